@@ -0,0 +1,172 @@
+#include "Utils.h"
+
+#include <Core/Algorithms.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+    /*
+     * A square lattice of points, with the springs of each cell laid out as
+     * perfect squares - as large ships are after the ship factory's reordering.
+     */
+    struct LatticePoints
+    {
+        vec2f const * GetPositionBufferAsVec2() const
+        {
+            return PositionBuffer.get();
+        }
+
+        vec2f const * GetVelocityBufferAsVec2() const
+        {
+            return VelocityBuffer.get();
+        }
+
+        unique_aligned_buffer<vec2f> PositionBuffer;
+        unique_aligned_buffer<vec2f> VelocityBuffer;
+    };
+
+    struct LatticeSprings
+    {
+        using Endpoints = SpringEndpoints;
+
+        ElementCount GetPerfectSquareCount() const
+        {
+            return PerfectSquareCount;
+        }
+
+        Endpoints const * GetEndpointsBuffer() const
+        {
+            return EndpointsBuffer.get();
+        }
+
+        float const * GetRestLengthBuffer() const
+        {
+            return RestLengthBuffer.get();
+        }
+
+        float const * GetStiffnessCoefficientBuffer() const
+        {
+            return StiffnessCoefficientBuffer.get();
+        }
+
+        float const * GetDampingCoefficientBuffer() const
+        {
+            return DampingCoefficientBuffer.get();
+        }
+
+        ElementCount PerfectSquareCount;
+        unique_aligned_buffer<Endpoints> EndpointsBuffer;
+        unique_aligned_buffer<float> RestLengthBuffer;
+        unique_aligned_buffer<float> StiffnessCoefficientBuffer;
+        unique_aligned_buffer<float> DampingCoefficientBuffer;
+    };
+
+    void MakeLattice(
+        size_t width,
+        LatticePoints & points,
+        LatticeSprings & springs)
+    {
+        size_t const pointCount = MakeSize((width + 1) * (width + 1));
+
+        points.PositionBuffer = MakeVectors(pointCount);
+        points.VelocityBuffer = MakeVectors(pointCount);
+
+        for (size_t y = 0; y <= width; ++y)
+        {
+            for (size_t x = 0; x <= width; ++x)
+            {
+                // Slightly off the rest lengths, so that springs are all under stress
+                points.PositionBuffer[y * (width + 1) + x] = vec2f(static_cast<float>(x) * 1.01f, static_cast<float>(y) * 0.99f);
+            }
+        }
+
+        size_t const springCount = width * width * 4;
+
+        springs.PerfectSquareCount = static_cast<ElementCount>(width * width);
+        springs.EndpointsBuffer = make_unique_buffer_aligned_to_vectorization_word<SpringEndpoints>(springCount);
+        springs.RestLengthBuffer = MakeFloats(springCount);
+        springs.StiffnessCoefficientBuffer = MakeFloats(springCount, 0.5f);
+        springs.DampingCoefficientBuffer = MakeFloats(springCount, 0.03f);
+
+        size_t s = 0;
+        for (size_t y = 0; y < width; ++y)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                ElementIndex const j = static_cast<ElementIndex>((y + 1) * (width + 1) + x);
+                ElementIndex const m = j + 1;
+                ElementIndex const k = static_cast<ElementIndex>(y * (width + 1) + x);
+                ElementIndex const l = k + 1;
+
+                // J-L, M-K, J-K, M-L, as the vectorized algorithms expect perfect squares
+                springs.EndpointsBuffer[s] = { j, l };
+                springs.RestLengthBuffer[s++] = 1.4142f;
+                springs.EndpointsBuffer[s] = { m, k };
+                springs.RestLengthBuffer[s++] = 1.4142f;
+                springs.EndpointsBuffer[s] = { j, k };
+                springs.RestLengthBuffer[s++] = 1.0f;
+                springs.EndpointsBuffer[s] = { m, l };
+                springs.RestLengthBuffer[s++] = 1.0f;
+            }
+        }
+    }
+}
+
+//
+// CPU baseline for offloading spring forces of very large ships; the argument
+// is the width - in points - of a square ship
+//
+
+static void ApplySpringsForces_Naive(benchmark::State & state)
+{
+    LatticePoints points;
+    LatticeSprings springs;
+    MakeLattice(static_cast<size_t>(state.range(0)), points, springs);
+
+    ElementCount const springCount = springs.PerfectSquareCount * 4;
+    auto dynamicForces = MakeVectors(MakeSize(static_cast<size_t>((state.range(0) + 1) * (state.range(0) + 1))));
+
+    for (auto _ : state)
+    {
+        Algorithms::ApplySpringsForces_Naive(
+            points,
+            springs,
+            0,
+            springCount,
+            dynamicForces.get());
+    }
+
+    benchmark::DoNotOptimize(dynamicForces);
+
+    state.SetItemsProcessed(state.iterations() * springCount);
+}
+BENCHMARK(ApplySpringsForces_Naive)->RangeMultiplier(4)->Range(64, 2048);
+
+static void ApplySpringsForces_Vectorized(benchmark::State & state)
+{
+    LatticePoints points;
+    LatticeSprings springs;
+    MakeLattice(static_cast<size_t>(state.range(0)), points, springs);
+
+    ElementCount const springCount = springs.PerfectSquareCount * 4;
+    auto dynamicForces = MakeVectors(MakeSize(static_cast<size_t>((state.range(0) + 1) * (state.range(0) + 1))));
+
+    for (auto _ : state)
+    {
+        // Picks the SSE or Neon variant, depending on the platform
+        Algorithms::ApplySpringsForces(
+            points,
+            springs,
+            0,
+            springCount,
+            dynamicForces.get());
+    }
+
+    benchmark::DoNotOptimize(dynamicForces);
+
+    state.SetItemsProcessed(state.iterations() * springCount);
+}
+BENCHMARK(ApplySpringsForces_Vectorized)->RangeMultiplier(4)->Range(64, 2048);
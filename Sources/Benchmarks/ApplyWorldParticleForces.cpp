@@ -0,0 +1,97 @@
+#include "Utils.h"
+
+#include <Core/Algorithms.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+static constexpr size_t SampleSize = 2000000;
+
+namespace {
+
+    struct BuoyancyCoefficients
+    {
+        float Coefficient1;
+        float Coefficient2;
+    };
+}
+
+static void ApplyWorldParticleForces_Naive(benchmark::State & state)
+{
+    auto const size = MakeSize(SampleSize);
+
+    auto depths = MakeFloats(size);
+    auto airWaterInterfaceInverseWidths = MakeFloats(size, 1.0f);
+    auto masses = MakeFloats(size);
+    std::vector<BuoyancyCoefficients> buoyancyCoefficients(size, BuoyancyCoefficients{ 10.0f, 0.1f });
+    auto temperatures = MakeFloats(size);
+    auto velocities = MakeVectors(size);
+    auto windReceptivities = MakeFloats(size);
+
+    auto outStaticForces = MakeVectors(size);
+
+    for (auto _ : state)
+    {
+        Algorithms::ApplyWorldParticleForces_Naive(
+            0,
+            static_cast<ElementIndex>(size),
+            depths.get(),
+            airWaterInterfaceInverseWidths.get(),
+            masses.get(),
+            buoyancyCoefficients.data(),
+            temperatures.get(),
+            velocities.get(),
+            windReceptivities.get(),
+            vec2f(0.0f, -9.80f),
+            1.2754f,
+            1000.0f,
+            0.0015f,
+            0.3f,
+            vec2f(10.0f, 0.0f),
+            outStaticForces.get());
+    }
+
+    benchmark::DoNotOptimize(outStaticForces);
+}
+BENCHMARK(ApplyWorldParticleForces_Naive);
+
+static void ApplyWorldParticleForces_Vectorized(benchmark::State & state)
+{
+    auto const size = MakeSize(SampleSize);
+
+    auto depths = MakeFloats(size);
+    auto airWaterInterfaceInverseWidths = MakeFloats(size, 1.0f);
+    auto masses = MakeFloats(size);
+    std::vector<BuoyancyCoefficients> buoyancyCoefficients(size, BuoyancyCoefficients{ 10.0f, 0.1f });
+    auto temperatures = MakeFloats(size);
+    auto velocities = MakeVectors(size);
+    auto windReceptivities = MakeFloats(size);
+
+    auto outStaticForces = MakeVectors(size);
+
+    for (auto _ : state)
+    {
+        // Picks the SSE or Neon variant, depending on the platform
+        Algorithms::ApplyWorldParticleForces(
+            0,
+            static_cast<ElementIndex>(size),
+            depths.get(),
+            airWaterInterfaceInverseWidths.get(),
+            masses.get(),
+            buoyancyCoefficients.data(),
+            temperatures.get(),
+            velocities.get(),
+            windReceptivities.get(),
+            vec2f(0.0f, -9.80f),
+            1.2754f,
+            1000.0f,
+            0.0015f,
+            0.3f,
+            vec2f(10.0f, 0.0f),
+            outStaticForces.get());
+    }
+
+    benchmark::DoNotOptimize(outStaticForces);
+}
+BENCHMARK(ApplyWorldParticleForces_Vectorized);
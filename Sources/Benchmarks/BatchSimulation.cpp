@@ -0,0 +1,693 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+
+/*
+ * Headless batch simulation: runs the ship x seed combinations of a scenario, each in a
+ * new world, stepping the simulation as fast as possible, and saves the outcome of each
+ * run - e.g. if and when the ship started sinking - to a JSON results file.
+ *
+ * Runs execute on --workers world threads, each world with its own random engine and game
+ * clock; a world thread picks the next run as soon as it's done with the previous one, so that
+ * small ships fill the processors left idle by large ones. With --isolate, each run executes
+ * instead in its own worker process, so that a run that crashes only fails itself.
+ *
+ * The game clock is advanced in lockstep with the simulation, so that clock-driven phenomena
+ * - e.g. storms - unfold in simulated time, however fast the simulation runs.
+ *
+ * Scenario file:
+ *
+ * {
+ *     "steps": 7680,                   // Mandatory
+ *     "ships": [ "a.shp2", ... ],      // Mandatory; relative to the scenario file
+ *     "seeds": [ 1, 2, ... ],          // Optional; defaults to the default seed
+ *     "simulation_threads": 1,         // Optional; per run
+ *     "storm": true,                   // Optional; triggers a storm at the start of each run
+ *     "stop_on_sinking": true,         // Optional; ends each run as soon as its ship starts sinking
+ *     "parameters": { "wind_speed_base": 40.0, ... } // Optional; see ParameterOverrides
+ * }
+ *
+ * Usage: BatchSimulation [--workers N] [--isolate] <scenario.json> <results.json>
+ */
+
+#include <Game/FileStreams.h>
+#include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/ISimulationEventHandlers.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameChronometer.h>
+#include <Core/GameException.h>
+#include <Core/GameRandomEngine.h>
+#include <Core/GameWallClock.h>
+#include <Core/PerfStats.h>
+#include <Core/SysSpecifics.h>
+#include <Core/TextureAtlas.h>
+#include <Core/ThreadManager.h>
+#include <Core/Utils.h>
+
+#include <picojson.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    struct Options
+    {
+        size_t WorkerCount;
+        bool DoIsolateJobs;
+        std::filesystem::path ScenarioFilePath;
+        std::filesystem::path ResultsFilePath;
+
+        // Set when we're a worker process
+        std::optional<size_t> JobIndex;
+        std::filesystem::path JobResultFilePath;
+    };
+
+    std::optional<Options> ParseOptions(int argc, char ** argv)
+    {
+        Options options{
+            ThreadManager::GetNumberOfPerformanceProcessors(),
+            false,
+            {},
+            {},
+            std::nullopt,
+            {} };
+
+        std::vector<std::filesystem::path> positionalArgs;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string const arg(argv[i]);
+            if (arg == "--workers" && i + 1 < argc)
+            {
+                options.WorkerCount = std::max(static_cast<size_t>(std::stoul(argv[++i])), size_t(1));
+            }
+            else if (arg == "--isolate")
+            {
+                options.DoIsolateJobs = true;
+            }
+            else if (arg == "--job" && i + 2 < argc)
+            {
+                options.JobIndex = static_cast<size_t>(std::stoul(argv[++i]));
+                options.JobResultFilePath = std::filesystem::path(argv[++i]);
+            }
+            else
+            {
+                positionalArgs.emplace_back(arg);
+            }
+        }
+
+        if (options.JobIndex.has_value() && positionalArgs.size() == 1)
+        {
+            options.ScenarioFilePath = positionalArgs[0];
+        }
+        else if (!options.JobIndex.has_value() && positionalArgs.size() == 2)
+        {
+            options.ScenarioFilePath = positionalArgs[0];
+            options.ResultsFilePath = positionalArgs[1];
+        }
+        else
+        {
+            return std::nullopt;
+        }
+
+        return options;
+    }
+
+    //
+    // Scenario
+    //
+
+    struct Job
+    {
+        std::filesystem::path ShipFilePath;
+        std::uint32_t Seed;
+    };
+
+    struct Scenario
+    {
+        size_t StepCount;
+        size_t SimulationThreadCount;
+        bool DoTriggerStorm;
+        bool DoStopOnSinking;
+        std::map<std::string, float> ParameterOverrides;
+        std::vector<Job> Jobs;
+    };
+
+    /*
+     * The simulation parameters that may be set by a scenario.
+     */
+    std::map<std::string, std::function<void(SimulationParameters &, float)>> const ParameterOverrides = {
+        { "wind_speed_base", [](SimulationParameters & p, float v) { p.WindSpeedBase = v; } },
+        { "wind_speed_max_factor", [](SimulationParameters & p, float v) { p.WindSpeedMaxFactor = v; } },
+        { "wind_gust_frequency_adjustment", [](SimulationParameters & p, float v) { p.WindGustFrequencyAdjustment = v; } },
+        { "basal_wave_height_adjustment", [](SimulationParameters & p, float v) { p.BasalWaveHeightAdjustment = v; } },
+        { "basal_wave_length_adjustment", [](SimulationParameters & p, float v) { p.BasalWaveLengthAdjustment = v; } },
+        { "basal_wave_speed_adjustment", [](SimulationParameters & p, float v) { p.BasalWaveSpeedAdjustment = v; } },
+        { "storm_strength_adjustment", [](SimulationParameters & p, float v) { p.StormStrengthAdjustment = v; } },
+        { "storm_duration_seconds", [](SimulationParameters & p, float v) { p.StormDuration = std::chrono::seconds(static_cast<std::chrono::seconds::rep>(v)); } },
+        { "rogue_wave_rate_seconds", [](SimulationParameters & p, float v) { p.RogueWaveRate = std::chrono::seconds(static_cast<std::chrono::seconds::rep>(v)); } },
+        { "sea_depth", [](SimulationParameters & p, float v) { p.SeaDepth = v; } },
+        { "water_density_adjustment", [](SimulationParameters & p, float v) { p.WaterDensityAdjustment = v; } },
+        { "water_intake_adjustment", [](SimulationParameters & p, float v) { p.WaterIntakeAdjustment = v; } },
+        { "spring_strength_adjustment", [](SimulationParameters & p, float v) { p.SpringStrengthAdjustment = v; } },
+    };
+
+    Scenario LoadScenario(std::filesystem::path const & scenarioFilePath)
+    {
+        picojson::value const scenarioJson = GameAssetManager::LoadJson(scenarioFilePath);
+        auto const & scenarioObject = Utils::GetJsonValueAsObject(scenarioJson, "scenario");
+
+        Scenario scenario{
+            Utils::GetMandatoryJsonMember<size_t>(scenarioObject, "steps"),
+            static_cast<size_t>(std::max(Utils::GetOptionalJsonMember<int>(scenarioObject, "simulation_threads", 1), 1)),
+            Utils::GetOptionalJsonMember<bool>(scenarioObject, "storm", false),
+            Utils::GetOptionalJsonMember<bool>(scenarioObject, "stop_on_sinking", false),
+            {},
+            {} };
+
+        auto const parametersObject = Utils::GetOptionalJsonObject(scenarioObject, "parameters");
+        if (parametersObject.has_value())
+        {
+            for (auto const & [name, value] : *parametersObject)
+            {
+                if (ParameterOverrides.count(name) == 0)
+                {
+                    throw GameException("Unrecognized simulation parameter \"" + name + "\"");
+                }
+
+                scenario.ParameterOverrides[name] = Utils::GetJsonValueAs<float>(value, name);
+            }
+        }
+
+        std::vector<std::uint32_t> seeds;
+        auto const seedsArray = Utils::GetOptionalJsonArray(scenarioObject, "seeds");
+        if (seedsArray.has_value())
+        {
+            for (auto const & seedValue : *seedsArray)
+            {
+                seeds.push_back(static_cast<std::uint32_t>(Utils::GetJsonValueAs<std::int64_t>(seedValue, "seeds")));
+            }
+        }
+        else
+        {
+            seeds.push_back(GameRandomEngine::DefaultSeed);
+        }
+
+        auto const shipsArray = Utils::GetMandatoryJsonArray(scenarioObject, "ships");
+        for (auto const & shipValue : shipsArray)
+        {
+            std::filesystem::path const shipFilePath = scenarioFilePath.parent_path() / Utils::GetJsonValueAs<std::string>(shipValue, "ships");
+            for (auto const seed : seeds)
+            {
+                scenario.Jobs.push_back({ shipFilePath, seed });
+            }
+        }
+
+        return scenario;
+    }
+
+    //
+    // Running
+    //
+
+    /*
+     * The process-wide state needed to run jobs.
+     */
+    struct SimulationContext
+    {
+        ThreadManager & TheThreadManager;
+        GameAssetManager const & TheGameAssetManager;
+        MaterialDatabase const & TheMaterialDatabase;
+        FishSpeciesDatabase const & TheFishSpeciesDatabase;
+        NpcDatabase const & TheNpcDatabase;
+        ShipTexturizer const & TheShipTexturizer;
+        ShipStrengthRandomizer const & TheShipStrengthRandomizer;
+        OceanFloorHeightMap const & TheOceanFloorHeightMap;
+    };
+
+    class RunStatistics final : public IStructuralShipEventHandler, public IGenericShipEventHandler
+    {
+    public:
+
+        std::optional<float> SinkingBeginSimulationTime;
+        std::uint64_t BrokenCount = 0;
+        std::uint64_t DestroyedCount = 0;
+        float WaterTaken = 0.0f;
+
+        // Set before each step
+        float CurrentSimulationTime = 0.0f;
+
+        void OnBreak(
+            StructuralMaterial const & /*structuralMaterial*/,
+            bool /*isUnderwater*/,
+            unsigned int size) override
+        {
+            BrokenCount += size;
+        }
+
+        void OnDestroy(
+            StructuralMaterial const & /*structuralMaterial*/,
+            bool /*isUnderwater*/,
+            unsigned int size) override
+        {
+            DestroyedCount += size;
+        }
+
+        void OnSinkingBegin(ShipId /*shipId*/) override
+        {
+            if (!SinkingBeginSimulationTime.has_value())
+            {
+                SinkingBeginSimulationTime = CurrentSimulationTime;
+            }
+        }
+
+        void OnWaterTaken(float waterTaken) override
+        {
+            WaterTaken += waterTaken;
+        }
+    };
+
+    picojson::object RunJob(
+        Job const & job,
+        Scenario const & scenario,
+        SimulationContext const & context)
+    {
+        GameRandomEngine::GetInstance().Reseed(job.Seed);
+
+        SimulationParameters simulationParameters;
+        for (auto const & [name, value] : scenario.ParameterOverrides)
+        {
+            ParameterOverrides.at(name)(simulationParameters, value);
+        }
+
+        ViewModel const viewModel(
+            FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+            1.0f,
+            vec2f::zero(),
+            DisplayLogicalSize(1920, 1080),
+            1);
+
+        SimulationEventDispatcher simulationEventDispatcher;
+
+        RunStatistics runStatistics;
+        simulationEventDispatcher.RegisterStructuralShipEventHandler(&runStatistics);
+        simulationEventDispatcher.RegisterGenericShipEventHandler(&runStatistics);
+
+        Physics::World world(
+            OceanFloorHeightMap(context.TheOceanFloorHeightMap),
+            context.TheFishSpeciesDatabase,
+            context.TheNpcDatabase,
+            simulationEventDispatcher,
+            simulationParameters);
+
+        auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+            world.GetNextShipId(),
+            world,
+            ShipDeSerializer::LoadShip(job.ShipFilePath, context.TheMaterialDatabase, context.TheThreadManager),
+            ShipLoadOptions(),
+            context.TheMaterialDatabase,
+            context.TheShipTexturizer,
+            context.TheShipStrengthRandomizer,
+            simulationEventDispatcher,
+            context.TheGameAssetManager,
+            simulationParameters,
+            context.TheThreadManager);
+
+        ShipId const shipId = ship->GetId();
+
+        world.AddShip(std::move(ship));
+        world.Announce();
+        simulationEventDispatcher.Flush();
+
+        if (scenario.DoTriggerStorm)
+        {
+            world.TriggerStorm();
+        }
+
+        //
+        // Run
+        //
+
+        auto constexpr StepWallClockDuration = std::chrono::duration_cast<GameWallClock::duration>(
+            std::chrono::duration<float>(SimulationParameters::SimulationStepTimeDuration<float>));
+
+        PerfStats perfStats;
+
+        auto const startTime = GameChronometer::Now();
+
+        size_t stepCount = 0;
+        while (stepCount < scenario.StepCount)
+        {
+            runStatistics.CurrentSimulationTime = world.GetCurrentSimulationTime();
+
+            world.Update(
+                simulationParameters,
+                viewModel,
+                StressRenderModeType::None,
+                context.TheThreadManager,
+                perfStats);
+
+            simulationEventDispatcher.Flush();
+
+            GameWallClock::GetInstance().AdvancePaused(StepWallClockDuration);
+
+            ++stepCount;
+
+            if (scenario.DoStopOnSinking && runStatistics.SinkingBeginSimulationTime.has_value())
+            {
+                break;
+            }
+        }
+
+        auto const elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(GameChronometer::Now() - startTime);
+
+        //
+        // Make result
+        //
+
+        picojson::object result;
+
+        result["ship"] = picojson::value(job.ShipFilePath.filename().string());
+        result["seed"] = picojson::value(static_cast<std::int64_t>(job.Seed));
+        result["point_count"] = picojson::value(static_cast<std::int64_t>(world.GetShipPointCount(shipId)));
+        result["steps"] = picojson::value(static_cast<std::int64_t>(stepCount));
+        result["simulation_time_seconds"] = picojson::value(static_cast<double>(world.GetCurrentSimulationTime()));
+        result["elapsed_ms"] = picojson::value(elapsed.count());
+        result["steps_per_second"] = picojson::value(elapsed.count() > 0.0 ? static_cast<double>(stepCount) * 1000.0 / elapsed.count() : 0.0);
+        result["sinking_begin_seconds"] = runStatistics.SinkingBeginSimulationTime.has_value()
+            ? picojson::value(static_cast<double>(*runStatistics.SinkingBeginSimulationTime))
+            : picojson::value();
+        result["broken_count"] = picojson::value(static_cast<std::int64_t>(runStatistics.BrokenCount));
+        result["destroyed_count"] = picojson::value(static_cast<std::int64_t>(runStatistics.DestroyedCount));
+        result["water_taken"] = picojson::value(static_cast<double>(runStatistics.WaterTaken));
+
+        return result;
+    }
+
+    picojson::object MakeErrorResult(
+        Job const & job,
+        std::string const & errorMessage)
+    {
+        picojson::object result;
+
+        result["ship"] = picojson::value(job.ShipFilePath.filename().string());
+        result["seed"] = picojson::value(static_cast<std::int64_t>(job.Seed));
+        result["error"] = picojson::value(errorMessage);
+
+        return result;
+    }
+
+    /*
+     * Runs the specified jobs in this process, on the specified number of world threads; each
+     * world thread runs one world at a time, with its own random engine and game clock, and
+     * picks the next job as soon as it's done with the previous one.
+     */
+    std::vector<picojson::object> RunJobs(
+        std::vector<size_t> const & jobIndices,
+        size_t worldThreadCount,
+        Scenario const & scenario,
+        std::string const & argv0)
+    {
+        //
+        // Load the read-only state shared by all worlds
+        //
+
+        GameAssetManager const gameAssetManager{ argv0 };
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+        FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+        NpcDatabase const npcDatabase = NpcDatabase::Load(gameAssetManager, materialDatabase, npcTextureAtlas);
+
+        OceanFloorHeightMap const oceanFloorHeightMap = OceanFloorHeightMap::LoadFromImage(
+            gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath()));
+
+        //
+        // Run worlds
+        //
+
+        std::vector<picojson::object> results(jobIndices.size());
+
+        std::atomic<size_t> nextJobIndexIndex(0);
+
+        auto const worldThreadLoop = [&](size_t worldThreadIndex)
+        {
+            ThreadManager threadManager(
+                false,
+                scenario.SimulationThreadCount,
+                [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+            threadManager.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "FS World Thread " + std::to_string(worldThreadIndex), 0);
+
+            // We're simulating all along
+            threadManager.SetIsSimulationActive(true);
+
+            // Not shared, as it caches textures
+            ShipTexturizer const shipTexturizer(materialDatabase, gameAssetManager);
+            ShipStrengthRandomizer const shipStrengthRandomizer;
+
+            // This thread's own context; clock-driven phenomena follow the simulation
+            GameRandomEngine randomEngine;
+            GameRandomEngine::ThreadBinding const randomEngineBinding(&randomEngine);
+            GameWallClock wallClock;
+            wallClock.SetPaused(true);
+            GameWallClock::ThreadBinding const wallClockBinding(&wallClock);
+
+            SimulationContext const context{
+                threadManager,
+                gameAssetManager,
+                materialDatabase,
+                fishSpeciesDatabase,
+                npcDatabase,
+                shipTexturizer,
+                shipStrengthRandomizer,
+                oceanFloorHeightMap };
+
+            for (size_t i = nextJobIndexIndex.fetch_add(1); i < jobIndices.size(); i = nextJobIndexIndex.fetch_add(1))
+            {
+                Job const & job = scenario.Jobs[jobIndices[i]];
+
+                try
+                {
+                    results[i] = RunJob(job, scenario, context);
+                }
+                catch (std::exception const & ex)
+                {
+                    results[i] = MakeErrorResult(job, ex.what());
+                }
+            }
+        };
+
+        worldThreadCount = std::max(std::min(worldThreadCount, jobIndices.size()), size_t(1));
+
+        std::vector<std::thread> worldThreads;
+        for (size_t t = 1; t < worldThreadCount; ++t)
+        {
+            worldThreads.emplace_back(worldThreadLoop, t);
+        }
+
+        // This thread plays along
+        worldThreadLoop(0);
+
+        for (auto & worldThread : worldThreads)
+        {
+            worldThread.join();
+        }
+
+        return results;
+    }
+
+    std::string QuoteCommandLineArgument(std::string const & arg)
+    {
+        return "\"" + arg + "\"";
+    }
+
+    /*
+     * Runs all jobs in worker processes, each job in its own process, with at most the
+     * specified number of processes at any time.
+     */
+    std::vector<picojson::object> FarmJobs(
+        Options const & options,
+        Scenario const & scenario,
+        std::string const & argv0)
+    {
+        std::vector<picojson::object> results(scenario.Jobs.size());
+
+        std::atomic<size_t> nextJobIndex(0);
+
+        auto const workerLoop = [&]()
+        {
+            for (size_t jobIndex = nextJobIndex.fetch_add(1); jobIndex < scenario.Jobs.size(); jobIndex = nextJobIndex.fetch_add(1))
+            {
+                std::filesystem::path const jobResultFilePath =
+                    options.ResultsFilePath.string() + ".job" + std::to_string(jobIndex);
+
+                std::string commandLine =
+                    QuoteCommandLineArgument(argv0)
+                    + " --job " + std::to_string(jobIndex) + " " + QuoteCommandLineArgument(jobResultFilePath.string())
+                    + " " + QuoteCommandLineArgument(options.ScenarioFilePath.string());
+
+#if FS_IS_OS_WINDOWS()
+                // cmd strips the outermost quotes
+                commandLine = "\"" + commandLine + "\"";
+#endif
+
+                // The worker's own output would only interleave with the other workers'
+                commandLine += FS_IS_OS_WINDOWS() ? " > NUL 2>&1" : " > /dev/null 2>&1";
+
+                int const exitCode = std::system(commandLine.c_str());
+
+                try
+                {
+                    if (exitCode != 0 || !std::filesystem::exists(jobResultFilePath))
+                    {
+                        throw GameException("Worker process failed with exit code " + std::to_string(exitCode));
+                    }
+
+                    results[jobIndex] = Utils::GetJsonValueAsObject(GameAssetManager::LoadJson(jobResultFilePath), "result");
+                }
+                catch (std::exception const & ex)
+                {
+                    results[jobIndex] = MakeErrorResult(scenario.Jobs[jobIndex], ex.what());
+                }
+
+                std::error_code ec;
+                std::filesystem::remove(jobResultFilePath, ec);
+
+                std::cout << "Job " << (jobIndex + 1) << "/" << scenario.Jobs.size() << " completed: "
+                    << scenario.Jobs[jobIndex].ShipFilePath.filename().string() << " (seed " << scenario.Jobs[jobIndex].Seed << ")" << std::endl;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t w = 0; w < std::min(options.WorkerCount, scenario.Jobs.size()); ++w)
+        {
+            workers.emplace_back(workerLoop);
+        }
+
+        for (auto & worker : workers)
+        {
+            worker.join();
+        }
+
+        return results;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    std::optional<Options> const options = ParseOptions(argc, argv);
+    if (!options.has_value())
+    {
+        std::cout << "Usage: BatchSimulation [--workers N] [--isolate] <scenario.json> <results.json>" << std::endl;
+        return 1;
+    }
+
+    std::string const argv0(argv[0]);
+
+    try
+    {
+        Scenario const scenario = LoadScenario(options->ScenarioFilePath);
+
+        if (options->JobIndex.has_value())
+        {
+            //
+            // Worker process
+            //
+
+            if (*options->JobIndex >= scenario.Jobs.size())
+            {
+                throw GameException("Job " + std::to_string(*options->JobIndex) + " is not in the scenario");
+            }
+
+            auto const results = RunJobs({ *options->JobIndex }, 1, scenario, argv0);
+
+            GameAssetManager::SaveJson(picojson::value(results[0]), options->JobResultFilePath);
+
+            return 0;
+        }
+
+        //
+        // Run all jobs
+        //
+
+        std::cout << "Jobs: " << scenario.Jobs.size() << "  Steps: " << scenario.StepCount << "  Workers: " << options->WorkerCount << std::endl;
+
+        auto const startTime = GameChronometer::Now();
+
+        std::vector<picojson::object> results;
+        if (!options->DoIsolateJobs)
+        {
+            std::vector<size_t> jobIndices(scenario.Jobs.size());
+            for (size_t j = 0; j < jobIndices.size(); ++j)
+            {
+                jobIndices[j] = j;
+            }
+
+            results = RunJobs(jobIndices, options->WorkerCount, scenario, argv0);
+        }
+        else
+        {
+            results = FarmJobs(*options, scenario, argv0);
+        }
+
+        auto const elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(GameChronometer::Now() - startTime);
+
+        //
+        // Save results
+        //
+
+        picojson::array resultsArray;
+        for (auto & result : results)
+        {
+            resultsArray.emplace_back(std::move(result));
+        }
+
+        picojson::object resultsObject;
+        resultsObject["scenario"] = picojson::value(options->ScenarioFilePath.filename().string());
+        resultsObject["elapsed_seconds"] = picojson::value(elapsed.count());
+        resultsObject["results"] = picojson::value(std::move(resultsArray));
+
+        GameAssetManager::SaveJson(picojson::value(std::move(resultsObject)), options->ResultsFilePath);
+
+        std::cout << "Results saved to " << options->ResultsFilePath.string() << " (" << elapsed.count() << " s)" << std::endl;
+    }
+    catch (std::exception const & ex)
+    {
+        std::cout << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
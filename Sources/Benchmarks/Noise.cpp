@@ -0,0 +1,47 @@
+#include "Utils.h"
+
+#include <Core/Noise.h>
+#include <Core/ThreadManager.h>
+#include <Core/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+//
+// The fractal Perlin noise textures generated at startup; the argument is
+// the size of the square texture
+//
+
+static void Noise_Perlin_Serial(benchmark::State & state)
+{
+    IntegralRectSize const size(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        auto noise = Noise::CreateRepeatableFractal2DPerlinNoise(size, 8, 1024, 0.73f);
+        benchmark::DoNotOptimize(noise);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size.GetLinearSize());
+}
+BENCHMARK(Noise_Perlin_Serial)->RangeMultiplier(2)->Range(256, 1024);
+
+static void Noise_Perlin_Parallel(benchmark::State & state)
+{
+    IntegralRectSize const size(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+    size_t const parallelism = std::max(std::thread::hardware_concurrency(), 1u);
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool threadPool(ThreadManager::ThreadTaskKind::Simulation, parallelism, threadManager);
+
+    for (auto _ : state)
+    {
+        auto noise = Noise::CreateRepeatableFractal2DPerlinNoise(size, 8, 1024, 0.73f, threadPool);
+        benchmark::DoNotOptimize(noise);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size.GetLinearSize());
+}
+BENCHMARK(Noise_Perlin_Parallel)->RangeMultiplier(2)->Range(256, 1024);
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <array>
 #include <limits>
 
 static constexpr size_t Size = 200000000;
@@ -96,6 +97,41 @@ static void PrecalculatedFunction_LinearlyInterpolatedPeriodic_256(benchmark::St
 }
 BENCHMARK(PrecalculatedFunction_LinearlyInterpolatedPeriodic_256);
 
+template<size_t SamplesCount>
+static void PrecalculatedFunction_LinearlyInterpolatedPeriodic_Batch(benchmark::State& state)
+{
+    PrecalculatedFunction<SamplesCount> pf(
+        [](float x)
+        {
+            return sin(2.0f * Pi<float> * x);
+        });
+
+    auto floats = MakeFloats(Size);
+
+    std::array<float, 1024> values;
+
+    float result = 0.0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < Size; i += values.size())
+        {
+            size_t const count = std::min(values.size(), Size - i);
+
+            pf.GetLinearlyInterpolatedPeriodic(floats.get() + i, values.data(), count);
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                result += values[j];
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(result);
+}
+BENCHMARK_TEMPLATE(PrecalculatedFunction_LinearlyInterpolatedPeriodic_Batch, 8192);
+BENCHMARK_TEMPLATE(PrecalculatedFunction_LinearlyInterpolatedPeriodic_Batch, 2048);
+BENCHMARK_TEMPLATE(PrecalculatedFunction_LinearlyInterpolatedPeriodic_Batch, 256);
+
 static void PrecalculatedFunction_LinearlyInterpolatedPeriodic_WithPhaseArgAdjustment(benchmark::State& state)
 {
     PrecalculatedFunction<8192> pf(
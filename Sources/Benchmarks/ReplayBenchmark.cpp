@@ -0,0 +1,371 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+
+/*
+ * Headless performance regression test: loads a ship, and replays onto it an interaction
+ * session recorded with GameController::StartRecordingEvents(), stepping the world at the
+ * fixed simulation step until all of the session's events have been replayed - each at the
+ * simulation time it was recorded at - and then for the specified number of steps.
+ *
+ * The average duration of each phase is then compared against a baseline, failing when a phase
+ * regresses by more than the threshold; phases whose baseline is below the noise floor are
+ * reported but not checked. With --write-baseline, the baseline is (re-)written instead.
+ *
+ * Baselines are text files with one "<phase> <milliseconds>" line per phase, and are only
+ * meaningful on the machine - and with the thread count - they were written with.
+ *
+ * Usage: ReplayBenchmark [--steps N] [--seed S] [--threads T] [--threshold P] [--baseline B] [--write-baseline] <ship.shp2> <events>
+ */
+
+#include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/EventRecorder.h>
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameException.h>
+#include <Core/GameRandomEngine.h>
+#include <Core/PerfStats.h>
+#include <Core/TextureAtlas.h>
+#include <Core/ThreadManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    // Phases faster than this are too noisy to be checked
+    float constexpr NoiseFloorMs = 0.05f;
+
+    struct Options
+    {
+        size_t StepCount;
+        std::uint32_t Seed;
+        size_t ThreadCount;
+        float ThresholdFraction;
+        std::optional<std::filesystem::path> BaselineFilePath;
+        bool DoWriteBaseline;
+        std::vector<std::filesystem::path> FilePaths;
+    };
+
+    Options ParseOptions(int argc, char ** argv)
+    {
+        Options options{
+            200,
+            GameRandomEngine::DefaultSeed,
+            ThreadManager::GetNumberOfProcessors(),
+            0.1f,
+            std::nullopt,
+            false,
+            {} };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string const arg(argv[i]);
+            if ((arg == "--steps" || arg == "--seed" || arg == "--threads") && i + 1 < argc)
+            {
+                auto const value = std::stoul(argv[++i]);
+                if (arg == "--steps")
+                    options.StepCount = static_cast<size_t>(value);
+                else if (arg == "--seed")
+                    options.Seed = static_cast<std::uint32_t>(value);
+                else
+                    options.ThreadCount = std::max(static_cast<size_t>(value), size_t(1));
+            }
+            else if (arg == "--threshold" && i + 1 < argc)
+            {
+                options.ThresholdFraction = std::stof(argv[++i]) / 100.0f;
+            }
+            else if (arg == "--baseline" && i + 1 < argc)
+            {
+                options.BaselineFilePath = std::filesystem::path(argv[++i]);
+            }
+            else if (arg == "--write-baseline")
+            {
+                options.DoWriteBaseline = true;
+            }
+            else
+            {
+                options.FilePaths.emplace_back(arg);
+            }
+        }
+
+        return options;
+    }
+
+    std::map<std::string, float> LoadBaseline(std::filesystem::path const & baselineFilePath)
+    {
+        std::ifstream file(baselineFilePath);
+        if (!file.is_open())
+        {
+            throw GameException("Cannot open baseline file \"" + baselineFilePath.string() + "\"");
+        }
+
+        std::map<std::string, float> baseline;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream lineStream(line);
+            std::string name;
+            float ms;
+            if (lineStream >> name >> ms)
+            {
+                baseline[name] = ms;
+            }
+        }
+
+        return baseline;
+    }
+
+    void SaveBaseline(
+        std::map<std::string, float> const & phases,
+        std::filesystem::path const & baselineFilePath)
+    {
+        std::ofstream file(baselineFilePath, std::ios_base::out | std::ios_base::trunc);
+        if (!file.is_open())
+        {
+            throw GameException("Cannot create baseline file \"" + baselineFilePath.string() + "\"");
+        }
+
+        for (auto const & [name, ms] : phases)
+        {
+            file << name << " " << std::fixed << std::setprecision(4) << ms << std::endl;
+        }
+    }
+
+    std::map<std::string, float> GetPhases(PerfStats const & perfStats)
+    {
+        std::map<std::string, float> phases;
+
+        for (size_t m = 0; m <= static_cast<size_t>(PerfMeasurement::_Last); ++m)
+        {
+            PerfMeasurement const measurement = static_cast<PerfMeasurement>(m);
+
+            float const averageMs = perfStats.GetMeasurement(measurement).ToRatio<std::chrono::microseconds>() / 1000.0f;
+            if (averageMs != 0.0f)
+            {
+                phases[GetPerfMeasurementInfo(measurement).Name] = averageMs;
+            }
+        }
+
+        return phases;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    Options const options = ParseOptions(argc, argv);
+    if (options.FilePaths.size() != 2 || (options.DoWriteBaseline && !options.BaselineFilePath.has_value()))
+    {
+        std::cout << "Usage: ReplayBenchmark [--steps N] [--seed S] [--threads T] [--threshold P] [--baseline B] [--write-baseline] <ship.shp2> <events>" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path const & shipFilePath = options.FilePaths[0];
+    std::filesystem::path const & eventsFilePath = options.FilePaths[1];
+
+    try
+    {
+        //
+        // Initialize
+        //
+
+        ThreadManager threadManager(
+            false,
+            options.ThreadCount,
+            [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+        threadManager.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "FS Main Thread", 0);
+
+        GameAssetManager const gameAssetManager{ std::string(argv[0]) };
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+        FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+        NpcDatabase const npcDatabase = NpcDatabase::Load(gameAssetManager, materialDatabase, npcTextureAtlas);
+        ShipTexturizer const shipTexturizer(materialDatabase, gameAssetManager);
+        ShipStrengthRandomizer const shipStrengthRandomizer;
+
+        OceanFloorHeightMap const oceanFloorHeightMap = OceanFloorHeightMap::LoadFromImage(
+            gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath()));
+
+        SimulationParameters const simulationParameters;
+
+        ViewModel const viewModel(
+            FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+            1.0f,
+            vec2f::zero(),
+            DisplayLogicalSize(1920, 1080),
+            1);
+
+        RecordedEvents const recordedEvents = RecordedEvents::Load(eventsFilePath);
+
+        //
+        // Load ship
+        //
+
+        GameRandomEngine::GetInstance().Reseed(options.Seed);
+
+        SimulationEventDispatcher simulationEventDispatcher;
+
+        Physics::World world(
+            OceanFloorHeightMap(oceanFloorHeightMap),
+            fishSpeciesDatabase,
+            npcDatabase,
+            simulationEventDispatcher,
+            simulationParameters);
+
+        auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+            world.GetNextShipId(),
+            world,
+            ShipDeSerializer::LoadShip(shipFilePath, materialDatabase, threadManager),
+            ShipLoadOptions(),
+            materialDatabase,
+            shipTexturizer,
+            shipStrengthRandomizer,
+            simulationEventDispatcher,
+            gameAssetManager,
+            simulationParameters,
+            threadManager);
+
+        world.AddShip(std::move(ship));
+        world.Announce();
+        simulationEventDispatcher.Flush();
+
+        std::cout << shipFilePath.filename().string() << ": " << recordedEvents.GetSize() << " events, then " << options.StepCount << " steps"
+            << "  Seed: " << options.Seed << "  Simulation parallelism: " << threadManager.GetSimulationParallelism() << std::endl;
+
+        //
+        // Replay
+        //
+
+        PerfStats perfStats;
+
+        size_t stepCount = 0;
+        size_t nextEvent = 0;
+        size_t remainingStepCount = options.StepCount;
+        while (nextEvent < recordedEvents.GetSize() || remainingStepCount > 0)
+        {
+            // Replay all events that are due by now; events without a time of their own follow the one before them
+            while (nextEvent < recordedEvents.GetSize())
+            {
+                RecordedEvent const & event = recordedEvents.GetEvent(nextEvent);
+                if (event.GetType() == RecordedEvent::RecordedEventType::PointDetachForDestroy
+                    && event.GetSimulationTime() > world.GetCurrentSimulationTime())
+                {
+                    break;
+                }
+
+                world.ReplayRecordedEvent(event, simulationParameters);
+                ++nextEvent;
+            }
+
+            {
+                ScopedPerfMeasurement<PerfMeasurement::TotalNetUpdate> const perfMeasurement(perfStats);
+
+                world.Update(
+                    simulationParameters,
+                    viewModel,
+                    StressRenderModeType::None,
+                    threadManager,
+                    perfStats);
+            }
+
+            simulationEventDispatcher.Flush();
+
+            ++stepCount;
+            if (nextEvent == recordedEvents.GetSize() && remainingStepCount > 0)
+            {
+                --remainingStepCount;
+            }
+        }
+
+        std::cout << "Steps: " << stepCount << std::endl;
+
+        //
+        // Compare or write baseline
+        //
+
+        auto const phases = GetPhases(perfStats);
+
+        if (options.DoWriteBaseline)
+        {
+            SaveBaseline(phases, *options.BaselineFilePath);
+
+            for (auto const & [name, ms] : phases)
+            {
+                std::cout << "  " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ms << " ms" << std::endl;
+            }
+
+            std::cout << "Baseline written to \"" << options.BaselineFilePath->string() << "\"" << std::endl;
+
+            return 0;
+        }
+
+        std::map<std::string, float> const baseline = options.BaselineFilePath.has_value()
+            ? LoadBaseline(*options.BaselineFilePath)
+            : std::map<std::string, float>();
+
+        size_t regressionCount = 0;
+        for (auto const & [name, ms] : phases)
+        {
+            std::cout << "  " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << ms << " ms";
+
+            auto const baselineIt = baseline.find(name);
+            if (baselineIt != baseline.end())
+            {
+                float const change = ms / baselineIt->second - 1.0f;
+
+                std::cout << "  (baseline " << std::setw(8) << baselineIt->second << " ms, " << std::showpos << std::setprecision(1) << change * 100.0f << std::noshowpos << "%)";
+
+                if (baselineIt->second >= NoiseFloorMs && change > options.ThresholdFraction)
+                {
+                    std::cout << "  REGRESSION";
+                    ++regressionCount;
+                }
+            }
+
+            std::cout << std::endl;
+        }
+
+        if (regressionCount > 0)
+        {
+            std::cout << regressionCount << " phase(s) regressed by more than " << std::setprecision(0) << options.ThresholdFraction * 100.0f << "%" << std::endl;
+            return 2;
+        }
+    }
+    catch (std::exception const & ex)
+    {
+        std::cout << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,374 @@
+#include <Game/FileStreams.h>
+#include <Game/FileSystem.h>
+#include <Game/GameAssetManager.h>
+#include <Game/GameVersion.h>
+#include <Game/ShipLegacyFormatDeSerializer.h>
+#include <Game/ShipPreviewImageDatabase.h>
+
+#include <Simulation/Layers.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/ShipDefinition.h>
+#include <Simulation/ShipDefinitionFormatDeSerializer.h>
+
+#include <Core/ImageData.h>
+#include <Core/GameTypes.h>
+#include <Core/MemoryStreams.h>
+#include <Core/PngTools.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+//
+// A reproducible corpus of synthetic ships - small, medium, and huge - made of
+// hull-shaped structures cycling through all materials, with a noisy texture
+// so that PNG compression does some actual work.
+//
+// Benchmarks take the index of the corpus ship as their argument.
+//
+
+static constexpr ShipSpaceSize CorpusShipSizes[] = {
+    ShipSpaceSize(100, 40),
+    ShipSpaceSize(400, 160),
+    ShipSpaceSize(1600, 640)
+};
+
+static constexpr int TextureMagnificationFactor = 2;
+
+static constexpr size_t PreviewDatabaseShipCount = 50;
+static constexpr ImageSize PreviewImageSize = ImageSize(200, 100);
+
+static MaterialDatabase const & GetMaterialDatabase()
+{
+    static GameAssetManager const gameAssetManager = GameAssetManager((std::filesystem::current_path() / "Data").string());
+    static MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+    return materialDatabase;
+}
+
+static std::filesystem::path GetScratchDirectory()
+{
+    std::filesystem::path const scratchDirectory = std::filesystem::temp_directory_path() / "FloatingSandboxBenchmarks";
+    std::filesystem::create_directories(scratchDirectory);
+    return scratchDirectory;
+}
+
+// Deterministic, platform-independent pseudo-random sequence
+static std::uint32_t NextRandom(std::uint32_t & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+static bool IsHull(
+    int x,
+    int y,
+    ShipSpaceSize const & shipSize)
+{
+    // A hull tapering towards the keel, with a superstructure in the middle
+    int const hullHeight = shipSize.height / 2;
+    if (y < hullHeight)
+    {
+        int const inset = (hullHeight - y) * shipSize.width / (4 * hullHeight);
+        return x >= inset && x < shipSize.width - inset;
+    }
+    else
+    {
+        return x >= shipSize.width / 3 && x < shipSize.width * 2 / 3;
+    }
+}
+
+static std::vector<StructuralMaterial const *> GetAllStructuralMaterials()
+{
+    std::vector<StructuralMaterial const *> materials;
+    for (auto const & category : GetMaterialDatabase().GetStructuralMaterialPalette().Categories)
+    {
+        for (auto const & subCategory : category.SubCategories)
+        {
+            for (auto const & material : subCategory.Materials)
+            {
+                materials.push_back(&material.get());
+            }
+        }
+    }
+
+    return materials;
+}
+
+static StructuralLayerData MakeStructuralLayer(ShipSpaceSize const & shipSize)
+{
+    auto const materials = GetAllStructuralMaterials();
+
+    StructuralLayerData structuralLayer(shipSize);
+    size_t currentMaterial = 0;
+    for (int y = 0; y < shipSize.height; ++y)
+    {
+        for (int x = 0; x < shipSize.width; ++x)
+        {
+            if (IsHull(x, y, shipSize))
+            {
+                // Runs of the same material, as in real ships
+                structuralLayer.Buffer[{x, y}].Material = materials[currentMaterial];
+                if ((x % 8) == 7)
+                {
+                    currentMaterial = (currentMaterial + 1) % materials.size();
+                }
+            }
+        }
+    }
+
+    return structuralLayer;
+}
+
+static RgbaImageData MakeTextureImage(ImageSize const & size)
+{
+    std::uint32_t randomState = 242;
+
+    RgbaImageData image(size);
+    for (int y = 0; y < size.height; ++y)
+    {
+        for (int x = 0; x < size.width; ++x)
+        {
+            std::uint8_t const noise = static_cast<std::uint8_t>(NextRandom(randomState) & 0x0f);
+            image[{x, y}] = rgbaColor(
+                static_cast<std::uint8_t>((x * 255) / size.width) ^ noise,
+                static_cast<std::uint8_t>((y * 255) / size.height) ^ noise,
+                static_cast<std::uint8_t>(0x80 + noise),
+                0xff);
+        }
+    }
+
+    return image;
+}
+
+static ShipDefinition MakeShipDefinition(ShipSpaceSize const & shipSize)
+{
+    ShipLayers layers(
+        shipSize,
+        std::make_unique<StructuralLayerData>(MakeStructuralLayer(shipSize)),
+        nullptr,
+        nullptr,
+        std::make_unique<TextureLayerData>(
+            MakeTextureImage(
+                ImageSize(
+                    shipSize.width * TextureMagnificationFactor,
+                    shipSize.height * TextureMagnificationFactor))),
+        nullptr);
+
+    return ShipDefinition(
+        std::move(layers),
+        ShipMetadata("BenchmarkShip"),
+        ShipPhysicsData(),
+        std::nullopt);
+}
+
+static MemoryBinaryWriteStream MakeShipDefinitionFile(ShipSpaceSize const & shipSize)
+{
+    MemoryBinaryWriteStream outputStream;
+    ShipDefinitionFormatDeSerializer::Save(
+        MakeShipDefinition(shipSize),
+        CurrentGameVersion,
+        outputStream);
+
+    return outputStream;
+}
+
+static std::filesystem::path MakeLegacyShipFile(ShipSpaceSize const & shipSize)
+{
+    auto const structuralLayer = MakeStructuralLayer(shipSize);
+
+    RgbImageData image(ImageSize(shipSize.width, shipSize.height));
+    for (int y = 0; y < shipSize.height; ++y)
+    {
+        for (int x = 0; x < shipSize.width; ++x)
+        {
+            StructuralMaterial const * material = structuralLayer.Buffer[{x, y}].Material;
+            image[{x, y}] = (material != nullptr) ? material->ColorKey : EmptyMaterialColorKey;
+        }
+    }
+
+    std::filesystem::path const filePath = GetScratchDirectory() / ("LegacyShip_" + std::to_string(shipSize.width) + ".png");
+
+    FileBinaryWriteStream outputStream(filePath);
+    PngTools::EncodeImage(image, outputStream);
+
+    return filePath;
+}
+
+static std::filesystem::path MakePreviewImageFilename(size_t s)
+{
+    return "Ship_" + std::to_string(s) + ".shp2";
+}
+
+static NewShipPreviewImageDatabase MakeNewPreviewDatabase(std::shared_ptr<IFileSystem> fileSystem)
+{
+    NewShipPreviewImageDatabase newDatabase(std::move(fileSystem));
+    for (size_t s = 0; s < PreviewDatabaseShipCount; ++s)
+    {
+        newDatabase.Add(
+            MakePreviewImageFilename(s),
+            std::filesystem::file_time_type(),
+            std::make_unique<RgbaImageData>(MakeTextureImage(PreviewImageSize)));
+    }
+
+    return newDatabase;
+}
+
+//
+// ShipDefinitionFormatDeSerializer
+//
+
+static void Serialization_ShipDefinitionFormat_Save(benchmark::State & state)
+{
+    ShipDefinition const shipDefinition = MakeShipDefinition(CorpusShipSizes[state.range(0)]);
+
+    for (auto _ : state)
+    {
+        MemoryBinaryWriteStream outputStream;
+        ShipDefinitionFormatDeSerializer::Save(
+            shipDefinition,
+            CurrentGameVersion,
+            outputStream);
+
+        benchmark::DoNotOptimize(outputStream.GetData());
+    }
+}
+BENCHMARK(Serialization_ShipDefinitionFormat_Save)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+static void Serialization_ShipDefinitionFormat_Load(benchmark::State & state)
+{
+    MemoryBinaryWriteStream const shipDefinitionFile = MakeShipDefinitionFile(CorpusShipSizes[state.range(0)]);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        MemoryBinaryReadStream inputStream = shipDefinitionFile.MakeReadStreamCopy();
+        state.ResumeTiming();
+
+        auto shipDefinition = ShipDefinitionFormatDeSerializer::Load(
+            inputStream,
+            GetMaterialDatabase());
+
+        benchmark::DoNotOptimize(shipDefinition.Layers.StructuralLayer.get());
+    }
+}
+BENCHMARK(Serialization_ShipDefinitionFormat_Load)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+//
+// Legacy import
+//
+
+static void Serialization_LegacyImageDefinition_Load(benchmark::State & state)
+{
+    std::filesystem::path const shipFilePath = MakeLegacyShipFile(CorpusShipSizes[state.range(0)]);
+
+    for (auto _ : state)
+    {
+        auto shipDefinition = ShipLegacyFormatDeSerializer::LoadShipFromImageDefinition(
+            shipFilePath,
+            GetMaterialDatabase(),
+            nullptr);
+
+        benchmark::DoNotOptimize(shipDefinition.Layers.StructuralLayer.get());
+    }
+}
+BENCHMARK(Serialization_LegacyImageDefinition_Load)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+//
+// PersistedShipPreviewImageDatabase
+//
+
+static void Serialization_PreviewImageDatabase_Commit(benchmark::State & state)
+{
+    std::filesystem::path const databaseFilePath = GetScratchDirectory() / "PreviewDatabase_Commit.db";
+    auto const fileSystem = std::make_shared<FileSystemImpl>();
+    NewShipPreviewImageDatabase const newDatabase = MakeNewPreviewDatabase(fileSystem);
+    PersistedShipPreviewImageDatabase const oldDatabase(fileSystem);
+
+    for (auto _ : state)
+    {
+        newDatabase.Commit(
+            databaseFilePath,
+            oldDatabase,
+            true);
+    }
+}
+BENCHMARK(Serialization_PreviewImageDatabase_Commit)->Unit(benchmark::kMillisecond);
+
+static void Serialization_PreviewImageDatabase_Lookup(benchmark::State & state)
+{
+    std::filesystem::path const databaseFilePath = GetScratchDirectory() / "PreviewDatabase_Lookup.db";
+    auto const fileSystem = std::make_shared<FileSystemImpl>();
+    MakeNewPreviewDatabase(fileSystem).Commit(
+        databaseFilePath,
+        PersistedShipPreviewImageDatabase(fileSystem),
+        true);
+
+    for (auto _ : state)
+    {
+        auto database = PersistedShipPreviewImageDatabase::Load(
+            databaseFilePath,
+            fileSystem);
+
+        for (size_t s = 0; s < PreviewDatabaseShipCount; ++s)
+        {
+            auto previewImage = database.TryGetPreviewImage(
+                MakePreviewImageFilename(s),
+                std::filesystem::file_time_type());
+
+            benchmark::DoNotOptimize(previewImage);
+        }
+
+        database.Close();
+    }
+}
+BENCHMARK(Serialization_PreviewImageDatabase_Lookup)->Unit(benchmark::kMillisecond);
+
+//
+// PngTools
+//
+
+static void Serialization_Png_Encode(benchmark::State & state)
+{
+    ShipSpaceSize const & shipSize = CorpusShipSizes[state.range(0)];
+    RgbaImageData const image = MakeTextureImage(
+        ImageSize(
+            shipSize.width * TextureMagnificationFactor,
+            shipSize.height * TextureMagnificationFactor));
+
+    for (auto _ : state)
+    {
+        MemoryBinaryWriteStream outputStream;
+        PngTools::EncodeImage(image, outputStream);
+
+        benchmark::DoNotOptimize(outputStream.GetData());
+    }
+}
+BENCHMARK(Serialization_Png_Encode)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+static void Serialization_Png_Decode(benchmark::State & state)
+{
+    ShipSpaceSize const & shipSize = CorpusShipSizes[state.range(0)];
+    MemoryBinaryWriteStream pngFile;
+    PngTools::EncodeImage(
+        MakeTextureImage(
+            ImageSize(
+                shipSize.width * TextureMagnificationFactor,
+                shipSize.height * TextureMagnificationFactor)),
+        pngFile);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        MemoryBinaryReadStream inputStream = pngFile.MakeReadStreamCopy();
+        state.ResumeTiming();
+
+        auto image = PngTools::DecodeImageRgba(inputStream);
+
+        benchmark::DoNotOptimize(image);
+    }
+}
+BENCHMARK(Serialization_Png_Decode)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,80 @@
+#include <Simulation/ShipFactoryTypes.h>
+
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+#include <vector>
+
+static constexpr ElementIndex LatticeWidth = 400;
+static constexpr ElementIndex LatticeHeight = 250;
+
+// The springs of a full lattice: E, NE, N, NW of each point
+static std::vector<ShipFactoryPointPair> MakeLatticeSprings()
+{
+    std::vector<ShipFactoryPointPair> springs;
+
+    for (ElementIndex y = 0; y < LatticeHeight - 1; ++y)
+    {
+        for (ElementIndex x = 1; x < LatticeWidth - 1; ++x)
+        {
+            ElementIndex const p = y * LatticeWidth + x;
+            springs.emplace_back(p, p + 1);
+            springs.emplace_back(p, p + LatticeWidth + 1);
+            springs.emplace_back(p, p + LatticeWidth);
+            springs.emplace_back(p, p + LatticeWidth - 1);
+        }
+    }
+
+    return springs;
+}
+
+static void ShipFactoryPointPairToIndexMap_StdUnorderedMap(benchmark::State & state)
+{
+    auto const springs = MakeLatticeSprings();
+
+    size_t found = 0;
+    for (auto _ : state)
+    {
+        std::unordered_map<ShipFactoryPointPair, ElementIndex, ShipFactoryPointPair::Hasher> map;
+        for (ElementIndex s = 0; s < springs.size(); ++s)
+        {
+            map.try_emplace(springs[s], s);
+        }
+
+        for (auto const & spring : springs)
+        {
+            // One hit and one (most likely) miss
+            found += (map.find(spring) != map.cend()) ? 1 : 0;
+            found += (map.find({ spring.Endpoint1Index, spring.Endpoint2Index + 2 }) != map.cend()) ? 1 : 0;
+        }
+    }
+
+    benchmark::DoNotOptimize(found);
+}
+BENCHMARK(ShipFactoryPointPairToIndexMap_StdUnorderedMap);
+
+static void ShipFactoryPointPairToIndexMap_Flat(benchmark::State & state)
+{
+    auto const springs = MakeLatticeSprings();
+
+    size_t found = 0;
+    for (auto _ : state)
+    {
+        ShipFactoryPointPairToIndexMap map;
+        map.reserve(springs.size());
+        for (ElementIndex s = 0; s < springs.size(); ++s)
+        {
+            map.try_emplace(springs[s], s);
+        }
+
+        for (auto const & spring : springs)
+        {
+            // One hit and one (most likely) miss
+            found += (map.find(spring) != map.cend()) ? 1 : 0;
+            found += (map.find({ spring.Endpoint1Index, spring.Endpoint2Index + 2 }) != map.cend()) ? 1 : 0;
+        }
+    }
+
+    benchmark::DoNotOptimize(found);
+}
+BENCHMARK(ShipFactoryPointPairToIndexMap_Flat);
@@ -0,0 +1,349 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+
+/*
+ * Headless macro-benchmark of the simulation: loads ships, and runs World::Update
+ * for a fixed number of steps, without a window nor an OpenGL context.
+ *
+ * Each ship runs on its own in a new world, with the random engine reseeded,
+ * so that its timings do not depend on the other ships, nor on their order.
+ * Note that the render upload - and thus the connectivity visit it triggers -
+ * is not part of the measurements.
+ *
+ * With --warmup, each ship first runs for the specified number of steps, which are not
+ * measured; with --snapshot-dir, the state reached at the end of the warm-up is saved to
+ * the directory, and subsequent runs with the same ship, warm-up, and seed start directly
+ * from there.
+ *
+ * With --pin-threads, each simulation thread is pinned to its own processor, so that runs are
+ * not perturbed by the OS migrating threads - and their caches - across processors.
+ *
+ * With --hot-threads, simulation threads spin between parallel batches rather than parking.
+ *
+ * With --morton-layout, ships are laid out along a Z-order curve rather than by rows.
+ *
+ * Usage: SimulationBenchmark [--steps N] [--seed S] [--threads T] [--pin-threads] [--hot-threads] [--morton-layout] [--warmup W] [--snapshot-dir D] <ship.shp2> [<ship.shp2> ...]
+ */
+
+#include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameChronometer.h>
+#include <Core/GameException.h>
+#include <Core/GameRandomEngine.h>
+#include <Core/PerfStats.h>
+#include <Core/Snapshot.h>
+#include <Core/TextureAtlas.h>
+#include <Core/ThreadManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    struct Options
+    {
+        size_t StepCount;
+        std::uint32_t Seed;
+        size_t ThreadCount;
+        bool DoPinThreads;
+        bool DoKeepThreadsHot;
+        bool DoUseMortonLayout;
+        size_t WarmupStepCount;
+        std::optional<std::filesystem::path> SnapshotDirectoryPath;
+        std::vector<std::filesystem::path> ShipFilePaths;
+    };
+
+    Options ParseOptions(int argc, char ** argv)
+    {
+        Options options{
+            1000,
+            GameRandomEngine::DefaultSeed,
+            ThreadManager::GetNumberOfProcessors(),
+            false,
+            false,
+            false,
+            0,
+            std::nullopt,
+            {} };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string const arg(argv[i]);
+            if ((arg == "--steps" || arg == "--seed" || arg == "--threads" || arg == "--warmup") && i + 1 < argc)
+            {
+                auto const value = std::stoul(argv[++i]);
+                if (arg == "--steps")
+                    options.StepCount = static_cast<size_t>(value);
+                else if (arg == "--seed")
+                    options.Seed = static_cast<std::uint32_t>(value);
+                else if (arg == "--threads")
+                    options.ThreadCount = std::max(static_cast<size_t>(value), size_t(1));
+                else
+                    options.WarmupStepCount = static_cast<size_t>(value);
+            }
+            else if (arg == "--pin-threads")
+            {
+                options.DoPinThreads = true;
+            }
+            else if (arg == "--hot-threads")
+            {
+                options.DoKeepThreadsHot = true;
+            }
+            else if (arg == "--morton-layout")
+            {
+                options.DoUseMortonLayout = true;
+            }
+            else if (arg == "--snapshot-dir" && i + 1 < argc)
+            {
+                options.SnapshotDirectoryPath = std::filesystem::path(argv[++i]);
+            }
+            else
+            {
+                options.ShipFilePaths.emplace_back(arg);
+            }
+        }
+
+        return options;
+    }
+
+    size_t GetMeasurementDepth(PerfMeasurement measurement)
+    {
+        size_t depth = 0;
+        for (auto parent = GetPerfMeasurementInfo(measurement).Parent; parent.has_value(); parent = GetPerfMeasurementInfo(*parent).Parent)
+        {
+            ++depth;
+        }
+
+        return depth;
+    }
+
+    void PrintPerfStats(PerfStats const & perfStats)
+    {
+        for (size_t m = 0; m <= static_cast<size_t>(PerfMeasurement::_Last); ++m)
+        {
+            PerfMeasurement const measurement = static_cast<PerfMeasurement>(m);
+
+            float const averageMs = perfStats.GetMeasurement(measurement).ToRatio<std::chrono::microseconds>() / 1000.0f;
+            if (averageMs == 0.0f)
+                continue;
+
+            std::cout << "    "
+                << std::string(GetMeasurementDepth(measurement) * 2, ' ')
+                << std::left << std::setw(32 - static_cast<int>(GetMeasurementDepth(measurement) * 2)) << GetPerfMeasurementInfo(measurement).Name
+                << std::right << std::fixed << std::setprecision(3) << std::setw(10) << averageMs << " ms" << std::endl;
+        }
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    Options const options = ParseOptions(argc, argv);
+    if (options.ShipFilePaths.empty())
+    {
+        std::cout << "Usage: SimulationBenchmark [--steps N] [--seed S] [--threads T] [--pin-threads] [--hot-threads] [--morton-layout] [--warmup W] [--snapshot-dir D] <ship.shp2> [<ship.shp2> ...]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        //
+        // Initialize
+        //
+
+        ThreadManager threadManager(
+            false,
+            options.ThreadCount,
+            [&options](ThreadManager::ThreadTaskKind threadTaskKind, std::string const & threadName, size_t threadTaskIndex)
+            {
+                if (options.DoPinThreads
+                    && (threadTaskKind == ThreadManager::ThreadTaskKind::MainAndSimulation || threadTaskKind == ThreadManager::ThreadTaskKind::Simulation))
+                {
+                    if (!ThreadManager::PinThisThreadToProcessor(threadTaskIndex % ThreadManager::GetNumberOfProcessors()))
+                    {
+                        std::cout << "Warning: cannot pin thread \"" << threadName << "\"" << std::endl;
+                    }
+                }
+            });
+
+        threadManager.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "FS Main Thread", 0);
+
+        // We're simulating all along
+        threadManager.SetDoKeepSimulationThreadsHot(options.DoKeepThreadsHot);
+        threadManager.SetIsSimulationActive(true);
+
+        GameAssetManager const gameAssetManager{ std::string(argv[0]) };
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+        FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+        NpcDatabase const npcDatabase = NpcDatabase::Load(gameAssetManager, materialDatabase, npcTextureAtlas);
+        ShipTexturizer const shipTexturizer(materialDatabase, gameAssetManager);
+        ShipStrengthRandomizer const shipStrengthRandomizer;
+
+        OceanFloorHeightMap const oceanFloorHeightMap = OceanFloorHeightMap::LoadFromImage(
+            gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath()));
+
+        SimulationParameters simulationParameters;
+        if (options.DoUseMortonLayout)
+        {
+            simulationParameters.ShipLayoutOrder = ShipLayoutOrderType::Morton;
+        }
+
+        ViewModel const viewModel(
+            FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+            1.0f,
+            vec2f::zero(),
+            DisplayLogicalSize(1920, 1080),
+            1);
+
+        std::cout << "Steps: " << options.StepCount << "  Warm-up steps: " << options.WarmupStepCount << "  Seed: " << options.Seed
+            << "  Simulation parallelism: " << threadManager.GetSimulationParallelism() << std::endl;
+
+        //
+        // Run each ship
+        //
+
+        for (auto const & shipFilePath : options.ShipFilePaths)
+        {
+            GameRandomEngine::GetInstance().Reseed(options.Seed);
+
+            SimulationEventDispatcher simulationEventDispatcher;
+
+            Physics::World world(
+                OceanFloorHeightMap(oceanFloorHeightMap),
+                fishSpeciesDatabase,
+                npcDatabase,
+                simulationEventDispatcher,
+                simulationParameters);
+
+            auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+                world.GetNextShipId(),
+                world,
+                ShipDeSerializer::LoadShip(shipFilePath, materialDatabase, threadManager),
+                ShipLoadOptions(),
+                materialDatabase,
+                shipTexturizer,
+                shipStrengthRandomizer,
+                simulationEventDispatcher,
+                gameAssetManager,
+                simulationParameters,
+                threadManager);
+
+            ShipId const shipId = ship->GetId();
+
+            world.AddShip(std::move(ship));
+            world.Announce();
+            simulationEventDispatcher.Flush();
+
+            //
+            // Warm up
+            //
+
+            if (options.WarmupStepCount > 0)
+            {
+                std::optional<std::filesystem::path> snapshotFilePath;
+                if (options.SnapshotDirectoryPath.has_value())
+                {
+                    snapshotFilePath = *options.SnapshotDirectoryPath
+                        / (shipFilePath.stem().string() + "_" + std::to_string(options.WarmupStepCount) + "_" + std::to_string(options.Seed)
+                            + (options.DoUseMortonLayout ? "_morton" : "") + ".snapshot");
+                }
+
+                if (snapshotFilePath.has_value() && std::filesystem::exists(*snapshotFilePath))
+                {
+                    world.RestoreSnapshot(Snapshot::Load(*snapshotFilePath));
+                }
+                else
+                {
+                    PerfStats warmupPerfStats;
+
+                    for (size_t s = 0; s < options.WarmupStepCount; ++s)
+                    {
+                        world.Update(
+                            simulationParameters,
+                            viewModel,
+                            StressRenderModeType::None,
+                            threadManager,
+                            warmupPerfStats);
+
+                        simulationEventDispatcher.Flush();
+                    }
+
+                    if (snapshotFilePath.has_value())
+                    {
+                        world.TakeSnapshot().Save(*snapshotFilePath);
+                    }
+                }
+            }
+
+            PerfStats perfStats;
+
+            auto const startTime = GameChronometer::Now();
+
+            for (size_t s = 0; s < options.StepCount; ++s)
+            {
+                {
+                    ScopedPerfMeasurement<PerfMeasurement::TotalNetUpdate> const perfMeasurement(perfStats);
+
+                    world.Update(
+                        simulationParameters,
+                        viewModel,
+                        StressRenderModeType::None,
+                        threadManager,
+                        perfStats);
+                }
+
+                simulationEventDispatcher.Flush();
+            }
+
+            auto const elapsed = std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(GameChronometer::Now() - startTime);
+
+            // The final extent of the ship is a cheap check that runs are identical
+            auto const aabb = world.CalculateAllShipParticleAABB();
+
+            std::cout << std::endl << shipFilePath.filename().string() << " (" << world.GetShipPointCount(shipId) << " points)" << std::endl;
+            std::cout << "  Total: " << std::fixed << std::setprecision(1) << elapsed.count() << " ms"
+                << "  Per step: " << std::setprecision(3) << elapsed.count() / static_cast<float>(std::max(options.StepCount, size_t(1))) << " ms" << std::endl;
+            std::cout << "  Final AABB: " << std::setprecision(4)
+                << "(" << aabb.BottomLeft.x << ", " << aabb.BottomLeft.y << ") - ("
+                << aabb.TopRight.x << ", " << aabb.TopRight.y << ")" << std::endl;
+            std::cout << "  Average per step:" << std::endl;
+
+            PrintPerfStats(perfStats);
+        }
+    }
+    catch (std::exception const & ex)
+    {
+        std::cout << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
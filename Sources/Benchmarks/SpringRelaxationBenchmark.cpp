@@ -0,0 +1,342 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+
+/*
+ * Headless benchmark of the whole spring relaxation loop, in each of its parallel computation
+ * modes, over ship topologies and simulation parallelisms.
+ *
+ * Topologies are either synthetic - solid rectangular hulls of the specified widths, with a
+ * height of a quarter of their width - or real ships. Each combination runs in a new world,
+ * with the random engine reseeded, and reports the average time of the Springs phase per step;
+ * the fastest mode for each topology and parallelism is marked.
+ *
+ * Parallelisms are the powers of two up to --max-threads, plus --max-threads itself.
+ *
+ * Usage: SpringRelaxationBenchmark [--steps N] [--seed S] [--max-threads T] [--widths W1,W2,...] [--material M] [<ship.shp2> ...]
+ */
+
+#include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/Layers.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipDefinition.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameException.h>
+#include <Core/GameRandomEngine.h>
+#include <Core/PerfStats.h>
+#include <Core/TextureAtlas.h>
+#include <Core/ThreadManager.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    std::array<std::pair<SpringRelaxationParallelComputationModeType, char const *>, 4> const Modes = { {
+        { SpringRelaxationParallelComputationModeType::FullSpeed, "FullSpeed" },
+        { SpringRelaxationParallelComputationModeType::StepByStep, "StepByStep" },
+        { SpringRelaxationParallelComputationModeType::Hybrid, "Hybrid" },
+        { SpringRelaxationParallelComputationModeType::Chebyshev, "Chebyshev" } } };
+
+    struct Options
+    {
+        size_t StepCount;
+        std::uint32_t Seed;
+        size_t MaxThreadCount;
+        std::vector<int> SyntheticWidths;
+        std::optional<std::string> MaterialName;
+        std::vector<std::filesystem::path> ShipFilePaths;
+    };
+
+    Options ParseOptions(int argc, char ** argv)
+    {
+        Options options{
+            200,
+            GameRandomEngine::DefaultSeed,
+            ThreadManager::GetNumberOfProcessors(),
+            {},
+            std::nullopt,
+            {} };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string const arg(argv[i]);
+            if ((arg == "--steps" || arg == "--seed" || arg == "--max-threads") && i + 1 < argc)
+            {
+                auto const value = std::stoul(argv[++i]);
+                if (arg == "--steps")
+                    options.StepCount = static_cast<size_t>(value);
+                else if (arg == "--seed")
+                    options.Seed = static_cast<std::uint32_t>(value);
+                else
+                    options.MaxThreadCount = std::max(static_cast<size_t>(value), size_t(1));
+            }
+            else if (arg == "--widths" && i + 1 < argc)
+            {
+                std::istringstream widthsStream(argv[++i]);
+                std::string width;
+                while (std::getline(widthsStream, width, ','))
+                {
+                    options.SyntheticWidths.push_back(std::max(std::stoi(width), 4));
+                }
+            }
+            else if (arg == "--material" && i + 1 < argc)
+            {
+                options.MaterialName = std::string(argv[++i]);
+            }
+            else
+            {
+                options.ShipFilePaths.emplace_back(arg);
+            }
+        }
+
+        if (options.SyntheticWidths.empty() && options.ShipFilePaths.empty())
+        {
+            options.SyntheticWidths = { 64, 256, 1024 };
+        }
+
+        return options;
+    }
+
+    std::vector<size_t> MakeParallelisms(size_t maxThreadCount)
+    {
+        std::vector<size_t> parallelisms;
+        for (size_t p = 1; p < maxThreadCount; p *= 2)
+        {
+            parallelisms.push_back(p);
+        }
+
+        parallelisms.push_back(maxThreadCount);
+
+        return parallelisms;
+    }
+
+    StructuralMaterial const & GetSyntheticMaterial(
+        MaterialDatabase const & materialDatabase,
+        std::optional<std::string> const & materialName)
+    {
+        if (materialName.has_value())
+        {
+            return materialDatabase.GetStructuralMaterial(*materialName);
+        }
+
+        // The first hull material that is not special in any way
+        for (auto const & [colorKey, material] : materialDatabase.GetStructuralMaterialColorMap())
+        {
+            if (material.IsHull && !material.UniqueType.has_value())
+            {
+                return material;
+            }
+        }
+
+        throw GameException("Cannot find a hull material for synthetic ships");
+    }
+
+    ShipDefinition MakeSyntheticShip(
+        int width,
+        StructuralMaterial const & material)
+    {
+        ShipSpaceSize const size(width, std::max(width / 4, 2));
+
+        auto structuralLayer = std::make_unique<StructuralLayerData>(size);
+        for (int y = 0; y < size.height; ++y)
+        {
+            for (int x = 0; x < size.width; ++x)
+            {
+                structuralLayer->Buffer[ShipSpaceCoordinates(x, y)] = StructuralElement(&material);
+            }
+        }
+
+        return ShipDefinition(
+            ShipLayers(size, std::move(structuralLayer), nullptr, nullptr, nullptr, nullptr),
+            ShipMetadata("Synthetic " + std::to_string(size.width) + "x" + std::to_string(size.height)),
+            ShipPhysicsData(),
+            std::nullopt);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    Options const options = ParseOptions(argc, argv);
+
+    try
+    {
+        //
+        // Initialize
+        //
+
+        ThreadManager threadManager(
+            false,
+            options.MaxThreadCount,
+            [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+        threadManager.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "FS Main Thread", 0);
+
+        GameAssetManager const gameAssetManager{ std::string(argv[0]) };
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+        FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+        NpcDatabase const npcDatabase = NpcDatabase::Load(gameAssetManager, materialDatabase, npcTextureAtlas);
+        ShipTexturizer const shipTexturizer(materialDatabase, gameAssetManager);
+        ShipStrengthRandomizer const shipStrengthRandomizer;
+
+        OceanFloorHeightMap const oceanFloorHeightMap = OceanFloorHeightMap::LoadFromImage(
+            gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath()));
+
+        ViewModel const viewModel(
+            FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+            1.0f,
+            vec2f::zero(),
+            DisplayLogicalSize(1920, 1080),
+            1);
+
+        //
+        // Prepare topologies
+        //
+
+        std::vector<std::pair<std::string, std::function<ShipDefinition()>>> topologies;
+
+        if (!options.SyntheticWidths.empty())
+        {
+            StructuralMaterial const & syntheticMaterial = GetSyntheticMaterial(materialDatabase, options.MaterialName);
+            for (int const width : options.SyntheticWidths)
+            {
+                topologies.emplace_back(
+                    "synthetic-" + std::to_string(width),
+                    [width, &syntheticMaterial]()
+                    {
+                        return MakeSyntheticShip(width, syntheticMaterial);
+                    });
+            }
+        }
+
+        for (auto const & shipFilePath : options.ShipFilePaths)
+        {
+            topologies.emplace_back(
+                shipFilePath.filename().string(),
+                [&shipFilePath, &materialDatabase, &threadManager]()
+                {
+                    return ShipDeSerializer::LoadShip(shipFilePath, materialDatabase, threadManager);
+                });
+        }
+
+        std::vector<size_t> const parallelisms = MakeParallelisms(options.MaxThreadCount);
+
+        std::cout << "Steps: " << options.StepCount << "  Seed: " << options.Seed << std::endl;
+
+        //
+        // Run each topology x parallelism x mode
+        //
+
+        for (auto const & [topologyName, makeShipDefinition] : topologies)
+        {
+            std::cout << std::endl << topologyName << std::endl;
+
+            for (size_t const parallelism : parallelisms)
+            {
+                threadManager.SetSimulationParallelism(parallelism);
+
+                std::array<float, Modes.size()> springsMs;
+                size_t springCount = 0;
+
+                for (size_t m = 0; m < Modes.size(); ++m)
+                {
+                    GameRandomEngine::GetInstance().Reseed(options.Seed);
+
+                    SimulationParameters simulationParameters;
+                    simulationParameters.SpringRelaxationParallelComputationMode = Modes[m].first;
+
+                    SimulationEventDispatcher simulationEventDispatcher;
+
+                    Physics::World world(
+                        OceanFloorHeightMap(oceanFloorHeightMap),
+                        fishSpeciesDatabase,
+                        npcDatabase,
+                        simulationEventDispatcher,
+                        simulationParameters);
+
+                    auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+                        world.GetNextShipId(),
+                        world,
+                        makeShipDefinition(),
+                        ShipLoadOptions(),
+                        materialDatabase,
+                        shipTexturizer,
+                        shipStrengthRandomizer,
+                        simulationEventDispatcher,
+                        gameAssetManager,
+                        simulationParameters,
+                        threadManager);
+
+                    world.AddShip(std::move(ship));
+                    world.Announce();
+                    simulationEventDispatcher.Flush();
+
+                    springCount = world.GetAllShipSpringCount();
+
+                    PerfStats perfStats;
+
+                    for (size_t s = 0; s < options.StepCount; ++s)
+                    {
+                        world.Update(
+                            simulationParameters,
+                            viewModel,
+                            StressRenderModeType::None,
+                            threadManager,
+                            perfStats);
+
+                        simulationEventDispatcher.Flush();
+                    }
+
+                    springsMs[m] = perfStats.GetMeasurement(PerfMeasurement::TotalShipsSpringsUpdate).ToRatio<std::chrono::microseconds>() / 1000.0f;
+                }
+
+                size_t const bestMode = static_cast<size_t>(std::distance(springsMs.cbegin(), std::min_element(springsMs.cbegin(), springsMs.cend())));
+
+                std::cout << "  " << springCount << " springs, " << std::setw(2) << parallelism << " thread(s):";
+                for (size_t m = 0; m < Modes.size(); ++m)
+                {
+                    std::cout << "  " << Modes[m].second << " " << std::fixed << std::setprecision(3) << springsMs[m] << " ms" << (m == bestMode ? "*" : "");
+                }
+
+                std::cout << std::endl;
+            }
+        }
+    }
+    catch (std::exception const & ex)
+    {
+        std::cout << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "Utils.h"
+
+#include <Core/Algorithms.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+static constexpr size_t SampleSize = 2000000;
+
+static void UpdateWaterVelocities_CalculateSpringOutboundWaterVelocities_Naive(benchmark::State & state)
+{
+    auto const size = MakeSize(SampleSize);
+
+    std::vector<vec2f> pointPositions;
+    std::vector<SpringEndpoints> springEndpoints;
+    MakeGraph(size, pointPositions, springEndpoints);
+
+    auto springNormalizedVectors = MakeVectors(size);
+    auto springFactoryRestLengths = MakeFloats(size, 1.0f);
+    auto pointWaters = MakeFloats(size);
+    auto pointWaterVelocities = MakeVectors(size);
+
+    auto outPointAOutboundVelocities = MakeFloats(size);
+    auto outPointBOutboundVelocities = MakeFloats(size);
+    auto outPointAOutboundWeights = MakeFloats(size);
+    auto outPointBOutboundWeights = MakeFloats(size);
+
+    for (auto _ : state)
+    {
+        for (ElementIndex s = 0; s < size; s += 4)
+        {
+            Algorithms::CalculateSpringOutboundWaterVelocities_Naive(
+                s,
+                springEndpoints.data(),
+                springNormalizedVectors.get(),
+                springFactoryRestLengths.get(),
+                pointPositions.data(),
+                pointWaters.get(),
+                pointWaterVelocities.get(),
+                0.5f,
+                9.80f,
+                outPointAOutboundVelocities.get(),
+                outPointBOutboundVelocities.get(),
+                outPointAOutboundWeights.get(),
+                outPointBOutboundWeights.get());
+        }
+    }
+
+    benchmark::DoNotOptimize(outPointAOutboundWeights);
+    benchmark::DoNotOptimize(outPointBOutboundWeights);
+}
+BENCHMARK(UpdateWaterVelocities_CalculateSpringOutboundWaterVelocities_Naive);
+
+static void UpdateWaterVelocities_CalculateSpringOutboundWaterVelocities_Vectorized(benchmark::State & state)
+{
+    auto const size = MakeSize(SampleSize);
+
+    std::vector<vec2f> pointPositions;
+    std::vector<SpringEndpoints> springEndpoints;
+    MakeGraph(size, pointPositions, springEndpoints);
+
+    auto springNormalizedVectors = MakeVectors(size);
+    auto springFactoryRestLengths = MakeFloats(size, 1.0f);
+    auto pointWaters = MakeFloats(size);
+    auto pointWaterVelocities = MakeVectors(size);
+
+    auto outPointAOutboundVelocities = MakeFloats(size);
+    auto outPointBOutboundVelocities = MakeFloats(size);
+    auto outPointAOutboundWeights = MakeFloats(size);
+    auto outPointBOutboundWeights = MakeFloats(size);
+
+    for (auto _ : state)
+    {
+        for (ElementIndex s = 0; s < size; s += 4)
+        {
+            // Picks the SSE or Neon variant, depending on the platform
+            Algorithms::CalculateSpringOutboundWaterVelocities(
+                s,
+                springEndpoints.data(),
+                springNormalizedVectors.get(),
+                springFactoryRestLengths.get(),
+                pointPositions.data(),
+                pointWaters.get(),
+                pointWaterVelocities.get(),
+                0.5f,
+                9.80f,
+                outPointAOutboundVelocities.get(),
+                outPointBOutboundVelocities.get(),
+                outPointAOutboundWeights.get(),
+                outPointBOutboundWeights.get());
+        }
+    }
+
+    benchmark::DoNotOptimize(outPointAOutboundWeights);
+    benchmark::DoNotOptimize(outPointBOutboundWeights);
+}
+BENCHMARK(UpdateWaterVelocities_CalculateSpringOutboundWaterVelocities_Vectorized);
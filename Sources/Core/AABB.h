@@ -127,6 +127,16 @@ public:
             && point.y >= BottomLeft.y - margin
             && point.y <= TopRight.y + margin;
     }
+
+    inline bool Intersects(
+        AABB const & other,
+        float margin) const noexcept
+    {
+        return other.TopRight.x >= BottomLeft.x - margin
+            && other.BottomLeft.x <= TopRight.x + margin
+            && other.TopRight.y >= BottomLeft.y - margin
+            && other.BottomLeft.y <= TopRight.y + margin;
+    }
 };
 
 struct ShipAABB : public AABB
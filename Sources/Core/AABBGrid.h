@@ -0,0 +1,215 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "AABB.h"
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Geometry {
+
+/*
+ * A uniform grid partitioning the space covered by a set of elements, each
+ * cell listing the elements whose AABB overlaps it.
+ *
+ * Finding the elements that might contain a position then only takes visiting
+ * the elements of the cell containing the position - which are visited in the
+ * order in which they were added to the grid.
+ */
+class AABBGrid final
+{
+public:
+
+    struct Entry
+    {
+        ElementIndex Element;
+        AABB Box;
+
+        Entry(
+            ElementIndex element,
+            AABB const & box)
+            : Element(element)
+            , Box(box)
+        {}
+    };
+
+public:
+
+    AABBGrid()
+        : mBounds()
+        , mCellWidth(1.0f)
+        , mCellHeight(1.0f)
+        , mWidth(0)
+        , mHeight(0)
+        , mCellStarts()
+        , mCellElements()
+    {}
+
+    bool IsEmpty() const
+    {
+        return mCellElements.empty();
+    }
+
+    void Clear()
+    {
+        mWidth = 0;
+        mHeight = 0;
+        mCellStarts.clear();
+        mCellElements.clear();
+    }
+
+    /*
+     * Rebuilds the grid with the specified entries, sizing cells so that each
+     * holds about as many elements as the specified target.
+     */
+    void Build(
+        std::vector<Entry> const & entries,
+        float targetElementsPerCell)
+    {
+        Clear();
+
+        if (entries.empty())
+        {
+            return;
+        }
+
+        //
+        // Calculate grid geometry
+        //
+
+        mBounds = AABB();
+        for (auto const & entry : entries)
+        {
+            mBounds.ExtendTo(entry.Box);
+        }
+
+        float const boundsWidth = std::max(mBounds.GetWidth(), 1e-3f);
+        float const boundsHeight = std::max(mBounds.GetHeight(), 1e-3f);
+
+        // Square-ish cells, unless that would take too many of them along one axis
+        float const targetCellCount = std::max(static_cast<float>(entries.size()) / targetElementsPerCell, 1.0f);
+        float const targetCellSize = std::sqrt(boundsWidth * boundsHeight / targetCellCount);
+        mWidth = std::clamp(static_cast<int>(std::ceil(boundsWidth / targetCellSize)), 1, MaxDimension);
+        mHeight = std::clamp(static_cast<int>(std::ceil(boundsHeight / targetCellSize)), 1, MaxDimension);
+        mCellWidth = boundsWidth / static_cast<float>(mWidth);
+        mCellHeight = boundsHeight / static_cast<float>(mHeight);
+
+        //
+        // Count elements per cell, then turn counts into starts, and finally
+        // fill cells - preserving the order of entries within each cell
+        //
+
+        size_t const cellCount = static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight);
+        mCellStarts.assign(cellCount + 1, 0);
+
+        for (auto const & entry : entries)
+        {
+            VisitCells(
+                entry.Box,
+                [this](size_t cellIndex)
+                {
+                    ++mCellStarts[cellIndex + 1];
+                });
+        }
+
+        for (size_t c = 1; c <= cellCount; ++c)
+        {
+            mCellStarts[c] += mCellStarts[c - 1];
+        }
+
+        mCellElements.resize(mCellStarts[cellCount]);
+
+        std::vector<size_t> cellCursors(mCellStarts.cbegin(), mCellStarts.cend() - 1);
+
+        for (auto const & entry : entries)
+        {
+            VisitCells(
+                entry.Box,
+                [&](size_t cellIndex)
+                {
+                    mCellElements[cellCursors[cellIndex]++] = entry.Element;
+                });
+        }
+    }
+
+    /*
+     * Visits the elements that might contain the specified position; the visitor
+     * returns true to stop the visit.
+     */
+    template<typename TVisitor>
+    void VisitCandidates(
+        vec2f const & position,
+        TVisitor && visitor) const
+    {
+        if (mCellStarts.empty() || !mBounds.Contains(position))
+        {
+            // Outside of all elements
+            return;
+        }
+
+        size_t const cellIndex =
+            static_cast<size_t>(ToCellY(position.y)) * static_cast<size_t>(mWidth)
+            + static_cast<size_t>(ToCellX(position.x));
+        for (size_t e = mCellStarts[cellIndex]; e < mCellStarts[cellIndex + 1]; ++e)
+        {
+            if (visitor(mCellElements[e]))
+            {
+                break;
+            }
+        }
+    }
+
+private:
+
+    static int constexpr MaxDimension = 4096;
+
+    // Positions on the top and right edges of the bounds belong to the last cells,
+    // and the same mapping is used when adding and when querying
+    inline int ToCellX(float x) const
+    {
+        return std::clamp(static_cast<int>(std::floor((x - mBounds.BottomLeft.x) / mCellWidth)), 0, mWidth - 1);
+    }
+
+    inline int ToCellY(float y) const
+    {
+        return std::clamp(static_cast<int>(std::floor((y - mBounds.BottomLeft.y) / mCellHeight)), 0, mHeight - 1);
+    }
+
+    template<typename TCellVisitor>
+    inline void VisitCells(
+        AABB const & box,
+        TCellVisitor && cellVisitor) const
+    {
+        int const minX = ToCellX(box.BottomLeft.x);
+        int const maxX = ToCellX(box.TopRight.x);
+        int const minY = ToCellY(box.BottomLeft.y);
+        int const maxY = ToCellY(box.TopRight.y);
+
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                cellVisitor(static_cast<size_t>(y) * static_cast<size_t>(mWidth) + static_cast<size_t>(x));
+            }
+        }
+    }
+
+    AABB mBounds;
+    float mCellWidth;
+    float mCellHeight;
+    int mWidth;
+    int mHeight;
+
+    // Elements of cell c are at [mCellStarts[c], mCellStarts[c + 1])
+    std::vector<size_t> mCellStarts;
+    std::vector<ElementIndex> mCellElements;
+};
+
+}
@@ -115,6 +115,55 @@ public:
         mAABBs.clear();
     }
 
+    /*
+     * Visits all pairs of AABBs that intersect each other - within the specified margin -
+     * as pairs of indices (i < j) into the items.
+     *
+     * Sort-and-sweep along x, hence O(n log n) plus the number of pairs whose x spans overlap;
+     * the visit order only depends on the AABBs and on their insertion order.
+     */
+    template<typename TVisitor>
+    void VisitIntersectingPairs(
+        float margin,
+        TVisitor && visitor) const
+    {
+        std::vector<size_t> sortedIndices(mAABBs.size());
+        for (size_t i = 0; i < mAABBs.size(); ++i)
+        {
+            sortedIndices[i] = i;
+        }
+
+        std::sort(
+            sortedIndices.begin(),
+            sortedIndices.end(),
+            [this](size_t lhs, size_t rhs)
+            {
+                return mAABBs[lhs].BottomLeft.x < mAABBs[rhs].BottomLeft.x
+                    || (mAABBs[lhs].BottomLeft.x == mAABBs[rhs].BottomLeft.x && lhs < rhs);
+            });
+
+        for (size_t s1 = 0; s1 < sortedIndices.size(); ++s1)
+        {
+            size_t const i1 = sortedIndices[s1];
+            float const right1 = mAABBs[i1].TopRight.x + margin;
+
+            for (size_t s2 = s1 + 1; s2 < sortedIndices.size(); ++s2)
+            {
+                size_t const i2 = sortedIndices[s2];
+                if (mAABBs[i2].BottomLeft.x > right1)
+                {
+                    // No more overlaps along x for this one
+                    break;
+                }
+
+                if (mAABBs[i1].Intersects(mAABBs[i2], margin))
+                {
+                    visitor(std::min(i1, i2), std::max(i1, i2));
+                }
+            }
+        }
+    }
+
 protected:
 
     std::vector<TElement> mAABBs;
@@ -14,6 +14,7 @@
 #include <array>
 #include <cmath>
 #include <iterator>
+#include <limits>
 #include <optional>
 #include <vector>
 
@@ -463,6 +464,133 @@ inline void DiffuseLight(
 #endif
 }
 
+/*
+ * Same as DiffuseLight, but evaluating each tile of consecutive points only against
+ * the lamps whose spread reaches the tile's bounding box, and whose plane ID is not lower
+ * than the lowest plane ID in the tile.
+ *
+ * As points that are close by index are mostly close in space, the cost scales with the
+ * local density of lamps, rather than with their total count.
+ */
+inline void DiffuseLight_Tiled(
+    ElementIndex const pointStart,
+    ElementIndex const pointEnd,
+    vec2f const * pointPositions,
+    PlaneId const * pointPlaneIds,
+    vec2f const * lampPositions,
+    PlaneId const * lampPlaneIds,
+    float const * lampDistanceCoeffs,
+    float const * lampSpreadMaxDistances,
+    ElementIndex const lampCount,
+    float * restrict outLightBuffer) noexcept
+{
+    // With few lamps, culling costs about as much as it saves
+    ElementIndex constexpr MinLampCount = 16;
+
+    // Must be a multiple of the vectorization word
+    ElementIndex constexpr TileSize = 64;
+    static_assert((TileSize % vectorization_float_count<ElementIndex>) == 0);
+
+    assert(is_aligned_to_float_element_count(pointStart));
+    assert(is_aligned_to_float_element_count(pointEnd));
+    assert(is_aligned_to_float_element_count(lampCount));
+
+    if (lampCount < MinLampCount)
+    {
+        DiffuseLight(
+            pointStart,
+            pointEnd,
+            pointPositions,
+            pointPlaneIds,
+            lampPositions,
+            lampPlaneIds,
+            lampDistanceCoeffs,
+            lampSpreadMaxDistances,
+            lampCount,
+            outLightBuffer);
+
+        return;
+    }
+
+    // The lamps of one tile, padded to the vectorization word with lamps that emit no light
+    auto tileLampPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(lampCount);
+    auto tileLampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(lampCount);
+    auto tileLampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(lampCount);
+    auto tileLampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(lampCount);
+
+    for (ElementIndex tileStart = pointStart; tileStart < pointEnd; tileStart += TileSize)
+    {
+        ElementIndex const tileEnd = std::min(tileStart + TileSize, pointEnd);
+
+        Geometry::AABB tileAABB;
+        PlaneId tileMinPlaneId = std::numeric_limits<PlaneId>::max();
+        for (ElementIndex p = tileStart; p < tileEnd; ++p)
+        {
+            tileAABB.ExtendTo(pointPositions[p]);
+            tileMinPlaneId = std::min(tileMinPlaneId, pointPlaneIds[p]);
+        }
+
+        //
+        // Select lamps: a lamp whose spread does not reach the tile's box yields
+        // no light to any of the tile's points; we leave some margin for rounding
+        //
+
+        ElementIndex tileLampCount = 0;
+        for (ElementIndex l = 0; l < lampCount; ++l)
+        {
+            if (lampPlaneIds[l] >= tileMinPlaneId
+                && lampDistanceCoeffs[l] != 0.0f)
+            {
+                vec2f const & lampPosition = lampPositions[l];
+                float const dx = std::max(std::max(tileAABB.BottomLeft.x - lampPosition.x, lampPosition.x - tileAABB.TopRight.x), 0.0f);
+                float const dy = std::max(std::max(tileAABB.BottomLeft.y - lampPosition.y, lampPosition.y - tileAABB.TopRight.y), 0.0f);
+                float const reach = lampSpreadMaxDistances[l] * 1.001f + 0.001f;
+                if (dx * dx + dy * dy < reach * reach)
+                {
+                    tileLampPositions[tileLampCount] = lampPosition;
+                    tileLampPlaneIds[tileLampCount] = lampPlaneIds[l];
+                    tileLampDistanceCoeffs[tileLampCount] = lampDistanceCoeffs[l];
+                    tileLampSpreadMaxDistances[tileLampCount] = lampSpreadMaxDistances[l];
+                    ++tileLampCount;
+                }
+            }
+        }
+
+        if (tileLampCount == 0)
+        {
+            std::fill(
+                outLightBuffer + tileStart,
+                outLightBuffer + tileEnd,
+                0.0f);
+
+            continue;
+        }
+
+        while (!is_aligned_to_float_element_count(tileLampCount))
+        {
+            tileLampPositions[tileLampCount] = vec2f::zero();
+            tileLampPlaneIds[tileLampCount] = 0;
+            tileLampDistanceCoeffs[tileLampCount] = 0.0f;
+            tileLampSpreadMaxDistances[tileLampCount] = 0.0f;
+            ++tileLampCount;
+        }
+
+        assert(tileLampCount <= lampCount);
+
+        DiffuseLight(
+            tileStart,
+            tileEnd,
+            pointPositions,
+            pointPlaneIds,
+            tileLampPositions.get(),
+            tileLampPlaneIds.get(),
+            tileLampDistanceCoeffs.get(),
+            tileLampSpreadMaxDistances.get(),
+            tileLampCount,
+            outLightBuffer);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -832,6 +960,875 @@ inline void CalculateSpringVectors(
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// CalculateSpringOutboundWaterVelocities
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * For each of four springs, calculates the scalar velocity of the water flowing out of
+ * each of its two endpoints along the spring - the endpoint's own water velocity along
+ * the spring plus Bernoulli's velocity gained along it, clamped to outbound-only -
+ * together with the weight of that flow, i.e. the velocity scaled by the spring's
+ * factory rest length.
+ */
+template<typename TEndpoints>
+inline void CalculateSpringOutboundWaterVelocities_Naive(
+    ElementIndex springIndex,
+    TEndpoints const * restrict const endpointsBuffer,
+    vec2f const * restrict const springNormalizedVectorBuffer,
+    float const * restrict const springFactoryRestLengthBuffer,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const waterBuffer,
+    vec2f const * restrict const waterVelocityBuffer,
+    float waterCrazyness,
+    float gravityMagnitude,
+    float * restrict const outPointAOutboundVelocityBuffer,
+    float * restrict const outPointBOutboundVelocityBuffer,
+    float * restrict const outPointAOutboundWeightBuffer,
+    float * restrict const outPointBOutboundWeightBuffer)
+{
+    for (size_t s = springIndex; s < springIndex + 4; ++s)
+    {
+        auto const pointAIndex = endpointsBuffer[s].PointAIndex;
+        auto const pointBIndex = endpointsBuffer[s].PointBIndex;
+
+        // Oriented A -> B
+        vec2f const springNormalizedVector = springNormalizedVectorBuffer[s];
+
+        // Pressure and gravity potential difference (positive implies A -> B flow)
+        float const dwy =
+            (waterBuffer[pointAIndex] - waterBuffer[pointBIndex])
+            + (positionBuffer[pointAIndex].y - positionBuffer[pointBIndex].y);
+
+        // Bernoulli's velocity gained from A to B (Bernoulli, 1738); the one
+        // gained from B to A is its opposite
+        float const bernoulliVelocityAB = (dwy >= 0.0f)
+            ? std::sqrt(2.0f * gravityMagnitude * dwy)
+            : -std::sqrt(2.0f * gravityMagnitude * -dwy);
+
+        float const alphaCrazynessA = 1.0f + waterCrazyness * (waterBuffer[pointAIndex] - 1.0f);
+        float const alphaCrazynessB = 1.0f + waterCrazyness * (waterBuffer[pointBIndex] - 1.0f);
+
+        float const outboundVelocityA = std::max(
+            waterVelocityBuffer[pointAIndex].dot(springNormalizedVector) + bernoulliVelocityAB * alphaCrazynessA,
+            0.0f);
+
+        float const outboundVelocityB = std::max(
+            -waterVelocityBuffer[pointBIndex].dot(springNormalizedVector) - bernoulliVelocityAB * alphaCrazynessB,
+            0.0f);
+
+        outPointAOutboundVelocityBuffer[s] = outboundVelocityA;
+        outPointBOutboundVelocityBuffer[s] = outboundVelocityB;
+        outPointAOutboundWeightBuffer[s] = outboundVelocityA / springFactoryRestLengthBuffer[s];
+        outPointBOutboundWeightBuffer[s] = outboundVelocityB / springFactoryRestLengthBuffer[s];
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<typename TEndpoints>
+inline void CalculateSpringOutboundWaterVelocities_SSEVectorized(
+    ElementIndex springIndex,
+    TEndpoints const * restrict const endpointsBuffer,
+    vec2f const * restrict const springNormalizedVectorBuffer,
+    float const * restrict const springFactoryRestLengthBuffer,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const waterBuffer,
+    vec2f const * restrict const waterVelocityBuffer,
+    float waterCrazyness,
+    float gravityMagnitude,
+    float * restrict const outPointAOutboundVelocityBuffer,
+    float * restrict const outPointBOutboundVelocityBuffer,
+    float * restrict const outPointAOutboundWeightBuffer,
+    float * restrict const outPointBOutboundWeightBuffer)
+{
+    // This code is vectorized for at least 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+
+    __m128 const Zero = _mm_setzero_ps();
+    __m128 const One = _mm_set1_ps(1.0f);
+    __m128 const SignMask = _mm_set1_ps(-0.0f);
+    __m128 const TwoGravity = _mm_set1_ps(2.0f * gravityMagnitude);
+    __m128 const WaterCrazyness = _mm_set1_ps(waterCrazyness);
+
+    auto const pa0 = endpointsBuffer[springIndex + 0].PointAIndex;
+    auto const pa1 = endpointsBuffer[springIndex + 1].PointAIndex;
+    auto const pa2 = endpointsBuffer[springIndex + 2].PointAIndex;
+    auto const pa3 = endpointsBuffer[springIndex + 3].PointAIndex;
+    auto const pb0 = endpointsBuffer[springIndex + 0].PointBIndex;
+    auto const pb1 = endpointsBuffer[springIndex + 1].PointBIndex;
+    auto const pb2 = endpointsBuffer[springIndex + 2].PointBIndex;
+    auto const pb3 = endpointsBuffer[springIndex + 3].PointBIndex;
+
+    // Gather water and position's y
+
+    __m128 const pa_water = _mm_setr_ps(waterBuffer[pa0], waterBuffer[pa1], waterBuffer[pa2], waterBuffer[pa3]);
+    __m128 const pb_water = _mm_setr_ps(waterBuffer[pb0], waterBuffer[pb1], waterBuffer[pb2], waterBuffer[pb3]);
+    __m128 const pa_pos_y = _mm_setr_ps(positionBuffer[pa0].y, positionBuffer[pa1].y, positionBuffer[pa2].y, positionBuffer[pa3].y);
+    __m128 const pb_pos_y = _mm_setr_ps(positionBuffer[pb0].y, positionBuffer[pb1].y, positionBuffer[pb2].y, positionBuffer[pb3].y);
+
+    // Gather water velocities, and shuffle them into xxxx, yyyy
+
+    __m128 const pa0pa1_wv_xy = _mm_movelh_ps( // First argument goes low
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pa0))),
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pa1))));
+    __m128 const pa2pa3_wv_xy = _mm_movelh_ps(
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pa2))),
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pa3))));
+    __m128 const pa_wv_x = _mm_shuffle_ps(pa0pa1_wv_xy, pa2pa3_wv_xy, 0x88);
+    __m128 const pa_wv_y = _mm_shuffle_ps(pa0pa1_wv_xy, pa2pa3_wv_xy, 0xDD);
+
+    __m128 const pb0pb1_wv_xy = _mm_movelh_ps(
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pb0))),
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pb1))));
+    __m128 const pb2pb3_wv_xy = _mm_movelh_ps(
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pb2))),
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(waterVelocityBuffer + pb3))));
+    __m128 const pb_wv_x = _mm_shuffle_ps(pb0pb1_wv_xy, pb2pb3_wv_xy, 0x88);
+    __m128 const pb_wv_y = _mm_shuffle_ps(pb0pb1_wv_xy, pb2pb3_wv_xy, 0xDD);
+
+    // Load spring directions - contiguous - and shuffle them into xxxx, yyyy
+
+    __m128 const s0s1_dir_xy = _mm_load_ps(reinterpret_cast<float const *>(springNormalizedVectorBuffer + springIndex));
+    __m128 const s2s3_dir_xy = _mm_load_ps(reinterpret_cast<float const *>(springNormalizedVectorBuffer + springIndex + 2));
+    __m128 const s_dir_x = _mm_shuffle_ps(s0s1_dir_xy, s2s3_dir_xy, 0x88);
+    __m128 const s_dir_y = _mm_shuffle_ps(s0s1_dir_xy, s2s3_dir_xy, 0xDD);
+
+    // Bernoulli's velocity from A to B: sign(dwy) * sqrt(2g * |dwy|)
+
+    __m128 const dwy = _mm_add_ps(
+        _mm_sub_ps(pa_water, pb_water),
+        _mm_sub_ps(pa_pos_y, pb_pos_y));
+
+    __m128 const bernoulliVelocityAB = _mm_or_ps(
+        _mm_sqrt_ps(_mm_mul_ps(TwoGravity, _mm_andnot_ps(SignMask, dwy))),
+        _mm_and_ps(SignMask, dwy));
+
+    // Crazyness alphas: 1 + crazyness * (w - 1)
+
+    __m128 const pa_alpha = _mm_add_ps(One, _mm_mul_ps(WaterCrazyness, _mm_sub_ps(pa_water, One)));
+    __m128 const pb_alpha = _mm_add_ps(One, _mm_mul_ps(WaterCrazyness, _mm_sub_ps(pb_water, One)));
+
+    // Outbound velocities
+
+    __m128 const pa_wv_along = _mm_add_ps(_mm_mul_ps(pa_wv_x, s_dir_x), _mm_mul_ps(pa_wv_y, s_dir_y));
+    __m128 const pa_outboundVelocity = _mm_max_ps(
+        _mm_add_ps(pa_wv_along, _mm_mul_ps(bernoulliVelocityAB, pa_alpha)),
+        Zero);
+
+    __m128 const pb_wv_along = _mm_add_ps(_mm_mul_ps(pb_wv_x, s_dir_x), _mm_mul_ps(pb_wv_y, s_dir_y));
+    __m128 const pb_outboundVelocity = _mm_max_ps(
+        _mm_sub_ps(Zero, _mm_add_ps(pb_wv_along, _mm_mul_ps(bernoulliVelocityAB, pb_alpha))),
+        Zero);
+
+    // Weights
+
+    __m128 const s_factoryRestLength = _mm_load_ps(springFactoryRestLengthBuffer + springIndex);
+
+    _mm_store_ps(outPointAOutboundVelocityBuffer + springIndex, pa_outboundVelocity);
+    _mm_store_ps(outPointBOutboundVelocityBuffer + springIndex, pb_outboundVelocity);
+    _mm_store_ps(outPointAOutboundWeightBuffer + springIndex, _mm_div_ps(pa_outboundVelocity, s_factoryRestLength));
+    _mm_store_ps(outPointBOutboundWeightBuffer + springIndex, _mm_div_ps(pb_outboundVelocity, s_factoryRestLength));
+}
+#endif
+
+#if FS_IS_ARM_NEON() // Implies ARM anyways
+template<typename TEndpoints>
+inline void CalculateSpringOutboundWaterVelocities_NeonVectorized(
+    ElementIndex springIndex,
+    TEndpoints const * restrict const endpointsBuffer,
+    vec2f const * restrict const springNormalizedVectorBuffer,
+    float const * restrict const springFactoryRestLengthBuffer,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const waterBuffer,
+    vec2f const * restrict const waterVelocityBuffer,
+    float waterCrazyness,
+    float gravityMagnitude,
+    float * restrict const outPointAOutboundVelocityBuffer,
+    float * restrict const outPointBOutboundVelocityBuffer,
+    float * restrict const outPointAOutboundWeightBuffer,
+    float * restrict const outPointBOutboundWeightBuffer)
+{
+    // This code is vectorized for at least 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+
+    float32x4_t const Zero = vdupq_n_f32(0.0f);
+    float32x4_t const One = vdupq_n_f32(1.0f);
+    float32x4_t const TwoGravity = vdupq_n_f32(2.0f * gravityMagnitude);
+    float32x4_t const WaterCrazyness = vdupq_n_f32(waterCrazyness);
+
+    auto const pa0 = endpointsBuffer[springIndex + 0].PointAIndex;
+    auto const pa1 = endpointsBuffer[springIndex + 1].PointAIndex;
+    auto const pa2 = endpointsBuffer[springIndex + 2].PointAIndex;
+    auto const pa3 = endpointsBuffer[springIndex + 3].PointAIndex;
+    auto const pb0 = endpointsBuffer[springIndex + 0].PointBIndex;
+    auto const pb1 = endpointsBuffer[springIndex + 1].PointBIndex;
+    auto const pb2 = endpointsBuffer[springIndex + 2].PointBIndex;
+    auto const pb3 = endpointsBuffer[springIndex + 3].PointBIndex;
+
+    // Gather water and position's y
+
+    aligned_to_vword float const tmpPaWater[4] = { waterBuffer[pa0], waterBuffer[pa1], waterBuffer[pa2], waterBuffer[pa3] };
+    aligned_to_vword float const tmpPbWater[4] = { waterBuffer[pb0], waterBuffer[pb1], waterBuffer[pb2], waterBuffer[pb3] };
+    aligned_to_vword float const tmpPaPosY[4] = { positionBuffer[pa0].y, positionBuffer[pa1].y, positionBuffer[pa2].y, positionBuffer[pa3].y };
+    aligned_to_vword float const tmpPbPosY[4] = { positionBuffer[pb0].y, positionBuffer[pb1].y, positionBuffer[pb2].y, positionBuffer[pb3].y };
+
+    float32x4_t const pa_water = vld1q_f32(tmpPaWater);
+    float32x4_t const pb_water = vld1q_f32(tmpPbWater);
+    float32x4_t const pa_pos_y = vld1q_f32(tmpPaPosY);
+    float32x4_t const pb_pos_y = vld1q_f32(tmpPbPosY);
+
+    // Gather water velocities, and transpose them into xxxx, yyyy
+
+    float32x4x2_t const pa_wv_xxxx_yyyy = vtrnq_f32(
+        vcombine_f32(
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pa0)),
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pa2))),
+        vcombine_f32(
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pa1)),
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pa3))));
+
+    float32x4x2_t const pb_wv_xxxx_yyyy = vtrnq_f32(
+        vcombine_f32(
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pb0)),
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pb2))),
+        vcombine_f32(
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pb1)),
+            vld1_f32(reinterpret_cast<float const *>(waterVelocityBuffer + pb3))));
+
+    // Load spring directions - contiguous - and de-interleave them into xxxx, yyyy
+
+    float32x4x2_t const s_dir_xxxx_yyyy = vld2q_f32(reinterpret_cast<float const *>(springNormalizedVectorBuffer + springIndex));
+
+    // Bernoulli's velocity from A to B: sign(dwy) * sqrt(2g * |dwy|)
+
+    float32x4_t const dwy = vaddq_f32(
+        vsubq_f32(pa_water, pb_water),
+        vsubq_f32(pa_pos_y, pb_pos_y));
+
+    float32x4_t const bernoulliArg = vmulq_f32(TwoGravity, vabsq_f32(dwy));
+
+    // sqrt(x) = x * 1/sqrt(x), with two newton-rhapson steps; x==0 => 0
+    float32x4_t bernoulliArg_inv_sqrt = vrsqrteq_f32(bernoulliArg);
+    bernoulliArg_inv_sqrt = vmulq_f32(
+        bernoulliArg_inv_sqrt,
+        vrsqrtsq_f32(vmulq_f32(bernoulliArg, bernoulliArg_inv_sqrt), bernoulliArg_inv_sqrt));
+    bernoulliArg_inv_sqrt = vmulq_f32(
+        bernoulliArg_inv_sqrt,
+        vrsqrtsq_f32(vmulq_f32(bernoulliArg, bernoulliArg_inv_sqrt), bernoulliArg_inv_sqrt));
+    float32x4_t const bernoulliVelocityMagnitude = vreinterpretq_f32_u32(
+        vandq_u32(
+            vreinterpretq_u32_f32(vmulq_f32(bernoulliArg, bernoulliArg_inv_sqrt)),
+            vcgtq_f32(bernoulliArg, Zero)));
+
+    float32x4_t const bernoulliVelocityAB = vbslq_f32(
+        vcltq_f32(dwy, Zero),
+        vnegq_f32(bernoulliVelocityMagnitude),
+        bernoulliVelocityMagnitude);
+
+    // Crazyness alphas: 1 + crazyness * (w - 1)
+
+    float32x4_t const pa_alpha = vmlaq_f32(One, WaterCrazyness, vsubq_f32(pa_water, One));
+    float32x4_t const pb_alpha = vmlaq_f32(One, WaterCrazyness, vsubq_f32(pb_water, One));
+
+    // Outbound velocities
+
+    float32x4_t const pa_wv_along = vmlaq_f32(
+        vmulq_f32(pa_wv_xxxx_yyyy.val[0], s_dir_xxxx_yyyy.val[0]),
+        pa_wv_xxxx_yyyy.val[1],
+        s_dir_xxxx_yyyy.val[1]);
+    float32x4_t const pa_outboundVelocity = vmaxq_f32(
+        vmlaq_f32(pa_wv_along, bernoulliVelocityAB, pa_alpha),
+        Zero);
+
+    float32x4_t const pb_wv_along = vmlaq_f32(
+        vmulq_f32(pb_wv_xxxx_yyyy.val[0], s_dir_xxxx_yyyy.val[0]),
+        pb_wv_xxxx_yyyy.val[1],
+        s_dir_xxxx_yyyy.val[1]);
+    float32x4_t const pb_outboundVelocity = vmaxq_f32(
+        vnegq_f32(vmlaq_f32(pb_wv_along, bernoulliVelocityAB, pb_alpha)),
+        Zero);
+
+    // Weights: velocity / rest length, with one newton-rhapson step on the reciprocal
+
+    float32x4_t const s_factoryRestLength = vld1q_f32(springFactoryRestLengthBuffer + springIndex);
+    float32x4_t s_factoryRestLength_inv = vrecpeq_f32(s_factoryRestLength);
+    s_factoryRestLength_inv = vmulq_f32(
+        s_factoryRestLength_inv,
+        vrecpsq_f32(s_factoryRestLength, s_factoryRestLength_inv));
+
+    vst1q_f32(outPointAOutboundVelocityBuffer + springIndex, pa_outboundVelocity);
+    vst1q_f32(outPointBOutboundVelocityBuffer + springIndex, pb_outboundVelocity);
+    vst1q_f32(outPointAOutboundWeightBuffer + springIndex, vmulq_f32(pa_outboundVelocity, s_factoryRestLength_inv));
+    vst1q_f32(outPointBOutboundWeightBuffer + springIndex, vmulq_f32(pb_outboundVelocity, s_factoryRestLength_inv));
+}
+#endif
+
+template<typename TEndpoints>
+inline void CalculateSpringOutboundWaterVelocities(
+    ElementIndex springIndex,
+    TEndpoints const * restrict const endpointsBuffer,
+    vec2f const * restrict const springNormalizedVectorBuffer,
+    float const * restrict const springFactoryRestLengthBuffer,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const waterBuffer,
+    vec2f const * restrict const waterVelocityBuffer,
+    float waterCrazyness,
+    float gravityMagnitude,
+    float * restrict const outPointAOutboundVelocityBuffer,
+    float * restrict const outPointBOutboundVelocityBuffer,
+    float * restrict const outPointAOutboundWeightBuffer,
+    float * restrict const outPointBOutboundWeightBuffer)
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    CalculateSpringOutboundWaterVelocities_SSEVectorized<TEndpoints>(
+#elif FS_IS_ARM_NEON()
+    CalculateSpringOutboundWaterVelocities_NeonVectorized<TEndpoints>(
+#else
+    CalculateSpringOutboundWaterVelocities_Naive<TEndpoints>(
+#endif
+        springIndex,
+        endpointsBuffer,
+        springNormalizedVectorBuffer,
+        springFactoryRestLengthBuffer,
+        positionBuffer,
+        waterBuffer,
+        waterVelocityBuffer,
+        waterCrazyness,
+        gravityMagnitude,
+        outPointAOutboundVelocityBuffer,
+        outPointBOutboundVelocityBuffer,
+        outPointAOutboundWeightBuffer,
+        outPointBOutboundWeightBuffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// DissipateHeat
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Dissipates the heat of the specified points into their environment - water
+ * when underwater or smothered with water, air otherwise - without overshooting
+ * its temperature.
+ *
+ * Since the heat lost has the same sign as the temperature delta, not overshooting
+ * amounts to clamping the fraction of the delta that is lost to 1.0.
+ */
+inline void DissipateHeat_Naive(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const cachedDepthBuffer,
+    float const * restrict const waterBuffer,
+    float const * restrict const materialHeatCapacityReciprocalBuffer,
+    float smotheringWaterHighWatermark,
+    float surfaceWaterTemperature,
+    float thermoclineSlope,
+    float waterConvectiveHeatTransferCoefficient,
+    float airTemperature,
+    float airConvectiveHeatTransferCoefficient,
+    float * restrict const temperatureBuffer)
+{
+    for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+    {
+        float environmentTemperature;
+        float convectiveHeatTransferCoefficient;
+        if (cachedDepthBuffer[p] > 0.0f || waterBuffer[p] > smotheringWaterHighWatermark)
+        {
+            // Dissipation in water
+            environmentTemperature = surfaceWaterTemperature - Clamp(positionBuffer[p].y * thermoclineSlope, 0.0f, surfaceWaterTemperature);
+            convectiveHeatTransferCoefficient = waterConvectiveHeatTransferCoefficient;
+        }
+        else
+        {
+            // Dissipation in air
+            environmentTemperature = airTemperature;
+            convectiveHeatTransferCoefficient = airConvectiveHeatTransferCoefficient;
+        }
+
+        // Temperature delta (particle - env)
+        float const deltaT = temperatureBuffer[p] - environmentTemperature;
+
+        temperatureBuffer[p] -=
+            deltaT
+            * std::min(convectiveHeatTransferCoefficient * materialHeatCapacityReciprocalBuffer[p], 1.0f);
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+inline void DissipateHeat_SSEVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const cachedDepthBuffer,
+    float const * restrict const waterBuffer,
+    float const * restrict const materialHeatCapacityReciprocalBuffer,
+    float smotheringWaterHighWatermark,
+    float surfaceWaterTemperature,
+    float thermoclineSlope,
+    float waterConvectiveHeatTransferCoefficient,
+    float airTemperature,
+    float airConvectiveHeatTransferCoefficient,
+    float * restrict const temperatureBuffer)
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    __m128 const Zero = _mm_setzero_ps();
+    __m128 const One = _mm_set1_ps(1.0f);
+    __m128 const SmotheringWaterHighWatermark = _mm_set1_ps(smotheringWaterHighWatermark);
+    __m128 const SurfaceWaterTemperature = _mm_set1_ps(surfaceWaterTemperature);
+    __m128 const ThermoclineSlope = _mm_set1_ps(thermoclineSlope);
+    __m128 const WaterConvectiveHeatTransferCoefficient = _mm_set1_ps(waterConvectiveHeatTransferCoefficient);
+    __m128 const AirTemperature = _mm_set1_ps(airTemperature);
+    __m128 const AirConvectiveHeatTransferCoefficient = _mm_set1_ps(airConvectiveHeatTransferCoefficient);
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        // In water?
+        __m128 const isInWater = _mm_or_ps(
+            _mm_cmpgt_ps(_mm_load_ps(cachedDepthBuffer + p), Zero),
+            _mm_cmpgt_ps(_mm_load_ps(waterBuffer + p), SmotheringWaterHighWatermark));
+
+        // Load positions - contiguous - and shuffle them into yyyy
+        __m128 const p0p1_pos_xy = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + p));
+        __m128 const p2p3_pos_xy = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + p + 2));
+        __m128 const pos_y = _mm_shuffle_ps(p0p1_pos_xy, p2p3_pos_xy, 0xDD);
+
+        // Water temperature: surface - clamp(y * slope, 0, surface)
+        __m128 const waterTemperature = _mm_sub_ps(
+            SurfaceWaterTemperature,
+            _mm_min_ps(
+                _mm_max_ps(_mm_mul_ps(pos_y, ThermoclineSlope), Zero),
+                SurfaceWaterTemperature));
+
+        // Choose environment
+        __m128 const environmentTemperature = _mm_or_ps(
+            _mm_and_ps(isInWater, waterTemperature),
+            _mm_andnot_ps(isInWater, AirTemperature));
+        __m128 const convectiveHeatTransferCoefficient = _mm_or_ps(
+            _mm_and_ps(isInWater, WaterConvectiveHeatTransferCoefficient),
+            _mm_andnot_ps(isInWater, AirConvectiveHeatTransferCoefficient));
+
+        // T -= deltaT * min(coeff * hcr, 1)
+        __m128 const temperature = _mm_load_ps(temperatureBuffer + p);
+        __m128 const deltaT = _mm_sub_ps(temperature, environmentTemperature);
+        __m128 const lostFraction = _mm_min_ps(
+            _mm_mul_ps(convectiveHeatTransferCoefficient, _mm_load_ps(materialHeatCapacityReciprocalBuffer + p)),
+            One);
+
+        _mm_store_ps(temperatureBuffer + p, _mm_sub_ps(temperature, _mm_mul_ps(deltaT, lostFraction)));
+    }
+}
+#endif
+
+#if FS_IS_ARM_NEON() // Implies ARM anyways
+inline void DissipateHeat_NeonVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const cachedDepthBuffer,
+    float const * restrict const waterBuffer,
+    float const * restrict const materialHeatCapacityReciprocalBuffer,
+    float smotheringWaterHighWatermark,
+    float surfaceWaterTemperature,
+    float thermoclineSlope,
+    float waterConvectiveHeatTransferCoefficient,
+    float airTemperature,
+    float airConvectiveHeatTransferCoefficient,
+    float * restrict const temperatureBuffer)
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    float32x4_t const Zero = vdupq_n_f32(0.0f);
+    float32x4_t const One = vdupq_n_f32(1.0f);
+    float32x4_t const SmotheringWaterHighWatermark = vdupq_n_f32(smotheringWaterHighWatermark);
+    float32x4_t const SurfaceWaterTemperature = vdupq_n_f32(surfaceWaterTemperature);
+    float32x4_t const ThermoclineSlope = vdupq_n_f32(thermoclineSlope);
+    float32x4_t const WaterConvectiveHeatTransferCoefficient = vdupq_n_f32(waterConvectiveHeatTransferCoefficient);
+    float32x4_t const AirTemperature = vdupq_n_f32(airTemperature);
+    float32x4_t const AirConvectiveHeatTransferCoefficient = vdupq_n_f32(airConvectiveHeatTransferCoefficient);
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        // In water?
+        uint32x4_t const isInWater = vorrq_u32(
+            vcgtq_f32(vld1q_f32(cachedDepthBuffer + p), Zero),
+            vcgtq_f32(vld1q_f32(waterBuffer + p), SmotheringWaterHighWatermark));
+
+        // Load positions - contiguous - and de-interleave them into xxxx, yyyy
+        float32x4x2_t const pos_xxxx_yyyy = vld2q_f32(reinterpret_cast<float const *>(positionBuffer + p));
+
+        // Water temperature: surface - clamp(y * slope, 0, surface)
+        float32x4_t const waterTemperature = vsubq_f32(
+            SurfaceWaterTemperature,
+            vminq_f32(
+                vmaxq_f32(vmulq_f32(pos_xxxx_yyyy.val[1], ThermoclineSlope), Zero),
+                SurfaceWaterTemperature));
+
+        // Choose environment
+        float32x4_t const environmentTemperature = vbslq_f32(isInWater, waterTemperature, AirTemperature);
+        float32x4_t const convectiveHeatTransferCoefficient = vbslq_f32(isInWater, WaterConvectiveHeatTransferCoefficient, AirConvectiveHeatTransferCoefficient);
+
+        // T -= deltaT * min(coeff * hcr, 1)
+        float32x4_t const temperature = vld1q_f32(temperatureBuffer + p);
+        float32x4_t const deltaT = vsubq_f32(temperature, environmentTemperature);
+        float32x4_t const lostFraction = vminq_f32(
+            vmulq_f32(convectiveHeatTransferCoefficient, vld1q_f32(materialHeatCapacityReciprocalBuffer + p)),
+            One);
+
+        vst1q_f32(temperatureBuffer + p, vmlsq_f32(temperature, deltaT, lostFraction));
+    }
+}
+#endif
+
+inline void DissipateHeat(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer,
+    float const * restrict const cachedDepthBuffer,
+    float const * restrict const waterBuffer,
+    float const * restrict const materialHeatCapacityReciprocalBuffer,
+    float smotheringWaterHighWatermark,
+    float surfaceWaterTemperature,
+    float thermoclineSlope,
+    float waterConvectiveHeatTransferCoefficient,
+    float airTemperature,
+    float airConvectiveHeatTransferCoefficient,
+    float * restrict const temperatureBuffer)
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    DissipateHeat_SSEVectorized(
+#elif FS_IS_ARM_NEON()
+    DissipateHeat_NeonVectorized(
+#else
+    DissipateHeat_Naive(
+#endif
+        startPointIndex,
+        endPointIndex,
+        positionBuffer,
+        cachedDepthBuffer,
+        waterBuffer,
+        materialHeatCapacityReciprocalBuffer,
+        smotheringWaterHighWatermark,
+        surfaceWaterTemperature,
+        thermoclineSlope,
+        waterConvectiveHeatTransferCoefficient,
+        airTemperature,
+        airConvectiveHeatTransferCoefficient,
+        temperatureBuffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// ApplyWorldParticleForces
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Adds to the static force of each of the specified points the forces that the
+ * world exerts on it - gravity, buoyancy, friction drag, and global wind - smoothly
+ * transitioning between air and water at the air-water interface.
+ */
+template<typename TBuoyancyCoefficients>
+inline void ApplyWorldParticleForces_Naive(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float const * restrict const depthBuffer,
+    float const * restrict const airWaterInterfaceInverseWidthBuffer,
+    float const * restrict const massBuffer,
+    TBuoyancyCoefficients const * restrict const buoyancyCoefficientsBuffer,
+    float const * restrict const temperatureBuffer,
+    vec2f const * restrict const velocityBuffer,
+    float const * restrict const materialWindReceptivityBuffer,
+    vec2f const & gravity,
+    float effectiveAirDensity,
+    float effectiveWaterDensity,
+    float airFrictionDragCoefficient,
+    float waterFrictionDragCoefficient,
+    vec2f const & globalWindForce,
+    vec2f * restrict const staticForceBuffer)
+{
+    for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+    {
+        vec2f staticForce = vec2f::zero();
+
+        //
+        // Calculate above/under-water coefficient
+        //
+        // 0.0: above water
+        // 1.0: under water
+        // in-between: smooth air-water interface (nature abhors discontinuities)
+        //
+
+        float const uwCoefficient = Clamp(depthBuffer[p] * airWaterInterfaceInverseWidthBuffer[p], 0.0f, 1.0f);
+
+        //
+        // Apply gravity
+        //
+
+        staticForce +=
+            gravity
+            * massBuffer[p]; // Material + Augmentation + Water
+
+        //
+        // Apply water/air buoyancy
+        //
+
+        // Calculate upward push of water/air mass
+        float const buoyancyPush =
+            buoyancyCoefficientsBuffer[p].Coefficient1
+            + buoyancyCoefficientsBuffer[p].Coefficient2 * temperatureBuffer[p];
+
+        // Apply buoyancy
+        staticForce.y +=
+            buoyancyPush
+            * Mix(effectiveAirDensity, effectiveWaterDensity, uwCoefficient);
+
+        //
+        // Apply friction drag
+        //
+        // We use a linear law for simplicity.
+        //
+        // With a linear law, we know that the force will never overcome the current velocity
+        // as long as m > (C * dt) (~=0.0016 for water drag), which is a mass we won't have in our system (air is 1.2754);
+        // hence we don't care here about capping the force to prevent overcoming accelerations.
+        //
+
+        staticForce +=
+            -velocityBuffer[p]
+            * Mix(airFrictionDragCoefficient, waterFrictionDragCoefficient, uwCoefficient);
+
+        //
+        // Global (linear) wind force
+        //
+
+        // Note: should be based on relative velocity, but we simplify here for performance reasons
+        staticForce +=
+            globalWindForce
+            * materialWindReceptivityBuffer[p]
+            * (1.0f - uwCoefficient); // Only above-water (modulated)
+
+        staticForceBuffer[p] += staticForce;
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<typename TBuoyancyCoefficients>
+inline void ApplyWorldParticleForces_SSEVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float const * restrict const depthBuffer,
+    float const * restrict const airWaterInterfaceInverseWidthBuffer,
+    float const * restrict const massBuffer,
+    TBuoyancyCoefficients const * restrict const buoyancyCoefficientsBuffer,
+    float const * restrict const temperatureBuffer,
+    vec2f const * restrict const velocityBuffer,
+    float const * restrict const materialWindReceptivityBuffer,
+    vec2f const & gravity,
+    float effectiveAirDensity,
+    float effectiveWaterDensity,
+    float airFrictionDragCoefficient,
+    float waterFrictionDragCoefficient,
+    vec2f const & globalWindForce,
+    vec2f * restrict const staticForceBuffer)
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    static_assert(sizeof(TBuoyancyCoefficients) == 2 * sizeof(float));
+    assert((startPointIndex % 4) == 0);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    __m128 const Zero = _mm_setzero_ps();
+    __m128 const One = _mm_set1_ps(1.0f);
+    __m128 const GravityX = _mm_set1_ps(gravity.x);
+    __m128 const GravityY = _mm_set1_ps(gravity.y);
+    __m128 const AirDensity = _mm_set1_ps(effectiveAirDensity);
+    __m128 const WaterMinusAirDensity = _mm_set1_ps(effectiveWaterDensity - effectiveAirDensity);
+    __m128 const AirFrictionDragCoefficient = _mm_set1_ps(airFrictionDragCoefficient);
+    __m128 const WaterMinusAirFrictionDragCoefficient = _mm_set1_ps(waterFrictionDragCoefficient - airFrictionDragCoefficient);
+    __m128 const GlobalWindForceX = _mm_set1_ps(globalWindForce.x);
+    __m128 const GlobalWindForceY = _mm_set1_ps(globalWindForce.y);
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        // Above/under-water coefficient: clamp(depth * iw, 0, 1)
+        __m128 const uwCoefficient = _mm_min_ps(
+            _mm_max_ps(
+                _mm_mul_ps(_mm_load_ps(depthBuffer + p), _mm_load_ps(airWaterInterfaceInverseWidthBuffer + p)),
+                Zero),
+            One);
+
+        // Load buoyancy coefficients - contiguous - and shuffle them into 1111, 2222
+        __m128 const p0p1_bc_12 = _mm_load_ps(reinterpret_cast<float const *>(buoyancyCoefficientsBuffer + p));
+        __m128 const p2p3_bc_12 = _mm_load_ps(reinterpret_cast<float const *>(buoyancyCoefficientsBuffer + p + 2));
+        __m128 const bc_1 = _mm_shuffle_ps(p0p1_bc_12, p2p3_bc_12, 0x88);
+        __m128 const bc_2 = _mm_shuffle_ps(p0p1_bc_12, p2p3_bc_12, 0xDD);
+
+        // Buoyancy: (c1 + c2 * T) * mix(air, water, uw)
+        __m128 const buoyancy = _mm_mul_ps(
+            _mm_add_ps(bc_1, _mm_mul_ps(bc_2, _mm_load_ps(temperatureBuffer + p))),
+            _mm_add_ps(AirDensity, _mm_mul_ps(WaterMinusAirDensity, uwCoefficient)));
+
+        // Load velocities - contiguous - and shuffle them into xxxx, yyyy
+        __m128 const p0p1_vel_xy = _mm_load_ps(reinterpret_cast<float const *>(velocityBuffer + p));
+        __m128 const p2p3_vel_xy = _mm_load_ps(reinterpret_cast<float const *>(velocityBuffer + p + 2));
+        __m128 const vel_x = _mm_shuffle_ps(p0p1_vel_xy, p2p3_vel_xy, 0x88);
+        __m128 const vel_y = _mm_shuffle_ps(p0p1_vel_xy, p2p3_vel_xy, 0xDD);
+
+        // Friction drag coefficient: mix(air, water, uw)
+        __m128 const frictionDragCoefficient = _mm_add_ps(AirFrictionDragCoefficient, _mm_mul_ps(WaterMinusAirFrictionDragCoefficient, uwCoefficient));
+
+        // Wind modulation: receptivity * (1 - uw)
+        __m128 const windFactor = _mm_mul_ps(_mm_load_ps(materialWindReceptivityBuffer + p), _mm_sub_ps(One, uwCoefficient));
+
+        // Total: gravity * m - v * drag + wind * factor (+ buoyancy along y)
+        __m128 const mass = _mm_load_ps(massBuffer + p);
+        __m128 const force_x = _mm_add_ps(
+            _mm_sub_ps(_mm_mul_ps(GravityX, mass), _mm_mul_ps(vel_x, frictionDragCoefficient)),
+            _mm_mul_ps(GlobalWindForceX, windFactor));
+        __m128 const force_y = _mm_add_ps(
+            _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(GravityY, mass), buoyancy),
+                _mm_sub_ps(Zero, _mm_mul_ps(vel_y, frictionDragCoefficient))),
+            _mm_mul_ps(GlobalWindForceY, windFactor));
+
+        // Interleave back into xy, and add
+        float * const restrict staticForce = reinterpret_cast<float *>(staticForceBuffer + p);
+        _mm_store_ps(staticForce, _mm_add_ps(_mm_load_ps(staticForce), _mm_unpacklo_ps(force_x, force_y)));
+        _mm_store_ps(staticForce + 4, _mm_add_ps(_mm_load_ps(staticForce + 4), _mm_unpackhi_ps(force_x, force_y)));
+    }
+}
+#endif
+
+#if FS_IS_ARM_NEON() // Implies ARM anyways
+template<typename TBuoyancyCoefficients>
+inline void ApplyWorldParticleForces_NeonVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float const * restrict const depthBuffer,
+    float const * restrict const airWaterInterfaceInverseWidthBuffer,
+    float const * restrict const massBuffer,
+    TBuoyancyCoefficients const * restrict const buoyancyCoefficientsBuffer,
+    float const * restrict const temperatureBuffer,
+    vec2f const * restrict const velocityBuffer,
+    float const * restrict const materialWindReceptivityBuffer,
+    vec2f const & gravity,
+    float effectiveAirDensity,
+    float effectiveWaterDensity,
+    float airFrictionDragCoefficient,
+    float waterFrictionDragCoefficient,
+    vec2f const & globalWindForce,
+    vec2f * restrict const staticForceBuffer)
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    static_assert(sizeof(TBuoyancyCoefficients) == 2 * sizeof(float));
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    float32x4_t const Zero = vdupq_n_f32(0.0f);
+    float32x4_t const One = vdupq_n_f32(1.0f);
+    float32x4_t const GravityX = vdupq_n_f32(gravity.x);
+    float32x4_t const GravityY = vdupq_n_f32(gravity.y);
+    float32x4_t const AirDensity = vdupq_n_f32(effectiveAirDensity);
+    float32x4_t const WaterMinusAirDensity = vdupq_n_f32(effectiveWaterDensity - effectiveAirDensity);
+    float32x4_t const AirFrictionDragCoefficient = vdupq_n_f32(airFrictionDragCoefficient);
+    float32x4_t const WaterMinusAirFrictionDragCoefficient = vdupq_n_f32(waterFrictionDragCoefficient - airFrictionDragCoefficient);
+    float32x4_t const GlobalWindForceX = vdupq_n_f32(globalWindForce.x);
+    float32x4_t const GlobalWindForceY = vdupq_n_f32(globalWindForce.y);
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        // Above/under-water coefficient: clamp(depth * iw, 0, 1)
+        float32x4_t const uwCoefficient = vminq_f32(
+            vmaxq_f32(
+                vmulq_f32(vld1q_f32(depthBuffer + p), vld1q_f32(airWaterInterfaceInverseWidthBuffer + p)),
+                Zero),
+            One);
+
+        // Load buoyancy coefficients - contiguous - and de-interleave them into 1111, 2222
+        float32x4x2_t const bc_1111_2222 = vld2q_f32(reinterpret_cast<float const *>(buoyancyCoefficientsBuffer + p));
+
+        // Buoyancy: (c1 + c2 * T) * mix(air, water, uw)
+        float32x4_t const buoyancy = vmulq_f32(
+            vmlaq_f32(bc_1111_2222.val[0], bc_1111_2222.val[1], vld1q_f32(temperatureBuffer + p)),
+            vmlaq_f32(AirDensity, WaterMinusAirDensity, uwCoefficient));
+
+        // Load velocities - contiguous - and de-interleave them into xxxx, yyyy
+        float32x4x2_t const vel_xxxx_yyyy = vld2q_f32(reinterpret_cast<float const *>(velocityBuffer + p));
+
+        // Friction drag coefficient: mix(air, water, uw)
+        float32x4_t const frictionDragCoefficient = vmlaq_f32(AirFrictionDragCoefficient, WaterMinusAirFrictionDragCoefficient, uwCoefficient);
+
+        // Wind modulation: receptivity * (1 - uw)
+        float32x4_t const windFactor = vmulq_f32(vld1q_f32(materialWindReceptivityBuffer + p), vsubq_f32(One, uwCoefficient));
+
+        // Total: gravity * m - v * drag + wind * factor (+ buoyancy along y)
+        float32x4_t const mass = vld1q_f32(massBuffer + p);
+        float32x4x2_t staticForce_xxxx_yyyy = vld2q_f32(reinterpret_cast<float const *>(staticForceBuffer + p));
+        staticForce_xxxx_yyyy.val[0] = vaddq_f32(
+            staticForce_xxxx_yyyy.val[0],
+            vmlaq_f32(
+                vmlsq_f32(vmulq_f32(GravityX, mass), vel_xxxx_yyyy.val[0], frictionDragCoefficient),
+                GlobalWindForceX,
+                windFactor));
+        staticForce_xxxx_yyyy.val[1] = vaddq_f32(
+            staticForce_xxxx_yyyy.val[1],
+            vmlaq_f32(
+                vmlsq_f32(vmlaq_f32(buoyancy, GravityY, mass), vel_xxxx_yyyy.val[1], frictionDragCoefficient),
+                GlobalWindForceY,
+                windFactor));
+
+        // Interleave back into xy
+        vst2q_f32(reinterpret_cast<float *>(staticForceBuffer + p), staticForce_xxxx_yyyy);
+    }
+}
+#endif
+
+template<typename TBuoyancyCoefficients>
+inline void ApplyWorldParticleForces(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float const * restrict const depthBuffer,
+    float const * restrict const airWaterInterfaceInverseWidthBuffer,
+    float const * restrict const massBuffer,
+    TBuoyancyCoefficients const * restrict const buoyancyCoefficientsBuffer,
+    float const * restrict const temperatureBuffer,
+    vec2f const * restrict const velocityBuffer,
+    float const * restrict const materialWindReceptivityBuffer,
+    vec2f const & gravity,
+    float effectiveAirDensity,
+    float effectiveWaterDensity,
+    float airFrictionDragCoefficient,
+    float waterFrictionDragCoefficient,
+    vec2f const & globalWindForce,
+    vec2f * restrict const staticForceBuffer)
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    ApplyWorldParticleForces_SSEVectorized<TBuoyancyCoefficients>(
+#elif FS_IS_ARM_NEON()
+    ApplyWorldParticleForces_NeonVectorized<TBuoyancyCoefficients>(
+#else
+    ApplyWorldParticleForces_Naive<TBuoyancyCoefficients>(
+#endif
+        startPointIndex,
+        endPointIndex,
+        depthBuffer,
+        airWaterInterfaceInverseWidthBuffer,
+        massBuffer,
+        buoyancyCoefficientsBuffer,
+        temperatureBuffer,
+        velocityBuffer,
+        materialWindReceptivityBuffer,
+        gravity,
+        effectiveAirDensity,
+        effectiveWaterDensity,
+        airFrictionDragCoefficient,
+        waterFrictionDragCoefficient,
+        globalWindForce,
+        staticForceBuffer);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // IntegrateAndResetDynamicForces
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -960,6 +1957,106 @@ inline void IntegrateAndResetDynamicForces_SSEVectorized(
         }
     }
 }
+
+template<typename TPoints>
+FS_TARGET_AVX2_FMA inline void IntegrateAndResetDynamicForces_AVX2Vectorized(
+    TPoints & points,
+    size_t nBuffers,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float * const restrict * dynamicForceBuffers,
+    float dt,
+    float velocityFactor) noexcept
+{
+    // This implementation is for 8-float AVX, with a 4-float tail; buffers are only
+    // aligned to the (SSE) vectorization word, hence loads and stores are unaligned
+    static_assert(vectorization_float_count<int> >= 4);
+
+    assert(((endPointIndex - startPointIndex) % 2) == 0);
+
+    float * restrict const positionBuffer = points.GetPositionBufferAsFloat();
+    float * restrict const velocityBuffer = points.GetVelocityBufferAsFloat();
+    float const * const restrict staticForceBuffer = points.GetStaticForceBufferAsFloat();
+    float const * const restrict integrationFactorBuffer = points.GetIntegrationFactorBufferAsFloat();
+
+    float * const restrict * restrict const dynamicForceBufferOfBuffers = dynamicForceBuffers;
+
+    __m256 const zero_8 = _mm256_setzero_ps();
+    __m256 const dt_8 = _mm256_set1_ps(dt);
+    __m256 const velocityFactor_8 = _mm256_set1_ps(velocityFactor);
+
+    size_t i = startPointIndex * 2;
+    for (; i + 8 <= endPointIndex * 2; i += 8) // Two components per vector
+    {
+        __m256 springForce_4 = zero_8;
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            springForce_4 =
+                _mm256_add_ps(
+                    springForce_4,
+                    _mm256_loadu_ps(dynamicForceBufferOfBuffers[b] + i));
+        }
+
+        // vec2f const deltaPos =
+        //    velocityBuffer[i] * dt
+        //    + (springForceBuffer[i] + externalForceBuffer[i]) * integrationFactorBuffer[i];
+        __m256 const deltaPos_4 =
+            _mm256_fmadd_ps(
+                _mm256_loadu_ps(velocityBuffer + i),
+                dt_8,
+                _mm256_mul_ps(
+                    _mm256_add_ps(
+                        springForce_4,
+                        _mm256_loadu_ps(staticForceBuffer + i)),
+                    _mm256_loadu_ps(integrationFactorBuffer + i)));
+
+        // positionBuffer[i] += deltaPos;
+        _mm256_storeu_ps(positionBuffer + i, _mm256_add_ps(_mm256_loadu_ps(positionBuffer + i), deltaPos_4));
+
+        // velocityBuffer[i] = deltaPos * velocityFactor;
+        _mm256_storeu_ps(velocityBuffer + i, _mm256_mul_ps(deltaPos_4, velocityFactor_8));
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            _mm256_storeu_ps(dynamicForceBufferOfBuffers[b] + i, zero_8);
+        }
+    }
+
+    if (i < endPointIndex * 2)
+    {
+        // Last two points
+
+        assert(i + 4 == endPointIndex * 2);
+
+        __m128 springForce_2 = _mm_setzero_ps();
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            springForce_2 =
+                _mm_add_ps(
+                    springForce_2,
+                    _mm_load_ps(dynamicForceBufferOfBuffers[b] + i));
+        }
+
+        __m128 const deltaPos_2 =
+            _mm_fmadd_ps(
+                _mm_load_ps(velocityBuffer + i),
+                _mm256_castps256_ps128(dt_8),
+                _mm_mul_ps(
+                    _mm_add_ps(
+                        springForce_2,
+                        _mm_load_ps(staticForceBuffer + i)),
+                    _mm_load_ps(integrationFactorBuffer + i)));
+
+        _mm_store_ps(positionBuffer + i, _mm_add_ps(_mm_load_ps(positionBuffer + i), deltaPos_2));
+        _mm_store_ps(velocityBuffer + i, _mm_mul_ps(deltaPos_2, _mm256_castps256_ps128(velocityFactor_8)));
+
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            _mm_store_ps(dynamicForceBufferOfBuffers[b] + i, _mm_setzero_ps());
+        }
+    }
+}
 #endif
 
 #if FS_IS_ARM_NEON() // Implies ARM anyways
@@ -1065,7 +2162,10 @@ inline void IntegrateAndResetDynamicForces(
     float velocityFactor) noexcept
 {
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
-    IntegrateAndResetDynamicForces_SSEVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
+    if (IsAVX2FMASupported())
+        IntegrateAndResetDynamicForces_AVX2Vectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
+    else
+        IntegrateAndResetDynamicForces_SSEVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
 #elif FS_IS_ARM_NEON()
     IntegrateAndResetDynamicForces_NeonVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
 #else
@@ -1093,6 +2193,56 @@ inline void IntegrateAndResetDynamicForces(
         velocityFactor);
 }
 
+/*
+ * Integrates forces and resets dynamic forces, like IntegrateAndResetDynamicForces, but
+ * with dynamic forces - i.e. spring forces - scaled by the specified over-relaxation factor.
+ *
+ * Only used by the Chebyshev spring relaxation mode, whose factors vary at each iteration;
+ * simple enough for compilers to vectorize it, hence it comes in one flavor only.
+ */
+
+template<typename TPoints>
+inline void IntegrateAndResetDynamicForcesWithOverRelaxation(
+    TPoints & points,
+    size_t nBuffers,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float * const restrict * dynamicForceBuffers,
+    float dt,
+    float velocityFactor,
+    float dynamicForceRelaxationFactor) noexcept
+{
+    // We loop by floats
+
+    float * restrict const positionBuffer = points.GetPositionBufferAsFloat() + startPointIndex * 2;
+    float * restrict const velocityBuffer = points.GetVelocityBufferAsFloat() + startPointIndex * 2;
+    float const * const restrict staticForceBuffer = points.GetStaticForceBufferAsFloat() + startPointIndex * 2;
+    float const * const restrict integrationFactorBuffer = points.GetIntegrationFactorBufferAsFloat() + startPointIndex * 2;
+
+    size_t const count = (endPointIndex - startPointIndex) * 2;
+    for (size_t i = 0; i < count; ++i)
+    {
+        float totalDynamicForce = 0.0f;
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            totalDynamicForce += (dynamicForceBuffers[b] + startPointIndex * 2)[i];
+        }
+
+        float const deltaPos =
+            velocityBuffer[i] * dt
+            + (totalDynamicForce * dynamicForceRelaxationFactor + staticForceBuffer[i]) * integrationFactorBuffer[i];
+
+        positionBuffer[i] += deltaPos;
+        velocityBuffer[i] = deltaPos * velocityFactor;
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            (dynamicForceBuffers[b] + startPointIndex * 2)[i] = 0.0f;
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // ApplySpringForces
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2322,6 +3472,125 @@ inline void ApplySpringsForces(
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// MakePointsAABB
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Calculates the AABB of the specified points; the AABB of no points is the empty
+ * (inverted) one.
+ */
+inline Geometry::AABB MakePointsAABB_Naive(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer) noexcept
+{
+    Geometry::AABB result;
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+    {
+        result.ExtendTo(positionBuffer[p]);
+    }
+
+    return result;
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+inline Geometry::AABB MakePointsAABB_SSEVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer) noexcept
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    // Positions are contiguous, hence we work on xyxy
+    __m128 min_xyxy_1 = _mm_set1_ps(std::numeric_limits<float>::max());
+    __m128 min_xyxy_2 = min_xyxy_1;
+    __m128 max_xyxy_1 = _mm_set1_ps(std::numeric_limits<float>::lowest());
+    __m128 max_xyxy_2 = max_xyxy_1;
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        __m128 const p0p1_pos_xy = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + p));
+        __m128 const p2p3_pos_xy = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + p + 2));
+
+        min_xyxy_1 = _mm_min_ps(min_xyxy_1, p0p1_pos_xy);
+        min_xyxy_2 = _mm_min_ps(min_xyxy_2, p2p3_pos_xy);
+        max_xyxy_1 = _mm_max_ps(max_xyxy_1, p0p1_pos_xy);
+        max_xyxy_2 = _mm_max_ps(max_xyxy_2, p2p3_pos_xy);
+    }
+
+    // Fold into xy
+    __m128 min_xyxy = _mm_min_ps(min_xyxy_1, min_xyxy_2);
+    min_xyxy = _mm_min_ps(min_xyxy, _mm_movehl_ps(min_xyxy, min_xyxy));
+    __m128 max_xyxy = _mm_max_ps(max_xyxy_1, max_xyxy_2);
+    max_xyxy = _mm_max_ps(max_xyxy, _mm_movehl_ps(max_xyxy, max_xyxy));
+
+    Geometry::AABB result;
+
+    _mm_storel_pi(reinterpret_cast<__m64 *>(&(result.BottomLeft.x)), min_xyxy);
+    _mm_storel_pi(reinterpret_cast<__m64 *>(&(result.TopRight.x)), max_xyxy);
+
+    return result;
+}
+#endif
+
+#if FS_IS_ARM_NEON() // Implies ARM anyways
+inline Geometry::AABB MakePointsAABB_NeonVectorized(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer) noexcept
+{
+    // This code is vectorized for 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    // Positions are contiguous, hence we work on xyxy
+    float32x4_t min_xyxy_1 = vdupq_n_f32(std::numeric_limits<float>::max());
+    float32x4_t min_xyxy_2 = min_xyxy_1;
+    float32x4_t max_xyxy_1 = vdupq_n_f32(std::numeric_limits<float>::lowest());
+    float32x4_t max_xyxy_2 = max_xyxy_1;
+
+    for (ElementIndex p = startPointIndex; p < endPointIndex; p += 4)
+    {
+        float32x4_t const p0p1_pos_xy = vld1q_f32(reinterpret_cast<float const *>(positionBuffer + p));
+        float32x4_t const p2p3_pos_xy = vld1q_f32(reinterpret_cast<float const *>(positionBuffer + p + 2));
+
+        min_xyxy_1 = vminq_f32(min_xyxy_1, p0p1_pos_xy);
+        min_xyxy_2 = vminq_f32(min_xyxy_2, p2p3_pos_xy);
+        max_xyxy_1 = vmaxq_f32(max_xyxy_1, p0p1_pos_xy);
+        max_xyxy_2 = vmaxq_f32(max_xyxy_2, p2p3_pos_xy);
+    }
+
+    // Fold into xy
+    float32x4_t const min_xyxy = vminq_f32(min_xyxy_1, min_xyxy_2);
+    float32x4_t const max_xyxy = vmaxq_f32(max_xyxy_1, max_xyxy_2);
+
+    Geometry::AABB result;
+
+    vst1_f32(&(result.BottomLeft.x), vmin_f32(vget_low_f32(min_xyxy), vget_high_f32(min_xyxy)));
+    vst1_f32(&(result.TopRight.x), vmax_f32(vget_low_f32(max_xyxy), vget_high_f32(max_xyxy)));
+
+    return result;
+}
+#endif
+
+inline Geometry::AABB MakePointsAABB(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f const * restrict const positionBuffer) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    return MakePointsAABB_SSEVectorized(startPointIndex, endPointIndex, positionBuffer);
+#elif FS_IS_ARM_NEON()
+    return MakePointsAABB_NeonVectorized(startPointIndex, endPointIndex, positionBuffer);
+#else
+    return MakePointsAABB_Naive(startPointIndex, endPointIndex, positionBuffer);
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // MakeAABBWeightedUnion
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "BufferArena.h"
 #include "GameMath.h"
 #include "SysSpecifics.h"
 
@@ -22,6 +23,9 @@
  *
  * The buffer is mem-aligned so that if TElement is float,
  * then the buffer is aligned to the vectorization number of floats.
+ *
+ * The buffer's memory may optionally come from a BufferArena, which must
+ * then outlive the buffer.
  */
 template <typename TElement>
 class Buffer final
@@ -33,10 +37,60 @@ public:
         return sizeof(TElement) * element_count;
     }
 
+private:
+
+    /*
+     * Frees the elements, unless they belong to an arena.
+     */
+    struct ElementsDeleter
+    {
+        bool IsArenaOwned{ false };
+
+        void operator()(TElement * ptr) const
+        {
+            if (!IsArenaOwned)
+            {
+                free_aligned(reinterpret_cast<void *>(ptr));
+            }
+        }
+    };
+
+    using elements_ptr = std::unique_ptr<TElement[], ElementsDeleter>;
+
+    static elements_ptr AllocateElements(size_t size)
+    {
+        return elements_ptr(
+            make_unique_buffer_aligned_to_vectorization_word<TElement>(size).release(),
+            ElementsDeleter{ false });
+    }
+
+    static elements_ptr AllocateElements(
+        BufferArena & arena,
+        size_t size)
+    {
+        if (!arena.IsEnabled())
+        {
+            return AllocateElements(size);
+        }
+
+        return elements_ptr(
+            reinterpret_cast<TElement *>(arena.Allocate(CalculateByteSize(size))),
+            ElementsDeleter{ true });
+    }
+
 public:
 
     explicit Buffer(size_t size)
-        : mBuffer(make_unique_buffer_aligned_to_vectorization_word<TElement>(size))
+        : mBuffer(AllocateElements(size))
+        , mSize(size)
+        , mCurrentPopulatedSize(0)
+    {
+    }
+
+    Buffer(
+        BufferArena & arena,
+        size_t size)
+        : mBuffer(AllocateElements(arena, size))
         , mSize(size)
         , mCurrentPopulatedSize(0)
     {
@@ -57,6 +111,22 @@ public:
             fillValue);
     }
 
+    Buffer(
+        BufferArena & arena,
+        size_t size,
+        size_t fillStart,
+        TElement fillValue)
+        : Buffer(arena, size)
+    {
+        assert(fillStart <= mSize);
+
+        // Fill-in values
+        std::fill(
+            mBuffer.get() + fillStart,
+            mBuffer.get() + mSize,
+            fillValue);
+    }
+
     Buffer(
         size_t size,
         size_t fillStart,
@@ -78,6 +148,16 @@ public:
         fill(fillValue);
     }
 
+    Buffer(
+        BufferArena & arena,
+        size_t size,
+        TElement fillValue)
+        : Buffer(arena, size)
+    {
+        // Fill-in values
+        fill(fillValue);
+    }
+
     Buffer(Buffer && other) noexcept
         : mBuffer(std::move(other.mBuffer))
         , mSize(other.mSize)
@@ -103,6 +183,14 @@ public:
         return mCurrentPopulatedSize;
     }
 
+    /*
+     * Gets the number of bytes occupied by the buffer's elements.
+     */
+    size_t GetByteSize() const
+    {
+        return CalculateByteSize(mSize);
+    }
+
     /*
      * Gets the current number of bytes populated in the buffer via emplace_back();
      * less than or equal the declared buffer size.
@@ -130,6 +218,35 @@ public:
         }
     }
 
+    /*
+     * Adds the specified number of elements to the buffer, each one constructed with the same arguments.
+     * Assumed to be invoked only at initialization time.
+     *
+     * Cannot add more elements than the size specified at constructor time.
+     */
+    template <typename... Args>
+    void emplace_back_n(size_t count, Args&&... args)
+    {
+        TElement * restrict const ptr = receive(count);
+        for (size_t i = 0; i < count; ++i)
+            new(&(ptr[i])) TElement(args...);
+    }
+
+    /*
+     * Adds the specified number of elements to the buffer, each one constructed with what the
+     * function returns for the element's index in the range. Assumed to be invoked only at
+     * initialization time.
+     *
+     * Cannot add more elements than the size specified at constructor time.
+     */
+    template <typename TFunction>
+    void emplace_back_range(size_t count, TFunction && elementFunction)
+    {
+        TElement * restrict const ptr = receive(count);
+        for (size_t i = 0; i < count; ++i)
+            new(&(ptr[i])) TElement(elementFunction(i));
+    }
+
     /*
      * Appends undefined data for the specified amount of data, advances by that much,
      * and returns the pointer to the append position, which should be used right away.
@@ -245,7 +362,7 @@ public:
         return mBuffer.get();
     }
 
-    unique_aligned_buffer<TElement> mBuffer;
+    elements_ptr mBuffer;
     size_t mSize;
     size_t mCurrentPopulatedSize;
 };
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <type_traits>
 
 template <typename TElement, typename TIntegralTag>
 struct Buffer2D
@@ -148,7 +149,7 @@ public:
     {
         auto newData = std::make_unique<TElement[]>(mLinearSize);
 
-        std::memcpy(newData.get(), Data.get(), mLinearSize * sizeof(TElement));
+        CopyRun(newData.get(), Data.get(), mLinearSize);
 
         return Buffer2D(
             Size,
@@ -167,10 +168,10 @@ public:
             int const sourceLinearIndex = (targetY + regionRect.origin.y) * Size.width + regionRect.origin.x;
             int const targetLinearIndex = targetY * regionRect.size.width;
 
-            std::memcpy(
+            CopyRun(
                 newData.get() + targetLinearIndex,
                 Data.get() + sourceLinearIndex,
-                regionRect.size.width * sizeof(TElement));
+                regionRect.size.width);
         }
 
         return Buffer2D(
@@ -186,6 +187,46 @@ public:
             value);
     }
 
+    void FillRegion(
+        _IntegralRect<TIntegralTag> const & region,
+        TElement const value)
+    {
+        // The region is entirely within this buffer
+        assert(region.IsContainedInRect(_IntegralRect<TIntegralTag>(_IntegralCoordinates<TIntegralTag>(0, 0), Size)));
+
+        TElement * row = Data.get() + region.origin.y * Size.width + region.origin.x;
+        for (int y = 0; y < region.size.height; ++y, row += Size.width)
+        {
+            std::fill_n(row, region.size.width, value);
+        }
+    }
+
+    /*
+     * Compares a region of this buffer with a region of the same size of another buffer,
+     * with the same semantics as operator==.
+     */
+    bool IsRegionEqual(
+        _IntegralRect<TIntegralTag> const & region,
+        Buffer2D const & other,
+        _IntegralCoordinates<TIntegralTag> const & otherOrigin) const
+    {
+        // The regions are entirely within their buffers
+        assert(region.IsContainedInRect(_IntegralRect<TIntegralTag>(_IntegralCoordinates<TIntegralTag>(0, 0), Size)));
+        assert(_IntegralRect<TIntegralTag>(otherOrigin, region.size).IsContainedInRect(_IntegralRect<TIntegralTag>(_IntegralCoordinates<TIntegralTag>(0, 0), other.Size)));
+
+        TElement const * row = Data.get() + region.origin.y * Size.width + region.origin.x;
+        TElement const * otherRow = other.Data.get() + otherOrigin.y * other.Size.width + otherOrigin.x;
+        for (int y = 0; y < region.size.height; ++y, row += Size.width, otherRow += other.Size.width)
+        {
+            if (std::memcmp(row, otherRow, region.size.width * sizeof(TElement)) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /*
      * In-place shrinking.
      */
@@ -201,10 +242,21 @@ public:
                 int const sourceLinearIndex = (targetY + rect.origin.y) * Size.width + rect.origin.x;
                 int const targetLinearIndex = targetY * rect.size.width;
 
-                std::memmove(
-                    Data.get() + targetLinearIndex,
-                    Data.get() + sourceLinearIndex,
-                    rect.size.width * sizeof(TElement));
+                // Rows only ever move backwards, hence a forward copy is safe even when they overlap
+                if constexpr (std::is_trivially_copyable_v<TElement>)
+                {
+                    std::memmove(
+                        Data.get() + targetLinearIndex,
+                        Data.get() + sourceLinearIndex,
+                        rect.size.width * sizeof(TElement));
+                }
+                else
+                {
+                    std::move(
+                        Data.get() + sourceLinearIndex,
+                        Data.get() + sourceLinearIndex + rect.size.width,
+                        Data.get() + targetLinearIndex);
+                }
             }
 
             Size = rect.size;
@@ -218,17 +270,36 @@ public:
 
     void BlitFromRegion(
         Buffer2D const & source,
-        _IntegralRect<TIntegralTag> const & sourceRegion,
-        _IntegralCoordinates<TIntegralTag> const & targetPos)
+        _IntegralRect<TIntegralTag> const & sourceRegion, // Expected to be contained in source buffer
+        _IntegralCoordinates<TIntegralTag> const & targetPos) // Might be anywhere
     {
-        BlitFromRegion(
-            source,
-            sourceRegion,
-            targetPos,
-            [](TElement const & src, TElement const &) -> TElement
+        BlitExtent const extent = CalculateBlitExtent(source, sourceRegion, targetPos);
+
+        int sourceLinearIndex = extent.SourceLinearIndex;
+        int targetLinearIndex = extent.TargetLinearIndex;
+
+        for (int yc = 0; yc < extent.Height; ++yc)
+        {
+            // Whole rows at a time
+            if constexpr (std::is_trivially_copyable_v<TElement>)
+            {
+                // Source might be ourselves
+                std::memmove(
+                    Data.get() + targetLinearIndex,
+                    source.Data.get() + sourceLinearIndex,
+                    extent.Width * sizeof(TElement));
+            }
+            else
             {
-                return src;
-            });
+                std::copy_n(
+                    source.Data.get() + sourceLinearIndex,
+                    extent.Width,
+                    Data.get() + targetLinearIndex);
+            }
+
+            sourceLinearIndex += source.Size.width;
+            targetLinearIndex += Size.width;
+        }
     }
 
     template<typename TOperator>
@@ -238,33 +309,19 @@ public:
         _IntegralCoordinates<TIntegralTag> const & targetPos, // Might be anywhere
         TOperator const & elementOperator)
     {
-        // The source region is completely contained in the source buffer
-        assert(sourceRegion.IsContainedInRect({ {0, 0}, source.Size }));
-
-        int const srcXStart = sourceRegion.origin.x + std::max(-targetPos.x, 0);
-        int const tgtXStart = std::max(targetPos.x, 0);
-        int const copyW = std::max(
-            std::min(
-                (sourceRegion.origin.x + sourceRegion.size.width) - srcXStart,
-                Size.width - tgtXStart),
-            0);
+        BlitExtent const extent = CalculateBlitExtent(source, sourceRegion, targetPos);
 
-        int const srcYStart = sourceRegion.origin.y + std::max(-targetPos.y, 0);
-        int const tgtYStart = std::max(targetPos.y, 0);
-        int const copyH = std::max(
-            std::min(
-                (sourceRegion.origin.y + sourceRegion.size.height) - srcYStart,
-                Size.height - tgtYStart),
-            0);
+        int sourceLinearIndex = extent.SourceLinearIndex;
+        int targetLinearIndex = extent.TargetLinearIndex;
 
-        int sourceLinearIndex = srcYStart * source.Size.width + srcXStart;
-        int targetLinearIndex = tgtYStart * Size.width + tgtXStart;
-
-        for (int yc = 0; yc < copyH; ++yc)
+        for (int yc = 0; yc < extent.Height; ++yc)
         {
-            for (int xc = 0; xc < copyW; ++xc)
+            TElement const * const sourceRow = source.Data.get() + sourceLinearIndex;
+            TElement * const targetRow = Data.get() + targetLinearIndex;
+
+            for (int xc = 0; xc < extent.Width; ++xc)
             {
-                Data[targetLinearIndex + xc] = elementOperator(source.Data[sourceLinearIndex + xc], Data[targetLinearIndex + xc]);
+                targetRow[xc] = elementOperator(sourceRow[xc], targetRow[xc]);
             }
 
             sourceLinearIndex += source.Size.width;
@@ -279,29 +336,30 @@ public:
     {
         auto newData = std::make_unique<TElement[]>(newSize.width * newSize.height);
 
-        int const leftFillerWRange = originOffset.x;
-        int const rightFillerWRange = std::min(originOffset.x + Size.width, newSize.width);
-
-        int const leftFillerHRange = originOffset.y;
-        int const rightFillerHRange = std::min(originOffset.y + Size.height, newSize.height);
+        // Range of new columns and rows covered by original data
+        int const copyXStart = std::clamp(originOffset.x, 0, newSize.width);
+        int const copyXEnd = std::clamp(originOffset.x + Size.width, copyXStart, newSize.width);
+        int const copyYStart = std::clamp(originOffset.y, 0, newSize.height);
+        int const copyYEnd = std::clamp(originOffset.y + Size.height, copyYStart, newSize.height);
 
         for (int ny = 0; ny < newSize.height; ++ny)
         {
-            int const oldYOffset = (ny - leftFillerHRange) * Size.width;
-            int const newYOffset = ny * newSize.width;
+            TElement * const newRow = newData.get() + ny * newSize.width;
 
-            for (int nx = 0; nx < newSize.width; ++nx)
+            if (ny < copyYStart || ny >= copyYEnd)
             {
-                _IntegralCoordinates<TIntegralTag> const coords(nx, ny);
-                if (nx < leftFillerWRange || nx >= rightFillerWRange
-                    || ny < leftFillerHRange || ny >= rightFillerHRange)
-                {
-                    newData[newYOffset + nx] = fillerValue;
-                }
-                else
-                {
-                    newData[newYOffset + nx] = Data[oldYOffset + nx - leftFillerWRange];
-                }
+                std::fill_n(newRow, newSize.width, fillerValue);
+            }
+            else
+            {
+                std::fill_n(newRow, copyXStart, fillerValue);
+
+                CopyRun(
+                    newRow + copyXStart,
+                    Data.get() + (ny - originOffset.y) * Size.width + (copyXStart - originOffset.x),
+                    copyXEnd - copyXStart);
+
+                std::fill_n(newRow + copyXEnd, newSize.width - copyXEnd, fillerValue);
             }
         }
 
@@ -361,25 +419,90 @@ public:
 
 private:
 
+    /*
+     * Copies a run of contiguous, non-overlapping elements.
+     */
+    static void CopyRun(
+        TElement * const target,
+        TElement const * const source,
+        size_t count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            std::memcpy(target, source, count * sizeof(TElement));
+        }
+        else
+        {
+            std::copy_n(source, count, target);
+        }
+    }
+
+    struct BlitExtent
+    {
+        int SourceLinearIndex;
+        int TargetLinearIndex;
+        int Width;
+        int Height;
+    };
+
+    /*
+     * Clips a blit against this buffer.
+     */
+    BlitExtent CalculateBlitExtent(
+        Buffer2D const & source,
+        _IntegralRect<TIntegralTag> const & sourceRegion,
+        _IntegralCoordinates<TIntegralTag> const & targetPos) const
+    {
+        // The source region is completely contained in the source buffer
+        assert(sourceRegion.IsContainedInRect({ {0, 0}, source.Size }));
+
+        int const srcXStart = sourceRegion.origin.x + std::max(-targetPos.x, 0);
+        int const tgtXStart = std::max(targetPos.x, 0);
+        int const copyW = std::max(
+            std::min(
+                (sourceRegion.origin.x + sourceRegion.size.width) - srcXStart,
+                Size.width - tgtXStart),
+            0);
+
+        int const srcYStart = sourceRegion.origin.y + std::max(-targetPos.y, 0);
+        int const tgtYStart = std::max(targetPos.y, 0);
+        int const copyH = std::max(
+            std::min(
+                (sourceRegion.origin.y + sourceRegion.size.height) - srcYStart,
+                Size.height - tgtYStart),
+            0);
+
+        return BlitExtent{
+            srcYStart * source.Size.width + srcXStart,
+            tgtYStart * Size.width + tgtXStart,
+            copyW,
+            copyH };
+    }
+
     template<bool H, bool V>
     void Flip()
     {
-        int const xMax = (H && !V) ? Size.width / 2 : Size.width;
-        int const yMax = V ? Size.height / 2 : Size.height;
-
-        for (int y = 0; y < yMax; ++y)
+        if constexpr (H && V)
+        {
+            // Equivalent to reversing the whole buffer
+            std::reverse(Data.get(), Data.get() + mLinearSize);
+        }
+        else if constexpr (H)
         {
-            for (int x = 0; x < xMax; ++x)
+            for (int y = 0; y < Size.height; ++y)
             {
-                auto const srcCoords = coordinates_type(x, y);
-
-                auto dstCoords = srcCoords;
-                if constexpr (H)
-                    dstCoords = dstCoords.FlipX(Size.width);
-                if constexpr (V)
-                    dstCoords = dstCoords.FlipY(Size.height);
+                TElement * const row = Data.get() + y * Size.width;
+                std::reverse(row, row + Size.width);
+            }
+        }
+        else
+        {
+            static_assert(V);
 
-                std::swap(this->operator[](srcCoords), this->operator[](dstCoords));
+            for (int y = 0; y < Size.height / 2; ++y)
+            {
+                TElement * const row = Data.get() + y * Size.width;
+                std::swap_ranges(row, row + Size.width, Data.get() + (Size.height - 1 - y) * Size.width);
             }
         }
     }
@@ -391,13 +514,27 @@ private:
 
         auto newData = std::make_unique<TElement[]>(mLinearSize);
 
-        for (int srcY = 0; srcY < Size.height; ++srcY)
+        // Visit source in square blocks, so that both source rows and
+        // target rows of a block stay in cache
+        int constexpr BlockSize = 32;
+
+        for (int srcYStart = 0; srcYStart < Size.height; srcYStart += BlockSize)
         {
-            int const srcYOffset = srcY * Size.width;
-            for (int srcX = 0; srcX < Size.width; ++srcX)
+            int const srcYEnd = std::min(srcYStart + BlockSize, Size.height);
+
+            for (int srcXStart = 0; srcXStart < Size.width; srcXStart += BlockSize)
             {
-                auto const dstCoords = coordinates_type(srcX, srcY).template Rotate90<TDirection>(Size);
-                newData[dstCoords.y * newSize.width + dstCoords.x] = Data[srcYOffset + srcX];
+                int const srcXEnd = std::min(srcXStart + BlockSize, Size.width);
+
+                for (int srcY = srcYStart; srcY < srcYEnd; ++srcY)
+                {
+                    int const srcYOffset = srcY * Size.width;
+                    for (int srcX = srcXStart; srcX < srcXEnd; ++srcX)
+                    {
+                        auto const dstCoords = coordinates_type(srcX, srcY).template Rotate90<TDirection>(Size);
+                        newData[dstCoords.y * newSize.width + dstCoords.x] = Data[srcYOffset + srcX];
+                    }
+                }
             }
         }
 
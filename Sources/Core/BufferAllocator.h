@@ -7,66 +7,184 @@
 
 #include "Buffer.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
-#include <memory>
-#include <mutex>
-#include <vector>
+#include <utility>
 
+template <typename TElement>
+class BufferAllocator;
+
+/*
+ * Move-only handle to a buffer borrowed from a BufferAllocator; the buffer goes back
+ * to the allocator's pool when the handle is destroyed.
+ *
+ * The handle must not outlive its allocator.
+ */
+template <typename TElement>
+class PooledBuffer final
+{
+public:
+
+    PooledBuffer(PooledBuffer && other) noexcept
+        : mBuffer(other.mBuffer)
+        , mAllocator(other.mAllocator)
+    {
+        other.mBuffer = nullptr;
+    }
+
+    PooledBuffer & operator=(PooledBuffer && other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+
+            mBuffer = other.mBuffer;
+            mAllocator = other.mAllocator;
+            other.mBuffer = nullptr;
+        }
+
+        return *this;
+    }
+
+    PooledBuffer(PooledBuffer const &) = delete;
+    PooledBuffer & operator=(PooledBuffer const &) = delete;
+
+    ~PooledBuffer()
+    {
+        Reset();
+    }
+
+    Buffer<TElement> & operator*() const noexcept
+    {
+        assert(nullptr != mBuffer);
+        return *mBuffer;
+    }
+
+    Buffer<TElement> * operator->() const noexcept
+    {
+        assert(nullptr != mBuffer);
+        return mBuffer;
+    }
+
+private:
+
+    PooledBuffer(
+        Buffer<TElement> * buffer,
+        BufferAllocator<TElement> * allocator) noexcept
+        : mBuffer(buffer)
+        , mAllocator(allocator)
+    {
+    }
+
+    void Reset() noexcept
+    {
+        if (nullptr != mBuffer)
+        {
+            mAllocator->Release(mBuffer);
+            mBuffer = nullptr;
+        }
+    }
+
+    Buffer<TElement> * mBuffer;
+    BufferAllocator<TElement> * mAllocator;
+
+    friend class BufferAllocator<TElement>;
+};
+
+/*
+ * Pool of same-size buffers, allocated and released concurrently from multiple threads.
+ *
+ * Free buffers are kept in a fixed number of atomic slots, which are claimed and filled
+ * with single atomic operations; hence allocation and release never take a lock, and in
+ * the steady state never touch the heap. Buffers released while all slots are occupied
+ * are simply freed.
+ */
 template <typename TElement>
 class BufferAllocator
 {
 public:
 
-    BufferAllocator(size_t bufferSize)
+    explicit BufferAllocator(size_t bufferSize)
         : mBufferSize(bufferSize)
         , mPool()
-        , mLock()
     {
+        for (auto & slot : mPool)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
     }
 
     BufferAllocator(BufferAllocator && other) noexcept
         : mBufferSize(other.mBufferSize)
-        , mPool(std::move(other.mPool))
-        , mLock() // We make our own, new lock - assuming we're not moving synchronization state here
+        , mPool()
     {
+        // Assuming nobody is using the other allocator while we're moving it
+        for (size_t s = 0; s < PoolSlotCount; ++s)
+        {
+            mPool[s].store(
+                other.mPool[s].exchange(nullptr, std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
     }
 
-    std::shared_ptr<Buffer<TElement>> Allocate()
-    {
-        Buffer<TElement> * buffer;
+    BufferAllocator(BufferAllocator const &) = delete;
+    BufferAllocator & operator=(BufferAllocator const &) = delete;
+    BufferAllocator & operator=(BufferAllocator &&) = delete;
 
-        if (std::lock_guard lock{ mLock }; !mPool.empty())
+    ~BufferAllocator()
+    {
+        for (auto & slot : mPool)
         {
-            buffer = mPool.back().release();
-            mPool.pop_back();
+            delete slot.load(std::memory_order_acquire);
         }
-        else
+    }
+
+    PooledBuffer<TElement> Allocate()
+    {
+        for (auto & slot : mPool)
         {
-            buffer = new Buffer<TElement>(mBufferSize);
-        }
+            if (slot.load(std::memory_order_relaxed) != nullptr)
+            {
+                Buffer<TElement> * const buffer = slot.exchange(nullptr, std::memory_order_acquire);
+                if (nullptr != buffer)
+                {
+                    return PooledBuffer<TElement>(buffer, this);
+                }
 
-        assert(nullptr != buffer);
+                // Someone else got it first
+            }
+        }
 
-        return std::shared_ptr<Buffer<TElement>>(
-            buffer,
-            [this](auto p)
-            {
-                this->Release(p);
-            });
+        // Pool is empty
+        return PooledBuffer<TElement>(new Buffer<TElement>(mBufferSize), this);
     }
 
 private:
 
-    void Release(Buffer<TElement> * buffer)
+    void Release(Buffer<TElement> * buffer) noexcept
     {
-        std::lock_guard lock{ mLock };
+        assert(nullptr != buffer);
 
-        mPool.push_back(std::unique_ptr<Buffer<TElement>>(buffer));
+        for (auto & slot : mPool)
+        {
+            Buffer<TElement> * expected = nullptr;
+            if (slot.load(std::memory_order_relaxed) == nullptr
+                && slot.compare_exchange_strong(expected, buffer, std::memory_order_release, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+
+        // Pool is full
+        delete buffer;
     }
 
+    // Enough for the work buffers a simulation step keeps alive at the same time
+    static size_t constexpr PoolSlotCount = 32;
+
     size_t const mBufferSize;
-    std::vector<std::unique_ptr<Buffer<TElement>>> mPool;
+    std::array<std::atomic<Buffer<TElement> *>, PoolSlotCount> mPool;
 
-    // The mutex guarding concurrency-sensitive operations
-    std::mutex mLock;
-};
\ No newline at end of file
+    friend class PooledBuffer<TElement>;
+};
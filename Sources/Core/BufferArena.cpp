@@ -0,0 +1,141 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "BufferArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if FS_IS_OS_WINDOWS()
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+    // The size of huge pages on all the platforms we care about; chunks are
+    // multiples of it, so that they may be backed by huge pages
+    size_t constexpr HugePageByteSize = 2 * 1024 * 1024;
+
+    size_t RoundUp(size_t size, size_t multiple)
+    {
+        return (size + multiple - 1) / multiple * multiple;
+    }
+}
+
+BufferArena::BufferArena(bool isEnabled)
+    : mIsEnabled(isEnabled)
+    , mChunks()
+    , mAllocatedByteSize(0)
+{
+}
+
+BufferArena::BufferArena(BufferArena && other) noexcept
+    : mIsEnabled(other.mIsEnabled)
+    , mChunks(std::move(other.mChunks))
+    , mAllocatedByteSize(other.mAllocatedByteSize)
+{
+    other.mChunks.clear();
+    other.mAllocatedByteSize = 0;
+}
+
+BufferArena::~BufferArena()
+{
+    for (auto const & chunk : mChunks)
+    {
+        FreeChunk(chunk);
+    }
+}
+
+void * BufferArena::Allocate(size_t byteSize)
+{
+    assert(mIsEnabled);
+
+    // Pad to the cache line, so that the next allocation starts on a fresh one
+    size_t const paddedByteSize = RoundUp(std::max(byteSize, size_t(1)), CacheLineByteSize);
+
+    if (mChunks.empty() || mChunks.back().UsedSize + paddedByteSize > mChunks.back().Size)
+    {
+        // Make room; grow geometrically, so that containers with many buffers
+        // end up with few chunks
+        size_t const minChunkSize = mChunks.empty()
+            ? paddedByteSize
+            : std::max(paddedByteSize, mChunks.back().Size * 2);
+
+        mChunks.push_back(AllocateChunk(minChunkSize));
+    }
+
+    Chunk & chunk = mChunks.back();
+    std::byte * const ptr = chunk.Data + chunk.UsedSize;
+    chunk.UsedSize += paddedByteSize;
+
+    mAllocatedByteSize += paddedByteSize;
+
+    assert((reinterpret_cast<std::uintptr_t>(ptr) % CacheLineByteSize) == 0);
+    assert(is_aligned_to_vectorization_word(ptr));
+
+    return ptr;
+}
+
+BufferArena::Chunk BufferArena::AllocateChunk(size_t minSize)
+{
+    size_t const size = RoundUp(minSize, HugePageByteSize);
+
+    void * ptr = nullptr;
+
+#if FS_IS_OS_WINDOWS()
+
+    // Large pages require the "lock pages in memory" privilege, which
+    // most users do not have; fall back to regular pages when denied
+    size_t const largePageMinimum = ::GetLargePageMinimum();
+    if (largePageMinimum != 0 && (size % largePageMinimum) == 0)
+    {
+        ptr = ::VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+
+    if (ptr == nullptr)
+    {
+        ptr = ::VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+
+#else
+
+    if (posix_memalign(&ptr, HugePageByteSize, size) != 0)
+    {
+        ptr = nullptr;
+    }
+
+#if FS_IS_OS_LINUX()
+    if (ptr != nullptr)
+    {
+        // Only a hint, as transparent huge pages may be disabled
+        ::madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+#endif
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return Chunk{ reinterpret_cast<std::byte *>(ptr), size, 0 };
+}
+
+void BufferArena::FreeChunk(Chunk const & chunk)
+{
+#if FS_IS_OS_WINDOWS()
+    ::VirtualFree(chunk.Data, 0, MEM_RELEASE);
+#else
+    std::free(chunk.Data);
+#endif
+}
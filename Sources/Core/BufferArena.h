@@ -0,0 +1,86 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "SysSpecifics.h"
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Backing store for the buffers of an element container, so that all of its
+ * buffers live in few, contiguous chunks of memory rather than in as many
+ * scattered heap allocations.
+ *
+ * Chunks are huge-page-backed where the OS supports it. All allocations are
+ * aligned to - and padded to a multiple of - the cache line size, hence no two
+ * buffers share a cache line.
+ *
+ * Memory is only released when the arena is destroyed; the arena must hence
+ * outlive all the buffers allocated from it.
+ *
+ * When not enabled, the arena hands out nothing, and buffers fall back to their
+ * own heap allocations.
+ */
+class BufferArena final
+{
+public:
+
+    static size_t constexpr CacheLineByteSize = cache_line_byte_count<size_t>;
+
+public:
+
+    explicit BufferArena(bool isEnabled);
+
+    BufferArena(BufferArena && other) noexcept;
+
+    ~BufferArena();
+
+    BufferArena(BufferArena const &) = delete;
+    BufferArena & operator=(BufferArena const &) = delete;
+    BufferArena & operator=(BufferArena &&) = delete;
+
+    bool IsEnabled() const
+    {
+        return mIsEnabled;
+    }
+
+    /*
+     * Returns cache-line-aligned memory, valid for as long as the arena lives.
+     * May only be invoked when the arena is enabled.
+     */
+    void * Allocate(size_t byteSize);
+
+    /*
+     * Bytes allocated so far, including padding.
+     */
+    size_t GetAllocatedByteSize() const
+    {
+        return mAllocatedByteSize;
+    }
+
+    size_t GetChunkCount() const
+    {
+        return mChunks.size();
+    }
+
+private:
+
+    struct Chunk
+    {
+        std::byte * Data;
+        size_t Size;
+        size_t UsedSize;
+    };
+
+    static Chunk AllocateChunk(size_t minSize);
+
+    static void FreeChunk(Chunk const & chunk);
+
+    bool mIsEnabled;
+    std::vector<Chunk> mChunks;
+    size_t mAllocatedByteSize;
+};
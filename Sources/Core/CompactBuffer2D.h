@@ -0,0 +1,114 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Buffer2D.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+/*
+ * Immutable, compact copy of a Buffer2D, meant for keeping many snapshots (e.g. undo history).
+ *
+ * Buffers mostly consist of long runs of identical elements - empty space, homogeneous
+ * materials, flat texture areas - hence the copy is run-length encoded; buffers that
+ * wouldn't shrink that way (e.g. noisy textures) are kept verbatim instead.
+ */
+template <typename TElement, typename TIntegralTag>
+class CompactBuffer2D
+{
+public:
+
+    using buffer_type = Buffer2D<TElement, TIntegralTag>;
+
+public:
+
+    explicit CompactBuffer2D(buffer_type const & buffer)
+        : mSize(buffer.Size)
+        , mRuns()
+        , mVerbatim()
+    {
+        size_t const linearSize = buffer.GetLinearSize();
+        size_t const maxRunCount = buffer.GetByteSize() / sizeof(Run); // Beyond this we're not saving anything
+
+        for (size_t i = 0; i < linearSize; /* incremented in loop */)
+        {
+            if (mRuns.size() >= maxRunCount)
+            {
+                // Not worth it
+                mRuns.clear();
+                mRuns.shrink_to_fit();
+                mVerbatim.emplace(buffer.Clone());
+                return;
+            }
+
+            TElement const & value = buffer.Data[i];
+
+            size_t runEnd = i + 1;
+            while (runEnd < linearSize
+                && runEnd - i < std::numeric_limits<std::uint32_t>::max()
+                && buffer.Data[runEnd] == value)
+            {
+                ++runEnd;
+            }
+
+            mRuns.push_back({ value, static_cast<std::uint32_t>(runEnd - i) });
+
+            i = runEnd;
+        }
+
+        mRuns.shrink_to_fit();
+    }
+
+    typename buffer_type::size_type const & GetSize() const
+    {
+        return mSize;
+    }
+
+    size_t GetByteSize() const
+    {
+        return mVerbatim.has_value()
+            ? mVerbatim->GetByteSize()
+            : mRuns.size() * sizeof(Run);
+    }
+
+    buffer_type MakeBuffer() const
+    {
+        if (mVerbatim.has_value())
+        {
+            return mVerbatim->Clone();
+        }
+
+        buffer_type buffer(mSize);
+
+        size_t i = 0;
+        for (Run const & run : mRuns)
+        {
+            std::fill_n(&(buffer.Data[i]), run.Count, run.Value);
+            i += run.Count;
+        }
+
+        assert(i == buffer.GetLinearSize());
+
+        return buffer;
+    }
+
+private:
+
+    struct Run
+    {
+        TElement Value;
+        std::uint32_t Count;
+    };
+
+    typename buffer_type::size_type mSize;
+    std::vector<Run> mRuns;
+    std::optional<buffer_type> mVerbatim;
+};
@@ -6,7 +6,9 @@
 #pragma once
 
 #include "Endian.h"
+#include "Streams.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -24,6 +26,7 @@ public:
         , mAllocatedSize(capacity)
     {
         mBuffer = std::make_unique<unsigned char[]>(mAllocatedSize);
+        mReadBuffer = mBuffer.get();
     }
 
     size_t GetSize() const
@@ -33,7 +36,18 @@ public:
 
     unsigned char const * GetData() const
     {
-        return mBuffer.get();
+        return mReadBuffer;
+    }
+
+    /*
+     * Makes the buffer read from the specified external data - which must outlive the
+     * reads - in lieu of its own, until the next Reset(); spares copying data that is
+     * already in memory, such as data from a memory-mapped file.
+     */
+    void Borrow(unsigned char const * data, size_t size)
+    {
+        mReadBuffer = data;
+        mSize = size;
     }
 
     /*
@@ -43,7 +57,7 @@ public:
     template<typename TType>
     size_t ReserveAndAdvance()
     {
-        EnsureMayAppend(mSize + sizeof(TType));
+        EnsureMayAppend(sizeof(TType));
 
         // Advance
         size_t startIndex = mSize;
@@ -57,7 +71,7 @@ public:
      */
     size_t ReserveAndAdvance(size_t size)
     {
-        EnsureMayAppend(mSize + size);
+        EnsureMayAppend(size);
 
         // Advance
         size_t startIndex = mSize;
@@ -71,7 +85,7 @@ public:
      */
     unsigned char * Receive(size_t size)
     {
-        EnsureMayAppend(mSize + size);
+        EnsureMayAppend(size);
 
         // Advance
         size_t startIndex = mSize;
@@ -86,7 +100,8 @@ public:
     template<typename T>
     size_t WriteAt(T const & value, size_t index)
     {
-        assert(index + sizeof(T) < mAllocatedSize);
+        assert(!IsBorrowed());
+        assert(index + sizeof(T) <= mSize);
 
         return Endian<T, TEndianess>::Write(value, mBuffer.get() + index);
     }
@@ -100,7 +115,7 @@ public:
     {
         // Make sure it fits
         size_t const requiredSize = sizeof(T);
-        EnsureMayAppend(mSize + requiredSize);
+        EnsureMayAppend(requiredSize);
 
         // Append
         size_t const sz = Endian<T, TEndianess>::Write(value, mBuffer.get() + mSize);
@@ -121,7 +136,7 @@ public:
     {
         // Make sure it fits
         size_t const requiredSize = sizeof(std::uint32_t) + value.length();
-        EnsureMayAppend(mSize + requiredSize);
+        EnsureMayAppend(requiredSize);
 
         // Append len
         std::uint32_t const length = static_cast<std::uint32_t>(value.length());
@@ -144,7 +159,7 @@ public:
      */
     size_t Append(unsigned char const * data, size_t size)
     {
-        EnsureMayAppend(mSize + size);
+        EnsureMayAppend(size);
 
         // Append
         std::memcpy(mBuffer.get() + mSize, data, size);
@@ -162,9 +177,9 @@ public:
     template<typename T, typename std::enable_if_t<!std::is_same_v<T, var_uint16_t> && !std::is_same_v<T, std::string>, int> = 0>
     size_t ReadAt(size_t index, T & value) const
     {
-        assert(index + sizeof(T) <= mAllocatedSize);
+        assert(index + sizeof(T) <= GetReadableSize());
 
-        return Endian<T, TEndianess>::Read(mBuffer.get() + index, value);
+        return Endian<T, TEndianess>::Read(mReadBuffer + index, value);
     }
 
     /*
@@ -174,9 +189,9 @@ public:
     template<typename T, typename std::enable_if_t<std::is_same_v<T, var_uint16_t>, int> = 0>
     size_t ReadAt(size_t index, T & value) const
     {
-        assert(index + 1 <= mAllocatedSize);
+        assert(index + 1 <= GetReadableSize());
 
-        return Endian<var_uint16_t, TEndianess>::Read(mBuffer.get() + index, value);
+        return Endian<var_uint16_t, TEndianess>::Read(mReadBuffer + index, value);
     }
 
     /*
@@ -187,14 +202,14 @@ public:
     size_t ReadAt(size_t index, T & value) const
     {
         // Read length
-        assert(index + sizeof(std::uint32_t) <= mAllocatedSize);
+        assert(index + sizeof(std::uint32_t) <= GetReadableSize());
         std::uint32_t length;
-        size_t const sz1 = Endian<std::uint32_t, TEndianess>::Read(mBuffer.get() + index, length);
+        size_t const sz1 = Endian<std::uint32_t, TEndianess>::Read(mReadBuffer + index, length);
         assert(sz1 == sizeof(std::uint32_t));
 
         // Read bytes
-        assert(index + sizeof(std::uint32_t) + length <= mAllocatedSize);
-        value = std::string(reinterpret_cast<char const *>(mBuffer.get()) + index + sz1, length);
+        assert(index + sizeof(std::uint32_t) + length <= GetReadableSize());
+        value = std::string(reinterpret_cast<char const *>(mReadBuffer) + index + sz1, length);
 
         return sz1 + length;
     }
@@ -205,34 +220,50 @@ public:
      */
     size_t ReadAt(size_t index, unsigned char * ptr, size_t count) const
     {
-        assert(index + count <= mAllocatedSize);
+        assert(index + count <= GetReadableSize());
 
-        std::memcpy(ptr, mBuffer.get() + index, count);
+        std::memcpy(ptr, mReadBuffer + index, count);
 
         return count;
     }
 
     void Reset()
     {
+        mReadBuffer = mBuffer.get();
         mSize = 0;
     }
 
 private:
 
+    bool IsBorrowed() const
+    {
+        return mReadBuffer != mBuffer.get();
+    }
+
+    size_t GetReadableSize() const
+    {
+        return IsBorrowed() ? mSize : mAllocatedSize;
+    }
+
     void EnsureMayAppend(size_t additionalSize)
     {
+        assert(!IsBorrowed());
+
         size_t requiredAllocatedSize = mSize + additionalSize;
         if (requiredAllocatedSize > mAllocatedSize)
         {
-            if (requiredAllocatedSize < 128 * 1024
-                && requiredAllocatedSize < mAllocatedSize * 2)
-            {
-                requiredAllocatedSize = mAllocatedSize * 2;
-            }
+            // Grow geometrically, so that the cost of copying is amortized over the appends - doubling
+            // while small, and by half beyond, so as to waste less of large buffers
+            size_t const grownAllocatedSize = (mAllocatedSize < 1024 * 1024)
+                ? mAllocatedSize * 2
+                : mAllocatedSize + mAllocatedSize / 2;
+
+            requiredAllocatedSize = std::max(requiredAllocatedSize, grownAllocatedSize);
 
             unsigned char * newBuffer = new unsigned char[requiredAllocatedSize];
             std::memcpy(newBuffer, mBuffer.get(), mSize);
             mBuffer.reset(newBuffer);
+            mReadBuffer = mBuffer.get();
             mAllocatedSize = requiredAllocatedSize;
         }
     }
@@ -240,6 +271,31 @@ private:
 private:
 
     std::unique_ptr<unsigned char[]> mBuffer;
+    unsigned char const * mReadBuffer; // Either mBuffer or borrowed data
     size_t mSize; // Current pointer
     size_t mAllocatedSize;
-};
\ No newline at end of file
+};
+
+/*
+ * A write stream appending to a buffer, for producers of streams - such as image
+ * encoders - to write straight into a buffer being serialized, rather than into
+ * an intermediate stream to be then copied into the buffer.
+ */
+template<typename TEndianess>
+class DeSerializationBufferWriteStream final : public BinaryWriteStream
+{
+public:
+
+    explicit DeSerializationBufferWriteStream(DeSerializationBuffer<TEndianess> & buffer)
+        : mBuffer(buffer)
+    {}
+
+    void Write(std::uint8_t const * buffer, size_t size) override
+    {
+        mBuffer.Append(buffer, size);
+    }
+
+private:
+
+    DeSerializationBuffer<TEndianess> & mBuffer;
+};
@@ -0,0 +1,154 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/*
+ * Tracks the dirty portions of a buffer as a set of intervals of element indices,
+ * which may then be coalesced into a small number of uploads.
+ *
+ * Marking elements is cheapest when done in increasing order, as an element that
+ * falls within or right after the last interval just extends it.
+ */
+class DirtyIntervalSet final
+{
+public:
+
+    struct Interval
+    {
+        ElementIndex Start;
+        ElementIndex End; // Excluded
+
+        Interval(
+            ElementIndex start,
+            ElementIndex end)
+            : Start(start)
+            , End(end)
+        {}
+
+        ElementCount GetSize() const
+        {
+            return End - Start;
+        }
+
+        bool operator==(Interval const & other) const
+        {
+            return Start == other.Start && End == other.End;
+        }
+    };
+
+public:
+
+    /*
+     * Intervals that are not farther than mergeDistance elements from each other
+     * are merged when coalescing - trading the upload of some clean elements for
+     * fewer uploads; when then more than maxIntervals remain, they are all merged
+     * into one.
+     */
+    DirtyIntervalSet(
+        ElementCount mergeDistance,
+        size_t maxIntervals)
+        : mMergeDistance(mergeDistance)
+        , mMaxIntervals(maxIntervals)
+        , mIntervals()
+    {
+        assert(maxIntervals > 0);
+    }
+
+    void Add(ElementIndex index)
+    {
+        Add(index, index + 1);
+    }
+
+    void Add(
+        ElementIndex start,
+        ElementIndex end)
+    {
+        assert(start < end);
+
+        if (!mIntervals.empty())
+        {
+            Interval & last = mIntervals.back();
+            if (start >= last.Start && start <= last.End)
+            {
+                last.End = std::max(last.End, end);
+                return;
+            }
+        }
+
+        mIntervals.emplace_back(start, end);
+
+        // Keep memory bounded when marking out of order
+        if (mIntervals.size() > mMaxIntervals * 4)
+        {
+            Coalesce();
+        }
+    }
+
+    bool IsEmpty() const
+    {
+        return mIntervals.empty();
+    }
+
+    void Clear()
+    {
+        mIntervals.clear();
+    }
+
+    /*
+     * Returns the intervals sorted, disjoint, and merged as described above.
+     */
+    std::vector<Interval> const & Coalesce()
+    {
+        if (mIntervals.size() > 1)
+        {
+            std::sort(
+                mIntervals.begin(),
+                mIntervals.end(),
+                [](Interval const & lhs, Interval const & rhs)
+                {
+                    return lhs.Start < rhs.Start;
+                });
+
+            size_t last = 0;
+            for (size_t i = 1; i < mIntervals.size(); ++i)
+            {
+                if (mIntervals[i].Start <= mIntervals[last].End + mMergeDistance)
+                {
+                    mIntervals[last].End = std::max(mIntervals[last].End, mIntervals[i].End);
+                }
+                else
+                {
+                    mIntervals[++last] = mIntervals[i];
+                }
+            }
+
+            mIntervals.resize(last + 1, Interval(0, 0));
+
+            if (mIntervals.size() > mMaxIntervals)
+            {
+                Interval const hull(mIntervals.front().Start, mIntervals.back().End);
+                mIntervals.clear();
+                mIntervals.push_back(hull);
+            }
+        }
+
+        return mIntervals;
+    }
+
+private:
+
+    ElementCount const mMergeDistance;
+    size_t const mMaxIntervals;
+
+    std::vector<Interval> mIntervals;
+};
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "BufferArena.h"
 #include "ElementIndexRangeIterator.h"
 #include "GameTypes.h"
 #include "SysSpecifics.h"
@@ -59,11 +60,23 @@ public:
 protected:
 
     ElementContainer(ElementCount elementCount)
+        : ElementContainer(elementCount, false)
+    {
+    }
+
+    /*
+     * When doUseContiguousBuffers is set, buffers constructed with mBufferArena are
+     * allocated contiguously, in huge pages where supported.
+     */
+    ElementContainer(
+        ElementCount elementCount,
+        bool doUseContiguousBuffers)
         : mElementCount(elementCount)
         // We round our number of buffer elements to the next multiple of the vectorized float count, so that
         // buffers of single floats are aligned on vectorized word boundaries.
         // Note that buffers of more than single floats would also automatically be aligned.
         , mBufferElementCount(make_aligned_float_element_count(elementCount))
+        , mBufferArena(doUseContiguousBuffers)
     {
     }
 
@@ -74,4 +87,8 @@ protected:
     // differs from the element count as this is rounded up to the
     // vectorization word size
     ElementCount const mBufferElementCount;
+
+    // The backing store of the buffers of this container; declared here, so that
+    // it is constructed before - and destroyed after - the buffers of the derived container
+    BufferArena mBufferArena;
 };
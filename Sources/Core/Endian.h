@@ -11,14 +11,23 @@
 #include <cstdint>
 #include <limits>
 
+// The endianness of the host, known at compile time so that conversions fold
+// into plain loads and stores - or byte swaps - without checks at runtime
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+bool constexpr IsHostLittleEndian = true;
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+bool constexpr IsHostLittleEndian = false;
+#else
+#error "Unable to detect the endianness of the host"
+#endif
+
 class BigEndianess
 {
 public:
 
-    static bool ShouldSwap()
+    static constexpr bool ShouldSwap()
     {
-        static uint16_t const swapTest = 1;
-        return (*((char *)&swapTest) == 1);
+        return IsHostLittleEndian;
     }
 };
 
@@ -26,9 +35,9 @@ class LittleEndianess
 {
 public:
 
-    static bool ShouldSwap()
+    static constexpr bool ShouldSwap()
     {
-        return !BigEndianess::ShouldSwap();
+        return !IsHostLittleEndian;
     }
 };
 
@@ -67,7 +76,7 @@ public:
 
     static size_t Read(unsigned char const * ptr, std::uint16_t & value) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             value =(static_cast<std::uint16_t>(ptr[0]) << 8) | static_cast<std::uint16_t>(ptr[1]);
         }
@@ -81,7 +90,7 @@ public:
 
     static size_t Write(std::uint16_t const & value, unsigned char * ptr) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             unsigned char const * vPtr = reinterpret_cast<unsigned char const *>(&value);
             ptr[0] = vPtr[1];
@@ -103,7 +112,7 @@ public:
 
     static size_t Read(unsigned char const * ptr, std::uint32_t & value) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             value = (static_cast<std::uint32_t>(ptr[0]) << 24) | (static_cast<std::uint32_t>(ptr[1]) << 16)
                 | (static_cast<std::uint32_t>(ptr[2]) << 8) | static_cast<std::uint32_t>(ptr[3]);
@@ -118,7 +127,7 @@ public:
 
     static size_t Write(std::uint32_t const & value, unsigned char * ptr) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             unsigned char const * vPtr = reinterpret_cast<unsigned char const *>(&value);
             ptr[0] = vPtr[3];
@@ -162,7 +171,7 @@ public:
 
     static size_t Read(unsigned char const * ptr, std::uint64_t & value) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             value = (static_cast<std::uint64_t>(ptr[0]) << 56) | (static_cast<std::uint64_t>(ptr[1]) << 48)
                 | (static_cast<std::uint64_t>(ptr[2]) << 40) | (static_cast<std::uint64_t>(ptr[3]) << 32)
@@ -179,7 +188,7 @@ public:
 
     static size_t Write(std::uint64_t const & value, unsigned char * ptr) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             unsigned char const * vPtr = reinterpret_cast<unsigned char const *>(&value);
             ptr[0] = vPtr[7];
@@ -207,7 +216,7 @@ public:
 
     static size_t Read(unsigned char const * ptr, float & value) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             unsigned char buffer[4];
             buffer[0] = ptr[3];
@@ -226,7 +235,7 @@ public:
 
     static size_t Write(float const & value, unsigned char * ptr) noexcept
     {
-        if (TEndianess::ShouldSwap())
+        if constexpr (TEndianess::ShouldSwap())
         {
             unsigned char const * vPtr = reinterpret_cast<unsigned char const *>(&value);
             ptr[0] = vPtr[3];
@@ -0,0 +1,128 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*
+ * An IEEE 754 half-precision float, for storing cold attributes - i.e. attributes that are
+ * neither hot in vectorized loops nor in need of full precision - in half the memory.
+ *
+ * Values are converted at each use, with round-to-nearest-even; about three significant
+ * decimal digits survive the round-trip, with a range of +/-65504.
+ */
+class Float16 final
+{
+public:
+
+    constexpr Float16() noexcept
+        : mBits(0)
+    {}
+
+    explicit Float16(float value) noexcept
+        : mBits(FromFloat(value))
+    {}
+
+    float ToFloat() const noexcept
+    {
+        return ToFloat(mBits);
+    }
+
+    std::uint16_t GetBits() const noexcept
+    {
+        return mBits;
+    }
+
+    bool operator==(Float16 const & other) const noexcept
+    {
+        return mBits == other.mBits;
+    }
+
+    bool operator!=(Float16 const & other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    static inline std::uint32_t AsBits(float value) noexcept
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static inline float AsFloat(std::uint32_t bits) noexcept
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static inline std::uint16_t FromFloat(float value) noexcept
+    {
+        std::uint32_t constexpr Float32Infinity = 255u << 23;
+        std::uint32_t constexpr Float16Max = (127u + 16u) << 23; // Magnitudes from here on overflow
+        std::uint32_t constexpr Float16MinNormal = 113u << 23;
+        std::uint32_t constexpr DenormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        std::uint32_t f = AsBits(value);
+        std::uint32_t const sign = f & 0x80000000u;
+        f ^= sign;
+
+        std::uint32_t result;
+        if (f >= Float16Max)
+        {
+            // Infinity or NaN
+            result = (f > Float32Infinity) ? 0x7e00u : 0x7c00u;
+        }
+        else if (f < Float16MinNormal)
+        {
+            // Denormal or zero; let the FPU do the rounding, by aligning the mantissa via an addition
+            result = AsBits(AsFloat(f) + AsFloat(DenormalMagic)) - DenormalMagic;
+        }
+        else
+        {
+            // Normal; rebias the exponent, and round the mantissa to nearest-even
+            std::uint32_t const mantissaOdd = (f >> 13) & 1u;
+            f += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xfffu;
+            f += mantissaOdd;
+            result = f >> 13;
+        }
+
+        return static_cast<std::uint16_t>(result | (sign >> 16));
+    }
+
+    static inline float ToFloat(std::uint16_t bits) noexcept
+    {
+        std::uint32_t constexpr ShiftedExponent = 0x7c00u << 13;
+
+        std::uint32_t result = (bits & 0x7fffu) << 13;
+        std::uint32_t const exponent = ShiftedExponent & result;
+        result += (127u - 15u) << 23; // Exponent rebias
+
+        if (exponent == ShiftedExponent)
+        {
+            // Infinity or NaN
+            result += (128u - 16u) << 23;
+        }
+        else if (exponent == 0)
+        {
+            // Denormal or zero; renormalize via a subtraction
+            result += 1u << 23;
+            result = AsBits(AsFloat(result) - AsFloat(113u << 23));
+        }
+
+        return AsFloat(result | ((bits & 0x8000u) << 16));
+    }
+
+    std::uint16_t mBits;
+};
+
+static_assert(sizeof(Float16) == 2);
+static_assert(std::is_trivially_copyable_v<Float16>);
@@ -6,6 +6,7 @@
 #include "FontSet.h"
 
 #include "GameException.h"
+#include "Log.h"
 #include "TextureAtlas.h"
 #include "TextureDatabase.h"
 
@@ -88,6 +89,27 @@ template<typename TFontSet>
 FontSet<TFontSet> FontSet<TFontSet>::Load(
     IAssetManager const & assetManager,
     SimpleProgressCallback const & progressCallback)
+{
+    auto const bakedFontSetStream = assetManager.TryLoadBakedFontSet(TFontSet::FontSetName);
+    if (bakedFontSetStream)
+    {
+        auto fontSet = TryDeserialize(*bakedFontSetStream);
+        if (fontSet.has_value())
+        {
+            progressCallback(1.0f);
+            return std::move(*fontSet);
+        }
+
+        LogMessage("FontSet: baked font set \"", TFontSet::FontSetName, "\" is stale, loading fonts");
+    }
+
+    return LoadFromBffFonts(assetManager, progressCallback);
+}
+
+template<typename TFontSet>
+FontSet<TFontSet> FontSet<TFontSet>::LoadFromBffFonts(
+    IAssetManager const & assetManager,
+    SimpleProgressCallback const & progressCallback)
 {
     //
     // Get list of available fonts
@@ -99,8 +121,6 @@ FontSet<TFontSet> FontSet<TFontSet>::Load(
     // Load fonts, in enum order
     //
 
-    size_t constexpr FontCount = static_cast<size_t>(TFontSet::FontKindType::_Last) + 1;
-
     std::vector<BffFont> bffFonts;
 
     for (size_t fontKind = 0; fontKind < FontCount; ++fontKind)
@@ -137,6 +157,119 @@ FontSet<TFontSet> FontSet<TFontSet>::Load(
     return InternalLoad(std::move(bffFonts));
 }
 
+template<typename TFontSet>
+void FontSet<TFontSet>::Serialize(BinaryWriteStream & outputStream) const
+{
+    static_assert(sizeof(vec2f) == 2 * sizeof(float));
+
+    auto const writeUint32 = [&outputStream](std::uint32_t value)
+        {
+            outputStream.Write(reinterpret_cast<std::uint8_t const *>(&value), sizeof(value));
+        };
+
+    assert(Metadata.size() == FontCount);
+
+    // Header
+    writeUint32(BakedMagic);
+    writeUint32(BakedVersion);
+    writeUint32(static_cast<std::uint32_t>(Metadata.size()));
+    writeUint32(static_cast<std::uint32_t>(Atlas.Size.width));
+    writeUint32(static_cast<std::uint32_t>(Atlas.Size.height));
+
+    // Metadata
+    for (auto const & fontMetadata : Metadata)
+    {
+        writeUint32(static_cast<std::uint32_t>(fontMetadata.CellSize.width));
+        writeUint32(static_cast<std::uint32_t>(fontMetadata.CellSize.height));
+        outputStream.Write(fontMetadata.GlyphWidths.data(), 256 * sizeof(std::uint8_t));
+        outputStream.Write(reinterpret_cast<std::uint8_t const *>(fontMetadata.GlyphTextureAtlasBottomLefts.data()), 256 * sizeof(vec2f));
+        outputStream.Write(reinterpret_cast<std::uint8_t const *>(fontMetadata.GlyphTextureAtlasTopRights.data()), 256 * sizeof(vec2f));
+    }
+
+    // Atlas
+    outputStream.Write(reinterpret_cast<std::uint8_t const *>(Atlas.Data.get()), Atlas.GetByteSize());
+}
+
+template<typename TFontSet>
+std::optional<FontSet<TFontSet>> FontSet<TFontSet>::TryDeserialize(BinaryReadStream & inputStream)
+{
+    //
+    // Header and metadata, in one go - we know how many fonts to expect
+    //
+
+    size_t constexpr PreambleSize = BakedHeaderSize + FontCount * BakedFontMetadataSize;
+    std::array<std::uint8_t, PreambleSize> preamble;
+    if (inputStream.Read(preamble.data(), PreambleSize) != PreambleSize)
+    {
+        return std::nullopt;
+    }
+
+    std::uint8_t const * ptr = preamble.data();
+
+    auto const readUint32 = [&ptr]() -> std::uint32_t
+        {
+            std::uint32_t value;
+            std::memcpy(&value, ptr, sizeof(value));
+            ptr += sizeof(value);
+            return value;
+        };
+
+    auto const readGlyphCoordinates = [&ptr]() -> std::array<vec2f, 256>
+        {
+            std::array<vec2f, 256> value;
+            std::memcpy(value.data(), ptr, 256 * sizeof(vec2f));
+            ptr += 256 * sizeof(vec2f);
+            return value;
+        };
+
+    if (readUint32() != BakedMagic
+        || readUint32() != BakedVersion
+        || readUint32() != FontCount)
+    {
+        return std::nullopt;
+    }
+
+    int const atlasWidth = static_cast<int>(readUint32());
+    int const atlasHeight = static_cast<int>(readUint32());
+
+    std::vector<FontMetadata> fontMetadata;
+    fontMetadata.reserve(FontCount);
+    for (size_t f = 0; f < FontCount; ++f)
+    {
+        int const cellWidth = static_cast<int>(readUint32());
+        int const cellHeight = static_cast<int>(readUint32());
+
+        std::array<std::uint8_t, 256> glyphWidths;
+        std::memcpy(glyphWidths.data(), ptr, 256 * sizeof(std::uint8_t));
+        ptr += 256 * sizeof(std::uint8_t);
+
+        auto const glyphTextureBottomLefts = readGlyphCoordinates();
+        auto const glyphTextureTopRights = readGlyphCoordinates();
+
+        fontMetadata.emplace_back(
+            ImageSize(cellWidth, cellHeight),
+            glyphWidths,
+            glyphTextureBottomLefts,
+            glyphTextureTopRights);
+    }
+
+    assert(ptr == preamble.data() + PreambleSize);
+
+    //
+    // Atlas, straight into its image
+    //
+
+    RgbaImageData atlas(ImageSize(atlasWidth, atlasHeight));
+    if (inputStream.Read(reinterpret_cast<std::uint8_t *>(atlas.Data.get()), atlas.GetByteSize()) != atlas.GetByteSize())
+    {
+        return std::nullopt;
+    }
+
+    return FontSet<TFontSet>(
+        std::move(fontMetadata),
+        std::move(atlas));
+}
+
 enum class DummyFontTextureGroups : uint16_t
 {
     Font = 0,
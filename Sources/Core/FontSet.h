@@ -8,11 +8,13 @@
 #include "IAssetManager.h"
 #include "ImageData.h"
 #include "ProgressCallback.h"
+#include "Streams.h"
 #include "Vectors.h"
 
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -86,6 +88,9 @@ struct FontMetadata final
 
 /*
  * Provides loading services for a set of fonts.
+ *
+ * A font set may be baked - by ShipTools - into a single blob with the atlas and
+ * the metadata ready to use, which is then preferred over the individual fonts.
  */
 template<typename TFontSet>
 struct FontSet final
@@ -93,10 +98,28 @@ struct FontSet final
     std::vector<FontMetadata> Metadata;
     RgbaImageData Atlas;
 
+    /*
+     * Loads the baked font set if there is one, and the individual fonts otherwise.
+     */
     static FontSet<TFontSet> Load(
         IAssetManager const & assetManager,
         SimpleProgressCallback const & progressCallback);
 
+    /*
+     * Loads the individual fonts, building the atlas.
+     */
+    static FontSet<TFontSet> LoadFromBffFonts(
+        IAssetManager const & assetManager,
+        SimpleProgressCallback const & progressCallback);
+
+    void Serialize(BinaryWriteStream & outputStream) const;
+
+    /*
+     * Returns none when the blob is not a baked font set of the current version
+     * and with the current fonts.
+     */
+    static std::optional<FontSet<TFontSet>> TryDeserialize(BinaryReadStream & inputStream);
+
     FontSet(
         std::vector<FontMetadata> && metadata,
         RgbaImageData && atlas)
@@ -108,6 +131,17 @@ private:
 
     static FontSet<TFontSet> InternalLoad(std::vector<BffFont> && bffFonts);
 
+    static constexpr size_t FontCount = static_cast<size_t>(TFontSet::FontKindType::_Last) + 1;
+
+    static constexpr std::uint32_t BakedMagic = 0x46534231; // "FSB1"
+    static constexpr std::uint32_t BakedVersion = 1;
+
+    // Magic, version, font count, atlas width, atlas height
+    static constexpr size_t BakedHeaderSize = 5 * sizeof(std::uint32_t);
+
+    // Cell size, glyph widths, glyph bottom-lefts, glyph top-rights
+    static constexpr size_t BakedFontMetadataSize = 2 * sizeof(std::uint32_t) + 256 * sizeof(std::uint8_t) + 2 * 256 * sizeof(vec2f);
+
     friend class FontSetTests_Load_Test;
 };
 
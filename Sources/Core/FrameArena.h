@@ -0,0 +1,180 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+ * Bump allocator for data that only lives for one simulation step.
+ *
+ * Allocating is a pointer increment, deallocating is a no-op, and all memory is
+ * freed in bulk by Reset(). When a step needs more than the arena holds, a new
+ * chunk is added; at the next reset the chunks are coalesced into a single, larger
+ * one, so that in the steady state the arena never touches the heap.
+ *
+ * Not thread-safe: only meant to be used by the thread driving the simulation step.
+ */
+class FrameArena final
+{
+public:
+
+    explicit FrameArena(size_t initialCapacity = 64 * 1024)
+        : mChunks()
+        , mCurrent(nullptr)
+        , mEnd(nullptr)
+        , mAllocatedByteCount(0)
+    {
+        AddChunk(initialCapacity);
+    }
+
+    FrameArena(FrameArena const &) = delete;
+    FrameArena & operator=(FrameArena const &) = delete;
+
+    void * Allocate(
+        size_t byteSize,
+        size_t alignment)
+    {
+        assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+        std::byte * ptr = Align(mCurrent, alignment);
+        if (ptr + byteSize > mEnd)
+        {
+            // Make room
+            AddChunk(std::max(mChunks.back().Size * 2, byteSize + alignment));
+            ptr = Align(mCurrent, alignment);
+        }
+
+        mCurrent = ptr + byteSize;
+        mAllocatedByteCount += byteSize;
+
+        return ptr;
+    }
+
+    /*
+     * Invalidates all memory allocated since the previous reset.
+     */
+    void Reset()
+    {
+        if (mChunks.size() > 1)
+        {
+            // Coalesce
+            size_t totalCapacity = 0;
+            for (auto const & chunk : mChunks)
+            {
+                totalCapacity += chunk.Size;
+            }
+
+            mChunks.clear();
+            AddChunk(totalCapacity);
+        }
+        else
+        {
+            mCurrent = mChunks.back().Data.get();
+        }
+
+        mAllocatedByteCount = 0;
+    }
+
+    /*
+     * Bytes allocated since the previous reset.
+     */
+    size_t GetAllocatedByteCount() const
+    {
+        return mAllocatedByteCount;
+    }
+
+    size_t GetChunkCount() const
+    {
+        return mChunks.size();
+    }
+
+private:
+
+    static std::byte * Align(
+        std::byte * ptr,
+        size_t alignment)
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>(ptr);
+        return ptr + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+    }
+
+    void AddChunk(size_t size)
+    {
+        mChunks.push_back({ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+        mCurrent = mChunks.back().Data.get();
+        mEnd = mCurrent + size;
+    }
+
+    struct Chunk
+    {
+        std::unique_ptr<std::byte[]> Data;
+        size_t Size;
+    };
+
+    std::vector<Chunk> mChunks;
+    std::byte * mCurrent;
+    std::byte * mEnd;
+
+    size_t mAllocatedByteCount;
+};
+
+/*
+ * Standard allocator on top of a FrameArena, for standard containers that only live
+ * for one simulation step.
+ */
+template<typename TElement>
+class FrameArenaAllocator
+{
+public:
+
+    using value_type = TElement;
+
+    explicit FrameArenaAllocator(FrameArena & arena) noexcept
+        : mArena(&arena)
+    {}
+
+    template<typename TOtherElement>
+    FrameArenaAllocator(FrameArenaAllocator<TOtherElement> const & other) noexcept
+        : mArena(other.mArena)
+    {}
+
+    TElement * allocate(size_t n)
+    {
+        return static_cast<TElement *>(mArena->Allocate(n * sizeof(TElement), alignof(TElement)));
+    }
+
+    void deallocate(TElement *, size_t) noexcept
+    {
+        // Freed in bulk at arena reset
+    }
+
+    template<typename TOtherElement>
+    bool operator==(FrameArenaAllocator<TOtherElement> const & other) const noexcept
+    {
+        return mArena == other.mArena;
+    }
+
+    template<typename TOtherElement>
+    bool operator!=(FrameArenaAllocator<TOtherElement> const & other) const noexcept
+    {
+        return mArena != other.mArena;
+    }
+
+private:
+
+    FrameArena * mArena;
+
+    template<typename TOtherElement>
+    friend class FrameArenaAllocator;
+};
+
+template<typename TElement>
+using frame_vector = std::vector<TElement, FrameArenaAllocator<TElement>>;
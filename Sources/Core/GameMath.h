@@ -363,6 +363,27 @@ inline bool AreAlmostEqual(float value1, float value2, float epsilon)
     return (d > -epsilon) && (d < epsilon);
 }
 
+/*
+ * Returns the Morton (Z-order) code of the specified coordinates, i.e. their bits
+ * interleaved - x's in the even bits, y's in the odd bits; sorting by this code
+ * visits a grid by ever-larger squares, keeping neighbors close to each other.
+ */
+inline std::uint32_t MortonCode(
+    std::uint16_t x,
+    std::uint16_t y) noexcept
+{
+    auto const spread = [](std::uint32_t v) -> std::uint32_t
+    {
+        v = (v | (v << 8)) & 0x00ff00ffu;
+        v = (v | (v << 4)) & 0x0f0f0f0fu;
+        v = (v | (v << 2)) & 0x33333333u;
+        v = (v | (v << 1)) & 0x55555555u;
+        return v;
+    };
+
+    return spread(x) | (spread(y) << 1);
+}
+
 ////////////////////////////////////////////////
 // Trigonometric
 ////////////////////////////////////////////////
@@ -6,9 +6,13 @@
 #pragma once
 
 #include "GameMath.h"
+#include "RandomStream.h"
 #include "Vectors.h"
 
+#include <cstdint>
 #include <random>
+#include <sstream>
+#include <string>
 
 /*
  * The random engine for the entire game.
@@ -16,19 +20,114 @@
  * Not so random - always uses the same seed. On purpose! We want two instances
  * of the game to be identical to each other.
  *
- * Singleton.
+ * Singleton - though a thread may bind its own instance, so that multiple simulations
+ * may run side-by-side in the same process, each drawing from its own sequence.
  */
 class GameRandomEngine
 {
 public:
 
+    static std::uint32_t constexpr DefaultSeed = 19730528;
+
+    /*
+     * Returns the instance bound to the calling thread, if any, or else the process-wide one.
+     */
     static GameRandomEngine & GetInstance()
     {
+        if (ThisThreadInstance != nullptr)
+        {
+            return *ThisThreadInstance;
+        }
+
         static GameRandomEngine * instance = new GameRandomEngine();
 
         return *instance;
     }
 
+    static GameRandomEngine * GetThisThreadInstance()
+    {
+        return ThisThreadInstance;
+    }
+
+    /*
+     * Binds an instance - or none, when null - to the calling thread, for the lifetime of the binding.
+     */
+    class ThreadBinding final
+    {
+    public:
+
+        explicit ThreadBinding(GameRandomEngine * instance)
+            : mPreviousInstance(ThisThreadInstance)
+        {
+            ThisThreadInstance = instance;
+        }
+
+        ~ThreadBinding()
+        {
+            ThisThreadInstance = mPreviousInstance;
+        }
+
+        ThreadBinding(ThreadBinding const &) = delete;
+        ThreadBinding & operator=(ThreadBinding const &) = delete;
+
+    private:
+
+        GameRandomEngine * const mPreviousInstance;
+    };
+
+    GameRandomEngine()
+        : mSeed(DefaultSeed)
+        , mRandomEngine(DefaultSeed, 0)
+        , mNormalDistribution(0.0f, 1.0f)
+    {
+    }
+
+    /*
+     * Restarts the sequence from the specified seed; mostly useful for making
+     * runs reproducible regardless of what ran before, e.g. in benchmarks.
+     */
+    void Reseed(std::uint32_t seed)
+    {
+        mSeed = seed;
+        mRandomEngine = RandomStream(seed, 0);
+        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
+    }
+
+    /*
+     * Makes a new, independent stream from the current seed.
+     *
+     * This engine may only be used by one thread at a time; parallel tasks that need
+     * randomness use instead their own streams, whose indices are derived from e.g.
+     * the simulation step and the task index, so that what they draw does not depend
+     * on thread scheduling. A stream index always yields the same sequence, hence it
+     * is not to be reused across steps.
+     */
+    RandomStream MakeStream(std::uint64_t streamIndex) const
+    {
+        // Stream zero is ours
+        return RandomStream(mSeed, streamIndex + 1);
+    }
+
+    /*
+     * Gets the full state of the sequence, so that it may later be resumed from
+     * exactly this point via SetState(); used by simulation snapshots.
+     */
+    std::string GetState() const
+    {
+        std::ostringstream ss;
+        ss << mSeed << ' ' << mRandomEngine.GetCounter() << ' ' << mNormalDistribution;
+        return ss.str();
+    }
+
+    void SetState(std::string const & state)
+    {
+        std::istringstream ss(state);
+        std::uint64_t counter = 0;
+        ss >> mSeed >> counter >> mNormalDistribution;
+        mRandomEngine = RandomStream(mSeed, 0);
+        mRandomEngine.SetCounter(counter);
+    }
+
     /*
      * Returns a value between 0 and count - 1, included.
      */
@@ -95,7 +194,17 @@ public:
 
     inline float GenerateNormalizedUniformReal()
     {
-        return mRandomUniformDistribution(mRandomEngine);
+        return mRandomEngine.GenerateNormalizedUniformReal();
+    }
+
+    /*
+     * Equivalent to, but faster than, invoking GenerateNormalizedUniformReal() count times.
+     */
+    void FillNormalizedUniformReals(
+        float * values,
+        size_t count)
+    {
+        mRandomEngine.FillNormalizedUniformReals(values, count);
     }
 
     inline float GenerateUniformReal(
@@ -158,15 +267,9 @@ public:
 
 private:
 
-    GameRandomEngine()
-    {
-        std::seed_seq seed_seq({ 1, 242, 19730528 });
-        mRandomEngine = std::ranlux48_base(seed_seq);
-        mRandomUniformDistribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
-        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
-    }
+    static inline thread_local GameRandomEngine * ThisThreadInstance = nullptr;
 
-    std::ranlux48_base mRandomEngine;
-    std::uniform_real_distribution<float> mRandomUniformDistribution;
+    std::uint32_t mSeed;
+    RandomStream mRandomEngine;
     std::normal_distribution<float> mNormalDistribution;
 };
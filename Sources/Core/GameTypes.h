@@ -1222,7 +1222,26 @@ enum class SpringRelaxationParallelComputationModeType
 {
     StepByStep,
     FullSpeed,
-    Hybrid
+    Hybrid,
+    Chebyshev, // StepByStep, with Chebyshev-accelerated spring relaxation
+    Automatic // Chosen per ship, among the above but Chebyshev
+};
+
+/*
+ * The spring relaxation computation a ship is currently running with.
+ */
+struct ShipSpringRelaxationState
+{
+    ShipId Ship;
+    SpringRelaxationParallelComputationModeType Mode;
+    size_t Parallelism;
+    bool IsEvaluating; // When automatic, whether the choice is still being evaluated
+};
+
+enum class ShipLayoutOrderType
+{
+    Rows,   // Perfect squares by rows
+    Morton  // Perfect squares - and leftovers - along a Z-order curve
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
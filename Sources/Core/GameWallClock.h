@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include <cassert>
 #include <chrono>
 #include <optional>
 
@@ -13,7 +14,8 @@
  *
  * Note: it's not really a wall clock - its values do not measure time.
  *
- * Singleton.
+ * Singleton - though a thread may bind its own instance, so that multiple simulations
+ * may run side-by-side in the same process, each on its own clock.
  */
 class GameWallClock
 {
@@ -25,13 +27,59 @@ public:
 
 public:
 
+    /*
+     * Returns the instance bound to the calling thread, if any, or else the process-wide one.
+     */
     static inline GameWallClock & GetInstance()
     {
+        if (ThisThreadInstance != nullptr)
+        {
+            return *ThisThreadInstance;
+        }
+
         static GameWallClock * instance = new GameWallClock();
 
         return *instance;
     }
 
+    static GameWallClock * GetThisThreadInstance()
+    {
+        return ThisThreadInstance;
+    }
+
+    /*
+     * Binds an instance - or none, when null - to the calling thread, for the lifetime of the binding.
+     */
+    class ThreadBinding final
+    {
+    public:
+
+        explicit ThreadBinding(GameWallClock * instance)
+            : mPreviousInstance(ThisThreadInstance)
+        {
+            ThisThreadInstance = instance;
+        }
+
+        ~ThreadBinding()
+        {
+            ThisThreadInstance = mPreviousInstance;
+        }
+
+        ThreadBinding(ThreadBinding const &) = delete;
+        ThreadBinding & operator=(ThreadBinding const &) = delete;
+
+    private:
+
+        GameWallClock * const mPreviousInstance;
+    };
+
+    GameWallClock()
+        : mClockStartTime(std::chrono::steady_clock::now())
+        , mLastPauseTime(std::chrono::steady_clock::now())
+        , mLastResumeTime(mLastPauseTime)
+    {
+    }
+
     /*
      * Returns the current time as a fractional number of seconds since an arbitrary
      * reference moment. It is not subject to the game pausing.
@@ -157,16 +205,23 @@ public:
         }
     }
 
-private:
-
-    GameWallClock()
-        : mClockStartTime(std::chrono::steady_clock::now())
-        , mLastPauseTime(std::chrono::steady_clock::now())
-        , mLastResumeTime(mLastPauseTime)
+    /*
+     * Moves the paused clock forward by the specified interval.
+     *
+     * Used by headless runs that step the simulation faster than real time, so that
+     * the clock keeps in lockstep with the simulation.
+     */
+    void AdvancePaused(duration interval)
     {
+        assert(!mLastResumeTime.has_value());
 
+        mLastPauseTime += interval;
     }
 
+private:
+
+    static inline thread_local GameWallClock * ThisThreadInstance = nullptr;
+
     time_point const mClockStartTime;
     time_point mLastPauseTime;
     std::optional<time_point> mLastResumeTime;
@@ -43,6 +43,7 @@ public:
 	virtual ImageSize GetTextureDatabaseFrameSize(std::string const & databaseName, std::string const & frameRelativePath) const = 0;
 	virtual RgbaImageData LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const = 0;
 	virtual std::vector<AssetDescriptor> EnumerateTextureDatabaseFrames(std::string const & databaseName) const = 0;
+	virtual std::uint64_t GetTextureDatabaseFrameStamp(std::string const & databaseName, std::string const & frameRelativePath) const = 0; // Changes whenever the frame does
 
 	// Material textures
 	virtual std::string GetMaterialTextureRelativePath(std::string const & materialTextureName) const = 0;
@@ -59,6 +60,7 @@ public:
 	// Fonts
 	virtual std::vector<AssetDescriptor> EnumerateFonts(std::string const & fontSetName) const = 0;
 	virtual std::unique_ptr<BinaryReadStream> LoadFont(std::string const & fontSetName, std::string const & fontRelativePath) const = 0;
+	virtual std::unique_ptr<BinaryReadStream> TryLoadBakedFontSet(std::string const & fontSetName) const = 0; // nullptr when not baked
 
 	// Misc databases
 	virtual picojson::value LoadStructuralMaterialDatabase() const = 0;
@@ -9,6 +9,158 @@
 
 Logger Logger::Instance;
 
+Logger::Logger()
+	: mCurrentListener()
+	, mStoredMessages()
+    , mMutex()
+    , mWorkerThread()
+    , mQueueMutex()
+    , mQueueSignal()
+    , mPublishedSignal()
+    , mPendingMessages()
+    , mEnqueuedMessageCount(0)
+    , mPublishedMessageCount(0)
+    , mIsStopRequested(false)
+{
+}
+
+Logger::~Logger()
+{
+    {
+        std::scoped_lock lock(mQueueMutex);
+
+        mIsStopRequested = true;
+    }
+
+    mQueueSignal.notify_one();
+
+    if (mWorkerThread.joinable())
+    {
+        mWorkerThread.join();
+    }
+}
+
+void Logger::Flush()
+{
+    std::unique_lock lock(mQueueMutex);
+
+    if (!mWorkerThread.joinable()
+        || std::this_thread::get_id() == mWorkerThread.get_id()) // Listener
+    {
+        return;
+    }
+
+    std::uint64_t const targetMessageCount = mEnqueuedMessageCount;
+
+    mPublishedSignal.wait(
+        lock,
+        [this, targetMessageCount]
+        {
+            return mPublishedMessageCount >= targetMessageCount;
+        });
+}
+
+void Logger::Enqueue(PendingMessage && message)
+{
+    {
+        std::scoped_lock lock(mQueueMutex);
+
+        if (!mWorkerThread.joinable() && !mIsStopRequested)
+        {
+            // Start at first message
+            mWorkerThread = std::thread(&Logger::WorkerThreadLoop, this);
+        }
+
+        mPendingMessages.emplace_back(std::move(message));
+        ++mEnqueuedMessageCount;
+    }
+
+    mQueueSignal.notify_one();
+}
+
+void Logger::WorkerThreadLoop()
+{
+    std::vector<PendingMessage> messages;
+
+    while (true)
+    {
+        bool isStopRequested;
+
+        {
+            std::unique_lock lock(mQueueMutex);
+
+            mQueueSignal.wait(
+                lock,
+                [this]
+                {
+                    return !mPendingMessages.empty() || mIsStopRequested;
+                });
+
+            std::swap(messages, mPendingMessages);
+            isStopRequested = mIsStopRequested;
+        }
+
+        // Format and publish without holding the queue lock
+        for (auto const & message : messages)
+        {
+            std::time_t const time = std::chrono::system_clock::to_time_t(message.Timestamp);
+            auto const usecs = std::chrono::duration_cast<std::chrono::microseconds>(message.Timestamp.time_since_epoch() % std::chrono::seconds(1)).count();
+
+            std::stringstream ss;
+
+            ss
+                << std::put_time(std::localtime(&time), "%T") << "."
+                << std::setfill('0') << std::setw(6) << usecs << ":";
+
+            message.Formatter(ss);
+
+            Publish(ss.str());
+        }
+
+        {
+            std::scoped_lock lock(mQueueMutex);
+
+            mPublishedMessageCount += messages.size();
+        }
+
+        mPublishedSignal.notify_all();
+
+        messages.clear();
+
+        if (isStopRequested)
+        {
+            break;
+        }
+    }
+}
+
+void Logger::Publish(std::string const & message)
+{
+    // Store and publish
+    {
+        std::scoped_lock lock(mMutex);
+
+        mStoredMessages.push_back(message);
+        if (mStoredMessages.size() > MaxStoredMessages)
+        {
+            mStoredMessages.pop_front();
+        }
+
+        // Publish
+        if (!!mCurrentListener)
+        {
+            mCurrentListener(message);
+        }
+    }
+
+    // Output to stdout
+    std::cout << message << std::endl;
+
+#ifdef _DEBUG
+    LogToDebugStream(message);
+#endif
+}
+
 #if FS_IS_OS_WINDOWS()
 #include "windows.h"
 #endif
@@ -7,6 +7,8 @@
 
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <ctime>
 #include <deque>
 #include <functional>
@@ -15,7 +17,11 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace /* anonymous */ {
 
@@ -61,16 +67,21 @@ namespace /* anonymous */ {
 
 }
 
+/*
+ * The game's logger.
+ *
+ * Logging only captures the arguments and hands them over, under a short-lived lock,
+ * to a background thread, which does all the formatting, the storing, and the
+ * publishing to the listener and to stdout. Hence logging does not stall the caller,
+ * and the listener is invoked on the logger's thread.
+ */
 class Logger
 {
 public:
 
-	Logger()
-		: mCurrentListener()
-		, mStoredMessages()
-        , mMutex()
-	{
-	}
+	Logger();
+
+	~Logger();
 
 	Logger(Logger const &) = delete;
 	Logger(Logger &&) = delete;
@@ -83,6 +94,9 @@ public:
         // any given moment in time, so we're catching ill-conceived attempts here
 		assert(!mCurrentListener);
 
+        // Make sure we publish all messages logged so far
+        Flush();
+
         std::scoped_lock lock(mMutex);
 
         // Register listener
@@ -108,43 +122,18 @@ public:
 	template<typename...TArgs>
 	void Log(TArgs&&... args)
 	{
-        auto now = std::chrono::system_clock::now();
-        std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-        auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch() % std::chrono::seconds(1)).count();
-
-		std::stringstream ss;
-
-        ss
-            << std::put_time(std::localtime(&now_c), "%T") << "."
-            << std::setfill('0') << std::setw(6) << usecs << ":";
-
-		_LogToStream(ss, std::forward<TArgs>(args)...);
-
-		std::string const & message = ss.str();
-
-		// Store and publish
-        {
-            std::scoped_lock lock(mMutex);
-
-            mStoredMessages.push_back(message);
-            if (mStoredMessages.size() > MaxStoredMessages)
-            {
-                mStoredMessages.pop_front();
-            }
-
-            // Publish
-            if (!!mCurrentListener)
-            {
-                mCurrentListener(message);
-            }
-        }
-
-        // Output to stdout
-        std::cout << message << std::endl;
-
-#ifdef _DEBUG
-        LogToDebugStream(message);
-#endif
+        Enqueue(
+            PendingMessage(
+                std::chrono::system_clock::now(),
+                [capturedArgs = std::make_tuple(_CaptureLogArg(std::forward<TArgs>(args))...)](std::stringstream & ss)
+                {
+                    std::apply(
+                        [&ss](auto const &... a)
+                        {
+                            _LogToStream(ss, a...);
+                        },
+                        capturedArgs);
+                }));
 	}
 
     template<typename...TArgs>
@@ -153,8 +142,15 @@ public:
         _LogToNothing(std::forward<TArgs>(args)...);
     }
 
+    /*
+     * Waits until all the messages logged so far have been published.
+     */
+    void Flush();
+
     std::string GetAll()
     {
+        Flush();
+
         std::stringstream ss;
 
         {
@@ -171,6 +167,37 @@ public:
 
 private:
 
+    struct PendingMessage
+    {
+        std::chrono::system_clock::time_point Timestamp;
+        std::function<void(std::stringstream &)> Formatter;
+
+        PendingMessage(
+            std::chrono::system_clock::time_point timestamp,
+            std::function<void(std::stringstream &)> && formatter)
+            : Timestamp(timestamp)
+            , Formatter(std::move(formatter))
+        {}
+    };
+
+    template<typename T>
+    static auto _CaptureLogArg(T && t)
+    {
+        using TDecayed = std::decay_t<T>;
+
+        // Strings are captured by value, as they may well not outlive the message
+        if constexpr (std::is_same_v<TDecayed, char *> || std::is_same_v<TDecayed, char const *> || std::is_same_v<TDecayed, std::string_view>)
+            return std::string(t);
+        else
+            return TDecayed(std::forward<T>(t));
+    }
+
+    void Enqueue(PendingMessage && message);
+
+    void WorkerThreadLoop();
+
+    void Publish(std::string const & message);
+
     void LogToDebugStream(std::string const & message);
 
 public:
@@ -186,8 +213,23 @@ private:
 	std::deque<std::string> mStoredMessages;
 	static constexpr size_t MaxStoredMessages = 1000;
 
-    // The mutex for multi-threaded access
+    // The mutex for the listener and the stored messages
     std::mutex mMutex;
+
+    //
+    // Background publishing
+    //
+
+    std::thread mWorkerThread;
+
+    // Guarded by queue lock
+    std::mutex mQueueMutex;
+    std::condition_variable mQueueSignal; // Signaled when messages are enqueued
+    std::condition_variable mPublishedSignal; // Signaled when messages are published
+    std::vector<PendingMessage> mPendingMessages;
+    std::uint64_t mEnqueuedMessageCount;
+    std::uint64_t mPublishedMessageCount;
+    bool mIsStopRequested;
 };
 
 //
@@ -0,0 +1,108 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "MemoryReport.h"
+
+#include "Log.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+    std::string FormatByteSize(size_t byteSize)
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(2) << static_cast<double>(byteSize) / (1024.0 * 1024.0) << "MB";
+        return ss.str();
+    }
+}
+
+size_t MemoryReport::GetTotalByteSize() const
+{
+    size_t totalByteSize = 0;
+    for (auto const & entry : mEntries)
+    {
+        totalByteSize += entry.ByteSize;
+    }
+
+    return totalByteSize;
+}
+
+std::vector<std::pair<std::string, size_t>> MemoryReport::GetSubsystemByteSizes() const
+{
+    std::vector<std::pair<std::string, size_t>> subsystemByteSizes;
+
+    for (auto const & entry : mEntries)
+    {
+        auto it = std::find_if(
+            subsystemByteSizes.begin(),
+            subsystemByteSizes.end(),
+            [&entry](auto const & s)
+            {
+                return s.first == entry.Subsystem;
+            });
+
+        if (it != subsystemByteSizes.end())
+        {
+            it->second += entry.ByteSize;
+        }
+        else
+        {
+            subsystemByteSizes.emplace_back(entry.Subsystem, entry.ByteSize);
+        }
+    }
+
+    // Stable, so that subsystems of equal size stay in reporting order
+    std::stable_sort(
+        subsystemByteSizes.begin(),
+        subsystemByteSizes.end(),
+        [](auto const & lhs, auto const & rhs)
+        {
+            return lhs.second > rhs.second;
+        });
+
+    return subsystemByteSizes;
+}
+
+std::vector<MemoryReport::Entry> MemoryReport::GetLargestEntries(size_t maxCount) const
+{
+    std::vector<Entry> largestEntries = mEntries;
+
+    std::stable_sort(
+        largestEntries.begin(),
+        largestEntries.end(),
+        [](Entry const & lhs, Entry const & rhs)
+        {
+            return lhs.ByteSize > rhs.ByteSize;
+        });
+
+    if (largestEntries.size() > maxCount)
+    {
+        largestEntries.erase(largestEntries.begin() + maxCount, largestEntries.end());
+    }
+
+    return largestEntries;
+}
+
+void MemoryReport::Log(
+    std::string const & title,
+    size_t maxLargestEntries) const
+{
+    LogMessage(title, ": ", FormatByteSize(GetTotalByteSize()));
+
+    for (auto const & subsystem : GetSubsystemByteSizes())
+    {
+        LogMessage("    ", subsystem.first, ": ", FormatByteSize(subsystem.second));
+    }
+
+    LogMessage("  Largest:");
+
+    for (auto const & entry : GetLargestEntries(maxLargestEntries))
+    {
+        LogMessage("    ", entry.Subsystem, "::", entry.Item, ": ", FormatByteSize(entry.ByteSize));
+    }
+}
@@ -0,0 +1,106 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Buffer.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * An account of the memory occupied by an object - e.g. a ship - broken down by
+ * subsystem (e.g. "Points") and, within each subsystem, by item (e.g. "Position").
+ *
+ * Containers report their own items; owners aggregate them.
+ */
+class MemoryReport final
+{
+public:
+
+    struct Entry
+    {
+        std::string Subsystem;
+        std::string Item;
+        size_t ByteSize;
+
+        Entry(
+            std::string const & subsystem,
+            std::string const & item,
+            size_t byteSize)
+            : Subsystem(subsystem)
+            , Item(item)
+            , ByteSize(byteSize)
+        {}
+    };
+
+public:
+
+    void Add(
+        std::string const & subsystem,
+        std::string const & item,
+        size_t byteSize)
+    {
+        mEntries.emplace_back(subsystem, item, byteSize);
+    }
+
+    template<typename TElement>
+    void Add(
+        std::string const & subsystem,
+        std::string const & item,
+        Buffer<TElement> const & buffer)
+    {
+        Add(subsystem, item, buffer.GetByteSize());
+    }
+
+    template<typename TElement>
+    void Add(
+        std::string const & subsystem,
+        std::string const & item,
+        std::vector<TElement> const & vector)
+    {
+        // What is allocated, rather than what is used
+        Add(subsystem, item, vector.capacity() * sizeof(TElement));
+    }
+
+    void Add(
+        std::string const & subsystem,
+        std::string const & item,
+        std::vector<bool> const & vector)
+    {
+        // Packed
+        Add(subsystem, item, (vector.capacity() + 7) / 8);
+    }
+
+    std::vector<Entry> const & GetEntries() const
+    {
+        return mEntries;
+    }
+
+    size_t GetTotalByteSize() const;
+
+    /*
+     * Gets the total of each subsystem, in order of decreasing size.
+     */
+    std::vector<std::pair<std::string, size_t>> GetSubsystemByteSizes() const;
+
+    /*
+     * Gets the largest entries, in order of decreasing size.
+     */
+    std::vector<Entry> GetLargestEntries(size_t maxCount) const;
+
+    /*
+     * Logs the totals, the subsystem totals, and the largest entries.
+     */
+    void Log(
+        std::string const & title,
+        size_t maxLargestEntries) const;
+
+private:
+
+    std::vector<Entry> mEntries;
+};
@@ -53,12 +53,93 @@ public:
 		return szToRead;
 	}
 
+	std::uint8_t const * ReadInPlace(size_t size) override
+	{
+		if (size > mData.size() - mReadOffset)
+		{
+			return nullptr;
+		}
+
+		std::uint8_t const * const data = mData.data() + mReadOffset;
+		mReadOffset += size;
+		return data;
+	}
+
 private:
 
 	std::vector<std::uint8_t> const mData;
 	size_t mReadOffset;
 };
 
+/*
+ * Implementation of BinaryReadStream over memory owned by someone else,
+ * which must outlive the stream.
+ */
+class MemoryViewBinaryReadStream final : public BinaryReadStream
+{
+public:
+
+	MemoryViewBinaryReadStream(
+		std::uint8_t const * data,
+		size_t size)
+		: mData(data)
+		, mSize(size)
+		, mReadOffset(0u)
+	{}
+
+	size_t GetSize() override
+	{
+		return mSize;
+	}
+
+	size_t GetCurrentPosition() override
+	{
+		return mReadOffset;
+	}
+
+	void SetPosition(size_t offset) override
+	{
+		mReadOffset = std::min(offset, mSize);
+	}
+
+	size_t Read(std::uint8_t * buffer, size_t size) override
+	{
+		size_t const szToRead = std::min(size, mSize - mReadOffset);
+		if (szToRead > 0)
+		{
+			std::memcpy(buffer, mData + mReadOffset, szToRead);
+			mReadOffset += szToRead;
+		}
+
+		return szToRead;
+	}
+
+	size_t Skip(size_t size) override
+	{
+		size_t const szToRead = std::min(size, mSize - mReadOffset);
+		mReadOffset += szToRead;
+		return szToRead;
+	}
+
+	std::uint8_t const * ReadInPlace(size_t size) override
+	{
+		if (size > mSize - mReadOffset)
+		{
+			return nullptr;
+		}
+
+		std::uint8_t const * const data = mData + mReadOffset;
+		mReadOffset += size;
+		return data;
+	}
+
+private:
+
+	std::uint8_t const * const mData;
+	size_t const mSize;
+	size_t mReadOffset;
+};
+
 /*
  * Implementation of TextReadStream for in-memory streams.
  */
@@ -7,14 +7,65 @@
 
 #include "GameRandomEngine.h"
 #include "Log.h"
+#include "SysSpecifics.h"
+#include "ThreadPool.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
+
+struct Noise::PerlinCellMetadata
+{
+	int GridDensity; // Number of cells
+	int CellWidth;
+	int CellHeight;
+	float ScalingFactor;
+
+	// Per-column (within a cell) values
+	std::vector<float> OffsetX0; // cx
+	std::vector<float> OffsetX1; // cx - cellWidth
+	std::vector<float> Dx2;
+	std::vector<float> OneMinusDx2;
+
+	// Per-row (within a cell) values
+	std::vector<float> Dy2;
+};
 
 Buffer2D<float, struct IntegralTag> Noise::CreateRepeatableFractal2DPerlinNoise(
 	IntegralRectSize const & size,
 	int firstGridDensity, // Number of cells
 	int lastGridDensity, // Number of cells
 	float persistence)
+{
+	return InternalCreateRepeatableFractal2DPerlinNoise(
+		size,
+		firstGridDensity,
+		lastGridDensity,
+		persistence,
+		nullptr);
+}
+
+Buffer2D<float, struct IntegralTag> Noise::CreateRepeatableFractal2DPerlinNoise(
+	IntegralRectSize const & size,
+	int firstGridDensity, // Number of cells
+	int lastGridDensity, // Number of cells
+	float persistence,
+	ThreadPool & threadPool)
+{
+	return InternalCreateRepeatableFractal2DPerlinNoise(
+		size,
+		firstGridDensity,
+		lastGridDensity,
+		persistence,
+		&threadPool);
+}
+
+Buffer2D<float, struct IntegralTag> Noise::InternalCreateRepeatableFractal2DPerlinNoise(
+	IntegralRectSize const & size,
+	int firstGridDensity,
+	int lastGridDensity,
+	float persistence,
+	ThreadPool * threadPool)
 {
 	//
 	// Create float buf
@@ -41,7 +92,8 @@ Buffer2D<float, struct IntegralTag> Noise::CreateRepeatableFractal2DPerlinNoise(
 		AddRepeatableUnscaledPerlinNoise(
 			floatBuf,
 			gridDensity,
-			amplitude);
+			amplitude,
+			threadPool);
 
 		//
 		// Advance
@@ -82,12 +134,14 @@ Buffer2D<vec2f, struct IntegralTag> Noise::MakePerlinVectorGrid(IntegralRectSize
 void Noise::AddRepeatableUnscaledPerlinNoise(
 	Buffer2D<float, struct IntegralTag> & buffer,
 	int gridDensity, // Number of cells
-	float amplitude)
+	float amplitude,
+	ThreadPool * threadPool)
 {
 	assert((buffer.Size.width % gridDensity) == 0);
 	assert((buffer.Size.height % gridDensity) == 0);
 
-	// Create grid (#edges = #cells + 1)
+	// Create grid (#edges = #cells + 1); this is serial, so that the
+	// sequence of random numbers does not depend on parallelism
 	IntegralRectSize const gridSize = IntegralRectSize(
 		gridDensity + 1,
 		gridDensity + 1);
@@ -104,74 +158,176 @@ void Noise::AddRepeatableUnscaledPerlinNoise(
 		grid[{gridSize.width - 1, y}] = grid[{0, y}];
 	grid[{gridSize.width - 1, gridSize.height - 1}] = grid[{0, 0}];
 
-	// Create corner metadata
-	vec2i const cornerVectors[4] = {
-		{0, 0},
-		{cellWidth, 0},
-		{0, cellHeight},
-		{cellWidth, cellHeight}
-	};
+	//
+	// Create cell metadata, shared by all cells
+	//
+
+	PerlinCellMetadata cellMetadata;
+	cellMetadata.GridDensity = gridDensity;
+	cellMetadata.CellWidth = cellWidth;
+	cellMetadata.CellHeight = cellHeight;
 
 	// Precalc scaling factor, which also ensures that dot product
 	// results are between -1 and 1
-	float const scalingFactor = amplitude / std::sqrtf(static_cast<float>(cellWidth * cellWidth + cellHeight * cellHeight));
+	cellMetadata.ScalingFactor = amplitude / std::sqrtf(static_cast<float>(cellWidth * cellWidth + cellHeight * cellHeight));
+
+	cellMetadata.OffsetX0.reserve(cellWidth);
+	cellMetadata.OffsetX1.reserve(cellWidth);
+	cellMetadata.Dx2.reserve(cellWidth);
+	cellMetadata.OneMinusDx2.reserve(cellWidth);
+	float dx = 0.0f;
+	for (int cx = 0; cx < cellWidth; ++cx, dx += 1.0f / static_cast<float>(cellWidth))
+	{
+		float const dx2 = SmoothStep(0.0f, 1.0f, dx);
 
-	//
-	// Visit all points in the abstract cell
-	//
+		cellMetadata.OffsetX0.push_back(static_cast<float>(cx));
+		cellMetadata.OffsetX1.push_back(static_cast<float>(cx - cellWidth));
+		cellMetadata.Dx2.push_back(dx2);
+		cellMetadata.OneMinusDx2.push_back(1.0f - dx2);
+	}
 
+	cellMetadata.Dy2.reserve(cellHeight);
 	float dy = 0.0f;
 	for (int cy = 0; cy < cellHeight; ++cy, dy += 1.0f / static_cast<float>(cellHeight))
 	{
-		float const dy2 = SmoothStep(0.0f, 1.0f, dy);
+		cellMetadata.Dy2.push_back(SmoothStep(0.0f, 1.0f, dy));
+	}
 
-		float dx = 0.0f;
-		for (int cx = 0; cx < cellWidth; ++cx, dx += 1.0f / static_cast<float>(cellWidth))
+	//
+	// Fill rows
+	//
+
+	int const rowCount = buffer.Size.height;
+
+	if (threadPool == nullptr || threadPool->GetParallelism() <= 1)
+	{
+		AddRepeatableUnscaledPerlinNoiseRows(buffer, grid, cellMetadata, 0, rowCount);
+	}
+	else
+	{
+		// Rows are independent from each other, hence we split them among tasks
+		size_t const taskCount = std::min(threadPool->GetParallelism(), static_cast<size_t>(rowCount));
+		int const rowsPerTask = static_cast<int>((static_cast<size_t>(rowCount) + taskCount - 1) / taskCount);
+
+		std::vector<ThreadPool::Task> tasks;
+		tasks.reserve(taskCount);
+		for (int startY = 0; startY < rowCount; startY += rowsPerTask)
 		{
-			float const dx2 = SmoothStep(0.0f, 1.0f, dx);
+			int const endY = std::min(startY + rowsPerTask, rowCount);
+
+			tasks.emplace_back(
+				[&buffer, &grid, &cellMetadata, startY, endY]()
+				{
+					AddRepeatableUnscaledPerlinNoiseRows(buffer, grid, cellMetadata, startY, endY);
+				});
+		}
+
+		threadPool->Run(tasks);
+	}
+}
 
-			// Calculate the four offset vectors
-			vec2f offsetVectors[4];
-			for (int corner = 0; corner < 4; ++corner)
+void Noise::AddRepeatableUnscaledPerlinNoiseRows(
+	Buffer2D<float, struct IntegralTag> & buffer,
+	Buffer2D<vec2f, struct IntegralTag> const & grid,
+	PerlinCellMetadata const & cellMetadata,
+	int startY,
+	int endY)
+{
+	int const gridDensity = cellMetadata.GridDensity;
+	int const cellWidth = cellMetadata.CellWidth;
+	int const cellHeight = cellMetadata.CellHeight;
+	float const scalingFactor = cellMetadata.ScalingFactor;
+
+	float const * const offsetX0 = cellMetadata.OffsetX0.data();
+	float const * const offsetX1 = cellMetadata.OffsetX1.data();
+	float const * const dx2 = cellMetadata.Dx2.data();
+	float const * const oneMinusDx2 = cellMetadata.OneMinusDx2.data();
+
+	for (int y = startY; y < endY; ++y)
+	{
+		int const cellTopY = y / cellHeight;
+		int const cy = y % cellHeight;
+
+		float const offsetY0 = static_cast<float>(cy);
+		float const offsetY1 = static_cast<float>(cy - cellHeight);
+		float const dy2 = cellMetadata.Dy2[cy];
+		float const oneMinusDy2 = 1.0f - dy2;
+
+		vec2f const * gridPtr = &(grid[{0, cellTopY}]);
+		float * bufferPtr = &(buffer[{0, y}]);
+
+		for (int cellLeftX = 0; cellLeftX < gridDensity; ++cellLeftX, ++gridPtr, bufferPtr += cellWidth)
+		{
+			// The four grid vectors are constant throughout the cell's row
+			vec2f const & g0 = *(gridPtr);
+			vec2f const & g1 = *(gridPtr + 1);
+			vec2f const & g2 = *(gridPtr + gridDensity + 1);
+			vec2f const & g3 = *(gridPtr + 1 + gridDensity + 1);
+
+			// The y components of the dot products, too
+			float const dotY0 = offsetY0 * g0.y;
+			float const dotY1 = offsetY0 * g1.y;
+			float const dotY2 = offsetY1 * g2.y;
+			float const dotY3 = offsetY1 * g3.y;
+
+			int cx = 0;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+			__m128 const g0x_4 = _mm_set1_ps(g0.x);
+			__m128 const g1x_4 = _mm_set1_ps(g1.x);
+			__m128 const g2x_4 = _mm_set1_ps(g2.x);
+			__m128 const g3x_4 = _mm_set1_ps(g3.x);
+			__m128 const dotY0_4 = _mm_set1_ps(dotY0);
+			__m128 const dotY1_4 = _mm_set1_ps(dotY1);
+			__m128 const dotY2_4 = _mm_set1_ps(dotY2);
+			__m128 const dotY3_4 = _mm_set1_ps(dotY3);
+			__m128 const dy2_4 = _mm_set1_ps(dy2);
+			__m128 const oneMinusDy2_4 = _mm_set1_ps(oneMinusDy2);
+			__m128 const scalingFactor_4 = _mm_set1_ps(scalingFactor);
+
+			for (; cx + 4 <= cellWidth; cx += 4)
 			{
-				offsetVectors[corner] = vec2f(
-					static_cast<float>(cx - cornerVectors[corner].x),
-					static_cast<float>(cy - cornerVectors[corner].y));
+				__m128 const offsetX0_4 = _mm_loadu_ps(offsetX0 + cx);
+				__m128 const offsetX1_4 = _mm_loadu_ps(offsetX1 + cx);
+
+				// Calc dot products of grid vectors with offset vectors for each corner
+				__m128 const dotProduct0 = _mm_add_ps(_mm_mul_ps(offsetX0_4, g0x_4), dotY0_4);
+				__m128 const dotProduct1 = _mm_add_ps(_mm_mul_ps(offsetX1_4, g1x_4), dotY1_4);
+				__m128 const dotProduct2 = _mm_add_ps(_mm_mul_ps(offsetX0_4, g2x_4), dotY2_4);
+				__m128 const dotProduct3 = _mm_add_ps(_mm_mul_ps(offsetX1_4, g3x_4), dotY3_4);
+
+				// Interpolate dot products at the candidate pos
+				__m128 const dx2_4 = _mm_loadu_ps(dx2 + cx);
+				__m128 const oneMinusDx2_4 = _mm_loadu_ps(oneMinusDx2 + cx);
+				__m128 const nTop = _mm_add_ps(_mm_mul_ps(dotProduct0, oneMinusDx2_4), _mm_mul_ps(dotProduct1, dx2_4));
+				__m128 const nBottom = _mm_add_ps(_mm_mul_ps(dotProduct2, oneMinusDx2_4), _mm_mul_ps(dotProduct3, dx2_4));
+				__m128 const n = _mm_add_ps(_mm_mul_ps(nTop, oneMinusDy2_4), _mm_mul_ps(nBottom, dy2_4));
+
+				// Store value
+				_mm_storeu_ps(
+					bufferPtr + cx,
+					_mm_add_ps(_mm_loadu_ps(bufferPtr + cx), _mm_mul_ps(n, scalingFactor_4)));
 			}
 
-			//
-			// Visit all cells
-			//
+#endif
 
-			vec2f const * gridPtr = grid.Data.get();
-			float * bufferPtr = &(buffer[{cx, cy}]);
-
-			for (int cellTopY = 0; cellTopY < gridDensity; ++cellTopY)
+			for (; cx < cellWidth; ++cx)
 			{
-				float * bufferPtrRow = bufferPtr;
-				for (int cellLeftX = 0; cellLeftX < gridDensity; ++cellLeftX)
-				{
-					// Calc dot products of grid vectors with offset vectors for each corner
-					float const dotProduct0 = offsetVectors[0].dot(*(gridPtr));
-					float const dotProduct1 = offsetVectors[1].dot(*(gridPtr + 1));
-					float const dotProduct2 = offsetVectors[2].dot(*(gridPtr + gridDensity + 1));
-					float const dotProduct3 = offsetVectors[3].dot(*(gridPtr + 1 + gridDensity + 1));
-
-					// Interpolate dot products at the candidate pos
-					float const nTop = dotProduct0 * (1.0f - dx2) + dotProduct1 * dx2;
-					float const nBottom = dotProduct2 * (1.0f - dx2) + dotProduct3 * dx2;
-					float const n = nTop * (1.0f - dy2) + nBottom * dy2;
-
-					// Store value
-					*(bufferPtrRow) += n * scalingFactor;
-
-					++gridPtr;
-					bufferPtrRow += cellWidth;
-				}
-
-				++gridPtr; // Skip extra cell
-				bufferPtr += buffer.Size.width * cellHeight; // Restart writing into next cell's row
+				// Calc dot products of grid vectors with offset vectors for each corner
+				float const dotProduct0 = offsetX0[cx] * g0.x + dotY0;
+				float const dotProduct1 = offsetX1[cx] * g1.x + dotY1;
+				float const dotProduct2 = offsetX0[cx] * g2.x + dotY2;
+				float const dotProduct3 = offsetX1[cx] * g3.x + dotY3;
+
+				// Interpolate dot products at the candidate pos
+				float const nTop = dotProduct0 * oneMinusDx2[cx] + dotProduct1 * dx2[cx];
+				float const nBottom = dotProduct2 * oneMinusDx2[cx] + dotProduct3 * dx2[cx];
+				float const n = nTop * oneMinusDy2 + nBottom * dy2;
+
+				// Store value
+				bufferPtr[cx] += n * scalingFactor;
 			}
 		}
 	}
-}
\ No newline at end of file
+}
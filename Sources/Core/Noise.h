@@ -9,6 +9,8 @@
 #include "GameTypes.h"
 #include "Vectors.h"
 
+class ThreadPool;
+
 class Noise final
 {
 public:
@@ -19,12 +21,43 @@ public:
 		int lastGridDensity, // Number of cells
 		float persistence);
 
+	/*
+	 * As above, with rows generated in parallel.
+	 */
+	static Buffer2D<float, struct IntegralTag> CreateRepeatableFractal2DPerlinNoise(
+		IntegralRectSize const & size,
+		int firstGridDensity, // Number of cells
+		int lastGridDensity, // Number of cells
+		float persistence,
+		ThreadPool & threadPool);
+
 private:
 
+	static Buffer2D<float, struct IntegralTag> InternalCreateRepeatableFractal2DPerlinNoise(
+		IntegralRectSize const & size,
+		int firstGridDensity,
+		int lastGridDensity,
+		float persistence,
+		ThreadPool * threadPool);
+
 	static Buffer2D<vec2f, struct IntegralTag> MakePerlinVectorGrid(IntegralRectSize const & size);
 
 	static void AddRepeatableUnscaledPerlinNoise(
 		Buffer2D<float, struct IntegralTag> & buffer,
 		int gridDensity, // Number of cells
-		float amplitude);
+		float amplitude,
+		ThreadPool * threadPool);
+
+	struct PerlinCellMetadata;
+
+	/*
+	 * Adds the noise to the specified rows of the buffer, vectorized across each
+	 * row's samples.
+	 */
+	static void AddRepeatableUnscaledPerlinNoiseRows(
+		Buffer2D<float, struct IntegralTag> & buffer,
+		Buffer2D<vec2f, struct IntegralTag> const & grid,
+		PerlinCellMetadata const & cellMetadata,
+		int startY,
+		int endY);
 };
\ No newline at end of file
@@ -6,35 +6,117 @@
 #pragma once
 
 #include "GameChronometer.h"
+#include "PerfTrace.h"
 
 #include <algorithm>
 #include <atomic>
+#include <iterator>
+#include <optional>
 #include <vector>
 
+/*
+ * The measurements we take.
+ *
+ * Measurements form a hierarchy, whose nesting is reflected in the indentation
+ * below; a measurement's time is included in its parent's, but siblings do not
+ * necessarily add up to their parent. See GetPerfMeasurementInfo().
+ *
+ * "Total" measurements are summed across all the instances of a subsystem (e.g.
+ * across all ships), and are counted once per instance.
+ */
 enum class PerfMeasurement : size_t
 {
     // Update
     TotalUpdate = 0,
-    TotalNpcUpdate,
-    TotalFishUpdate,
-    TotalOceanSurfaceUpdate,
-    TotalShipsUpdate,
-    TotalShipsSpringsUpdate,
-    TotalWaitForRenderUpload,
-    TotalNetUpdate, // = TotalUpdate - TotalWaitForRenderUpload
+        TotalNetUpdate,
+            TotalOceanSurfaceUpdate,
+            TotalShipsUpdate,
+                TotalShipsSpringsUpdate,
+                TotalShipsStrainUpdate,
+                TotalShipsWorldForcesUpdate,
+                TotalShipsWaterDynamicsUpdate,
+                TotalShipsWaterDiffusionUpdate,
+                TotalShipsPressureUpdate,
+                TotalShipsHeatUpdate,
+                TotalShipsElectricalUpdate,
+                TotalShipsLightDiffusionUpdate,
+                TotalShipsCombustionUpdate,
+                TotalShipsEphemeralParticlesUpdate,
+            TotalNpcUpdate,
+            TotalFishUpdate,
 
     // Render-Upload
     TotalWaitForRenderDraw,
     TotalNetRenderUpload,
+        TotalSkyRenderUpload,
+        TotalOceanRenderUpload,
+        TotalFishRenderUpload,
+        TotalShipsRenderUpload,
+            TotalShipsStructureUpdate,
+            TotalShipsPointsRenderUpload,
+            TotalShipsElementsRenderUpload,
+            TotalShipsFrontiersRenderUpload,
+        TotalNpcRenderUpload,
+        TotalNotificationsRenderUpload,
 
     // Render-Draw
     TotalMainThreadRenderDraw,
     TotalRenderDraw, // In render thread
-    TotalUploadRenderDraw,
+        TotalUploadRenderDraw,
 
     _Last = TotalUploadRenderDraw
 };
 
+struct PerfMeasurementInfo
+{
+    char const * Name;
+    std::optional<PerfMeasurement> Parent;
+};
+
+inline PerfMeasurementInfo const & GetPerfMeasurementInfo(PerfMeasurement measurement)
+{
+    static PerfMeasurementInfo const Infos[] = {
+        { "Update", std::nullopt },
+        { "NetUpdate", PerfMeasurement::TotalUpdate },
+        { "OceanSurface", PerfMeasurement::TotalNetUpdate },
+        { "Ships", PerfMeasurement::TotalNetUpdate },
+        { "Springs", PerfMeasurement::TotalShipsUpdate },
+        { "Strain", PerfMeasurement::TotalShipsUpdate },
+        { "WorldForces", PerfMeasurement::TotalShipsUpdate },
+        { "WaterDynamics", PerfMeasurement::TotalShipsUpdate },
+        { "WaterDiffusion", PerfMeasurement::TotalShipsUpdate },
+        { "Pressure", PerfMeasurement::TotalShipsUpdate },
+        { "Heat", PerfMeasurement::TotalShipsUpdate },
+        { "Electrical", PerfMeasurement::TotalShipsUpdate },
+        { "LightDiffusion", PerfMeasurement::TotalShipsUpdate },
+        { "Combustion", PerfMeasurement::TotalShipsUpdate },
+        { "EphemeralParticles", PerfMeasurement::TotalShipsUpdate },
+        { "Npcs", PerfMeasurement::TotalNetUpdate },
+        { "Fishes", PerfMeasurement::TotalNetUpdate },
+
+        { "WaitForRenderDraw", std::nullopt },
+        { "NetRenderUpload", std::nullopt },
+        { "SkyUpload", PerfMeasurement::TotalNetRenderUpload },
+        { "OceanUpload", PerfMeasurement::TotalNetRenderUpload },
+        { "FishesUpload", PerfMeasurement::TotalNetRenderUpload },
+        { "ShipsUpload", PerfMeasurement::TotalNetRenderUpload },
+        { "Structure", PerfMeasurement::TotalShipsRenderUpload },
+        { "PointsUpload", PerfMeasurement::TotalShipsRenderUpload },
+        { "ElementsUpload", PerfMeasurement::TotalShipsRenderUpload },
+        { "FrontiersUpload", PerfMeasurement::TotalShipsRenderUpload },
+        { "NpcsUpload", PerfMeasurement::TotalNetRenderUpload },
+        { "NotificationsUpload", PerfMeasurement::TotalNetRenderUpload },
+
+        { "MainThreadRenderDraw", std::nullopt },
+        { "RenderDraw", std::nullopt },
+        { "UploadRenderDraw", PerfMeasurement::TotalRenderDraw }
+    };
+
+    static_assert(std::size(Infos) == static_cast<size_t>(PerfMeasurement::_Last) + 1);
+
+    return Infos[static_cast<size_t>(measurement)];
+}
+
 struct PerfStats
 {
     struct Ratio
@@ -80,10 +162,13 @@ struct PerfStats
 
         inline void Update(GameChronometer::duration duration)
         {
+            // Note: measurements may be updated concurrently by multiple threads
             auto ratio = mRatio.load();
-            ratio.Duration += duration;
-            ratio.Denominator += 1;
-            mRatio.store(ratio);
+            _Ratio newRatio;
+            do
+            {
+                newRatio = _Ratio(ratio.Duration + duration, ratio.Denominator + 1);
+            } while (!mRatio.compare_exchange_weak(ratio, newRatio));
         }
 
         template<typename TDuration>
@@ -130,10 +215,22 @@ struct PerfStats
         return mMeasurements[static_cast<std::size_t>(PM)];
     }
 
+    Ratio const & GetMeasurement(PerfMeasurement measurement) const
+    {
+        return mMeasurements[static_cast<std::size_t>(measurement)];
+    }
+
     template<PerfMeasurement PM>
     void Update(GameChronometer::duration duration)
     {
         mMeasurements[static_cast<std::size_t>(PM)].Update(duration);
+
+        // Trace it, if we're recording; measurements are always taken right at their end
+        if (PerfTrace::GetInstance().IsRecording())
+        {
+            auto const now = GameChronometer::Now();
+            PerfTrace::GetInstance().RecordEvent(GetPerfMeasurementInfo(PM).Name, now - duration, now);
+        }
     }
 
     void Reset()
@@ -158,10 +255,36 @@ inline PerfStats operator-(PerfStats const & lhs, PerfStats const & rhs)
 {
     PerfStats perfStats;
 
-    for (size_t i = 0; i < static_cast<size_t>(PerfMeasurement::_Last); ++i)
+    for (size_t i = 0; i <= static_cast<size_t>(PerfMeasurement::_Last); ++i)
     {
         perfStats.mMeasurements[i] = lhs.mMeasurements[i] - rhs.mMeasurements[i];
     }
 
     return perfStats;
-}
\ No newline at end of file
+}
+/*
+ * Measures the time spent in a scope.
+ */
+template<PerfMeasurement PM>
+class ScopedPerfMeasurement final
+{
+public:
+
+    explicit ScopedPerfMeasurement(PerfStats & perfStats)
+        : mPerfStats(perfStats)
+        , mStartTime(GameChronometer::Now())
+    {}
+
+    ~ScopedPerfMeasurement()
+    {
+        mPerfStats.Update<PM>(GameChronometer::Now() - mStartTime);
+    }
+
+    ScopedPerfMeasurement(ScopedPerfMeasurement const &) = delete;
+    ScopedPerfMeasurement & operator=(ScopedPerfMeasurement const &) = delete;
+
+private:
+
+    PerfStats & mPerfStats;
+    GameChronometer::time_point const mStartTime;
+};
@@ -0,0 +1,165 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "PerfTrace.h"
+
+#include "GameException.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace /* anonymous */ {
+
+    std::string EscapeJsonString(std::string const & str)
+    {
+        std::string result;
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+                result.push_back('\\');
+
+            result.push_back(c);
+        }
+
+        return result;
+    }
+}
+
+PerfTrace::PerfTrace()
+    : mIsRecording(false)
+    , mRecordingStartTime(GameChronometer::Now())
+    , mTimelinesLock()
+    , mTimelines()
+{
+}
+
+void PerfTrace::StartRecording()
+{
+    {
+        std::lock_guard const lock{ mTimelinesLock };
+
+        for (auto & timeline : mTimelines)
+        {
+            std::lock_guard const timelineLock{ timeline->Lock };
+
+            timeline->Events.clear();
+            timeline->DroppedEventCount = 0;
+        }
+
+        mRecordingStartTime = GameChronometer::Now();
+    }
+
+    mIsRecording.store(true);
+
+    LogMessage("PerfTrace: started recording");
+}
+
+size_t PerfTrace::StopRecording(std::filesystem::path const & outputFilePath)
+{
+    mIsRecording.store(false);
+
+    std::ofstream outputFile(outputFilePath, std::ios_base::out | std::ios_base::trunc);
+    if (!outputFile.is_open())
+    {
+        throw GameException("Cannot open file \"" + outputFilePath.string() + "\" for writing");
+    }
+
+    auto const toMicroseconds = [](GameChronometer::duration duration)
+        {
+            // Events may have started right before the recording did
+            return std::max<std::int64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+                0);
+        };
+
+    size_t eventCount = 0;
+    size_t droppedEventCount = 0;
+
+    outputFile << "{\"traceEvents\":[";
+
+    bool isFirst = true;
+
+    std::lock_guard const lock{ mTimelinesLock };
+
+    for (auto & timeline : mTimelines)
+    {
+        std::lock_guard const timelineLock{ timeline->Lock };
+
+        if (!isFirst)
+            outputFile << ",";
+
+        outputFile << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << timeline->ThreadId
+            << ",\"args\":{\"name\":\"" << EscapeJsonString(timeline->ThreadName) << "\"}}";
+
+        isFirst = false;
+
+        for (Event const & e : timeline->Events)
+        {
+            outputFile << ",\n{\"name\":\"" << EscapeJsonString(e.Name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << timeline->ThreadId
+                << ",\"ts\":" << toMicroseconds(e.StartTime - mRecordingStartTime)
+                << ",\"dur\":" << toMicroseconds(e.EndTime - e.StartTime)
+                << "}";
+        }
+
+        eventCount += timeline->Events.size();
+        droppedEventCount += timeline->DroppedEventCount;
+
+        timeline->Events.clear();
+        timeline->Events.shrink_to_fit();
+    }
+
+    outputFile << "\n]}\n";
+
+    LogMessage("PerfTrace: stopped recording; saved ", eventCount, " events (dropped ", droppedEventCount, ") to \"", outputFilePath.string(), "\"");
+
+    return eventCount;
+}
+
+void PerfTrace::SetThisThreadName(std::string const & threadName)
+{
+    ThreadTimeline & timeline = GetThisThreadTimeline();
+
+    std::lock_guard const lock{ mTimelinesLock };
+
+    timeline.ThreadName = threadName;
+}
+
+PerfTrace::ThreadTimeline & PerfTrace::GetThisThreadTimeline()
+{
+    // Note: timelines are never deleted, and neither are we
+    thread_local ThreadTimeline * thisThreadTimeline = nullptr;
+
+    if (thisThreadTimeline == nullptr)
+    {
+        std::lock_guard const lock{ mTimelinesLock };
+
+        size_t const threadId = mTimelines.size() + 1;
+        mTimelines.emplace_back(std::make_unique<ThreadTimeline>(threadId, "Thread " + std::to_string(threadId)));
+
+        thisThreadTimeline = mTimelines.back().get();
+    }
+
+    return *thisThreadTimeline;
+}
+
+void PerfTrace::DoRecordEvent(
+    char const * name,
+    GameChronometer::time_point startTime,
+    GameChronometer::time_point endTime)
+{
+    ThreadTimeline & timeline = GetThisThreadTimeline();
+
+    std::lock_guard const lock{ timeline.Lock };
+
+    if (timeline.Events.size() < MaxEventsPerThread)
+    {
+        timeline.Events.emplace_back(name, startTime, endTime);
+    }
+    else
+    {
+        ++timeline.DroppedEventCount;
+    }
+}
@@ -0,0 +1,156 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * Records timelines of begin/end events, one per thread, and writes them
+ * out as a Chrome trace (chrome://tracing, Perfetto).
+ *
+ * Recording is off by default; when off, recording an event costs the
+ * check of a flag.
+ */
+class PerfTrace final
+{
+public:
+
+    static PerfTrace & GetInstance()
+    {
+        static PerfTrace * instance = new PerfTrace();
+
+        return *instance;
+    }
+
+    inline bool IsRecording() const
+    {
+        return mIsRecording.load(std::memory_order_relaxed);
+    }
+
+    void StartRecording();
+
+    /*
+     * Stops recording and saves the trace to the specified file; returns the number of events saved.
+     */
+    size_t StopRecording(std::filesystem::path const & outputFilePath);
+
+    /*
+     * Names the calling thread in the traces.
+     */
+    void SetThisThreadName(std::string const & threadName);
+
+    /*
+     * The name is expected to outlive the recording, e.g. to be a literal.
+     */
+    inline void RecordEvent(
+        char const * name,
+        GameChronometer::time_point startTime,
+        GameChronometer::time_point endTime)
+    {
+        if (IsRecording())
+        {
+            DoRecordEvent(name, startTime, endTime);
+        }
+    }
+
+private:
+
+    PerfTrace();
+
+    struct Event
+    {
+        char const * Name;
+        GameChronometer::time_point StartTime;
+        GameChronometer::time_point EndTime;
+
+        Event(
+            char const * name,
+            GameChronometer::time_point startTime,
+            GameChronometer::time_point endTime)
+            : Name(name)
+            , StartTime(startTime)
+            , EndTime(endTime)
+        {}
+    };
+
+    struct ThreadTimeline
+    {
+        size_t const ThreadId;
+        std::string ThreadName;
+
+        std::mutex Lock; // Only contended while starting and stopping recordings
+        std::vector<Event> Events;
+        size_t DroppedEventCount;
+
+        ThreadTimeline(
+            size_t threadId,
+            std::string const & threadName)
+            : ThreadId(threadId)
+            , ThreadName(threadName)
+            , Lock()
+            , Events()
+            , DroppedEventCount(0)
+        {}
+    };
+
+    ThreadTimeline & GetThisThreadTimeline();
+
+    void DoRecordEvent(
+        char const * name,
+        GameChronometer::time_point startTime,
+        GameChronometer::time_point endTime);
+
+private:
+
+    // Cap on the number of events we keep for each thread, to bound memory
+    // usage when a recording is left running
+    static size_t constexpr MaxEventsPerThread = 1000000;
+
+    std::atomic<bool> mIsRecording;
+
+    GameChronometer::time_point mRecordingStartTime;
+
+    // All the timelines ever created, one per thread
+    std::mutex mTimelinesLock;
+    std::vector<std::unique_ptr<ThreadTimeline>> mTimelines;
+};
+
+/*
+ * Records a trace event for a scope.
+ */
+class ScopedPerfTraceEvent final
+{
+public:
+
+    explicit ScopedPerfTraceEvent(char const * name)
+        : mName(name)
+        , mStartTime(PerfTrace::GetInstance().IsRecording() ? GameChronometer::Now() : GameChronometer::time_point())
+    {}
+
+    ~ScopedPerfTraceEvent()
+    {
+        if (mStartTime != GameChronometer::time_point())
+        {
+            PerfTrace::GetInstance().RecordEvent(mName, mStartTime, GameChronometer::Now());
+        }
+    }
+
+    ScopedPerfTraceEvent(ScopedPerfTraceEvent const &) = delete;
+    ScopedPerfTraceEvent & operator=(ScopedPerfTraceEvent const &) = delete;
+
+private:
+
+    char const * const mName;
+    GameChronometer::time_point const mStartTime;
+};
@@ -0,0 +1,161 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <vector>
+
+/*
+ * Builds a task graph out of a sequence of phases, each declaring the resources
+ * (e.g. buffers) it reads and writes.
+ *
+ * A phase is made to depend on all the earlier phases it conflicts with - i.e. the
+ * last writers of the resources it reads or writes, and the readers of the resources
+ * it writes since they were last written - so that the graph yields the same
+ * results as running the phases in the order in which they have been added, while
+ * letting phases that do not conflict run concurrently.
+ *
+ * TResource is an enum class whose last value is _Last.
+ */
+template<typename TResource>
+class PhaseGraph final
+{
+public:
+
+    using PhaseId = ThreadPool::TaskGraph::TaskId;
+
+    PhaseGraph()
+        : mTaskGraph()
+        , mPhaseDependencies()
+        , mLastWriters()
+        , mReadersSinceLastWrite()
+    {}
+
+    PhaseId AddPhase(
+        ThreadPool::Task && task,
+        std::initializer_list<TResource> reads,
+        std::initializer_list<TResource> writes)
+    {
+        std::array<ThreadPool::Task, 1> tasks{ std::move(task) };
+
+        return AddPhases(std::move(tasks), reads, writes).front();
+    }
+
+    /*
+     * Adds a group of phases that work on disjoint partitions of the same
+     * resources, and which thus may run concurrently with each other; later
+     * phases that conflict with the group depend on all of its phases.
+     *
+     * Tasks may come in any container, e.g. one backed by a frame arena.
+     */
+    template<typename TTasks>
+    std::vector<PhaseId> AddPhases(
+        TTasks && tasks,
+        std::initializer_list<TResource> reads,
+        std::initializer_list<TResource> writes)
+    {
+        assert(!tasks.empty());
+
+        //
+        // Calculate dependencies
+        //
+
+        std::vector<PhaseId> dependencies;
+
+        for (TResource const r : reads)
+        {
+            auto const & lastWriters = mLastWriters[static_cast<size_t>(r)];
+            dependencies.insert(dependencies.end(), lastWriters.cbegin(), lastWriters.cend());
+        }
+
+        for (TResource const w : writes)
+        {
+            auto const & lastWriters = mLastWriters[static_cast<size_t>(w)];
+            dependencies.insert(dependencies.end(), lastWriters.cbegin(), lastWriters.cend());
+
+            auto const & readers = mReadersSinceLastWrite[static_cast<size_t>(w)];
+            dependencies.insert(dependencies.end(), readers.cbegin(), readers.cend());
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+        //
+        // Add tasks
+        //
+
+        std::vector<PhaseId> newPhaseIds;
+
+        for (auto & task : tasks)
+        {
+            PhaseId const newPhaseId = mTaskGraph.Add(std::move(task), dependencies);
+            assert(newPhaseId == mPhaseDependencies.size());
+
+            mPhaseDependencies.emplace_back(dependencies);
+
+            newPhaseIds.push_back(newPhaseId);
+        }
+
+        //
+        // Update resource state - reads first, so that a phase
+        // that reads and writes a resource is just its last writer
+        //
+
+        for (TResource const r : reads)
+        {
+            auto & readers = mReadersSinceLastWrite[static_cast<size_t>(r)];
+            readers.insert(readers.end(), newPhaseIds.cbegin(), newPhaseIds.cend());
+        }
+
+        for (TResource const w : writes)
+        {
+            mLastWriters[static_cast<size_t>(w)] = newPhaseIds;
+            mReadersSinceLastWrite[static_cast<size_t>(w)].clear();
+        }
+
+        return newPhaseIds;
+    }
+
+    bool IsEmpty() const
+    {
+        return mTaskGraph.IsEmpty();
+    }
+
+    /*
+     * The (direct) dependencies of the specified phase, sorted.
+     */
+    std::vector<PhaseId> const & GetDependencies(PhaseId phaseId) const
+    {
+        assert(phaseId < mPhaseDependencies.size());
+        return mPhaseDependencies[phaseId];
+    }
+
+    void Run(ThreadPool & threadPool)
+    {
+        if (!mTaskGraph.IsEmpty())
+        {
+            threadPool.Run(mTaskGraph);
+        }
+    }
+
+private:
+
+    static size_t constexpr ResourceCount = static_cast<size_t>(TResource::_Last) + 1;
+
+    ThreadPool::TaskGraph mTaskGraph;
+
+    // Indexed by phase
+    std::vector<std::vector<PhaseId>> mPhaseDependencies;
+
+    // Indexed by resource
+    std::array<std::vector<PhaseId>, ResourceCount> mLastWriters; // More than one for phase groups
+    std::array<std::vector<PhaseId>, ResourceCount> mReadersSinceLastWrite;
+};
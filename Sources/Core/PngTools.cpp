@@ -220,14 +220,14 @@ ImageSize PngTools::GetImageSize(BinaryReadStream & pngImageData)
         static_cast<int>(height) };
 }
 
-void PngTools::EncodeImage(RgbaImageData const & image, BinaryWriteStream & outputStream)
+void PngTools::EncodeImage(RgbaImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed)
 {
-    InternalEncodeImage<RgbaImageData>(image, outputStream);
+    InternalEncodeImage<RgbaImageData>(image, outputStream, compressionSpeed);
 }
 
-void PngTools::EncodeImage(RgbImageData const & image, BinaryWriteStream & outputStream)
+void PngTools::EncodeImage(RgbImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed)
 {
-    InternalEncodeImage<RgbImageData>(image, outputStream);
+    InternalEncodeImage<RgbImageData>(image, outputStream, compressionSpeed);
 }
 
 ///////////////////////////////////////////////////
@@ -577,7 +577,7 @@ TImageData PngTools::InternalDecodeImage(BinaryReadStream & pngImageData)
 }
 
 template<typename TImageData>
-void PngTools::InternalEncodeImage(TImageData const & image, BinaryWriteStream & outputStream)
+void PngTools::InternalEncodeImage(TImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed)
 {
     auto context = _detail::EncodeProlog(outputStream);
 
@@ -612,6 +612,15 @@ void PngTools::InternalEncodeImage(TImageData const & image, BinaryWriteStream &
             PNG_INTERLACE_NONE,
             PNG_COMPRESSION_TYPE_DEFAULT,
             PNG_FILTER_TYPE_DEFAULT);
+
+        if (compressionSpeed == CompressionSpeedType::Fast)
+        {
+            // Most of the encoding time goes in trying all filters on each row,
+            // and in deflating at the default level; the Sub filter alone and
+            // the fastest deflate level (Z_BEST_SPEED) lose little on our images
+            png_set_filter(context->png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+            png_set_compression_level(context->png_ptr, 1);
+        }
     }
 
     // Write whole
@@ -22,13 +22,19 @@ class PngTools
 {
 public:
 
+    enum class CompressionSpeedType
+    {
+        Default,    // Smallest files
+        Fast        // Several times faster to encode, for slightly larger files; e.g. for screenshots
+    };
+
     static RgbaImageData DecodeImageRgba(BinaryReadStream & pngImageData);
     static RgbImageData DecodeImageRgb(BinaryReadStream & pngImageData);
 
     static ImageSize GetImageSize(BinaryReadStream & pngImageData);
 
-    static void EncodeImage(RgbaImageData const & image, BinaryWriteStream & outputStream);
-    static void EncodeImage(RgbImageData const & image, BinaryWriteStream & outputStream);
+    static void EncodeImage(RgbaImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed = CompressionSpeedType::Default);
+    static void EncodeImage(RgbImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed = CompressionSpeedType::Default);
 
 private:
 
@@ -36,5 +42,5 @@ private:
     static TImageData InternalDecodeImage(BinaryReadStream & pngImageData);
 
     template<typename TImageData>
-    static void InternalEncodeImage(TImageData const & image, BinaryWriteStream & outputStream);
+    static void InternalEncodeImage(TImageData const & image, BinaryWriteStream & outputStream, CompressionSpeedType compressionSpeed);
 };
\ No newline at end of file
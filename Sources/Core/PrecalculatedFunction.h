@@ -6,6 +6,7 @@
 #pragma once
 
 #include "GameMath.h"
+#include "SysSpecifics.h"
 
 #include <array>
 #include <cassert>
@@ -139,6 +140,33 @@ public:
             + mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
     }
 
+    /*
+     * Equivalent to invoking GetLinearlyInterpolatedPeriodic() on each of count values,
+     * but evaluating four values at a time.
+     *
+     * Requires a power-of-two number of samples, so that wrapping around is a mask.
+     */
+    void GetLinearlyInterpolatedPeriodic(
+        float const * restrict x,
+        float * restrict outValues,
+        size_t count) const
+    {
+        static_assert((SamplesCount & (SamplesCount - 1)) == 0, "Batch evaluation requires a power-of-two number of samples");
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+        size_t const vectorizedCount = GetLinearlyInterpolatedPeriodic_SSEVectorized(x, outValues, count);
+#elif FS_IS_ARM_NEON()
+        size_t const vectorizedCount = GetLinearlyInterpolatedPeriodic_NeonVectorized(x, outValues, count);
+#else
+        size_t const vectorizedCount = 0;
+#endif
+
+        for (size_t i = vectorizedCount; i < count; ++i)
+        {
+            outValues[i] = GetLinearlyInterpolatedPeriodic(x[i]);
+        }
+    }
+
 private:
 
     void PopulateSamples(std::function<float(float)> calculator)
@@ -168,6 +196,105 @@ private:
         mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Never used
     }
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    size_t GetLinearlyInterpolatedPeriodic_SSEVectorized(
+        float const * restrict x,
+        float * restrict outValues,
+        size_t count) const
+    {
+        __m128 const samplesCount_4 = _mm_set1_ps(static_cast<float>(SamplesCount));
+        __m128i const sampleIndexMask_4 = _mm_set1_epi32(static_cast<int>(SamplesCount - 1));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // Fractional absolute index in the (infinite) sample array
+            __m128 const absoluteSampleIndexF_4 = _mm_mul_ps(_mm_loadu_ps(x + i), samplesCount_4);
+
+            // Integral part, floored: truncation rounds negatives up, in which case we step back by one
+            __m128i absoluteSampleIndexI_4 = _mm_cvttps_epi32(absoluteSampleIndexF_4);
+            absoluteSampleIndexI_4 = _mm_add_epi32(
+                absoluteSampleIndexI_4,
+                _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(absoluteSampleIndexI_4), absoluteSampleIndexF_4))); // -1 where rounded up
+
+            // Fractional part within sample index and the next sample index
+            __m128 const sampleIndexDx_4 = _mm_sub_ps(absoluteSampleIndexF_4, _mm_cvtepi32_ps(absoluteSampleIndexI_4));
+
+            // Integral part - sample; two's complement makes the mask wrap negatives around too
+            alignas(16) std::int32_t sampleIndices[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(sampleIndices), _mm_and_si128(absoluteSampleIndexI_4, sampleIndexMask_4));
+
+            // Fetch the (value, delta) pairs - no gathers
+            __m128 const samples01_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[0]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[1]])));
+            __m128 const samples23_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[2]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[3]])));
+
+            __m128 const sampleValues_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const sampleDeltas_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm_storeu_ps(
+                outValues + i,
+                _mm_add_ps(
+                    sampleValues_4,
+                    _mm_mul_ps(sampleDeltas_4, sampleIndexDx_4)));
+        }
+
+        return i;
+    }
+#endif
+
+#if FS_IS_ARM_NEON()
+    size_t GetLinearlyInterpolatedPeriodic_NeonVectorized(
+        float const * restrict x,
+        float * restrict outValues,
+        size_t count) const
+    {
+        float32x4_t const samplesCount_4 = vdupq_n_f32(static_cast<float>(SamplesCount));
+        int32x4_t const sampleIndexMask_4 = vdupq_n_s32(static_cast<int>(SamplesCount - 1));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // Fractional absolute index in the (infinite) sample array
+            float32x4_t const absoluteSampleIndexF_4 = vmulq_f32(vld1q_f32(x + i), samplesCount_4);
+
+            // Integral part, floored: truncation rounds negatives up, in which case we step back by one
+            int32x4_t absoluteSampleIndexI_4 = vcvtq_s32_f32(absoluteSampleIndexF_4);
+            absoluteSampleIndexI_4 = vaddq_s32(
+                absoluteSampleIndexI_4,
+                vreinterpretq_s32_u32(vcgtq_f32(vcvtq_f32_s32(absoluteSampleIndexI_4), absoluteSampleIndexF_4))); // -1 where rounded up
+
+            // Fractional part within sample index and the next sample index
+            float32x4_t const sampleIndexDx_4 = vsubq_f32(absoluteSampleIndexF_4, vcvtq_f32_s32(absoluteSampleIndexI_4));
+
+            // Integral part - sample; two's complement makes the mask wrap negatives around too
+            std::int32_t sampleIndices[4];
+            vst1q_s32(sampleIndices, vandq_s32(absoluteSampleIndexI_4, sampleIndexMask_4));
+
+            // Fetch the (value, delta) pairs - no gathers
+            float32x4x2_t const samples_4 = vuzpq_f32(
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[0]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[1]].SampleValue))),
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[2]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[3]].SampleValue))));
+
+            vst1q_f32(
+                outValues + i,
+                vmlaq_f32(
+                    samples_4.val[0],
+                    samples_4.val[1],
+                    sampleIndexDx_4));
+        }
+
+        return i;
+    }
+#endif
+
     struct Sample
     {
         float SampleValue; // Value of this sample
@@ -0,0 +1,113 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/*
+ * Counter-based pseudo-random generator: the n-th value of a stream is a pure
+ * function of the stream's key and of n, i.e. a SplitMix64 finalizer applied to
+ * a Weyl sequence.
+ *
+ * Hence:
+ * - Streams are cheap to create, and independent streams may be derived from
+ *   a single seed, e.g. one per parallel task;
+ * - Batch fills have no dependency between consecutive values, and vectorize;
+ * - The state is just a counter, which makes it trivial to save and restore.
+ *
+ * Satisfies UniformRandomBitGenerator, so it may also drive std distributions.
+ */
+class RandomStream final
+{
+public:
+
+    using result_type = std::uint64_t;
+
+    RandomStream(
+        std::uint64_t seed,
+        std::uint64_t streamIndex)
+        : mKey(Mix(Mix(seed) ^ (streamIndex * KeyGamma + 1)))
+        , mCounter(0)
+    {}
+
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline result_type operator()()
+    {
+        return Generate(mCounter++);
+    }
+
+    /*
+     * Returns a value in [0.0, 1.0).
+     */
+    inline float GenerateNormalizedUniformReal()
+    {
+        return ToNormalizedFloat(Generate(mCounter++));
+    }
+
+    /*
+     * Fills the specified buffer with values in [0.0, 1.0); equivalent to, but
+     * faster than, invoking GenerateNormalizedUniformReal() count times.
+     */
+    void FillNormalizedUniformReals(
+        float * values,
+        size_t count)
+    {
+        std::uint64_t const counterStart = mCounter;
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = ToNormalizedFloat(Generate(counterStart + i));
+        }
+
+        mCounter += count;
+    }
+
+    std::uint64_t GetCounter() const
+    {
+        return mCounter;
+    }
+
+    void SetCounter(std::uint64_t counter)
+    {
+        mCounter = counter;
+    }
+
+private:
+
+    static std::uint64_t constexpr WeylGamma = 0x9e3779b97f4a7c15ull;
+    static std::uint64_t constexpr KeyGamma = 0xd1b54a32d192ed03ull;
+
+    static inline std::uint64_t Mix(std::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    inline std::uint64_t Generate(std::uint64_t counter) const
+    {
+        return Mix(mKey + (counter + 1) * WeylGamma);
+    }
+
+    static inline float ToNormalizedFloat(std::uint64_t value)
+    {
+        // Top 24 bits, i.e. as many as a float's mantissa may hold
+        return static_cast<float>(value >> 40) * (1.0f / 16777216.0f);
+    }
+
+    std::uint64_t mKey;
+    std::uint64_t mCounter;
+};
@@ -0,0 +1,68 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Snapshot.h"
+
+#include <fstream>
+
+namespace {
+
+    // File header: magic, format version
+    char constexpr FileMagic[4] = { 'F', 'S', 'S', 'S' };
+    std::uint32_t constexpr FileFormatVersion = 1;
+}
+
+Snapshot Snapshot::Load(std::filesystem::path const & filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        throw GameException("Cannot open snapshot file \"" + filePath.string() + "\"");
+    }
+
+    size_t const fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+
+    size_t constexpr HeaderSize = sizeof(FileMagic) + sizeof(std::uint32_t);
+
+    char magic[sizeof(FileMagic)];
+    std::uint32_t version = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+
+    if (!file
+        || std::memcmp(magic, FileMagic, sizeof(FileMagic)) != 0
+        || version != FileFormatVersion)
+    {
+        throw GameException("Snapshot file \"" + filePath.string() + "\" is not a valid snapshot file");
+    }
+
+    std::vector<std::uint8_t> data(fileSize - HeaderSize);
+    file.read(reinterpret_cast<char *>(data.data()), data.size());
+    if (!file)
+    {
+        throw GameException("Cannot read snapshot file \"" + filePath.string() + "\"");
+    }
+
+    return Snapshot(std::move(data));
+}
+
+void Snapshot::Save(std::filesystem::path const & filePath) const
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw GameException("Cannot create snapshot file \"" + filePath.string() + "\"");
+    }
+
+    file.write(FileMagic, sizeof(FileMagic));
+    file.write(reinterpret_cast<char const *>(&FileFormatVersion), sizeof(FileFormatVersion));
+    file.write(reinterpret_cast<char const *>(mData.data()), mData.size());
+
+    if (!file)
+    {
+        throw GameException("Cannot write snapshot file \"" + filePath.string() + "\"");
+    }
+}
@@ -0,0 +1,276 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Buffer.h"
+#include "GameException.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+ * An opaque blob of binary state, written and read back sequentially via a
+ * SnapshotWriter and a SnapshotReader.
+ *
+ * Values and buffers are copied verbatim, hence a snapshot may only be restored
+ * by the same build that took it, on the same platform.
+ */
+class Snapshot final
+{
+public:
+
+    Snapshot() = default;
+
+    static Snapshot Load(std::filesystem::path const & filePath);
+
+    void Save(std::filesystem::path const & filePath) const;
+
+    size_t GetByteSize() const
+    {
+        return mData.size();
+    }
+
+private:
+
+    explicit Snapshot(std::vector<std::uint8_t> && data)
+        : mData(std::move(data))
+    {}
+
+    std::vector<std::uint8_t> mData;
+
+    friend class SnapshotWriter;
+    friend class SnapshotReader;
+};
+
+class SnapshotWriter final
+{
+public:
+
+    explicit SnapshotWriter(Snapshot & snapshot)
+        : mData(snapshot.mData)
+    {}
+
+    template<typename T>
+    void Write(T const & value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        WriteBytes(&value, sizeof(T));
+    }
+
+    template<typename TElement>
+    void Write(Buffer<TElement> const & buffer)
+    {
+        Write(buffer, buffer.GetSize());
+    }
+
+    /*
+     * Writes only the first elementCount elements of the buffer.
+     */
+    template<typename TElement>
+    void Write(
+        Buffer<TElement> const & buffer,
+        size_t elementCount)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+        assert(elementCount <= buffer.GetSize());
+
+        WriteHeader<TElement>(elementCount);
+        WriteBytes(buffer.data(), elementCount * sizeof(TElement));
+    }
+
+    template<typename TElement>
+    void Write(std::vector<TElement> const & elements)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+
+        WriteHeader<TElement>(elements.size());
+        WriteBytes(elements.data(), elements.size() * sizeof(TElement));
+    }
+
+    template<typename TElement>
+    void Write(std::deque<TElement> const & elements)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+
+        WriteHeader<TElement>(elements.size());
+        for (auto const & element : elements)
+        {
+            WriteBytes(&element, sizeof(TElement));
+        }
+    }
+
+    void Write(std::string const & value)
+    {
+        WriteHeader<char>(value.size());
+        WriteBytes(value.data(), value.size());
+    }
+
+private:
+
+    template<typename TElement>
+    void WriteHeader(size_t elementCount)
+    {
+        Write(static_cast<std::uint64_t>(elementCount));
+        Write(static_cast<std::uint32_t>(sizeof(TElement)));
+    }
+
+    void WriteBytes(void const * bytes, size_t byteCount)
+    {
+        size_t const offset = mData.size();
+        mData.resize(offset + byteCount);
+        if (byteCount > 0)
+        {
+            std::memcpy(mData.data() + offset, bytes, byteCount);
+        }
+    }
+
+    std::vector<std::uint8_t> & mData;
+};
+
+/*
+ * Reads back a snapshot, in the same order in which it was written.
+ *
+ * Buffers are restored in place, and must have the same size as the buffers that
+ * were written; any mismatch is reported as a GameException.
+ */
+class SnapshotReader final
+{
+public:
+
+    explicit SnapshotReader(Snapshot const & snapshot)
+        : mData(snapshot.mData)
+        , mOffset(0)
+    {}
+
+    template<typename T>
+    void Read(T & value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        ReadBytes(&value, sizeof(T));
+    }
+
+    template<typename T>
+    T Read()
+    {
+        T value;
+        Read(value);
+        return value;
+    }
+
+    template<typename TElement>
+    void Read(Buffer<TElement> & buffer)
+    {
+        Read(buffer, buffer.GetSize());
+    }
+
+    /*
+     * Reads only the first elementCount elements of the buffer.
+     */
+    template<typename TElement>
+    void Read(
+        Buffer<TElement> & buffer,
+        size_t elementCount)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+        assert(elementCount <= buffer.GetSize());
+
+        size_t const snapshotElementCount = ReadHeader<TElement>();
+        if (snapshotElementCount != elementCount)
+        {
+            throw GameException("Snapshot buffer has " + std::to_string(snapshotElementCount) + " elements, while " + std::to_string(elementCount) + " were expected");
+        }
+
+        ReadBytes(buffer.data(), elementCount * sizeof(TElement));
+    }
+
+    template<typename TElement>
+    void Read(std::vector<TElement> & elements)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+
+        size_t const elementCount = ReadHeader<TElement>();
+        CheckAvailable(elementCount * sizeof(TElement));
+
+        elements.resize(elementCount);
+        ReadBytes(elements.data(), elementCount * sizeof(TElement));
+    }
+
+    template<typename TElement>
+    void Read(std::deque<TElement> & elements)
+    {
+        static_assert(std::is_trivially_copyable_v<TElement>);
+
+        size_t const elementCount = ReadHeader<TElement>();
+        CheckAvailable(elementCount * sizeof(TElement));
+
+        elements.clear();
+        for (size_t e = 0; e < elementCount; ++e)
+        {
+            // Elements need not be default-constructible
+            alignas(TElement) std::uint8_t elementBytes[sizeof(TElement)];
+            ReadBytes(elementBytes, sizeof(TElement));
+            elements.push_back(*reinterpret_cast<TElement const *>(elementBytes));
+        }
+    }
+
+    void Read(std::string & value)
+    {
+        size_t const elementCount = ReadHeader<char>();
+        CheckAvailable(elementCount);
+
+        value.assign(reinterpret_cast<char const *>(mData.data() + mOffset), elementCount);
+        mOffset += elementCount;
+    }
+
+    bool IsAtEnd() const
+    {
+        return mOffset == mData.size();
+    }
+
+private:
+
+    template<typename TElement>
+    size_t ReadHeader()
+    {
+        size_t const elementCount = static_cast<size_t>(Read<std::uint64_t>());
+        if (Read<std::uint32_t>() != sizeof(TElement))
+        {
+            throw GameException("Snapshot element size does not match; the snapshot was taken by a different build");
+        }
+
+        return elementCount;
+    }
+
+    void CheckAvailable(size_t byteCount) const
+    {
+        if (byteCount > mData.size() - mOffset)
+        {
+            throw GameException("Snapshot is truncated");
+        }
+    }
+
+    void ReadBytes(void * bytes, size_t byteCount)
+    {
+        CheckAvailable(byteCount);
+
+        if (byteCount > 0)
+        {
+            std::memcpy(bytes, mData.data() + mOffset, byteCount);
+            mOffset += byteCount;
+        }
+    }
+
+    std::vector<std::uint8_t> const & mData;
+    size_t mOffset;
+};
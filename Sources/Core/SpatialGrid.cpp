@@ -0,0 +1,104 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "SpatialGrid.h"
+
+#include "AABB.h"
+
+void SpatialGrid::Rebuild(
+    vec2f const * positions,
+    ElementIndex startIndex,
+    ElementIndex endIndex)
+{
+    assert(startIndex <= endIndex);
+
+    mElementIndices.clear();
+
+    size_t const elementCount = static_cast<size_t>(endIndex - startIndex);
+    if (elementCount == 0)
+    {
+        mWidth = 0;
+        mHeight = 0;
+        mCellStarts.clear();
+        return;
+    }
+
+    //
+    // Calculate extent
+    //
+
+    Geometry::AABB aabb;
+    for (ElementIndex e = startIndex; e < endIndex; ++e)
+    {
+        aabb.ExtendTo(positions[e]);
+    }
+
+    if (aabb.BottomLeft.x > aabb.TopRight.x || aabb.BottomLeft.y > aabb.TopRight.y)
+    {
+        // All positions are non-numbers; all elements end up in the one cell
+        aabb = Geometry::AABB(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+
+    //
+    // Choose cell size - growing it when elements are sparse, so that
+    // the number of cells stays proportional to the number of elements
+    //
+
+    mCellSize = mNominalCellSize;
+
+    size_t const maxCellCount = elementCount * mMaxCellsPerElement;
+    while (true)
+    {
+        mWidth = static_cast<size_t>(aabb.GetWidth() / mCellSize) + 1;
+        mHeight = static_cast<size_t>(aabb.GetHeight() / mCellSize) + 1;
+        if (mWidth * mHeight <= maxCellCount)
+            break;
+
+        mCellSize *= 2.0f;
+    }
+
+    mCellSizeReciprocal = 1.0f / mCellSize;
+    mOrigin = aabb.BottomLeft;
+
+    //
+    // Counting sort of elements by cell
+    //
+
+    size_t const cellCount = mWidth * mHeight;
+
+    mCellStarts.assign(cellCount + 1, 0);
+    mElementCellIndices.resize(elementCount);
+
+    for (ElementIndex e = startIndex; e < endIndex; ++e)
+    {
+        ElementIndex const cellIndex = static_cast<ElementIndex>(
+            static_cast<size_t>(ToCellY(positions[e].y)) * mWidth
+            + static_cast<size_t>(ToCellX(positions[e].x)));
+
+        mElementCellIndices[e - startIndex] = cellIndex;
+        ++mCellStarts[cellIndex + 1];
+    }
+
+    for (size_t c = 1; c <= cellCount; ++c)
+    {
+        mCellStarts[c] += mCellStarts[c - 1];
+    }
+
+    // Fill in, using the starts of the next cells as cursors, then
+    // shift them back; visiting elements in order keeps each cell sorted
+    mElementIndices.resize(elementCount);
+    for (ElementIndex e = startIndex; e < endIndex; ++e)
+    {
+        ElementIndex const cellIndex = mElementCellIndices[e - startIndex];
+        mElementIndices[mCellStarts[cellIndex]++] = e;
+    }
+
+    for (size_t c = cellCount; c > 0; --c)
+    {
+        mCellStarts[c] = mCellStarts[c - 1];
+    }
+
+    mCellStarts[0] = 0;
+}
@@ -0,0 +1,221 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/*
+ * A uniform grid over a set of element positions, for answering spatial queries
+ * in time proportional to the queried area rather than to the number of elements.
+ *
+ * The grid is a snapshot: it is rebuilt in its entirety from the positions, and
+ * it does not follow the elements when they move afterwards.
+ *
+ * Queries are conservative - they visit all the elements in the cells overlapping
+ * the queried area - and it is up to the caller to do the exact test on each
+ * visited element. Within a cell, elements are visited in increasing index order.
+ */
+class SpatialGrid final
+{
+public:
+
+    SpatialGrid(
+        float cellSize,
+        size_t maxCellsPerElement)
+        : mNominalCellSize(cellSize)
+        , mMaxCellsPerElement(maxCellsPerElement)
+        , mCellSize(cellSize)
+        , mCellSizeReciprocal(1.0f / cellSize)
+        , mOrigin(vec2f::zero())
+        , mWidth(0)
+        , mHeight(0)
+        , mCellStarts()
+        , mElementIndices()
+        , mElementCellIndices()
+    {
+        assert(cellSize > 0.0f);
+        assert(maxCellsPerElement > 0);
+    }
+
+    bool IsEmpty() const
+    {
+        return mElementIndices.empty();
+    }
+
+    /*
+     * Rebuilds the grid with the elements in the [startIndex, endIndex) range.
+     */
+    void Rebuild(
+        vec2f const * positions,
+        ElementIndex startIndex,
+        ElementIndex endIndex);
+
+    /*
+     * Visits all the elements in the cells overlapping the specified circle.
+     */
+    template<typename TVisitor>
+    void VisitInRadius(
+        vec2f const & center,
+        float radius,
+        TVisitor && visitor) const
+    {
+        VisitInRectangle(
+            center - vec2f(radius, radius),
+            center + vec2f(radius, radius),
+            std::forward<TVisitor>(visitor));
+    }
+
+    /*
+     * Visits all the elements in the cells overlapping the specified segment,
+     * thickened by the specified radius.
+     */
+    template<typename TVisitor>
+    void VisitAlongSegment(
+        vec2f const & startPos,
+        vec2f const & endPos,
+        float radius,
+        TVisitor && visitor) const
+    {
+        if (mElementIndices.empty())
+            return;
+
+        // Walk the segment by rows, visiting for each row the span of cells that
+        // the thickened segment covers within that row's vertical extent
+
+        float const minY = std::min(startPos.y, endPos.y) - radius;
+        float const maxY = std::max(startPos.y, endPos.y) + radius;
+
+        int const startRow = ToCellY(minY);
+        int const endRow = ToCellY(maxY);
+
+        vec2f const dir = endPos - startPos;
+
+        for (int row = startRow; row <= endRow; ++row)
+        {
+            // Vertical extent of this row, restricted to the thickened segment's
+            float const rowBottom = std::max(mOrigin.y + static_cast<float>(row) * mCellSize, minY);
+            float const rowTop = std::min(mOrigin.y + static_cast<float>(row + 1) * mCellSize, maxY);
+
+            // Horizontal extent of the segment within the row's (thickened) vertical extent
+            float segMinX;
+            float segMaxX;
+            if (std::abs(dir.y) < 0.0001f)
+            {
+                segMinX = std::min(startPos.x, endPos.x);
+                segMaxX = std::max(startPos.x, endPos.x);
+            }
+            else
+            {
+                float const t1 = std::clamp((rowBottom - radius - startPos.y) / dir.y, 0.0f, 1.0f);
+                float const t2 = std::clamp((rowTop + radius - startPos.y) / dir.y, 0.0f, 1.0f);
+                float const x1 = startPos.x + dir.x * t1;
+                float const x2 = startPos.x + dir.x * t2;
+                segMinX = std::min(x1, x2);
+                segMaxX = std::max(x1, x2);
+            }
+
+            VisitCells(
+                ToCellX(segMinX - radius),
+                ToCellX(segMaxX + radius),
+                row,
+                row,
+                visitor);
+        }
+    }
+
+    /*
+     * Visits all the elements in the cells overlapping the specified rectangle.
+     */
+    template<typename TVisitor>
+    void VisitInRectangle(
+        vec2f const & bottomLeft,
+        vec2f const & topRight,
+        TVisitor && visitor) const
+    {
+        if (mElementIndices.empty())
+            return;
+
+        VisitCells(
+            ToCellX(bottomLeft.x),
+            ToCellX(topRight.x),
+            ToCellY(bottomLeft.y),
+            ToCellY(topRight.y),
+            visitor);
+    }
+
+private:
+
+    template<typename TVisitor>
+    void VisitCells(
+        int cellX1,
+        int cellX2,
+        int cellY1,
+        int cellY2,
+        TVisitor & visitor) const
+    {
+        for (int y = cellY1; y <= cellY2; ++y)
+        {
+            size_t const rowStart = static_cast<size_t>(y) * mWidth;
+            for (int x = cellX1; x <= cellX2; ++x)
+            {
+                size_t const cellIndex = rowStart + static_cast<size_t>(x);
+                for (ElementIndex i = mCellStarts[cellIndex]; i < mCellStarts[cellIndex + 1]; ++i)
+                {
+                    visitor(mElementIndices[i]);
+                }
+            }
+        }
+    }
+
+    inline int ToCellX(float x) const
+    {
+        // Note: std::max(0, NaN) == 0
+        return static_cast<int>(
+            std::min(
+                std::max(0.0f, (x - mOrigin.x) * mCellSizeReciprocal),
+                static_cast<float>(mWidth - 1)));
+    }
+
+    inline int ToCellY(float y) const
+    {
+        // Note: std::max(0, NaN) == 0
+        return static_cast<int>(
+            std::min(
+                std::max(0.0f, (y - mOrigin.y) * mCellSizeReciprocal),
+                static_cast<float>(mHeight - 1)));
+    }
+
+private:
+
+    float const mNominalCellSize;
+    size_t const mMaxCellsPerElement;
+
+    // The cell size we're currently using, which is larger than
+    // the nominal one when the elements are sparse
+    float mCellSize;
+    float mCellSizeReciprocal;
+
+    vec2f mOrigin; // Bottom-left
+    size_t mWidth;
+    size_t mHeight;
+
+    // Start offset of each cell's elements in mElementIndices, with one
+    // extra entry at the end
+    std::vector<ElementIndex> mCellStarts;
+
+    // Element indices sorted by cell
+    std::vector<ElementIndex> mElementIndices;
+
+    // Scratch: the cell of each element, during a rebuild
+    std::vector<ElementIndex> mElementCellIndices;
+};
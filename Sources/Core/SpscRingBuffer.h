@@ -0,0 +1,108 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4324) // We get padded because of the alignment of the indices
+#endif
+
+/*
+ * A fixed-capacity, lock-free ring of elements, for exactly one producer
+ * thread and one consumer thread.
+ *
+ * Elements are plain data, copied in and out of preallocated storage; the
+ * ring never allocates after construction.
+ */
+template<typename TElement, size_t Capacity>
+class SpscRingBuffer final
+{
+    static_assert(std::is_trivially_copyable_v<TElement>);
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+
+    SpscRingBuffer()
+        : mHead(0)
+        , mTail(0)
+        , mElements()
+    {}
+
+    SpscRingBuffer(SpscRingBuffer const &) = delete;
+    SpscRingBuffer & operator=(SpscRingBuffer const &) = delete;
+
+    static constexpr size_t GetCapacity()
+    {
+        return Capacity;
+    }
+
+    /*
+     * Invoked by the producer; returns false if the ring is full.
+     */
+    bool TryPush(TElement const & element)
+    {
+        size_t const tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mHead.load(std::memory_order_acquire) == Capacity)
+        {
+            // Full
+            return false;
+        }
+
+        mElements[tail & (Capacity - 1)] = element;
+
+        // Publish element
+        mTail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /*
+     * Invoked by the consumer; returns false if the ring is empty.
+     */
+    bool TryPop(TElement & element)
+    {
+        size_t const head = mHead.load(std::memory_order_relaxed);
+        if (head == mTail.load(std::memory_order_acquire))
+        {
+            // Empty
+            return false;
+        }
+
+        element = mElements[head & (Capacity - 1)];
+
+        // Release slot
+        mHead.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /*
+     * Only exact when invoked while neither side is operating.
+     */
+    bool IsEmpty() const
+    {
+        return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+    }
+
+private:
+
+    // Head and tail grow indefinitely, and wrap around naturally; each on its own
+    // cache line, as each is written by a different thread
+    alignas(64) std::atomic<size_t> mHead; // Written by consumer
+    alignas(64) std::atomic<size_t> mTail; // Written by producer
+
+    alignas(64) std::array<TElement, Capacity> mElements;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
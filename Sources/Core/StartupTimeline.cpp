@@ -0,0 +1,114 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "StartupTimeline.h"
+
+#include "Log.h"
+#include "PerfTrace.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace /* anonymous */ {
+
+    float ToMilliseconds(GameChronometer::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+}
+
+StartupTimeline::StartupTimeline()
+    : mOriginTime(GameChronometer::Now())
+    , mLock()
+    , mStages()
+    , mThreadIds()
+{
+}
+
+void StartupTimeline::RecordStage(
+    char const * name,
+    GameChronometer::time_point startTime,
+    GameChronometer::time_point endTime)
+{
+    std::lock_guard const lock{ mLock };
+
+    mStages.emplace_back(
+        name,
+        GetThisThreadOrdinal(),
+        startTime - mOriginTime,
+        endTime - startTime);
+}
+
+std::vector<StartupTimeline::Stage> StartupTimeline::GetStages() const
+{
+    std::vector<Stage> stages;
+
+    {
+        std::lock_guard const lock{ mLock };
+
+        stages = mStages;
+    }
+
+    std::stable_sort(
+        stages.begin(),
+        stages.end(),
+        [](Stage const & lhs, Stage const & rhs)
+        {
+            return lhs.StartOffset < rhs.StartOffset;
+        });
+
+    return stages;
+}
+
+void StartupTimeline::LogAndClear()
+{
+    auto const stages = GetStages();
+
+    GameChronometer::duration end = GameChronometer::duration::zero();
+    GameChronometer::duration busy = GameChronometer::duration::zero();
+
+    LogMessage("Startup timeline (thread, start ms, duration ms, stage):");
+
+    for (auto const & stage : stages)
+    {
+        LogMessage("  ", stage.ThreadOrdinal, "  ", ToMilliseconds(stage.StartOffset), "  ", ToMilliseconds(stage.Duration), "  ", stage.Name);
+
+        end = std::max(end, stage.StartOffset + stage.Duration);
+        busy += stage.Duration;
+    }
+
+    // Note: nested stages count more than once in the total
+    LogMessage("Startup timeline: ", stages.size(), " stages ending at ", ToMilliseconds(end), "ms, ", ToMilliseconds(busy), "ms of stages in total");
+
+    std::lock_guard const lock{ mLock };
+
+    mStages.clear();
+}
+
+size_t StartupTimeline::GetThisThreadOrdinal()
+{
+    // Note: invoked under lock
+
+    auto const thisThreadId = std::this_thread::get_id();
+
+    auto const it = std::find(mThreadIds.cbegin(), mThreadIds.cend(), thisThreadId);
+    if (it != mThreadIds.cend())
+    {
+        return static_cast<size_t>(std::distance(mThreadIds.cbegin(), it));
+    }
+
+    mThreadIds.push_back(thisThreadId);
+
+    return mThreadIds.size() - 1;
+}
+
+ScopedStartupStage::~ScopedStartupStage()
+{
+    auto const endTime = GameChronometer::Now();
+
+    mTimeline.RecordStage(mName, mStartTime, endTime);
+
+    PerfTrace::GetInstance().RecordEvent(mName, mStartTime, endTime);
+}
@@ -0,0 +1,115 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Records the stages of the game's startup - when each starts, how long it takes, and
+ * on which thread it runs - so that the whole startup may be logged as a timeline once
+ * it's over.
+ *
+ * Stages may be recorded concurrently by any thread.
+ */
+class StartupTimeline final
+{
+public:
+
+    struct Stage
+    {
+        char const * Name;
+        size_t ThreadOrdinal; // 0 for the first thread that recorded a stage, 1 for the next one, etc.
+        GameChronometer::duration StartOffset; // From the timeline's origin
+        GameChronometer::duration Duration;
+
+        Stage(
+            char const * name,
+            size_t threadOrdinal,
+            GameChronometer::duration startOffset,
+            GameChronometer::duration duration)
+            : Name(name)
+            , ThreadOrdinal(threadOrdinal)
+            , StartOffset(startOffset)
+            , Duration(duration)
+        {}
+    };
+
+    static StartupTimeline & GetInstance()
+    {
+        static StartupTimeline * instance = new StartupTimeline();
+
+        return *instance;
+    }
+
+    StartupTimeline();
+
+    /*
+     * The name is expected to outlive the timeline, e.g. to be a literal.
+     */
+    void RecordStage(
+        char const * name,
+        GameChronometer::time_point startTime,
+        GameChronometer::time_point endTime);
+
+    /*
+     * The stages recorded so far, sorted by start time.
+     */
+    std::vector<Stage> GetStages() const;
+
+    /*
+     * Logs the stages recorded so far, and forgets them.
+     */
+    void LogAndClear();
+
+private:
+
+    size_t GetThisThreadOrdinal();
+
+private:
+
+    GameChronometer::time_point const mOriginTime;
+
+    mutable std::mutex mLock;
+    std::vector<Stage> mStages;
+    std::vector<std::thread::id> mThreadIds; // By ordinal
+};
+
+/*
+ * Records a startup stage for a scope, also as a trace event when a
+ * trace is being recorded.
+ */
+class ScopedStartupStage final
+{
+public:
+
+    explicit ScopedStartupStage(char const * name)
+        : ScopedStartupStage(name, StartupTimeline::GetInstance())
+    {}
+
+    ScopedStartupStage(
+        char const * name,
+        StartupTimeline & timeline)
+        : mName(name)
+        , mTimeline(timeline)
+        , mStartTime(GameChronometer::Now())
+    {}
+
+    ~ScopedStartupStage();
+
+    ScopedStartupStage(ScopedStartupStage const &) = delete;
+    ScopedStartupStage & operator=(ScopedStartupStage const &) = delete;
+
+private:
+
+    char const * const mName;
+    StartupTimeline & mTimeline;
+    GameChronometer::time_point const mStartTime;
+};
@@ -27,6 +27,16 @@ public:
 	virtual size_t Read(std::uint8_t * buffer, size_t size) = 0;
 
 	virtual size_t Skip(size_t size) = 0;
+
+	/*
+	 * For streams whose content is in memory: returns a pointer to the next size bytes
+	 * and advances by that much. Returns nullptr - without advancing - when the stream
+	 * cannot lend its content, or when fewer than size bytes are left.
+	 */
+	virtual std::uint8_t const * ReadInPlace(size_t /*size*/)
+	{
+		return nullptr;
+	}
 };
 
 /*
@@ -65,4 +75,12 @@ public:
 	virtual ~TextWriteStream() = default;
 
 	virtual void Write(std::string const & content) = 0;
+
+	/*
+	 * Makes all content written so far visible to readers of the stream.
+	 */
+	virtual void Flush()
+	{
+		// Default-implemented
+	}
 };
\ No newline at end of file
@@ -5,6 +5,10 @@
 ***************************************************************************************/
 #include "SysSpecifics.h"
 
+#if (FS_IS_ARCHITECTURE_X86_64() || FS_IS_ARCHITECTURE_X86_32()) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #if FS_IS_ARCHITECTURE_ARM_32()
 #pragma message ("ARCHITECTURE:FS_ARCHITECTURE_ARM_32")
 #elif FS_IS_ARCHITECTURE_ARM_64()
@@ -39,4 +43,47 @@
 
 #define STR1(x) #x
 #define STR(x) STR1(x)
-#pragma message ("ARM NEON:" STR(FS_IS_ARM_NEON()))
\ No newline at end of file
+#pragma message ("ARM NEON:" STR(FS_IS_ARM_NEON()))
+
+#if FS_IS_ARCHITECTURE_X86_64() || FS_IS_ARCHITECTURE_X86_32()
+
+bool DetectAVX2FMASupport() noexcept
+{
+#ifdef _MSC_VER
+
+    int registers[4];
+
+    __cpuid(registers, 0);
+    if (registers[0] < 7)
+    {
+        // No extended features leaf
+        return false;
+    }
+
+    __cpuid(registers, 1);
+    bool const hasFma = (registers[2] & (1 << 12)) != 0;
+    bool const hasOsXSave = (registers[2] & (1 << 27)) != 0;
+    bool const hasAvx = (registers[2] & (1 << 28)) != 0;
+    if (!hasFma || !hasOsXSave || !hasAvx)
+    {
+        return false;
+    }
+
+    // Make sure the OS saves the YMM registers
+    if ((_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+
+#else
+
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+
+#endif
+}
+
+#endif
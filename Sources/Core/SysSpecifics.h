@@ -180,10 +180,38 @@ inline constexpr T ceil_square_power_of_two(T value)
 #include <pmmintrin.h>
 */
 #include <pmmintrin.h>
+#include <immintrin.h> // Only usable in functions marked with FS_TARGET_AVX2_FMA
 #elif (FS_IS_ARCHITECTURE_ARM_32() || FS_IS_ARCHITECTURE_ARM_64()) && FS_IS_ARM_NEON()
 #include <arm_neon.h>
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////
+// Runtime CPU features
+////////////////////////////////////////////////////////////////////////////////////////
+
+#if FS_IS_ARCHITECTURE_X86_64() || FS_IS_ARCHITECTURE_X86_32()
+
+// Marks functions that use AVX2 and FMA intrinsics, while the rest of the binary
+// sticks to SSE; such functions may only be invoked when IsAVX2FMASupported()
+#ifdef _MSC_VER
+#define FS_TARGET_AVX2_FMA
+#else
+#define FS_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#endif
+
+bool DetectAVX2FMASupport() noexcept;
+
+/*
+ * Checks whether the CPU - and the OS - support AVX2 and FMA; detection runs once.
+ */
+inline bool IsAVX2FMASupported() noexcept
+{
+    static bool const isSupported = DetectAVX2FMASupport();
+    return isSupported;
+}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////
 // Alignment
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -204,6 +232,16 @@ static constexpr T vectorization_float_count = 4 * 4; // We want to use the 4x4
 template <typename T>
 static constexpr T vectorization_byte_count = vectorization_float_count<T> * sizeof(float);
 
+// The size of a cache line on all the architectures we care about
+template <typename T>
+static constexpr T cache_line_byte_count = 64;
+
+// The number of floats in a cache line; a multiple of the vectorization word size
+template <typename T>
+static constexpr T cache_line_float_count = cache_line_byte_count<T> / sizeof(float);
+
+static_assert((cache_line_float_count<size_t> % vectorization_float_count<size_t>) == 0);
+
 #ifdef _MSC_VER
 # define FS_ALIGN16_BEG __declspec(align(vectorization_byte_count<int>))
 # define FS_ALIGN16_END
@@ -17,7 +17,14 @@ TaskThread::TaskThread(
     bool isMultithreaded,
     ThreadManager & threadManager)
     : mHasThread(isMultithreaded)
+    , mTaskQueue()
+    , mLastQueuedSequenceNumber(0)
+    , mLastCompletedSequenceNumber(0)
     , mIsStop(false)
+    , mIsMainThreadParked(false)
+    , mIsTaskThreadParked(false)
+    , mTaskExceptionMessages()
+    , mTaskExceptionMessagesCount(0)
 {
     if (mHasThread)
     {
@@ -44,10 +51,10 @@ TaskThread::~TaskThread()
 
         // Notify stop
         {
-            std::unique_lock const lock{ mThreadLock };
+            std::lock_guard<std::mutex> const lock(mParkLock);
 
-            mIsStop = true;
-            mThreadSignal.notify_one();
+            mIsStop.store(true);
+            mParkSignal.notify_one();
         }
 
         LogMessage("TaskThread::~TaskThread(): signaled stop; waiting for thread now...");
@@ -56,6 +63,8 @@ TaskThread::~TaskThread()
         mThread.join();
 
         LogMessage("TaskThread::~TaskThread(): ...thread stopped.");
+
+        // Tasks that were still in the queue are destroyed with the queue
     }
 }
 
@@ -79,70 +88,99 @@ void TaskThread::ThreadLoop(
 
     while (true)
     {
+        // We're the only writer of this
+        std::uint64_t const sequenceNumber = mLastCompletedSequenceNumber.load(std::memory_order_relaxed) + 1;
+
         //
-        // Extract task
+        // Wait for task
         //
 
-        QueuedTask queuedTask;
-
-        {
-            std::unique_lock<std::mutex> lock(mThreadLock);
-
-            // Wait for signal
-            mThreadSignal.wait(
-                lock,
-                [this]
-                {
-                    return mIsStop || !mTaskQueue.empty();
-                });
-
-            if (mIsStop)
-            {
-                // We're done!
-                break;
-            }
-            else
+        SpinThenPark(
+            mIsTaskThreadParked,
+            [this, sequenceNumber]()
             {
-                //
-                // Deque task
-                //
-
-                assert(!mTaskQueue.empty());
+                return mIsStop.load() || mLastQueuedSequenceNumber.load() >= sequenceNumber;
+            });
 
-                queuedTask = std::move(mTaskQueue.front());
-                mTaskQueue.pop_front();
-            }
+        if (mIsStop.load())
+        {
+            // We're done!
+            break;
         }
 
         //
         // Run task
         //
 
-        assert(!!queuedTask.TaskToRun);
+        QueuedTask & queuedTask = mTaskQueue[sequenceNumber % QueueCapacity];
 
         try
         {
-            queuedTask.TaskToRun();
+            queuedTask.Run();
         }
         catch (std::runtime_error const & exc)
         {
-            // Store in task completion indicator
-            // (safe to do without locks, as it will only be read by
-            // main thread after it is signaled)
-            queuedTask.CompletionIndicator->RegisterException(exc.what());
+            // Store for the main thread, which will only look for it after it
+            // sees the task completed
+            RegisterException(sequenceNumber, exc.what());
         }
 
+        // Free the slot before handing it back
+        queuedTask.Destroy();
+
         //
         // Signal task completion
         //
 
+        mLastCompletedSequenceNumber.store(sequenceNumber);
+
+        Unpark(mIsMainThreadParked);
+    }
+
+    LogMessage("TaskThread::ThreadLoop(): exiting");
+}
+
+void TaskThread::WaitForCompletion(std::uint64_t sequenceNumber)
+{
+    if (mLastCompletedSequenceNumber.load() < sequenceNumber)
+    {
+        SpinThenPark(
+            mIsMainThreadParked,
+            [this, sequenceNumber]()
+            {
+                return mLastCompletedSequenceNumber.load() >= sequenceNumber;
+            });
+    }
+
+    // Check if an exception was thrown
+    if (mTaskExceptionMessagesCount.load() > 0)
+    {
+        std::string exceptionMessage;
+
         {
-            std::unique_lock const lock{ mThreadLock };
+            std::lock_guard<std::mutex> const lock(mTaskExceptionMessagesLock);
 
-            queuedTask.CompletionIndicator->MarkCompleted();
-            mThreadSignal.notify_one();
+            auto it = mTaskExceptionMessages.find(sequenceNumber);
+            if (it == mTaskExceptionMessages.end())
+            {
+                return;
+            }
+
+            exceptionMessage = std::move(it->second);
+            mTaskExceptionMessages.erase(it);
+            mTaskExceptionMessagesCount.store(mTaskExceptionMessages.size());
         }
+
+        throw std::runtime_error(exceptionMessage);
     }
+}
 
-    LogMessage("TaskThread::ThreadLoop(): exiting");
-}
\ No newline at end of file
+void TaskThread::RegisterException(
+    std::uint64_t sequenceNumber,
+    std::string const & exceptionMessage)
+{
+    std::lock_guard<std::mutex> const lock(mTaskExceptionMessagesLock);
+
+    mTaskExceptionMessages[sequenceNumber] = exceptionMessage;
+    mTaskExceptionMessagesCount.store(mTaskExceptionMessages.size());
+}
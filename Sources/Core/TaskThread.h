@@ -7,14 +7,20 @@
 
 #include "ThreadManager.h"
 
+#include <array>
+#include <atomic>
+#include <cassert>
 #include <condition_variable>
-#include <deque>
-#include <functional>
-#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <mutex>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <utility>
 
 /*
  * A thread that serially runs tasks provided by the main thread. The user
@@ -25,83 +31,81 @@
  * class (the main thread), and that thread is responsible for the lifetime
  * of this class (cctor and dctor).
  *
+ * Tasks are queued into a bounded, lock-free, single-producer single-consumer
+ * ring, storing small tasks in-place; tasks are numbered by the order in which they
+ * are queued, and their completion is signalled by publishing the sequence number
+ * of the last task completed. Neither queueing nor completion takes a lock, except
+ * for waking up a thread that has parked after spinning in vain.
  */
 class TaskThread
 {
 public:
 
-    using Task = std::function<void()>;
-
     // Note: instances of this class are owned by the main thread, which is
     // also responsible for invoking the destructor of TaskThread, hence if
     // we assume there won't be any Wait() calls after TaskThread has been destroyed,
-    // then there's no need for instances of _TaskCompletionIndicatorImpl to
+    // then there's no need for instances of TaskCompletionIndicator to
     // outlive the TaskThread instance that generated them.
-    struct _TaskCompletionIndicatorImpl
+    class TaskCompletionIndicator
     {
     public:
 
+        TaskCompletionIndicator()
+            : mTaskThread(nullptr)
+            , mSequenceNumber(0)
+        {}
+
         /*
          * Invoked by main thread to wait until the task is completed.
          *
-         * Throws an exception if the task threw an exception.
+         * Throws an exception if the task threw an exception; the exception
+         * is thrown by the first Wait() only.
          */
-        void Wait()
+        void Wait() const
         {
-            if (!mIsTaskCompleted)
-            {
-                std::unique_lock<std::mutex> lock(mThreadLock);
+            assert(mTaskThread != nullptr);
 
-                // Wait for task completion
-                mThreadSignal.wait(
-                    lock,
-                    [this]
-                    {
-                        return mIsTaskCompleted;
-                    });
-            }
-
-            // Check if an exception was thrown
-            if (!mExceptionMessage.empty())
-            {
-                throw std::runtime_error(mExceptionMessage);
-            }
+            mTaskThread->WaitForCompletion(mSequenceNumber);
         }
 
-    private:
+        /*
+         * Invoked by main thread to check - without waiting - whether the task is completed;
+         * a subsequent Wait() then returns immediately.
+         */
+        bool IsCompleted() const
+        {
+            assert(mTaskThread != nullptr);
 
-        _TaskCompletionIndicatorImpl(
-            std::mutex & threadLock,
-            std::condition_variable & threadSignal)
-            : mIsTaskCompleted(false)
-            , mExceptionMessage()
-            , mThreadLock(threadLock)
-            , mThreadSignal(threadSignal)
-        {}
+            return mTaskThread->mLastCompletedSequenceNumber.load() >= mSequenceNumber;
+        }
 
-        void MarkCompleted()
+        explicit operator bool() const
         {
-            mIsTaskCompleted = true;
+            return mTaskThread != nullptr;
         }
 
-        void RegisterException(std::string const & exceptionMessage)
+        void reset()
         {
-            mExceptionMessage = exceptionMessage;
+            mTaskThread = nullptr;
         }
 
     private:
 
-        bool mIsTaskCompleted; // Flag set by task thread to signal completion of the task
-        std::string mExceptionMessage; // Set by task thread upon exception
+        TaskCompletionIndicator(
+            TaskThread & taskThread,
+            std::uint64_t sequenceNumber)
+            : mTaskThread(&taskThread)
+            , mSequenceNumber(sequenceNumber)
+        {}
+
+    private:
 
-        std::mutex & mThreadLock;
-        std::condition_variable & mThreadSignal;
+        TaskThread * mTaskThread;
+        std::uint64_t mSequenceNumber;
 
         friend class TaskThread;
     };
 
-    using TaskCompletionIndicator = std::shared_ptr<_TaskCompletionIndicatorImpl>;
-
 public:
 
     TaskThread(
@@ -121,13 +125,14 @@ public:
     /*
      * Invoked on the main thread to queue a task that will run
      * on the task thread.
+     *
+     * Waits for room in the queue if the queue is full.
      */
-    TaskCompletionIndicator QueueTask(Task && task)
+    template<typename TTask>
+    TaskCompletionIndicator QueueTask(TTask && task)
     {
-        auto taskCompletionIndicator = std::shared_ptr<_TaskCompletionIndicatorImpl>(
-            new _TaskCompletionIndicatorImpl(
-                mThreadLock,
-                mThreadSignal));
+        // We're the only writer of this
+        std::uint64_t const sequenceNumber = mLastQueuedSequenceNumber.load(std::memory_order_relaxed) + 1;
 
         if (mHasThread)
         {
@@ -135,13 +140,23 @@ public:
             // Queue task
             //
 
-            std::unique_lock<std::mutex> lock(mThreadLock);
+            // Wait for the task thread to be done with the slot's previous task
+            if (sequenceNumber > QueueCapacity)
+            {
+                SpinThenPark(
+                    mIsMainThreadParked,
+                    [this, sequenceNumber]()
+                    {
+                        return mLastCompletedSequenceNumber.load() >= sequenceNumber - QueueCapacity;
+                    });
+            }
 
-            mTaskQueue.emplace_back(
-                std::move(task),
-                taskCompletionIndicator);
+            mTaskQueue[sequenceNumber % QueueCapacity].Emplace(std::forward<TTask>(task));
 
-            mThreadSignal.notify_one();
+            // Publish
+            mLastQueuedSequenceNumber.store(sequenceNumber);
+
+            Unpark(mIsTaskThreadParked);
         }
         else
         {
@@ -155,24 +170,25 @@ public:
             }
             catch (std::runtime_error const & exc)
             {
-                // Store in task completion indicator
-                taskCompletionIndicator->RegisterException(exc.what());
+                RegisterException(sequenceNumber, exc.what());
             }
 
-            taskCompletionIndicator->MarkCompleted();
+            mLastQueuedSequenceNumber.store(sequenceNumber);
+            mLastCompletedSequenceNumber.store(sequenceNumber);
         }
 
-        return taskCompletionIndicator;
+        return TaskCompletionIndicator(*this, sequenceNumber);
     }
 
     /*
      * Invoked on the main thread to run a task on the task thread
      * and wait until it returns.
      */
-    void RunSynchronously(Task && task)
+    template<typename TTask>
+    void RunSynchronously(TTask && task)
     {
-        auto result = QueueTask(std::move(task));
-        result->Wait();
+        auto result = QueueTask(std::forward<TTask>(task));
+        result.Wait();
     }
 
     /*
@@ -192,36 +208,156 @@ private:
         size_t threadTaskIndex,
         ThreadManager * threadManager);
 
+    void WaitForCompletion(std::uint64_t sequenceNumber);
+
+    void RegisterException(
+        std::uint64_t sequenceNumber,
+        std::string const & exceptionMessage);
+
+    /*
+     * Spins for a while waiting for the predicate to become true, and then
+     * - if still false - blocks, flagging that we're parked so that the other
+     * thread knows it has to wake us up.
+     */
+    template<typename TPredicate>
+    void SpinThenPark(
+        std::atomic<bool> & isParked,
+        TPredicate const & predicate)
+    {
+        for (size_t s = 0; s < SpinIterations; ++s)
+        {
+            if (predicate())
+            {
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+
+        std::unique_lock<std::mutex> lock(mParkLock);
+
+        // Note: the order between this store and the predicate evaluation, and the order
+        // between the other thread's state store and its check of the flag, is what makes
+        // us not miss wake-ups
+        isParked.store(true);
+
+        mParkSignal.wait(lock, predicate);
+
+        isParked.store(false);
+    }
+
+    void Unpark(std::atomic<bool> const & isParked)
+    {
+        if (isParked.load())
+        {
+            std::lock_guard<std::mutex> const lock(mParkLock);
+            mParkSignal.notify_one();
+        }
+    }
+
 private:
 
-    struct QueuedTask
+    /*
+     * A type-erased task, stored in-place when it's small enough, and on the heap otherwise.
+     */
+    class QueuedTask final
     {
-        Task TaskToRun;
-        TaskCompletionIndicator CompletionIndicator;
+    public:
 
         QueuedTask()
-            : TaskToRun()
-            , CompletionIndicator()
+            : mRun(nullptr)
+            , mDestroy(nullptr)
+        {}
+
+        QueuedTask(QueuedTask const & other) = delete;
+        QueuedTask & operator=(QueuedTask const & other) = delete;
+
+        ~QueuedTask()
         {
+            Destroy();
         }
 
-        QueuedTask(
-            Task && taskToRun,
-            TaskCompletionIndicator completionIndicator)
-            : TaskToRun(std::move(taskToRun))
-            , CompletionIndicator(std::move(completionIndicator))
-        {}
+        template<typename TTask>
+        void Emplace(TTask && task)
+        {
+            using TaskType = std::decay_t<TTask>;
+
+            assert(mRun == nullptr);
+
+            if constexpr (sizeof(TaskType) <= InPlaceSize && alignof(TaskType) <= alignof(std::max_align_t))
+            {
+                new (mStorage) TaskType(std::forward<TTask>(task));
+
+                mRun = [](void * storage) { (*std::launder(reinterpret_cast<TaskType *>(storage)))(); };
+                mDestroy = [](void * storage) { std::launder(reinterpret_cast<TaskType *>(storage))->~TaskType(); };
+            }
+            else
+            {
+                // Too large, on the heap
+                new (mStorage) TaskType *(new TaskType(std::forward<TTask>(task)));
+
+                mRun = [](void * storage) { (**std::launder(reinterpret_cast<TaskType **>(storage)))(); };
+                mDestroy = [](void * storage) { delete *std::launder(reinterpret_cast<TaskType **>(storage)); };
+            }
+        }
+
+        void Run()
+        {
+            assert(mRun != nullptr);
+            mRun(mStorage);
+        }
+
+        void Destroy()
+        {
+            if (mDestroy != nullptr)
+            {
+                mDestroy(mStorage);
+
+                mRun = nullptr;
+                mDestroy = nullptr;
+            }
+        }
+
+    private:
+
+        // Enough for a task capturing a handful of pointers and values
+        static size_t constexpr InPlaceSize = 64;
+
+        alignas(std::max_align_t) unsigned char mStorage[InPlaceSize];
+
+        void (*mRun)(void *);
+        void (*mDestroy)(void *);
     };
 
+    // Comfortably more than the tasks queued in a frame
+    static size_t constexpr QueueCapacity = 64;
+
+    // The tasks we wait for normally take longer than a scheduling quantum,
+    // so no point in spinning much
+    static size_t constexpr SpinIterations = 64;
+
 private:
 
     std::thread mThread;
     bool const mHasThread; // Invariant: mHasThread==true <=> mThread.joinable(); we only use the flag as the perf impact of checking is_joinable() is unknown
 
-    std::mutex mThreadLock;
-    std::condition_variable mThreadSignal; // Just one, as each of {main thread, worker thread} can't be waiting and signaling at the same time
+    // The ring; task with sequence number N lives at N % QueueCapacity
+    std::array<QueuedTask, QueueCapacity> mTaskQueue;
+
+    // Sequence numbers start from 1; written, respectively, only by the main thread and only by the task thread
+    std::atomic<std::uint64_t> mLastQueuedSequenceNumber;
+    std::atomic<std::uint64_t> mLastCompletedSequenceNumber;
+
+    std::atomic<bool> mIsStop;
 
-    std::deque<QueuedTask> mTaskQueue;
+    // Parking
+    std::mutex mParkLock;
+    std::condition_variable mParkSignal; // Just one, as each of {main thread, worker thread} can't be parked at the same time
+    std::atomic<bool> mIsMainThreadParked;
+    std::atomic<bool> mIsTaskThreadParked;
 
-    bool mIsStop;
-};
\ No newline at end of file
+    // Exceptions thrown by tasks, by sequence number; rare enough to be guarded by a lock
+    std::map<std::uint64_t, std::string> mTaskExceptionMessages;
+    std::atomic<size_t> mTaskExceptionMessagesCount;
+    std::mutex mTaskExceptionMessagesLock;
+};
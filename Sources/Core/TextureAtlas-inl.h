@@ -11,8 +11,11 @@
 #include "SysSpecifics.h"
 #include "Utils.h"
 
+#include <chrono>
 #include <cmath>
 #include <cstring>
+#include <fstream>
+#include <system_error>
 
 template <typename TTextureDatabase>
 TextureAtlasMetadata<TTextureDatabase>::TextureAtlasMetadata(
@@ -224,6 +227,204 @@ TextureAtlas<TTextureDatabase> TextureAtlas<TTextureDatabase>::Deserialize(IAsse
 // Builder
 ////////////////////////////////////////////////////////////////////////////////
 
+template<typename TTextureDatabase>
+TextureAtlas<TTextureDatabase> TextureAtlasBuilder<TTextureDatabase>::BuildCachedAtlas(
+    TextureDatabase<TTextureDatabase> const & database,
+    TextureAtlasOptions options,
+    float resizeFactor,
+    IAssetManager const & assetManager,
+    ThreadPool & threadPool,
+    std::optional<std::filesystem::path> const & cacheFolderPath,
+    SimpleProgressCallback const & progressCallback)
+{
+    if (!cacheFolderPath.has_value())
+    {
+        return BuildAtlas(database, options, resizeFactor, assetManager, threadPool, progressCallback);
+    }
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    std::filesystem::path const cacheFilePath = *cacheFolderPath / (TTextureDatabase::DatabaseName + ".atlas.cache");
+    std::uint64_t const cacheKey = CalculateCacheKey(database, options, resizeFactor, assetManager);
+
+    auto cachedAtlas = [&]() -> std::optional<TextureAtlas<TTextureDatabase>>
+        {
+            try
+            {
+                return TryLoadCachedAtlas(cacheFilePath, cacheKey);
+            }
+            catch (std::exception const & ex)
+            {
+                // We'll just build it again
+                LogMessage("TextureAtlasBuilder: error loading atlas cache \"", cacheFilePath.string(), "\": ", ex.what());
+                return std::nullopt;
+            }
+        }();
+
+    if (cachedAtlas.has_value())
+    {
+        LogMessage("TextureAtlasBuilder: loaded \"", TTextureDatabase::DatabaseName, "\" atlas from cache: time=",
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count(), "us");
+
+        progressCallback(1.0f);
+
+        return std::move(*cachedAtlas);
+    }
+
+    auto atlas = BuildAtlas(database, options, resizeFactor, assetManager, threadPool, progressCallback);
+
+    SaveCachedAtlas(atlas, cacheFilePath, cacheKey);
+
+    return atlas;
+}
+
+template<typename TTextureDatabase>
+std::uint64_t TextureAtlasBuilder<TTextureDatabase>::CalculateCacheKey(
+    TextureDatabase<TTextureDatabase> const & database,
+    TextureAtlasOptions options,
+    float resizeFactor,
+    IAssetManager const & assetManager)
+{
+    // FNV-1a, which - unlike std::hash - is stable across runs and builds
+
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto const hashBytes = [&hash](void const * data, size_t size)
+        {
+            for (size_t b = 0; b < size; ++b)
+            {
+                hash ^= static_cast<std::uint8_t const *>(data)[b];
+                hash *= 0x100000001b3ull;
+            }
+        };
+
+    auto const hashString = [&](std::string const & str)
+        {
+            hashBytes(str.data(), str.size());
+
+            // Separator
+            hash ^= 0xffu;
+            hash *= 0x100000001b3ull;
+        };
+
+    hashString(TTextureDatabase::DatabaseName);
+
+    std::uint32_t const optionsValue = static_cast<std::uint32_t>(options);
+    hashBytes(&optionsValue, sizeof(optionsValue));
+    hashBytes(&resizeFactor, sizeof(resizeFactor));
+
+    for (auto const & group : database.GetGroups())
+    {
+        for (auto const & frameSpecification : group.GetFrameSpecifications())
+        {
+            hashString(frameSpecification.RelativePath);
+
+            picojson::object frameMetadataJson;
+            frameSpecification.Metadata.Serialize(frameMetadataJson);
+            hashString(picojson::value(frameMetadataJson).serialize());
+
+            std::uint64_t const frameStamp = assetManager.GetTextureDatabaseFrameStamp(
+                TTextureDatabase::DatabaseName,
+                frameSpecification.RelativePath);
+            hashBytes(&frameStamp, sizeof(frameStamp));
+        }
+    }
+
+    return hash;
+}
+
+template<typename TTextureDatabase>
+std::optional<TextureAtlas<TTextureDatabase>> TextureAtlasBuilder<TTextureDatabase>::TryLoadCachedAtlas(
+    std::filesystem::path const & cacheFilePath,
+    std::uint64_t cacheKey)
+{
+    //
+    // File layout: key, specification length, atlas width, atlas height, specification json, atlas pixels
+    //
+
+    std::ifstream file(cacheFilePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        // Not cached yet
+        return std::nullopt;
+    }
+
+    std::uint64_t key;
+    std::uint32_t specificationLength;
+    std::uint32_t atlasWidth;
+    std::uint32_t atlasHeight;
+    file.read(reinterpret_cast<char *>(&key), sizeof(key));
+    file.read(reinterpret_cast<char *>(&specificationLength), sizeof(specificationLength));
+    file.read(reinterpret_cast<char *>(&atlasWidth), sizeof(atlasWidth));
+    file.read(reinterpret_cast<char *>(&atlasHeight), sizeof(atlasHeight));
+    if (!file || key != cacheKey)
+    {
+        // Stale
+        LogMessage("TextureAtlasBuilder: atlas cache \"", cacheFilePath.string(), "\" is stale");
+        return std::nullopt;
+    }
+
+    std::string specificationJsonString(specificationLength, '\0');
+    file.read(specificationJsonString.data(), specificationLength);
+
+    RgbaImageData atlasImage(ImageSize(static_cast<int>(atlasWidth), static_cast<int>(atlasHeight)));
+    file.read(reinterpret_cast<char *>(atlasImage.Data.get()), atlasImage.GetByteSize());
+
+    if (!file)
+    {
+        // Truncated
+        return std::nullopt;
+    }
+
+    picojson::value specificationJsonValue;
+    std::string const parseError = picojson::parse(specificationJsonValue, specificationJsonString);
+    if (!parseError.empty() || !specificationJsonValue.is<picojson::object>())
+    {
+        return std::nullopt;
+    }
+
+    auto metadata = TextureAtlasMetadata<TTextureDatabase>::Deserialize(specificationJsonValue.get<picojson::object>());
+    if (metadata.GetSize() != atlasImage.Size)
+    {
+        return std::nullopt;
+    }
+
+    return TextureAtlas<TTextureDatabase>(
+        std::move(metadata),
+        std::move(atlasImage));
+}
+
+template<typename TTextureDatabase>
+void TextureAtlasBuilder<TTextureDatabase>::SaveCachedAtlas(
+    TextureAtlas<TTextureDatabase> const & atlas,
+    std::filesystem::path const & cacheFilePath,
+    std::uint64_t cacheKey)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cacheFilePath.parent_path(), ec);
+
+    std::ofstream file(cacheFilePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        // Not a problem, we'll just build it again next time
+        LogMessage("TextureAtlasBuilder: cannot write atlas cache \"", cacheFilePath.string(), "\"");
+        return;
+    }
+
+    auto const [specificationJson, atlasImage] = atlas.Serialize();
+    std::string const specificationJsonString = specificationJson.serialize();
+
+    std::uint32_t const specificationLength = static_cast<std::uint32_t>(specificationJsonString.size());
+    std::uint32_t const atlasWidth = static_cast<std::uint32_t>(atlasImage.Size.width);
+    std::uint32_t const atlasHeight = static_cast<std::uint32_t>(atlasImage.Size.height);
+    file.write(reinterpret_cast<char const *>(&cacheKey), sizeof(cacheKey));
+    file.write(reinterpret_cast<char const *>(&specificationLength), sizeof(specificationLength));
+    file.write(reinterpret_cast<char const *>(&atlasWidth), sizeof(atlasWidth));
+    file.write(reinterpret_cast<char const *>(&atlasHeight), sizeof(atlasHeight));
+    file.write(specificationJsonString.data(), specificationJsonString.size());
+    file.write(reinterpret_cast<char const *>(atlasImage.Data.get()), atlasImage.GetByteSize());
+}
+
 template<typename TTextureDatabase>
 typename TextureAtlasBuilder<TTextureDatabase>::AtlasSpecification TextureAtlasBuilder<TTextureDatabase>::BuildAtlasSpecification(
     std::vector<TextureInfo> const & inputTextureInfos,
@@ -694,6 +895,62 @@ TextureAtlas<TTextureDatabase> TextureAtlasBuilder<TTextureDatabase>::InternalBu
         std::move(atlasImageData));
 }
 
+template <typename TTextureDatabase>
+std::function<TextureFrame<TTextureDatabase>(TextureFrameId<typename TextureAtlasBuilder<TTextureDatabase>::TTextureGroups> const &)> TextureAtlasBuilder<TTextureDatabase>::MakeDecodedFrameLoader(
+    std::vector<TextureInfo> const & textureInfos,
+    std::function<TextureFrame<TTextureDatabase>(TextureFrameId<TTextureGroups> const &)> frameLoader,
+    ThreadPool & threadPool)
+{
+    //
+    // Decode frames, interleaving them among tasks
+    //
+
+    auto decodedFrames = std::make_shared<std::vector<std::optional<TextureFrame<TTextureDatabase>>>>(textureInfos.size());
+
+    {
+        size_t const parallelism = std::min(threadPool.GetParallelism(), textureInfos.size());
+
+        std::vector<ThreadPool::Task> tasks;
+        for (size_t t = 0; t < parallelism; ++t)
+        {
+            tasks.emplace_back(
+                [&, t]()
+                {
+                    for (size_t f = t; f < textureInfos.size(); f += parallelism)
+                    {
+                        (*decodedFrames)[f].emplace(frameLoader(textureInfos[f].FrameId));
+                    }
+                });
+        }
+
+        if (!tasks.empty())
+        {
+            threadPool.Run(tasks);
+        }
+    }
+
+    auto decodedFrameIndices = std::make_shared<std::unordered_map<TextureFrameId<TTextureGroups>, size_t>>();
+    for (size_t f = 0; f < textureInfos.size(); ++f)
+    {
+        decodedFrameIndices->emplace(textureInfos[f].FrameId, f);
+    }
+
+    return [decodedFrames, decodedFrameIndices, frameLoader](TextureFrameId<TTextureGroups> const & frameId) -> TextureFrame<TTextureDatabase>
+        {
+            auto const & decodedFrame = (*decodedFrames)[decodedFrameIndices->at(frameId)];
+            if (decodedFrame.has_value())
+            {
+                // Clone, as frames may be loaded more than once
+                return decodedFrame->Clone();
+            }
+            else
+            {
+                // Failed in its task (which swallows errors) - retry here, so to report errors
+                return frameLoader(frameId);
+            }
+        };
+}
+
 template <typename TTextureDatabase>
 void TextureAtlasBuilder<TTextureDatabase>::CopyImage(
     ImageData<rgbaColor> && sourceImage,
@@ -11,14 +11,18 @@
 #include "ImageData.h"
 #include "ProgressCallback.h"
 #include "TextureDatabase.h"
+#include "ThreadPool.h"
 #include "Vectors.h"
 
 #include <picojson.h>
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -254,6 +258,71 @@ public:
             progressCallback);
     }
 
+    /*
+     * Builds an atlas with the entire content of the database, decoding all frames
+     * up-front in parallel on the specified thread pool.
+     */
+    static TextureAtlas<TTextureDatabase> BuildAtlas(
+        TextureDatabase<TTextureDatabase> const & database,
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool,
+        SimpleProgressCallback const & progressCallback)
+    {
+        auto frameLoader = [&](TextureFrameId<TTextureGroups> const & frameId) -> TextureFrame<TTextureDatabase>
+            {
+                if (resizeFactor != 1.0f)
+                    return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager).Resize(resizeFactor);
+                else
+                    return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager);
+            };
+
+        // Build TextureInfo's
+        std::vector<TextureInfo> textureInfos;
+        for (auto const & group : database.GetGroups())
+        {
+            AddTextureInfos(group, options, resizeFactor, textureInfos);
+        }
+
+        // Decode frames
+        auto const decodedFrameLoader = MakeDecodedFrameLoader(
+            textureInfos,
+            frameLoader,
+            threadPool);
+
+        // Build specification
+        auto const specification = BuildAtlasSpecification(
+            textureInfos,
+            options,
+            decodedFrameLoader);
+
+        // Build atlas
+        return InternalBuildAtlas(
+            specification,
+            options,
+            decodedFrameLoader,
+            progressCallback);
+    }
+
+    /*
+     * Builds an atlas with the entire content of the database like the parallel BuildAtlas,
+     * but first looks for it in the specified cache folder, where the atlas is then cached
+     * if it had to be built.
+     *
+     * Cached atlases are keyed by the frames - their metadata and their stamps, which change
+     * whenever their files do - and by the options, hence they are only built again when
+     * any of those changes.
+     */
+    static TextureAtlas<TTextureDatabase> BuildCachedAtlas(
+        TextureDatabase<TTextureDatabase> const & database,
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool,
+        std::optional<std::filesystem::path> const & cacheFolderPath,
+        SimpleProgressCallback const & progressCallback);
+
     /*
      * Builds an atlas with the specified textures.
      */
@@ -340,6 +409,57 @@ public:
             progressCallback);
     }
 
+    /*
+     * Builds a regular atlas with the specified database, decoding all frames up-front
+     * in parallel on the specified thread pool.
+     */
+    static TextureAtlas<TTextureDatabase> BuildRegularAtlas(
+        TextureDatabase<TTextureDatabase> const & database,
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool,
+        SimpleProgressCallback const & progressCallback)
+    {
+        if (!!(options & TextureAtlasOptions::SuppressDuplicates))
+        {
+            throw GameException("Duplicate suppression is not implemented with regular atlases");
+        }
+
+        auto frameLoader = [&](TextureFrameId<TTextureGroups> const & frameId) -> TextureFrame<TTextureDatabase>
+            {
+                if (resizeFactor != 1.0f)
+                    return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager).Resize(resizeFactor);
+                else
+                    return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager);
+            };
+
+        // Build TextureInfo's
+        std::vector<TextureInfo> textureInfos;
+        for (auto const & group : database.GetGroups())
+        {
+            // Note: we'll verify later whether dimensions are suitable for a regular atlas
+            AddTextureInfos(group, options, resizeFactor, textureInfos);
+        }
+
+        // Build specification - verifies whether dimensions are suitable for a regular atlas,
+        // before we spend time decoding frames
+        auto const specification = BuildRegularAtlasSpecification(textureInfos);
+
+        // Decode frames
+        auto const decodedFrameLoader = MakeDecodedFrameLoader(
+            textureInfos,
+            frameLoader,
+            threadPool);
+
+        // Build atlas
+        return InternalBuildAtlas(
+            specification,
+            options | TextureAtlasOptions::MipMappable,
+            decodedFrameLoader,
+            progressCallback);
+    }
+
 private:
 
     struct TextureInfo
@@ -422,6 +542,32 @@ private:
         std::function<TextureFrame<TTextureDatabase>(TextureFrameId<TTextureGroups> const &)> frameLoader,
         SimpleProgressCallback const & progressCallback);
 
+    /*
+     * Decodes - and resizes - all frames up-front, interleaving them among the threads of
+     * the specified pool, and returns a loader serving the decoded frames.
+     */
+    static std::function<TextureFrame<TTextureDatabase>(TextureFrameId<TTextureGroups> const &)> MakeDecodedFrameLoader(
+        std::vector<TextureInfo> const & textureInfos,
+        std::function<TextureFrame<TTextureDatabase>(TextureFrameId<TTextureGroups> const &)> frameLoader,
+        ThreadPool & threadPool);
+
+    static std::uint64_t CalculateCacheKey(
+        TextureDatabase<TTextureDatabase> const & database,
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager);
+
+    // Unit-tested
+    static std::optional<TextureAtlas<TTextureDatabase>> TryLoadCachedAtlas(
+        std::filesystem::path const & cacheFilePath,
+        std::uint64_t cacheKey);
+
+    // Unit-tested
+    static void SaveCachedAtlas(
+        TextureAtlas<TTextureDatabase> const & atlas,
+        std::filesystem::path const & cacheFilePath,
+        std::uint64_t cacheKey);
+
     static void CopyImage(
         ImageData<rgbaColor> && sourceImage,
         rgbaColor * destImage,
@@ -470,6 +616,8 @@ private:
     friend class TextureAtlasTests_Placement_InAtlasSizeMatchingFrameSize_Test;
     friend class TextureAtlasTests_Placement_InAtlasSizeLargerThanFrameSize_Test;
     friend class TextureAtlasTests_Placement_Duplicates_Test;
+    friend class TextureAtlasTests_Cache_RoundTrip_Test;
+    friend class TextureAtlasTests_Cache_RejectsDifferentKey_Test;
 };
 
 #include "TextureAtlas-inl.h"
\ No newline at end of file
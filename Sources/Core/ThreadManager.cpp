@@ -7,8 +7,10 @@
 
 #include "FloatingPoint.h"
 #include "Log.h"
+#include "PerfTrace.h"
 #include "SysSpecifics.h"
 
+#include <algorithm>
 #include <cassert>
 
 #if FS_IS_OS_WINDOWS()
@@ -16,8 +18,16 @@
 #define NOMINMAX
 #include <Windows.h>
 #elif FS_IS_OS_ANDROID()
+#include <sched.h>
 #include <sys/syscall.h>
 #include <unistd.h>
+#elif FS_IS_OS_LINUX()
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if FS_IS_OS_ANDROID() || FS_IS_OS_LINUX()
+#include <fstream>
 #endif
 
 size_t ThreadManager::GetNumberOfProcessors()
@@ -27,6 +37,32 @@ size_t ThreadManager::GetNumberOfProcessors()
         static_cast<size_t>(std::thread::hardware_concurrency()));
 }
 
+ThreadManager::ProcessorClasses const & ThreadManager::GetProcessorClasses()
+{
+    // Detected once, the topology does not change
+    static ProcessorClasses const processorClasses = DetectProcessorClasses();
+
+    return processorClasses;
+}
+
+size_t ThreadManager::GetNumberOfPerformanceProcessors()
+{
+    auto const & processorClasses = GetProcessorClasses();
+
+    return processorClasses.IsHeterogeneous()
+        ? processorClasses.PerformanceProcessors.size()
+        : GetNumberOfProcessors();
+}
+
+void ThreadManager::InitializeThisBackgroundThread()
+{
+    auto const & processorClasses = GetProcessorClasses();
+    if (processorClasses.IsHeterogeneous())
+    {
+        RestrictThisThreadToProcessors(processorClasses.EfficiencyProcessors);
+    }
+}
+
 ThreadManager::ThreadManager(
     bool isRenderingMultithreaded,
     size_t simulationParallelism,
@@ -34,6 +70,10 @@ ThreadManager::ThreadManager(
     : mIsRenderingMultithreaded(isRenderingMultithreaded)
     , mMaxSimulationParallelism(GetNumberOfProcessors())
     , mPlatformSpecificThreadInitializationFunctor(std::move(platformSpecificThreadInitializationFunctor))
+    , mSimulationThreadPool()
+    , mCurrentSimulationParallelism(0)
+    , mDoKeepSimulationThreadsHot(false)
+    , mIsSimulationActive(false)
 {
     LogMessage("ThreadManager: isRenderingMultithreaded=", (mIsRenderingMultithreaded ? "YES" : "NO"),
         " simulationParallelism=", simulationParallelism,
@@ -59,6 +99,19 @@ void ThreadManager::InitializeThisThread(
     EnableFloatingPointExceptions();
 #endif
 
+    //
+    // Name thread in traces
+    //
+
+    PerfTrace::GetInstance().SetThisThreadName(threadName);
+
+    //
+    // Place thread on the right class of processors - before the platform-specific
+    // initialization, which may want to place it differently
+    //
+
+    PlaceThisThread(threadTaskKind);
+
     mPlatformSpecificThreadInitializationFunctor(threadTaskKind, threadName, threadTaskIndex);
 }
 
@@ -81,6 +134,81 @@ size_t ThreadManager::GetThisThreadProcessor()
 #endif
 }
 
+bool ThreadManager::PinThisThreadToProcessor(size_t processorIndex)
+{
+#if FS_IS_OS_WINDOWS()
+    if (processorIndex >= sizeof(DWORD_PTR) * 8)
+    {
+        return false;
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << processorIndex) != 0;
+#elif FS_IS_OS_ANDROID() || FS_IS_OS_LINUX()
+    if (processorIndex >= CPU_SETSIZE)
+    {
+        return false;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(processorIndex, &cpuSet);
+
+#if FS_IS_OS_ANDROID()
+    return sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#endif
+#else
+    // Not supported (e.g. MacOS only offers affinity hints)
+    (void)processorIndex;
+    return false;
+#endif
+}
+
+bool ThreadManager::RestrictThisThreadToProcessors(std::vector<size_t> const & processorIndices)
+{
+    if (processorIndices.empty())
+    {
+        return false;
+    }
+
+#if FS_IS_OS_WINDOWS()
+    DWORD_PTR mask = 0;
+    for (size_t const processorIndex : processorIndices)
+    {
+        if (processorIndex >= sizeof(DWORD_PTR) * 8)
+        {
+            return false;
+        }
+
+        mask |= DWORD_PTR(1) << processorIndex;
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif FS_IS_OS_ANDROID() || FS_IS_OS_LINUX()
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (size_t const processorIndex : processorIndices)
+    {
+        if (processorIndex >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        CPU_SET(processorIndex, &cpuSet);
+    }
+
+#if FS_IS_OS_ANDROID()
+    return sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#endif
+#else
+    // Not supported (e.g. MacOS only offers affinity hints)
+    return false;
+#endif
+}
+
 size_t ThreadManager::GetSimulationParallelism() const
 {
     return mSimulationThreadPool->GetParallelism();
@@ -96,10 +224,173 @@ void ThreadManager::SetSimulationParallelism(size_t parallelism)
 
     mSimulationThreadPool.reset();
 
+    // Threads of the new pool are placed according to this
+    mCurrentSimulationParallelism = parallelism;
+
     mSimulationThreadPool = std::make_unique<ThreadPool>(ThreadManager::ThreadTaskKind::Simulation, parallelism, *this);
+
+    UpdateSimulationThreadPoolHotness();
 }
 
 ThreadPool & ThreadManager::GetSimulationThreadPool()
 {
     return *mSimulationThreadPool;
 }
+
+void ThreadManager::SetDoKeepSimulationThreadsHot(bool value)
+{
+    mDoKeepSimulationThreadsHot = value;
+
+    UpdateSimulationThreadPoolHotness();
+}
+
+void ThreadManager::SetIsSimulationActive(bool value)
+{
+    if (value != mIsSimulationActive)
+    {
+        mIsSimulationActive = value;
+
+        UpdateSimulationThreadPoolHotness();
+    }
+}
+
+void ThreadManager::UpdateSimulationThreadPoolHotness()
+{
+    mSimulationThreadPool->SetAreWorkersHot(mDoKeepSimulationThreadsHot && mIsSimulationActive);
+}
+
+ThreadManager::ProcessorClasses ThreadManager::DetectProcessorClasses()
+{
+    //
+    // Get a measure of the performance of each processor - higher is faster
+    //
+
+    std::vector<std::uint64_t> processorPerformances(GetNumberOfProcessors(), 0);
+
+#if FS_IS_OS_WINDOWS()
+    DWORD bufferSize = 0;
+    GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &bufferSize);
+    if (bufferSize > 0)
+    {
+        std::vector<std::uint8_t> buffer(bufferSize);
+        if (GetLogicalProcessorInformationEx(RelationProcessorCore, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &bufferSize))
+        {
+            for (DWORD offset = 0; offset < bufferSize; )
+            {
+                auto const * const info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+
+                // Efficiency class: higher is faster; we only look at the first group
+                if (info->Processor.GroupMask[0].Group == 0)
+                {
+                    for (size_t p = 0; p < processorPerformances.size() && p < sizeof(KAFFINITY) * 8; ++p)
+                    {
+                        if ((info->Processor.GroupMask[0].Mask & (KAFFINITY(1) << p)) != 0)
+                        {
+                            processorPerformances[p] = static_cast<std::uint64_t>(info->Processor.EfficiencyClass) + 1;
+                        }
+                    }
+                }
+
+                offset += info->Size;
+            }
+        }
+    }
+#elif FS_IS_OS_ANDROID() || FS_IS_OS_LINUX()
+    auto const readSysValue = [](std::string const & path) -> std::uint64_t
+    {
+        std::ifstream file(path);
+        std::uint64_t value = 0;
+        if (file >> value)
+        {
+            return value;
+        }
+
+        return 0;
+    };
+
+    for (size_t p = 0; p < processorPerformances.size(); ++p)
+    {
+        std::string const cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(p);
+
+        // Capacity (ARM) is the most accurate; max frequency approximates it elsewhere (e.g. hybrid x86)
+        processorPerformances[p] = readSysValue(cpuPath + "/cpu_capacity");
+        if (processorPerformances[p] == 0)
+        {
+            processorPerformances[p] = readSysValue(cpuPath + "/cpufreq/cpuinfo_max_freq");
+        }
+    }
+#endif
+
+    //
+    // Classify: the processors close to the fastest one are performance processors; if we
+    // couldn't measure any of them, then we just don't know
+    //
+    // We allow some slack so that the favored cores of a homogeneous CPU - which boost to
+    // slightly higher frequencies than the others - don't count as a class of their own
+    //
+
+    ProcessorClasses processorClasses;
+
+    if (std::find(processorPerformances.cbegin(), processorPerformances.cend(), std::uint64_t(0)) == processorPerformances.cend())
+    {
+        std::uint64_t const maxPerformance = *std::max_element(processorPerformances.cbegin(), processorPerformances.cend());
+
+        for (size_t p = 0; p < processorPerformances.size(); ++p)
+        {
+            if (processorPerformances[p] * 5 >= maxPerformance * 4)
+            {
+                processorClasses.PerformanceProcessors.push_back(p);
+            }
+            else
+            {
+                processorClasses.EfficiencyProcessors.push_back(p);
+            }
+        }
+
+        if (!processorClasses.IsHeterogeneous())
+        {
+            processorClasses.PerformanceProcessors.clear();
+            processorClasses.EfficiencyProcessors.clear();
+        }
+    }
+
+    LogMessage("ThreadManager: detected ", processorClasses.PerformanceProcessors.size(), " performance processors and ",
+        processorClasses.EfficiencyProcessors.size(), " efficiency processors");
+
+    return processorClasses;
+}
+
+void ThreadManager::PlaceThisThread(ThreadTaskKind threadTaskKind)
+{
+    auto const & processorClasses = GetProcessorClasses();
+    if (!processorClasses.IsHeterogeneous())
+    {
+        // Nothing to choose from
+        return;
+    }
+
+    switch (threadTaskKind)
+    {
+        case ThreadTaskKind::MainAndSimulation:
+        case ThreadTaskKind::Simulation:
+        {
+            // Simulation tasks of a batch wait for each other, hence they're better off all on
+            // performance processors - unless there are more of them than performance processors
+            if (mCurrentSimulationParallelism <= processorClasses.PerformanceProcessors.size())
+            {
+                RestrictThisThreadToProcessors(processorClasses.PerformanceProcessors);
+            }
+
+            break;
+        }
+
+        case ThreadTaskKind::Render:
+        case ThreadTaskKind::Other:
+        {
+            // Out of the simulation's way
+            RestrictThisThreadToProcessors(processorClasses.EfficiencyProcessors);
+
+            break;
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 class ThreadPool;
 
@@ -26,6 +27,35 @@ public:
 
     static size_t GetNumberOfProcessors();
 
+    /*
+     * The processors of a heterogeneous (e.g. P/E-core, big.LITTLE) CPU, by class; both
+     * lists are empty when the CPU is homogeneous, or when its classes cannot be told apart.
+     */
+    struct ProcessorClasses
+    {
+        std::vector<size_t> PerformanceProcessors;
+        std::vector<size_t> EfficiencyProcessors;
+
+        bool IsHeterogeneous() const
+        {
+            return !PerformanceProcessors.empty() && !EfficiencyProcessors.empty();
+        }
+    };
+
+    static ProcessorClasses const & GetProcessorClasses();
+
+    /*
+     * The number of processors worth running simulation tasks on, i.e. the performance
+     * processors of a heterogeneous CPU, or else all processors.
+     */
+    static size_t GetNumberOfPerformanceProcessors();
+
+    /*
+     * Invoked on threads doing background work not on the critical path (e.g. preview loading),
+     * which - on heterogeneous CPUs - are better off on efficiency processors.
+     */
+    static void InitializeThisBackgroundThread();
+
 public:
 
     using PlatformSpecificThreadInitializationFunction = std::function<void(ThreadTaskKind, std::string const &, size_t)>;
@@ -47,6 +77,21 @@ public:
 
     static size_t GetThisThreadProcessor();
 
+    /*
+     * Restricts the calling thread to run on the specified processor only; meant
+     * to be invoked from platform-specific thread initialization functors.
+     *
+     * Returns false when pinning is not supported or fails.
+     */
+    static bool PinThisThreadToProcessor(size_t processorIndex);
+
+    /*
+     * Restricts the calling thread to run on the specified processors only.
+     *
+     * Returns false when restricting is not supported or fails.
+     */
+    static bool RestrictThisThreadToProcessors(std::vector<size_t> const & processorIndices);
+
     //
     // Simulation Parallelism applies to all simulation tasks, including SpringRelaxation and LightDiffusion
     //
@@ -67,6 +112,25 @@ public:
 
     ThreadPool & GetSimulationThreadPool();
 
+    /*
+     * The option to keep simulation threads spinning between batches - rather than letting them
+     * park - while the simulation is active, trading CPU time for lower wake-up latency.
+     */
+    void SetDoKeepSimulationThreadsHot(bool value);
+
+    /*
+     * Invoked at each iteration with whether or not the simulation is being updated.
+     */
+    void SetIsSimulationActive(bool value);
+
+private:
+
+    static ProcessorClasses DetectProcessorClasses();
+
+    void PlaceThisThread(ThreadTaskKind threadTaskKind);
+
+    void UpdateSimulationThreadPoolHotness();
+
 private:
 
     bool const mIsRenderingMultithreaded;
@@ -74,6 +138,10 @@ private:
     PlatformSpecificThreadInitializationFunction const mPlatformSpecificThreadInitializationFunctor;
 
     std::unique_ptr<ThreadPool> mSimulationThreadPool;
+    size_t mCurrentSimulationParallelism;
+
+    bool mDoKeepSimulationThreadsHot;
+    bool mIsSimulationActive;
 };
 
 #include "ThreadPool.h"
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "ThreadPool.h"
 
 #include "Log.h"
+#include "PerfTrace.h"
 #include "SysSpecifics.h"
 
 #include <algorithm>
@@ -17,16 +18,28 @@ ThreadPool::ThreadPool(
     : mThreadTaskKind(threadTaskKind)
     , mLock()
     , mThreads()
+    , mWorkQueues()
     , mWorkerThreadSignal()
-    , mTasksToRun(nullptr)
-    , mTasksToComplete(0)
-    , mCompletedTasks(0)
+    , mBatchSequenceNumber(0)
+    , mBatchRandomEngine(nullptr)
+    , mBatchWallClock(nullptr)
+    , mLastBatchStartTimestamp(std::chrono::steady_clock::now())
+    , mAverageBatchIntervalNs(static_cast<float>(MaxSpinWindow.count()))
+    , mSpinWindowNs(0)
+    , mAreWorkersHot(false)
+    , mPendingTaskCount(0)
     , mIsStop(false)
 {
     LogMessage("ThreadPool: creating thread pool with parallelism=", parallelism);
 
     assert(parallelism > 0);
 
+    // Create one queue for each thread (main thread is one of them)
+    for (size_t i = 0; i < parallelism; ++i)
+    {
+        mWorkQueues.emplace_back(std::make_unique<WorkQueue>());
+    }
+
     // Start N-1 threads (main thread is one of them)
     for (size_t i = 0; i < parallelism - 1; ++i)
     {
@@ -60,10 +73,11 @@ ThreadPool::~ThreadPool()
 void ThreadPool::Run(std::vector<Task> const & tasks)
 {
     assert(!tasks.empty());
-    assert(mTasksToComplete <= 0);
 
     // Shortcut to avoid paying synchronization penalties
-    // in trivial cases
+    // in trivial cases.
+    // Note: this path does not touch the pool's state, hence it is also
+    // safe to take from within a task that is being run by this pool
     if (mThreads.empty() || tasks.size() == 1)
     {
         for (Task const & task : tasks)
@@ -74,39 +88,74 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
         return;
     }
 
-    // Queue all the tasks
-    {
-        std::unique_lock const lock{ mLock };
+    assert(mPendingTaskCount.load() == 0);
 
-        mTasksToRun = &tasks;
-        mTasksToComplete.store(static_cast<int>(tasks.size()) - 1); // Take already the main thread one into account
-        mCompletedTasks.store(1); // Take already the main thread one into account
+    // Queue all tasks but the last one onto the worker threads' queues, round-robin;
+    // the last one is for the main thread.
+    // Note: pending count has to be set before queueing, as threads still
+    // lingering from the previous batch may pick tasks immediately
+    mPendingTaskCount.store(tasks.size() - 1);
+    for (size_t t = 0; t < tasks.size() - 1; ++t)
+    {
+        Push(
+            1 + (t % mThreads.size()),
+            WorkItem(&(tasks[t]), nullptr, 0));
     }
 
     // Signal threads that tasks are available
-    mWorkerThreadSignal.notify_all();
+    Signal();
 
     // Run the Nth task on the main thread
     RunTask(tasks.back());
 
-    // Run the remaining tasks on main thread, if needed
-    RunRemainingTasksLoop();
+    // Help out with the remaining tasks, until all tasks are completed
+    RunUntilBatchCompleted(0);
+}
 
-    // Only returns when there are no more tasks
-    assert(mTasksToComplete.load() <= 0);
+void ThreadPool::Run(TaskGraph & taskGraph)
+{
+    assert(!taskGraph.IsEmpty());
+
+    // Reset dependencies
+    for (auto & node : taskGraph.mNodes)
+    {
+        node->PendingDependencyCount.store(node->DependencyCount, std::memory_order_relaxed);
+    }
 
-    // Wait until all tasks are completed
+    // Shortcut to avoid paying synchronization penalties in trivial cases;
+    // insertion order is a topological order
+    if (mThreads.empty() || taskGraph.GetSize() == 1)
     {
-        // ...in a spinlock
-        while (true)
+        for (auto const & node : taskGraph.mNodes)
         {
-            assert(mCompletedTasks.load() >= 0 && mCompletedTasks.load() <= tasks.size());
-            if (mCompletedTasks.load() == tasks.size())
-            {
-                break;
-            }
+            RunTask(node->Function);
+        }
+
+        return;
+    }
+
+    assert(mPendingTaskCount.load() == 0);
+
+    // Queue all the roots, round-robin across all queues
+    mPendingTaskCount.store(taskGraph.GetSize());
+    size_t queueIndex = 0;
+    for (TaskGraph::TaskId t = 0; t < taskGraph.GetSize(); ++t)
+    {
+        if (taskGraph.mNodes[t]->DependencyCount == 0)
+        {
+            Push(
+                queueIndex,
+                WorkItem(&(taskGraph.mNodes[t]->Function), &taskGraph, t));
+
+            queueIndex = (queueIndex + 1) % mWorkQueues.size();
         }
     }
+
+    // Signal threads that tasks are available
+    Signal();
+
+    // Play along, until all tasks are completed
+    RunUntilBatchCompleted(0);
 }
 
 void ThreadPool::ThreadLoop(
@@ -124,25 +173,31 @@ void ThreadPool::ThreadLoop(
     // Run thread loop until thread pool is destroyed
     //
 
+    std::uint64_t lastBatchSequenceNumber = 0;
+
     while (true)
     {
+        if (SpinForNextBatch(lastBatchSequenceNumber))
         {
-            std::unique_lock lock{ mLock };
-
             if (mIsStop)
             {
                 // We're done!
                 break;
             }
 
-            // Wait for signal that tasks have been queued (or that we've been stopped)
+            lastBatchSequenceNumber = mBatchSequenceNumber.load();
+        }
+        else
+        {
+            std::unique_lock lock{ mLock };
+
+            // Wait for signal that a batch has been started (or that we've been stopped)
             mWorkerThreadSignal.wait(
                 lock,
-                [this]()
+                [this, lastBatchSequenceNumber]()
                 {
                     // Condition to leave the wait
-                    // Note: other threads may empty mTasksToComplete - that's fine, this thread won't run
-                    return mIsStop || mTasksToComplete.load() > 0;
+                    return mIsStop || mBatchSequenceNumber != lastBatchSequenceNumber;
                 });
 
             if (mIsStop)
@@ -150,52 +205,202 @@ void ThreadPool::ThreadLoop(
                 // We're done!
                 break;
             }
+
+            lastBatchSequenceNumber = mBatchSequenceNumber;
         }
 
-        // Tasks have been queued...
+        // A batch has been started...
 
-        // ...run the remaining tasks
-        RunRemainingTasksLoop();
+        // ...run tasks until it's completed, in the context of the batch
+        GameRandomEngine::ThreadBinding const randomEngineBinding(mBatchRandomEngine);
+        GameWallClock::ThreadBinding const wallClockBinding(mBatchWallClock);
+
+        RunUntilBatchCompleted(threadTaskIndex);
     }
 
     LogMessage("Thread exiting");
 }
 
-void ThreadPool::RunRemainingTasksLoop()
+void ThreadPool::Signal()
 {
     //
-    // Run tasks until queue is empty
+    // Update spin window with the interval since the previous batch
+    //
+    // We cap intervals at the max spin window, as the ones beyond it
+    // (e.g. between simulation steps) are anyway not worth spinning for
     //
 
+    auto const now = std::chrono::steady_clock::now();
+
+    float const batchIntervalNs = static_cast<float>(
+        std::min(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - mLastBatchStartTimestamp),
+            MaxSpinWindow).count());
+
+    mLastBatchStartTimestamp = now;
+
+    mAverageBatchIntervalNs += 0.2f * (batchIntervalNs - mAverageBatchIntervalNs);
+
+    // Twice the average, to catch most of the intervals that are shorter than the window
+    mSpinWindowNs.store(
+        std::min(
+            static_cast<std::int64_t>(2.0f * mAverageBatchIntervalNs),
+            static_cast<std::int64_t>(MaxSpinWindow.count())),
+        std::memory_order_relaxed);
+
+    //
+    // Start batch
+    //
+
+    {
+        std::unique_lock const lock{ mLock };
+
+        // Published to workers by the batch sequence number
+        mBatchRandomEngine = GameRandomEngine::GetThisThreadInstance();
+        mBatchWallClock = GameWallClock::GetThisThreadInstance();
+
+        ++mBatchSequenceNumber;
+    }
+
+    mWorkerThreadSignal.notify_all();
+}
+
+bool ThreadPool::SpinForNextBatch(std::uint64_t lastBatchSequenceNumber) const
+{
+    auto const spinStartTimestamp = std::chrono::steady_clock::now();
+
     while (true)
     {
-        //
-        // De-queue a task
-        //
+        // Check a few times between clock reads
+        for (int i = 0; i < 16; ++i)
+        {
+            if (mIsStop.load() || mBatchSequenceNumber.load() != lastBatchSequenceNumber)
+            {
+                return true;
+            }
+
+            std::this_thread::yield();
+        }
+
+        if (!mAreWorkersHot.load(std::memory_order_relaxed)
+            && std::chrono::steady_clock::now() - spinStartTimestamp >= std::chrono::nanoseconds(mSpinWindowNs.load(std::memory_order_relaxed)))
+        {
+            return false;
+        }
+    }
+}
+
+void ThreadPool::RunUntilBatchCompleted(size_t queueIndex)
+{
+    // Note: we keep spinning even when there's nothing to pick, as tasks
+    // being run by other threads may still make continuations runnable
+    while (mPendingTaskCount.load(std::memory_order_acquire) > 0)
+    {
+        auto const workItem = PopOrSteal(queueIndex);
+        if (workItem.has_value())
+        {
+            RunWorkItem(*workItem, queueIndex);
+        }
+    }
+}
+
+void ThreadPool::Push(
+    size_t queueIndex,
+    WorkItem const & workItem)
+{
+    assert(queueIndex < mWorkQueues.size());
+
+    WorkQueue & queue = *(mWorkQueues[queueIndex]);
+
+    std::unique_lock const lock{ queue.Lock };
+
+    queue.Items.push_back(workItem);
+}
+
+std::optional<ThreadPool::WorkItem> ThreadPool::PopOrSteal(size_t queueIndex)
+{
+    //
+    // Own queue first, from its back - most recently pushed, hence hottest
+    //
+
+    {
+        WorkQueue & queue = *(mWorkQueues[queueIndex]);
+
+        std::unique_lock const lock{ queue.Lock };
+
+        if (!queue.Items.empty())
+        {
+            WorkItem const workItem = queue.Items.back();
+            queue.Items.pop_back();
+            return workItem;
+        }
+    }
+
+    //
+    // Steal from other queues, from their front
+    //
+
+    for (size_t i = 1; i < mWorkQueues.size(); ++i)
+    {
+        WorkQueue & queue = *(mWorkQueues[(queueIndex + i) % mWorkQueues.size()]);
 
-        int const oldTasksToComplete = mTasksToComplete.fetch_sub(1);
-        if (oldTasksToComplete <= 0)
+        std::unique_lock const lock{ queue.Lock };
+
+        if (!queue.Items.empty())
         {
-            // No more tasks
-            return;
+            WorkItem const workItem = queue.Items.front();
+            queue.Items.pop_front();
+            return workItem;
         }
+    }
 
-        //
-        // Run the task
-        //
+    return std::nullopt;
+}
 
-        RunTask((*mTasksToRun)[oldTasksToComplete - 1]);
+void ThreadPool::RunWorkItem(
+    WorkItem const & workItem,
+    size_t queueIndex)
+{
+    //
+    // Run the task
+    //
 
-        //
-        // Signal task completion
-        //
+    RunTask(*workItem.Function);
 
-        ++mCompletedTasks;
+    //
+    // Release continuations
+    //
+
+    if (workItem.Graph != nullptr)
+    {
+        auto & nodes = workItem.Graph->mNodes;
+        for (TaskGraph::TaskId const continuation : nodes[workItem.GraphTaskId]->Continuations)
+        {
+            if (nodes[continuation]->PendingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                // Last dependency - continuation is runnable; we push it onto our own
+                // queue, so that we're likely to pick it right away
+                Push(
+                    queueIndex,
+                    WorkItem(&(nodes[continuation]->Function), workItem.Graph, continuation));
+            }
+        }
     }
+
+    //
+    // Signal task completion
+    //
+    // Note: only after continuations have been queued, so that the batch
+    // is never seen as completed prematurely
+    //
+
+    mPendingTaskCount.fetch_sub(1, std::memory_order_acq_rel);
 }
 
 void ThreadPool::RunTask(Task const & task)
 {
+    ScopedPerfTraceEvent const traceEvent("Task");
+
     try
     {
         task();
@@ -208,4 +413,4 @@ void ThreadPool::RunTask(Task const & task)
 
         // Keep going...
     }
-}
\ No newline at end of file
+}
@@ -5,21 +5,47 @@
 ***************************************************************************************/
 #pragma once
 
+#include "GameRandomEngine.h"
+#include "GameWallClock.h"
 #include "ThreadManager.h"
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <deque>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
 
 /*
- * This class implements a thread pool that executes batches of tasks.
+ * This class implements a work-stealing thread pool that executes batches of tasks.
  *
+ * Each thread has its own queue of tasks; threads pick tasks from their own queue first,
+ * and steal tasks from other threads' queues when their own is empty.
+ *
+ * A batch may be either a plain list of tasks, or a graph of tasks with dependencies
+ * among them; in the latter case, a task becomes runnable as soon as all the tasks
+ * it depends on have completed, without waiting for the rest of the batch.
+ *
+ * A thread never runs more than one task at a time, hence - like before - tasks of a plain
+ * batch whose size does not exceed the parallelism may synchronize among themselves.
+ *
+ * Between batches, worker threads spin for a while before parking, so to pick up batches
+ * that follow each other closely without paying for a wake-up; the spin window follows the
+ * measured interval between batches. Workers may also be kept "hot", i.e. spinning until
+ * the next batch however long it takes, which is meant for while the simulation is running.
+ *
+ * Tasks run with the random engine and the game clock of the thread that runs the batch, so
+ * that a pool serving the simulation of a world sees that world's instances; a pool is driven
+ * by one thread at a time.
  */
 class ThreadPool final
 {
@@ -27,6 +53,99 @@ public:
 
     using Task = std::function<void()>;
 
+    /*
+     * A set of tasks with dependencies among them.
+     *
+     * A task may only depend on tasks that have been added before it; graphs are meant
+     * to be built once and run many times.
+     */
+    class TaskGraph final
+    {
+    public:
+
+        using TaskId = size_t;
+
+        TaskId Add(Task && task)
+        {
+            return Add(std::move(task), {});
+        }
+
+        TaskId Add(
+            Task && task,
+            std::initializer_list<TaskId> dependencies)
+        {
+            return Add(std::move(task), dependencies.begin(), dependencies.end());
+        }
+
+        /*
+         * Dependencies must be unique.
+         */
+        TaskId Add(
+            Task && task,
+            std::vector<TaskId> const & dependencies)
+        {
+            return Add(std::move(task), dependencies.cbegin(), dependencies.cend());
+        }
+
+        size_t GetSize() const
+        {
+            return mNodes.size();
+        }
+
+        bool IsEmpty() const
+        {
+            return mNodes.empty();
+        }
+
+        void Clear()
+        {
+            mNodes.clear();
+        }
+
+    private:
+
+        template<typename TIterator>
+        TaskId Add(
+            Task && task,
+            TIterator dependenciesBegin,
+            TIterator dependenciesEnd)
+        {
+            TaskId const newTaskId = mNodes.size();
+
+            mNodes.emplace_back(std::make_unique<Node>(std::move(task), static_cast<size_t>(std::distance(dependenciesBegin, dependenciesEnd))));
+
+            for (auto it = dependenciesBegin; it != dependenciesEnd; ++it)
+            {
+                assert(*it < newTaskId);
+                mNodes[*it]->Continuations.push_back(newTaskId);
+            }
+
+            return newTaskId;
+        }
+
+        friend class ThreadPool;
+
+        struct Node
+        {
+            Task Function;
+            std::vector<TaskId> Continuations;
+            size_t const DependencyCount;
+            std::atomic<size_t> PendingDependencyCount;
+
+            Node(
+                Task && function,
+                size_t dependencyCount)
+                : Function(std::move(function))
+                , Continuations()
+                , DependencyCount(dependencyCount)
+                , PendingDependencyCount(dependencyCount)
+            {}
+        };
+
+        // Insertion order is a topological order
+        std::vector<std::unique_ptr<Node>> mNodes;
+    };
+
 public:
 
     explicit ThreadPool(
@@ -42,12 +161,20 @@ public:
     }
 
     /*
-     * The first task is guaranteed to run on the main thread.
+     * When set, workers spin - rather than park - until the next batch.
+     */
+    void SetAreWorkersHot(bool value)
+    {
+        mAreWorkersHot.store(value, std::memory_order_relaxed);
+    }
+
+    /*
+     * The last task is guaranteed to run on the main thread.
      */
     void Run(std::vector<Task> const & tasks);
 
     /*
-     * The first task is guaranteed to run on the main thread.
+     * The last task is guaranteed to run on the main thread.
      */
     inline void RunAndClear(std::vector<Task> & tasks)
     {
@@ -55,14 +182,61 @@ public:
         tasks.clear();
     }
 
+    /*
+     * Returns when all tasks in the graph have completed.
+     */
+    void Run(TaskGraph & taskGraph);
+
 private:
 
+    struct WorkItem
+    {
+        Task const * Function;
+        TaskGraph * Graph; // Only set for tasks of a graph
+        TaskGraph::TaskId GraphTaskId;
+
+        WorkItem(
+            Task const * function,
+            TaskGraph * graph,
+            TaskGraph::TaskId graphTaskId)
+            : Function(function)
+            , Graph(graph)
+            , GraphTaskId(graphTaskId)
+        {}
+    };
+
+    struct WorkQueue
+    {
+        std::mutex Lock;
+        std::deque<WorkItem> Items;
+    };
+
     void ThreadLoop(
         std::string threadName,
         size_t threadTaskIndex,
         ThreadManager & threadManager);
 
-    void RunRemainingTasksLoop();
+    /*
+     * Captures the calling thread's context for the batch, and starts the batch.
+     */
+    void Signal();
+
+    /*
+     * Returns false if no batch has been started in the spin window.
+     */
+    bool SpinForNextBatch(std::uint64_t lastBatchSequenceNumber) const;
+
+    void RunUntilBatchCompleted(size_t queueIndex);
+
+    void Push(
+        size_t queueIndex,
+        WorkItem const & workItem);
+
+    std::optional<WorkItem> PopOrSteal(size_t queueIndex);
+
+    void RunWorkItem(
+        WorkItem const & workItem,
+        size_t queueIndex);
 
     void RunTask(Task const & task);
 
@@ -76,20 +250,33 @@ private:
     // Our threads (N-1, as main thread also plays)
     std::vector<std::thread> mThreads;
 
+    // One queue for each thread; the main thread's is the first one
+    std::vector<std::unique_ptr<WorkQueue>> mWorkQueues;
+
     // The condition variable to wake up threads
     std::condition_variable mWorkerThreadSignal;
 
-    // The tasks currently awaiting to be picked up;
-    // threads takes all but the last one
-    std::vector<Task> const * mTasksToRun;
+    // Incremented each time a batch is started; used by threads to
+    // detect new batches
+    std::atomic<std::uint64_t> mBatchSequenceNumber;
+
+    // The context of the thread running the current batch; set before the batch is started
+    GameRandomEngine * mBatchRandomEngine;
+    GameWallClock * mBatchWallClock;
+
+    // Spinning policy
+
+    static std::chrono::nanoseconds constexpr MaxSpinWindow = std::chrono::microseconds(100);
 
-    // Also serves as proxy to index of next task to pick.
-    // Begins with N-1, as last task is for main thread, and can go lower than zero if too many threads are eager to work
-    std::atomic<int> mTasksToComplete;
+    std::chrono::steady_clock::time_point mLastBatchStartTimestamp; // Only touched by main thread
+    float mAverageBatchIntervalNs; // Only touched by main thread; intervals are capped at MaxSpinWindow
+    std::atomic<std::int64_t> mSpinWindowNs;
+    std::atomic<bool> mAreWorkersHot;
 
-    // Number of tasks that still have to complete. Trails opposite of mTasksToComplete
-    std::atomic<size_t> mCompletedTasks;
+    // Number of tasks of the current batch that have yet to complete
+    // (excluding the one that the main thread runs directly)
+    std::atomic<size_t> mPendingTaskCount;
 
     // Set to true when have to stop
-    bool mIsStop;
+    std::atomic<bool> mIsStop;
 };
@@ -28,6 +28,13 @@ BootSettings BootSettings::Load(std::filesystem::path const & filePath)
                 {
                     settings.DoForceNoGlFinish = Utils::GetOptionalJsonMember<bool>(rootObject, "force_no_glfinish");
                     settings.DoForceNoMultithreadedRendering = Utils::GetOptionalJsonMember<bool>(rootObject, "force_no_multithreaded_rendering");
+                    settings.DoForceNoGpuInteriorView = Utils::GetOptionalJsonMember<bool>(rootObject, "force_no_gpu_interior_view");
+
+                    auto const telemetryFilePath = Utils::GetOptionalJsonMember<std::string>(rootObject, "telemetry_file_path");
+                    if (telemetryFilePath.has_value())
+                        settings.TelemetryFilePath = std::filesystem::path(*telemetryFilePath);
+
+                    settings.TelemetrySampleRate = Utils::GetOptionalJsonMember<float>(rootObject, "telemetry_sample_rate");
                 }
             }
         }
@@ -54,6 +61,15 @@ void BootSettings::Save(
     if (settings.DoForceNoMultithreadedRendering.has_value())
         rootObject["force_no_multithreaded_rendering"] = picojson::value(*(settings.DoForceNoMultithreadedRendering));
 
+    if (settings.DoForceNoGpuInteriorView.has_value())
+        rootObject["force_no_gpu_interior_view"] = picojson::value(*(settings.DoForceNoGpuInteriorView));
+
+    if (settings.TelemetryFilePath.has_value())
+        rootObject["telemetry_file_path"] = picojson::value(settings.TelemetryFilePath->string());
+
+    if (settings.TelemetrySampleRate.has_value())
+        rootObject["telemetry_sample_rate"] = picojson::value(static_cast<double>(*(settings.TelemetrySampleRate)));
+
     // Save
     GameAssetManager::SaveJson(
         picojson::value(rootObject),
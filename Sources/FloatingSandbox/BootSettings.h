@@ -15,9 +15,21 @@ public:
     std::optional<bool> DoForceNoGlFinish;
     std::optional<bool> DoForceNoMultithreadedRendering;
 
+    // When set, ships' interior views are made on the CPU rather than on the GPU;
+    // only settable by editing the file
+    std::optional<bool> DoForceNoGpuInteriorView;
+
+    // When set, telemetry is streamed to this file (CSV if ".csv", NDJSON otherwise);
+    // only settable by editing the file
+    std::optional<std::filesystem::path> TelemetryFilePath;
+    std::optional<float> TelemetrySampleRate; // Samples per second
+
     BootSettings()
         : DoForceNoGlFinish()
         , DoForceNoMultithreadedRendering()
+        , DoForceNoGpuInteriorView()
+        , TelemetryFilePath()
+        , TelemetrySampleRate()
     {}
 
     BootSettings(
@@ -25,12 +37,18 @@ public:
         std::optional<bool> doForceNoMultithreadedRendering)
         : DoForceNoGlFinish(doForceNoGlFinish)
         , DoForceNoMultithreadedRendering(doForceNoMultithreadedRendering)
+        , DoForceNoGpuInteriorView()
+        , TelemetryFilePath()
+        , TelemetrySampleRate()
     {}
 
     bool operator==(BootSettings const & rhs) const
     {
         return this->DoForceNoGlFinish == rhs.DoForceNoGlFinish
-            && this->DoForceNoMultithreadedRendering == rhs.DoForceNoMultithreadedRendering;
+            && this->DoForceNoMultithreadedRendering == rhs.DoForceNoMultithreadedRendering
+            && this->DoForceNoGpuInteriorView == rhs.DoForceNoGpuInteriorView
+            && this->TelemetryFilePath == rhs.TelemetryFilePath
+            && this->TelemetrySampleRate == rhs.TelemetrySampleRate;
     }
 
 public:
@@ -21,6 +21,7 @@
 
 #include <Core/BuildInfo.h>
 #include <Core/Log.h>
+#include <Core/StartupTimeline.h>
 #include <Core/SysSpecifics.h>
 #include <Core/ThreadManager.h>
 
@@ -104,9 +105,17 @@ bool CalculateIsRenderingMultithreaded(std::optional<bool> doForceNoMultithreade
 
 size_t CalculateInitialSimulationParallelism(bool isRenderingMultiThreaded)
 {
-    return std::min(
-        size_t(4),
-        ThreadManager::GetNumberOfProcessors() - (isRenderingMultiThreaded ? 1 : 0));
+    // On heterogeneous CPUs we only count performance processors, and the render
+    // thread goes to efficiency processors
+    bool const isRenderingOnSimulationProcessors =
+        isRenderingMultiThreaded
+        && !ThreadManager::GetProcessorClasses().IsHeterogeneous();
+
+    return std::max(
+        size_t(1),
+        std::min(
+            size_t(4),
+            ThreadManager::GetNumberOfPerformanceProcessors() - (isRenderingOnSimulationProcessors ? 1 : 0)));
 }
 
 class MainApp final : public wxApp
@@ -236,6 +245,9 @@ MainApp::~MainApp()
 
 bool MainApp::OnInit()
 {
+    // Start the startup timeline now
+    StartupTimeline::GetInstance();
+
     if (!wxApp::OnInit())
     {
         return false;
@@ -247,7 +259,10 @@ bool MainApp::OnInit()
         // Initialize asset manager, using executable's path
         //
 
-        mGameAssetManager = std::make_unique<GameAssetManager>(std::string(argv[0]));
+        {
+            ScopedStartupStage const stage("GameAssetManager");
+            mGameAssetManager = std::make_unique<GameAssetManager>(std::string(argv[0]));
+        }
 
         //
         // Load boot settings
@@ -281,8 +296,11 @@ bool MainApp::OnInit()
         wxInitAllImageHandlers();
 
         // Language
-        auto const preferredLanguage = UIPreferencesManager::LoadPreferredLanguage();
-        mLocalizationManager = LocalizationManager::CreateInstance(preferredLanguage, *mGameAssetManager);
+        {
+            ScopedStartupStage const stage("LocalizationManager");
+            auto const preferredLanguage = UIPreferencesManager::LoadPreferredLanguage();
+            mLocalizationManager = LocalizationManager::CreateInstance(preferredLanguage, *mGameAssetManager);
+        }
 
         //
         // See if we've been given a ship file path to start with
@@ -19,6 +19,7 @@
 
 #include <Core/GameException.h>
 #include <Core/Log.h>
+#include <Core/StartupTimeline.h>
 
 #include <wx/intl.h>
 #include <wx/msgdlg.h>
@@ -28,6 +29,7 @@
 #include <wx/string.h>
 #include <wx/tooltip.h>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <ctime>
@@ -51,6 +53,7 @@ long const ID_RELOAD_CURRENT_SHIP_MENUITEM = wxNewId();
 long const ID_RELOAD_PREVIOUS_SHIP_MENUITEM = wxNewId();
 long const ID_MORE_SHIPS_MENUITEM = wxNewId();
 long const ID_SAVE_SCREENSHOT_MENUITEM = wxNewId();
+long const ID_RECORD_FRAMES_MENUITEM = wxNewId();
 long const ID_OPEN_SCREENSHOT_FOLDER_MENUITEM = wxNewId();
 long const ID_QUIT_MENUITEM = wxNewId();
 
@@ -122,6 +125,7 @@ MainFrame::MainFrame(
     , mSettingsManager()
     , mUIPreferencesManager()
     , mUpdateChecker()
+    , mScreenshotWriter(std::make_unique<ScreenshotWriter>(std::max(ThreadManager::GetNumberOfProcessors() / 2, size_t(1))))
     , mMainPanel(nullptr)
     , mMainGLCanvas(nullptr)
     , mMainGLCanvasContext()
@@ -137,11 +141,16 @@ MainFrame::MainFrame(
     , mHasStartupTipBeenChecked(false)
     , mIsGameFrozen(false)
     , mPauseCount(0)
+    , mLastUserInteractionTimestamp(std::chrono::steady_clock::now())
+    , mIsGameTimerThrottled(false)
     , mCurrentShipTitles()
     , mCurrentRCBombCount(0u)
     , mCurrentAntiMatterBombCount(0u)
     , mIsShiftKeyDown(false)
     , mIsMouseCapturedByGLCanvas(false)
+    , mRequestedScreenshotFilePaths()
+    , mFrameRecordingFilePathPrefix()
+    , mRecordedFrameCount(0)
 {
     Create(
         nullptr,
@@ -278,6 +287,10 @@ MainFrame::MainFrame(
             fileMenu->Append(saveScreenshotMenuItem);
             Connect(ID_SAVE_SCREENSHOT_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnSaveScreenshotMenuItemSelected);
 
+            wxMenuItem * recordFramesMenuItem = new wxMenuItem(fileMenu, ID_RECORD_FRAMES_MENUITEM, _("Record Frames") + wxS("\tCtrl+Shift+C"), _("Save a screenshot of each frame"), wxITEM_CHECK);
+            fileMenu->Append(recordFramesMenuItem);
+            Connect(ID_RECORD_FRAMES_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnRecordFramesMenuItemSelected);
+
             wxMenuItem * openScreenshotFolderMenuItem = new wxMenuItem(fileMenu, ID_OPEN_SCREENSHOT_FOLDER_MENUITEM, _("Open Screenshots Folder"));
             fileMenu->Append(openScreenshotFolderMenuItem);
             fileMenu->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent &) { wxLaunchDefaultBrowser(mUIPreferencesManager->GetScreenshotsFolderPath().string()); }, ID_OPEN_SCREENSHOT_FOLDER_MENUITEM);
@@ -848,6 +861,8 @@ bool MainFrame::ProcessKeyDown(
     int keyCode,
     int keyModifiers)
 {
+    OnUserInteraction();
+
     if (keyCode == WXK_LEFT)
     {
         if (!!mGameController && !!mUIPreferencesManager)
@@ -929,6 +944,8 @@ bool MainFrame::ProcessKeyUp(
     int keyCode,
     int keyModifiers)
 {
+    OnUserInteraction();
+
     // Deliver to electric panel
     if (!!mElectricalPanel)
     {
@@ -1035,6 +1052,8 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
 
     try
     {
+        ScopedStartupStage const stage("GameController::Create");
+
         mGameController = GameController::Create(
             RenderDeviceProperties(
                 DisplayLogicalSize(
@@ -1043,6 +1062,9 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
                 mMainGLCanvas->GetContentScaleFactor(),
                 mBootSettings.DoForceNoGlFinish,
                 mBootSettings.DoForceNoMultithreadedRendering,
+                mBootSettings.DoForceNoGpuInteriorView,
+                StandardSystemPaths::GetInstance().GetUserGameRootFolderPath() / "ShaderCache",
+                StandardSystemPaths::GetInstance().GetUserGameRootFolderPath() / "TextureAtlasCache",
                 std::bind(&MainFrame::MakeOpenGLContextCurrent, this),
                 [this]()
                 {
@@ -1080,6 +1102,21 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
         return;
     }
 
+    if (mBootSettings.TelemetryFilePath.has_value())
+    {
+        try
+        {
+            mGameController->StartTelemetry(
+                *mBootSettings.TelemetryFilePath,
+                mBootSettings.TelemetrySampleRate.value_or(4.0f));
+        }
+        catch (std::exception const & e)
+        {
+            // Not worth failing the game for
+            LogMessage("MainFrame::OnPostInitializeTrigger: cannot start telemetry: ", e.what());
+        }
+    }
+
     this->mMainApp->Yield();
 
 
@@ -1089,6 +1126,8 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
 
     try
     {
+        ScopedStartupStage const stage("SoundController");
+
         mSoundController = std::make_unique<SoundController>(
             mGameAssetManager,
             ProgressCallback(
@@ -1120,6 +1159,8 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
 
     try
     {
+        ScopedStartupStage const stage("MusicController");
+
         mMusicController = std::make_unique<MusicController>(
             mGameAssetManager,
             ProgressCallback(
@@ -1204,6 +1245,8 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
 
     try
     {
+        ScopedStartupStage const stage("ToolController");
+
         mToolController = std::make_unique<ToolController>(
             InitialNonNpcToolType,
             mGameController->GetEffectiveAmbientLightIntensity(),
@@ -1248,9 +1291,9 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
                 mLocalizationManager,
                 mGameController->GetMaterialDatabase(),
                 mGameController->GetShipTexturizer(),
-                [this](std::optional<std::filesystem::path> shipFilePath)
+                [this](std::optional<std::filesystem::path> shipFilePath, std::optional<ShipDefinition> shipDefinition)
                 {
-                    this->SwitchFromShipBuilder(shipFilePath);
+                    this->SwitchFromShipBuilder(std::move(shipFilePath), std::move(shipDefinition));
                 },
                 ProgressCallback(
                     [&splash, this](float progress, ProgressMessageType message)
@@ -1342,6 +1385,8 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
 
     try
     {
+        ScopedStartupStage const stage("InitialShip");
+
         mGameController->AddShip(*startupShipLoadSpecs, mGameAssetManager);
 
         // Succeeded
@@ -1389,6 +1434,7 @@ void MainFrame::OnPostInitializeTrigger(wxTimerEvent & /*event*/)
     auto const postInitializeEndTimestamp = std::chrono::steady_clock::now();
     auto const elapsed = std::chrono::duration_cast<std::chrono::duration<float>>(postInitializeEndTimestamp - postInitializeStartTimestamp);
     LogMessage("Post-Initialize took ", elapsed.count(), "s");
+    StartupTimeline::GetInstance().LogAndClear();
 
 
     //
@@ -1582,6 +1628,8 @@ void MainFrame::OnMainGLCanvasPaint(wxPaintEvent & event)
 
 void MainFrame::OnMainGLCanvasResize(wxSizeEvent & event)
 {
+    OnUserInteraction();
+
     LogMessage("OnMainGLCanvasResize: ", event.GetSize().GetX(), "x", event.GetSize().GetY(),
         (mGameController) ? " (With GameController)" : " (Without GameController)");
 
@@ -1600,6 +1648,8 @@ void MainFrame::OnMainGLCanvasResize(wxSizeEvent & event)
 
 void MainFrame::OnMainGLCanvasMouseLeftDown(wxMouseEvent & /*event*/)
 {
+    OnUserInteraction();
+
     // First of all, set focus on the canvas if it has lost it - we want
     // it to receive all mouse events
     if (!mMainGLCanvas->HasFocus())
@@ -1623,6 +1673,8 @@ void MainFrame::OnMainGLCanvasMouseLeftDown(wxMouseEvent & /*event*/)
 
 void MainFrame::OnMainGLCanvasMouseLeftUp(wxMouseEvent & /*event*/)
 {
+    OnUserInteraction();
+
     // We can now release the mouse
     if (mIsMouseCapturedByGLCanvas)
     {
@@ -1638,6 +1690,8 @@ void MainFrame::OnMainGLCanvasMouseLeftUp(wxMouseEvent & /*event*/)
 
 void MainFrame::OnMainGLCanvasMouseRightDown(wxMouseEvent & /*event*/)
 {
+    OnUserInteraction();
+
     if (mToolController)
     {
         mToolController->OnRightMouseDown();
@@ -1653,6 +1707,8 @@ void MainFrame::OnMainGLCanvasMouseRightDown(wxMouseEvent & /*event*/)
 
 void MainFrame::OnMainGLCanvasMouseRightUp(wxMouseEvent & /*event*/)
 {
+    OnUserInteraction();
+
     // We can now release the mouse
     if (mIsMouseCapturedByGLCanvas)
     {
@@ -1668,11 +1724,15 @@ void MainFrame::OnMainGLCanvasMouseRightUp(wxMouseEvent & /*event*/)
 
 void MainFrame::OnMainGLCanvasMouseMiddleDown(wxMouseEvent & /*event*/)
 {
+    OnUserInteraction();
+
     OnMidMouseButtonDown();
 }
 
 void MainFrame::OnMainGLCanvasMouseMove(wxMouseEvent & event)
 {
+    OnUserInteraction();
+
     if (mToolController)
     {
         mToolController->OnMouseMove(
@@ -1684,6 +1744,8 @@ void MainFrame::OnMainGLCanvasMouseMove(wxMouseEvent & event)
 
 void MainFrame::OnMainGLCanvasMouseWheel(wxMouseEvent & event)
 {
+    OnUserInteraction();
+
     if (mGameController)
     {
         mGameController->AdjustZoom(powf(1.002f, event.GetWheelRotation()));
@@ -1752,91 +1814,57 @@ void MainFrame::OnSaveScreenshotMenuItemSelected(wxCommandEvent & /*event*/)
     assert(!!mSoundController);
     mSoundController->PlaySnapshotSound();
 
-    try
-    {
-        //
-        // Take screenshot
-        //
-
-        assert(!!mGameController);
-        auto screenshotImage = mGameController->TakeScreenshot();
-
-        //
-        // Ensure pictures folder exists
-        //
-
-        assert(!!mUIPreferencesManager);
-        auto const folderPath = mUIPreferencesManager->GetScreenshotsFolderPath();
-
-        if (!std::filesystem::exists(folderPath))
-        {
-            try
-            {
-                std::filesystem::create_directories(folderPath);
-            }
-            catch (std::filesystem::filesystem_error const & fex)
-            {
-                OnError(
-                    std::string("Could not save screenshot to path \"") + folderPath.string() + "\": " + fex.what(),
-                    false);
-
-                return;
-            }
-        }
-
-        //
-        // Choose filename
-        //
+    //
+    // Ensure pictures folder exists
+    //
 
-        std::filesystem::path screenshotFilePath;
+    auto const folderPath = EnsureScreenshotsFolder();
+    if (!folderPath.has_value())
+    {
+        return;
+    }
 
-        std::string shipName = mCurrentShipTitles.empty()
-            ? "NoShip"
-            : mCurrentShipTitles.back();
+    //
+    // Choose filename
+    //
 
-        do
-        {
-            auto now = std::chrono::system_clock::now();
-            auto now_time_t = std::chrono::system_clock::to_time_t(now);
-            auto const tm = std::localtime(&now_time_t);
+    std::filesystem::path screenshotFilePath;
 
-            std::stringstream ssFilename;
-            ssFilename.fill('0');
-            ssFilename
-                << std::setw(4) << (1900 + tm->tm_year) << std::setw(2) << (1 + tm->tm_mon) << std::setw(2) << tm->tm_mday
-                << "_"
-                << std::setw(2) << tm->tm_hour << std::setw(2) << tm->tm_min << std::setw(2) << tm->tm_sec
-                << "_"
-                << std::setw(3) << std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch() % std::chrono::seconds(1)).count()
-                << "_"
-                << shipName
-                << ".png";
+    do
+    {
+        screenshotFilePath = *folderPath / (MakeScreenshotFilenameStem() + ".png");
 
-            screenshotFilePath = folderPath / ssFilename.str();
+    } while (std::filesystem::exists(screenshotFilePath)
+        || std::find(mRequestedScreenshotFilePaths.cbegin(), mRequestedScreenshotFilePaths.cend(), screenshotFilePath) != mRequestedScreenshotFilePaths.cend());
 
-        } while (std::filesystem::exists(screenshotFilePath));
+    //
+    // Take screenshot - asynchronously; we'll save it once
+    // it's been read back
+    //
 
-        //
-        // Save screenshot
-        //
+    assert(!!mGameController);
+    mGameController->RequestScreenshot();
+    mRequestedScreenshotFilePaths.push_back(screenshotFilePath);
+}
 
-        try
-        {
-            GameAssetManager::SavePngImage(
-                screenshotImage,
-                screenshotFilePath);
-        }
-        catch (std::filesystem::filesystem_error const & fex)
+void MainFrame::OnRecordFramesMenuItemSelected(wxCommandEvent & event)
+{
+    if (event.IsChecked())
+    {
+        auto const folderPath = EnsureScreenshotsFolder();
+        if (!folderPath.has_value())
         {
-            OnError(
-                std::string("Could not save screenshot to file \"") + screenshotFilePath.string() + "\": " + fex.what(),
-                false);
+            GetMenuBar()->Check(ID_RECORD_FRAMES_MENUITEM, false);
+            return;
         }
+
+        // Frames are requested at each game iteration, from now on
+        mFrameRecordingFilePathPrefix = *folderPath / (MakeScreenshotFilenameStem() + "_");
+        mRecordedFrameCount = 0;
     }
-    catch (std::exception const & ex)
+    else
     {
-        OnError(std::string("Could not take screenshot: ") + ex.what(), false);
-        return;
+        mFrameRecordingFilePathPrefix.reset();
     }
 }
 
@@ -1911,6 +1939,8 @@ void MainFrame::OnPauseMenuItemSelected(wxCommandEvent & /*event*/)
 
 void MainFrame::OnStepMenuItemSelected(wxCommandEvent & /*event*/)
 {
+    OnUserInteraction();
+
     assert(!!mGameController);
 
     mGameController->PulseUpdateAtNextGameIteration();
@@ -2222,7 +2252,7 @@ void MainFrame::RunGameIteration()
         // iteration callbacks.
         //
 
-        PostGameStepTimer(mGameTimerDuration);
+        PostGameStepTimer(CalculateGameTimerDuration());
     }
 #else
     std::chrono::steady_clock::time_point const startTimestamp = std::chrono::steady_clock::now();
@@ -2248,6 +2278,16 @@ void MainFrame::RunGameIteration()
         ////    !!mSplashScreenDialog ? std::to_string(mSplashScreenDialog->IsShown()) : "<NoSplash>",
         ////    " IsMainGLCanvasShown=", !!mMainGLCanvas ? std::to_string(mMainGLCanvas->IsShown()) : "<NoCanvas>",
         ////    " IsFrameShown=", std::to_string(this->IsShown()));
+        if (mFrameRecordingFilePathPrefix.has_value())
+        {
+            // Record the frame of this iteration
+            std::ostringstream ssFrame;
+            ssFrame << std::setfill('0') << std::setw(6) << mRecordedFrameCount++;
+
+            mGameController->RequestScreenshot();
+            mRequestedScreenshotFilePaths.emplace_back(mFrameRecordingFilePathPrefix->string() + ssFrame.str() + ".png");
+        }
+
         mGameController->RunGameIteration();
 
         // Update probe panel
@@ -2268,6 +2308,9 @@ void MainFrame::RunGameIteration()
 
         // Do after-render chores
         AfterGameRender();
+
+        // Hand screenshots that have been read back to the writer
+        SaveTakenScreenshots();
     }
     catch (std::exception const & e)
     {
@@ -2312,7 +2355,7 @@ void MainFrame::RunGameIteration()
     //
 
     auto const nextIterationDelay =
-        mGameTimerDuration
+        CalculateGameTimerDuration()
         - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTimestamp);
 
     if (nextIterationDelay.count() <= 0)
@@ -2330,6 +2373,84 @@ void MainFrame::RunGameIteration()
 #endif
 }
 
+std::optional<std::filesystem::path> MainFrame::EnsureScreenshotsFolder()
+{
+    assert(!!mUIPreferencesManager);
+    auto const folderPath = mUIPreferencesManager->GetScreenshotsFolderPath();
+
+    if (!std::filesystem::exists(folderPath))
+    {
+        try
+        {
+            std::filesystem::create_directories(folderPath);
+        }
+        catch (std::filesystem::filesystem_error const & fex)
+        {
+            OnError(
+                std::string("Could not save screenshot to path \"") + folderPath.string() + "\": " + fex.what(),
+                false);
+
+            return std::nullopt;
+        }
+    }
+
+    return folderPath;
+}
+
+std::string MainFrame::MakeScreenshotFilenameStem() const
+{
+    std::string shipName = mCurrentShipTitles.empty()
+        ? "NoShip"
+        : mCurrentShipTitles.back();
+
+    auto now = std::chrono::system_clock::now();
+    auto now_time_t = std::chrono::system_clock::to_time_t(now);
+    auto const tm = std::localtime(&now_time_t);
+
+    std::stringstream ssFilename;
+    ssFilename.fill('0');
+    ssFilename
+        << std::setw(4) << (1900 + tm->tm_year) << std::setw(2) << (1 + tm->tm_mon) << std::setw(2) << tm->tm_mday
+        << "_"
+        << std::setw(2) << tm->tm_hour << std::setw(2) << tm->tm_min << std::setw(2) << tm->tm_sec
+        << "_"
+        << std::setw(3) << std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch() % std::chrono::seconds(1)).count()
+        << "_"
+        << shipName;
+
+    return ssFilename.str();
+}
+
+void MainFrame::SaveTakenScreenshots()
+{
+    assert(!!mGameController);
+    assert(!!mScreenshotWriter);
+
+    for (auto & screenshotImage : mGameController->PopTakenScreenshots())
+    {
+        assert(!mRequestedScreenshotFilePaths.empty());
+
+        mScreenshotWriter->Write(
+            std::move(screenshotImage),
+            mRequestedScreenshotFilePaths.front());
+
+        mRequestedScreenshotFilePaths.pop_front();
+    }
+
+    auto const errors = mScreenshotWriter->PopErrors();
+    if (!errors.empty())
+    {
+        // Stop recording, or else we'd keep failing
+        if (mFrameRecordingFilePathPrefix.has_value())
+        {
+            mFrameRecordingFilePathPrefix.reset();
+            GetMenuBar()->Check(ID_RECORD_FRAMES_MENUITEM, false);
+        }
+
+        OnError(errors.front(), false);
+    }
+}
+
 void MainFrame::OnError(
     wxString const & message,
     bool die)
@@ -2434,6 +2555,8 @@ void MainFrame::ThawGame()
 
 void MainFrame::SetPaused(bool isPaused)
 {
+    OnUserInteraction();
+
     if (isPaused)
     {
         if (0 == mPauseCount)
@@ -2491,6 +2614,44 @@ void MainFrame::PostGameStepTimer(std::chrono::milliseconds duration)
         true); // One-shot
 }
 
+std::chrono::milliseconds MainFrame::CalculateGameTimerDuration()
+{
+    //
+    // While paused, and after a while without user interactions, nothing moves
+    // on screen but the odd animation; we then run - and thus re-render - at a
+    // low rate, so to spare the CPU and the GPU
+    //
+
+    auto constexpr IdleUserInteractionDelay = std::chrono::seconds(1);
+    auto constexpr ThrottledGameTimerDuration = std::chrono::milliseconds(250);
+
+    mIsGameTimerThrottled =
+        IsPaused()
+        && !mIsMouseCapturedByGLCanvas // Tools may be working
+        && !mFrameRecordingFilePathPrefix.has_value()
+        && std::chrono::steady_clock::now() - mLastUserInteractionTimestamp > IdleUserInteractionDelay;
+
+    return mIsGameTimerThrottled
+        ? ThrottledGameTimerDuration
+        : mGameTimerDuration;
+}
+
+void MainFrame::OnUserInteraction()
+{
+    mLastUserInteractionTimestamp = std::chrono::steady_clock::now();
+
+    if (mIsGameTimerThrottled)
+    {
+        // Cut the current throttled wait short
+        mIsGameTimerThrottled = false;
+
+        if (mGameTimer && mGameTimer->IsRunning())
+        {
+            PostGameStepTimer(mGameTimerDuration);
+        }
+    }
+}
+
 void MainFrame::StartLowFrequencyTimer()
 {
     assert(mLowFrequencyTimer);
@@ -2956,6 +3117,14 @@ std::filesystem::path MainFrame::ChooseDefaultShip(GameAssetManager const & game
 void MainFrame::LoadShip(
     ShipLoadSpecifications const & loadSpecs,
     bool isFromUser)
+{
+    LoadShip(loadSpecs, std::nullopt, isFromUser);
+}
+
+void MainFrame::LoadShip(
+    ShipLoadSpecifications const & loadSpecs,
+    std::optional<ShipDefinition> && shipDefinition,
+    bool isFromUser)
 {
     //
     // Reset
@@ -2980,7 +3149,9 @@ void MainFrame::LoadShip(
     {
         // Load
         assert(mGameController);
-        auto const shipMetadata = mGameController->ResetAndLoadShip(loadSpecs, mGameAssetManager);
+        auto const shipMetadata = shipDefinition.has_value()
+            ? mGameController->ResetAndLoadShip(loadSpecs, std::move(*shipDefinition), mGameAssetManager)
+            : mGameController->ResetAndLoadShip(loadSpecs, mGameAssetManager);
 
         // Succeeded
         OnShipLoaded(loadSpecs);
@@ -3100,7 +3271,9 @@ void MainFrame::SwitchToShipBuilderForCurrentShip()
     mShipBuilderMainFrame->OpenForLoadShip(mCurrentShipLoadSpecs->DefinitionFilepath, mUIPreferencesManager->GetDisplayUnitsSystem());
 }
 
-void MainFrame::SwitchFromShipBuilder(std::optional<std::filesystem::path> shipFilePath)
+void MainFrame::SwitchFromShipBuilder(
+    std::optional<std::filesystem::path> shipFilePath,
+    std::optional<ShipDefinition> shipDefinition)
 {
     // Show us
     Show(true);
@@ -3114,8 +3287,8 @@ void MainFrame::SwitchFromShipBuilder(std::optional<std::filesystem::path> shipF
 
     if (shipFilePath.has_value())
     {
-        // Load the ship
-        LoadShip(ShipLoadSpecifications(*shipFilePath), false);
+        // Load the ship - straight from the builder's definition, when we've been handed it
+        LoadShip(ShipLoadSpecifications(*shipFilePath), std::move(shipDefinition), false);
     }
     else
     {
@@ -7,6 +7,7 @@
 
 #include "BootSettings.h"
 #include "MusicController.h"
+#include "ScreenshotWriter.h"
 #include "SettingsManager.h"
 #include "SoundController.h"
 #include "ToolController.h"
@@ -45,9 +46,11 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 /*
@@ -107,6 +110,7 @@ private:
     std::unique_ptr<SettingsManager> mSettingsManager;
     std::unique_ptr<UIPreferencesManager> mUIPreferencesManager;
     std::unique_ptr<UpdateChecker> mUpdateChecker;
+    std::unique_ptr<ScreenshotWriter> mScreenshotWriter;
 
     UnFocusablePanel * mMainPanel;
 
@@ -236,6 +240,7 @@ private:
     void OnLoadShipMenuItemSelected(wxCommandEvent & event);
     void OnReloadPreviousShipMenuItemSelected(wxCommandEvent & event);
     void OnSaveScreenshotMenuItemSelected(wxCommandEvent & event);
+    void OnRecordFramesMenuItemSelected(wxCommandEvent & event);
 
     void OnTriggerLightningMenuItemSelected(wxCommandEvent & event);
     void OnRCBombDetonateMenuItemSelected(wxCommandEvent & event);
@@ -370,6 +375,12 @@ private:
 
     void RunGameIteration();
 
+    std::optional<std::filesystem::path> EnsureScreenshotsFolder();
+
+    std::string MakeScreenshotFilenameStem() const;
+
+    void SaveTakenScreenshots();
+
     void MakeOpenGLContextCurrent()
     {
         LogMessage("MainFrame::MakeOpenGLContextCurrent()");
@@ -416,6 +427,10 @@ private:
 
     void PostGameStepTimer(std::chrono::milliseconds duration);
 
+    std::chrono::milliseconds CalculateGameTimerDuration();
+
+    void OnUserInteraction();
+
     void StartLowFrequencyTimer();
 
     void ResetShipUIState();
@@ -442,6 +457,11 @@ private:
         ShipLoadSpecifications const & loadSpecs,
         bool isFromUser);
 
+    void LoadShip(
+        ShipLoadSpecifications const & loadSpecs,
+        std::optional<ShipDefinition> && shipDefinition, // When already in memory
+        bool isFromUser);
+
     void ReloadCurrentShip();
 
     void OnShipLoaded(ShipLoadSpecifications loadSpecs); // By val to have own copy vs current/prev
@@ -452,7 +472,9 @@ private:
 
     void SwitchToShipBuilderForCurrentShip();
 
-    void SwitchFromShipBuilder(std::optional<std::filesystem::path> shipFilePath);
+    void SwitchFromShipBuilder(
+        std::optional<std::filesystem::path> shipFilePath,
+        std::optional<ShipDefinition> shipDefinition);
 
     std::tuple<wxBitmap, wxBitmap> MakeMenuBitmaps(std::string const & iconName) const;
 
@@ -475,9 +497,18 @@ private:
     bool mHasStartupTipBeenChecked;
     bool mIsGameFrozen;
     int mPauseCount;
+    std::chrono::steady_clock::time_point mLastUserInteractionTimestamp; // For throttling the game timer while paused
+    bool mIsGameTimerThrottled;
     std::vector<std::string> mCurrentShipTitles;
     size_t mCurrentRCBombCount;
     size_t mCurrentAntiMatterBombCount;
     bool mIsShiftKeyDown; // Implements SHIFT state machine; mutex with GameController::IsShiftOn
     bool mIsMouseCapturedByGLCanvas;
+
+    // The files that the requested screenshots are to be saved to, in request order
+    std::deque<std::filesystem::path> mRequestedScreenshotFilePaths;
+
+    // Set while recording frames
+    std::optional<std::filesystem::path> mFrameRecordingFilePathPrefix;
+    size_t mRecordedFrameCount;
 };
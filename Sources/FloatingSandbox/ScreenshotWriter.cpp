@@ -0,0 +1,125 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "ScreenshotWriter.h"
+
+#include <Game/FileStreams.h>
+
+#include <Core/Log.h>
+#include <Core/PngTools.h>
+
+#include <cassert>
+
+ScreenshotWriter::ScreenshotWriter(size_t parallelism)
+    : mQueuedScreenshots()
+    , mErrors()
+    , mIsStopping(false)
+    , mLock()
+    , mScreenshotQueuedSignal()
+    , mScreenshotDequeuedSignal()
+    , mWorkerThreads()
+{
+    assert(parallelism > 0);
+
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        mWorkerThreads.emplace_back(&ScreenshotWriter::WorkerThread, this);
+    }
+}
+
+ScreenshotWriter::~ScreenshotWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mIsStopping = true;
+    }
+
+    mScreenshotQueuedSignal.notify_all();
+
+    for (auto & workerThread : mWorkerThreads)
+    {
+        assert(workerThread.joinable());
+        workerThread.join();
+    }
+}
+
+void ScreenshotWriter::Write(
+    RgbImageData && image,
+    std::filesystem::path const & filePath)
+{
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+
+        mScreenshotDequeuedSignal.wait(
+            lock,
+            [this]
+            {
+                return mQueuedScreenshots.size() < MaxQueuedScreenshots;
+            });
+
+        mQueuedScreenshots.emplace_back(std::move(image), filePath);
+    }
+
+    mScreenshotQueuedSignal.notify_one();
+}
+
+std::vector<std::string> ScreenshotWriter::PopErrors()
+{
+    std::vector<std::string> errors;
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        std::swap(errors, mErrors);
+    }
+
+    return errors;
+}
+
+void ScreenshotWriter::WorkerThread()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+
+        mScreenshotQueuedSignal.wait(
+            lock,
+            [this]
+            {
+                return !mQueuedScreenshots.empty() || mIsStopping;
+            });
+
+        if (mQueuedScreenshots.empty())
+        {
+            // Stopping, and nothing left to save
+            break;
+        }
+
+        QueuedScreenshot screenshot = std::move(mQueuedScreenshots.front());
+        mQueuedScreenshots.pop_front();
+
+        lock.unlock();
+        mScreenshotDequeuedSignal.notify_one();
+
+        //
+        // Encode and save
+        //
+
+        try
+        {
+            auto writeStream = FileBinaryWriteStream(screenshot.FilePath);
+            PngTools::EncodeImage(
+                screenshot.Image,
+                writeStream,
+                PngTools::CompressionSpeedType::Fast);
+        }
+        catch (std::exception const & ex)
+        {
+            LogMessage("ScreenshotWriter: error saving \"", screenshot.FilePath.string(), "\": ", ex.what());
+
+            std::lock_guard<std::mutex> errorLock(mLock);
+            mErrors.emplace_back(std::string("Could not save screenshot to file \"") + screenshot.FilePath.string() + "\": " + ex.what());
+        }
+    }
+}
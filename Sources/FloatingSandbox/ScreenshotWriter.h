@@ -0,0 +1,79 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Core/ImageData.h>
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * This class encodes and saves screenshots on background threads, so that
+ * taking screenshots - even one per frame, when recording - does not stall
+ * the game.
+ *
+ * Screenshots are encoded in parallel, hence they may be saved out of order.
+ */
+class ScreenshotWriter
+{
+public:
+
+    explicit ScreenshotWriter(size_t parallelism);
+
+    /*
+     * Waits until all queued screenshots are saved.
+     */
+    ~ScreenshotWriter();
+
+    /*
+     * Queues a screenshot for saving; blocks while too many screenshots are queued,
+     * so to keep memory bounded when the game produces them faster than we can encode.
+     */
+    void Write(
+        RgbImageData && image,
+        std::filesystem::path const & filePath);
+
+    /*
+     * Returns the errors encountered since the last invocation.
+     */
+    std::vector<std::string> PopErrors();
+
+private:
+
+    void WorkerThread();
+
+private:
+
+    static size_t constexpr MaxQueuedScreenshots = 32;
+
+    struct QueuedScreenshot
+    {
+        RgbImageData Image;
+        std::filesystem::path FilePath;
+
+        QueuedScreenshot(
+            RgbImageData && image,
+            std::filesystem::path const & filePath)
+            : Image(std::move(image))
+            , FilePath(filePath)
+        {}
+    };
+
+    std::deque<QueuedScreenshot> mQueuedScreenshots;
+    std::vector<std::string> mErrors;
+    bool mIsStopping;
+
+    std::mutex mLock;
+    std::condition_variable mScreenshotQueuedSignal;
+    std::condition_variable mScreenshotDequeuedSignal;
+
+    std::vector<std::thread> mWorkerThreads;
+};
@@ -60,6 +60,7 @@ SoundController::SoundController(
     , mUOneShotMultipleChoiceSounds()
     , mOneShotMultipleChoiceSounds()
     , mCurrentlyPlayingOneShotSounds()
+    , mCurrentlyPlayingOneShotSoundsCount(0)
     // Continuous sounds
     , mSawedMetalSound(SawedInertiaDuration)
     , mSawedWoodSound(SawedInertiaDuration)
@@ -98,6 +99,9 @@ SoundController::SoundController(
     , mLoopedSounds(
         mMasterEffectsVolume,
         mMasterEffectsMuted)
+    , mSoundFilesToPrefetch()
+    , mIsPrefetchStopRequested(false)
+    , mPrefetchThread()
 {
     //
     // Initialize Sounds
@@ -118,7 +122,9 @@ SoundController::SoundController(
         // Load sound file
         //
 
-        std::unique_ptr<SoundFile> soundFile = SoundFile::Load(gameAssetManager.GetSoundFilePath(soundName));
+        // Decoded at first use or by the prefetch thread, whichever comes first
+        std::unique_ptr<SoundFile> soundFile = SoundFile::LoadLazily(gameAssetManager.GetSoundFilePath(soundName));
+        mSoundFilesToPrefetch.push_back(soundFile.get());
 
         //
         // Parse filename
@@ -941,10 +947,23 @@ SoundController::SoundController(
                 .Choices.emplace_back(std::move(soundFile));
         }
     }
+
+    //
+    // Start prefetching the sounds that have not been decoded yet
+    //
+
+    mPrefetchThread = std::thread(&SoundController::PrefetchThreadLoop, this);
 }
 
 SoundController::~SoundController()
 {
+    // Stop prefetching before the sound files go away
+    mIsPrefetchStopRequested.store(true);
+    if (mPrefetchThread.joinable())
+    {
+        mPrefetchThread.join();
+    }
+
     Reset();
 }
 
@@ -1125,16 +1144,7 @@ void SoundController::SetPlayBreakSounds(bool playBreakSounds)
 
     if (!mPlayBreakSounds)
     {
-        for (auto const & playingSoundIt : mCurrentlyPlayingOneShotSounds)
-        {
-            for (auto & playingSound : playingSoundIt.second)
-            {
-                if (SoundType::Break == playingSound.Type)
-                {
-                    playingSound.Sound->stop();
-                }
-            }
-        }
+        StopOneShotSounds(SoundType::Break);
     }
 }
 
@@ -1144,16 +1154,7 @@ void SoundController::SetPlayStressSounds(bool playStressSounds)
 
     if (!mPlayStressSounds)
     {
-        for (auto const & playingSoundIt : mCurrentlyPlayingOneShotSounds)
-        {
-            for (auto & playingSound : playingSoundIt.second)
-            {
-                if (SoundType::Stress == playingSound.Type)
-                {
-                    playingSound.Sound->stop();
-                }
-            }
-        }
+        StopOneShotSounds(SoundType::Stress);
     }
 }
 
@@ -1165,16 +1166,7 @@ void SoundController::SetPlayWindSound(bool playWindSound)
     {
         mWindSound.SetMuted(true);
 
-        for (auto const & playingSoundIt : mCurrentlyPlayingOneShotSounds)
-        {
-            for (auto & playingSound : playingSoundIt.second)
-            {
-                if (SoundType::WindGust == playingSound.Type)
-                {
-                    playingSound.Sound->stop();
-                }
-            }
-        }
+        StopOneShotSounds(SoundType::WindGust);
     }
     else
     {
@@ -1581,6 +1573,7 @@ void SoundController::Reset()
     }
 
     mCurrentlyPlayingOneShotSounds.clear();
+    mCurrentlyPlayingOneShotSoundsCount = 0;
 
     mSawedMetalSound.Reset();
     mSawedWoodSound.Reset();
@@ -3064,7 +3057,7 @@ void SoundController::PlayOneShotSound(
             else
             {
                 // Incorporate if it's exactly the same sound
-                doIncorporateWithExisting = (playingSound.Sound->getBuffer() == &soundFile.SoundBuffer);
+                doIncorporateWithExisting = (playingSound.Sound->getBuffer() == &soundFile.GetSoundBuffer());
             }
 
             if (doIncorporateWithExisting)
@@ -3095,6 +3088,30 @@ void SoundController::PlayOneShotSound(
 
     assert(thisTypeCurrentlyPlayingSounds.size() < maxPlayingSoundsForThisType);
 
+    //
+    // Make sure there's a voice for this sound
+    //
+
+    if (mCurrentlyPlayingOneShotSoundsCount >= MaxPlayingOneShotSounds)
+    {
+        for (auto & playingSoundIt : mCurrentlyPlayingOneShotSounds)
+        {
+            ScavengeStoppedSounds(playingSoundIt.second);
+        }
+
+        if (mCurrentlyPlayingOneShotSoundsCount >= MaxPlayingOneShotSounds)
+        {
+            // Need to steal the voice of a sound that is at most as important as this one
+            if (!ScavengeLowestPrioritySound(GetPriorityForType(soundType)))
+            {
+                // All voices are busy with more important sounds
+                return;
+            }
+        }
+    }
+
+    assert(mCurrentlyPlayingOneShotSoundsCount < MaxPlayingOneShotSounds);
+
     //
     // Create and play sound
     //
@@ -3137,21 +3154,24 @@ void SoundController::PlayOneShotSound(
         std::move(sound),
         now,
         isInterruptible);
+
+    ++mCurrentlyPlayingOneShotSoundsCount;
 }
 
 void SoundController::ScavengeStoppedSounds(std::vector<PlayingSound> & playingSounds)
 {
-    for (auto it = playingSounds.begin(); it != playingSounds.end(); /*incremented in loop*/)
+    // Order does not matter, hence swap-and-pop
+    for (size_t i = 0; i < playingSounds.size(); /*incremented in loop*/)
     {
-        assert(!!it->Sound);
-        if (sf::Sound::Status::Stopped == it->Sound->getStatus())
+        assert(!!playingSounds[i].Sound);
+        if (sf::Sound::Status::Stopped == playingSounds[i].Sound->getStatus())
         {
             // Scavenge
-            it = playingSounds.erase(it);
+            RemovePlayingSound(playingSounds, i);
         }
         else
         {
-            ++it;
+            ++i;
         }
     }
 }
@@ -3199,5 +3219,81 @@ void SoundController::ScavengeOldestSound(std::vector<PlayingSound> & playingSou
 
     assert(!!playingSounds[iSoundToStop].Sound);
     playingSounds[iSoundToStop].Sound->stop();
-    playingSounds.erase(playingSounds.begin() + iSoundToStop);
-}
\ No newline at end of file
+    RemovePlayingSound(playingSounds, iSoundToStop);
+}
+
+bool SoundController::ScavengeLowestPrioritySound(int maxPriority)
+{
+    std::vector<PlayingSound> * lowestPriorityPlayingSounds = nullptr;
+    int lowestPriority = maxPriority + 1;
+    for (auto & playingSoundIt : mCurrentlyPlayingOneShotSounds)
+    {
+        if (!playingSoundIt.second.empty())
+        {
+            int const priority = GetPriorityForType(playingSoundIt.first);
+            if (priority < lowestPriority
+                || (priority == lowestPriority
+                    && lowestPriorityPlayingSounds != nullptr
+                    && playingSoundIt.second.size() > lowestPriorityPlayingSounds->size()))
+            {
+                // Among equally-important types, the most crowded one gives up a voice
+                lowestPriorityPlayingSounds = &(playingSoundIt.second);
+                lowestPriority = priority;
+            }
+        }
+    }
+
+    if (lowestPriorityPlayingSounds == nullptr)
+    {
+        return false;
+    }
+
+    ScavengeOldestSound(*lowestPriorityPlayingSounds);
+
+    return true;
+}
+
+void SoundController::RemovePlayingSound(
+    std::vector<PlayingSound> & playingSounds,
+    size_t index)
+{
+    assert(index < playingSounds.size());
+
+    if (index != playingSounds.size() - 1)
+    {
+        playingSounds[index] = std::move(playingSounds.back());
+    }
+
+    playingSounds.pop_back();
+
+    assert(mCurrentlyPlayingOneShotSoundsCount > 0);
+    --mCurrentlyPlayingOneShotSoundsCount;
+}
+
+void SoundController::StopOneShotSounds(SoundType soundType)
+{
+    auto const playingSoundsIt = mCurrentlyPlayingOneShotSounds.find(soundType);
+    if (playingSoundsIt != mCurrentlyPlayingOneShotSounds.end())
+    {
+        for (auto & playingSound : playingSoundsIt->second)
+        {
+            playingSound.Sound->stop();
+        }
+    }
+}
+
+void SoundController::PrefetchThreadLoop()
+{
+    for (SoundFile const * soundFile : mSoundFilesToPrefetch)
+    {
+        if (mIsPrefetchStopRequested.load())
+        {
+            break;
+        }
+
+        // A no-op if the sound has been played in the meantime
+        soundFile->GetSoundBuffer();
+    }
+
+    LogMessage("SoundController: prefetched ", mSoundFilesToPrefetch.size(), " sounds");
+}
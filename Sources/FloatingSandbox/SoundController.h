@@ -20,6 +20,7 @@
 
 #include <SFML/Audio.hpp>
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <memory>
@@ -27,6 +28,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -514,6 +516,16 @@ private:
 
     void ScavengeOldestSound(std::vector<PlayingSound> & playingSounds);
 
+    bool ScavengeLowestPrioritySound(int maxPriority);
+
+    void RemovePlayingSound(
+        std::vector<PlayingSound> & playingSounds,
+        size_t index);
+
+    void StopOneShotSounds(SoundType soundType);
+
+    void PrefetchThreadLoop();
+
 private:
 
     //
@@ -570,6 +582,31 @@ private:
         }
     }
 
+    // Voices for all one-shot sounds together; leaves room to the continuous and looped sounds
+    // within the 256 sources that most OpenAL implementations provide
+    static size_t constexpr MaxPlayingOneShotSounds = 160;
+
+    // When all voices are busy, a new sound may only steal the voice of a sound with
+    // the same or lower priority
+    static constexpr int GetPriorityForType(SoundType soundType)
+    {
+        switch (soundType)
+        {
+            case SoundType::Break:
+            case SoundType::Stress:
+            case SoundType::LightFlicker:
+                return 0;
+            case SoundType::Error:
+            case SoundType::Snapshot:
+            case SoundType::BlastToolSlow1:
+            case SoundType::BlastToolSlow2:
+            case SoundType::BlastToolFast:
+                return 2;
+            default:
+                return 1;
+        }
+    }
+
     static constexpr std::chrono::milliseconds GetMinDeltaTimeSoundForType(SoundType soundType)
     {
         switch (soundType)
@@ -616,6 +653,7 @@ private:
         OneShotMultipleChoiceSound> mOneShotMultipleChoiceSounds;
 
     std::unordered_map<SoundType, std::vector<PlayingSound>> mCurrentlyPlayingOneShotSounds;
+    size_t mCurrentlyPlayingOneShotSoundsCount; // Across all types
 
     //
     // Continuous sounds
@@ -660,4 +698,13 @@ private:
     ContinuousMultipleChoiceAggregateSound<GlobalGadgetId> mAntiMatterBombContainedSounds;
 
     MultiInstanceLoopedSounds<GlobalElectricalElementId> mLoopedSounds;
+
+    //
+    // Prefetching
+    //
+
+    // Owned by the sounds above; the pointers outlive moves of the owning unique_ptr's
+    std::vector<SoundFile const *> mSoundFilesToPrefetch;
+    std::atomic<bool> mIsPrefetchStopRequested;
+    std::thread mPrefetchThread;
 };
@@ -249,4 +249,30 @@ std::unique_ptr<SoundFile> SoundFile::Load(std::filesystem::path const & soundFi
         new SoundFile(
             std::move(sb),
             soundFilePath.filename().string()));
-}
\ No newline at end of file
+}
+
+std::unique_ptr<SoundFile> SoundFile::LoadLazily(std::filesystem::path const & soundFilePath)
+{
+    if (!std::filesystem::exists(soundFilePath))
+    {
+        throw GameException("Cannot load sound \"" + soundFilePath.filename().string() + "\"");
+    }
+
+    return std::unique_ptr<SoundFile>(new SoundFile(soundFilePath));
+}
+
+void SoundFile::EnsureLoaded() const
+{
+    std::lock_guard<std::mutex> const lock(mLoadMutex);
+
+    if (!mIsLoaded.load(std::memory_order_relaxed))
+    {
+        if (!mSoundBuffer.loadFromFile(mSoundFilePath.string()))
+        {
+            // Too late to fail; play silence rather
+            LogMessage("ERROR: Cannot load sound \"", Filename, "\"");
+        }
+
+        mIsLoaded.store(true, std::memory_order_release);
+    }
+}
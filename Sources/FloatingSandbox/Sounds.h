@@ -15,11 +15,13 @@
 #include <SFML/Audio.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <limits>
 #include <optional>
 #include <set>
@@ -140,19 +142,54 @@ enum class SoundType : uint32_t
 
 SoundType StrToSoundType(std::string const & str);
 
+/*
+ * A sound's samples.
+ *
+ * Files may be loaded lazily, in which case the samples are only decoded at the
+ * first access - from whichever thread gets there first.
+ */
 struct SoundFile
 {
-    sf::SoundBuffer SoundBuffer;
     std::string Filename;
 
     static std::unique_ptr<SoundFile> Load(std::filesystem::path const & soundFilePath);
 
+    static std::unique_ptr<SoundFile> LoadLazily(std::filesystem::path const & soundFilePath);
+
+    /*
+     * Returns the samples, decoding them now if the file was loaded lazily and they
+     * have not been decoded yet.
+     *
+     * Thread-safe.
+     */
+    sf::SoundBuffer const & GetSoundBuffer() const
+    {
+        if (!mIsLoaded.load(std::memory_order_acquire))
+        {
+            EnsureLoaded();
+        }
+
+        return mSoundBuffer;
+    }
+
+    bool IsLoaded() const
+    {
+        return mIsLoaded.load(std::memory_order_acquire);
+    }
+
     std::unique_ptr<SoundFile> Clone() const
     {
-        return std::unique_ptr<SoundFile>(
-            new SoundFile(
-                sf::SoundBuffer(SoundBuffer),
-                Filename));
+        if (IsLoaded())
+        {
+            return std::unique_ptr<SoundFile>(
+                new SoundFile(
+                    sf::SoundBuffer(mSoundBuffer),
+                    Filename));
+        }
+        else
+        {
+            return LoadLazily(mSoundFilePath);
+        }
     }
 
 private:
@@ -160,15 +197,29 @@ private:
     SoundFile(
         sf::SoundBuffer && soundBuffer,
         std::string const & filename)
-        : SoundBuffer(std::move(soundBuffer))
-        , Filename(filename)
+        : Filename(filename)
+        , mSoundBuffer(std::move(soundBuffer))
+        , mSoundFilePath()
+        , mIsLoaded(true)
+        , mLoadMutex()
     {}
 
-    SoundFile(SoundFile const & other)
-    {
-        SoundBuffer = other.SoundBuffer;
-        Filename = other.Filename;
-    }
+    explicit SoundFile(std::filesystem::path const & soundFilePath)
+        : Filename(soundFilePath.filename().string())
+        , mSoundBuffer()
+        , mSoundFilePath(soundFilePath)
+        , mIsLoaded(false)
+        , mLoadMutex()
+    {}
+
+    SoundFile(SoundFile const & other) = delete;
+
+    void EnsureLoaded() const;
+
+    mutable sf::SoundBuffer mSoundBuffer;
+    std::filesystem::path const mSoundFilePath;
+    mutable std::atomic<bool> mIsLoaded;
+    mutable std::mutex mLoadMutex;
 };
 
 enum class SizeType : int
@@ -215,7 +266,7 @@ public:
         bool isMuted,
         std::chrono::milliseconds timeToFadeIn = std::chrono::milliseconds::zero(),
         std::chrono::milliseconds timeToFadeOut = std::chrono::milliseconds::zero())
-        : sf::Sound(soundFile.SoundBuffer)
+        : sf::Sound(soundFile.GetSoundBuffer())
         , mSoundFile(soundFile)
         , mIsPaused(false)
         , mDesiredPlayingStateAfterPause(false)
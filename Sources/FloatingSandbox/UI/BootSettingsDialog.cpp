@@ -216,9 +216,10 @@ void BootSettingsDialog::OnSaveAndQuitButton(wxCommandEvent & /*event*/)
     else if (mDoForceNoMultithreadedRendering_FalseRadioButton->GetValue())
         doForceNoMultithrededRendering = false;
 
-    BootSettings settings(
-        doForceNoGlFinish,
-        doForceNoMultithrededRendering);
+    // Start from the current settings, so to preserve those we don't show
+    BootSettings settings = BootSettings::Load(mGameAssetManager.GetBootSettingsFilePath());
+    settings.DoForceNoGlFinish = doForceNoGlFinish;
+    settings.DoForceNoMultithreadedRendering = doForceNoMultithrededRendering;
 
     BootSettings defaultSettings;
 
@@ -5,7 +5,12 @@
  ***************************************************************************************/
 #include "DebugDialog.h"
 
+#include <Core/GameException.h>
+#include <Core/PerfTrace.h>
+
+#include <wx/filedlg.h>
 #include <wx/gbsizer.h>
+#include <wx/msgdlg.h>
 #include <wx/notebook.h>
 #include <wx/settings.h>
 #include <wx/statbox.h>
@@ -78,6 +83,19 @@ DebugDialog::DebugDialog(
     }
 
 
+    //
+    // Performance Trace
+    //
+
+    {
+        wxPanel * perfTracePanel = new wxPanel(notebook);
+
+        PopulatePerfTracePanel(perfTracePanel);
+
+        notebook->AddPage(perfTracePanel, _("Performance Trace"));
+    }
+
+
     //
     // Finalize dialog
     //
@@ -245,8 +263,8 @@ void DebugDialog::PopulateEventRecordingPanel(wxPanel * panel)
                     [this](uint32_t eventIndex, RecordedEvent const & recordedEvent)
                     {
                         SetRecordedEventText(eventIndex, recordedEvent);
-                    }
-                );
+                    },
+                    std::filesystem::temp_directory_path() / "FloatingSandbox_Events.bin");
             });
 
         gridSizer->Add(
@@ -371,4 +389,79 @@ void DebugDialog::PopulateEventRecordingPanel(wxPanel * panel)
     // Finalize panel
 
     panel->SetSizerAndFit(gridSizer);
-}
\ No newline at end of file
+}
+
+void DebugDialog::PopulatePerfTracePanel(wxPanel * panel)
+{
+    wxGridBagSizer * gridSizer = new wxGridBagSizer(0, 0);
+
+    {
+        mPerfTraceStartButton = new wxButton(panel, wxID_ANY, _("Start"));
+
+        mPerfTraceStartButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mPerfTraceStartButton->Enable(false);
+                mPerfTraceStopButton->Enable(true);
+
+                PerfTrace::GetInstance().StartRecording();
+            });
+
+        gridSizer->Add(
+            mPerfTraceStartButton,
+            wxGBPosition(0, 0),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    {
+        mPerfTraceStopButton = new wxButton(panel, wxID_ANY, _("Stop and Save..."));
+
+        mPerfTraceStopButton->Enable(false);
+
+        mPerfTraceStopButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mPerfTraceStartButton->Enable(true);
+                mPerfTraceStopButton->Enable(false);
+
+                wxFileDialog saveDialog(
+                    this,
+                    _("Save Trace"),
+                    wxEmptyString,
+                    "FloatingSandbox_Trace.json",
+                    "Chrome trace files (*.json)|*.json",
+                    wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+
+                // Note: we stop recording even when the user cancels
+                std::filesystem::path outputFilePath = std::filesystem::temp_directory_path() / "FloatingSandbox_Trace.json";
+                if (saveDialog.ShowModal() == wxID_OK)
+                {
+                    outputFilePath = saveDialog.GetPath().ToStdString();
+                }
+
+                try
+                {
+                    PerfTrace::GetInstance().StopRecording(outputFilePath);
+                }
+                catch (GameException const & exc)
+                {
+                    wxMessageBox(exc.what(), _("Error"), wxICON_ERROR);
+                }
+            });
+
+        gridSizer->Add(
+            mPerfTraceStopButton,
+            wxGBPosition(0, 1),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    // Finalize panel
+
+    panel->SetSizerAndFit(gridSizer);
+}
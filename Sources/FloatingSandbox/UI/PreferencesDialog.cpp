@@ -311,6 +311,20 @@ void PreferencesDialog::OnContinuousAutoFocusOnShipCheckBoxClicked(wxCommandEven
     mOnChangeCallback();
 }
 
+void PreferencesDialog::OnDecoupledSimulationRateCheckBoxClicked(wxCommandEvent & /*event*/)
+{
+    mUIPreferencesManager.SetDoDecoupledSimulationRate(mDecoupledSimulationRateCheckBox->GetValue());
+
+    mOnChangeCallback();
+}
+
+void PreferencesDialog::OnAutoQualityCheckBoxClicked(wxCommandEvent & /*event*/)
+{
+    mUIPreferencesManager.SetDoAutoQuality(mAutoQualityCheckBox->GetValue());
+
+    mOnChangeCallback();
+}
+
 void PreferencesDialog::OnAutoFocusOnShipLoadCheckBoxClicked(wxCommandEvent & /*event*/)
 {
     mUIPreferencesManager.SetDoAutoFocusOnShipLoad(mAutoFocusOnShipLoadCheckBox->GetValue());
@@ -658,6 +672,20 @@ void PreferencesDialog::PopulateGamePanel(wxPanel * panel)
                     UserInterfaceBorder);
             }
 
+            {
+                mAutoQualityCheckBox = new wxCheckBox(boxSizer->GetStaticBox(), wxID_ANY,
+                    _("Auto-Adjust Quality"), wxDefaultPosition, wxDefaultSize, 0);
+                mAutoQualityCheckBox->SetToolTip(_("When checked, the game lowers the detail of clouds, ocean, and flames - and eventually the accuracy of the simulation - whenever frames take too long, and restores them when the load decreases."));
+                mAutoQualityCheckBox->Bind(wxEVT_COMMAND_CHECKBOX_CLICKED, &PreferencesDialog::OnAutoQualityCheckBoxClicked, this);
+
+                sizer->Add(
+                    mAutoQualityCheckBox,
+                    wxGBPosition(5, 2),
+                    wxGBSpan(1, 2),
+                    wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL | wxRIGHT,
+                    UserInterfaceBorder);
+            }
+
             //
             // Row 7
             //
@@ -727,6 +755,20 @@ void PreferencesDialog::PopulateGamePanel(wxPanel * panel)
                     UserInterfaceBorder);
             }
 
+            {
+                mDecoupledSimulationRateCheckBox = new wxCheckBox(boxSizer->GetStaticBox(), wxID_ANY,
+                    _("Decouple Simulation from Frame Rate"), wxDefaultPosition, wxDefaultSize, 0);
+                mDecoupledSimulationRateCheckBox->SetToolTip(_("When checked, the simulation keeps up with real time regardless of how often frames are drawn, and ships move smoothly in-between simulation steps; at the cost of ships being shown up to one step late."));
+                mDecoupledSimulationRateCheckBox->Bind(wxEVT_COMMAND_CHECKBOX_CLICKED, &PreferencesDialog::OnDecoupledSimulationRateCheckBoxClicked, this);
+
+                sizer->Add(
+                    mDecoupledSimulationRateCheckBox,
+                    wxGBPosition(6, 2),
+                    wxGBSpan(1, 2),
+                    wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL | wxBOTTOM | wxRIGHT,
+                    UserInterfaceBorder);
+            }
+
             //
             // Row 8
             //
@@ -1407,6 +1449,8 @@ void PreferencesDialog::ReadSettings()
         }
     }
 
+    mAutoQualityCheckBox->SetValue(mUIPreferencesManager.GetDoAutoQuality());
+    mDecoupledSimulationRateCheckBox->SetValue(mUIPreferencesManager.GetDoDecoupledSimulationRate());
     mReloadLastLoadedShipOnStartupCheckBox->SetValue(mUIPreferencesManager.GetReloadLastLoadedShipOnStartup());
     mShowShipDescriptionAtShipLoadCheckBox->SetValue(mUIPreferencesManager.GetShowShipDescriptionsAtShipLoad());
     mContinuousAutoFocusOnShipCheckBox->SetValue(mUIPreferencesManager.GetAutoFocusTarget() == AutoFocusTargetKindType::Ship);
@@ -55,6 +55,8 @@ private:
     void OnReloadLastLoadedShipOnStartupCheckBoxClicked(wxCommandEvent & event);
     void OnShowShipDescriptionAtShipLoadCheckBoxClicked(wxCommandEvent & event);
     void OnContinuousAutoFocusOnShipCheckBoxClicked(wxCommandEvent & event);
+    void OnAutoQualityCheckBoxClicked(wxCommandEvent & event);
+    void OnDecoupledSimulationRateCheckBoxClicked(wxCommandEvent & event);
     void OnAutoFocusOnShipLoadCheckBoxClicked(wxCommandEvent & event);
     void OnAutoShowSwitchboardCheckBoxClicked(wxCommandEvent & event);
     void OnShowElectricalNotificationsCheckBoxClicked(wxCommandEvent & event);
@@ -108,6 +110,8 @@ private:
     wxSpinCtrl * mCameraSpeedAdjustmentSpinCtrl;
     wxCheckBox * mShowStatusTextCheckBox;
     wxCheckBox * mShowExtendedStatusTextCheckBox;
+    wxCheckBox * mAutoQualityCheckBox;
+    wxCheckBox * mDecoupledSimulationRateCheckBox;
     wxListBox * mLanguagesListBox;
     wxComboBox * mDisplayUnitsSettingsComboBox;
 
@@ -6176,7 +6176,9 @@ void SettingsDialog::PopulateParallelismExperimentsPanel(wxPanel * panel)
         {
             "StepByStep",
             "FullSpeed",
-            "Hybrid"
+            "Hybrid",
+            "Chebyshev",
+            "Automatic"
         };
 
         mSpringRelaxationParallelComputationModeRadioBox = new wxRadioBox(panel, wxID_ANY, "Computation Mode", wxDefaultPosition, wxDefaultSize,
@@ -6194,11 +6196,19 @@ void SettingsDialog::PopulateParallelismExperimentsPanel(wxPanel * panel)
                 {
                     mLiveSettings.SetValue(GameSettings::SpringRelaxationParallelComputationMode, SpringRelaxationParallelComputationModeType::FullSpeed);
                 }
-                else
+                else if (2 == selectedMode)
                 {
-                    assert(2 == selectedMode);
                     mLiveSettings.SetValue(GameSettings::SpringRelaxationParallelComputationMode, SpringRelaxationParallelComputationModeType::Hybrid);
                 }
+                else if (3 == selectedMode)
+                {
+                    mLiveSettings.SetValue(GameSettings::SpringRelaxationParallelComputationMode, SpringRelaxationParallelComputationModeType::Chebyshev);
+                }
+                else
+                {
+                    assert(4 == selectedMode);
+                    mLiveSettings.SetValue(GameSettings::SpringRelaxationParallelComputationMode, SpringRelaxationParallelComputationModeType::Automatic);
+                }
 
                 OnLiveSettingsChanged();
             });
@@ -6686,6 +6696,18 @@ void SettingsDialog::SyncControlsWithSettings(Settings<GameSettings> const & set
             mSpringRelaxationParallelComputationModeRadioBox->SetSelection(2);
             break;
         }
+
+        case SpringRelaxationParallelComputationModeType::Chebyshev:
+        {
+            mSpringRelaxationParallelComputationModeRadioBox->SetSelection(3);
+            break;
+        }
+
+        case SpringRelaxationParallelComputationModeType::Automatic:
+        {
+            mSpringRelaxationParallelComputationModeRadioBox->SetSelection(4);
+            break;
+        }
     }
 #endif
 }
@@ -21,6 +21,10 @@
 static constexpr int MaxElementsPerRow = 11;
 static constexpr int MaxKeyboardShortcuts = 20;
 
+// Caps the repaints of a single frame when lots of elements change at once;
+// the remaining ones are applied at the next frames
+static constexpr size_t MaxElementUpdatesPerFrame = 64;
+
 SwitchboardPanel * SwitchboardPanel::Create(
     wxWindow * parent,
     std::function<void()> onRelayout,
@@ -54,6 +58,7 @@ SwitchboardPanel::SwitchboardPanel(
     , mBackgroundSelectorPopup()
     //
     , mElementMap()
+    , mPendingElementUpdates()
     , mUpdateableElements()
     , mKeyboardShortcutToElementId()
     , mCurrentKeyDownElementId()
@@ -395,6 +400,10 @@ bool SwitchboardPanel::ProcessKeyDown(
     if (keyIndex < mKeyboardShortcutToElementId.size())
     {
         GlobalElectricalElementId const elementId = mKeyboardShortcutToElementId[keyIndex];
+
+        // Bring the control up-to-date, as the shortcut acts on its current state
+        ApplyPendingElementUpdate(elementId);
+
         ElectricalElementInfo & elementInfo = mElementMap.at(elementId);
         if (nullptr == elementInfo.DisablableControl
             || elementInfo.DisablableControl->IsEnabled())
@@ -430,6 +439,8 @@ bool SwitchboardPanel::ProcessKeyUp(
     // Map and toggle
     //
 
+    ApplyPendingElementUpdate(*mCurrentKeyDownElementId);
+
     ElectricalElementInfo & elementInfo = mElementMap.at(*mCurrentKeyDownElementId);
     if (nullptr == elementInfo.DisablableControl
         || elementInfo.DisablableControl->IsEnabled())
@@ -464,6 +475,7 @@ void SwitchboardPanel::OnElectricalElementAnnouncementsBegin()
 
     // Clear maps
     mElementMap.clear();
+    mPendingElementUpdates.clear();
     mUpdateableElements.clear();
 
     // Clear keyboard shortcuts map
@@ -1188,13 +1200,9 @@ void SwitchboardPanel::OnSwitchEnabled(
     // Enable/disable switch
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Switch);
-
-    SwitchElectricalElementControl * swCtrl = dynamic_cast<SwitchElectricalElementControl *>(elementInfo.Control);
-    if (swCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        swCtrl->SetEnabled(isEnabled);
+        pendingUpdate->IsEnabled = isEnabled;
     }
 }
 
@@ -1206,13 +1214,9 @@ void SwitchboardPanel::OnSwitchToggled(
     // Toggle switch
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Switch);
-
-    SwitchElectricalElementControl * swCtrl = dynamic_cast<SwitchElectricalElementControl *>(elementInfo.Control);
-    if (swCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        swCtrl->SetState(newState);
+        pendingUpdate->State = newState;
     }
 }
 
@@ -1224,24 +1228,17 @@ void SwitchboardPanel::OnPowerProbeToggled(
     // Toggle control
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    if (elementInfo.Control != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        if (elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::PowerMonitor)
+        if (mElementMap.at(electricalElementId).Control->GetControlType() == ElectricalElementControl::ControlType::PowerMonitor)
         {
-            PowerMonitorElectricalElementControl * pmCtrl = dynamic_cast<PowerMonitorElectricalElementControl *>(elementInfo.Control);
-            assert(pmCtrl != nullptr);
-
-            pmCtrl->SetState(newState);
+            pendingUpdate->State = newState;
         }
         else
         {
-            assert(elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Gauge);
-
-            GaugeElectricalElementControl * ggCtrl = dynamic_cast<GaugeElectricalElementControl *>(elementInfo.Control);
-            assert(ggCtrl != nullptr);
+            assert(mElementMap.at(electricalElementId).Control->GetControlType() == ElectricalElementControl::ControlType::Gauge);
 
-            ggCtrl->SetValue(newState == ElectricalState::On ? 0.0f : 1.0f);
+            pendingUpdate->Value = (newState == ElectricalState::On ? 0.0f : 1.0f);
         }
     }
 }
@@ -1254,13 +1251,9 @@ void SwitchboardPanel::OnEngineControllerEnabled(
     // Enable/disable controller
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::EngineController);
-
-    EngineControllerElectricalElementControl * ecCtrl = dynamic_cast<EngineControllerElectricalElementControl *>(elementInfo.Control);
-    if (ecCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        ecCtrl->SetEnabled(isEnabled);
+        pendingUpdate->IsEnabled = isEnabled;
     }
 }
 
@@ -1274,13 +1267,9 @@ void SwitchboardPanel::OnEngineControllerUpdated(
     // Toggle controller
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::EngineController);
-
-    EngineControllerElectricalElementControl * ecCtrl = dynamic_cast<EngineControllerElectricalElementControl *>(elementInfo.Control);
-    if (ecCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        ecCtrl->SetValue(newControllerValue);
+        pendingUpdate->Value = newControllerValue;
     }
 }
 
@@ -1293,13 +1282,9 @@ void SwitchboardPanel::OnEngineMonitorUpdated(
     // Change RPM
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Gauge);
-
-    GaugeElectricalElementControl * ggCtrl = dynamic_cast<GaugeElectricalElementControl *>(elementInfo.Control);
-    if (ggCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        ggCtrl->SetValue(1.0f - rpm);
+        pendingUpdate->Value = 1.0f - rpm;
     }
 }
 
@@ -1319,13 +1304,9 @@ void SwitchboardPanel::OnWaterPumpUpdated(
     // Change gauge
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Gauge);
-
-    GaugeElectricalElementControl * ggCtrl = dynamic_cast<GaugeElectricalElementControl *>(elementInfo.Control);
-    if (ggCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        ggCtrl->SetValue(1.0f - normalizedForce);
+        pendingUpdate->Value = 1.0f - normalizedForce;
     }
 }
 
@@ -1337,13 +1318,9 @@ void SwitchboardPanel::OnWatertightDoorEnabled(
     // Enable/disable indicator
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Switch);
-
-    SwitchElectricalElementControl * swCtrl = dynamic_cast<SwitchElectricalElementControl *>(elementInfo.Control);
-    if (swCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        swCtrl->SetEnabled(isEnabled);
+        pendingUpdate->IsEnabled = isEnabled;
     }
 }
 
@@ -1355,13 +1332,9 @@ void SwitchboardPanel::OnWatertightDoorUpdated(
     // Toggle indicator
     //
 
-    auto & elementInfo = mElementMap.at(electricalElementId);
-    assert(elementInfo.Control == nullptr || elementInfo.Control->GetControlType() == ElectricalElementControl::ControlType::Switch);
-
-    SwitchElectricalElementControl * swCtrl = dynamic_cast<SwitchElectricalElementControl *>(elementInfo.Control);
-    if (swCtrl != nullptr)
+    if (auto * const pendingUpdate = GetPendingElementUpdate(electricalElementId); pendingUpdate != nullptr)
     {
-        swCtrl->SetState(isOpen ? ElectricalState::On : ElectricalState::Off);
+        pendingUpdate->State = isOpen ? ElectricalState::On : ElectricalState::Off;
     }
 }
 
@@ -1500,6 +1473,126 @@ void SwitchboardPanel::SetBackgroundBitmapFromCombo(int selection)
     Refresh();
 }
 
+SwitchboardPanel::PendingElementUpdate * SwitchboardPanel::GetPendingElementUpdate(GlobalElectricalElementId electricalElementId)
+{
+    if (mElementMap.at(electricalElementId).Control == nullptr)
+    {
+        // Not on the panel, hence nothing to update
+        return nullptr;
+    }
+
+    return &(mPendingElementUpdates[electricalElementId]);
+}
+
+void SwitchboardPanel::ApplyPendingElementUpdates()
+{
+    // Controls may only be seen when the switch panel is fully showing;
+    // until then, their updates keep coalescing
+    if (mShowingMode != ShowingMode::ShowingFullyFloating
+        && mShowingMode != ShowingMode::ShowingFullyDocked)
+    {
+        return;
+    }
+
+    assert(mSwitchPanel != nullptr);
+    wxRect const visibleRect = mSwitchPanel->GetClientRect();
+
+    size_t appliedCount = 0;
+    for (auto it = mPendingElementUpdates.begin();
+        it != mPendingElementUpdates.end() && appliedCount < MaxElementUpdatesPerFrame;)
+    {
+        ElectricalElementInfo const & elementInfo = mElementMap.at(it->first);
+        assert(elementInfo.Control != nullptr);
+
+        // Controls scrolled out of view get their update once they scroll back into view
+        if (elementInfo.Control->GetRect().Intersects(visibleRect))
+        {
+            ApplyPendingElementUpdate(elementInfo, it->second);
+            it = mPendingElementUpdates.erase(it);
+            ++appliedCount;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void SwitchboardPanel::ApplyPendingElementUpdate(GlobalElectricalElementId electricalElementId)
+{
+    if (auto const it = mPendingElementUpdates.find(electricalElementId); it != mPendingElementUpdates.end())
+    {
+        ApplyPendingElementUpdate(mElementMap.at(electricalElementId), it->second);
+        mPendingElementUpdates.erase(it);
+    }
+}
+
+void SwitchboardPanel::ApplyPendingElementUpdate(
+    ElectricalElementInfo const & elementInfo,
+    PendingElementUpdate const & pendingUpdate)
+{
+    // Note: controls only repaint when their state actually changes
+
+    assert(elementInfo.Control != nullptr);
+
+    switch (elementInfo.Control->GetControlType())
+    {
+        case ElectricalElementControl::ControlType::Switch:
+        {
+            SwitchElectricalElementControl * swCtrl = dynamic_cast<SwitchElectricalElementControl *>(elementInfo.Control);
+            assert(swCtrl != nullptr);
+            assert(!pendingUpdate.Value.has_value());
+
+            if (pendingUpdate.IsEnabled.has_value())
+                swCtrl->SetEnabled(*pendingUpdate.IsEnabled);
+
+            if (pendingUpdate.State.has_value())
+                swCtrl->SetState(*pendingUpdate.State);
+
+            break;
+        }
+
+        case ElectricalElementControl::ControlType::PowerMonitor:
+        {
+            PowerMonitorElectricalElementControl * pmCtrl = dynamic_cast<PowerMonitorElectricalElementControl *>(elementInfo.Control);
+            assert(pmCtrl != nullptr);
+            assert(!pendingUpdate.IsEnabled.has_value() && !pendingUpdate.Value.has_value());
+
+            if (pendingUpdate.State.has_value())
+                pmCtrl->SetState(*pendingUpdate.State);
+
+            break;
+        }
+
+        case ElectricalElementControl::ControlType::Gauge:
+        {
+            GaugeElectricalElementControl * ggCtrl = dynamic_cast<GaugeElectricalElementControl *>(elementInfo.Control);
+            assert(ggCtrl != nullptr);
+            assert(!pendingUpdate.IsEnabled.has_value() && !pendingUpdate.State.has_value());
+
+            if (pendingUpdate.Value.has_value())
+                ggCtrl->SetValue(*pendingUpdate.Value);
+
+            break;
+        }
+
+        case ElectricalElementControl::ControlType::EngineController:
+        {
+            EngineControllerElectricalElementControl * ecCtrl = dynamic_cast<EngineControllerElectricalElementControl *>(elementInfo.Control);
+            assert(ecCtrl != nullptr);
+            assert(!pendingUpdate.State.has_value());
+
+            if (pendingUpdate.IsEnabled.has_value())
+                ecCtrl->SetEnabled(*pendingUpdate.IsEnabled);
+
+            if (pendingUpdate.Value.has_value())
+                ecCtrl->SetValue(*pendingUpdate.Value);
+
+            break;
+        }
+    }
+}
+
 void SwitchboardPanel::OnLeaveWindowTimer(wxTimerEvent & /*event*/)
 {
     wxPoint const clientCoords = ScreenToClient(wxGetMousePosition());
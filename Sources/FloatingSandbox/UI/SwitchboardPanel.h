@@ -55,6 +55,11 @@ public:
 
     void UpdateSimulation()
     {
+        if (!mPendingElementUpdates.empty())
+        {
+            ApplyPendingElementUpdates();
+        }
+
         for (auto ctrl : mUpdateableElements)
         {
             ctrl->UpdateSimulation();
@@ -278,6 +283,18 @@ private:
 
     std::unordered_map<GlobalElectricalElementId, ElectricalElementInfo> mElementMap;
 
+    // The latest state announced for an element and not applied yet to its control;
+    // announcements are coalesced here and applied at most once per frame, so that
+    // a storm of announcements costs a single control update
+    struct PendingElementUpdate
+    {
+        std::optional<bool> IsEnabled;
+        std::optional<ElectricalState> State;
+        std::optional<float> Value;
+    };
+
+    std::unordered_map<GlobalElectricalElementId, PendingElementUpdate> mPendingElementUpdates;
+
     // The electrical elements that need to be updated
     std::vector<IUpdateableElectricalElementControl *> mUpdateableElements;
 
@@ -290,6 +307,18 @@ private:
     // and only about the first key up in a sequence of key ups
     std::optional<GlobalElectricalElementId> mCurrentKeyDownElementId;
 
+private:
+
+    PendingElementUpdate * GetPendingElementUpdate(GlobalElectricalElementId electricalElementId);
+
+    void ApplyPendingElementUpdates();
+
+    void ApplyPendingElementUpdate(GlobalElectricalElementId electricalElementId);
+
+    void ApplyPendingElementUpdate(
+        ElectricalElementInfo const & elementInfo,
+        PendingElementUpdate const & pendingUpdate);
+
 private:
 
     std::function<void()> const mOnRelayout;
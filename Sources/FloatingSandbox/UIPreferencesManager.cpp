@@ -322,6 +322,26 @@ void UIPreferencesManager::LoadPreferences()
             mGameController.SetCameraSpeedAdjustment(static_cast<float>(it->second.get<double>()));
         }
 
+        //
+        // Auto-quality
+        //
+
+        if (auto it = preferencesRootObject->find("auto_quality");
+            it != preferencesRootObject->end() && it->second.is<bool>())
+        {
+            mGameController.SetDoAutoQuality(it->second.get<bool>());
+        }
+
+        //
+        // Decoupled simulation rate
+        //
+
+        if (auto it = preferencesRootObject->find("decoupled_simulation_rate");
+            it != preferencesRootObject->end() && it->second.is<bool>())
+        {
+            mGameController.SetDoDecoupledSimulationRate(it->second.get<bool>());
+        }
+
         //
         // Auto-focus at ship load
         //
@@ -599,6 +619,12 @@ void UIPreferencesManager::SavePreferences() const
     // Add camera speed adjustment
     preferencesRootObject["camera_speed_adjustment"] = picojson::value(static_cast<double>(mGameController.GetCameraSpeedAdjustment()));
 
+    // Add auto-quality
+    preferencesRootObject["auto_quality"] = picojson::value(mGameController.GetDoAutoQuality());
+
+    // Add decoupled simulation rate
+    preferencesRootObject["decoupled_simulation_rate"] = picojson::value(mGameController.GetDoDecoupledSimulationRate());
+
     // Add auto focus at ship load
     preferencesRootObject["auto_zoom_at_ship_load"] = picojson::value(mGameController.GetDoAutoFocusOnShipLoad());
 
@@ -215,6 +215,26 @@ public:
         return mGameController.GetMaxCameraSpeedAdjustment();
     }
 
+    bool GetDoAutoQuality() const
+    {
+        return mGameController.GetDoAutoQuality();
+    }
+
+    void SetDoAutoQuality(bool value)
+    {
+        mGameController.SetDoAutoQuality(value);
+    }
+
+    bool GetDoDecoupledSimulationRate() const
+    {
+        return mGameController.GetDoDecoupledSimulationRate();
+    }
+
+    void SetDoDecoupledSimulationRate(bool value)
+    {
+        mGameController.SetDoDecoupledSimulationRate(value);
+    }
+
     bool GetDoAutoFocusOnShipLoad() const
     {
         return mGameController.GetDoAutoFocusOnShipLoad();
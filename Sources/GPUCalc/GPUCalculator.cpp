@@ -18,7 +18,7 @@ GPUCalculator::GPUCalculator(
     // Initialize shader manager
     //
 
-    mShaderManager = ShaderManager<GPUCalcShaderSets::ShaderSet>::CreateInstance(assetManager);
+    mShaderManager = ShaderManager<GPUCalcShaderSets::ShaderSet>::CreateInstance(assetManager, SimpleProgressCallback::Dummy());
 }
 
 ImageSize GPUCalculator::CalculateRequiredRenderBufferSize(size_t pixels)
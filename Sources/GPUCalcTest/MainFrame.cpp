@@ -181,7 +181,12 @@ MainFrame::MainFrame(wxApp * mainApp)
     Logger::Instance.RegisterListener(
         [this](std::string const & message)
         {
-            this->OnLogMessage(message);
+            // We're invoked on the logger's thread
+            this->CallAfter(
+                [this, message]()
+                {
+                    this->OnLogMessage(message);
+                });
         });
 
 
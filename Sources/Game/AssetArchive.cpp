@@ -0,0 +1,250 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "AssetArchive.h"
+
+#include "FileSystem.h"
+#include "GameVersion.h"
+
+#include <Core/DeSerializationBuffer.h>
+#include <Core/Endian.h>
+#include <Core/GameException.h>
+#include <Core/Log.h>
+
+#include <algorithm>
+#include <tuple>
+
+std::filesystem::path const AssetArchive::ArchiveFileName = "Data.fsarchive";
+
+static std::string const ArchiveTitle = "FLOATING SANDBOX ASSET ARCHIVE";
+
+namespace /* anonymous */ {
+
+    using ArchiveBuffer = DeSerializationBuffer<LittleEndianess>;
+
+    void CheckReadableSize(
+        ArchiveBuffer const & buffer,
+        size_t index,
+        size_t size)
+    {
+        if (index + size > buffer.GetSize())
+        {
+            throw GameException("Asset archive is truncated");
+        }
+    }
+
+    template<typename T>
+    size_t ReadValue(
+        ArchiveBuffer const & buffer,
+        size_t index,
+        T & value)
+    {
+        CheckReadableSize(buffer, index, sizeof(T));
+        return index + buffer.ReadAt(index, value);
+    }
+
+    size_t ReadString(
+        ArchiveBuffer const & buffer,
+        size_t index,
+        std::string & value)
+    {
+        std::uint32_t length;
+        ReadValue(buffer, index, length);
+        CheckReadableSize(buffer, index, sizeof(std::uint32_t) + length);
+        return index + buffer.ReadAt(index, value);
+    }
+}
+
+size_t AssetArchive::Pack(
+    std::filesystem::path const & rootDirectoryPath,
+    std::filesystem::path const & archiveFilePath)
+{
+    //
+    // Collect files - in a deterministic order - skipping the archive itself, should it be under the root
+    //
+
+    std::vector<std::filesystem::path> filePaths = FileSystem::ListFilesRecursively(rootDirectoryPath);
+
+    filePaths.erase(
+        std::remove_if(
+            filePaths.begin(),
+            filePaths.end(),
+            [normalizedArchiveFilePath = archiveFilePath.lexically_normal()](auto const & filePath)
+            {
+                return filePath.lexically_normal() == normalizedArchiveFilePath;
+            }),
+        filePaths.end());
+
+    std::sort(filePaths.begin(), filePaths.end());
+
+    //
+    // Header and index
+    //
+
+    ArchiveBuffer indexBuffer(4096);
+
+    indexBuffer.Append(ArchiveTitle);
+    indexBuffer.Append(CurrentGameVersion.ToString());
+    indexBuffer.Append(static_cast<std::uint32_t>(filePaths.size()));
+
+    std::vector<std::uint64_t> fileSizes;
+    std::uint64_t dataOffset = 0;
+    for (auto const & filePath : filePaths)
+    {
+        std::uint64_t const fileSize = static_cast<std::uint64_t>(std::filesystem::file_size(filePath));
+
+        indexBuffer.Append(MakeIndexKey(filePath.lexically_relative(rootDirectoryPath)));
+        indexBuffer.Append(dataOffset);
+        indexBuffer.Append(fileSize);
+
+        fileSizes.push_back(fileSize);
+        dataOffset += fileSize;
+    }
+
+    FileBinaryWriteStream archiveStream(archiveFilePath);
+
+    archiveStream.Write(
+        reinterpret_cast<std::uint8_t const *>(indexBuffer.GetData()),
+        indexBuffer.GetSize());
+
+    //
+    // Data
+    //
+
+    std::vector<std::uint8_t> fileContent;
+    for (size_t f = 0; f < filePaths.size(); ++f)
+    {
+        FileBinaryReadStream fileStream(filePaths[f]);
+
+        fileContent.resize(static_cast<size_t>(fileSizes[f]));
+        if (fileStream.Read(fileContent.data(), fileContent.size()) != fileContent.size())
+        {
+            throw GameException("File \"" + filePaths[f].string() + "\" has changed while being packed");
+        }
+
+        archiveStream.Write(fileContent.data(), fileContent.size());
+    }
+
+    return filePaths.size();
+}
+
+std::unique_ptr<AssetArchive> AssetArchive::Open(std::filesystem::path const & archiveFilePath)
+{
+    auto archiveStream = std::make_unique<MemoryMappedFileBinaryReadStream>(archiveFilePath);
+
+    size_t const archiveSize = archiveStream->GetSize();
+    std::uint8_t const * const archiveData = archiveStream->ReadInPlace(archiveSize);
+    if (archiveData == nullptr)
+    {
+        throw GameException("Asset archive is empty");
+    }
+
+    ArchiveBuffer buffer(0);
+    buffer.Borrow(archiveData, archiveSize);
+
+    size_t index = 0;
+
+    //
+    // Header
+    //
+
+    std::string title;
+    index = ReadString(buffer, index, title);
+    if (title != ArchiveTitle)
+    {
+        throw GameException("Asset archive is not recognized");
+    }
+
+    std::string version;
+    index = ReadString(buffer, index, version);
+    if (version != CurrentGameVersion.ToString())
+    {
+        throw GameException("Asset archive was packed for version " + version + " of the simulator");
+    }
+
+    std::uint32_t entryCount;
+    index = ReadValue(buffer, index, entryCount);
+
+    //
+    // Index
+    //
+
+    std::vector<std::tuple<std::string, std::uint64_t, std::uint64_t>> entries;
+    for (std::uint32_t e = 0; e < entryCount; ++e)
+    {
+        std::string relativePath;
+        index = ReadString(buffer, index, relativePath);
+
+        std::uint64_t offset;
+        index = ReadValue(buffer, index, offset);
+
+        std::uint64_t size;
+        index = ReadValue(buffer, index, size);
+
+        entries.emplace_back(std::move(relativePath), offset, size);
+    }
+
+    // Now that we know where data starts
+    size_t const dataStart = index;
+
+    std::map<std::string, AssetView> assetIndex;
+    for (auto & [relativePath, offset, size] : entries)
+    {
+        if (offset + size > archiveSize - dataStart)
+        {
+            throw GameException("Asset archive is truncated");
+        }
+
+        assetIndex.emplace(
+            std::move(relativePath),
+            AssetView{ archiveData + dataStart + static_cast<size_t>(offset), static_cast<size_t>(size) });
+    }
+
+    LogMessage("AssetArchive: opened \"", archiveFilePath.string(), "\" with ", assetIndex.size(), " assets");
+
+    return std::unique_ptr<AssetArchive>(
+        new AssetArchive(
+            std::move(archiveStream),
+            std::move(assetIndex)));
+}
+
+std::optional<AssetArchive::AssetView> AssetArchive::Find(std::filesystem::path const & relativePath) const
+{
+    auto const it = mIndex.find(MakeIndexKey(relativePath));
+    if (it == mIndex.end())
+    {
+        return std::nullopt;
+    }
+
+    return it->second;
+}
+
+std::vector<std::filesystem::path> AssetArchive::ListFiles(
+    std::filesystem::path const & relativeDirectoryPath,
+    bool isRecursive) const
+{
+    std::string directoryPrefix = MakeIndexKey(relativeDirectoryPath);
+    if (directoryPrefix == ".")
+    {
+        directoryPrefix.clear();
+    }
+    else if (!directoryPrefix.empty() && directoryPrefix.back() != '/')
+    {
+        directoryPrefix += '/';
+    }
+
+    std::vector<std::filesystem::path> relativeFilePaths;
+
+    // Entries in the directory are all contiguous in the index
+    for (auto it = mIndex.lower_bound(directoryPrefix); it != mIndex.end() && it->first.compare(0, directoryPrefix.size(), directoryPrefix) == 0; ++it)
+    {
+        if (isRecursive || it->first.find('/', directoryPrefix.size()) == std::string::npos)
+        {
+            relativeFilePaths.emplace_back(it->first);
+        }
+    }
+
+    return relativeFilePaths;
+}
@@ -0,0 +1,94 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include "FileStreams.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * A packed archive of game assets: all the files under a directory, concatenated
+ * into a single file with a central index.
+ *
+ * The archive is memory-mapped, and assets are served as views straight into
+ * the mapping, sparing the opening of hundreds of loose files at startup.
+ *
+ * Layout:
+ *  - Header: title, game version, number of entries
+ *  - Index: for each entry, its path relative to the packed directory, its offset from the
+ *    start of the data section, and its size
+ *  - Data section: the content of all entries, back-to-back
+ */
+class AssetArchive final
+{
+public:
+
+    struct AssetView
+    {
+        std::uint8_t const * Data;
+        size_t Size;
+    };
+
+    static std::filesystem::path const ArchiveFileName;
+
+    /*
+     * Packs all files under the specified directory into a new archive; returns the number of files packed.
+     */
+    static size_t Pack(
+        std::filesystem::path const & rootDirectoryPath,
+        std::filesystem::path const & archiveFilePath);
+
+    /*
+     * Throws if the archive is not valid, or was packed for a different version of the game.
+     */
+    static std::unique_ptr<AssetArchive> Open(std::filesystem::path const & archiveFilePath);
+
+    /*
+     * Returns the asset at the specified path - relative to the packed directory - if it's in the archive.
+     * The view lives as long as the archive.
+     */
+    std::optional<AssetView> Find(std::filesystem::path const & relativePath) const;
+
+    /*
+     * Returns the relative paths of all assets in the specified directory - relative to the packed
+     * directory - and, if requested, in all of its sub-directories.
+     */
+    std::vector<std::filesystem::path> ListFiles(
+        std::filesystem::path const & relativeDirectoryPath,
+        bool isRecursive) const;
+
+    size_t GetSize() const
+    {
+        return mIndex.size();
+    }
+
+private:
+
+    AssetArchive(
+        std::unique_ptr<MemoryMappedFileBinaryReadStream> && archiveStream,
+        std::map<std::string, AssetView> && index)
+        : mArchiveStream(std::move(archiveStream))
+        , mIndex(std::move(index))
+    {}
+
+    static std::string MakeIndexKey(std::filesystem::path const & relativePath)
+    {
+        return relativePath.lexically_normal().generic_string();
+    }
+
+private:
+
+    std::unique_ptr<MemoryMappedFileBinaryReadStream> const mArchiveStream;
+
+    // Keyed by generic relative path
+    std::map<std::string, AssetView> const mIndex;
+};
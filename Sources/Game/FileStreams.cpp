@@ -0,0 +1,117 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "FileStreams.h"
+
+#include <Core/SysSpecifics.h>
+
+#if FS_IS_OS_WINDOWS()
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFileBinaryReadStream::MemoryMappedFileBinaryReadStream(std::filesystem::path const & filePath)
+	: mData(nullptr)
+	, mSize(0)
+	, mReadOffset(0)
+{
+	// Note: the mapping outlives the file handles, which we close right away
+
+#if FS_IS_OS_WINDOWS()
+
+	HANDLE const fileHandle = ::CreateFileW(
+		filePath.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		throw GameException("Cannot open file \"" + filePath.string() + "\" for reading");
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!::GetFileSizeEx(fileHandle, &fileSize))
+	{
+		::CloseHandle(fileHandle);
+		throw GameException("Cannot get size of file \"" + filePath.string() + "\"");
+	}
+
+	mSize = static_cast<size_t>(fileSize.QuadPart);
+
+	if (mSize > 0)
+	{
+		HANDLE const mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle != nullptr)
+		{
+			mData = static_cast<std::uint8_t const *>(::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			::CloseHandle(mappingHandle);
+		}
+
+		if (mData == nullptr)
+		{
+			::CloseHandle(fileHandle);
+			throw GameException("Cannot map file \"" + filePath.string() + "\" in memory");
+		}
+	}
+
+	::CloseHandle(fileHandle);
+
+#else
+
+	int const fd = ::open(filePath.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		throw GameException("Cannot open file \"" + filePath.string() + "\" for reading");
+	}
+
+	struct stat fileStat;
+	if (::fstat(fd, &fileStat) != 0)
+	{
+		::close(fd);
+		throw GameException("Cannot get size of file \"" + filePath.string() + "\"");
+	}
+
+	mSize = static_cast<size_t>(fileStat.st_size);
+
+	if (mSize > 0)
+	{
+		void * const data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+		{
+			::close(fd);
+			throw GameException("Cannot map file \"" + filePath.string() + "\" in memory");
+		}
+
+		// We parse front to back
+		::madvise(data, mSize, MADV_SEQUENTIAL);
+
+		mData = static_cast<std::uint8_t const *>(data);
+	}
+
+	::close(fd);
+
+#endif
+}
+
+MemoryMappedFileBinaryReadStream::~MemoryMappedFileBinaryReadStream()
+{
+	if (mData != nullptr)
+	{
+#if FS_IS_OS_WINDOWS()
+		::UnmapViewOfFile(mData);
+#else
+		::munmap(const_cast<std::uint8_t *>(mData), mSize);
+#endif
+	}
+}
@@ -9,6 +9,7 @@
 #include <Core/Streams.h>
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -72,6 +73,74 @@ private:
 	std::ifstream mStream;
 };
 
+/*
+ * Implementation of BinaryReadStream for files mapped in memory; lends
+ * its content in-place, sparing copies of large files.
+ */
+class MemoryMappedFileBinaryReadStream final : public BinaryReadStream
+{
+public:
+
+	MemoryMappedFileBinaryReadStream(std::filesystem::path const & filePath);
+
+	~MemoryMappedFileBinaryReadStream();
+
+	MemoryMappedFileBinaryReadStream(MemoryMappedFileBinaryReadStream const &) = delete;
+	MemoryMappedFileBinaryReadStream & operator=(MemoryMappedFileBinaryReadStream const &) = delete;
+
+	size_t GetSize() override
+	{
+		return mSize;
+	}
+
+	size_t GetCurrentPosition() override
+	{
+		return mReadOffset;
+	}
+
+	void SetPosition(size_t offset) override
+	{
+		mReadOffset = std::min(offset, mSize);
+	}
+
+	size_t Read(std::uint8_t * buffer, size_t size) override
+	{
+		size_t const szToRead = std::min(size, mSize - mReadOffset);
+		if (szToRead > 0)
+		{
+			std::memcpy(buffer, mData + mReadOffset, szToRead);
+			mReadOffset += szToRead;
+		}
+
+		return szToRead;
+	}
+
+	size_t Skip(size_t size) override
+	{
+		size_t const szToRead = std::min(size, mSize - mReadOffset);
+		mReadOffset += szToRead;
+		return szToRead;
+	}
+
+	std::uint8_t const * ReadInPlace(size_t size) override
+	{
+		if (size > mSize - mReadOffset)
+		{
+			return nullptr;
+		}
+
+		std::uint8_t const * const data = mData + mReadOffset;
+		mReadOffset += size;
+		return data;
+	}
+
+private:
+
+	std::uint8_t const * mData; // nullptr when the file is empty
+	size_t mSize;
+	size_t mReadOffset;
+};
+
 /*
  * Implementation of TextReadStream for file streams.
  */
@@ -133,6 +202,7 @@ class FileBinaryWriteStream final : public BinaryWriteStream
 public:
 
 	FileBinaryWriteStream(std::filesystem::path const & filePath)
+		: mFilePath(filePath)
 	{
 		mStream = std::ofstream(filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
 		if (!mStream)
@@ -143,8 +213,11 @@ public:
 
 	~FileBinaryWriteStream()
 	{
-		mStream.flush();
-		mStream.close();
+		if (mStream.is_open())
+		{
+			mStream.flush();
+			mStream.close();
+		}
 	}
 
 	void Write(std::uint8_t const * buffer, size_t size) override
@@ -152,8 +225,23 @@ public:
 		mStream.write(reinterpret_cast<char const *>(buffer), size);
 	}
 
+	/*
+	 * Flushes and closes the file, throwing if any of the writes - or the flush
+	 * itself - has failed, e.g. because the disk is full.
+	 */
+	void Close()
+	{
+		mStream.flush();
+		mStream.close();
+		if (!mStream)
+		{
+			throw GameException("Cannot write file \"" + mFilePath.filename().string() + "\"");
+		}
+	}
+
 private:
 
+	std::filesystem::path const mFilePath;
 	std::ofstream mStream;
 };
 
@@ -184,6 +272,11 @@ public:
 		mStream << content;
 	}
 
+	void Flush() override
+	{
+		mStream.flush();
+	}
+
 private:
 
 	std::ofstream mStream;
@@ -83,6 +83,46 @@ public:
         return filePaths;
     }
 
+    static std::vector<std::filesystem::path> ListFilesRecursively(std::filesystem::path const & directoryPath)
+    {
+        std::vector<std::filesystem::path> filePaths;
+
+        // Be robust to users messing up
+        if (std::filesystem::exists(directoryPath)
+            && std::filesystem::is_directory(directoryPath))
+        {
+            // Note: not following directory symlinks, as they might make for cycles
+            auto directoryIterator = std::filesystem::recursive_directory_iterator(
+                directoryPath,
+                std::filesystem::directory_options::skip_permission_denied);
+
+            for (auto const & entryIt : directoryIterator)
+            {
+                try
+                {
+                    auto const entryFilepath = entryIt.path();
+
+                    if (std::filesystem::is_regular_file(entryFilepath))
+                    {
+                        // Make sure the filename may be converted to the local codepage
+                        std::string _ = entryFilepath.filename().string();
+                        (void)_;
+
+                        filePaths.push_back(entryFilepath);
+                    }
+                }
+                catch (std::exception const & ex)
+                {
+                    LogMessage("Ignoring a file directory entry due to error: ", ex.what());
+
+                    // Ignore this file
+                }
+            }
+        }
+
+        return filePaths;
+    }
+
     static void DeleteFile(std::filesystem::path const & filePath)
     {
         std::filesystem::remove(filePath);
@@ -174,6 +214,7 @@ struct IFileSystem
 
     /*
      * Opens a binary file for reading. Throws if the file does not exist.
+     * The returned stream may lend its content in place (see BinaryReadStream::ReadInPlace).
      */
     virtual std::unique_ptr<BinaryReadStream> OpenBinaryInputStream(std::filesystem::path const & filePath) = 0;
 
@@ -199,6 +240,11 @@ struct IFileSystem
      */
     virtual std::vector<std::filesystem::path> ListFiles(std::filesystem::path const & directoryPath) = 0;
 
+    /*
+     * Returns paths of all files in the specified directory and in all of its sub-directories.
+     */
+    virtual std::vector<std::filesystem::path> ListFilesRecursively(std::filesystem::path const & directoryPath) = 0;
+
     /*
      * Deletes a file.
      */
@@ -239,7 +285,7 @@ public:
 
     std::unique_ptr<BinaryReadStream> OpenBinaryInputStream(std::filesystem::path const & filePath) override
     {
-        return std::make_unique<FileBinaryReadStream>(filePath);
+        return std::make_unique<MemoryMappedFileBinaryReadStream>(filePath);
     }
 
     std::unique_ptr<TextReadStream> OpenTextInputStream(std::filesystem::path const & filePath) override
@@ -262,6 +308,11 @@ public:
         return FileSystem::ListFiles(directoryPath);
     }
 
+    std::vector<std::filesystem::path> ListFilesRecursively(std::filesystem::path const & directoryPath) override
+    {
+        return FileSystem::ListFilesRecursively(directoryPath);
+    }
+
     void DeleteFile(std::filesystem::path const & filePath) override
     {
         FileSystem::DeleteFile(filePath);
@@ -10,6 +10,7 @@
 
 #include <Core/GameException.h>
 #include <Core/Log.h>
+#include <Core/MemoryStreams.h>
 #include <Core/PngTools.h>
 #include <Core/Streams.h>
 #include <Core/Utils.h>
@@ -26,28 +27,30 @@ GameAssetManager::GameAssetManager(std::string const && argv0)
     , mResourcesRoot(mDataRoot / "Resources")
 	, mTextureRoot(mDataRoot / "Textures")
     , mShaderRoot(mDataRoot / "Shaders")
+    , mAssetArchive(TryOpenAssetArchive(mGameRoot / AssetArchive::ArchiveFileName))
 {
 }
 
 GameAssetManager::GameAssetManager(std::filesystem::path const & textureRoot)
 	: mDataRoot(textureRoot) // Just because (not needed in this scenario)
 	, mTextureRoot(textureRoot)
+	, mAssetArchive()
 {
 }
 
 picojson::value GameAssetManager::LoadTetureDatabaseSpecification(std::string const & databaseName) const
 {
-    return LoadJson(mTextureRoot / databaseName / "database.json");
+    return LoadDataJson(mTextureRoot / databaseName / "database.json");
 }
 
 ImageSize GameAssetManager::GetTextureDatabaseFrameSize(std::string const & databaseName, std::string const & frameRelativePath) const
 {
-    return GetImageSize(mTextureRoot / databaseName / frameRelativePath);
+    return GetDataImageSize(mTextureRoot / databaseName / frameRelativePath);
 }
 
 RgbaImageData GameAssetManager::LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const
 {
-    return LoadPngImageRgba(mTextureRoot / databaseName / frameRelativePath);
+    return LoadDataPngImageRgba(mTextureRoot / databaseName / frameRelativePath);
 }
 
 std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateTextureDatabaseFrames(std::string const & databaseName) const
@@ -55,25 +58,23 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateTextureDa
     std::vector<AssetDescriptor> frameDescriptors;
 
     std::filesystem::path const databaseRootPath = mTextureRoot / databaseName;
-    for (auto const & entryIt : std::filesystem::recursive_directory_iterator(databaseRootPath))
+    for (auto const & framePath : ListDataFiles(databaseRootPath, true))
     {
-        if (std::filesystem::is_regular_file(entryIt.path())
-            && entryIt.path().extension().string() != ".json")
+        if (framePath.extension().string() != ".json")
         {
             // We only expect png's
-            if (entryIt.path().extension().string() == ".png")
+            if (framePath.extension().string() == ".png")
             {
-                auto const framePath = entryIt.path();
                 frameDescriptors.push_back(
                     AssetDescriptor{
                         framePath.filename().stem().string(),
                         framePath.filename().string(),
-                        std::filesystem::relative(framePath, databaseRootPath).string()
+                        framePath.lexically_relative(databaseRootPath).string()
                     });
             }
-            else if (entryIt.path().extension().string() != ".txt") // txt allowed
+            else if (framePath.extension().string() != ".txt") // txt allowed
             {
-                LogMessage("WARNING: found file \"" + entryIt.path().string() + "\" with unexpected extension while loading texture database \"" + databaseName + "\"");
+                LogMessage("WARNING: found file \"" + framePath.string() + "\" with unexpected extension while loading texture database \"" + databaseName + "\"");
             }
         }
     }
@@ -81,35 +82,47 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateTextureDa
     return frameDescriptors;
 }
 
+std::uint64_t GameAssetManager::GetTextureDatabaseFrameStamp(std::string const & databaseName, std::string const & frameRelativePath) const
+{
+    std::filesystem::path const framePath = mTextureRoot / databaseName / frameRelativePath;
+
+    if (auto const assetView = FindInAssetArchive(framePath); assetView.has_value())
+    {
+        // Archived frames only change with the archive, which is bound to the game version
+        return static_cast<std::uint64_t>(assetView->Size);
+    }
+
+    return static_cast<std::uint64_t>(std::filesystem::last_write_time(framePath).time_since_epoch().count());
+}
+
 std::string GameAssetManager::GetMaterialTextureRelativePath(std::string const & materialTextureName) const
 {
     std::filesystem::path const materialTexturesRootPath = MakeMaterialTexturesRootPath();
     std::filesystem::path const fullPath = materialTexturesRootPath / (materialTextureName + ".png");
 
     // Make sure file exists
-    if (!std::filesystem::exists(fullPath)
-        || !std::filesystem::is_regular_file(fullPath))
+    if (!DataFileExists(fullPath))
     {
         throw GameException(
             "Cannot find material texture file for texture name \"" + materialTextureName + "\"");
     }
 
-    return std::filesystem::relative(fullPath, materialTexturesRootPath).string();
+    return fullPath.lexically_relative(materialTexturesRootPath).string();
 }
 
 RgbImageData GameAssetManager::LoadMaterialTexture(std::string const & frameRelativePath) const
 {
-    return LoadPngImageRgb(MakeMaterialTexturesRootPath() / frameRelativePath);
+    return LoadDataPngImageRgb(MakeMaterialTexturesRootPath() / frameRelativePath);
 }
 
 picojson::value GameAssetManager::LoadTetureAtlasSpecification(std::string const & textureDatabaseName) const
 {
-    return LoadJson(mTextureRoot / "Atlases" / MakeAtlasSpecificationFilename(textureDatabaseName));
+    return LoadDataJson(mTextureRoot / "Atlases" / MakeAtlasSpecificationFilename(textureDatabaseName));
 }
 
 RgbaImageData GameAssetManager::LoadTextureAtlasImageRGBA(std::string const & textureDatabaseName) const
 {
-    return LoadPngImageRgba(mTextureRoot / "Atlases" / MakeAtlasImageFilename(textureDatabaseName));
+    return LoadDataPngImageRgba(mTextureRoot / "Atlases" / MakeAtlasImageFilename(textureDatabaseName));
 }
 
 std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateShaders(std::string const & shaderSetName) const
@@ -117,24 +130,20 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateShaders(s
     std::vector<AssetDescriptor> shaderDescriptors;
 
     std::filesystem::path const shaderSetRootPath = mShaderRoot / shaderSetName;
-    for (auto const & entryIt : std::filesystem::directory_iterator(shaderSetRootPath))
+    for (auto const & shaderPath : ListDataFiles(shaderSetRootPath, false))
     {
-        if (std::filesystem::is_regular_file(entryIt.path()))
+        if (shaderPath.extension() == ".glsl" || shaderPath.extension() == ".glslinc")
         {
-            if (entryIt.path().extension() == ".glsl" || entryIt.path().extension() == ".glslinc")
-            {
-                std::string shaderFilename = entryIt.path().filename().string();
-                shaderDescriptors.push_back(
-                    AssetDescriptor{
-                        entryIt.path().filename().stem().string(),
-                        entryIt.path().filename().string(),
-                        std::filesystem::relative(entryIt.path(), shaderSetRootPath).string()
-                    });
-            }
-            else
-            {
-                LogMessage("WARNING: found file \"" + entryIt.path().string() + "\" with unexpected extension while loading shader set \"" + shaderSetName + "\"");
-            }
+            shaderDescriptors.push_back(
+                AssetDescriptor{
+                    shaderPath.filename().stem().string(),
+                    shaderPath.filename().string(),
+                    shaderPath.lexically_relative(shaderSetRootPath).string()
+                });
+        }
+        else
+        {
+            LogMessage("WARNING: found file \"" + shaderPath.string() + "\" with unexpected extension while loading shader set \"" + shaderSetName + "\"");
         }
     }
 
@@ -143,7 +152,7 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateShaders(s
 
 std::string GameAssetManager::LoadShader(std::string const & shaderSetName, std::string const & shaderRelativePath) const
 {
-    return FileTextReadStream(mShaderRoot / shaderSetName / shaderRelativePath).ReadAll();
+    return LoadDataTextFile(mShaderRoot / shaderSetName / shaderRelativePath);
 }
 
 std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateFonts(std::string const & fontSetName) const
@@ -151,18 +160,14 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateFonts(std
     std::vector<AssetDescriptor> fontDescriptors;
 
     std::filesystem::path const fontSetRootPath = mDataRoot / "Fonts" / fontSetName;
-    for (auto const & entryIt : std::filesystem::recursive_directory_iterator(fontSetRootPath))
+    for (auto const & fontPath : ListDataFiles(fontSetRootPath, true))
     {
-        if (std::filesystem::is_regular_file(entryIt.path()))
-        {
-            auto const fontPath = entryIt.path();
-            fontDescriptors.push_back(
-                AssetDescriptor{
-                    fontPath.filename().stem().string(),
-                    fontPath.filename().string(),
-                    std::filesystem::relative(fontPath, fontSetRootPath).string()
-                });
-        }
+        fontDescriptors.push_back(
+            AssetDescriptor{
+                fontPath.filename().stem().string(),
+                fontPath.filename().string(),
+                fontPath.lexically_relative(fontSetRootPath).string()
+            });
     }
 
     return fontDescriptors;
@@ -170,27 +175,38 @@ std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateFonts(std
 
 std::unique_ptr<BinaryReadStream> GameAssetManager::LoadFont(std::string const & fontSetName, std::string const & fontRelativePath) const
 {
-    return std::make_unique<FileBinaryReadStream>(mDataRoot / "Fonts" / fontSetName / fontRelativePath);
+    return OpenDataBinaryFile(mDataRoot / "Fonts" / fontSetName / fontRelativePath);
+}
+
+std::unique_ptr<BinaryReadStream> GameAssetManager::TryLoadBakedFontSet(std::string const & fontSetName) const
+{
+    std::filesystem::path const bakedFontSetPath = mDataRoot / "Fonts" / MakeBakedFontSetFilename(fontSetName);
+    if (!DataFileExists(bakedFontSetPath))
+    {
+        return nullptr;
+    }
+
+    return OpenDataBinaryFile(bakedFontSetPath);
 }
 
 picojson::value GameAssetManager::LoadStructuralMaterialDatabase() const
 {
-    return LoadJson(mDataRoot / "Misc" / "materials_structural.json");
+    return LoadDataJson(mDataRoot / "Misc" / "materials_structural.json");
 }
 
 picojson::value GameAssetManager::LoadElectricalMaterialDatabase() const
 {
-    return LoadJson(mDataRoot / "Misc" / "materials_electrical.json");
+    return LoadDataJson(mDataRoot / "Misc" / "materials_electrical.json");
 }
 
 picojson::value GameAssetManager::LoadFishSpeciesDatabase() const
 {
-    return LoadJson(mDataRoot / "Misc" / "fish_species.json");
+    return LoadDataJson(mDataRoot / "Misc" / "fish_species.json");
 }
 
 picojson::value GameAssetManager::LoadNpcDatabase() const
 {
-    return LoadJson(mDataRoot / "Misc" / "npcs.json");
+    return LoadDataJson(mDataRoot / "Misc" / "npcs.json");
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -477,4 +493,157 @@ void GameAssetManager::SaveTextFile(
     std::filesystem::path const & filePath)
 {
     FileTextWriteStream(filePath).Write(content);
-}
\ No newline at end of file
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// Data files
+////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<AssetArchive> GameAssetManager::TryOpenAssetArchive(std::filesystem::path const & archiveFilePath)
+{
+    if (!std::filesystem::exists(archiveFilePath))
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        return AssetArchive::Open(archiveFilePath);
+    }
+    catch (std::exception const & ex)
+    {
+        // Not fatal, we've got the loose files
+        LogMessage("WARNING: ignoring asset archive \"", archiveFilePath.string(), "\": ", ex.what());
+        return nullptr;
+    }
+}
+
+std::optional<AssetArchive::AssetView> GameAssetManager::FindInAssetArchive(std::filesystem::path const & dataFilePath) const
+{
+    if (!mAssetArchive)
+    {
+        return std::nullopt;
+    }
+
+    return mAssetArchive->Find(dataFilePath.lexically_relative(mDataRoot));
+}
+
+bool GameAssetManager::DataFileExists(std::filesystem::path const & dataFilePath) const
+{
+    return FindInAssetArchive(dataFilePath).has_value()
+        || (std::filesystem::exists(dataFilePath) && std::filesystem::is_regular_file(dataFilePath));
+}
+
+std::vector<std::filesystem::path> GameAssetManager::ListDataFiles(
+    std::filesystem::path const & dataDirectoryPath,
+    bool isRecursive) const
+{
+    if (mAssetArchive)
+    {
+        auto const relativeFilePaths = mAssetArchive->ListFiles(dataDirectoryPath.lexically_relative(mDataRoot), isRecursive);
+        if (!relativeFilePaths.empty())
+        {
+            std::vector<std::filesystem::path> filePaths;
+            for (auto const & relativeFilePath : relativeFilePaths)
+            {
+                filePaths.push_back(mDataRoot / relativeFilePath);
+            }
+
+            return filePaths;
+        }
+    }
+
+    std::vector<std::filesystem::path> filePaths;
+    if (isRecursive)
+    {
+        for (auto const & entryIt : std::filesystem::recursive_directory_iterator(dataDirectoryPath))
+        {
+            if (std::filesystem::is_regular_file(entryIt.path()))
+            {
+                filePaths.push_back(entryIt.path());
+            }
+        }
+    }
+    else
+    {
+        for (auto const & entryIt : std::filesystem::directory_iterator(dataDirectoryPath))
+        {
+            if (std::filesystem::is_regular_file(entryIt.path()))
+            {
+                filePaths.push_back(entryIt.path());
+            }
+        }
+    }
+
+    return filePaths;
+}
+
+ImageSize GameAssetManager::GetDataImageSize(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        auto readStream = MemoryViewBinaryReadStream(assetView->Data, assetView->Size);
+        return PngTools::GetImageSize(readStream);
+    }
+
+    return GetImageSize(dataFilePath);
+}
+
+RgbaImageData GameAssetManager::LoadDataPngImageRgba(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        auto readStream = MemoryViewBinaryReadStream(assetView->Data, assetView->Size);
+        return PngTools::DecodeImageRgba(readStream);
+    }
+
+    return LoadPngImageRgba(dataFilePath);
+}
+
+RgbImageData GameAssetManager::LoadDataPngImageRgb(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        auto readStream = MemoryViewBinaryReadStream(assetView->Data, assetView->Size);
+        return PngTools::DecodeImageRgb(readStream);
+    }
+
+    return LoadPngImageRgb(dataFilePath);
+}
+
+picojson::value GameAssetManager::LoadDataJson(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        try
+        {
+            return Utils::ParseJSONString(std::string(reinterpret_cast<char const *>(assetView->Data), assetView->Size));
+        }
+        catch (GameException const & ex)
+        {
+            throw GameException("Error loading \"" + dataFilePath.filename().string() + "\": " + ex.what());
+        }
+    }
+
+    return LoadJson(dataFilePath);
+}
+
+std::string GameAssetManager::LoadDataTextFile(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        return std::string(reinterpret_cast<char const *>(assetView->Data), assetView->Size);
+    }
+
+    return FileTextReadStream(dataFilePath).ReadAll();
+}
+
+std::unique_ptr<BinaryReadStream> GameAssetManager::OpenDataBinaryFile(std::filesystem::path const & dataFilePath) const
+{
+    if (auto const assetView = FindInAssetArchive(dataFilePath); assetView.has_value())
+    {
+        return std::make_unique<MemoryViewBinaryReadStream>(assetView->Data, assetView->Size);
+    }
+
+    return std::make_unique<FileBinaryReadStream>(dataFilePath);
+}
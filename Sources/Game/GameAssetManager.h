@@ -5,13 +5,19 @@
  ***************************************************************************************/
 #pragma once
 
+#include "AssetArchive.h"
+
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
 
 #include <picojson.h>
 
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 class GameAssetManager : public IAssetManager
 {
@@ -29,6 +35,7 @@ public:
 	ImageSize GetTextureDatabaseFrameSize(std::string const & databaseName, std::string const & frameRelativePath) const override;
 	RgbaImageData LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const override;
 	std::vector<AssetDescriptor> EnumerateTextureDatabaseFrames(std::string const & databaseName) const override;
+	std::uint64_t GetTextureDatabaseFrameStamp(std::string const & databaseName, std::string const & frameRelativePath) const override;
 
 	std::string GetMaterialTextureRelativePath(std::string const & materialTextureName) const override;
 	RgbImageData LoadMaterialTexture(std::string const & frameRelativePath) const override;
@@ -41,6 +48,7 @@ public:
 
 	std::vector<AssetDescriptor> EnumerateFonts(std::string const & fontSetName) const override;
 	std::unique_ptr<BinaryReadStream> LoadFont(std::string const & fontSetName, std::string const & fontRelativePath) const override;
+	std::unique_ptr<BinaryReadStream> TryLoadBakedFontSet(std::string const & fontSetName) const override;
 
 	picojson::value LoadStructuralMaterialDatabase() const override;
 	picojson::value LoadElectricalMaterialDatabase() const override;
@@ -154,6 +162,11 @@ public:
 		return textureDatabaseName + ".atlas.png";
 	}
 
+	static std::filesystem::path MakeBakedFontSetFilename(std::string const & fontSetName)
+	{
+		return fontSetName + ".fontset";
+	}
+
 private:
 
 	std::filesystem::path MakeMaterialTexturesRootPath() const
@@ -161,6 +174,28 @@ private:
 		return mTextureRoot / "Material";
 	}
 
+	//
+	// Data files, served from the asset archive when there is one and it has them,
+	// and from loose files otherwise
+	//
+
+	static std::unique_ptr<AssetArchive> TryOpenAssetArchive(std::filesystem::path const & archiveFilePath);
+
+	std::optional<AssetArchive::AssetView> FindInAssetArchive(std::filesystem::path const & dataFilePath) const;
+
+	bool DataFileExists(std::filesystem::path const & dataFilePath) const;
+
+	std::vector<std::filesystem::path> ListDataFiles(
+		std::filesystem::path const & dataDirectoryPath,
+		bool isRecursive) const;
+
+	ImageSize GetDataImageSize(std::filesystem::path const & dataFilePath) const;
+	RgbaImageData LoadDataPngImageRgba(std::filesystem::path const & dataFilePath) const;
+	RgbImageData LoadDataPngImageRgb(std::filesystem::path const & dataFilePath) const;
+	picojson::value LoadDataJson(std::filesystem::path const & dataFilePath) const;
+	std::string LoadDataTextFile(std::filesystem::path const & dataFilePath) const;
+	std::unique_ptr<BinaryReadStream> OpenDataBinaryFile(std::filesystem::path const & dataFilePath) const;
+
 private:
 
 	std::filesystem::path const mGameRoot;
@@ -168,4 +203,7 @@ private:
 	std::filesystem::path const mResourcesRoot;
 	std::filesystem::path const mTextureRoot;
 	std::filesystem::path const mShaderRoot;
+
+	// The packed Data directory, if any
+	std::unique_ptr<AssetArchive> const mAssetArchive;
 };
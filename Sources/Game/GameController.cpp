@@ -15,6 +15,8 @@
 #include <Core/Conversions.h>
 #include <Core/GameMath.h>
 #include <Core/Log.h>
+#include <Core/StartupTimeline.h>
+#include <Core/TaskThread.h>
 #include <Core/TextureAtlas.h>
 
 #include <ctime>
@@ -27,45 +29,98 @@ std::unique_ptr<GameController> GameController::Create(
     GameAssetManager const & gameAssetManager,
     ProgressCallback const & progressCallback)
 {
-    // Load material database
-    MaterialDatabase materialDatabase = MaterialDatabase::Load(gameAssetManager);
+    //
+    // The databases are loaded on two bootstrap threads while we create the render context:
+    //  - Material database -> NPC database
+    //  - Fish species database
+    //
+    // The render context and the NPC database share the NPC texture atlas, which we load
+    // upfront; the NPC database only needs its metadata.
+    //
+
+    // Load NPC texture atlas
+    auto npcTextureAtlas = [&]()
+        {
+            ScopedStartupStage const stage("NpcTextureAtlas");
+            return TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+        }();
+
+    TextureAtlas<GameTextureDatabases::NpcTextureDatabase> const npcTextureAtlasMetadata(
+        TextureAtlasMetadata<GameTextureDatabases::NpcTextureDatabase>(npcTextureAtlas.Metadata),
+        RgbaImageData(0, 0));
+
+    std::optional<MaterialDatabase> materialDatabase;
+    std::optional<NpcDatabase> npcDatabase;
+    std::optional<FishSpeciesDatabase> fishSpeciesDatabase;
 
-    // Load fish species database
-    FishSpeciesDatabase fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+    bool const isBootstrapMultithreaded = ThreadManager::GetNumberOfProcessors() > 1;
 
-    // Load NPC teture atlas
-    auto npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+    TaskThread materialAndNpcBootstrapThread(ThreadManager::ThreadTaskKind::Other, "FS Bootstrap 1", 0, isBootstrapMultithreaded, threadManager);
+    TaskThread fishBootstrapThread(ThreadManager::ThreadTaskKind::Other, "FS Bootstrap 2", 1, isBootstrapMultithreaded, threadManager);
+
+    auto const npcDatabaseCompletionIndicator = materialAndNpcBootstrapThread.QueueTask(
+        [&]()
+        {
+            {
+                ScopedStartupStage const stage("MaterialDatabase");
+                materialDatabase.emplace(MaterialDatabase::Load(gameAssetManager));
+            }
+
+            {
+                ScopedStartupStage const stage("NpcDatabase");
+                npcDatabase.emplace(NpcDatabase::Load(gameAssetManager, *materialDatabase, npcTextureAtlasMetadata));
+            }
+        });
 
-    // Load NPC database
-    NpcDatabase npcDatabase = NpcDatabase::Load(
-        gameAssetManager,
-        materialDatabase,
-        npcTextureAtlas);
+    auto const fishSpeciesDatabaseCompletionIndicator = fishBootstrapThread.QueueTask(
+        [&]()
+        {
+            ScopedStartupStage const stage("FishSpeciesDatabase");
+            fishSpeciesDatabase.emplace(FishSpeciesDatabase::Load(gameAssetManager));
+        });
 
     // Create perf stats
     std::unique_ptr<PerfStats> perfStats = std::make_unique<PerfStats>();
 
     // Create render context
-    std::unique_ptr<RenderContext> renderContext = std::make_unique<RenderContext>(
-        renderDeviceProperties,
-        FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
-        std::move(npcTextureAtlas),
-        *perfStats,
-        threadManager,
-        gameAssetManager,
-        progressCallback.MakeSubCallback(0.0f, 0.9f)); // Progress: 0.0-0.9
+    // Note: should this throw, the bootstrap threads are joined before the state they reference goes away
+    std::unique_ptr<RenderContext> renderContext = [&]()
+        {
+            ScopedStartupStage const stage("RenderContext");
+
+            return std::make_unique<RenderContext>(
+                renderDeviceProperties,
+                FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+                std::move(npcTextureAtlas),
+                *perfStats,
+                threadManager,
+                gameAssetManager,
+                progressCallback.MakeSubCallback(0.0f, 0.9f)); // Progress: 0.0-0.9
+        }();
+
+    // Wait for the databases; rethrows their loading errors
+    {
+        ScopedStartupStage const stage("WaitForDatabases");
+
+        npcDatabaseCompletionIndicator.Wait();
+        fishSpeciesDatabaseCompletionIndicator.Wait();
+    }
+
+    assert(materialDatabase.has_value() && npcDatabase.has_value() && fishSpeciesDatabase.has_value());
 
     //
     // Create controller
     //
 
+    ScopedStartupStage const stage("GameController");
+
     return std::unique_ptr<GameController>(
         new GameController(
             std::move(renderContext),
             std::move(perfStats),
-            std::move(fishSpeciesDatabase),
-            std::move(npcDatabase),
-            std::move(materialDatabase),
+            std::move(*fishSpeciesDatabase),
+            std::move(*npcDatabase),
+            std::move(*materialDatabase),
             threadManager,
             gameAssetManager,
             progressCallback));
@@ -92,6 +147,10 @@ GameController::GameController(
     // Ship factory
     , mShipStrengthRandomizer()
     , mShipTexturizer(mMaterialDatabase, gameAssetManager)
+    , mGameAssetManager(gameAssetManager)
+    , mBackgroundShipTexturizer(mMaterialDatabase, gameAssetManager)
+    , mPendingShipTextures()
+    , mShipTexturesThread(ThreadManager::ThreadTaskKind::Other, "FS Ship Textures", 0, ThreadManager::GetNumberOfProcessors() > 1, threadManager)
     // State
     , mSimulationParameters()
     , mIsFrozen(false)
@@ -130,6 +189,18 @@ GameController::GameController(
     , mTotalFrameCount(0u)
     , mLastPublishedTotalFrameCount(0u)
     , mSkippedFirstStatPublishes(0)
+    , mCurrentNpcCount(0)
+    , mCurrentHumanNpcInsideShipCount(0)
+    , mCurrentHumanNpcOutsideShipCount(0)
+    , mCurrentFishCount(0)
+    // Telemetry
+    , mTelemetrySession()
+    // Auto-quality
+    , mAutoQualityBaseline()
+    , mPerformanceGovernor(SimulationParameters::SimulationStepTimeDuration<float> * 1000.0f)
+    // Decoupled simulation rate
+    , mDecoupledSimulationTimeDebt(0.0f)
+    , mLastDecoupledGameIterationTimestampReal()
 {
     // Initialize time-of-day
     SetTimeOfDay(1.0f);
@@ -306,6 +377,14 @@ ShipMetadata GameController::ResetAndLoadShip(
     return InternalResetAndLoadShip(loadSpecs, assetManager);
 }
 
+ShipMetadata GameController::ResetAndLoadShip(
+    ShipLoadSpecifications const & loadSpecs,
+    ShipDefinition && shipDefinition,
+    IAssetManager const & assetManager)
+{
+    return InternalResetAndLoadShip(loadSpecs, std::move(shipDefinition), assetManager);
+}
+
 ShipMetadata GameController::ResetAndReloadShip(
     ShipLoadSpecifications const & loadSpecs,
     IAssetManager const & assetManager)
@@ -318,7 +397,7 @@ ShipMetadata GameController::AddShip(
     IAssetManager const & assetManager)
 {
     // Load ship definition
-    auto shipDefinition = ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mMaterialDatabase);
+    auto shipDefinition = ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mMaterialDatabase, mThreadManager);
 
     // Pre-validate ship's textures, if any
     if (shipDefinition.Layers.ExteriorTextureLayer)
@@ -335,7 +414,7 @@ ShipMetadata GameController::AddShip(
 
     auto const shipId = mWorld->GetNextShipId();
 
-    auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+    auto [ship, exteriorTextureImage, interiorViewImage, deferredShipTextures] = ShipFactory::CreateProgressively(
         shipId,
         *mWorld,
         std::move(shipDefinition),
@@ -345,7 +424,8 @@ ShipMetadata GameController::AddShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     //
     // No errors, so we may continue
@@ -355,6 +435,7 @@ ShipMetadata GameController::AddShip(
         std::move(ship),
         std::move(exteriorTextureImage),
         std::move(interiorViewImage),
+        std::move(deferredShipTextures),
         shipMetadata);
 
     return shipMetadata;
@@ -365,10 +446,27 @@ RgbImageData GameController::TakeScreenshot()
     return mRenderContext->TakeScreenshot();
 }
 
+void GameController::RequestScreenshot()
+{
+    mRenderContext->RequestScreenshot();
+}
+
+std::vector<RgbImageData> GameController::PopTakenScreenshots()
+{
+    return mRenderContext->PopTakenScreenshots();
+}
+
 void GameController::RunGameIteration()
 {
     assert(!mIsFrozen); // Not supposed to be invoked at all if we're frozen
 
+    auto const frameStartTimestampReal = std::chrono::steady_clock::now();
+
+    if (!mPendingShipTextures.empty())
+    {
+        SwapInReadyShipTextures();
+    }
+
     //
     // Initialize stats, if needed
     //
@@ -396,15 +494,25 @@ void GameController::RunGameIteration()
     // Decide whether we are going to run a simulation update
     bool const doUpdate = ((!mIsPaused || mIsPulseUpdateSet) && !mIsMoveToolEngaged);
 
+    // Decide how many simulation steps to run, and where in-between steps to render
+    size_t updateCount = doUpdate ? 1 : 0;
+    float renderInterpolationFactor = 1.0f;
+    if (mSimulationParameters.DoInterpolateRenderedPositions)
+    {
+        CalculateDecoupledSimulationSteps(doUpdate, mIsPulseUpdateSet, updateCount, renderInterpolationFactor);
+    }
+
     // Clear pulse
     mIsPulseUpdateSet = false;
 
-    if (doUpdate)
+    // Let simulation threads know whether they should stay hot
+    mThreadManager.SetIsSimulationActive(updateCount > 0);
+
+    for (size_t u = 0; u < updateCount; ++u)
     {
         auto const startTime = GameChronometer::Now();
 
         // Tell RenderContext we're starting an update
-        // (waits until the last upload has completed)
         mRenderContext->UpdateStart();
 
         auto const netStartTime = GameChronometer::Now();
@@ -482,13 +590,19 @@ void GameController::RunGameIteration()
         assert(!!mWorld);
         mWorld->RenderUpload(
             mSimulationParameters,
-            *mRenderContext);
+            *mRenderContext,
+            renderInterpolationFactor,
+            *mTotalPerfStats);
 
         //
         // Upload notification layer
         //
 
-        mNotificationLayer.RenderUpload(*mRenderContext);
+        {
+            ScopedPerfMeasurement<PerfMeasurement::TotalNotificationsRenderUpload> const perfMeasurement(*mTotalPerfStats);
+
+            mNotificationLayer.RenderUpload(*mRenderContext);
+        }
 
         mRenderContext->UploadEnd();
 
@@ -516,6 +630,94 @@ void GameController::RunGameIteration()
     //
 
     ++mTotalFrameCount;
+
+    if (mTelemetrySession.has_value())
+    {
+        UpdateTelemetry(frameStartTimestampReal);
+    }
+}
+
+void GameController::StartTelemetry(
+    std::filesystem::path const & filePath,
+    float sampleRate)
+{
+    assert(sampleRate > 0.0f);
+
+    // Close the current one first, if any
+    mTelemetrySession.reset();
+
+    auto const nowReal = std::chrono::steady_clock::now();
+
+    mTelemetrySession = TelemetrySession{
+        TelemetrySink::Create(filePath),
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(1.0f / sampleRate)),
+        nowReal,
+        nowReal,
+        *mTotalPerfStats,
+        0,
+        std::chrono::steady_clock::duration::zero(),
+        std::chrono::steady_clock::duration::zero() };
+}
+
+void GameController::StopTelemetry()
+{
+    mTelemetrySession.reset();
+}
+
+void GameController::SetDoDecoupledSimulationRate(bool value)
+{
+    mSimulationParameters.DoInterpolateRenderedPositions = value;
+
+    // Start afresh
+    mDecoupledSimulationTimeDebt = 0.0f;
+    mLastDecoupledGameIterationTimestampReal.reset();
+}
+
+void GameController::CalculateDecoupledSimulationSteps(
+    bool doUpdate,
+    bool isPulseUpdate,
+    size_t & outUpdateCount,
+    float & outRenderInterpolationFactor)
+{
+    float constexpr StepDuration = SimulationParameters::SimulationStepTimeDuration<float>;
+
+    // When we can't keep up, we give up on real time rather than falling further and further behind
+    size_t constexpr MaxUpdatesPerIteration = 4;
+
+    auto const nowReal = std::chrono::steady_clock::now();
+
+    if (!doUpdate)
+    {
+        // Keep showing the last step
+        outUpdateCount = 0;
+        outRenderInterpolationFactor = 1.0f;
+    }
+    else if (isPulseUpdate || !mLastDecoupledGameIterationTimestampReal.has_value())
+    {
+        // Exactly one step
+        outUpdateCount = 1;
+        outRenderInterpolationFactor = 1.0f;
+        mDecoupledSimulationTimeDebt = 0.0f;
+    }
+    else
+    {
+        mDecoupledSimulationTimeDebt += std::min(
+            std::chrono::duration<float>(nowReal - *mLastDecoupledGameIterationTimestampReal).count(),
+            StepDuration * static_cast<float>(MaxUpdatesPerIteration));
+
+        outUpdateCount = std::min(
+            static_cast<size_t>(mDecoupledSimulationTimeDebt / StepDuration),
+            MaxUpdatesPerIteration);
+        mDecoupledSimulationTimeDebt = std::min(
+            mDecoupledSimulationTimeDebt - StepDuration * static_cast<float>(outUpdateCount),
+            StepDuration);
+
+        // We render the time that has not been simulated yet as the fraction of the
+        // way from the previous to the last step, i.e. rendering lags by up to one step
+        outRenderInterpolationFactor = std::clamp(mDecoupledSimulationTimeDebt / StepDuration, 0.0f, 1.0f);
+    }
+
+    mLastDecoupledGameIterationTimestampReal = nowReal;
 }
 
 void GameController::LowFrequencyUpdate()
@@ -529,6 +731,15 @@ void GameController::LowFrequencyUpdate()
         //
 
         PublishStats(nowReal);
+
+        //
+        // Adjust quality
+        //
+
+        if (mAutoQualityBaseline.has_value() && !mIsPaused)
+        {
+            UpdateAutoQuality(*mTotalPerfStats - mLastPublishedTotalPerfStats);
+        }
     }
     else
     {
@@ -550,9 +761,103 @@ void GameController::LowFrequencyUpdate()
     mLastPublishedTotalFrameCount = mTotalFrameCount;
 }
 
-void GameController::StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback)
+void GameController::SetDoAutoQuality(bool value)
+{
+    if (value == mAutoQualityBaseline.has_value())
+    {
+        return;
+    }
+
+    if (value)
+    {
+        // Start from full quality, i.e. from the current settings
+        mAutoQualityBaseline = AutoQualityBaseline{
+            mSimulationParameters.NumMechanicalDynamicsIterationsAdjustment,
+            mSimulationParameters.MaxBurningParticlesPerShip,
+            mRenderContext->GetOceanRenderDetail(),
+            mRenderContext->GetCloudRenderDetail() };
+
+        mPerformanceGovernor.Reset();
+    }
+    else
+    {
+        // Restore the settings we might have overridden
+        ApplyAutoQualityLevel(PerformanceGovernor::MaxQualityLevel);
+
+        mAutoQualityBaseline.reset();
+    }
+}
+
+void GameController::UpdateAutoQuality(PerfStats const & lastDeltaPerfStats)
+{
+    assert(mAutoQualityBaseline.has_value());
+
+    //
+    // Frame time: the main thread's work, unless the render thread's drawing takes longer
+    //
+
+    float const mainThreadFrameTimeMillis =
+        lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalUpdate>().ToRatio<std::chrono::milliseconds>()
+        + lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalNetRenderUpload>().ToRatio<std::chrono::milliseconds>()
+        + lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalMainThreadRenderDraw>().ToRatio<std::chrono::milliseconds>();
+
+    float const frameTimeMillis = std::max(
+        mainThreadFrameTimeMillis,
+        lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalRenderDraw>().ToRatio<std::chrono::milliseconds>());
+
+    int const oldQualityLevel = mPerformanceGovernor.GetQualityLevel();
+    int const newQualityLevel = mPerformanceGovernor.Update(frameTimeMillis);
+    if (newQualityLevel != oldQualityLevel)
+    {
+        ApplyAutoQualityLevel(newQualityLevel);
+
+        std::stringstream ss;
+        ss << "AUTO QUALITY: " << newQualityLevel << "/" << PerformanceGovernor::MaxQualityLevel;
+        mNotificationLayer.PublishNotificationText(ss.str());
+    }
+}
+
+void GameController::ApplyAutoQualityLevel(int qualityLevel)
 {
-    mEventRecorder = std::make_unique<EventRecorder>(onEventCallback);
+    assert(mAutoQualityBaseline.has_value());
+
+    //
+    // Settings are given up in order of cost/benefit, from the ones that cost
+    // the most and are noticed the least
+    //
+
+    mRenderContext->SetCloudRenderDetail(
+        qualityLevel >= 4
+        ? mAutoQualityBaseline->CloudRenderDetail
+        : CloudRenderDetailType::Basic);
+
+    mRenderContext->SetOceanRenderDetail(
+        qualityLevel >= 3
+        ? mAutoQualityBaseline->OceanRenderDetail
+        : OceanRenderDetailType::Basic);
+
+    // Same as what the calibrator chooses for slow computers
+    mSimulationParameters.MaxBurningParticlesPerShip =
+        qualityLevel >= 2
+        ? mAutoQualityBaseline->MaxBurningParticlesPerShip
+        : std::min(mAutoQualityBaseline->MaxBurningParticlesPerShip, 112u);
+
+    // Last resort, as it makes structures softer
+    mSimulationParameters.NumMechanicalDynamicsIterationsAdjustment =
+        qualityLevel >= 1
+        ? mAutoQualityBaseline->NumMechanicalDynamicsIterationsAdjustment
+        : std::max(
+            mAutoQualityBaseline->NumMechanicalDynamicsIterationsAdjustment * 0.5f,
+            SimulationParameters::MinNumMechanicalDynamicsIterationsAdjustment);
+}
+
+void GameController::StartRecordingEvents(
+    std::function<void(uint32_t, RecordedEvent const &)> onEventCallback,
+    std::optional<std::filesystem::path> streamFilePath)
+{
+    mEventRecorder = std::make_unique<EventRecorder>(
+        std::move(onEventCallback),
+        std::move(streamFilePath));
 
     mWorld->SetEventRecorder(mEventRecorder.get());
 }
@@ -590,6 +895,9 @@ void GameController::Freeze()
     // Pause time
     GameWallClock::GetInstance().SetPaused(true);
 
+    // No simulation while frozen
+    mThreadManager.SetIsSimulationActive(false);
+
     mIsFrozen = true;
 }
 
@@ -760,7 +1068,8 @@ void GameController::MoveBy(
         connectedComponentId,
         worldOffset,
         inertialVelocity,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 }
 
 void GameController::MoveBy(
@@ -777,7 +1086,8 @@ void GameController::MoveBy(
         shipId,
         worldOffset,
         inertialVelocity,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 }
 
 void GameController::RotateBy(
@@ -806,7 +1116,8 @@ void GameController::RotateBy(
         angle,
         worldCenter,
         inertialAngle,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 }
 
 void GameController::RotateBy(
@@ -834,7 +1145,8 @@ void GameController::RotateBy(
         angle,
         worldCenter,
         inertialAngle,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 }
 
 std::tuple<vec2f, float> GameController::SetupMoveGrippedBy(
@@ -1710,6 +2022,18 @@ void GameController::QueryNearestNpcAt(DisplayLogicalCoordinates const & screenC
     mWorld->QueryNearestNpcAt(worldCoordinates, 1.0f);
 }
 
+MemoryReport GameController::GetShipMemoryReport(ShipId shipId) const
+{
+    MemoryReport report;
+
+    assert(!!mWorld);
+    mWorld->ReportShipMemory(shipId, report);
+
+    mRenderContext->ReportShipMemory(shipId, report);
+
+    return report;
+}
+
 void GameController::TriggerTsunami()
 {
     assert(!!mWorld);
@@ -1959,10 +2283,23 @@ void GameController::OnShipRepaired(ShipId /*shipId*/)
     LogMessage("Ship repaired!");
 }
 
+void GameController::OnFishCountUpdated(size_t count)
+{
+    mCurrentFishCount = count;
+}
+
+void GameController::OnNpcCountsUpdated(size_t totalNpcCount)
+{
+    mCurrentNpcCount = totalNpcCount;
+}
+
 void GameController::OnHumanNpcCountsUpdated(
     size_t insideShipCount,
     size_t outsideShipCount)
 {
+    mCurrentHumanNpcInsideShipCount = insideShipCount;
+    mCurrentHumanNpcOutsideShipCount = outsideShipCount;
+
     if (mDoShowNpcNotifications)
     {
         std::stringstream ss;
@@ -1977,10 +2314,18 @@ ShipMetadata GameController::InternalResetAndLoadShip(
     ShipLoadSpecifications const & loadSpecs,
     IAssetManager const & assetManager)
 {
-    assert(!!mWorld);
-
     // Load ship definition
-    auto shipDefinition = ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mMaterialDatabase);
+    auto shipDefinition = ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mMaterialDatabase, mThreadManager);
+
+    return InternalResetAndLoadShip(loadSpecs, std::move(shipDefinition), assetManager);
+}
+
+ShipMetadata GameController::InternalResetAndLoadShip(
+    ShipLoadSpecifications const & loadSpecs,
+    ShipDefinition && shipDefinition,
+    IAssetManager const & assetManager)
+{
+    assert(!!mWorld);
 
     // Pre-validate ship's textures, if any
     if (shipDefinition.Layers.ExteriorTextureLayer)
@@ -2001,7 +2346,7 @@ ShipMetadata GameController::InternalResetAndLoadShip(
 
     // Produce ship
     auto const shipId = newWorld->GetNextShipId();
-    auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+    auto [ship, exteriorTextureImage, interiorViewImage, deferredShipTextures] = ShipFactory::CreateProgressively(
         shipId,
         *newWorld,
         std::move(shipDefinition),
@@ -2011,7 +2356,8 @@ ShipMetadata GameController::InternalResetAndLoadShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     //
     // No errors, so we may continue
@@ -2023,6 +2369,7 @@ ShipMetadata GameController::InternalResetAndLoadShip(
         std::move(ship),
         std::move(exteriorTextureImage),
         std::move(interiorViewImage),
+        std::move(deferredShipTextures),
         shipMetadata);
 
     return shipMetadata;
@@ -2030,6 +2377,9 @@ ShipMetadata GameController::InternalResetAndLoadShip(
 
 void GameController::Reset(std::unique_ptr<Physics::World> newWorld)
 {
+    // The ships whose textures are being made are going away
+    DiscardPendingShipTextures();
+
     // Reset world
     assert(!!mWorld);
     mWorld = std::move(newWorld);
@@ -2058,6 +2408,7 @@ void GameController::InternalAddShip(
     std::unique_ptr<Physics::Ship> ship,
     RgbaImageData && exteriorTextureImage,
     RgbaImageData && interiorViewImage,
+    std::unique_ptr<ShipFactory::DeferredTextures> deferredShipTextures,
     ShipMetadata const & shipMetadata)
 {
     ShipId const shipId = ship->GetId();
@@ -2089,9 +2440,39 @@ void GameController::InternalAddShip(
         std::move(exteriorTextureImage),
         std::move(interiorViewImage));
 
+    // Start making the full textures, if we've got placeholders
+    if (deferredShipTextures)
+    {
+        auto pendingShipTextures = std::make_unique<PendingShipTextures>();
+        pendingShipTextures->Textures = std::move(deferredShipTextures);
+
+        // The texturizer gets our current settings in the order of the tasks
+        pendingShipTextures->CompletionIndicator = mShipTexturesThread.QueueTask(
+            [this,
+            pendingShipTextures = pendingShipTextures.get(),
+            sharedSettings = mShipTexturizer.GetSharedSettings(),
+            doForceSharedSettings = mShipTexturizer.GetDoForceSharedSettingsOntoShipSettings(),
+            maxGpuInteriorViewSize = mRenderContext->GetMaxGpuInteriorViewSize()]()
+            {
+                mBackgroundShipTexturizer.SetSharedSettings(sharedSettings);
+                mBackgroundShipTexturizer.SetDoForceSharedSettingsOntoShipSettings(doForceSharedSettings);
+
+                pendingShipTextures->Result.emplace(
+                    pendingShipTextures->Textures->Make(
+                        mBackgroundShipTexturizer,
+                        mGameAssetManager,
+                        maxGpuInteriorViewSize));
+            });
+
+        mPendingShipTextures.emplace_back(std::move(pendingShipTextures));
+    }
+
     // Tell view manager
     UpdateViewOnShipLoad();
 
+    // Log footprint
+    GetShipMemoryReport(shipId).Log("Ship " + std::to_string(shipId), 10);
+
     // Notify ship load
     mGameEventDispatcher.OnShipLoaded(
         shipId,
@@ -2101,6 +2482,75 @@ void GameController::InternalAddShip(
     mWorld->Announce();
 }
 
+void GameController::SwapInReadyShipTextures()
+{
+    for (auto it = mPendingShipTextures.begin(); it != mPendingShipTextures.end(); )
+    {
+        PendingShipTextures & pendingShipTextures = **it;
+
+        if (!pendingShipTextures.CompletionIndicator.IsCompleted())
+        {
+            ++it;
+            continue;
+        }
+
+        ShipId const shipId = pendingShipTextures.Textures->GetShipId();
+
+        try
+        {
+            // Surfaces the eventual exception
+            pendingShipTextures.CompletionIndicator.Wait();
+
+            assert(pendingShipTextures.Result.has_value());
+            auto & result = *pendingShipTextures.Result;
+
+            if (result.InteriorViewImage.has_value())
+            {
+                mRenderContext->UpdateShipTextures(
+                    shipId,
+                    std::move(result.ExteriorTextureImage),
+                    std::move(*result.InteriorViewImage));
+            }
+            else
+            {
+                // Make the interior view on the GPU
+                mRenderContext->UpdateShipTextures(
+                    shipId,
+                    std::move(result.ExteriorTextureImage),
+                    result.InteriorTextureImage,
+                    result.InteriorViewFloorVertices);
+            }
+
+            mWorld->SetShipInteriorTextureImage(shipId, std::move(result.InteriorTextureImage));
+        }
+        catch (std::exception const & exc)
+        {
+            // Not worth losing the ship for - it keeps its placeholders
+            LogMessage("GameController::SwapInReadyShipTextures(): cannot make textures of ship ", shipId, ": ", exc.what());
+        }
+
+        it = mPendingShipTextures.erase(it);
+    }
+}
+
+void GameController::DiscardPendingShipTextures()
+{
+    // Wait for the thread to be done with them
+    for (auto const & pendingShipTextures : mPendingShipTextures)
+    {
+        try
+        {
+            pendingShipTextures->CompletionIndicator.Wait();
+        }
+        catch (...)
+        {
+            // Ignore, we're discarding them anyway
+        }
+    }
+
+    mPendingShipTextures.clear();
+}
+
 void GameController::ResetStats()
 {
     mTotalPerfStats->Reset();
@@ -2110,6 +2560,12 @@ void GameController::ResetStats()
     mStatsOriginTimestampReal = std::chrono::steady_clock::time_point::min();
     mStatsLastTimestampReal = std::chrono::steady_clock::time_point::min();
     mSkippedFirstStatPublishes = 0;
+
+    if (mTelemetrySession.has_value())
+    {
+        // Deltas start afresh
+        mTelemetrySession->LastSampleTotalPerfStats.Reset();
+    }
 }
 
 void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
@@ -2148,7 +2604,68 @@ void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
         mIsPaused,
         mRenderContext->GetZoom(),
         mRenderContext->GetCameraWorldPosition(),
-        mRenderContext->GetStatistics());
+        mRenderContext->GetStatistics(),
+        mWorld->GetShipSpringRelaxationStates());
+}
+
+void GameController::UpdateTelemetry(std::chrono::steady_clock::time_point frameStartTimestampReal)
+{
+    assert(mTelemetrySession.has_value());
+
+    auto const nowReal = std::chrono::steady_clock::now();
+
+    auto const frameDuration = nowReal - frameStartTimestampReal;
+
+    ++(mTelemetrySession->FrameCount);
+    mTelemetrySession->TotalFrameDuration += frameDuration;
+    mTelemetrySession->MaxFrameDuration = std::max(mTelemetrySession->MaxFrameDuration, frameDuration);
+
+    if (nowReal - mTelemetrySession->LastSampleTimestampReal < mTelemetrySession->SampleInterval)
+    {
+        // Not yet
+        return;
+    }
+
+    //
+    // Make and publish sample
+    //
+
+    PerfStats const deltaPerfStats = *mTotalPerfStats - mTelemetrySession->LastSampleTotalPerfStats;
+
+    TelemetrySink::Sample sample;
+
+    sample.WallClockSeconds = std::chrono::duration<double>(nowReal - mTelemetrySession->StartTimestampReal).count();
+    sample.SimulationSeconds = mWorld->GetCurrentSimulationTime();
+
+    sample.FrameCount = mTelemetrySession->FrameCount;
+    sample.AverageFrameMilliseconds =
+        std::chrono::duration<float, std::milli>(mTelemetrySession->TotalFrameDuration).count()
+        / static_cast<float>(mTelemetrySession->FrameCount);
+    sample.MaxFrameMilliseconds = std::chrono::duration<float, std::milli>(mTelemetrySession->MaxFrameDuration).count();
+
+    for (size_t m = 0; m < TelemetrySink::PerfMeasurementCount; ++m)
+    {
+        sample.PerfMilliseconds[m] = deltaPerfStats.GetMeasurement(static_cast<PerfMeasurement>(m)).ToRatio<std::chrono::microseconds>() / 1000.0f;
+    }
+
+    sample.RenderStats = mRenderContext->GetStatistics();
+
+    sample.NpcCount = static_cast<std::uint32_t>(mCurrentNpcCount);
+    sample.HumanNpcInsideShipCount = static_cast<std::uint32_t>(mCurrentHumanNpcInsideShipCount);
+    sample.HumanNpcOutsideShipCount = static_cast<std::uint32_t>(mCurrentHumanNpcOutsideShipCount);
+    sample.FishCount = static_cast<std::uint32_t>(mCurrentFishCount);
+
+    mTelemetrySession->Sink->Publish(sample);
+
+    //
+    // Start next interval
+    //
+
+    mTelemetrySession->LastSampleTimestampReal = nowReal;
+    mTelemetrySession->LastSampleTotalPerfStats = *mTotalPerfStats;
+    mTelemetrySession->FrameCount = 0;
+    mTelemetrySession->TotalFrameDuration = std::chrono::steady_clock::duration::zero();
+    mTelemetrySession->MaxFrameDuration = std::chrono::steady_clock::duration::zero();
 }
 
 void GameController::OnBeginPlaceNewNpc(
@@ -12,13 +12,16 @@
 #include "IGameControllerSettingsOptions.h"
 #include "IGameEventHandlers.h"
 #include "NotificationLayer.h"
+#include "PerformanceGovernor.h"
 #include "ShipLoadSpecifications.h"
+#include "TelemetrySink.h"
 #include "ViewManager.h"
 
 #include <Simulation/FishSpeciesDatabase.h>
 #include <Simulation/MaterialDatabase.h>
 #include <Simulation/NpcDatabase.h>
 #include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipFactory.h>
 #include <Simulation/ShipMetadata.h>
 #include <Simulation/ShipStrengthRandomizer.h>
 #include <Simulation/ShipTexturizer.h>
@@ -37,12 +40,14 @@
 #include <Core/ImageData.h>
 #include <Core/ParameterSmoother.h>
 #include <Core/ProgressCallback.h>
+#include <Core/TaskThread.h>
 #include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -103,6 +108,16 @@ public:
         return mNpcDatabase.GetFurnitureSubKinds(role, language);
     }
 
+    /*
+     * Starts streaming telemetry to the specified file, at the specified number of samples
+     * per second; see TelemetrySink.
+     */
+    void StartTelemetry(
+        std::filesystem::path const & filePath,
+        float sampleRate);
+
+    void StopTelemetry();
+
     /////////////////////////////////////////////////////////
     // IGameController
     /////////////////////////////////////////////////////////
@@ -160,10 +175,13 @@ public:
     void RebindOpenGLContext();
 
     ShipMetadata ResetAndLoadShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) override;
+    ShipMetadata ResetAndLoadShip(ShipLoadSpecifications const & loadSpecs, ShipDefinition && shipDefinition, IAssetManager const & assetManager) override;
     ShipMetadata ResetAndReloadShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) override;
     ShipMetadata AddShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) override;
 
     RgbImageData TakeScreenshot() override;
+    void RequestScreenshot() override;
+    std::vector<RgbImageData> PopTakenScreenshots() override;
 
     void RunGameIteration() override;
     void LowFrequencyUpdate() override;
@@ -173,7 +191,9 @@ public:
         mIsPulseUpdateSet = true;
     }
 
-    void StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback) override;
+    void StartRecordingEvents(
+        std::function<void(uint32_t, RecordedEvent const &)> onEventCallback,
+        std::optional<std::filesystem::path> streamFilePath) override;
     RecordedEvents StopRecordingEvents() override;
     void ReplayRecordedEvent(RecordedEvent const & event) override;
 
@@ -293,6 +313,7 @@ public:
     std::optional<GlobalElementId> GetNearestPointAt(DisplayLogicalCoordinates const & screenCoordinates) const override;
     void QueryNearestPointAt(DisplayLogicalCoordinates const & screenCoordinates) const override;
     void QueryNearestNpcAt(DisplayLogicalCoordinates const & screenCoordinates) const override;
+    MemoryReport GetShipMemoryReport(ShipId shipId) const override;
 
     void TriggerTsunami() override;
     void TriggerRogueWave() override;
@@ -330,6 +351,12 @@ public:
     float GetMinCameraSpeedAdjustment() const override { return ViewManager::GetMinCameraSpeedAdjustment(); }
     float GetMaxCameraSpeedAdjustment() const override { return ViewManager::GetMaxCameraSpeedAdjustment(); }
 
+    bool GetDoDecoupledSimulationRate() const override { return mSimulationParameters.DoInterpolateRenderedPositions; }
+    void SetDoDecoupledSimulationRate(bool value) override;
+
+    bool GetDoAutoQuality() const override { return mAutoQualityBaseline.has_value(); }
+    void SetDoAutoQuality(bool value) override;
+
     bool GetDoAutoFocusOnShipLoad() const override { return mViewManager.GetDoAutoFocusOnShipLoad(); }
     void SetDoAutoFocusOnShipLoad(bool value) override { mViewManager.SetDoAutoFocusOnShipLoad(value); }
 
@@ -1054,6 +1081,10 @@ private:
 
     void OnShipRepaired(ShipId shipId) override;
 
+    void OnFishCountUpdated(size_t count) override;
+
+    void OnNpcCountsUpdated(size_t totalNpcCount) override;
+
     void OnHumanNpcCountsUpdated(
         size_t insideShipCount,
         size_t outsideShipCount) override;
@@ -1074,18 +1105,40 @@ private:
         ShipLoadSpecifications const & loadSpecs,
         IAssetManager const & assetManager);
 
+    ShipMetadata InternalResetAndLoadShip(
+        ShipLoadSpecifications const & loadSpecs,
+        ShipDefinition && shipDefinition,
+        IAssetManager const & assetManager);
+
     void Reset(std::unique_ptr<Physics::World> newWorld);
 
     void InternalAddShip(
         std::unique_ptr<Physics::Ship> ship,
         RgbaImageData && exteriorTextureImage,
         RgbaImageData && interiorViewImage,
+        std::unique_ptr<ShipFactory::DeferredTextures> deferredShipTextures,
         ShipMetadata const & shipMetadata);
 
+    void SwapInReadyShipTextures();
+
+    void DiscardPendingShipTextures();
+
     void ResetStats();
 
     void PublishStats(std::chrono::steady_clock::time_point nowReal);
 
+    void UpdateTelemetry(std::chrono::steady_clock::time_point frameStartTimestampReal);
+
+    void CalculateDecoupledSimulationSteps(
+        bool doUpdate,
+        bool isPulseUpdate,
+        size_t & outUpdateCount,
+        float & outRenderInterpolationFactor);
+
+    void UpdateAutoQuality(PerfStats const & lastDeltaPerfStats);
+
+    void ApplyAutoQualityLevel(int qualityLevel);
+
     void OnBeginPlaceNewNpc(
         NpcId const & npcId,
         bool doAnchorToScreen);
@@ -1147,6 +1200,24 @@ private:
     ShipStrengthRandomizer mShipStrengthRandomizer;
     ShipTexturizer mShipTexturizer;
 
+    //
+    // Progressive ship loading: ships are added with placeholder textures, while their
+    // full textures are made on a separate thread - with a texturizer of its own, as
+    // texturizers are not thread-safe - and swapped in when ready
+    //
+
+    struct PendingShipTextures
+    {
+        std::unique_ptr<ShipFactory::DeferredTextures> Textures;
+        std::optional<ShipFactory::DeferredTextures::Result> Result; // Set on the thread
+        TaskThread::TaskCompletionIndicator CompletionIndicator;
+    };
+
+    GameAssetManager const & mGameAssetManager;
+    ShipTexturizer mBackgroundShipTexturizer; // Only used on mShipTexturesThread
+    std::vector<std::unique_ptr<PendingShipTextures>> mPendingShipTextures;
+    TaskThread mShipTexturesThread; // After what its tasks use, so to be stopped first
+
 
     //
     // Our current state
@@ -1212,4 +1283,55 @@ private:
     uint64_t mTotalFrameCount;
     uint64_t mLastPublishedTotalFrameCount;
     int mSkippedFirstStatPublishes;
+
+    // As last announced by the world
+    size_t mCurrentNpcCount;
+    size_t mCurrentHumanNpcInsideShipCount;
+    size_t mCurrentHumanNpcOutsideShipCount;
+    size_t mCurrentFishCount;
+
+    //
+    // Telemetry
+    //
+
+    // Set if and only if telemetry is being streamed
+    struct TelemetrySession
+    {
+        std::unique_ptr<TelemetrySink> Sink;
+        std::chrono::steady_clock::duration SampleInterval;
+        std::chrono::steady_clock::time_point StartTimestampReal;
+        std::chrono::steady_clock::time_point LastSampleTimestampReal;
+        PerfStats LastSampleTotalPerfStats;
+
+        // Since the last sample
+        std::uint32_t FrameCount;
+        std::chrono::steady_clock::duration TotalFrameDuration;
+        std::chrono::steady_clock::duration MaxFrameDuration;
+    };
+
+    std::optional<TelemetrySession> mTelemetrySession;
+
+    //
+    // Auto-quality
+    //
+
+    // The settings that the governor overrides, as they were when auto-quality was enabled;
+    // set if and only if auto-quality is enabled
+    struct AutoQualityBaseline
+    {
+        float NumMechanicalDynamicsIterationsAdjustment;
+        unsigned int MaxBurningParticlesPerShip;
+        OceanRenderDetailType OceanRenderDetail;
+        CloudRenderDetailType CloudRenderDetail;
+    };
+
+    std::optional<AutoQualityBaseline> mAutoQualityBaseline;
+    PerformanceGovernor mPerformanceGovernor;
+
+    //
+    // Decoupled simulation rate
+    //
+
+    float mDecoupledSimulationTimeDebt; // Real time not yet simulated, in seconds
+    std::optional<std::chrono::steady_clock::time_point> mLastDecoupledGameIterationTimestampReal;
 };
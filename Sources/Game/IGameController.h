@@ -12,16 +12,20 @@
 #include <Simulation/EventRecorder.h>
 #include <Simulation/ISimulationEventHandlers.h>
 #include <Simulation/ShipAutoTexturizationSettings.h>
+#include <Simulation/ShipDefinition.h>
 #include <Simulation/ShipMetadata.h>
 
 #include <Core/Colors.h>
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
+#include <Core/MemoryReport.h>
 #include <Core/Vectors.h>
 
 #include <chrono>
+#include <filesystem>
 #include <functional>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -45,17 +49,22 @@ struct IGameController
     virtual void RegisterGameStatisticsEventHandler(IGameStatisticsEventHandler * handler) = 0;
 
     virtual ShipMetadata ResetAndLoadShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) = 0;
+    virtual ShipMetadata ResetAndLoadShip(ShipLoadSpecifications const & loadSpecs, ShipDefinition && shipDefinition, IAssetManager const & assetManager) = 0; // Definition already in memory, as in loadSpecs' file
     virtual ShipMetadata ResetAndReloadShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) = 0;
     virtual ShipMetadata AddShip(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager) = 0;
 
     virtual RgbImageData TakeScreenshot() = 0;
+    virtual void RequestScreenshot() = 0; // Of the next frame, read back asynchronously
+    virtual std::vector<RgbImageData> PopTakenScreenshots() = 0;
 
     virtual void RunGameIteration() = 0;
     virtual void LowFrequencyUpdate() = 0;
 
     virtual void PulseUpdateAtNextGameIteration() = 0;
 
-    virtual void StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback) = 0;
+    virtual void StartRecordingEvents(
+        std::function<void(uint32_t, RecordedEvent const &)> onEventCallback,
+        std::optional<std::filesystem::path> streamFilePath) = 0;
     virtual RecordedEvents StopRecordingEvents() = 0;
     virtual void ReplayRecordedEvent(RecordedEvent const & event) = 0;
 
@@ -176,6 +185,7 @@ struct IGameController
     virtual std::optional<GlobalElementId> GetNearestPointAt(DisplayLogicalCoordinates const & screenCoordinates) const = 0;
     virtual void QueryNearestPointAt(DisplayLogicalCoordinates const & screenCoordinates) const = 0;
     virtual void QueryNearestNpcAt(DisplayLogicalCoordinates const & screenCoordinates) const = 0;
+    virtual MemoryReport GetShipMemoryReport(ShipId shipId) const = 0;
 
     virtual void TriggerTsunami() = 0;
     virtual void TriggerRogueWave() = 0;
@@ -213,6 +223,14 @@ struct IGameController
     virtual float GetMinCameraSpeedAdjustment() const = 0;
     virtual float GetMaxCameraSpeedAdjustment() const = 0;
 
+    // When set, the simulation advances with real time - running as many fixed steps per iteration as
+    // needed - and ship points are rendered interpolated between the last two steps
+    virtual bool GetDoDecoupledSimulationRate() const = 0;
+    virtual void SetDoDecoupledSimulationRate(bool value) = 0;
+
+    virtual bool GetDoAutoQuality() const = 0;
+    virtual void SetDoAutoQuality(bool value) = 0;
+
     virtual bool GetDoAutoFocusOnShipLoad() const = 0;
     virtual void SetDoAutoFocusOnShipLoad(bool value) = 0;
 
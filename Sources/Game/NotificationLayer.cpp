@@ -12,6 +12,7 @@
 #include <Core/Conversions.h>
 #include <Core/GameWallClock.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <sstream>
@@ -77,7 +78,8 @@ void NotificationLayer::SetStatusTexts(
     bool isPaused,
     float zoom,
     vec2f const & camera,
-    RenderStatistics renderStats)
+    RenderStatistics renderStats,
+    std::vector<ShipSpringRelaxationState> const & springRelaxationStates)
 {
     int elapsedSecondsGameInt = static_cast<int>(roundf(elapsedGameSeconds.count()));
     int minutesGame = elapsedSecondsGameInt / 60;
@@ -124,9 +126,7 @@ void NotificationLayer::SetStatusTexts(
 			ss << std::fixed
 				<< std::setprecision(2)
 				<< "UPD:" << totalPerfStats.GetMeasurement<PerfMeasurement::TotalUpdate>().ToRatio<std::chrono::milliseconds>() << "MS"
-				<< " (W=" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalWaitForRenderUpload>().ToRatio<std::chrono::milliseconds>() << "MS +"
-				<< " " << totalNetUpdate << "MS"
-				<< " (S=" << shipsSpringsUpdatePercent << "%) (N=" << npcsUpdatePercent << "%))"
+				<< " (S=" << shipsSpringsUpdatePercent << "%) (N=" << npcsUpdatePercent << "%)"
 				<< " UPL:(W=" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalWaitForRenderDraw>().ToRatio<std::chrono::milliseconds>() << "MS +"
 				<< " " << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalNetRenderUpload>().ToRatio<std::chrono::milliseconds>() << "MS)"
 				;
@@ -168,6 +168,107 @@ void NotificationLayer::SetStatusTexts(
 			mStatusTextLines[3] = ss.str();
 		}
 
+		auto const toMs = [&lastDeltaPerfStats](PerfMeasurement measurement)
+			{
+				return lastDeltaPerfStats.GetMeasurement(measurement).ToRatio<std::chrono::milliseconds>();
+			};
+
+		ss.str("");
+
+		{
+			ss << std::fixed << std::setprecision(2)
+				<< "SIM: STR=" << toMs(PerfMeasurement::TotalShipsStrainUpdate)
+				<< " WFR=" << toMs(PerfMeasurement::TotalShipsWorldForcesUpdate)
+				<< " WAT=" << toMs(PerfMeasurement::TotalShipsWaterDynamicsUpdate)
+				<< " WDF=" << toMs(PerfMeasurement::TotalShipsWaterDiffusionUpdate)
+				<< " PRS=" << toMs(PerfMeasurement::TotalShipsPressureUpdate)
+				<< " HEA=" << toMs(PerfMeasurement::TotalShipsHeatUpdate)
+				<< " ELE=" << toMs(PerfMeasurement::TotalShipsElectricalUpdate)
+				<< " LGT=" << toMs(PerfMeasurement::TotalShipsLightDiffusionUpdate)
+				<< " CMB=" << toMs(PerfMeasurement::TotalShipsCombustionUpdate)
+				<< " EPH=" << toMs(PerfMeasurement::TotalShipsEphemeralParticlesUpdate)
+				<< " OCN=" << toMs(PerfMeasurement::TotalOceanSurfaceUpdate)
+				<< " NPC=" << toMs(PerfMeasurement::TotalNpcUpdate)
+				<< " FSH=" << toMs(PerfMeasurement::TotalFishUpdate);
+
+			mStatusTextLines[4] = ss.str();
+		}
+
+		ss.str("");
+
+		{
+			ss << std::fixed << std::setprecision(2)
+				<< "UPL: SKY=" << toMs(PerfMeasurement::TotalSkyRenderUpload)
+				<< " OCN=" << toMs(PerfMeasurement::TotalOceanRenderUpload)
+				<< " FSH=" << toMs(PerfMeasurement::TotalFishRenderUpload)
+				<< " SHP=" << toMs(PerfMeasurement::TotalShipsRenderUpload)
+				<< " (STC=" << toMs(PerfMeasurement::TotalShipsStructureUpdate)
+				<< " PNT=" << toMs(PerfMeasurement::TotalShipsPointsRenderUpload)
+				<< " ELM=" << toMs(PerfMeasurement::TotalShipsElementsRenderUpload)
+				<< " FRN=" << toMs(PerfMeasurement::TotalShipsFrontiersRenderUpload) << ")"
+				<< " NPC=" << toMs(PerfMeasurement::TotalNpcRenderUpload)
+				<< " NTF=" << toMs(PerfMeasurement::TotalNotificationsRenderUpload);
+
+			mStatusTextLines[5] = ss.str();
+		}
+
+		ss.str("");
+
+		{
+			auto const toGpuMs = [&renderStats](RenderStatistics::RenderPassType pass)
+				{
+					return renderStats.LastGpuPassMilliseconds[static_cast<size_t>(pass)];
+				};
+
+			auto const toKb = [&renderStats](RenderStatistics::UploadKindType uploadKind)
+				{
+					return static_cast<float>(renderStats.LastUploadedBytes[static_cast<size_t>(uploadKind)]) / 1024.0f;
+				};
+
+			ss << std::fixed << std::setprecision(2)
+				<< "GPU: BKG=" << toGpuMs(RenderStatistics::RenderPassType::Background)
+				<< " SHP=" << toGpuMs(RenderStatistics::RenderPassType::Ships)
+				<< " FGR=" << toGpuMs(RenderStatistics::RenderPassType::Foreground)
+				<< " NTF=" << toGpuMs(RenderStatistics::RenderPassType::Notifications)
+				<< " DRW:" << renderStats.LastShipDrawCalls
+				<< " UPL(KB): PNT=" << toKb(RenderStatistics::UploadKindType::ShipPoints)
+				<< " ELM=" << toKb(RenderStatistics::UploadKindType::ShipElements)
+				<< " NPC=" << toKb(RenderStatistics::UploadKindType::ShipNpcs)
+				<< " EFX=" << toKb(RenderStatistics::UploadKindType::ShipEffects);
+
+			mStatusTextLines[6] = ss.str();
+		}
+
+		ss.str("");
+
+		{
+			// Only the first few ships fit on a line
+			size_t constexpr MaxShips = 8;
+
+			ss << "SPR:";
+			for (size_t s = 0; s < std::min(springRelaxationStates.size(), MaxShips); ++s)
+			{
+				auto const & state = springRelaxationStates[s];
+
+				ss << " #" << state.Ship << "=";
+				switch (state.Mode)
+				{
+					case SpringRelaxationParallelComputationModeType::StepByStep: ss << "SBS"; break;
+					case SpringRelaxationParallelComputationModeType::FullSpeed: ss << "FSP"; break;
+					case SpringRelaxationParallelComputationModeType::Hybrid: ss << "HYB"; break;
+					case SpringRelaxationParallelComputationModeType::Chebyshev: ss << "CHB"; break;
+					case SpringRelaxationParallelComputationModeType::Automatic: ss << "?"; break;
+				}
+
+				ss << "/" << state.Parallelism << (state.IsEvaluating ? "*" : "");
+			}
+
+			if (springRelaxationStates.size() > MaxShips)
+				ss << " ...";
+
+			mStatusTextLines[7] = ss.str();
+		}
+
 		// Text needs to be re-uploaded
 		mIsStatusTextDirty = true;
     }
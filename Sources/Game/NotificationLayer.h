@@ -49,7 +49,8 @@ public:
         bool isPaused,
         float zoom,
         vec2f const & camera,
-        RenderStatistics renderStats);
+        RenderStatistics renderStats,
+        std::vector<ShipSpringRelaxationState> const & springRelaxationStates);
 
 	void PublishNotificationText(
 		std::string const & text,
@@ -202,7 +203,7 @@ private:
 
     bool mIsStatusTextEnabled;
     bool mIsExtendedStatusTextEnabled;
-	std::array<std::string, 4> mStatusTextLines;
+	std::array<std::string, 8> mStatusTextLines;
 	bool mIsStatusTextDirty;
 
 	//
@@ -0,0 +1,69 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "PerformanceGovernor.h"
+
+#include <Core/Log.h>
+
+#include <cassert>
+
+PerformanceGovernor::PerformanceGovernor(float targetFrameTimeMillis)
+    : mTargetFrameTimeMillis(targetFrameTimeMillis)
+    , mQualityLevel(MaxQualityLevel)
+    , mConsecutiveSlowPeriods(0)
+    , mConsecutiveFastPeriods(0)
+{
+    assert(mTargetFrameTimeMillis > 0.0f);
+}
+
+int PerformanceGovernor::Update(float frameTimeMillis)
+{
+    if (frameTimeMillis > mTargetFrameTimeMillis * SlowFrameTimeFraction)
+    {
+        ++mConsecutiveSlowPeriods;
+        mConsecutiveFastPeriods = 0;
+
+        if (mConsecutiveSlowPeriods >= SlowPeriodsToLowerQuality
+            && mQualityLevel > 0)
+        {
+            --mQualityLevel;
+
+            LogMessage("PerformanceGovernor: frame time ", frameTimeMillis, "ms, lowering quality to ", mQualityLevel);
+
+            // Give the new level a chance to show its effects
+            mConsecutiveSlowPeriods = 0;
+        }
+    }
+    else if (frameTimeMillis < mTargetFrameTimeMillis * FastFrameTimeFraction)
+    {
+        ++mConsecutiveFastPeriods;
+        mConsecutiveSlowPeriods = 0;
+
+        if (mConsecutiveFastPeriods >= FastPeriodsToRaiseQuality
+            && mQualityLevel < MaxQualityLevel)
+        {
+            ++mQualityLevel;
+
+            LogMessage("PerformanceGovernor: frame time ", frameTimeMillis, "ms, raising quality to ", mQualityLevel);
+
+            mConsecutiveFastPeriods = 0;
+        }
+    }
+    else
+    {
+        // Within the dead band
+        mConsecutiveSlowPeriods = 0;
+        mConsecutiveFastPeriods = 0;
+    }
+
+    return mQualityLevel;
+}
+
+void PerformanceGovernor::Reset()
+{
+    mQualityLevel = MaxQualityLevel;
+    mConsecutiveSlowPeriods = 0;
+    mConsecutiveFastPeriods = 0;
+}
@@ -0,0 +1,58 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+/*
+ * Closed-loop controller of the game's quality, complementing the one-off tuning
+ * done by the ComputerCalibrator at startup.
+ *
+ * Fed once per stats period with the frame time measured during the period, it
+ * lowers the quality level when frames are persistently slower than the target,
+ * and raises it back when they are persistently - and comfortably - faster. The
+ * two thresholds and the different persistence requirements provide the hysteresis
+ * that prevents oscillating between two levels.
+ *
+ * The governor only decides the level; mapping levels to settings is up to the caller.
+ */
+class PerformanceGovernor final
+{
+public:
+
+    // Full quality, i.e. the user's settings
+    static int constexpr MaxQualityLevel = 4;
+
+    explicit PerformanceGovernor(float targetFrameTimeMillis);
+
+    int GetQualityLevel() const
+    {
+        return mQualityLevel;
+    }
+
+    /*
+     * Returns the quality level to use from now on.
+     */
+    int Update(float frameTimeMillis);
+
+    void Reset();
+
+private:
+
+    // Frames slower than this fraction of the target count as slow...
+    static float constexpr SlowFrameTimeFraction = 1.1f;
+    // ...for this many consecutive periods before we lower the quality
+    static int constexpr SlowPeriodsToLowerQuality = 2;
+
+    // Frames faster than this fraction of the target count as fast...
+    static float constexpr FastFrameTimeFraction = 0.7f;
+    // ...for this many consecutive periods before we raise the quality
+    static int constexpr FastPeriodsToRaiseQuality = 5;
+
+    float const mTargetFrameTimeMillis;
+
+    int mQualityLevel;
+    int mConsecutiveSlowPeriods;
+    int mConsecutiveFastPeriods;
+};
@@ -18,6 +18,7 @@
 #include <chrono>
 #include <filesystem>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <typeinfo>
@@ -204,6 +205,11 @@ public:
         return mStorage.OpenBinaryOutputStream(mSettingsKey, streamName, extension);
     }
 
+    PersistedSettingsKey const & GetSettingsKey() const
+    {
+        return mSettingsKey;
+    }
+
     std::unique_ptr<TextWriteStream> GetNamedTextOutputStream(
         std::string const & streamName,
         std::string const & extension)
@@ -709,6 +715,29 @@ public:
         }
     }
 
+    /*
+     * Copies all and only the settings that are dirty in the other settings container;
+     * after this call, the copied settings are marked as dirty, and all the others
+     * are marked as clean.
+     */
+    void AssignDirty(Settings<TEnum> const & other)
+    {
+        assert(mSettings.size() == other.mSettings.size());
+
+        for (size_t s = 0; s < mSettings.size(); ++s)
+        {
+            if (other.mSettings[s]->IsDirty())
+            {
+                mSettings[s] = other.mSettings[s]->Clone();
+                mSettings[s]->MarkAsDirty();
+            }
+            else
+            {
+                mSettings[s]->ClearDirty();
+            }
+        }
+    }
+
     /*
      * Serializes all and only the dirty settings.
      */
@@ -974,8 +1003,7 @@ public:
 		PersistedSettingsKey const & key,
 		Settings<TEnum> & settings) const
 	{
-		SettingsDeserializationContext ctx(key, mStorage);
-		settings.Deserialize(ctx);
+		settings.AssignDirty(GetPersistedSettings(key));
 	}
 
     /*
@@ -994,11 +1022,15 @@ public:
             mStorage);
 
         settings.SerializeDirty(ctx);
+
+        InvalidatePersistedSettings(ctx.GetSettingsKey());
     }
 
     void DeletePersistedSettings(PersistedSettingsKey const & key)
     {
         mStorage.Delete(key);
+
+        InvalidatePersistedSettings(key);
     }
 
     /*
@@ -1024,13 +1056,7 @@ public:
 			Settings<TEnum> settings = mDefaultSettings;
 
 			// Load settings on top of defaults
-			{
-				SettingsDeserializationContext ctx(
-					PersistedSettingsKey::MakeLastModifiedSettingsKey(),
-					mStorage);
-
-				settings.Deserialize(ctx);
-			}
+			settings.AssignDirty(GetPersistedSettings(PersistedSettingsKey::MakeLastModifiedSettingsKey()));
 
 			// Enforce all settings, using the "immediate" setters
 			settings.MarkAllAsDirty();
@@ -1069,6 +1095,8 @@ public:
 				settings.SerializeDirty(ctx);
 			}
 
+			InvalidatePersistedSettings(PersistedSettingsKey::MakeLastModifiedSettingsKey());
+
 			return true;
 		}
 		else
@@ -1119,6 +1147,7 @@ protected:
         , mTemplateSettings(std::move(factory.mSettings))
         , mEnforcers(std::move(factory.mEnforcers))
         , mDefaultSettings(mTemplateSettings)
+        , mPersistedSettingsCache()
     {
         // Build defaults
         // (assuming this manager is constructed when all getters deliver
@@ -1129,6 +1158,49 @@ protected:
 
 private:
 
+    /*
+     * Returns the settings with the specified key, deserializing them only the first time,
+     * and marked as dirty if and only if they are persisted.
+     */
+    Settings<TEnum> const & GetPersistedSettings(PersistedSettingsKey const & key) const
+    {
+        auto it = std::find_if(
+            mPersistedSettingsCache.cbegin(),
+            mPersistedSettingsCache.cend(),
+            [&key](auto const & entry)
+            {
+                return entry.first == key;
+            });
+
+        if (it == mPersistedSettingsCache.cend())
+        {
+            Settings<TEnum> settings = mTemplateSettings;
+
+            {
+                SettingsDeserializationContext ctx(key, mStorage);
+                settings.Deserialize(ctx);
+            }
+
+            mPersistedSettingsCache.emplace_back(key, std::move(settings));
+            it = std::prev(mPersistedSettingsCache.cend());
+        }
+
+        return it->second;
+    }
+
+    void InvalidatePersistedSettings(PersistedSettingsKey const & key)
+    {
+        mPersistedSettingsCache.erase(
+            std::remove_if(
+                mPersistedSettingsCache.begin(),
+                mPersistedSettingsCache.end(),
+                [&key](auto const & entry)
+                {
+                    return entry.first == key;
+                }),
+            mPersistedSettingsCache.end());
+    }
+
     // Storage
     SettingsStorage mStorage;
 
@@ -1138,4 +1210,8 @@ private:
 
     // Default settings
     Settings<TEnum> mDefaultSettings;
+
+    // Settings deserialized so far, so that switching among them doesn't
+    // hit the storage and the JSON parser each time
+    mutable std::vector<std::pair<PersistedSettingsKey, Settings<TEnum>>> mPersistedSettingsCache;
 };
@@ -14,6 +14,7 @@
 #include <Simulation/ShipDefinitionFormatDeSerializer.h>
 
 #include <Core/GameException.h>
+#include <Core/Log.h>
 
 #include <memory>
 
@@ -26,23 +27,15 @@ ShipDefinition ShipDeSerializer::LoadShip(
     std::filesystem::path const & shipFilePath,
     MaterialDatabase const & materialDatabase)
 {
-    if (IsShipDefinitionFile(shipFilePath))
-    {
-        auto inputStream = FileBinaryReadStream(shipFilePath);
-        return ShipDefinitionFormatDeSerializer::Load(inputStream, materialDatabase);
-    }
-    else if (IsImageDefinitionFile(shipFilePath))
-    {
-        return ShipLegacyFormatDeSerializer::LoadShipFromImageDefinition(shipFilePath, materialDatabase);
-    }
-    else if (IsLegacyShpShipDefinitionFile(shipFilePath))
-    {
-        return ShipLegacyFormatDeSerializer::LoadShipFromLegacyShpShipDefinition(shipFilePath, materialDatabase);
-    }
-    else
-    {
-        throw GameException("Ship filename \"" + shipFilePath.filename().string() + "\" is not recognized as a ship file");
-    }
+    return InternalLoadShip(shipFilePath, materialDatabase, nullptr);
+}
+
+ShipDefinition ShipDeSerializer::LoadShip(
+    std::filesystem::path const & shipFilePath,
+    MaterialDatabase const & materialDatabase,
+    ThreadManager & threadManager)
+{
+    return InternalLoadShip(shipFilePath, materialDatabase, &threadManager);
 }
 
 EnhancedShipPreviewData ShipDeSerializer::LoadShipPreviewData(std::filesystem::path const & shipFilePath)
@@ -92,11 +85,49 @@ void ShipDeSerializer::SaveShip(
     ShipDefinition const & shipDefinition,
     std::filesystem::path const & shipFilePath)
 {
-    auto outputStream = FileBinaryWriteStream(shipFilePath);
-    ShipDefinitionFormatDeSerializer::Save(
+    SaveShip(
         shipDefinition,
-        CurrentGameVersion,
-        outputStream);
+        shipFilePath,
+        SimpleProgressCallback::Dummy());
+}
+
+void ShipDeSerializer::SaveShip(
+    ShipDefinition const & shipDefinition,
+    std::filesystem::path const & shipFilePath,
+    SimpleProgressCallback const & progressCallback)
+{
+    //
+    // Write to a temporary file next to the target - hence on the same volume - and
+    // then replace the target with it, so that a failed save never clobbers the
+    // previous version of the ship
+    //
+
+    std::filesystem::path temporaryFilePath = shipFilePath;
+    temporaryFilePath += ".tmp";
+
+    try
+    {
+        {
+            auto outputStream = FileBinaryWriteStream(temporaryFilePath);
+
+            ShipDefinitionFormatDeSerializer::Save(
+                shipDefinition,
+                CurrentGameVersion,
+                outputStream,
+                progressCallback);
+
+            outputStream.Close();
+        }
+
+        std::filesystem::rename(temporaryFilePath, shipFilePath);
+    }
+    catch (...)
+    {
+        std::error_code ec;
+        std::filesystem::remove(temporaryFilePath, ec);
+
+        throw;
+    }
 }
 
 void ShipDeSerializer::SaveStructuralLayerImage(
@@ -126,6 +157,131 @@ void ShipDeSerializer::SaveStructuralLayerImage(
 
 ///////////////////////////////////////////////////////
 
+ShipDefinition ShipDeSerializer::InternalLoadShip(
+    std::filesystem::path const & shipFilePath,
+    MaterialDatabase const & materialDatabase,
+    ThreadManager * threadManager)
+{
+    if (IsShipDefinitionFile(shipFilePath))
+    {
+        auto inputStream = MemoryMappedFileBinaryReadStream(shipFilePath);
+        return threadManager != nullptr
+            ? ShipDefinitionFormatDeSerializer::Load(inputStream, materialDatabase, *threadManager)
+            : ShipDefinitionFormatDeSerializer::Load(inputStream, materialDatabase);
+    }
+    else if (IsImageDefinitionFile(shipFilePath) || IsLegacyShpShipDefinitionFile(shipFilePath))
+    {
+        return LoadLegacyShip(shipFilePath, materialDatabase, threadManager);
+    }
+    else
+    {
+        throw GameException("Ship filename \"" + shipFilePath.filename().string() + "\" is not recognized as a ship file");
+    }
+}
+
+ShipDefinition ShipDeSerializer::LoadLegacyShip(
+    std::filesystem::path const & shipFilePath,
+    MaterialDatabase const & materialDatabase,
+    ThreadManager * threadManager)
+{
+    std::filesystem::path const cacheFilePath = GetLegacyShipCacheFilePath(shipFilePath);
+
+    //
+    // Try cache first
+    //
+
+    if (IsLegacyShipCacheValid(shipFilePath, cacheFilePath))
+    {
+        try
+        {
+            auto inputStream = MemoryMappedFileBinaryReadStream(cacheFilePath);
+            return threadManager != nullptr
+                ? ShipDefinitionFormatDeSerializer::Load(inputStream, materialDatabase, *threadManager)
+                : ShipDefinitionFormatDeSerializer::Load(inputStream, materialDatabase);
+        }
+        catch (std::exception const & ex)
+        {
+            // Fall back to the original
+            LogMessage("ShipDeSerializer: ignoring unreadable cache \"", cacheFilePath.string(), "\": ", ex.what());
+        }
+    }
+
+    //
+    // Convert
+    //
+
+    ThreadPool * const threadPool = threadManager != nullptr ? &(threadManager->GetSimulationThreadPool()) : nullptr;
+
+    ShipDefinition shipDefinition = IsImageDefinitionFile(shipFilePath)
+        ? ShipLegacyFormatDeSerializer::LoadShipFromImageDefinition(shipFilePath, materialDatabase, threadPool)
+        : ShipLegacyFormatDeSerializer::LoadShipFromLegacyShpShipDefinition(shipFilePath, materialDatabase, threadPool);
+
+    //
+    // Cache; ships might well live in read-only directories, hence failures are not errors
+    //
+
+    try
+    {
+        SaveShip(shipDefinition, cacheFilePath);
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("ShipDeSerializer: cannot cache converted ship to \"", cacheFilePath.string(), "\": ", ex.what());
+
+        try
+        {
+            // Do not leave a partial cache behind
+            if (FileSystem::Exists(cacheFilePath))
+                FileSystem::DeleteFile(cacheFilePath);
+        }
+        catch (...)
+        {
+            // Ignore
+        }
+    }
+
+    return shipDefinition;
+}
+
+std::filesystem::path ShipDeSerializer::GetLegacyShipCacheFilePath(std::filesystem::path const & shipFilePath)
+{
+    // E.g. "Titanic.png" -> "Titanic.png.1.19.1.6.shp2cache"; the extension keeps it from being taken for a ship
+    return std::filesystem::path(shipFilePath).concat("." + CurrentGameVersion.ToString() + ".shp2cache");
+}
+
+bool ShipDeSerializer::IsLegacyShipCacheValid(
+    std::filesystem::path const & shipFilePath,
+    std::filesystem::path const & cacheFilePath)
+{
+    try
+    {
+        if (!FileSystem::Exists(cacheFilePath))
+        {
+            return false;
+        }
+
+        std::vector<std::filesystem::path> const sourceFilePaths = IsLegacyShpShipDefinitionFile(shipFilePath)
+            ? ShipLegacyFormatDeSerializer::GetLegacyShpShipDefinitionSourceFilePaths(shipFilePath)
+            : std::vector<std::filesystem::path>{ shipFilePath };
+
+        auto const cacheTime = FileSystem::GetLastModifiedTime(cacheFilePath);
+        for (auto const & sourceFilePath : sourceFilePaths)
+        {
+            if (FileSystem::GetLastModifiedTime(sourceFilePath) > cacheTime)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    catch (...)
+    {
+        // Let the actual load report what's wrong with the ship
+        return false;
+    }
+}
+
 bool ShipDeSerializer::IsImageDefinitionFile(std::filesystem::path const & shipFilePath)
 {
     return Utils::CaseInsensitiveEquals(shipFilePath.extension().string(), GetImageDefinitionFileExtension());
@@ -12,6 +12,8 @@
 #include <Simulation/ShipDefinition.h>
 
 #include <Core/ImageData.h>
+#include <Core/ProgressCallback.h>
+#include <Core/ThreadManager.h>
 
 #include <cstdint>
 #include <filesystem>
@@ -48,10 +50,23 @@ public:
             || IsLegacyShpShipDefinitionFile(filepath);
     }
 
+    /*
+     * Ships in the legacy formats are cached, once converted, in the current format in a file
+     * next to the original - which is used for as long as it is newer than all of the ship's
+     * files and was written by this very version of the game.
+     */
     static ShipDefinition LoadShip(
         std::filesystem::path const & shipFilePath,
         MaterialDatabase const & materialDatabase);
 
+    /*
+     * Decodes the layers of ships concurrently.
+     */
+    static ShipDefinition LoadShip(
+        std::filesystem::path const & shipFilePath,
+        MaterialDatabase const & materialDatabase,
+        ThreadManager & threadManager);
+
     static EnhancedShipPreviewData LoadShipPreviewData(std::filesystem::path const & shipFilePath);
 
     static RgbaImageData LoadShipPreviewImage(
@@ -62,12 +77,37 @@ public:
         ShipDefinition const & shipDefinition,
         std::filesystem::path const & shipFilePath);
 
+    /*
+     * Encodes the ship concurrently, and replaces the file - if it exists - only once
+     * the whole ship has been written.
+     */
+    static void SaveShip(
+        ShipDefinition const & shipDefinition,
+        std::filesystem::path const & shipFilePath,
+        SimpleProgressCallback const & progressCallback);
+
     static void SaveStructuralLayerImage(
         StructuralLayerData const & structuralLayer,
         std::filesystem::path const & shipFilePath);
 
 private:
 
+    static ShipDefinition InternalLoadShip(
+        std::filesystem::path const & shipFilePath,
+        MaterialDatabase const & materialDatabase,
+        ThreadManager * threadManager);
+
+    static ShipDefinition LoadLegacyShip(
+        std::filesystem::path const & shipFilePath,
+        MaterialDatabase const & materialDatabase,
+        ThreadManager * threadManager);
+
+    static std::filesystem::path GetLegacyShipCacheFilePath(std::filesystem::path const & shipFilePath);
+
+    static bool IsLegacyShipCacheValid(
+        std::filesystem::path const & shipFilePath,
+        std::filesystem::path const & cacheFilePath);
+
     static bool IsImageDefinitionFile(std::filesystem::path const & shipFilePath);
 
     static bool IsLegacyShpShipDefinitionFile(std::filesystem::path const & shipFilePath);
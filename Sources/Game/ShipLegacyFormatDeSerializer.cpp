@@ -12,11 +12,14 @@
 #include <Core/ImageTools.h>
 #include <Core/Utils.h>
 
+#include <cassert>
+#include <exception>
 #include <memory>
 
 ShipDefinition ShipLegacyFormatDeSerializer::LoadShipFromImageDefinition(
     std::filesystem::path const & shipFilePath,
-    MaterialDatabase const & materialDatabase)
+    MaterialDatabase const & materialDatabase,
+    ThreadPool * threadPool)
 {
     return LoadFromDefinitionImageFilePaths(
         shipFilePath,
@@ -27,12 +30,14 @@ ShipDefinition ShipLegacyFormatDeSerializer::LoadShipFromImageDefinition(
         ShipMetadata(shipFilePath.stem().string()),
         ShipPhysicsData(),
         std::nullopt, // AutoTexturizationSettings
-        materialDatabase);
+        materialDatabase,
+        threadPool);
 }
 
 ShipDefinition ShipLegacyFormatDeSerializer::LoadShipFromLegacyShpShipDefinition(
     std::filesystem::path const & shipFilePath,
-    MaterialDatabase const & materialDatabase)
+    MaterialDatabase const & materialDatabase,
+    ThreadPool * threadPool)
 {
     JsonDefinition jsonDefinition = LoadLegacyShpShipDefinitionJson(shipFilePath);
 
@@ -45,7 +50,25 @@ ShipDefinition ShipLegacyFormatDeSerializer::LoadShipFromLegacyShpShipDefinition
         jsonDefinition.Metadata,
         jsonDefinition.PhysicsData,
         jsonDefinition.AutoTexturizationSettings,
-        materialDatabase);
+        materialDatabase,
+        threadPool);
+}
+
+std::vector<std::filesystem::path> ShipLegacyFormatDeSerializer::GetLegacyShpShipDefinitionSourceFilePaths(std::filesystem::path const & shipFilePath)
+{
+    JsonDefinition const jsonDefinition = LoadLegacyShpShipDefinitionJson(shipFilePath);
+
+    std::vector<std::filesystem::path> sourceFilePaths{ shipFilePath, jsonDefinition.StructuralLayerImageFilePath };
+
+    for (auto const & optionalFilePath : { jsonDefinition.ElectricalLayerImageFilePath, jsonDefinition.RopesLayerImageFilePath, jsonDefinition.TextureLayerImageFilePath })
+    {
+        if (optionalFilePath.has_value())
+        {
+            sourceFilePaths.push_back(*optionalFilePath);
+        }
+    }
+
+    return sourceFilePaths;
 }
 
 EnhancedShipPreviewData ShipLegacyFormatDeSerializer::LoadShipPreviewDataFromImageDefinition(std::filesystem::path const & imageDefinitionFilePath)
@@ -302,62 +325,128 @@ ShipDefinition ShipLegacyFormatDeSerializer::LoadFromDefinitionImageFilePaths(
     ShipMetadata const & metadata,
     ShipPhysicsData const & physicsData,
     std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
-    MaterialDatabase const & materialDatabase)
+    MaterialDatabase const & materialDatabase,
+    ThreadPool * threadPool)
 {
     //
     // Load images
     //
 
-    RgbImageData structuralLayerImage = GameAssetManager::LoadPngImageRgb(structuralLayerImageFilePath);
-
+    std::optional<RgbImageData> structuralLayerImage;
     std::optional<RgbImageData> electricalLayerImage;
+    std::optional<RgbImageData> ropesLayerImage;
+    std::optional<RgbaImageData> textureLayerImage;
+
+    std::vector<ThreadPool::Task> imageDecoders;
+
+    imageDecoders.emplace_back(
+        [&]()
+        {
+            structuralLayerImage.emplace(
+                GameAssetManager::LoadPngImageRgb(structuralLayerImageFilePath));
+        });
+
     if (electricalLayerImageFilePath.has_value())
     {
-        try
-        {
-            electricalLayerImage.emplace(
-                GameAssetManager::LoadPngImageRgb(*electricalLayerImageFilePath));
-        }
-        catch (GameException const & gex)
-        {
-            throw GameException("Error loading electrical layer image: " + std::string(gex.what()));
-        }
+        imageDecoders.emplace_back(
+            [&]()
+            {
+                try
+                {
+                    electricalLayerImage.emplace(
+                        GameAssetManager::LoadPngImageRgb(*electricalLayerImageFilePath));
+                }
+                catch (GameException const & gex)
+                {
+                    throw GameException("Error loading electrical layer image: " + std::string(gex.what()));
+                }
+            });
     }
 
-    std::optional<RgbImageData> ropesLayerImage;
     if (ropesLayerImageFilePath.has_value())
     {
-        try
-        {
-            ropesLayerImage.emplace(
-                GameAssetManager::LoadPngImageRgb(*ropesLayerImageFilePath));
-        }
-        catch (GameException const & gex)
-        {
-            throw GameException("Error loading rope layer image: " + std::string(gex.what()));
-        }
+        imageDecoders.emplace_back(
+            [&]()
+            {
+                try
+                {
+                    ropesLayerImage.emplace(
+                        GameAssetManager::LoadPngImageRgb(*ropesLayerImageFilePath));
+                }
+                catch (GameException const & gex)
+                {
+                    throw GameException("Error loading rope layer image: " + std::string(gex.what()));
+                }
+            });
     }
 
-    std::optional<RgbaImageData> textureLayerImage;
     if (textureLayerImageFilePath.has_value())
     {
-        try
+        imageDecoders.emplace_back(
+            [&]()
+            {
+                try
+                {
+                    textureLayerImage.emplace(
+                        GameAssetManager::LoadPngImageRgba(*textureLayerImageFilePath));
+                }
+                catch (GameException const & gex)
+                {
+                    throw GameException("Error loading texture layer image: " + std::string(gex.what()));
+                }
+            });
+    }
+
+    if (threadPool == nullptr || imageDecoders.size() <= 1)
+    {
+        for (auto const & imageDecoder : imageDecoders)
         {
-            textureLayerImage.emplace(
-                GameAssetManager::LoadPngImageRgba(*textureLayerImageFilePath));
+            imageDecoder();
         }
-        catch (GameException const & gex)
+    }
+    else
+    {
+        // The thread pool swallows exceptions, hence we ferry them back ourselves;
+        // the first one wins, i.e. the structural layer's
+        std::vector<std::exception_ptr> exceptions(imageDecoders.size());
+
+        std::vector<ThreadPool::Task> tasks;
+        tasks.reserve(imageDecoders.size());
+        for (size_t i = 0; i < imageDecoders.size(); ++i)
         {
-            throw GameException("Error loading texture layer image: " + std::string(gex.what()));
+            tasks.emplace_back(
+                [&imageDecoders, &exceptions, i]()
+                {
+                    try
+                    {
+                        imageDecoders[i]();
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+        }
+
+        threadPool->Run(tasks);
+
+        for (auto const & exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
         }
     }
 
+    assert(structuralLayerImage.has_value());
+
     //
     // Materialize ship
     //
 
     return LoadFromDefinitionImages(
-        std::move(structuralLayerImage),
+        std::move(*structuralLayerImage),
         std::move(electricalLayerImage),
         std::move(electricalPanel),
         std::move(ropesLayerImage),
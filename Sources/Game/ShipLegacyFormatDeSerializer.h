@@ -12,10 +12,12 @@
 #include <Simulation/ShipDefinition.h>
 
 #include <Core/ImageData.h>
+#include <Core/ThreadPool.h>
 
 #include <cstdint>
 #include <filesystem>
 #include <optional>
+#include <vector>
 
 /*
  * All the logic to load and save ships from and to legacy format files.
@@ -24,13 +26,23 @@ class ShipLegacyFormatDeSerializer
 {
 public:
 
+    /*
+     * The layer images are decoded concurrently when a thread pool is provided.
+     */
     static ShipDefinition LoadShipFromImageDefinition(
         std::filesystem::path const & shipFilePath,
-        MaterialDatabase const & materialDatabase);
+        MaterialDatabase const & materialDatabase,
+        ThreadPool * threadPool);
 
     static ShipDefinition LoadShipFromLegacyShpShipDefinition(
         std::filesystem::path const & shipFilePath,
-        MaterialDatabase const & materialDatabase);
+        MaterialDatabase const & materialDatabase,
+        ThreadPool * threadPool);
+
+    /*
+     * Gets all the files that make up a legacy .shp ship: the definition itself and its layer images.
+     */
+    static std::vector<std::filesystem::path> GetLegacyShpShipDefinitionSourceFilePaths(std::filesystem::path const & shipFilePath);
 
     static EnhancedShipPreviewData LoadShipPreviewDataFromImageDefinition(std::filesystem::path const & imageDefinitionFilePath);
 
@@ -84,7 +96,8 @@ private:
         ShipMetadata const & metadata,
         ShipPhysicsData const & physicsData,
         std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
-        MaterialDatabase const & materialDatabase);
+        MaterialDatabase const & materialDatabase,
+        ThreadPool * threadPool);
 
     static ShipDefinition LoadFromDefinitionImages(
         RgbImageData && structuralLayerImage,
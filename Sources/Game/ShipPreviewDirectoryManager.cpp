@@ -42,42 +42,45 @@ RgbaImageData ShipPreviewDirectoryManager::LoadPreviewImage(
     // (will throw if the file does not exist)
     auto const previewImageFileLastModified = mFileSystem->GetLastModifiedTime(previewData.PreviewFilePath);
 
-    // See if this preview file may be served by old database
-    auto oldDbPreviewImage = mOldDatabase.TryGetPreviewImage(previewImageFilename, previewImageFileLastModified);
-    if (oldDbPreviewImage.has_value())
     {
-        //
-        // Served by DB
-        //
+        std::scoped_lock lock(mDatabaseMutex);
 
-        // Tell new DB that this preview comes from old DB
-        mNewDatabase.Add(
-            previewImageFilename,
-            previewImageFileLastModified,
-            nullptr);
+        // See if this preview file may be served by old database
+        auto oldDbPreviewImage = mOldDatabase.TryGetPreviewImage(previewImageFilename, previewImageFileLastModified);
+        if (oldDbPreviewImage.has_value())
+        {
+            //
+            // Served by DB
+            //
+
+            // Tell new DB that this preview comes from old DB
+            mNewDatabase.Add(
+                previewImageFilename,
+                previewImageFileLastModified,
+                nullptr);
 
-        return std::move(*oldDbPreviewImage);
+            return std::move(*oldDbPreviewImage);
+        }
     }
-    else
-    {
-        //
-        // Not served by DB
-        //
 
-        // Needs to be loaded from scratch
-        LogMessage("ShipPreviewDirectoryManager::LoadPreviewImage(): can't serve '", previewImageFilename.string(), "' from persisted DB; loading...");
+    //
+    // Not served by DB
+    //
 
-        // Load preview image
-        RgbaImageData previewImage = ShipDeSerializer::LoadShipPreviewImage(previewData, maxImageSize);
+    // Needs to be loaded from scratch
+    LogMessage("ShipPreviewDirectoryManager::LoadPreviewImage(): can't serve '", previewImageFilename.string(), "' from persisted DB; loading...");
 
-        // Add to new DB
-        mNewDatabase.Add(
-            previewImageFilename,
-            previewImageFileLastModified,
-            std::make_unique<RgbaImageData>(previewImage.Clone()));
+    // Load preview image
+    RgbaImageData previewImage = ShipDeSerializer::LoadShipPreviewImage(previewData, maxImageSize);
 
-        return previewImage;
-    }
+    // Add to new DB
+    std::scoped_lock lock(mDatabaseMutex);
+    mNewDatabase.Add(
+        previewImageFilename,
+        previewImageFileLastModified,
+        std::make_unique<RgbaImageData>(previewImage.Clone()));
+
+    return previewImage;
 }
 
 void ShipPreviewDirectoryManager::Commit(bool isVisitCompleted)
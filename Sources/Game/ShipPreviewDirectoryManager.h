@@ -16,6 +16,7 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 class ShipPreviewDirectoryManager final
@@ -29,6 +30,9 @@ public:
         std::filesystem::path const & directoryPath,
         std::shared_ptr<IFileSystem> fileSystem);
 
+    /*
+     * May be invoked concurrently.
+     */
     RgbaImageData LoadPreviewImage(
         EnhancedShipPreviewData const & shipPreview,
         ImageSize const & maxImageSize);
@@ -55,4 +59,7 @@ private:
 
     PersistedShipPreviewImageDatabase mOldDatabase;
     NewShipPreviewImageDatabase mNewDatabase;
+
+    // Guards the databases; preview images are loaded outside of it
+    std::mutex mDatabaseMutex;
 };
\ No newline at end of file
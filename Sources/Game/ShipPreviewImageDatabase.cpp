@@ -7,6 +7,8 @@
 
 #include <Core/GameException.h>
 #include <Core/Log.h>
+#include <Core/MemoryStreams.h>
+#include <Core/PngTools.h>
 
 #include <limits>
 #include <utility>
@@ -85,13 +87,17 @@ size_t ShipPreviewImageDatabase::SerializePreviewImage(
     BinaryWriteStream & outputFile,
     RgbaImageData const & previewImage)
 {
-    auto const previewImageByteSize = previewImage.GetByteSize();
+    // Previews are stored PNG-compressed, which makes them a fraction of
+    // their raw size and thus keeps the database small enough to stay mapped
+
+    MemoryBinaryWriteStream encodedPreviewImage(previewImage.GetByteSize() / 4);
+    PngTools::EncodeImage(previewImage, encodedPreviewImage, PngTools::CompressionSpeedType::Fast);
 
     outputFile.Write(
-        reinterpret_cast<std::uint8_t const *>(previewImage.Data.get()),
-        previewImageByteSize);
+        encodedPreviewImage.GetData(),
+        encodedPreviewImage.GetSize());
 
-    return previewImageByteSize;
+    return encodedPreviewImage.GetSize();
 }
 
 RgbaImageData ShipPreviewImageDatabase::DeserializePreviewImage(
@@ -99,16 +105,36 @@ RgbaImageData ShipPreviewImageDatabase::DeserializePreviewImage(
     size_t size,
     ImageSize dimensions)
 {
-    // Alloc buffer
-    std::unique_ptr<rgbaColor[]> buffer = std::make_unique<rgbaColor[]>(size);
+    // Decode straight out of the stream's memory if the stream allows it,
+    // otherwise via an intermediate buffer
+    std::uint8_t const * const inPlaceData = inputFile.ReadInPlace(size);
+
+    RgbaImageData previewImage = [&]()
+    {
+        if (inPlaceData != nullptr)
+        {
+            MemoryViewBinaryReadStream encodedPreviewImage(inPlaceData, size);
+            return PngTools::DecodeImageRgba(encodedPreviewImage);
+        }
+        else
+        {
+            std::vector<std::uint8_t> buffer(size);
+            if (inputFile.Read(buffer.data(), size) != size)
+            {
+                throw GameException("Preview image is truncated");
+            }
 
-    // Read
-    inputFile.Read(reinterpret_cast<std::uint8_t *>(buffer.get()), size);
+            MemoryViewBinaryReadStream encodedPreviewImage(buffer.data(), size);
+            return PngTools::DecodeImageRgba(encodedPreviewImage);
+        }
+    }();
 
-    // Make image
-    return RgbaImageData(
-        dimensions,
-        std::move(buffer));
+    if (previewImage.Size != dimensions)
+    {
+        throw GameException("Preview image does not match its index entry");
+    }
+
+    return previewImage;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,6 +174,11 @@ PersistedShipPreviewImageDatabase PersistedShipPreviewImageDatabase::Load(
                 {
                     throw std::runtime_error("Database file was generated on a different platform");
                 }
+
+                if (header.ImageEncoding != DatabaseStructure::FileHeader::CurrentImageEncoding)
+                {
+                    throw std::runtime_error("Database file stores preview images in a different encoding");
+                }
             }
 
             // Read and populate index
@@ -272,10 +303,18 @@ std::optional<RgbaImageData> PersistedShipPreviewImageDatabase::TryGetPreviewIma
         mDatabaseFileStream->SetPosition(cachedFileIt->second.Position);
 
         // Read preview
-        return DeserializePreviewImage(
-            *mDatabaseFileStream,
-            cachedFileIt->second.Size,
-            cachedFileIt->second.Dimensions);
+        try
+        {
+            return DeserializePreviewImage(
+                *mDatabaseFileStream,
+                cachedFileIt->second.Size,
+                cachedFileIt->second.Dimensions);
+        }
+        catch (std::exception const & ex)
+        {
+            // Let the caller rebuild this preview from scratch
+            LogMessage("PersistedShipPreviewImageDatabase::TryGetPreviewImage(): error decoding preview '", previewImageFilename.string(), "': ", ex.what());
+        }
     }
 
     // No luck
@@ -563,12 +602,20 @@ void NewShipPreviewImageDatabase::WriteFromOldDatabase(
     size_t startOffset,
     size_t size) const
 {
+    oldDatabaseFile.SetPosition(startOffset);
+
+    // Copy the whole streak at once when the old database is mapped in memory
+    std::uint8_t const * const inPlaceData = oldDatabaseFile.ReadInPlace(size);
+    if (inPlaceData != nullptr)
+    {
+        newDatabaseFile.Write(inPlaceData, size);
+        return;
+    }
+
     size_t constexpr BlockSize = 4 * 1024 * 1024;
 
     std::vector<std::uint8_t> copyBuffer(BlockSize);
 
-    oldDatabaseFile.SetPosition(startOffset);
-
     for (size_t copied = 0; copied < size; copied += BlockSize)
     {
         auto const toCopy = (size - copied) >= BlockSize ? BlockSize : (size - copied);
@@ -33,13 +33,18 @@ protected:
         {
             static std::array<char, 32> constexpr StockTitle{ 'F', 'L', 'O', 'A', 'T', 'I', 'N', 'G', ' ', 'S', 'A', 'N', 'D', 'B', 'O', 'X', ' ', 'S', 'H', 'I', 'P', ' ', 'P', 'R', 'E', 'V', 'I', 'E', 'W', ' ', 'D', 'B' };
 
+            // Preview images are PNG-encoded; databases with raw images predate this field
+            static std::uint32_t constexpr CurrentImageEncoding = 0x31474E50; // 'PNG1'
+
             std::array<char, 32> Title;
             Version DBGameVersion;
             size_t SizeOfSizeT;
+            std::uint32_t ImageEncoding;
 
             FileHeader(Version gameVersion)
                 : DBGameVersion(gameVersion)
                 , SizeOfSizeT(sizeof(size_t))
+                , ImageEncoding(CurrentImageEncoding)
             {
                 std::memcpy(Title.data(), StockTitle.data(), Title.size());
             }
@@ -186,6 +191,7 @@ private:
     friend class ShipPreviewImageDatabaseTests_Commit_NewAdds1_AtEnd_Test;
     friend class ShipPreviewImageDatabaseTests_Commit_NewAdds2_AtEnd_Test;
     friend class ShipPreviewImageDatabaseTests_Commit_NewOverwrites1_Test;
+    friend class ShipPreviewImageDatabaseTests_Load_DiscardsDatabaseWithDifferentImageEncoding_Test;
 };
 
 class NewShipPreviewImageDatabase final : ShipPreviewImageDatabase
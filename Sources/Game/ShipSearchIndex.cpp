@@ -0,0 +1,416 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "ShipSearchIndex.h"
+
+#include "GameVersion.h"
+#include "ShipDeSerializer.h"
+
+#include <Core/DeSerializationBuffer.h>
+#include <Core/Endian.h>
+#include <Core/Log.h>
+#include <Core/Utils.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+
+static std::filesystem::path const IndexFileName = ".floatingsandbox_shipsearchindex";
+
+static std::string const IndexTitle = "FLOATING SANDBOX SHIP SEARCH INDEX";
+
+ShipSearchIndex::Entry::Entry(
+    std::filesystem::file_time_type lastModified,
+    ShipSpaceSize const & shipSize,
+    std::string const & shipName,
+    std::optional<std::string> const & author,
+    std::optional<std::string> const & artCredits,
+    std::optional<std::string> const & yearBuilt,
+    std::optional<std::string> const & description)
+    : LastModified(lastModified)
+    , ShipSize(shipSize)
+    , ShipName(shipName)
+    , Author(author)
+    , ArtCredits(artCredits)
+    , YearBuilt(yearBuilt)
+    , Description(description)
+    , mSearchStrings()
+{
+    mSearchStrings.push_back(Utils::ToLower(ShipName));
+
+    for (auto const & str : { Author, ArtCredits, YearBuilt, Description })
+    {
+        if (str.has_value())
+        {
+            mSearchStrings.push_back(Utils::ToLower(*str));
+        }
+    }
+}
+
+bool ShipSearchIndex::Entry::Matches(std::string const & lowercaseQuery) const
+{
+    return std::any_of(
+        mSearchStrings.cbegin(),
+        mSearchStrings.cend(),
+        [&lowercaseQuery](auto const & str)
+        {
+            return str.find(lowercaseQuery) != std::string::npos;
+        });
+}
+
+ShipSearchIndex ShipSearchIndex::Load(std::filesystem::path const & libraryDirectoryPath)
+{
+    return Load(
+        libraryDirectoryPath,
+        std::make_shared<FileSystemImpl>());
+}
+
+ShipSearchIndex ShipSearchIndex::Load(
+    std::filesystem::path const & libraryDirectoryPath,
+    std::shared_ptr<IFileSystem> fileSystem)
+{
+    std::filesystem::path const indexFilePath = libraryDirectoryPath / IndexFileName;
+
+    std::map<std::filesystem::path, Entry> entries;
+
+    if (fileSystem->Exists(indexFilePath))
+    {
+        try
+        {
+            auto inputStream = fileSystem->OpenBinaryInputStream(indexFilePath);
+            entries = Deserialize(*inputStream);
+
+            LogMessage("ShipSearchIndex: loaded ", entries.size(), " entries from \"", indexFilePath.string(), "\"");
+        }
+        catch (std::exception const & ex)
+        {
+            LogMessage("ShipSearchIndex: error loading \"", indexFilePath.string(), "\", ignoring: ", ex.what());
+
+            entries.clear();
+        }
+    }
+    else
+    {
+        LogMessage("ShipSearchIndex: no ship search index found at \"", indexFilePath.string(), "\"");
+    }
+
+    return ShipSearchIndex(
+        libraryDirectoryPath,
+        std::move(fileSystem),
+        std::move(entries));
+}
+
+bool ShipSearchIndex::Update(
+    ShipMetadataLoader const & shipMetadataLoader,
+    std::function<bool()> const & isInterrupted)
+{
+    std::set<std::filesystem::path> visitedShipFilePaths;
+
+    for (auto const & filePath : mFileSystem->ListFilesRecursively(mLibraryDirectoryPath))
+    {
+        if (isInterrupted())
+        {
+            return false;
+        }
+
+        if (!ShipDeSerializer::IsAnyShipDefinitionFile(filePath))
+        {
+            continue;
+        }
+
+        auto const relativeShipFilePath = filePath.lexically_relative(mLibraryDirectoryPath);
+
+        visitedShipFilePaths.insert(relativeShipFilePath);
+
+        try
+        {
+            auto const lastModified = mFileSystem->GetLastModifiedTime(filePath);
+
+            auto const entryIt = mEntries.find(relativeShipFilePath);
+            if (entryIt != mEntries.end() && entryIt->second.LastModified == lastModified)
+            {
+                // Up-to-date
+                continue;
+            }
+
+            //
+            // New or modified ship
+            //
+
+            auto const previewData = shipMetadataLoader(filePath);
+
+            Entry entry(
+                lastModified,
+                previewData.ShipSize,
+                previewData.Metadata.ShipName,
+                previewData.Metadata.Author,
+                previewData.Metadata.ArtCredits,
+                previewData.Metadata.YearBuilt,
+                previewData.Metadata.Description);
+
+            if (entryIt != mEntries.end())
+            {
+                entryIt->second = std::move(entry);
+            }
+            else
+            {
+                mEntries.emplace(relativeShipFilePath, std::move(entry));
+            }
+
+            mIsDirty = true;
+        }
+        catch (std::exception const & ex)
+        {
+            LogMessage("ShipSearchIndex: ignoring ship \"", filePath.string(), "\" due to error: ", ex.what());
+
+            // Ignore this ship
+        }
+    }
+
+    //
+    // Forget ships that are no more
+    //
+
+    for (auto it = mEntries.begin(); it != mEntries.end(); )
+    {
+        if (visitedShipFilePaths.count(it->first) == 0)
+        {
+            it = mEntries.erase(it);
+            mIsDirty = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return true;
+}
+
+void ShipSearchIndex::Save()
+{
+    if (!mIsDirty)
+    {
+        return;
+    }
+
+    std::filesystem::path const indexFilePath = mLibraryDirectoryPath / IndexFileName;
+
+    try
+    {
+        auto outputStream = mFileSystem->OpenBinaryOutputStream(indexFilePath);
+        Serialize(*outputStream);
+
+        mIsDirty = false;
+
+        LogMessage("ShipSearchIndex: saved ", mEntries.size(), " entries to \"", indexFilePath.string(), "\"");
+    }
+    catch (std::exception const & ex)
+    {
+        // The library might well be read-only; we'll rebuild the index next time
+        LogMessage("ShipSearchIndex: error saving \"", indexFilePath.string(), "\", ignoring: ", ex.what());
+    }
+}
+
+std::vector<std::filesystem::path> ShipSearchIndex::Search(std::string const & query) const
+{
+    std::string const lowercaseQuery = Utils::ToLower(query);
+
+    std::vector<std::filesystem::path> shipFilePaths;
+
+    for (auto const & [relativeShipFilePath, entry] : mEntries)
+    {
+        if (entry.Matches(lowercaseQuery))
+        {
+            shipFilePaths.push_back(mLibraryDirectoryPath / relativeShipFilePath);
+        }
+    }
+
+    return shipFilePaths;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+namespace /* anonymous */ {
+
+    using IndexBuffer = DeSerializationBuffer<BigEndianess>;
+
+    void AppendOptionalString(
+        std::optional<std::string> const & str,
+        IndexBuffer & buffer)
+    {
+        buffer.Append(static_cast<std::uint8_t>(str.has_value() ? 1 : 0));
+        if (str.has_value())
+        {
+            buffer.Append(*str);
+        }
+    }
+
+    void CheckReadableSize(
+        IndexBuffer const & buffer,
+        size_t index,
+        size_t size)
+    {
+        if (index + size > buffer.GetSize())
+        {
+            throw std::runtime_error("Search index file is truncated");
+        }
+    }
+
+    template<typename T>
+    size_t ReadValue(
+        IndexBuffer const & buffer,
+        size_t index,
+        T & value)
+    {
+        CheckReadableSize(buffer, index, sizeof(T));
+        return index + buffer.ReadAt(index, value);
+    }
+
+    size_t ReadString(
+        IndexBuffer const & buffer,
+        size_t index,
+        std::string & value)
+    {
+        std::uint32_t length;
+        ReadValue(buffer, index, length);
+        CheckReadableSize(buffer, index, sizeof(std::uint32_t) + length);
+        return index + buffer.ReadAt(index, value);
+    }
+
+    size_t ReadOptionalString(
+        IndexBuffer const & buffer,
+        size_t index,
+        std::optional<std::string> & value)
+    {
+        std::uint8_t hasValue;
+        index = ReadValue(buffer, index, hasValue);
+        if (hasValue != 0)
+        {
+            std::string str;
+            index = ReadString(buffer, index, str);
+            value = std::move(str);
+        }
+        else
+        {
+            value.reset();
+        }
+
+        return index;
+    }
+}
+
+std::map<std::filesystem::path, ShipSearchIndex::Entry> ShipSearchIndex::Deserialize(BinaryReadStream & inputStream)
+{
+    size_t const fileSize = inputStream.GetSize();
+
+    IndexBuffer buffer(fileSize);
+    if (inputStream.Read(buffer.Receive(fileSize), fileSize) != fileSize)
+    {
+        throw std::runtime_error("Search index file cannot be read");
+    }
+
+    size_t index = 0;
+
+    //
+    // Header
+    //
+
+    std::string title;
+    index = ReadString(buffer, index, title);
+    if (title != IndexTitle)
+    {
+        throw std::runtime_error("Search index file is not recognized");
+    }
+
+    std::string version;
+    index = ReadString(buffer, index, version);
+    if (version != CurrentGameVersion.ToString())
+    {
+        throw std::runtime_error("Search index file was generated on a different version of the simulator");
+    }
+
+    //
+    // Entries
+    //
+
+    std::map<std::filesystem::path, Entry> entries;
+
+    std::uint32_t entryCount;
+    index = ReadValue(buffer, index, entryCount);
+    for (std::uint32_t e = 0; e < entryCount; ++e)
+    {
+        std::string relativeShipFilePath;
+        index = ReadString(buffer, index, relativeShipFilePath);
+
+        std::uint64_t lastModifiedTicks;
+        index = ReadValue(buffer, index, lastModifiedTicks);
+
+        std::int32_t shipWidth;
+        index = ReadValue(buffer, index, shipWidth);
+        std::int32_t shipHeight;
+        index = ReadValue(buffer, index, shipHeight);
+
+        std::string shipName;
+        index = ReadString(buffer, index, shipName);
+
+        std::optional<std::string> author;
+        index = ReadOptionalString(buffer, index, author);
+        std::optional<std::string> artCredits;
+        index = ReadOptionalString(buffer, index, artCredits);
+        std::optional<std::string> yearBuilt;
+        index = ReadOptionalString(buffer, index, yearBuilt);
+        std::optional<std::string> description;
+        index = ReadOptionalString(buffer, index, description);
+
+        entries.emplace(
+            std::filesystem::path(relativeShipFilePath),
+            Entry(
+                std::filesystem::file_time_type(std::filesystem::file_time_type::duration(static_cast<std::filesystem::file_time_type::rep>(lastModifiedTicks))),
+                ShipSpaceSize(shipWidth, shipHeight),
+                shipName,
+                author,
+                artCredits,
+                yearBuilt,
+                description));
+    }
+
+    return entries;
+}
+
+void ShipSearchIndex::Serialize(BinaryWriteStream & outputStream) const
+{
+    IndexBuffer buffer(EstimatedEntrySize * (mEntries.size() + 1));
+
+    //
+    // Header
+    //
+
+    buffer.Append(IndexTitle);
+    buffer.Append(CurrentGameVersion.ToString());
+
+    //
+    // Entries
+    //
+
+    buffer.Append(static_cast<std::uint32_t>(mEntries.size()));
+    for (auto const & [relativeShipFilePath, entry] : mEntries)
+    {
+        buffer.Append(relativeShipFilePath.string());
+        buffer.Append(static_cast<std::uint64_t>(entry.LastModified.time_since_epoch().count()));
+        buffer.Append(static_cast<std::int32_t>(entry.ShipSize.width));
+        buffer.Append(static_cast<std::int32_t>(entry.ShipSize.height));
+        buffer.Append(entry.ShipName);
+        AppendOptionalString(entry.Author, buffer);
+        AppendOptionalString(entry.ArtCredits, buffer);
+        AppendOptionalString(entry.YearBuilt, buffer);
+        AppendOptionalString(entry.Description, buffer);
+    }
+
+    outputStream.Write(
+        reinterpret_cast<std::uint8_t const *>(buffer.GetData()),
+        buffer.GetSize());
+}
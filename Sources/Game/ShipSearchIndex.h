@@ -0,0 +1,135 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include "EnhancedShipPreviewData.h"
+#include "FileSystem.h"
+
+#include <Core/GameTypes.h>
+
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * A persistent index of the metadata of all the ships in a ship library - a directory and
+ * all of its sub-directories - for searching the whole library at once.
+ *
+ * The index lives in a file in the library's root directory, next to that directory's ship
+ * preview database. It is brought up-to-date incrementally: only the metadata of ships that are
+ * new, or that have been modified since they were indexed, is (re-)loaded.
+ *
+ * Not thread-safe; meant to be updated on a background thread, and then handed over to
+ * the UI thread for searching.
+ */
+class ShipSearchIndex final
+{
+public:
+
+    struct Entry
+    {
+        std::filesystem::file_time_type LastModified;
+        ShipSpaceSize ShipSize;
+        std::string ShipName;
+        std::optional<std::string> Author;
+        std::optional<std::string> ArtCredits;
+        std::optional<std::string> YearBuilt;
+        std::optional<std::string> Description;
+
+        Entry(
+            std::filesystem::file_time_type lastModified,
+            ShipSpaceSize const & shipSize,
+            std::string const & shipName,
+            std::optional<std::string> const & author,
+            std::optional<std::string> const & artCredits,
+            std::optional<std::string> const & yearBuilt,
+            std::optional<std::string> const & description);
+
+        bool Matches(std::string const & lowercaseQuery) const;
+
+    private:
+
+        // Lowercase name, author, art credits, year built, and description
+        std::vector<std::string> mSearchStrings;
+    };
+
+    using ShipMetadataLoader = std::function<EnhancedShipPreviewData(std::filesystem::path const & shipFilePath)>;
+
+    static ShipSearchIndex Load(std::filesystem::path const & libraryDirectoryPath);
+
+    /*
+     * Never throws: an index file that cannot be read makes for an empty index.
+     */
+    static ShipSearchIndex Load(
+        std::filesystem::path const & libraryDirectoryPath,
+        std::shared_ptr<IFileSystem> fileSystem);
+
+    ShipSearchIndex(ShipSearchIndex && other) = default;
+    ShipSearchIndex & operator=(ShipSearchIndex && other) = default;
+
+    /*
+     * Brings the index up-to-date with the ship files currently in the library, loading
+     * metadata with the specified loader.
+     *
+     * Returns false if interrupted, in which case the index retains all that it has indexed so far.
+     */
+    bool Update(
+        ShipMetadataLoader const & shipMetadataLoader,
+        std::function<bool()> const & isInterrupted);
+
+    /*
+     * Saves the index if it has changed since it was loaded or last saved.
+     */
+    void Save();
+
+    /*
+     * Returns the full paths of all ships whose metadata contains the specified string -
+     * case-insensitively - in library path order.
+     */
+    std::vector<std::filesystem::path> Search(std::string const & query) const;
+
+    size_t GetSize() const
+    {
+        return mEntries.size();
+    }
+
+    std::filesystem::path const & GetLibraryDirectoryPath() const
+    {
+        return mLibraryDirectoryPath;
+    }
+
+private:
+
+    static size_t constexpr EstimatedEntrySize = 256;
+
+    ShipSearchIndex(
+        std::filesystem::path const & libraryDirectoryPath,
+        std::shared_ptr<IFileSystem> fileSystem,
+        std::map<std::filesystem::path, Entry> && entries)
+        : mLibraryDirectoryPath(libraryDirectoryPath)
+        , mFileSystem(std::move(fileSystem))
+        , mEntries(std::move(entries))
+        , mIsDirty(false)
+    {}
+
+    static std::map<std::filesystem::path, Entry> Deserialize(BinaryReadStream & inputStream);
+
+    void Serialize(BinaryWriteStream & outputStream) const;
+
+private:
+
+    std::filesystem::path mLibraryDirectoryPath;
+    std::shared_ptr<IFileSystem> mFileSystem;
+
+    // Keyed by ship path relative to the library directory
+    std::map<std::filesystem::path, Entry> mEntries;
+
+    bool mIsDirty;
+};
@@ -0,0 +1,223 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "TelemetrySink.h"
+
+#include "FileStreams.h"
+
+#include <Core/Log.h>
+#include <Core/ThreadManager.h>
+#include <Core/Utils.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    using Fields = std::vector<std::pair<std::string, std::string>>;
+
+    template<typename T>
+    void AddField(
+        Fields & fields,
+        std::string name,
+        T value)
+    {
+        std::ostringstream ss;
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            ss << std::fixed << std::setprecision(3);
+        }
+
+        ss << value;
+
+        fields.emplace_back(std::move(name), ss.str());
+    }
+
+    /*
+     * The fields of a sample, in column order.
+     */
+    Fields MakeFields(TelemetrySink::Sample const & sample)
+    {
+        Fields fields;
+
+        AddField(fields, "wall_clock_s", sample.WallClockSeconds);
+        AddField(fields, "simulation_s", sample.SimulationSeconds);
+
+        AddField(fields, "frame_count", sample.FrameCount);
+        AddField(fields, "frame_avg_ms", sample.AverageFrameMilliseconds);
+        AddField(fields, "frame_max_ms", sample.MaxFrameMilliseconds);
+
+        for (size_t m = 0; m < TelemetrySink::PerfMeasurementCount; ++m)
+        {
+            AddField(fields, std::string("perf_") + GetPerfMeasurementInfo(static_cast<PerfMeasurement>(m)).Name + "_ms", sample.PerfMilliseconds[m]);
+        }
+
+        AddField(fields, "rendered_ship_points", sample.RenderStats.LastRenderedShipPoints);
+        AddField(fields, "rendered_ship_ropes", sample.RenderStats.LastRenderedShipRopes);
+        AddField(fields, "rendered_ship_springs", sample.RenderStats.LastRenderedShipSprings);
+        AddField(fields, "rendered_ship_triangles", sample.RenderStats.LastRenderedShipTriangles);
+        AddField(fields, "rendered_ship_planes", sample.RenderStats.LastRenderedShipPlanes);
+        AddField(fields, "rendered_ship_flames", sample.RenderStats.LastRenderedShipFlames);
+        AddField(fields, "rendered_ship_textures", sample.RenderStats.LastRenderedShipGenericMipMappedTextures);
+        AddField(fields, "ship_draw_calls", sample.RenderStats.LastShipDrawCalls);
+
+        static char const * const UploadKindNames[RenderStatistics::UploadKindCount] = { "ship_points", "ship_elements", "ship_npcs", "ship_effects" };
+        for (size_t k = 0; k < RenderStatistics::UploadKindCount; ++k)
+        {
+            AddField(fields, std::string("uploaded_") + UploadKindNames[k] + "_bytes", sample.RenderStats.LastUploadedBytes[k]);
+        }
+
+        static char const * const RenderPassNames[RenderStatistics::RenderPassCount] = { "background", "ships", "foreground", "notifications" };
+        for (size_t p = 0; p < RenderStatistics::RenderPassCount; ++p)
+        {
+            AddField(fields, std::string("gpu_") + RenderPassNames[p] + "_ms", sample.RenderStats.LastGpuPassMilliseconds[p]);
+        }
+
+        AddField(fields, "npc_count", sample.NpcCount);
+        AddField(fields, "human_npc_inside_ship_count", sample.HumanNpcInsideShipCount);
+        AddField(fields, "human_npc_outside_ship_count", sample.HumanNpcOutsideShipCount);
+        AddField(fields, "fish_count", sample.FishCount);
+
+        return fields;
+    }
+}
+
+std::unique_ptr<TelemetrySink> TelemetrySink::Create(std::filesystem::path const & filePath)
+{
+    FormatType const format = Utils::ToLower(filePath.extension().string()) == ".csv"
+        ? FormatType::Csv
+        : FormatType::Ndjson;
+
+    LogMessage("TelemetrySink: streaming telemetry to \"", filePath.string(), "\"");
+
+    return std::make_unique<TelemetrySink>(
+        std::make_unique<FileTextWriteStream>(filePath),
+        format);
+}
+
+TelemetrySink::TelemetrySink(
+    std::unique_ptr<TextWriteStream> outputStream,
+    FormatType format)
+    : mOutputStream(std::move(outputStream))
+    , mFormat(format)
+    , mSamples()
+    , mDroppedSampleCount(0)
+    , mWriterThread()
+    , mIsStop(false)
+{
+    if (mFormat == FormatType::Csv)
+    {
+        mOutputStream->Write(FormatHeader());
+    }
+
+    mWriterThread = std::thread(&TelemetrySink::ThreadLoop, this);
+}
+
+TelemetrySink::~TelemetrySink()
+{
+    mIsStop.store(true);
+    mWriterThread.join();
+
+    if (mDroppedSampleCount > 0)
+    {
+        LogMessage("TelemetrySink: dropped ", mDroppedSampleCount, " samples");
+    }
+}
+
+bool TelemetrySink::Publish(Sample const & sample)
+{
+    if (!mSamples.TryPush(sample))
+    {
+        ++mDroppedSampleCount;
+        return false;
+    }
+
+    return true;
+}
+
+void TelemetrySink::ThreadLoop()
+{
+    ThreadManager::InitializeThisBackgroundThread();
+
+    while (!mIsStop.load())
+    {
+        std::this_thread::sleep_for(WriterPollInterval);
+
+        WriteAvailableSamples();
+    }
+
+    // Samples published before we were stopped
+    WriteAvailableSamples();
+}
+
+void TelemetrySink::WriteAvailableSamples()
+{
+    bool hasWritten = false;
+
+    Sample sample;
+    while (mSamples.TryPop(sample))
+    {
+        mOutputStream->Write(FormatSample(sample));
+        hasWritten = true;
+    }
+
+    if (hasWritten)
+    {
+        // So that whoever is tailing us sees samples as they come
+        mOutputStream->Flush();
+    }
+}
+
+std::string TelemetrySink::FormatHeader() const
+{
+    std::string header;
+    for (auto const & [name, value] : MakeFields(Sample{}))
+    {
+        if (!header.empty())
+        {
+            header += ',';
+        }
+
+        header += name;
+    }
+
+    return header + '\n';
+}
+
+std::string TelemetrySink::FormatSample(Sample const & sample) const
+{
+    std::string line;
+
+    if (mFormat == FormatType::Csv)
+    {
+        for (auto const & [name, value] : MakeFields(sample))
+        {
+            if (!line.empty())
+            {
+                line += ',';
+            }
+
+            line += value;
+        }
+    }
+    else
+    {
+        assert(mFormat == FormatType::Ndjson);
+
+        for (auto const & [name, value] : MakeFields(sample))
+        {
+            line += line.empty() ? "{" : ",";
+            line += "\"" + name + "\":" + value;
+        }
+
+        line += '}';
+    }
+
+    return line + '\n';
+}
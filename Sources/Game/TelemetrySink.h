@@ -0,0 +1,114 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include <Render/RenderStatistics.h>
+
+#include <Core/PerfStats.h>
+#include <Core/SpscRingBuffer.h>
+#include <Core/Streams.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+/*
+ * Streams samples of the game's performance and statistics to a text stream - e.g. a file,
+ * or a named pipe read by an external dashboard - as CSV or as newline-delimited JSON.
+ *
+ * Samples are published by the main thread into a lock-free ring, and formatted and written
+ * by a background thread, so that publishing never waits for I/O; when the writer cannot
+ * keep up, samples are dropped rather than stalling the game.
+ */
+class TelemetrySink final
+{
+public:
+
+    enum class FormatType
+    {
+        Csv,
+        Ndjson
+    };
+
+    static size_t constexpr PerfMeasurementCount = static_cast<size_t>(PerfMeasurement::_Last) + 1;
+
+    struct Sample
+    {
+        double WallClockSeconds; // Since the sink was started
+        float SimulationSeconds;
+
+        // Frames since the previous sample
+        std::uint32_t FrameCount;
+        float AverageFrameMilliseconds;
+        float MaxFrameMilliseconds;
+
+        // Average of each measurement since the previous sample
+        std::array<float, PerfMeasurementCount> PerfMilliseconds;
+
+        RenderStatistics RenderStats;
+
+        std::uint32_t NpcCount;
+        std::uint32_t HumanNpcInsideShipCount;
+        std::uint32_t HumanNpcOutsideShipCount;
+        std::uint32_t FishCount;
+    };
+
+    /*
+     * The format is chosen by the extension of the file: CSV for ".csv", NDJSON otherwise.
+     */
+    static std::unique_ptr<TelemetrySink> Create(std::filesystem::path const & filePath);
+
+    TelemetrySink(
+        std::unique_ptr<TextWriteStream> outputStream,
+        FormatType format);
+
+    /*
+     * Writes all samples published so far before returning.
+     */
+    ~TelemetrySink();
+
+    TelemetrySink(TelemetrySink const &) = delete;
+    TelemetrySink & operator=(TelemetrySink const &) = delete;
+
+    /*
+     * Invoked by the main thread; returns false when the sample had to be dropped.
+     */
+    bool Publish(Sample const & sample);
+
+    size_t GetDroppedSampleCount() const
+    {
+        return mDroppedSampleCount;
+    }
+
+private:
+
+    void ThreadLoop();
+
+    void WriteAvailableSamples();
+
+    std::string FormatHeader() const;
+
+    std::string FormatSample(Sample const & sample) const;
+
+private:
+
+    // How often the writer wakes up; samples are meant to be published at a few per second
+    static std::chrono::milliseconds constexpr WriterPollInterval = std::chrono::milliseconds(100);
+
+    std::unique_ptr<TextWriteStream> const mOutputStream;
+    FormatType const mFormat;
+
+    SpscRingBuffer<Sample, 256> mSamples;
+    size_t mDroppedSampleCount; // Only touched by the main thread
+
+    std::thread mWriterThread;
+    std::atomic<bool> mIsStop;
+};
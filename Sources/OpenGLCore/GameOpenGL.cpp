@@ -21,6 +21,11 @@ int GameOpenGL::MaxSupportedOpenGLVersionMajor = 0;
 int GameOpenGL::MaxSupportedOpenGLVersionMinor = 0;
 
 bool GameOpenGL::AvoidGlFinish = false;
+bool GameOpenGL::SupportsPersistentMapping = false;
+bool GameOpenGL::SupportsAsyncReadback = false;
+bool GameOpenGL::SupportsProgramBinaries = false;
+bool GameOpenGL::SupportsTimerQueries = false;
+std::string GameOpenGL::DriverIdentifier;
 
 #ifdef _DEBUG
 
@@ -62,6 +67,12 @@ void GameOpenGL::InitOpenGL()
     std::string const renderer = (szRenderer != nullptr) ? szRenderer : "N/A";
     LogMessage("GL_RENDERER=", renderer);
 
+    char const * const szVersion = (const char *)glGetString(GL_VERSION);
+    std::string const version = (szVersion != nullptr) ? szVersion : "N/A";
+    LogMessage("GL_VERSION=", version);
+
+    DriverIdentifier = vendor + "|" + renderer + "|" + version;
+
 
     //
     // Check OpenGL version
@@ -144,6 +155,47 @@ void GameOpenGL::InitOpenGL()
 
     LogMessage("AvoidGlFinish=", AvoidGlFinish);
 
+    // Use persistent mapping only if the whole functionality has been loaded
+
+    SupportsPersistentMapping =
+        glBufferStorage != nullptr
+        && glMapBufferRange != nullptr
+        && glFenceSync != nullptr
+        && glDeleteSync != nullptr
+        && glClientWaitSync != nullptr;
+
+    LogMessage("SupportsPersistentMapping=", SupportsPersistentMapping);
+
+    // Use asynchronous readbacks only if we have fences; pixel buffer objects are
+    // core in 2.1, which any driver with fences exceeds
+
+    SupportsAsyncReadback =
+        (MaxSupportedOpenGLVersionMajor > 2 || (MaxSupportedOpenGLVersionMajor == 2 && MaxSupportedOpenGLVersionMinor >= 1))
+        && glFenceSync != nullptr
+        && glDeleteSync != nullptr
+        && glClientWaitSync != nullptr;
+
+    LogMessage("SupportsAsyncReadback=", SupportsAsyncReadback);
+
+    // Use program binaries only if the driver offers at least one format
+
+    SupportsProgramBinaries = false;
+    if (glGetProgramBinary != nullptr
+        && glProgramBinary != nullptr
+        && glProgramParameteri != nullptr)
+    {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &tmpConstant);
+        SupportsProgramBinaries = (glGetError() == GL_NO_ERROR && tmpConstant > 0);
+    }
+
+    LogMessage("SupportsProgramBinaries=", SupportsProgramBinaries);
+
+    // Use timer queries only if we may get their 64-bit results
+
+    SupportsTimerQueries = (glGetQueryObjectui64v != nullptr);
+
+    LogMessage("SupportsTimerQueries=", SupportsTimerQueries);
+
 
     //
     // Initialize debugging
@@ -178,12 +178,38 @@ struct GameOpenGLRenderbufferDeleter
     }
 };
 
+struct GameOpenGLQueryDeleter
+{
+    static void Delete(GLuint p)
+    {
+        static_assert(GLuint() == 0, "Default value is not zero, i.e. the OpenGL NULL");
+
+        if (p != 0)
+        {
+            glDeleteQueries(1, &p);
+        }
+    }
+};
+
+struct GameOpenGLSyncDeleter
+{
+    static void Delete(GLsync p)
+    {
+        if (p != nullptr)
+        {
+            glDeleteSync(p);
+        }
+    }
+};
+
 using GameOpenGLShaderProgram = GameOpenGLObject<GLuint, GameOpenGLProgramDeleter>;
 using GameOpenGLVBO = GameOpenGLObject<GLuint, GameOpenGLVBODeleter>;
 using GameOpenGLVAO = GameOpenGLObject<GLuint, GameOpenGLVAODeleter>;
 using GameOpenGLTexture = GameOpenGLObject<GLuint, GameOpenGLTextureDeleter>;
 using GameOpenGLFramebuffer = GameOpenGLObject<GLuint, GameOpenGLFramebufferDeleter>;
 using GameOpenGLRenderbuffer = GameOpenGLObject<GLuint, GameOpenGLRenderbufferDeleter>;
+using GameOpenGLQuery = GameOpenGLObject<GLuint, GameOpenGLQueryDeleter>;
+using GameOpenGLSync = GameOpenGLObject<GLsync, GameOpenGLSyncDeleter>;
 
 /////////////////////////////////////////////////////////////////////////////////////////
 // GameOpenGL
@@ -209,6 +235,24 @@ public:
 
     static bool AvoidGlFinish;
 
+    // Whether we may use persistently-mapped buffers (ARB_buffer_storage),
+    // together with fences to synchronize with them
+    static bool SupportsPersistentMapping;
+
+    // Whether we may read back pixels into buffer objects (ARB_pixel_buffer_object),
+    // together with fences to know when they're ready to be mapped
+    static bool SupportsAsyncReadback;
+
+    // Whether we may save and restore linked programs (ARB_get_program_binary)
+    static bool SupportsProgramBinaries;
+
+    // Whether we may measure GPU time with queries (ARB_timer_query)
+    static bool SupportsTimerQueries;
+
+    // Identifies the driver, so that program binaries are not restored by
+    // a driver other than the one that produced them
+    static std::string DriverIdentifier;
+
 public:
 
     static void InitOpenGL();
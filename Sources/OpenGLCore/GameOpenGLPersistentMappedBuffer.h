@@ -0,0 +1,127 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameOpenGL.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+/*
+ * This class is a buffer storage that is mapped persistently and coherently,
+ * partitioned into a ring of regions, each guarded by a fence.
+ *
+ * Regions are meant to be written in turn - one per frame - while the GPU may
+ * still be reading from the other ones; before a region is written again, the
+ * GPU must be done with the commands that were using it, which is ensured by
+ * waiting for its fence.
+ *
+ * Only to be used when GameOpenGL::SupportsPersistentMapping. Allocation, fencing
+ * and waiting require the OpenGL context, while the mapped memory itself may be
+ * written from any thread.
+ */
+template<typename TElement, size_t RegionCount, GLenum TTarget>
+class GameOpenGLPersistentMappedBuffer
+{
+public:
+
+    GameOpenGLPersistentMappedBuffer()
+        : mMappedBuffer(nullptr)
+        , mRegionSize(0u)
+        , mRegionFences()
+    {
+    }
+
+    /*
+     * Allocates the storage for the buffer currently bound to the target, and
+     * maps it; the mapping lives until the buffer is deleted.
+     */
+    void allocate_and_map(size_t regionSize)
+    {
+        assert(GameOpenGL::SupportsPersistentMapping);
+        assert(nullptr == mMappedBuffer);
+
+        GLbitfield constexpr Flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        GLsizeiptr const byteSize = static_cast<GLsizeiptr>(RegionCount * regionSize * sizeof(TElement));
+
+        glBufferStorage(TTarget, byteSize, nullptr, Flags);
+        CheckOpenGLError();
+
+        mMappedBuffer = reinterpret_cast<TElement *>(glMapBufferRange(TTarget, 0, byteSize, Flags));
+        CheckOpenGLError();
+
+        if (nullptr == mMappedBuffer)
+        {
+            throw GameException("glMapBufferRange returned null pointer");
+        }
+
+        mRegionSize = regionSize;
+    }
+
+    TElement * region_data(size_t region) noexcept
+    {
+        assert(nullptr != mMappedBuffer);
+        assert(region < RegionCount);
+        return mMappedBuffer + region * mRegionSize;
+    }
+
+    size_t region_byte_offset(size_t region) const noexcept
+    {
+        assert(region < RegionCount);
+        return region * mRegionSize * sizeof(TElement);
+    }
+
+    /*
+     * To be invoked after the last command that uses the specified region.
+     */
+    void fence_region(size_t region)
+    {
+        assert(region < RegionCount);
+
+        mRegionFences[region] = GameOpenGLSync(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        CheckOpenGLError();
+    }
+
+    /*
+     * Blocks until the GPU is done with the commands that were using the specified region.
+     */
+    void wait_region(size_t region)
+    {
+        assert(region < RegionCount);
+
+        if (!!mRegionFences[region])
+        {
+            // Flush at first, so that the fence is guaranteed to be eventually signaled
+            GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (true)
+            {
+                GLenum const waitResult = glClientWaitSync(*mRegionFences[region], waitFlags, 1000000000ull /* ns */);
+                if (waitResult != GL_TIMEOUT_EXPIRED)
+                {
+                    if (waitResult == GL_WAIT_FAILED)
+                    {
+                        throw GameException("glClientWaitSync failed");
+                    }
+
+                    break;
+                }
+
+                waitFlags = 0;
+            }
+
+            mRegionFences[region].reset();
+        }
+    }
+
+private:
+
+    TElement * mMappedBuffer;
+    size_t mRegionSize;
+
+    std::array<GameOpenGLSync, RegionCount> mRegionFences;
+};
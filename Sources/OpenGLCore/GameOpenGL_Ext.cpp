@@ -201,11 +201,89 @@ void InitOpenGLExt_TextureRG(GLADloadproc /*load*/)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Buffer Storage (https://registry.khronos.org/OpenGL/extensions/ARB/ARB_buffer_storage.txt)
+//////////////////////////////////////////////////////////////////////////
+
+PFNGLMAPBUFFERRANGEPROC glMapBufferRange = NULL;
+PFNGLBUFFERSTORAGEPROC glBufferStorage = NULL;
+PFNGLFENCESYNCPROC glFenceSync = NULL;
+PFNGLDELETESYNCPROC glDeleteSync = NULL;
+PFNGLCLIENTWAITSYNCPROC glClientWaitSync = NULL;
+
+void InitOpenGLExt_BufferStorage(GLADloadproc load)
+{
+    // Optional: we only use it if it's available together with its prerequisites,
+    // leaving all functions null otherwise; sync is also used on its own, e.g. for
+    // asynchronous readbacks, hence we load it whenever it's available
+
+    bool const hasMapBufferRange =
+        GLVersion.major >= 3 // Core in 3.0
+        || HasExt("GL_ARB_map_buffer_range");
+
+    bool const hasSync =
+        GLVersion.major > 3 // Core in 3.2
+        || (GLVersion.major == 3 && GLVersion.minor >= 2)
+        || HasExt("GL_ARB_sync");
+
+    bool const hasBufferStorage =
+        GLVersion.major > 4 // Core in 4.4
+        || (GLVersion.major == 4 && GLVersion.minor >= 4)
+        || HasExt("GL_ARB_buffer_storage");
+
+    if (hasSync)
+    {
+        // Core or ARB - maintains name
+
+        LoadAndVerify("glFenceSync", glFenceSync, load);
+        LoadAndVerify("glDeleteSync", glDeleteSync, load);
+        LoadAndVerify("glClientWaitSync", glClientWaitSync, load);
+    }
+
+    if (hasMapBufferRange && hasSync && hasBufferStorage)
+    {
+        // Core or ARB - maintains name
+
+        LoadAndVerify("glMapBufferRange", glMapBufferRange, load);
+        LoadAndVerify("glBufferStorage", glBufferStorage, load);
+    }
+    else
+    {
+        // Ignore
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Timer Query (https://registry.khronos.org/OpenGL/extensions/ARB/ARB_timer_query.txt)
+//////////////////////////////////////////////////////////////////////////
+
+PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v = NULL;
+
+void InitOpenGLExt_TimerQuery(GLADloadproc load)
+{
+    // Optional: we only use it if it's available
+
+    if (GLVersion.major > 3 // Core in 3.3
+        || (GLVersion.major == 3 && GLVersion.minor >= 3)
+        || HasExt("GL_ARB_timer_query"))
+    {
+        // Core or ARB - maintains name
+
+        LoadAndVerify("glGetQueryObjectui64v", glGetQueryObjectui64v, load);
+    }
+    else
+    {
+        // Ignore
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Misc
 //////////////////////////////////////////////////////////////////////////
 
 PFNGLGETPROGRAMBINARYPROC glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glProgramParameteri = NULL;
 PFNGLDEBUGMESSAGECALLBACKARB glDebugMessageCallback = NULL;
 
 void InitOpenGLExt_Misc(GLADloadproc load)
@@ -216,10 +294,14 @@ void InitOpenGLExt_Misc(GLADloadproc load)
         // Core
 
         LoadAndVerify("glGetProgramBinary", glGetProgramBinary, load);
+        LoadAndVerify("glProgramBinary", glProgramBinary, load);
+        LoadAndVerify("glProgramParameteri", glProgramParameteri, load);
     }
     else if (HasExt("GL_ARB_get_program_binary"))
     {
         LoadAndVerify("glGetProgramBinary", glGetProgramBinary, load);
+        LoadAndVerify("glProgramBinary", glProgramBinary, load);
+        LoadAndVerify("glProgramParameteri", glProgramParameteri, load);
     }
     else
     {
@@ -254,6 +336,10 @@ void InitOpenGLExt()
 
                 InitOpenGLExt_TextureRG(&get_proc);
 
+                InitOpenGLExt_BufferStorage(&get_proc);
+
+                InitOpenGLExt_TimerQuery(&get_proc);
+
                 InitOpenGLExt_Misc(&get_proc);
 
                 free_exts();
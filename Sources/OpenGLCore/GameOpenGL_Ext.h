@@ -225,6 +225,70 @@ GLAPI PFNGLISVERTEXARRAYPROC glIsVertexArray;
 #define GL_RG32I                   0x823B
 #define GL_RG32UI                  0x823C
 
+//////////////////////////////////////////////////////////////////////////
+// Buffer Storage (with map buffer range and sync)
+//////////////////////////////////////////////////////////////////////////
+
+//
+// Functions
+//
+
+typedef void * (APIENTRYP PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+GLAPI PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glBufferStorage;
+
+typedef GLsync(APIENTRYP PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
+GLAPI PFNGLFENCESYNCPROC glFenceSync;
+
+typedef void (APIENTRYP PFNGLDELETESYNCPROC)(GLsync sync);
+GLAPI PFNGLDELETESYNCPROC glDeleteSync;
+
+typedef GLenum(APIENTRYP PFNGLCLIENTWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+GLAPI PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+
+//
+// Enumerants
+//
+
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_WAIT_FAILED 0x911D
+
+//////////////////////////////////////////////////////////////////////////
+// Pixel Buffer Object
+//////////////////////////////////////////////////////////////////////////
+
+//
+// Enumerants
+//
+
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+
+//////////////////////////////////////////////////////////////////////////
+// Timer Query
+//////////////////////////////////////////////////////////////////////////
+
+//
+// Functions
+//
+
+typedef void (APIENTRYP PFNGLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname, GLuint64 * params);
+GLAPI PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+
+//
+// Enumerants
+//
+
+#define GL_TIME_ELAPSED 0x88BF
+
 //////////////////////////////////////////////////////////////////////////
 // Misc
 //////////////////////////////////////////////////////////////////////////
@@ -236,6 +300,12 @@ GLAPI PFNGLISVERTEXARRAYPROC glIsVertexArray;
 typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary);
 GLAPI PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
 
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length);
+GLAPI PFNGLPROGRAMBINARYPROC glProgramBinary;
+
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+GLAPI PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+
 typedef void (APIENTRY * DEBUGPROCARB)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * message, const void * userParam);
 typedef void (APIENTRYP PFNGLDEBUGMESSAGECALLBACKARB)(DEBUGPROCARB callback, const void * userParam);
 GLAPI PFNGLDEBUGMESSAGECALLBACKARB glDebugMessageCallback;
@@ -244,6 +314,9 @@ GLAPI PFNGLDEBUGMESSAGECALLBACKARB glDebugMessageCallback;
 // Enumerants
 //
 
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
 #define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
 #define GL_DEBUG_SEVERITY_HIGH_ARB 0x9146
 #define GL_DEBUG_SEVERITY_MEDIUM_ARB 0x9147
@@ -9,6 +9,7 @@
 
 #include <Core/BoundedVector.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
@@ -22,6 +23,10 @@
  * do not talk to each other.
  *
  * Vertex attributed uploaded by each provider are sticky.
+ *
+ * The VBO is allocated with slack, so that providers growing by a few vertices only
+ * cause the upload of the portion of the buffer that has changed, rather than the
+ * re-allocation and upload of the whole buffer.
  */
 template<typename TVertexAttributes, size_t NProviders>
 class MultiProviderVertexBuffer
@@ -45,6 +50,7 @@ public:
         size_t Offset;
         TVertexAttributes const * Pointer;
         size_t Size;
+        size_t AllocatedSize; // Only for AllocateAndUploadVBO
     };
 
     std::vector<TestAction> TestActions;
@@ -65,7 +71,7 @@ public:
         }
 
         mTotalVertexCount = 0;
-        mLastAllocatedVBOVertexCount = 0;
+        mAllocatedVBOVertexCount = 0;
 
 #ifndef MULTI_PROVIDER_VERTEX_BUFFER_TEST
 
@@ -290,15 +296,21 @@ public:
         mIsGlobalDirty = false; // A bit too early, but will be true when we're done
 
         //
-        // First off, if we've grown we need to reallocate and thus need to rebuild buffer
+        // First off, if we've outgrown the VBO we need to reallocate and thus need to rebuild buffer
         //
 
-        if (mTotalVertexCount > mLastAllocatedVBOVertexCount)
+        if (mTotalVertexCount > mAllocatedVBOVertexCount)
         {
             // Just rebuild buffer, realloc VBO, and upload all
 
+            // Grow geometrically after the first allocation, so that the next few
+            // growths fit in the slack
+            size_t const newAllocatedVertexCount = (mAllocatedVBOVertexCount == 0)
+                ? mTotalVertexCount
+                : std::max(mTotalVertexCount, mAllocatedVBOVertexCount * 2);
+
             // Rebuild buffer
-            mWorkBuffer.reset(mTotalVertexCount);
+            mWorkBuffer.reset(newAllocatedVertexCount);
             for (size_t iProvider = 0; iProvider < NProviders; ++iProvider)
             {
                 auto & providerData = mProviderData[iProvider];
@@ -317,30 +329,32 @@ public:
 
             assert(mWorkBuffer.size() == mTotalVertexCount);
 
-            // Reallocate VBO and upload all
+            // Reallocate VBO - orphaning the old storage - and upload all
 #ifndef MULTI_PROVIDER_VERTEX_BUFFER_TEST
             Bind();
-            glBufferData(GL_ARRAY_BUFFER, mTotalVertexCount * sizeof(TVertexAttributes), mWorkBuffer.data(), GL_DYNAMIC_DRAW);
+            glBufferData(GL_ARRAY_BUFFER, newAllocatedVertexCount * sizeof(TVertexAttributes), nullptr, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, mTotalVertexCount * sizeof(TVertexAttributes), mWorkBuffer.data());
             CheckOpenGLError();
 #else
             TestActions.push_back({
                 TestAction::ActionKind::AllocateAndUploadVBO,
                 0u,
                 mWorkBuffer.data(),
-                mTotalVertexCount * sizeof(TVertexAttributes) });
+                mTotalVertexCount * sizeof(TVertexAttributes),
+                newAllocatedVertexCount * sizeof(TVertexAttributes) });
 #endif
 
-            mLastAllocatedVBOVertexCount = mTotalVertexCount;
+            mAllocatedVBOVertexCount = newAllocatedVertexCount;
 
             return mTotalVertexCount;
         }
 
         //
-        // Required size has not grown - from here on we won't realloc VBO,
+        // Required size fits the VBO - from here on we won't realloc VBO,
         // nor rebuild work buffer unless where needed
         //
 
-        assert(mWorkBuffer.size() >= mTotalVertexCount);
+        assert(mAllocatedVBOVertexCount >= mTotalVertexCount);
 
         bool isDirty = false;
         bool forceRebuild = false;
@@ -439,7 +453,8 @@ public:
                 TestAction::ActionKind::UploadVBO,
                 iDirtyStartWb * sizeof(TVertexAttributes),
                 &(mWorkBuffer.data()[iDirtyStartWb]),
-                nVertices * sizeof(TVertexAttributes) });
+                nVertices * sizeof(TVertexAttributes),
+                0u });
 #endif
 
             return nVertices;
@@ -473,8 +488,8 @@ private:
     bool mIsGlobalDirty; // Set when at least one provider is dirty
     std::size_t mTotalVertexCount; // Total number of vertices, valid at beginning of RenderUpload()
 
-    BoundedVector<TVertexAttributes> mWorkBuffer; // For building single vertex buffer; always mirror of actual VBO
+    BoundedVector<TVertexAttributes> mWorkBuffer; // For building single vertex buffer; always mirror of actual VBO; allocated as large as the VBO
 
     GameOpenGLVBO mVBO;
-    size_t mLastAllocatedVBOVertexCount; // only grows
+    size_t mAllocatedVBOVertexCount; // only grows
 };
\ No newline at end of file
@@ -6,7 +6,9 @@
 #include "ShaderManager.h"
 
 #include <Core/GameException.h>
+#include <Core/Log.h>
 
+#include <fstream>
 #include <regex>
 #include <unordered_map>
 #include <unordered_set>
@@ -14,7 +16,12 @@
 template<typename TShaderSet>
 ShaderManager<TShaderSet>::ShaderManager(
     IAssetManager const & assetManager,
+    std::optional<std::filesystem::path> const & programBinaryCacheFolderPath,
     SimpleProgressCallback const & progressCallback)
+    : mPrograms()
+    , mProgramsByProgramParameter()
+    , mActiveProgramIndex(NoActiveProgram)
+    , mProgramBinaryCacheFolderPath(GameOpenGL::SupportsProgramBinaries ? programBinaryCacheFolderPath : std::nullopt)
 {
     //
     // Load all shader files
@@ -111,56 +118,90 @@ void ShaderManager<TShaderSet>::CompileShader(
 
 
         //
-        // Compile vertex shader
+        // Try to restore program from its binary
         //
 
-        GameOpenGL::CompileShader(
-            vertexShaderSource,
-            GL_VERTEX_SHADER,
-            mPrograms[programIndex].OpenGLHandle,
-            programName);
+        std::optional<std::filesystem::path> programBinaryFilePath;
+        std::uint64_t programBinaryKey = 0;
+        if (mProgramBinaryCacheFolderPath.has_value())
+        {
+            programBinaryFilePath = *mProgramBinaryCacheFolderPath / (TShaderSet::ShaderSetName + "_" + programName + ".bin");
+            programBinaryKey = CalculateProgramBinaryKey(vertexShaderSource, fragmentShaderSource);
+        }
 
+        if (!programBinaryFilePath.has_value()
+            || !TryRestoreProgramBinary(mPrograms[programIndex].OpenGLHandle, *programBinaryFilePath, programBinaryKey))
+        {
+            if (programBinaryFilePath.has_value())
+            {
+                // Make sure we'll be able to retrieve the binary
+                glProgramParameteri(*mPrograms[programIndex].OpenGLHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+                CheckOpenGLError();
+            }
 
-        //
-        // Compile fragment shader
-        //
 
-        GameOpenGL::CompileShader(
-            fragmentShaderSource,
-            GL_FRAGMENT_SHADER,
-            mPrograms[programIndex].OpenGLHandle,
-            programName);
+            //
+            // Compile vertex shader
+            //
 
+            GameOpenGL::CompileShader(
+                vertexShaderSource,
+                GL_VERTEX_SHADER,
+                mPrograms[programIndex].OpenGLHandle,
+                programName);
 
-        //
-        // Link a first time, to enable extraction of attributes and uniforms
-        //
 
-        GameOpenGL::LinkShaderProgram(mPrograms[programIndex].OpenGLHandle, programName);
+            //
+            // Compile fragment shader
+            //
 
+            GameOpenGL::CompileShader(
+                fragmentShaderSource,
+                GL_FRAGMENT_SHADER,
+                mPrograms[programIndex].OpenGLHandle,
+                programName);
 
-        //
-        // Extract attribute names from vertex shader and bind them
-        //
 
-        std::set<std::string> vertexAttributeNames = ExtractVertexAttributeNames(mPrograms[programIndex].OpenGLHandle);
+            //
+            // Link a first time, to enable extraction of attributes and uniforms
+            //
 
-        for (auto const & vertexAttributeName : vertexAttributeNames)
-        {
-            auto vertexAttribute = TShaderSet::StrToVertexAttributeKind(vertexAttributeName);
+            GameOpenGL::LinkShaderProgram(mPrograms[programIndex].OpenGLHandle, programName);
 
-            GameOpenGL::BindAttributeLocation(
-                mPrograms[programIndex].OpenGLHandle,
-                static_cast<GLuint>(vertexAttribute),
-                "in" + vertexAttributeName);
-        }
 
+            //
+            // Extract attribute names from vertex shader and bind them
+            //
 
-        //
-        // Link a second time, to freeze vertex attribute binding
-        //
+            std::set<std::string> vertexAttributeNames = ExtractVertexAttributeNames(mPrograms[programIndex].OpenGLHandle);
 
-        GameOpenGL::LinkShaderProgram(mPrograms[programIndex].OpenGLHandle, programName);
+            for (auto const & vertexAttributeName : vertexAttributeNames)
+            {
+                auto vertexAttribute = TShaderSet::StrToVertexAttributeKind(vertexAttributeName);
+
+                GameOpenGL::BindAttributeLocation(
+                    mPrograms[programIndex].OpenGLHandle,
+                    static_cast<GLuint>(vertexAttribute),
+                    "in" + vertexAttributeName);
+            }
+
+
+            //
+            // Link a second time, to freeze vertex attribute binding
+            //
+
+            GameOpenGL::LinkShaderProgram(mPrograms[programIndex].OpenGLHandle, programName);
+
+
+            //
+            // Save binary for next time
+            //
+
+            if (programBinaryFilePath.has_value())
+            {
+                SaveProgramBinary(mPrograms[programIndex].OpenGLHandle, *programBinaryFilePath, programBinaryKey);
+            }
+        }
 
 
         //
@@ -418,6 +459,155 @@ std::set<std::string> ShaderManager<TShaderSet>::ExtractVertexAttributeNames(Gam
     return attributeNames;
 }
 
+template<typename TShaderSet>
+std::uint64_t ShaderManager<TShaderSet>::CalculateProgramBinaryKey(
+    std::string const & vertexShaderSource,
+    std::string const & fragmentShaderSource)
+{
+    // FNV-1a, which - unlike std::hash - is stable across runs and builds
+
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto const hashString = [&hash](std::string const & str)
+        {
+            for (char const c : str)
+            {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            }
+
+            // Separator
+            hash ^= 0xffu;
+            hash *= 0x100000001b3ull;
+        };
+
+    hashString(GameOpenGL::DriverIdentifier);
+    hashString(vertexShaderSource);
+    hashString(fragmentShaderSource);
+
+    return hash;
+}
+
+template<typename TShaderSet>
+bool ShaderManager<TShaderSet>::TryRestoreProgramBinary(
+    GameOpenGLShaderProgram & shaderProgram,
+    std::filesystem::path const & programBinaryFilePath,
+    std::uint64_t programBinaryKey)
+{
+    //
+    // File layout: key, binaryFormat, length, binary
+    //
+
+    std::ifstream file(programBinaryFilePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        // Not cached yet
+        return false;
+    }
+
+    std::uint64_t key;
+    std::uint32_t binaryFormat;
+    std::uint32_t length;
+    file.read(reinterpret_cast<char *>(&key), sizeof(key));
+    file.read(reinterpret_cast<char *>(&binaryFormat), sizeof(binaryFormat));
+    file.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!file || key != programBinaryKey || length == 0)
+    {
+        // Stale
+        return false;
+    }
+
+    std::vector<char> binary(length);
+    file.read(binary.data(), length);
+    if (!file)
+    {
+        // Truncated
+        return false;
+    }
+
+    glProgramBinary(*shaderProgram, static_cast<GLenum>(binaryFormat), binary.data(), static_cast<GLsizei>(length));
+
+    GLint success;
+    glGetProgramiv(*shaderProgram, GL_LINK_STATUS, &success);
+    bool isRestored = (glGetError() == GL_NO_ERROR && success);
+
+    if (isRestored)
+    {
+        // Verify vertex attribute bindings, which are frozen in the binary
+        // and thus might be outdated wrt the shader set's
+        try
+        {
+            for (auto const & vertexAttributeName : ExtractVertexAttributeNames(shaderProgram))
+            {
+                GLint const location = glGetAttribLocation(*shaderProgram, ("in" + vertexAttributeName).c_str());
+                if (location != static_cast<GLint>(TShaderSet::StrToVertexAttributeKind(vertexAttributeName)))
+                {
+                    isRestored = false;
+                    break;
+                }
+            }
+        }
+        catch (GameException const &)
+        {
+            isRestored = false;
+        }
+    }
+
+    if (!isRestored)
+    {
+        LogMessage("ShaderManager: rejected program binary \"", programBinaryFilePath.filename().string(), "\"");
+
+        // Start from a clean program
+        shaderProgram.reset();
+        shaderProgram = glCreateProgram();
+        CheckOpenGLError();
+    }
+
+    return isRestored;
+}
+
+template<typename TShaderSet>
+void ShaderManager<TShaderSet>::SaveProgramBinary(
+    GameOpenGLShaderProgram const & shaderProgram,
+    std::filesystem::path const & programBinaryFilePath,
+    std::uint64_t programBinaryKey)
+{
+    // Best effort: failing to save only costs a compilation at next startup
+
+    GLint length = 0;
+    glGetProgramiv(*shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (glGetError() != GL_NO_ERROR || length <= 0)
+    {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLsizei actualLength = 0;
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(*shaderProgram, length, &actualLength, &binaryFormat, binary.data());
+    if (glGetError() != GL_NO_ERROR || actualLength <= 0)
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(programBinaryFilePath.parent_path(), ec);
+
+    std::ofstream file(programBinaryFilePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LogMessage("ShaderManager: cannot save program binary \"", programBinaryFilePath.string(), "\"");
+        return;
+    }
+
+    std::uint32_t const binaryFormat32 = static_cast<std::uint32_t>(binaryFormat);
+    std::uint32_t const length32 = static_cast<std::uint32_t>(actualLength);
+    file.write(reinterpret_cast<char const *>(&programBinaryKey), sizeof(programBinaryKey));
+    file.write(reinterpret_cast<char const *>(&binaryFormat32), sizeof(binaryFormat32));
+    file.write(reinterpret_cast<char const *>(&length32), sizeof(length32));
+    file.write(binary.data(), actualLength);
+}
+
 template<typename TShaderSet>
 std::set<std::string> ShaderManager<TShaderSet>::ExtractParameterNames(GameOpenGLShaderProgram const & shaderProgram)
 {
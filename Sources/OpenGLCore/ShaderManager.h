@@ -13,16 +13,22 @@
 
 #include <cassert>
 #include <cstdint>
+#include <filesystem>
 #include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <vector>
 
 /*
  * Loads all shaders for a specific set, and provides an API to manage the shaders.
+ *
+ * When given a cache folder, and the driver supports it, linked programs are saved there
+ * as binaries and restored at the next startup, skipping compilation and linking; a program
+ * is compiled from source whenever its binary is missing, stale, or rejected by the driver.
  */
 template <typename TShaderSet>
 class ShaderManager
@@ -30,6 +36,7 @@ class ShaderManager
 private:
 
     static constexpr GLint NoParameterLocation = std::numeric_limits<GLint>::min();
+    static constexpr uint32_t NoActiveProgram = std::numeric_limits<uint32_t>::max();
 
 public:
 
@@ -38,7 +45,16 @@ public:
         SimpleProgressCallback const & progressCallback)
     {
         return std::unique_ptr<ShaderManager>(
-            new ShaderManager(assetManager, progressCallback));
+            new ShaderManager(assetManager, std::nullopt, progressCallback));
+    }
+
+    static std::unique_ptr<ShaderManager> CreateInstance(
+        IAssetManager const & assetManager,
+        std::optional<std::filesystem::path> const & programBinaryCacheFolderPath,
+        SimpleProgressCallback const & progressCallback)
+    {
+        return std::unique_ptr<ShaderManager>(
+            new ShaderManager(assetManager, programBinaryCacheFolderPath, progressCallback));
     }
 
     template <typename TShaderSet::ProgramKindType Program>
@@ -353,9 +369,16 @@ public:
     {
         uint32_t const programIndex = static_cast<uint32_t>(program);
 
-        glUseProgram(*(mPrograms[programIndex].OpenGLHandle));
+        // Skip redundant switches, which are frequent when the same sequence
+        // of programs is used for each ship
+        if (programIndex != mActiveProgramIndex)
+        {
+            glUseProgram(*(mPrograms[programIndex].OpenGLHandle));
 
-        CheckOpenGLError();
+            CheckOpenGLError();
+
+            mActiveProgramIndex = programIndex;
+        }
     }
 
     // At any given moment, only one texture (unit) may be active
@@ -396,6 +419,7 @@ private:
 
     ShaderManager(
         IAssetManager const & assetManager,
+        std::optional<std::filesystem::path> const & programBinaryCacheFolderPath,
         SimpleProgressCallback const & progressCallback);
 
     struct ShaderInfo
@@ -420,6 +444,20 @@ private:
 
     static std::set<std::string> ExtractParameterNames(GameOpenGLShaderProgram const & shaderProgram);
 
+    static std::uint64_t CalculateProgramBinaryKey(
+        std::string const & vertexShaderSource,
+        std::string const & fragmentShaderSource);
+
+    static bool TryRestoreProgramBinary(
+        GameOpenGLShaderProgram & shaderProgram,
+        std::filesystem::path const & programBinaryFilePath,
+        std::uint64_t programBinaryKey);
+
+    static void SaveProgramBinary(
+        GameOpenGLShaderProgram const & shaderProgram,
+        std::filesystem::path const & programBinaryFilePath,
+        std::uint64_t programBinaryKey);
+
 private:
 
     struct ProgramInfo
@@ -439,6 +477,13 @@ private:
     // indexed by ProgramParameterKind
     std::vector<std::vector<typename TShaderSet::ProgramKindType>> mProgramsByProgramParameter;
 
+    // The index of the currently-active program; we assume we're
+    // the only ones activating programs in our OpenGL context
+    uint32_t mActiveProgramIndex;
+
+    // Where we keep program binaries; only set when the driver supports them
+    std::optional<std::filesystem::path> const mProgramBinaryCacheFolderPath;
+
 private:
 
     friend class ShaderManagerTests_ProcessesIncludes_OneLevel_Test;
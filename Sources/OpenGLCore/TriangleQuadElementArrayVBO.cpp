@@ -12,9 +12,14 @@ std::unique_ptr<TriangleQuadElementArrayVBO> TriangleQuadElementArrayVBO::Create
 	glGenBuffers(1, &tmpGLuint);
 	GameOpenGLVBO vbo(tmpGLuint);
 
-	return std::unique_ptr<TriangleQuadElementArrayVBO>(
+	auto elementArrayVBO = std::unique_ptr<TriangleQuadElementArrayVBO>(
 		new TriangleQuadElementArrayVBO(
 			std::move(vbo)));
+
+	// Pre-size, uploaded at the first render
+	elementArrayVBO->Grow(InitialQuadCount);
+
+	return elementArrayVBO;
 }
 
 void TriangleQuadElementArrayVBO::Grow(size_t quadCount)
@@ -9,6 +9,7 @@
 
 #include <Core/BoundedVector.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -20,6 +21,8 @@
  *  |/|
  *  B D
  *
+ * The buffer is shared by all quad-based pipelines, and starts with room for
+ * enough quads to never have to grow in small scenes.
  */
 class TriangleQuadElementArrayVBO final
 {
@@ -31,7 +34,9 @@ public:
 	{
 		if (quadCount > mQuadCount)
 		{
-			Grow(quadCount);
+			// Grow geometrically, so that fluctuating quad counts settle
+			// after a few re-uploads
+			Grow(std::max(quadCount, mQuadCount * 2));
 		}
 	}
 
@@ -58,6 +63,8 @@ public:
 
 private:
 
+	static size_t constexpr InitialQuadCount = 4096;
+
 	explicit TriangleQuadElementArrayVBO(GameOpenGLVBO && vbo)
 		: mIndices()
 		, mQuadCount(0)
@@ -28,7 +28,7 @@ GlobalRenderContext::GlobalRenderContext(
 {
 }
 
-void GlobalRenderContext::InitializeNoiseTextures()
+void GlobalRenderContext::InitializeNoiseTextures(ThreadPool & threadPool)
 {
     //
     // Load noise texture database
@@ -62,12 +62,14 @@ void GlobalRenderContext::InitializeNoiseTextures()
         GL_UNSIGNED_BYTE,
         GL_LINEAR);
 
-    RegeneratePerlin_4_32_043_Noise(); // Will upload at firstRenderPrepare
+    RegeneratePerlin_4_32_043_Noise(&threadPool); // Will upload at firstRenderPrepare
 
-    RegeneratePerlin_8_1024_073_Noise(); // Will upload at firstRenderPrepare
+    RegeneratePerlin_8_1024_073_Noise(&threadPool); // Will upload at firstRenderPrepare
 }
 
-void GlobalRenderContext::InitializeGenericTextures()
+void GlobalRenderContext::InitializeGenericTextures(
+    ThreadPool & threadPool,
+    std::optional<std::filesystem::path> const & textureAtlasCacheFolderPath)
 {
     //
     // Create generic linear texture atlas
@@ -77,11 +79,13 @@ void GlobalRenderContext::InitializeGenericTextures()
     auto genericLinearTextureDatabase = TextureDatabase<GameTextureDatabases::GenericLinearTextureDatabase>::Load(mAssetManager);
 
     // Create atlas
-    auto genericLinearTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericLinearTextureDatabase>::BuildAtlas(
+    auto genericLinearTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericLinearTextureDatabase>::BuildCachedAtlas(
         genericLinearTextureDatabase,
         TextureAtlasOptions::None,
         1.0f,
         mAssetManager,
+        threadPool,
+        textureAtlasCacheFolderPath,
         SimpleProgressCallback::Dummy());
 
     LogMessage("Generic linear texture atlas size: ", genericLinearTextureAtlas.Image.Size.ToString());
@@ -155,11 +159,13 @@ void GlobalRenderContext::InitializeGenericTextures()
     auto genericMipMappedTextureDatabase = TextureDatabase<GameTextureDatabases::GenericMipMappedTextureDatabase>::Load(mAssetManager);
 
     // Create atlas
-    auto genericMipMappedTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericMipMappedTextureDatabase>::BuildAtlas(
+    auto genericMipMappedTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericMipMappedTextureDatabase>::BuildCachedAtlas(
         genericMipMappedTextureDatabase,
         TextureAtlasOptions::MipMappable,
         1.0f,
         mAssetManager,
+        threadPool,
+        textureAtlasCacheFolderPath,
         SimpleProgressCallback::Dummy());
 
     LogMessage("Generic mipmapped texture atlas size: ", genericMipMappedTextureAtlas.Image.Size.ToString());
@@ -340,32 +346,42 @@ void GlobalRenderContext::RenderPrepareEnd()
     }
 }
 
-void GlobalRenderContext::RegeneratePerlin_4_32_043_Noise()
+void GlobalRenderContext::RegeneratePerlin_4_32_043_Noise(ThreadPool * threadPool)
 {
     mPerlinNoise_4_32_043_ToUpload = MakePerlinNoise(
         IntegralRectSize(1024, 1024),
         4,
         32,
-        0.43f);
+        0.43f,
+        threadPool);
 }
 
-void GlobalRenderContext::RegeneratePerlin_8_1024_073_Noise()
+void GlobalRenderContext::RegeneratePerlin_8_1024_073_Noise(ThreadPool * threadPool)
 {
     mPerlinNoise_8_1024_073_ToUpload = MakePerlinNoise(
         IntegralRectSize(1024, 1024),
         8,
         1024,
-        0.73f);
+        0.73f,
+        threadPool);
 }
 
 std::unique_ptr<Buffer2D<float, struct IntegralTag>> GlobalRenderContext::MakePerlinNoise(
     IntegralRectSize const & size,
     int firstGridDensity,
     int lastGridDensity,
-    float persistence)
+    float persistence,
+    ThreadPool * threadPool)
 {
     auto buf = std::make_unique<Buffer2D<float, struct IntegralTag>>(
-        Noise::CreateRepeatableFractal2DPerlinNoise(
+        threadPool != nullptr
+        ? Noise::CreateRepeatableFractal2DPerlinNoise(
+            size,
+            firstGridDensity,
+            lastGridDensity,
+            persistence,
+            *threadPool)
+        : Noise::CreateRepeatableFractal2DPerlinNoise(
             size,
             firstGridDensity,
             lastGridDensity,
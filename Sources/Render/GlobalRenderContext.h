@@ -18,9 +18,12 @@
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/TextureAtlas.h>
+#include <Core/ThreadPool.h>
 
 #include <cassert>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 class GlobalRenderContext
 {
@@ -32,9 +35,11 @@ public:
 
     ~GlobalRenderContext() = default;
 
-    void InitializeNoiseTextures();
+    void InitializeNoiseTextures(ThreadPool & threadPool);
 
-    void InitializeGenericTextures();
+    void InitializeGenericTextures(
+        ThreadPool & threadPool,
+        std::optional<std::filesystem::path> const & textureAtlasCacheFolderPath);
 
     void InitializeExplosionTextures();
 
@@ -83,17 +88,29 @@ public:
         return mUploadedNoiseTexturesManager.GetOpenGLHandle(noiseType);
     }
 
-    void RegeneratePerlin_4_32_043_Noise();
+    void RegeneratePerlin_4_32_043_Noise()
+    {
+        RegeneratePerlin_4_32_043_Noise(nullptr);
+    }
 
-    void RegeneratePerlin_8_1024_073_Noise();
+    void RegeneratePerlin_8_1024_073_Noise()
+    {
+        RegeneratePerlin_8_1024_073_Noise(nullptr);
+    }
 
 private:
 
+    // With a thread pool only when nobody else may be using it
+    void RegeneratePerlin_4_32_043_Noise(ThreadPool * threadPool);
+
+    void RegeneratePerlin_8_1024_073_Noise(ThreadPool * threadPool);
+
     static std::unique_ptr<Buffer2D<float, struct IntegralTag>> MakePerlinNoise(
         IntegralRectSize const & size,
         int firstGridDensity,
         int lastGridDensity,
-        float persistence);
+        float persistence,
+        ThreadPool * threadPool);
 
 private:
 
@@ -0,0 +1,159 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "InteriorViewRasterizer.h"
+
+#include <Core/GameException.h>
+
+#include <algorithm>
+#include <cassert>
+
+InteriorViewRasterizer::InteriorViewRasterizer(ShaderManager<GameShaderSets::ShaderSet> & shaderManager)
+    : mShaderManager(shaderManager)
+    , mVBO()
+    , mVAO()
+    , mFramebuffer()
+{
+    GLuint tmpGLuint;
+
+    glGenBuffers(1, &tmpGLuint);
+    mVBO = tmpGLuint;
+
+    glGenFramebuffers(1, &tmpGLuint);
+    mFramebuffer = tmpGLuint;
+
+    //
+    // Initialize VAO
+    //
+
+    glGenVertexArrays(1, &tmpGLuint);
+    mVAO = tmpGLuint;
+
+    glBindVertexArray(*mVAO);
+    CheckOpenGLError();
+
+    // Describe vertex attributes
+    static_assert(sizeof(InteriorViewFloorVertex) == 6 * sizeof(float));
+    glBindBuffer(GL_ARRAY_BUFFER, *mVBO);
+    glEnableVertexAttribArray(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::AABB1));
+    glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::AABB1), 4, GL_FLOAT, GL_FALSE, sizeof(InteriorViewFloorVertex), (void *)0);
+    glEnableVertexAttribArray(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::AABB2));
+    glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::AABB2), 2, GL_FLOAT, GL_FALSE, sizeof(InteriorViewFloorVertex), (void *)(4 * sizeof(float)));
+    CheckOpenGLError();
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+ImageSize InteriorViewRasterizer::GetMaxSize()
+{
+    return ImageSize(
+        std::min(GameOpenGL::MaxViewportWidth, GameOpenGL::MaxTextureSize),
+        std::min(GameOpenGL::MaxViewportHeight, GameOpenGL::MaxTextureSize));
+}
+
+RgbaImageData InteriorViewRasterizer::Rasterize(
+    RgbaImageData const & backgroundTexture,
+    std::vector<InteriorViewFloorVertex> const & floorVertices)
+{
+    ImageSize const size = backgroundTexture.Size;
+
+    assert(size.width <= GetMaxSize().width && size.height <= GetMaxSize().height);
+
+    //
+    // Create target texture, starting with the background
+    //
+
+    GLuint tmpGLuint;
+    glGenTextures(1, &tmpGLuint);
+    GameOpenGLTexture targetTexture(tmpGLuint);
+
+    mShaderManager.ActivateTexture<GameShaderSets::ProgramParameterKind::SharedTexture>();
+    glBindTexture(GL_TEXTURE_2D, *targetTexture);
+    CheckOpenGLError();
+
+    // No mipmaps, hence no mipmap filtering for the texture to be complete
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.width, size.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, backgroundTexture.Data.get());
+    CheckOpenGLError();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    //
+    // Attach it to the framebuffer
+    //
+
+    glBindFramebuffer(GL_FRAMEBUFFER, *mFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, *targetTexture, 0);
+    CheckOpenGLError();
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        throw GameException("Interior view framebuffer is not complete");
+    }
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    glViewport(0, 0, size.width, size.height);
+
+    //
+    // Draw floors
+    //
+
+    if (!floorVertices.empty())
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, *mVBO);
+        glBufferData(GL_ARRAY_BUFFER, floorVertices.size() * sizeof(InteriorViewFloorVertex), floorVertices.data(), GL_STREAM_DRAW);
+        CheckOpenGLError();
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // Pixels to NDC
+        ProjectionMatrix const orthoMatrix = {
+            { 2.0f / static_cast<float>(size.width), 0.0f, 0.0f, 0.0f },
+            { 0.0f, 2.0f / static_cast<float>(size.height), 0.0f, 0.0f },
+            { 0.0f, 0.0f, 0.0f, 0.0f },
+            { -1.0f, -1.0f, 0.0f, 1.0f }
+        };
+
+        mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::AABBs>();
+        mShaderManager.SetProgramParameter<GameShaderSets::ProgramKind::AABBs, GameShaderSets::ProgramParameterKind::OrthoMatrix>(
+            orthoMatrix);
+
+        // Blend alpha like colors - i.e. like in a mix - rather than squaring it
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+        glBindVertexArray(*mVAO);
+
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(floorVertices.size()));
+        CheckOpenGLError();
+
+        glBindVertexArray(0);
+
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    //
+    // Read back
+    //
+
+    RgbaImageData interiorView(size);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, size.width, size.height, GL_RGBA, GL_UNSIGNED_BYTE, interiorView.Data.get());
+    CheckOpenGLError();
+
+    //
+    // Restore
+    //
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    return interiorView;
+}
@@ -0,0 +1,71 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameShaderSets.h"
+
+#include <OpenGLCore/GameOpenGL.h>
+#include <OpenGLCore/ShaderManager.h>
+
+#include <Core/ImageData.h>
+#include <Core/Vectors.h>
+
+#include <vector>
+
+/*
+ * A vertex of the floors of a ship's interior view, in texture pixel space.
+ */
+struct InteriorViewFloorVertex
+{
+    vec4f color;
+    float x;
+    float y;
+
+    InteriorViewFloorVertex(
+        vec4f const & _color,
+        float _x,
+        float _y)
+        : color(_color)
+        , x(_x)
+        , y(_y)
+    {}
+};
+
+/*
+ * Makes the interior view of a ship on the GPU, drawing its floors - as triangles - onto
+ * its interior texture in a framebuffer object, and reading the result back, since ships
+ * keep their view images for when the view mode changes.
+ *
+ * Floors are drawn with the flat-color program of AABBs, whose vertices we share the layout of.
+ *
+ * To be used on the render thread only.
+ */
+class InteriorViewRasterizer final
+{
+public:
+
+    explicit InteriorViewRasterizer(ShaderManager<GameShaderSets::ShaderSet> & shaderManager);
+
+    /*
+     * The largest interior view that may be made.
+     */
+    static ImageSize GetMaxSize();
+
+    /*
+     * Changes the OrthoMatrix of the AABBs program, which the caller is responsible for restoring.
+     */
+    RgbaImageData Rasterize(
+        RgbaImageData const & backgroundTexture,
+        std::vector<InteriorViewFloorVertex> const & floorVertices);
+
+private:
+
+    ShaderManager<GameShaderSets::ShaderSet> & mShaderManager;
+
+    GameOpenGLVBO mVBO;
+    GameOpenGLVAO mVAO;
+    GameOpenGLFramebuffer mFramebuffer;
+};
@@ -676,6 +676,7 @@ void NotificationRenderContext::ApplyCanvasSizeChanges(RenderParameters const &
     for (auto & tntc : mTextNotificationTypeContexts)
     {
         tntc.AreTextLinesDirty = true;
+        tntc.IsGeneratedTextLineCacheValid = false;
     }
 
     // Make sure we re-calculate (and re-upload) all texture notification vertices
@@ -744,19 +745,31 @@ void NotificationRenderContext::RenderPrepareTextNotifications()
     //
 
     bool doNeedToUploadQuadVertexBuffers = false;
+    bool haveQuadVertexBufferSizesChanged = false;
     size_t totalTextQuadVertexBufferSize = 0;
 
     for (auto & textNotificationTypeContext : mTextNotificationTypeContexts)
     {
         if (textNotificationTypeContext.AreTextLinesDirty)
         {
-            // Re-generate quad vertices for this notification type
-            GenerateTextVertices(textNotificationTypeContext);
+            size_t const oldSize = textNotificationTypeContext.TextQuadVertexBuffer.size();
 
-            textNotificationTypeContext.AreTextLinesDirty = false;
+            // Re-generate quad vertices for this notification type; lines
+            // that have not changed are not re-tessellated
+            if (GenerateTextVertices(textNotificationTypeContext))
+            {
+                // We need to re-upload the vertex buffer of this notification type
+                textNotificationTypeContext.IsTextQuadVertexBufferDirty = true;
+                doNeedToUploadQuadVertexBuffers = true;
+
+                if (textNotificationTypeContext.TextQuadVertexBuffer.size() != oldSize)
+                {
+                    // Subsequent notification types' chunks move
+                    haveQuadVertexBufferSizesChanged = true;
+                }
+            }
 
-            // We need to re-upload the vertex buffers
-            doNeedToUploadQuadVertexBuffers = true;
+            textNotificationTypeContext.AreTextLinesDirty = false;
         }
 
         totalTextQuadVertexBufferSize += textNotificationTypeContext.TextQuadVertexBuffer.size();
@@ -765,7 +778,7 @@ void NotificationRenderContext::RenderPrepareTextNotifications()
     if (doNeedToUploadQuadVertexBuffers)
     {
         //
-        // Re-upload whole buffer
+        // Re-upload buffer - whole, or just the chunks that have changed
         //
 
         glBindBuffer(GL_ARRAY_BUFFER, *mTextVBO);
@@ -784,18 +797,26 @@ void NotificationRenderContext::RenderPrepareTextNotifications()
             CheckOpenGLError();
 
             mAllocatedTextQuadVertexBufferSize = mCurrentTextQuadVertexBufferSize;
+
+            // Buffer contents are gone
+            haveQuadVertexBufferSizesChanged = true;
         }
 
         // Upload buffer in chunks
         size_t start = 0;
-        for (auto const & textNotificationTypeContext : mTextNotificationTypeContexts)
+        for (auto & textNotificationTypeContext : mTextNotificationTypeContexts)
         {
-            glBufferSubData(
-                GL_ARRAY_BUFFER,
-                start * sizeof(TextQuadVertex),
-                textNotificationTypeContext.TextQuadVertexBuffer.size() * sizeof(TextQuadVertex),
-                textNotificationTypeContext.TextQuadVertexBuffer.data());
-            CheckOpenGLError();
+            if (haveQuadVertexBufferSizesChanged || textNotificationTypeContext.IsTextQuadVertexBufferDirty)
+            {
+                glBufferSubData(
+                    GL_ARRAY_BUFFER,
+                    start * sizeof(TextQuadVertex),
+                    textNotificationTypeContext.TextQuadVertexBuffer.size() * sizeof(TextQuadVertex),
+                    textNotificationTypeContext.TextQuadVertexBuffer.data());
+                CheckOpenGLError();
+
+                textNotificationTypeContext.IsTextQuadVertexBufferDirty = false;
+            }
 
             start += textNotificationTypeContext.TextQuadVertexBuffer.size();
         }
@@ -1228,20 +1249,83 @@ void NotificationRenderContext::RenderDrawInteractiveToolDashedLines()
     }
 }
 
-void NotificationRenderContext::GenerateTextVertices(TextNotificationTypeContext & context) const
+bool NotificationRenderContext::GenerateTextVertices(TextNotificationTypeContext & context) const
 {
     FontMetadata const & fontMetadata = *(context.NotificationFontMetadata);
 
     //
-    // Reset quad vertices
+    // Rebuild quad vertices, reusing the quads of the lines that have not changed
+    // since the previous generation
     //
 
+    std::swap(context.TextQuadVertexBuffer, context.PreviousTextQuadVertexBuffer);
     context.TextQuadVertexBuffer.clear();
 
+    bool const isCacheValid = context.IsGeneratedTextLineCacheValid;
+    bool haveVerticesChanged = !isCacheValid || (context.TextLines.size() != context.GeneratedTextLines.size());
+
+    for (size_t l = 0; l < context.TextLines.size(); ++l)
+    {
+        auto const & textLine = context.TextLines[l];
+
+        size_t const lineVertexStart = context.TextQuadVertexBuffer.size();
+
+        if (isCacheValid
+            && l < context.GeneratedTextLines.size()
+            && context.GeneratedTextLines[l] == textLine)
+        {
+            // Reuse this line's quads
+            auto const cachedStart = context.PreviousTextQuadVertexBuffer.cbegin() + context.GeneratedTextLineVertexStarts[l];
+            auto const cachedEnd = context.PreviousTextQuadVertexBuffer.cbegin() + context.GeneratedTextLineVertexStarts[l + 1];
+            context.TextQuadVertexBuffer.insert(
+                context.TextQuadVertexBuffer.end(),
+                cachedStart,
+                cachedEnd);
+        }
+        else
+        {
+            GenerateTextLineVertices(
+                textLine,
+                fontMetadata,
+                context.TextQuadVertexBuffer);
+
+            haveVerticesChanged = true;
+        }
+
+        // Keep this line's start, overwriting the previous generation's one
+        // only after having used it
+        if (l < context.GeneratedTextLineVertexStarts.size())
+        {
+            context.GeneratedTextLineVertexStarts[l] = lineVertexStart;
+        }
+        else
+        {
+            context.GeneratedTextLineVertexStarts.push_back(lineVertexStart);
+        }
+    }
+
+    context.GeneratedTextLineVertexStarts.resize(context.TextLines.size());
+    context.GeneratedTextLineVertexStarts.push_back(context.TextQuadVertexBuffer.size());
+
     //
-    // Rebuild quad vertices
+    // Remember what we've generated
     //
 
+    if (haveVerticesChanged)
+    {
+        context.GeneratedTextLines = context.TextLines;
+    }
+
+    context.IsGeneratedTextLineCacheValid = true;
+
+    return haveVerticesChanged;
+}
+
+void NotificationRenderContext::GenerateTextLineVertices(
+    TextLine const & textLine,
+    FontMetadata const & fontMetadata,
+    std::vector<TextQuadVertex> & vertices) const
+{
     // Hardcoded pixel offsets of readings in physics probe panel,
     // giving position of text's bottom-right corner
     float constexpr PhysicsProbePanelTextBottomY = 10.0f;
@@ -1250,168 +1334,164 @@ void NotificationRenderContext::GenerateTextVertices(TextNotificationTypeContext
     vec2f constexpr PhysicsProbePanelDepthBottomRight(371.0f, PhysicsProbePanelTextBottomY);
     vec2f constexpr PhysicsProbePanelPressureBottomRight(506.0f, PhysicsProbePanelTextBottomY);
 
-    for (auto const & textLine : context.TextLines)
-    {
-        //
-        // Calculate line position in NDC coordinates
-        //
+    //
+    // Calculate line position in NDC coordinates
+    //
 
-        vec2f linePositionNdc( // Top-left of quads; start with line's offset
-            textLine.ScreenOffset.x * static_cast<float>(fontMetadata.CellSize.width) * mScreenToNdcX,
-            -textLine.ScreenOffset.y * static_cast<float>(fontMetadata.CellSize.height) * mScreenToNdcY);
+    vec2f linePositionNdc( // Top-left of quads; start with line's offset
+        textLine.ScreenOffset.x * static_cast<float>(fontMetadata.CellSize.width) * mScreenToNdcX,
+        -textLine.ScreenOffset.y * static_cast<float>(fontMetadata.CellSize.height) * mScreenToNdcY);
 
-        switch (textLine.Anchor)
+    switch (textLine.Anchor)
+    {
+        case NotificationAnchorPositionType::BottomLeft:
         {
-            case NotificationAnchorPositionType::BottomLeft:
-            {
-                linePositionNdc += vec2f(
-                    -1.f + MarginScreen * mScreenToNdcX,
-                    -1.f + (MarginScreen + static_cast<float>(fontMetadata.CellSize.height)) * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                -1.f + MarginScreen * mScreenToNdcX,
+                -1.f + (MarginScreen + static_cast<float>(fontMetadata.CellSize.height)) * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::BottomRight:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::BottomRight:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    1.f - (MarginScreen + static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    -1.f + (MarginScreen + static_cast<float>(lineExtent.height)) * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                1.f - (MarginScreen + static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                -1.f + (MarginScreen + static_cast<float>(lineExtent.height)) * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::TopLeft:
-            {
-                linePositionNdc += vec2f(
-                    -1.f + MarginScreen * mScreenToNdcX,
-                    1.f - MarginTopScreen * mScreenToNdcY);
+        case NotificationAnchorPositionType::TopLeft:
+        {
+            linePositionNdc += vec2f(
+                -1.f + MarginScreen * mScreenToNdcX,
+                1.f - MarginTopScreen * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::TopRight:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::TopRight:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    1.f - (MarginScreen + static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    1.f - MarginTopScreen * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                1.f - (MarginScreen + static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                1.f - MarginTopScreen * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::PhysicsProbeReadingDepth:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::PhysicsProbeReadingDepth:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    -1.f + (PhysicsProbePanelDepthBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    -1.f + PhysicsProbePanelDepthBottomRight.y * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                -1.f + (PhysicsProbePanelDepthBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                -1.f + PhysicsProbePanelDepthBottomRight.y * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::PhysicsProbeReadingPressure:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::PhysicsProbeReadingPressure:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    -1.f + (PhysicsProbePanelPressureBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    -1.f + PhysicsProbePanelPressureBottomRight.y * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                -1.f + (PhysicsProbePanelPressureBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                -1.f + PhysicsProbePanelPressureBottomRight.y * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::PhysicsProbeReadingSpeed:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::PhysicsProbeReadingSpeed:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    -1.f + (PhysicsProbePanelSpeedBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    -1.f + PhysicsProbePanelSpeedBottomRight.y * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                -1.f + (PhysicsProbePanelSpeedBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                -1.f + PhysicsProbePanelSpeedBottomRight.y * mScreenToNdcY);
 
-                break;
-            }
+            break;
+        }
 
-            case NotificationAnchorPositionType::PhysicsProbeReadingTemperature:
-            {
-                auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
-                    textLine.Text.c_str(),
-                    textLine.Text.length());
+        case NotificationAnchorPositionType::PhysicsProbeReadingTemperature:
+        {
+            auto const lineExtent = fontMetadata.CalculateTextLineScreenExtent(
+                textLine.Text.c_str(),
+                textLine.Text.length());
 
-                linePositionNdc += vec2f(
-                    -1.f + (PhysicsProbePanelTemperatureBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
-                    -1.f + PhysicsProbePanelTemperatureBottomRight.y * mScreenToNdcY);
+            linePositionNdc += vec2f(
+                -1.f + (PhysicsProbePanelTemperatureBottomRight.x - static_cast<float>(lineExtent.width)) * mScreenToNdcX,
+                -1.f + PhysicsProbePanelTemperatureBottomRight.y * mScreenToNdcY);
 
-                break;
-            }
+            break;
         }
+    }
 
-        //
-        // Emit quads for this line
-        //
+    //
+    // Emit quads for this line
+    //
 
-        float const alpha = textLine.Alpha;
-        auto & vertices = context.TextQuadVertexBuffer;
+    float const alpha = textLine.Alpha;
 
-        for (char _ch : textLine.Text)
-        {
-            unsigned char const ch = static_cast<unsigned char>(_ch);
+    for (char _ch : textLine.Text)
+    {
+        unsigned char const ch = static_cast<unsigned char>(_ch);
 
-            float const glyphWidthNdc = static_cast<float>(fontMetadata.GlyphWidths[ch]) * mScreenToNdcX;
-            float const glyphHeightNdc = static_cast<float>(fontMetadata.CellSize.height) * mScreenToNdcY;
+        float const glyphWidthNdc = static_cast<float>(fontMetadata.GlyphWidths[ch]) * mScreenToNdcX;
+        float const glyphHeightNdc = static_cast<float>(fontMetadata.CellSize.height) * mScreenToNdcY;
 
-            float const textureULeft = fontMetadata.GlyphTextureAtlasBottomLefts[ch].x;
-            float const textureURight = fontMetadata.GlyphTextureAtlasTopRights[ch].x;
-            float const textureVBottom = fontMetadata.GlyphTextureAtlasBottomLefts[ch].y;
-            float const textureVTop = fontMetadata.GlyphTextureAtlasTopRights[ch].y;
+        float const textureULeft = fontMetadata.GlyphTextureAtlasBottomLefts[ch].x;
+        float const textureURight = fontMetadata.GlyphTextureAtlasTopRights[ch].x;
+        float const textureVBottom = fontMetadata.GlyphTextureAtlasBottomLefts[ch].y;
+        float const textureVTop = fontMetadata.GlyphTextureAtlasTopRights[ch].y;
 
-            // Top-left
-            vertices.emplace_back(
-                linePositionNdc.x,
-                linePositionNdc.y + glyphHeightNdc,
-                textureULeft,
-                textureVTop,
-                alpha);
+        // Top-left
+        vertices.emplace_back(
+            linePositionNdc.x,
+            linePositionNdc.y + glyphHeightNdc,
+            textureULeft,
+            textureVTop,
+            alpha);
 
-            // Bottom-left
-            vertices.emplace_back(
-                linePositionNdc.x,
-                linePositionNdc.y,
-                textureULeft,
-                textureVBottom,
-                alpha);
+        // Bottom-left
+        vertices.emplace_back(
+            linePositionNdc.x,
+            linePositionNdc.y,
+            textureULeft,
+            textureVBottom,
+            alpha);
 
-            // Top-right
-            vertices.emplace_back(
-                linePositionNdc.x + glyphWidthNdc,
-                linePositionNdc.y + glyphHeightNdc,
-                textureURight,
-                textureVTop,
-                alpha);
+        // Top-right
+        vertices.emplace_back(
+            linePositionNdc.x + glyphWidthNdc,
+            linePositionNdc.y + glyphHeightNdc,
+            textureURight,
+            textureVTop,
+            alpha);
 
-            // Bottom-right
-            vertices.emplace_back(
-                linePositionNdc.x + glyphWidthNdc,
-                linePositionNdc.y,
-                textureURight,
-                textureVBottom,
-                alpha);
-
-            linePositionNdc.x += glyphWidthNdc;
-        }
+        // Bottom-right
+        vertices.emplace_back(
+            linePositionNdc.x + glyphWidthNdc,
+            linePositionNdc.y,
+            textureURight,
+            textureVBottom,
+            alpha);
+
+        linePositionNdc.x += glyphWidthNdc;
     }
 }
 
@@ -815,7 +815,16 @@ private:
 
 	struct TextNotificationTypeContext;
 
-	void GenerateTextVertices(TextNotificationTypeContext & context) const;
+	// Returns true if the vertices have changed
+	bool GenerateTextVertices(TextNotificationTypeContext & context) const;
+
+	struct TextLine;
+	struct TextQuadVertex;
+
+	inline void GenerateTextLineVertices(
+		TextLine const & textLine,
+		FontMetadata const & fontMetadata,
+		std::vector<TextQuadVertex> & vertices) const;
 
 	void GenerateTextureNotificationVertices();
 
@@ -1155,6 +1164,14 @@ private:
 			, ScreenOffset(screenOffset)
 			, Alpha(alpha)
 		{}
+
+		bool operator==(TextLine const & other) const
+		{
+			return Text == other.Text
+				&& Anchor == other.Anchor
+				&& ScreenOffset == other.ScreenOffset
+				&& Alpha == other.Alpha;
+		}
 	};
 
 	/*
@@ -1167,12 +1184,26 @@ private:
 		std::vector<TextLine> TextLines;
 		bool AreTextLinesDirty; // When dirty, we'll re-build the quads for this notification type
 		std::vector<TextQuadVertex> TextQuadVertexBuffer;
+		bool IsTextQuadVertexBufferDirty; // When dirty, we'll re-upload the quads for this notification type
+
+		// Glyph-run cache: the lines the current quads have been generated from, together
+		// with the start of each line's quads; lines that did not change since the previous
+		// generation reuse their quads rather than being re-tessellated
+		std::vector<TextLine> GeneratedTextLines;
+		std::vector<size_t> GeneratedTextLineVertexStarts; // One extra at end
+		std::vector<TextQuadVertex> PreviousTextQuadVertexBuffer; // Scratch
+		bool IsGeneratedTextLineCacheValid; // Invalidated e.g. when the canvas changes
 
 		explicit TextNotificationTypeContext(FontMetadata const * notificationFontMetadata)
 			: NotificationFontMetadata(notificationFontMetadata)
 			, TextLines()
 			, AreTextLinesDirty(false)
 			, TextQuadVertexBuffer()
+			, IsTextQuadVertexBufferDirty(false)
+			, GeneratedTextLines()
+			, GeneratedTextLineVertexStarts()
+			, PreviousTextQuadVertexBuffer()
+			, IsGeneratedTextLineCacheValid(false)
 		{}
 
 		TextNotificationTypeContext() // Just to allow array
@@ -1180,6 +1211,11 @@ private:
 			, TextLines()
 			, AreTextLinesDirty(false)
 			, TextQuadVertexBuffer()
+			, IsTextQuadVertexBufferDirty(false)
+			, GeneratedTextLines()
+			, GeneratedTextLineVertexStarts()
+			, PreviousTextQuadVertexBuffer()
+			, IsGeneratedTextLineCacheValid(false)
 		{}
 	};
 
@@ -8,10 +8,12 @@
 #include <Core/GameChronometer.h>
 #include <Core/GameException.h>
 #include <Core/Log.h>
+#include <Core/StartupTimeline.h>
 #include <Core/SysSpecifics.h>
 #include <Core/ThreadManager.h>
 
 #include <cstring>
+#include <limits>
 
 namespace /*anonymous*/ {
 
@@ -42,6 +44,16 @@ RenderContext::RenderContext(
     , mRenderThread(ThreadManager::ThreadTaskKind::Render, "FS RenderThread", 0, threadManager.IsRenderingMultiThreaded(), threadManager)
     , mLastRenderUploadEndCompletionIndicator()
     , mLastRenderDrawCompletionIndicator()
+    , mLastRenderSwapCompletionIndicator()
+    , mPreviousRenderSwapCompletionIndicator()
+    , mLastRenderDrawStartTime()
+    , mIsScreenshotRequested(false)
+    , mPendingScreenshotReadbacks()
+    , mFreeScreenshotPixelBuffers()
+    , mTakenScreenshots()
+    , mTakenScreenshotsMutex()
+    , mAsyncUploadCommands()
+    , mAsyncUploadStagingBuffer()
     // Shader manager
     , mShaderManager()
     // Child contextes
@@ -49,6 +61,7 @@ RenderContext::RenderContext(
     , mWorldRenderContext()
     , mShips()
     , mNotificationRenderContext()
+    , mInteriorViewRasterizer()
     // Non-render parameters
     , mAmbientLightIntensity(1.0f)
     , mMoonlightColor(0x17, 0x3d, 0x5b)
@@ -73,12 +86,15 @@ RenderContext::RenderContext(
     // Statistics
     , mPerfStats(perfStats)
     , mRenderStats()
+    , mRenderPassTimer()
 {
     progressCallback(0.0f, ProgressMessageType::InitializingOpenGL);
 
     mRenderThread.RunSynchronously(
         [&, doForceNoGlFinish = renderDeviceProperties.DoForceNoGlFinish]()
         {
+            ScopedStartupStage const stage("Render_OpenGL");
+
             //
             // Initialize OpenGL
             //
@@ -128,13 +144,18 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_Shaders");
+
             //
             // Load shader manager
             //
 
             LogMessage("Initializing shaders...");
 
-            mShaderManager = ShaderManager<GameShaderSets::ShaderSet>::CreateInstance(assetManager, SimpleProgressCallback::Dummy());
+            mShaderManager = ShaderManager<GameShaderSets::ShaderSet>::CreateInstance(
+                assetManager,
+                renderDeviceProperties.ShaderCacheFolderPath,
+                SimpleProgressCallback::Dummy());
 
             LogMessage("...shaders initialized.");
         });
@@ -144,9 +165,11 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_NoiseTextures");
+
             mGlobalRenderContext = std::make_unique<GlobalRenderContext>(assetManager , *mShaderManager);
 
-            mGlobalRenderContext->InitializeNoiseTextures();
+            mGlobalRenderContext->InitializeNoiseTextures(threadManager.GetSimulationThreadPool());
         });
 
     progressCallback(0.15f, ProgressMessageType::LoadingGenericTextures);
@@ -154,7 +177,11 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
-            mGlobalRenderContext->InitializeGenericTextures();
+            ScopedStartupStage const stage("Render_GenericTextures");
+
+            mGlobalRenderContext->InitializeGenericTextures(
+                threadManager.GetSimulationThreadPool(),
+                renderDeviceProperties.TextureAtlasCacheFolderPath);
         });
 
     progressCallback(0.2f, ProgressMessageType::LoadingExplosionTextureAtlas);
@@ -162,18 +189,24 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_ExplosionTextures");
+
             mGlobalRenderContext->InitializeExplosionTextures();
         });
 
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_NpcTextures");
+
             mGlobalRenderContext->InitializeNpcTextures(std::move(npcTextureAtlas)); // Safe as it's synchronous
         });
 
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_WorldRenderContext");
+
             mWorldRenderContext = std::make_unique<WorldRenderContext>(
                 assetManager,
                 *mShaderManager,
@@ -185,6 +218,8 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_CloudTextures");
+
             mWorldRenderContext->InitializeCloudTextures();
         });
 
@@ -193,7 +228,11 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
-            mWorldRenderContext->InitializeFishTextures();
+            ScopedStartupStage const stage("Render_FishTextures");
+
+            mWorldRenderContext->InitializeFishTextures(
+                threadManager.GetSimulationThreadPool(),
+                renderDeviceProperties.TextureAtlasCacheFolderPath);
         });
 
     progressCallback(0.7f, ProgressMessageType::LoadingWorldTextures);
@@ -201,7 +240,9 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
-            mWorldRenderContext->InitializeWorldTextures();
+            ScopedStartupStage const stage("Render_WorldTextures");
+
+            mWorldRenderContext->InitializeWorldTextures(threadManager.GetSimulationThreadPool());
         });
 
     progressCallback(0.8f, ProgressMessageType::LoadingFonts);
@@ -209,6 +250,8 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_NotificationRenderContext");
+
             //
             // Initialize notification render context
             //
@@ -217,6 +260,21 @@ RenderContext::RenderContext(
                 assetManager,
                 *mShaderManager,
                 *mGlobalRenderContext);
+
+            //
+            // Initialize GPU timing
+            //
+
+            mRenderPassTimer = std::make_unique<RenderPassTimer>();
+
+            //
+            // Initialize interior view rasterizer
+            //
+
+            if (!renderDeviceProperties.DoForceNoGpuInteriorView.value_or(false))
+            {
+                mInteriorViewRasterizer = std::make_unique<InteriorViewRasterizer>(*mShaderManager);
+            }
         });
 
     progressCallback(0.9f, ProgressMessageType::InitializingGraphics);
@@ -224,6 +282,8 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
+            ScopedStartupStage const stage("Render_InitialParameters");
+
             //
             // Set initial values of non-render parameters from which
             // other parameters are calculated
@@ -273,11 +333,7 @@ RenderContext::~RenderContext()
     // (this destructor may only be invoked between two cycles,
     // hence knowing that there's no more render's is enough to ensure
     // nothing is using OpenGL at this moment)
-    if (!!mLastRenderDrawCompletionIndicator)
-    {
-        mLastRenderDrawCompletionIndicator->Wait();
-        mLastRenderDrawCompletionIndicator.reset();
-    }
+    WaitForPendingTasks();
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -371,6 +427,73 @@ void RenderContext::AddShip(
         });
 }
 
+void RenderContext::UpdateShipTextures(
+    ShipId shipId,
+    RgbaImageData exteriorTextureImage,
+    RgbaImageData interiorViewImage)
+{
+    ValidateShipTexture(exteriorTextureImage);
+    ValidateShipTexture(interiorViewImage);
+
+    assert(shipId >= 0 && shipId < mShips.size());
+
+    // Synchronously, as the ship might be rendering now; the upload happens at the next render
+    mRenderThread.RunSynchronously(
+        [&]()
+        {
+            mShips[shipId]->SetViewImages(
+                std::move(exteriorTextureImage),
+                std::move(interiorViewImage));
+        });
+}
+
+void RenderContext::UpdateShipTextures(
+    ShipId shipId,
+    RgbaImageData exteriorTextureImage,
+    RgbaImageData const & interiorTextureImage,
+    std::vector<InteriorViewFloorVertex> const & interiorViewFloorVertices)
+{
+    ValidateShipTexture(exteriorTextureImage);
+    ValidateShipTexture(interiorTextureImage);
+
+    assert(shipId >= 0 && shipId < mShips.size());
+    assert(mInteriorViewRasterizer);
+
+    mRenderThread.RunSynchronously(
+        [&]()
+        {
+            RgbaImageData interiorViewImage = mInteriorViewRasterizer->Rasterize(
+                interiorTextureImage,
+                interiorViewFloorVertices);
+
+#if FS_IS_OS_MACOS()
+            // As after any viewport change
+            mMakeRenderContextCurrentFunction();
+#endif
+
+            mShips[shipId]->SetViewImages(
+                std::move(exteriorTextureImage),
+                std::move(interiorViewImage));
+        });
+
+    // The rasterizer has borrowed the AABBs' ortho matrix
+    mRenderParameters.IsViewDirty = true;
+}
+
+void RenderContext::ReportShipMemory(
+    ShipId shipId,
+    MemoryReport & report)
+{
+    assert(shipId >= 0 && shipId < mShips.size());
+
+    // Synchronously, as the render thread owns the buffers
+    mRenderThread.RunSynchronously(
+        [&]()
+        {
+            mShips[shipId]->ReportMemory(report);
+        });
+}
+
 RgbImageData RenderContext::TakeScreenshot()
 {
     //
@@ -410,21 +533,23 @@ RgbImageData RenderContext::TakeScreenshot()
         std::move(pixelBuffer));
 }
 
-//////////////////////////////////////////////////////////////////////////////////
-
-void RenderContext::UpdateStart()
+std::vector<RgbImageData> RenderContext::PopTakenScreenshots()
 {
-    // If there's a pending RenderUploadEnd, wait for it so we
-    // know that CPU buffers are safe to be used
-    if (!!mLastRenderUploadEndCompletionIndicator)
+    std::vector<RgbImageData> takenScreenshots;
+
     {
-        auto const waitStart = GameChronometer::Now();
+        std::lock_guard<std::mutex> lock(mTakenScreenshotsMutex);
+        std::swap(takenScreenshots, mTakenScreenshots);
+    }
 
-        mLastRenderUploadEndCompletionIndicator->Wait();
-        mLastRenderUploadEndCompletionIndicator.reset();
+    return takenScreenshots;
+}
 
-        mPerfStats.Update<PerfMeasurement::TotalWaitForRenderUpload>(GameChronometer::Now() - waitStart);
-    }
+//////////////////////////////////////////////////////////////////////////////////
+
+void RenderContext::UpdateStart()
+{
+    // Nop
 }
 
 void RenderContext::UpdateEnd()
@@ -436,25 +561,45 @@ void RenderContext::UpdateEnd()
 
 void RenderContext::RenderStart()
 {
-    // Cleanup an eventual pending RenderUploadEnd - may be left behind if
-    // this cycle did not do an Update
-    mLastRenderUploadEndCompletionIndicator.reset();
+    // Nop
 }
 
 void RenderContext::UploadStart()
 {
     // Wait for an eventual pending RenderDraw, so that we know
-    // GPU buffers are free to be used
+    // GPU buffers are free to be used; we do not wait for its
+    // buffer swap, which only involves the driver and thus may
+    // overlap with this upload
     if (!!mLastRenderDrawCompletionIndicator)
     {
         auto const waitStart = GameChronometer::Now();
 
-        mLastRenderDrawCompletionIndicator->Wait();
+        mLastRenderDrawCompletionIndicator.Wait();
         mLastRenderDrawCompletionIndicator.reset();
 
         mPerfStats.Update<PerfMeasurement::TotalWaitForRenderDraw>(GameChronometer::Now() - waitStart);
     }
 
+    // The swap of the iteration before has run before that draw,
+    // hence this doesn't block - and it surfaces its eventual exceptions
+    if (!!mPreviousRenderSwapCompletionIndicator)
+    {
+        mPreviousRenderSwapCompletionIndicator.Wait();
+        mPreviousRenderSwapCompletionIndicator.reset();
+    }
+
+    // Wait for the eventual pending asynchronous uploads, so that we know
+    // their staging buffer is free to be used; these normally run before
+    // the draw, hence this doesn't block
+    if (!!mLastRenderUploadEndCompletionIndicator)
+    {
+        mLastRenderUploadEndCompletionIndicator.Wait();
+        mLastRenderUploadEndCompletionIndicator.reset();
+    }
+
+    assert(mAsyncUploadCommands.IsEmpty());
+    mAsyncUploadStagingBuffer.clear();
+
     mWorldRenderContext->UploadStart();
 
     mNotificationRenderContext->UploadStart();
@@ -466,15 +611,30 @@ void RenderContext::UploadEnd()
 
     mNotificationRenderContext->UploadEnd();
 
-    // Queue an indicator here, so we may wait for it
-    // when we want to touch CPU buffers again
+    // Run the asynchronous uploads, and remember we have
+    // to wait for them before staging again
     assert(!mLastRenderUploadEndCompletionIndicator);
-    mLastRenderUploadEndCompletionIndicator = mRenderThread.QueueSynchronizationPoint();
+    mLastRenderUploadEndCompletionIndicator = mRenderThread.QueueTask(
+        [this]()
+        {
+            RunAsyncUploads();
+        });
 }
 
 void RenderContext::Draw()
 {
     assert(!mLastRenderDrawCompletionIndicator);
+    assert(!mPreviousRenderSwapCompletionIndicator);
+
+    // Take the screenshot request now, as the canvas might change size later
+    std::optional<ImageSize> screenshotSize;
+    if (mIsScreenshotRequested)
+    {
+        auto const canvasPhysicalSize = mRenderParameters.View.GetCanvasPhysicalSize();
+        screenshotSize = ImageSize(canvasPhysicalSize.width, canvasPhysicalSize.height);
+
+        mIsScreenshotRequested = false;
+    }
 
     // Render asynchronously; we will wait for this render to complete
     // when we want to touch GPU buffers again.
@@ -484,6 +644,7 @@ void RenderContext::Draw()
         [this, renderParameters = mRenderParameters.TakeSnapshotAndClear(), lampToolToSet = mLampToolToSet]() mutable
         {
             auto const startTime = GameChronometer::Now();
+            mLastRenderDrawStartTime = startTime;
 
             RenderStatistics renderStats;
 
@@ -528,7 +689,10 @@ void RenderContext::Draw()
 
                 for (auto const & ship : mShips)
                 {
-                    ship->RenderPrepare(renderParameters);
+                    if (ship->IsVisible())
+                    {
+                        ship->RenderPrepare(renderParameters);
+                    }
                 }
 
                 mWorldRenderContext->RenderPrepareOceanFloor(renderParameters);
@@ -556,6 +720,10 @@ void RenderContext::Draw()
             //
 
             {
+                mRenderPassTimer->BeginFrame();
+
+                mRenderPassTimer->BeginPass(RenderStatistics::RenderPassType::Background);
+
                 mWorldRenderContext->RenderDrawSky(renderParameters); // Acts as canvas clear
 
                 mWorldRenderContext->RenderDrawStars(renderParameters);
@@ -565,15 +733,26 @@ void RenderContext::Draw()
                 // Render ocean opaquely, over sky
                 mWorldRenderContext->RenderDrawOcean(true, renderParameters);
 
+                mRenderPassTimer->EndPass();
+
+                mRenderPassTimer->BeginPass(RenderStatistics::RenderPassType::Ships);
+
                 glEnable(GL_DEPTH_TEST); // Required by ships
 
                 for (auto const & ship : mShips)
                 {
-                    ship->RenderDraw(renderParameters, renderStats);
+                    if (ship->IsVisible())
+                    {
+                        ship->RenderDraw(renderParameters, renderStats);
+                    }
                 }
 
                 glDisable(GL_DEPTH_TEST);
 
+                mRenderPassTimer->EndPass();
+
+                mRenderPassTimer->BeginPass(RenderStatistics::RenderPassType::Foreground);
+
                 mWorldRenderContext->RenderDrawOceanFloor(renderParameters);
 
                 mWorldRenderContext->RenderDrawFishes(renderParameters);
@@ -596,12 +775,40 @@ void RenderContext::Draw()
 
                 mWorldRenderContext->RenderDrawWorldBorder(renderParameters);
 
+                mRenderPassTimer->EndPass();
+
+                mRenderPassTimer->BeginPass(RenderStatistics::RenderPassType::Notifications);
+
                 mNotificationRenderContext->RenderDraw();
+
+                mRenderPassTimer->EndPass();
+
+                mRenderPassTimer->EndFrame();
             }
 
-            //
-            // Wrap up
-            //
+            // Update stats
+            renderStats.LastGpuPassMilliseconds = mRenderPassTimer->GetLastPassMilliseconds();
+            mRenderStats.store(renderStats);
+        });
+
+    //
+    // Swap asynchronously, as a separate task: this is where the driver
+    // blocks when it's got enough frames queued (e.g. vsync), and nothing
+    // it does touches our buffers, so the next upload needn't wait for it.
+    //
+    // Tasks run serially, hence the next draw still runs after this swap,
+    // and we never have more than two frames in flight
+    //
+
+    mPreviousRenderSwapCompletionIndicator = std::move(mLastRenderSwapCompletionIndicator);
+    mLastRenderSwapCompletionIndicator = mRenderThread.QueueTask(
+        [this, screenshotSize]()
+        {
+            if (screenshotSize.has_value())
+            {
+                // Read the back buffer while it's still defined
+                StartScreenshotReadback(*screenshotSize);
+            }
 
             if (mDoInvokeGlFinish)
             {
@@ -612,9 +819,14 @@ void RenderContext::Draw()
             // Flip the back buffer onto the screen
             mSwapRenderBuffersFunction();
 
+            // Collect the readbacks that are ready
+            if (!mPendingScreenshotReadbacks.empty())
+            {
+                CompleteScreenshotReadbacks(false);
+            }
+
             // Update stats
-            mPerfStats.Update<PerfMeasurement::TotalRenderDraw>(GameChronometer::Now() - startTime);
-            mRenderStats.store(renderStats);
+            mPerfStats.Update<PerfMeasurement::TotalRenderDraw>(GameChronometer::Now() - mLastRenderDrawStartTime);
         });
 
     //
@@ -633,9 +845,267 @@ void RenderContext::WaitForPendingTasks()
 {
     if (!!mLastRenderDrawCompletionIndicator)
     {
-        mLastRenderDrawCompletionIndicator->Wait();
+        mLastRenderDrawCompletionIndicator.Wait();
         mLastRenderDrawCompletionIndicator.reset();
     }
+
+    if (!!mPreviousRenderSwapCompletionIndicator)
+    {
+        mPreviousRenderSwapCompletionIndicator.Wait();
+        mPreviousRenderSwapCompletionIndicator.reset();
+    }
+
+    if (!!mLastRenderSwapCompletionIndicator)
+    {
+        mLastRenderSwapCompletionIndicator.Wait();
+        mLastRenderSwapCompletionIndicator.reset();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+void RenderContext::StartScreenshotReadback(ImageSize const & size)
+{
+    // We've been invoked on the render thread
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    CheckOpenGLError();
+
+    glReadBuffer(GL_BACK);
+    CheckOpenGLError();
+
+    if (!GameOpenGL::SupportsAsyncReadback)
+    {
+        //
+        // Read synchronously
+        //
+
+        auto pixelBuffer = std::make_unique<rgbColor[]>(size.GetLinearSize());
+
+        glReadPixels(0, 0, size.width, size.height, GL_RGB, GL_UNSIGNED_BYTE, pixelBuffer.get());
+        CheckOpenGLError();
+
+        std::lock_guard<std::mutex> lock(mTakenScreenshotsMutex);
+        mTakenScreenshots.emplace_back(size, std::move(pixelBuffer));
+
+        return;
+    }
+
+    // Keep our memory bounded when the GPU lags behind
+    if (mPendingScreenshotReadbacks.size() >= MaxPendingScreenshotReadbacks)
+    {
+        CompleteScreenshotReadbacks(true);
+    }
+
+    //
+    // Read into a pixel buffer, which returns immediately
+    //
+
+    GameOpenGLVBO pixelBuffer;
+    if (!mFreeScreenshotPixelBuffers.empty())
+    {
+        pixelBuffer = std::move(mFreeScreenshotPixelBuffers.back());
+        mFreeScreenshotPixelBuffers.pop_back();
+    }
+    else
+    {
+        GLuint tmpGLuint;
+        glGenBuffers(1, &tmpGLuint);
+        pixelBuffer = tmpGLuint;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, *pixelBuffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size.GetLinearSize() * sizeof(rgbColor), nullptr, GL_STREAM_READ);
+    CheckOpenGLError();
+
+    glReadPixels(0, 0, size.width, size.height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    CheckOpenGLError();
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    GameOpenGLSync fence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    CheckOpenGLError();
+
+    mPendingScreenshotReadbacks.emplace_back(
+        size,
+        std::move(pixelBuffer),
+        std::move(fence));
+}
+
+void RenderContext::CompleteScreenshotReadbacks(bool doWaitForOldest)
+{
+    // We've been invoked on the render thread
+
+    while (!mPendingScreenshotReadbacks.empty())
+    {
+        auto & readback = mPendingScreenshotReadbacks.front();
+
+        // Readbacks complete in order, hence we stop at the first one that's not ready
+        GLuint64 const timeout = doWaitForOldest
+            ? std::numeric_limits<GLuint64>::max()
+            : 0;
+        GLenum const waitResult = glClientWaitSync(*readback.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (waitResult == GL_TIMEOUT_EXPIRED)
+        {
+            break;
+        }
+        else if (waitResult == GL_WAIT_FAILED)
+        {
+            throw GameException("Cannot wait for screenshot readback");
+        }
+
+        doWaitForOldest = false;
+
+        //
+        // Copy pixels out of the pixel buffer
+        //
+
+        auto pixelBuffer = std::make_unique<rgbColor[]>(readback.Size.GetLinearSize());
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, *readback.PixelBuffer);
+
+        void const * const mappedBuffer = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        CheckOpenGLError();
+        if (mappedBuffer == nullptr)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            throw GameException("glMapBuffer returned null pointer");
+        }
+
+        std::memcpy(pixelBuffer.get(), mappedBuffer, readback.Size.GetLinearSize() * sizeof(rgbColor));
+
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        {
+            std::lock_guard<std::mutex> lock(mTakenScreenshotsMutex);
+            mTakenScreenshots.emplace_back(readback.Size, std::move(pixelBuffer));
+        }
+
+        //
+        // Recycle
+        //
+
+        mFreeScreenshotPixelBuffers.emplace_back(std::move(readback.PixelBuffer));
+        mPendingScreenshotReadbacks.pop_front();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+void RenderContext::QueueAsyncUpload(
+    AsyncUploadCommand::KindType kind,
+    ShipId shipId,
+    float const * data,
+    size_t floatCount,
+    size_t startDst,
+    size_t count)
+{
+    //
+    // Stage data
+    //
+    // Note: the render thread never reads the staging buffer while we're here
+    //
+
+    AsyncUploadCommand const command{
+        kind,
+        shipId,
+        mAsyncUploadStagingBuffer.size(),
+        startDst,
+        count };
+
+    mAsyncUploadStagingBuffer.insert(
+        mAsyncUploadStagingBuffer.end(),
+        data,
+        data + floatCount);
+
+    //
+    // Queue command
+    //
+
+    while (!mAsyncUploadCommands.TryPush(command))
+    {
+        // Full: run the uploads queued so far, to make room
+        mRenderThread.RunSynchronously(
+            [this]()
+            {
+                RunAsyncUploads();
+            });
+    }
+}
+
+void RenderContext::RunAsyncUploads()
+{
+    // We've been invoked on the render thread
+
+    static_assert(sizeof(vec4f) == 4 * sizeof(float));
+    static_assert(sizeof(ColorWithProgress) == 4 * sizeof(float));
+
+    AsyncUploadCommand command;
+    while (mAsyncUploadCommands.TryPop(command))
+    {
+        float const * const data = mAsyncUploadStagingBuffer.data() + command.StagingOffset;
+
+        switch (command.Kind)
+        {
+            case AsyncUploadCommand::KindType::ShipPointColors:
+            {
+                mShips[command.Ship]->UploadPointColors(
+                    reinterpret_cast<vec4f const *>(data),
+                    command.StartDst,
+                    command.Count);
+
+                break;
+            }
+
+            case AsyncUploadCommand::KindType::ShipPointTemperature:
+            {
+                mShips[command.Ship]->UploadPointTemperature(
+                    data,
+                    command.StartDst,
+                    command.Count);
+
+                break;
+            }
+
+            case AsyncUploadCommand::KindType::ShipPointStress:
+            {
+                mShips[command.Ship]->UploadPointStress(
+                    data,
+                    command.StartDst,
+                    command.Count);
+
+                break;
+            }
+
+            case AsyncUploadCommand::KindType::ShipPointAuxiliaryData:
+            {
+                mShips[command.Ship]->UploadPointAuxiliaryData(
+                    data,
+                    command.StartDst,
+                    command.Count);
+
+                break;
+            }
+
+            case AsyncUploadCommand::KindType::ShipPointFrontierColors:
+            {
+                mShips[command.Ship]->UploadPointFrontierColors(
+                    reinterpret_cast<ColorWithProgress const *>(data));
+
+                break;
+            }
+
+            case AsyncUploadCommand::KindType::CloudShadows:
+            {
+                mWorldRenderContext->UploadCloudShadows(
+                    data,
+                    command.Count);
+
+                break;
+            }
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -8,9 +8,11 @@
 #include "GameShaderSets.h"
 #include "GameTextureDatabases.h"
 #include "GlobalRenderContext.h"
+#include "InteriorViewRasterizer.h"
 #include "NotificationRenderContext.h"
 #include "RenderDeviceProperties.h"
 #include "RenderParameters.h"
+#include "RenderPassTimer.h"
 #include "ShipRenderContext.h"
 #include "WorldRenderContext.h"
 
@@ -19,12 +21,14 @@
 
 #include <Core/AABB.h>
 #include <Core/Colors.h>
+#include <Core/GameChronometer.h>
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
 #include <Core/PerfStats.h>
 #include <Core/ProgressCallback.h>
 #include <Core/RunningAverage.h>
+#include <Core/SpscRingBuffer.h>
 #include <Core/SysSpecifics.h>
 #include <Core/TaskThread.h>
 #include <Core/TextureAtlas.h>
@@ -34,7 +38,10 @@
 #include <array>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -812,6 +819,41 @@ public:
         RgbaImageData exteriorTextureImage,
         RgbaImageData interiorViewImage);
 
+    /*
+     * Replaces the textures of a ship, e.g. when its placeholder textures give way to the full ones.
+     */
+    void UpdateShipTextures(
+        ShipId shipId,
+        RgbaImageData exteriorTextureImage,
+        RgbaImageData interiorViewImage);
+
+    /*
+     * The largest interior view that may be made on the GPU - i.e. drawing its floors onto the
+     * interior texture - if any.
+     */
+    std::optional<ImageSize> GetMaxGpuInteriorViewSize() const
+    {
+        if (!mInteriorViewRasterizer)
+        {
+            return std::nullopt;
+        }
+
+        return InteriorViewRasterizer::GetMaxSize();
+    }
+
+    /*
+     * As above, but making the interior view on the GPU.
+     */
+    void UpdateShipTextures(
+        ShipId shipId,
+        RgbaImageData exteriorTextureImage,
+        RgbaImageData const & interiorTextureImage,
+        std::vector<InteriorViewFloorVertex> const & interiorViewFloorVertices);
+
+    void ReportShipMemory(
+        ShipId shipId,
+        MemoryReport & report);
+
     inline ShipRenderContext & GetShipRenderContext(ShipId shipId) const
     {
         assert(shipId >= 0 && shipId < mShips.size());
@@ -828,6 +870,22 @@ public:
 
     RgbImageData TakeScreenshot();
 
+    /*
+     * Requests a screenshot of the next drawn frame, without stalling on its
+     * readback; the screenshot becomes available via PopTakenScreenshots()
+     * a few frames later.
+     */
+    void RequestScreenshot()
+    {
+        mIsScreenshotRequested = true;
+    }
+
+    /*
+     * Returns the requested screenshots that have been taken since the last
+     * invocation, in the order they were requested.
+     */
+    std::vector<RgbImageData> PopTakenScreenshots();
+
 public:
 
     void UpdateStart();
@@ -957,18 +1015,19 @@ public:
         mWorldRenderContext->UploadCloudsEnd();
     }
 
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadCloudShadows(
         float const * shadowBuffer,
         size_t shadowSampleCount)
     {
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mWorldRenderContext->UploadCloudShadows(
-                    shadowBuffer,
-                    shadowSampleCount);
-            });
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::CloudShadows,
+            NoneShipId,
+            shadowBuffer,
+            shadowSampleCount,
+            0,
+            shadowSampleCount);
     }
 
     inline void UploadLandStart(size_t slices)
@@ -1113,8 +1172,8 @@ public:
         // Nop
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadShipPointColorsAsync(
         ShipId shipId,
         vec4f const * color,
@@ -1123,19 +1182,17 @@ public:
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointColors(
-                    color,
-                    startDst,
-                    count);
-            });
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::ShipPointColors,
+            shipId,
+            reinterpret_cast<float const *>(color),
+            count * 4,
+            startDst,
+            count);
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadShipPointTemperatureAsync(
         ShipId shipId,
         float const * temperature,
@@ -1144,19 +1201,17 @@ public:
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointTemperature(
-                    temperature,
-                    startDst,
-                    count);
-            });
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::ShipPointTemperature,
+            shipId,
+            temperature,
+            count,
+            startDst,
+            count);
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadShipPointStressAsync(
         ShipId shipId,
         float const * stress,
@@ -1165,19 +1220,17 @@ public:
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointStress(
-                    stress,
-                    startDst,
-                    count);
-            });
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::ShipPointStress,
+            shipId,
+            stress,
+            count,
+            startDst,
+            count);
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadShipPointAuxiliaryDataAsync(
         ShipId shipId,
         float const * auxiliaryData,
@@ -1186,31 +1239,32 @@ public:
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointAuxiliaryData(
-                    auxiliaryData,
-                    startDst,
-                    count);
-            });
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::ShipPointAuxiliaryData,
+            shipId,
+            auxiliaryData,
+            count,
+            startDst,
+            count);
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
+    // Upload is Asynchronous - but data is copied, hence buffer
+    // may be used right away
     inline void UploadShipPointFrontierColorsAsync(
         ShipId shipId,
         ColorWithProgress const * colors)
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointFrontierColors(colors);
-            });
+        size_t const pointCount = mShips[shipId]->GetPointCount();
+
+        QueueAsyncUpload(
+            AsyncUploadCommand::KindType::ShipPointFrontierColors,
+            shipId,
+            reinterpret_cast<float const *>(colors),
+            pointCount * 4,
+            0,
+            pointCount);
     }
 
     inline void UploadShipsEnd()
@@ -1261,6 +1315,49 @@ private:
 
     vec3f CalculateShipWaterColor() const;
 
+    //
+    // Asynchronous uploads
+    //
+    // Uploads that run on the render thread, of data which is copied at the moment
+    // of the upload call into a staging buffer, so that callers may modify their
+    // buffers right away - e.g. the simulation may start its next step while the
+    // render thread is still consuming these uploads
+    //
+
+    struct AsyncUploadCommand
+    {
+        enum class KindType : std::uint8_t
+        {
+            ShipPointColors,
+            ShipPointTemperature,
+            ShipPointStress,
+            ShipPointAuxiliaryData,
+            ShipPointFrontierColors,
+            CloudShadows
+        };
+
+        KindType Kind;
+        ShipId Ship;
+        size_t StagingOffset; // In floats
+        size_t StartDst;
+        size_t Count;
+    };
+
+    void StartScreenshotReadback(ImageSize const & size);
+
+    void CompleteScreenshotReadbacks(bool doWaitForOldest);
+
+    void QueueAsyncUpload(
+        AsyncUploadCommand::KindType kind,
+        ShipId shipId,
+        float const * data,
+        size_t floatCount,
+        size_t startDst,
+        size_t count);
+
+    // Invoked on the render thread
+    void RunAsyncUploads();
+
 private:
 
     //
@@ -1281,6 +1378,59 @@ private:
     TaskThread::TaskCompletionIndicator mLastRenderUploadEndCompletionIndicator;
     TaskThread::TaskCompletionIndicator mLastRenderDrawCompletionIndicator;
 
+    // The asynchronous buffer swaps of the last two iterations; the swap of
+    // the last iteration may still be running while we upload the next one,
+    // and it's only ever waited for once the next draw has completed
+    TaskThread::TaskCompletionIndicator mLastRenderSwapCompletionIndicator;
+    TaskThread::TaskCompletionIndicator mPreviousRenderSwapCompletionIndicator;
+
+    // When the last draw started, for the swap to complete its stats;
+    // only accessed by the render thread
+    GameChronometer::time_point mLastRenderDrawStartTime;
+
+    //
+    // Screenshots
+    //
+
+    // The readback of a requested screenshot, pending on the GPU
+    struct ScreenshotReadback
+    {
+        ImageSize Size;
+        GameOpenGLVBO PixelBuffer;
+        GameOpenGLSync Fence;
+
+        ScreenshotReadback(
+            ImageSize const & size,
+            GameOpenGLVBO && pixelBuffer,
+            GameOpenGLSync && fence)
+            : Size(size)
+            , PixelBuffer(std::move(pixelBuffer))
+            , Fence(std::move(fence))
+        {}
+    };
+
+    // How many readbacks may be pending before we wait for the oldest
+    static size_t constexpr MaxPendingScreenshotReadbacks = 3;
+
+    // Whether the main thread wants a screenshot of the next drawn frame
+    bool mIsScreenshotRequested;
+
+    // Only accessed by the render thread; pixel buffers are recycled
+    std::deque<ScreenshotReadback> mPendingScreenshotReadbacks;
+    std::vector<GameOpenGLVBO> mFreeScreenshotPixelBuffers;
+
+    // Produced by the render thread and consumed by the main thread
+    std::vector<RgbImageData> mTakenScreenshots;
+    std::mutex mTakenScreenshotsMutex;
+
+    // The asynchronous uploads of the current iteration, produced by the main
+    // thread and consumed by the render thread
+    SpscRingBuffer<AsyncUploadCommand, 256> mAsyncUploadCommands;
+
+    // The data of the asynchronous uploads of the current iteration; it's
+    // only (re)allocated while the render thread is not consuming it
+    std::vector<float> mAsyncUploadStagingBuffer;
+
     //
     // Shader manager
     //
@@ -1295,6 +1445,7 @@ private:
     std::unique_ptr<WorldRenderContext> mWorldRenderContext;
     std::vector<std::unique_ptr<ShipRenderContext>> mShips;
     std::unique_ptr<NotificationRenderContext> mNotificationRenderContext;
+    std::unique_ptr<InteriorViewRasterizer> mInteriorViewRasterizer; // Unless forced off
 
     //
     // Storage for externally-controlled parameters that only affect Upload (i.e.
@@ -1346,4 +1497,5 @@ private:
 
     PerfStats & mPerfStats;
     std::atomic<RenderStatistics> mRenderStats;
+    std::unique_ptr<RenderPassTimer> mRenderPassTimer;
 };
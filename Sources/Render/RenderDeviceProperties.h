@@ -8,6 +8,7 @@
 #include <Core/GameTypes.h>
 
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <optional>
 
@@ -18,6 +19,10 @@ struct RenderDeviceProperties
 
     std::optional<bool> DoForceNoGlFinish;
     std::optional<bool> DoForceNoMultithreadedRendering;
+    std::optional<bool> DoForceNoGpuInteriorView; // When set, ships' interior views are made on the CPU
+
+    std::optional<std::filesystem::path> ShaderCacheFolderPath; // Where to cache linked shader programs, if anywhere
+    std::optional<std::filesystem::path> TextureAtlasCacheFolderPath; // Where to cache atlases built at runtime, if anywhere
 
     std::function<void()> MakeRenderContextCurrentFunction;
     std::function<void()> SwapRenderBuffersFunction;
@@ -27,12 +32,18 @@ struct RenderDeviceProperties
         int logicalToPhysicalDisplayFactor,
         std::optional<bool> doForceNoGlFinish,
         std::optional<bool> doForceNoMultithreadedRendering,
+        std::optional<bool> doForceNoGpuInteriorView,
+        std::optional<std::filesystem::path> shaderCacheFolderPath,
+        std::optional<std::filesystem::path> textureAtlasCacheFolderPath,
         std::function<void()> makeRenderContextCurrentFunction,
         std::function<void()> swapRenderBuffersFunction)
         : InitialCanvasSize(initialCanvasSize)
         , LogicalToPhysicalDisplayFactor(logicalToPhysicalDisplayFactor)
         , DoForceNoGlFinish(doForceNoGlFinish)
         , DoForceNoMultithreadedRendering(doForceNoMultithreadedRendering)
+        , DoForceNoGpuInteriorView(doForceNoGpuInteriorView)
+        , ShaderCacheFolderPath(std::move(shaderCacheFolderPath))
+        , TextureAtlasCacheFolderPath(std::move(textureAtlasCacheFolderPath))
         , MakeRenderContextCurrentFunction(std::move(makeRenderContextCurrentFunction))
         , SwapRenderBuffersFunction(std::move(swapRenderBuffersFunction))
     {}
@@ -0,0 +1,110 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "RenderPassTimer.h"
+
+#include <cassert>
+
+RenderPassTimer::RenderPassTimer()
+    : mIsEnabled(GameOpenGL::SupportsTimerQueries)
+    , mQueries()
+    , mIsQueryPending()
+    , mCurrentQuerySet(0)
+    , mIsPassOpen(false)
+    , mLastPassMilliseconds()
+{
+    mLastPassMilliseconds.fill(0.0f);
+
+    for (auto & querySet : mIsQueryPending)
+    {
+        querySet.fill(false);
+    }
+
+    if (mIsEnabled)
+    {
+        for (auto & querySet : mQueries)
+        {
+            std::array<GLuint, RenderStatistics::RenderPassCount> tmpGLuints;
+            glGenQueries(static_cast<GLsizei>(RenderStatistics::RenderPassCount), tmpGLuints.data());
+            CheckOpenGLError();
+
+            for (size_t p = 0; p < RenderStatistics::RenderPassCount; ++p)
+            {
+                querySet[p] = tmpGLuints[p];
+            }
+        }
+    }
+}
+
+void RenderPassTimer::BeginFrame()
+{
+    if (!mIsEnabled)
+    {
+        return;
+    }
+
+    auto & querySet = mQueries[mCurrentQuerySet];
+    auto & isQueryPending = mIsQueryPending[mCurrentQuerySet];
+
+    for (size_t p = 0; p < RenderStatistics::RenderPassCount; ++p)
+    {
+        if (isQueryPending[p])
+        {
+            GLint isAvailable = GL_FALSE;
+            glGetQueryObjectiv(*querySet[p], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+            if (isAvailable == GL_TRUE)
+            {
+                GLuint64 elapsedNanoseconds = 0;
+                glGetQueryObjectui64v(*querySet[p], GL_QUERY_RESULT, &elapsedNanoseconds);
+
+                mLastPassMilliseconds[p] = static_cast<float>(elapsedNanoseconds) / 1000000.0f;
+            }
+
+            // Either way, the query is going to be reused for this frame
+            isQueryPending[p] = false;
+        }
+    }
+}
+
+void RenderPassTimer::BeginPass(RenderStatistics::RenderPassType pass)
+{
+    if (!mIsEnabled)
+    {
+        return;
+    }
+
+    assert(!mIsPassOpen);
+
+    size_t const p = static_cast<size_t>(pass);
+
+    glBeginQuery(GL_TIME_ELAPSED, *mQueries[mCurrentQuerySet][p]);
+    mIsQueryPending[mCurrentQuerySet][p] = true;
+    mIsPassOpen = true;
+}
+
+void RenderPassTimer::EndPass()
+{
+    if (!mIsEnabled)
+    {
+        return;
+    }
+
+    assert(mIsPassOpen);
+
+    glEndQuery(GL_TIME_ELAPSED);
+    mIsPassOpen = false;
+}
+
+void RenderPassTimer::EndFrame()
+{
+    if (!mIsEnabled)
+    {
+        return;
+    }
+
+    assert(!mIsPassOpen);
+
+    mCurrentQuerySet = (mCurrentQuerySet + 1) % QuerySetCount;
+}
@@ -0,0 +1,59 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "RenderStatistics.h"
+
+#include <OpenGLCore/GameOpenGL.h>
+
+#include <array>
+#include <cstddef>
+
+/*
+ * Measures the GPU time of each render pass, via GL_TIME_ELAPSED queries.
+ *
+ * Queries are double-buffered: the results of a frame's queries are collected two frames later,
+ * when the GPU has long finished with them, and only if they are available, so that we never stall
+ * waiting for the GPU.
+ *
+ * Does nothing when timer queries are not supported. To be used on the render thread only.
+ */
+class RenderPassTimer final
+{
+public:
+
+    RenderPassTimer();
+
+    /*
+     * Collects the results of the frame that last used this frame's queries.
+     */
+    void BeginFrame();
+
+    void BeginPass(RenderStatistics::RenderPassType pass);
+
+    void EndPass();
+
+    void EndFrame();
+
+    std::array<float, RenderStatistics::RenderPassCount> const & GetLastPassMilliseconds() const
+    {
+        return mLastPassMilliseconds;
+    }
+
+private:
+
+    static size_t constexpr QuerySetCount = 2;
+
+    bool const mIsEnabled;
+
+    std::array<std::array<GameOpenGLQuery, RenderStatistics::RenderPassCount>, QuerySetCount> mQueries;
+    std::array<std::array<bool, RenderStatistics::RenderPassCount>, QuerySetCount> mIsQueryPending;
+    size_t mCurrentQuerySet;
+
+    bool mIsPassOpen;
+
+    std::array<float, RenderStatistics::RenderPassCount> mLastPassMilliseconds;
+};
@@ -5,10 +5,38 @@
 ***************************************************************************************/
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 struct RenderStatistics
 {
+    // The render passes whose GPU time we measure
+    enum class RenderPassType : std::size_t
+    {
+        Background = 0, // Sky, stars, clouds, and opaque ocean
+        Ships,
+        Foreground, // Ocean floor, fishes, and everything else drawn over the world
+        Notifications,
+
+        _Last = Notifications
+    };
+
+    static size_t constexpr RenderPassCount = static_cast<size_t>(RenderPassType::_Last) + 1;
+
+    // The kinds of buffers whose uploads we count
+    enum class UploadKindType : std::size_t
+    {
+        ShipPoints = 0, // Point attributes
+        ShipElements, // Element indices
+        ShipNpcs,
+        ShipEffects, // Flames, sparks, explosions, textures, highlights, and debug overlays
+
+        _Last = ShipEffects
+    };
+
+    static size_t constexpr UploadKindCount = static_cast<size_t>(UploadKindType::_Last) + 1;
+
     std::uint64_t LastRenderedShipPoints;
     std::uint64_t LastRenderedShipRopes;
     std::uint64_t LastRenderedShipSprings;
@@ -17,6 +45,12 @@ struct RenderStatistics
     std::uint64_t LastRenderedShipFlames;
     std::uint64_t LastRenderedShipGenericMipMappedTextures;
 
+    std::uint64_t LastShipDrawCalls;
+    std::array<std::uint64_t, UploadKindCount> LastUploadedBytes;
+
+    // Of the latest frame whose timings are available; zero when timer queries are not supported
+    std::array<float, RenderPassCount> LastGpuPassMilliseconds;
+
     RenderStatistics() noexcept
     {
         Reset();
@@ -31,5 +65,10 @@ struct RenderStatistics
         LastRenderedShipPlanes = 0;
         LastRenderedShipFlames = 0;
         LastRenderedShipGenericMipMappedTextures = 0;
+
+        LastShipDrawCalls = 0;
+        LastUploadedBytes.fill(0);
+
+        LastGpuPassMilliseconds.fill(0.0f);
     }
-};
\ No newline at end of file
+};
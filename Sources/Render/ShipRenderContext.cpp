@@ -33,14 +33,21 @@ ShipRenderContext::ShipRenderContext(
     , mShipCount(shipCount)
     , mMaxMaxPlaneId(0)
     , mIsViewModelDirty(false)
+    , mIsVisible(true)
     // Buffers
     , mPointAttributeGroup1Buffer()
     , mPointAttributeGroup1VBO()
     , mPointAttributeGroup2Buffer()
     , mPointAttributeGroup2VBO()
+    , mIsPointAttributeStreamPersistent(GameOpenGL::SupportsPersistentMapping)
+    , mPointAttributeGroup1StreamBuffer()
+    , mPointAttributeGroup2StreamBuffer()
+    , mPointAttributeStreamDrawRegion(0)
+    , mPointAttributeStreamUploadedRegion()
     , mPointColorVBO()
     , mPointTemperatureVBO()
     , mPointStressVBO()
+    , mPointStressPackingBuffer()
     , mPointAuxiliaryDataVBO()
     , mPointFrontierColorVBO()
     //
@@ -57,9 +64,11 @@ ShipRenderContext::ShipRenderContext(
     , mNpcPositionVBO()
     , mNpcPositionVBOAllocatedVertexSize(0)
     , mNpcAttributesVertexBuffer()
+    , mNpcAttributesVertexUploadedBuffer()
     , mNpcAttributesVertexVBO()
     , mNpcAttributesVertexVBOAllocatedVertexSize(0)
     , mNpcQuadRoleVertexBuffer()
+    , mNpcQuadRoleVertexUploadedBuffer()
     , mNpcQuadRoleVertexVBO()
     , mNpcQuadRoleVertexVBOAllocatedVertexSize(0)
     //
@@ -93,6 +102,9 @@ ShipRenderContext::ShipRenderContext(
     , mGenericMipMappedTextureVBOAllocatedVertexSize(0u)
     //
     , mHighlightVertexBuffers()
+    , mHighlightVBOVertexBuffer()
+    , mHighlightVBOVertexOffsets()
+    , mHighlightVBOUploadedVertexBuffer()
     , mHighlightVBO()
     , mHighlightVBOAllocatedVertexSize(0u)
     //
@@ -117,9 +129,11 @@ ShipRenderContext::ShipRenderContext(
     , mSpringElementBuffer()
     , mRopeElementBuffer()
     , mTriangleElementBuffer()
+    , mTriangleElementTombstoneCount(0)
     , mAreElementBuffersDirty(true)
     , mElementVBO()
     , mElementVBOAllocatedIndexSize(0u)
+    , mElementVBOUploadedBuffer()
     , mPointElementVBOStartIndex(0)
     , mEphemeralPointElementVBOStartIndex(0)
     , mSpringElementVBOStartIndex(0)
@@ -143,9 +157,15 @@ ShipRenderContext::ShipRenderContext(
     , mShipRopesProgram(GameShaderSets::ProgramKind::ShipRopes) // Will be recalculated
     , mShipSpringsProgram(GameShaderSets::ProgramKind::ShipSpringsColor) // Will be recalculated
     , mShipTrianglesProgram(GameShaderSets::ProgramKind::ShipTrianglesColor) // Will be recalculated
+    , mShipPointsDrawProgram() // Will be recalculated
+    , mShipRopesDrawProgram() // Will be recalculated
+    , mShipSpringsDrawProgram() // Will be recalculated
+    , mShipTrianglesDrawProgram() // Will be recalculated
+    , mIsWireframe(false) // Will be recalculated
     // Textures
     , mExteriorViewImage(std::move(exteriorViewImage))
     , mInteriorViewImage(std::move(interiorViewImage))
+    , mIsShipTextureDirty(false)
     , mShipViewModeType(ShipViewModeType::Exterior) // Will be recalculated
     , mShipTextureOpenGLHandle()
     , mStressedSpringTextureOpenGLHandle()
@@ -160,6 +180,8 @@ ShipRenderContext::ShipRenderContext(
     , mNpcFlameHalfQuadWidth(BasisNpcFlameHalfQuadWidth) // No adjustment at the time of writing
     , mNpcFlameQuadHeight(BasisNpcFlameQuadHeight) // No adjustment at the time of writing
     , mVectorFieldLengthMultiplier(0.0f)
+    , mUploadedBytes()
+    , mDrawCallCount(0)
 {
     GLuint tmpGLuint;
 
@@ -177,7 +199,18 @@ ShipRenderContext::ShipRenderContext(
 
     mPointAttributeGroup1VBO = vbos[0];
     glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup1VBO);
-    glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+    if (mIsPointAttributeStreamPersistent)
+    {
+        mPointAttributeGroup1StreamBuffer.allocate_and_map(pointCount);
+        std::fill(
+            mPointAttributeGroup1StreamBuffer.region_data(0),
+            mPointAttributeGroup1StreamBuffer.region_data(0) + pointCount * PointAttributeStreamRegionCount,
+            vec4f::zero());
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+    }
     mPointAttributeGroup1Buffer.reset(pointCount);
     std::fill(
         mPointAttributeGroup1Buffer.data(),
@@ -186,7 +219,18 @@ ShipRenderContext::ShipRenderContext(
 
     mPointAttributeGroup2VBO = vbos[1];
     glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
-    glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+    if (mIsPointAttributeStreamPersistent)
+    {
+        mPointAttributeGroup2StreamBuffer.allocate_and_map(pointCount);
+        std::fill(
+            mPointAttributeGroup2StreamBuffer.region_data(0),
+            mPointAttributeGroup2StreamBuffer.region_data(0) + pointCount * PointAttributeStreamRegionCount,
+            vec4f::zero());
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+    }
     mPointAttributeGroup2Buffer.reset_full(pointCount);
 
     mPointColorVBO = vbos[2];
@@ -199,7 +243,8 @@ ShipRenderContext::ShipRenderContext(
 
     mPointStressVBO = vbos[4];
     glBindBuffer(GL_ARRAY_BUFFER, *mPointStressVBO);
-    glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(float), nullptr, GL_STREAM_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(std::int16_t), nullptr, GL_STREAM_DRAW);
+    mPointStressPackingBuffer.reset(pointCount);
 
     mPointAuxiliaryDataVBO = vbos[5];
     glBindBuffer(GL_ARRAY_BUFFER, *mPointAuxiliaryDataVBO);
@@ -291,7 +336,7 @@ ShipRenderContext::ShipRenderContext(
 
         glBindBuffer(GL_ARRAY_BUFFER, *mPointStressVBO);
         glEnableVertexAttribArray(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::ShipPointStress));
-        glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::ShipPointStress), 1, GL_FLOAT, GL_FALSE, sizeof(float), (void *)(0));
+        glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::ShipPointStress), 1, GL_SHORT, GL_TRUE, sizeof(std::int16_t), (void *)(0));
         CheckOpenGLError();
 
         glBindBuffer(GL_ARRAY_BUFFER, *mPointAuxiliaryDataVBO);
@@ -711,6 +756,49 @@ ShipRenderContext::~ShipRenderContext()
 
 //////////////////////////////////////////////////////////////////////////////////
 
+void ShipRenderContext::ReportMemory(MemoryReport & report) const
+{
+    //
+    // CPU
+    //
+
+    report.Add("ShipRender", "PointAttributeGroup1", mPointAttributeGroup1Buffer.max_size() * sizeof(vec4f));
+    report.Add("ShipRender", "PointAttributeGroup2", mPointAttributeGroup2Buffer.max_size() * sizeof(vec4f));
+    report.Add("ShipRender", "PointStressPacking", mPointStressPackingBuffer.max_size() * sizeof(std::int16_t));
+    report.Add("ShipRender", "PointElements", mPointElementBuffer);
+    report.Add("ShipRender", "EphemeralPointElements", mEphemeralPointElementBuffer.max_size() * sizeof(PointElement));
+    report.Add("ShipRender", "SpringElements", mSpringElementBuffer);
+    report.Add("ShipRender", "RopeElements", mRopeElementBuffer);
+    report.Add("ShipRender", "TriangleElements", mTriangleElementBuffer.max_size() * sizeof(TriangleElement));
+    report.Add("ShipRender", "StressedSpringElements", mStressedSpringElementBuffer);
+    report.Add("ShipRender", "FrontierEdgeElements", mFrontierEdgeElementBuffer.max_size() * sizeof(LineElement));
+    report.Add("ShipRender", "ElementVBOUploaded", mElementVBOUploadedBuffer);
+    report.Add("ShipRender", "HighlightVertices", mHighlightVBOVertexBuffer);
+    report.Add("ShipRender", "HighlightUploadedVertices", mHighlightVBOUploadedVertexBuffer);
+    report.Add("ShipRender", "NpcAttributesUploadedVertices", mNpcAttributesVertexUploadedBuffer);
+    report.Add("ShipRender", "NpcQuadRoleUploadedVertices", mNpcQuadRoleVertexUploadedBuffer);
+    report.Add("ShipRender", "ExteriorViewImage", mExteriorViewImage.GetByteSize());
+    report.Add("ShipRender", "InteriorViewImage", mInteriorViewImage.GetByteSize());
+
+    //
+    // GPU (estimated from what we have allocated)
+    //
+
+    size_t const pointAttributeStreamRegionCount = mIsPointAttributeStreamPersistent ? PointAttributeStreamRegionCount : 1;
+    report.Add("ShipRenderGPU", "PointAttributeGroup1VBO", mPointCount * sizeof(vec4f) * pointAttributeStreamRegionCount);
+    report.Add("ShipRenderGPU", "PointAttributeGroup2VBO", mPointCount * sizeof(vec4f) * pointAttributeStreamRegionCount);
+    report.Add("ShipRenderGPU", "PointColorVBO", mPointCount * sizeof(vec4f));
+    report.Add("ShipRenderGPU", "PointTemperatureVBO", mPointCount * sizeof(float));
+    report.Add("ShipRenderGPU", "PointStressVBO", mPointCount * sizeof(std::int16_t));
+    report.Add("ShipRenderGPU", "PointAuxiliaryDataVBO", mPointCount * sizeof(float));
+    report.Add("ShipRenderGPU", "PointFrontierColorVBO", mPointCount * sizeof(ColorWithProgress));
+    report.Add("ShipRenderGPU", "ElementVBO", mElementVBOAllocatedIndexSize);
+
+    // Only the texture of the current view is on the GPU, with its mipmaps adding about a third
+    RgbaImageData const & viewImage = (mShipViewModeType == ShipViewModeType::Exterior) ? mExteriorViewImage : mInteriorViewImage;
+    report.Add("ShipRenderGPU", "ShipTexture", viewImage.GetByteSize() * 4 / 3);
+}
+
 void ShipRenderContext::UploadStart(PlaneId maxMaxPlaneId)
 {
     //
@@ -802,6 +890,33 @@ void ShipRenderContext::UploadPointMutableAttributes(
 {
     // Uploaded at each cycle
 
+    if (mIsPointAttributeStreamPersistent)
+    {
+        // Write whole attributes straight into the next region - which the GPU is done
+        // with, as we've waited for it at the end of the last draw - taking the attributes
+        // that are uploaded sparingly from the CPU buffers
+        size_t const region = (mPointAttributeStreamDrawRegion + 1) % PointAttributeStreamRegionCount;
+
+        vec2f const * const restrict pSrc1 = position;
+        float const * const restrict pSrc2 = light;
+        float const * const restrict pSrc3 = water;
+        vec4f const * const restrict pSrc4 = mPointAttributeGroup1Buffer.data();
+        vec4f const * const restrict pSrc5 = mPointAttributeGroup2Buffer.data();
+        vec4f * restrict const pDst1 = mPointAttributeGroup1StreamBuffer.region_data(region);
+        vec4f * restrict const pDst2 = mPointAttributeGroup2StreamBuffer.region_data(region);
+        for (size_t i = 0; i < mPointCount; ++i)
+        {
+            pDst1[i] = vec4f(pSrc1[i].x, pSrc1[i].y, pSrc4[i].z, pSrc4[i].w);
+            pDst2[i] = vec4f(pSrc2[i], pSrc3[i], pSrc5[i].z, pSrc5[i].w);
+        }
+
+        mPointAttributeStreamUploadedRegion = region;
+
+        AccountUpload(RenderStatistics::UploadKindType::ShipPoints, mPointCount * 2 * sizeof(vec4f));
+
+        return;
+    }
+
     // Interleave positions into AttributeGroup1 buffer, and
     // light and water into AttributeGroup2 buffer
     vec2f const * const restrict pSrc1 = position;
@@ -833,6 +948,14 @@ void ShipRenderContext::UploadPointMutableAttributesPlaneId(
     float const * restrict pSrc = planeId;
     for (size_t i = 0; i < count; ++i)
         pDst[i].z = pSrc[i];
+
+    if (mPointAttributeStreamUploadedRegion.has_value())
+    {
+        // Also into the region that has been streamed in this cycle
+        vec4f * restrict pStreamDst = &(mPointAttributeGroup2StreamBuffer.region_data(*mPointAttributeStreamUploadedRegion)[startDst]);
+        for (size_t i = 0; i < count; ++i)
+            pStreamDst[i].z = pSrc[i];
+    }
 }
 
 void ShipRenderContext::UploadPointMutableAttributesDecay(
@@ -849,6 +972,14 @@ void ShipRenderContext::UploadPointMutableAttributesDecay(
     float const * restrict pSrc = decay;
     for (size_t i = 0; i < count; ++i)
         pDst[i].w = pSrc[i];
+
+    if (mPointAttributeStreamUploadedRegion.has_value())
+    {
+        // Also into the region that has been streamed in this cycle
+        vec4f * restrict pStreamDst = &(mPointAttributeGroup2StreamBuffer.region_data(*mPointAttributeStreamUploadedRegion)[startDst]);
+        for (size_t i = 0; i < count; ++i)
+            pStreamDst[i].w = pSrc[i];
+    }
 }
 
 void ShipRenderContext::UploadPointMutableAttributesEnd()
@@ -875,6 +1006,7 @@ void ShipRenderContext::UploadPointColors(
 
     glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(vec4f), count * sizeof(vec4f), color);
     CheckOpenGLError();
+    AccountUpload(RenderStatistics::UploadKindType::ShipPoints, count * sizeof(vec4f));
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -896,6 +1028,7 @@ void ShipRenderContext::UploadPointTemperature(
 
     glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(float), count * sizeof(float), temperature);
     CheckOpenGLError();
+    AccountUpload(RenderStatistics::UploadKindType::ShipPoints, count * sizeof(float));
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -913,10 +1046,20 @@ void ShipRenderContext::UploadPointStress(
 
     assert(startDst + count <= mPointCount);
 
+    // Stress is in [-1.0, +1.0], hence we pack it as a normalized short,
+    // which the shaders receive as a float all the same
+    std::int16_t * restrict const pDst = mPointStressPackingBuffer.data();
+    float const * restrict const pSrc = stress;
+    for (size_t i = 0; i < count; ++i)
+    {
+        pDst[i] = static_cast<std::int16_t>(std::round(Clamp(pSrc[i], -1.0f, 1.0f) * 32767.0f));
+    }
+
     glBindBuffer(GL_ARRAY_BUFFER, *mPointStressVBO);
 
-    glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(float), count * sizeof(float), stress);
+    glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(std::int16_t), count * sizeof(std::int16_t), pDst);
     CheckOpenGLError();
+    AccountUpload(RenderStatistics::UploadKindType::ShipPoints, count * sizeof(std::int16_t));
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -936,6 +1079,7 @@ void ShipRenderContext::UploadPointAuxiliaryData(
 
     glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(float), count * sizeof(float), auxiliaryData);
     CheckOpenGLError();
+    AccountUpload(RenderStatistics::UploadKindType::ShipPoints, count * sizeof(float));
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -950,6 +1094,7 @@ void ShipRenderContext::UploadPointFrontierColors(ColorWithProgress const * colo
 
     glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(ColorWithProgress), colors);
     CheckOpenGLError();
+    AccountUpload(RenderStatistics::UploadKindType::ShipPoints, mPointCount * sizeof(ColorWithProgress));
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -976,6 +1121,14 @@ void ShipRenderContext::UploadElementTrianglesStart(size_t trianglesCount)
     // No need to clear, we'll repopulate everything
 
     mTriangleElementBuffer.reset_full(trianglesCount);
+    mTriangleElementTombstoneCount = 0;
+}
+
+void ShipRenderContext::UploadElementTrianglesPatchStart()
+{
+    // Client wants to tombstone some of the triangles in the current set
+    //
+    // Nothing to do, we'll patch in-place
 }
 
 void ShipRenderContext::UploadElementTrianglesEnd()
@@ -1112,7 +1265,7 @@ void ShipRenderContext::UploadVectorsStart(
     size_t maxCount,
     vec4f const & color)
 {
-    mVectorArrowVertexBuffer.reserve(maxCount * 3 * 2);
+    mVectorArrowVertexBuffer.reserve(maxCount * VectorArrowVertexCount);
 
     if (color != mVectorArrowColor)
     {
@@ -1122,6 +1275,30 @@ void ShipRenderContext::UploadVectorsStart(
     }
 }
 
+void ShipRenderContext::UploadVectors(
+    size_t count,
+    vec2f const * position,
+    float const * planeId,
+    vec2f const * vector,
+    float lengthAdjustment)
+{
+    float const effectiveVectorLength = lengthAdjustment * mVectorFieldLengthMultiplier;
+
+    size_t const startVertex = mVectorArrowVertexBuffer.size();
+    mVectorArrowVertexBuffer.resize(startVertex + count * VectorArrowVertexCount);
+
+    vec3f * restrict const vertices = mVectorArrowVertexBuffer.data() + startVertex;
+    for (size_t i = 0; i < count; ++i)
+    {
+        StoreVectorArrow(
+            position[i],
+            planeId[i],
+            vector[i],
+            effectiveVectorLength,
+            vertices + i * VectorArrowVertexCount);
+    }
+}
+
 void ShipRenderContext::UploadVectorsEnd()
 {
     // Nop
@@ -1169,7 +1346,7 @@ void ShipRenderContext::UploadEnd()
 
 void ShipRenderContext::ProcessParameterChanges(RenderParameters const & renderParameters)
 {
-    if (renderParameters.IsShipViewModeDirty)
+    if (renderParameters.IsShipViewModeDirty || mIsShipTextureDirty)
     {
         ApplyShipViewModeChanges(renderParameters);
     }
@@ -1255,25 +1432,43 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
 {
     // We've been invoked on the render thread
 
-    //
-    // Upload Point AttributeGroup1 buffer
-    //
+    if (mIsPointAttributeStreamPersistent)
+    {
+        //
+        // Draw from the region that has just been streamed, if any; its
+        // contents are already visible to the GPU as the mapping is coherent
+        //
 
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup1VBO);
+        if (mPointAttributeStreamUploadedRegion.has_value())
+        {
+            BindPointAttributeStreamRegion(*mPointAttributeStreamUploadedRegion);
+            mPointAttributeStreamUploadedRegion.reset();
+        }
+    }
+    else
+    {
+        //
+        // Upload Point AttributeGroup1 buffer
+        //
 
-    glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup1Buffer.data());
-    CheckOpenGLError();
+        glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup1VBO);
 
-    //
-    // Upload Point AttributeGroup2 buffer
-    //
+        glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup1Buffer.data());
+        CheckOpenGLError();
+        AccountUpload(RenderStatistics::UploadKindType::ShipPoints, mPointCount * sizeof(vec4f));
 
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
+        //
+        // Upload Point AttributeGroup2 buffer
+        //
 
-    glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup2Buffer.data());
-    CheckOpenGLError();
+        glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup2Buffer.data());
+        CheckOpenGLError();
+        AccountUpload(RenderStatistics::UploadKindType::ShipPoints, mPointCount * sizeof(vec4f));
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
 
     //
     // Upload element buffers, if needed
@@ -1296,51 +1491,60 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *mElementVBO);
 
-        if (mElementVBOAllocatedIndexSize != requiredIndexSize)
+        bool doUploadAll = false;
+        if (requiredIndexSize > mElementVBOAllocatedIndexSize)
         {
-            // Re-allocate VBO buffer
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, requiredIndexSize, nullptr, GL_STATIC_DRAW);
+            // Re-allocate VBO buffer, with some room for growth - as elements
+            // mostly come and go in small numbers
+            size_t const allocatedWordCount = (requiredIndexSize / sizeof(std::uint32_t)) * 9 / 8;
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, allocatedWordCount * sizeof(std::uint32_t), nullptr, GL_STATIC_DRAW);
             CheckOpenGLError();
 
-            mElementVBOAllocatedIndexSize = requiredIndexSize;
+            mElementVBOAllocatedIndexSize = allocatedWordCount * sizeof(std::uint32_t);
+            mElementVBOUploadedBuffer.assign(allocatedWordCount, 0);
+            doUploadAll = true;
         }
 
+        //
+        // Only upload what differs from what the VBO already holds; by and large, element
+        // sets only lose a few elements at a time - triangles in particular are tombstoned
+        // in-place - hence most of the VBO stays the same
+        //
+
         // Upload triangles
-        glBufferSubData(
-            GL_ELEMENT_ARRAY_BUFFER,
+        UploadChangedElements(
+            mTriangleElementBuffer.data(),
+            mTriangleElementBuffer.size(),
             mTriangleElementVBOStartIndex,
-            mTriangleElementBuffer.size() * sizeof(TriangleElement),
-            mTriangleElementBuffer.data());
+            doUploadAll);
 
         // Upload ropes
-        glBufferSubData(
-            GL_ELEMENT_ARRAY_BUFFER,
+        UploadChangedElements(
+            mRopeElementBuffer.data(),
+            mRopeElementBuffer.size(),
             mRopeElementVBOStartIndex,
-            mRopeElementBuffer.size() * sizeof(LineElement),
-            mRopeElementBuffer.data());
+            doUploadAll);
 
         // Upload springs
-        glBufferSubData(
-            GL_ELEMENT_ARRAY_BUFFER,
+        UploadChangedElements(
+            mSpringElementBuffer.data(),
+            mSpringElementBuffer.size(),
             mSpringElementVBOStartIndex,
-            mSpringElementBuffer.size() * sizeof(LineElement),
-            mSpringElementBuffer.data());
+            doUploadAll);
 
         // Upload points
-        glBufferSubData(
-            GL_ELEMENT_ARRAY_BUFFER,
+        UploadChangedElements(
+            mPointElementBuffer.data(),
+            mPointElementBuffer.size(),
             mPointElementVBOStartIndex,
-            mPointElementBuffer.size() * sizeof(PointElement),
-            mPointElementBuffer.data());
+            doUploadAll);
 
         // Upload ephemeral points
-        glBufferSubData(
-            GL_ELEMENT_ARRAY_BUFFER,
+        UploadChangedElements(
+            mEphemeralPointElementBuffer.data(),
+            mEphemeralPointElementBuffer.size(),
             mEphemeralPointElementVBOStartIndex,
-            mEphemeralPointElementBuffer.size() * sizeof(PointElement),
-            mEphemeralPointElementBuffer.data());
-
-        CheckOpenGLError();
+            doUploadAll);
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -1377,6 +1581,7 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ELEMENT_ARRAY_BUFFER, mStressedSpringElementBuffer.size() * sizeof(LineElement), mStressedSpringElementBuffer.data(), GL_STREAM_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipElements, mStressedSpringElementBuffer.size() * sizeof(LineElement));
 
             mStressedSpringElementVBOAllocatedElementSize = mStressedSpringElementBuffer.size();
         }
@@ -1385,6 +1590,7 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mStressedSpringElementBuffer.size() * sizeof(LineElement), mStressedSpringElementBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipElements, mStressedSpringElementBuffer.size() * sizeof(LineElement));
         }
 
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -1409,6 +1615,7 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
                 // Re-allocate VBO buffer and upload
                 glBufferData(GL_ELEMENT_ARRAY_BUFFER, mFrontierEdgeElementBuffer.size() * sizeof(LineElement), mFrontierEdgeElementBuffer.data(), GL_STATIC_DRAW);
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipElements, mFrontierEdgeElementBuffer.size() * sizeof(LineElement));
 
                 mFrontierEdgeElementVBOAllocatedElementSize = mFrontierEdgeElementBuffer.size();
             }
@@ -1417,6 +1624,7 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
                 // No size change, just upload VBO buffer
                 glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mFrontierEdgeElementBuffer.size() * sizeof(LineElement), mFrontierEdgeElementBuffer.data());
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipElements, mFrontierEdgeElementBuffer.size() * sizeof(LineElement));
             }
 
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -1548,31 +1756,11 @@ void ShipRenderContext::RenderDraw(
         // would result in the same artifact
         //
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Decay
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::InternalPressure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Strength
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Structure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::None)
+        if (mShipTrianglesDrawProgram.has_value())
         {
-            if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Decay)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipTrianglesDecay>();
-            }
-            else if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::InternalPressure)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipTrianglesInternalPressure>();
-            }
-            else if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Strength)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipTrianglesStrength>();
-            }
-            else
-            {
-                mShaderManager.ActivateProgram(mShipTrianglesProgram);
-            }
+            mShaderManager.ActivateProgram(*mShipTrianglesDrawProgram);
 
-            if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+            if (mIsWireframe)
                 glLineWidth(0.1f);
 
             // Draw!
@@ -1581,9 +1769,10 @@ void ShipRenderContext::RenderDraw(
                 static_cast<GLsizei>(3 * mTriangleElementBuffer.size()),
                 GL_UNSIGNED_INT,
                 (GLvoid *)mTriangleElementVBOStartIndex);
+            ++mDrawCallCount;
 
             // Update stats
-            renderStats.LastRenderedShipTriangles += mTriangleElementBuffer.size();
+            renderStats.LastRenderedShipTriangles += mTriangleElementBuffer.size() - mTriangleElementTombstoneCount;
         }
 
         //
@@ -1599,16 +1788,16 @@ void ShipRenderContext::RenderDraw(
         // as springs.
         //
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Structure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::None)
+        if (mShipRopesDrawProgram.has_value())
         {
-            mShaderManager.ActivateProgram(mShipRopesProgram);
+            mShaderManager.ActivateProgram(*mShipRopesDrawProgram);
 
             glDrawElements(
                 GL_LINES,
                 static_cast<GLsizei>(2 * mRopeElementBuffer.size()),
                 GL_UNSIGNED_INT,
                 (GLvoid *)mRopeElementVBOStartIndex);
+            ++mDrawCallCount;
 
             // Update stats
             renderStats.LastRenderedShipRopes += mRopeElementBuffer.size();
@@ -1627,36 +1816,16 @@ void ShipRenderContext::RenderDraw(
         // Note: when DebugRenderMode is springs|edgeSprings, ropes would all be here.
         //
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Springs
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::EdgeSprings
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Structure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::None
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Decay
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::InternalPressure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Strength)
+        if (mShipSpringsDrawProgram.has_value())
         {
-            if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Decay)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipSpringsDecay>();
-            }
-            else if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::InternalPressure)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipSpringsInternalPressure>();
-            }
-            else if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Strength)
-            {
-                mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipSpringsStrength>();
-            }
-            else
-            {
-                mShaderManager.ActivateProgram(mShipSpringsProgram);
-            }
+            mShaderManager.ActivateProgram(*mShipSpringsDrawProgram);
 
             glDrawElements(
                 GL_LINES,
                 static_cast<GLsizei>(2 * mSpringElementBuffer.size()),
                 GL_UNSIGNED_INT,
                 (GLvoid *)mSpringElementVBOStartIndex);
+            ++mDrawCallCount;
 
             // Update stats
             renderStats.LastRenderedShipSprings += mSpringElementBuffer.size();
@@ -1685,6 +1854,7 @@ void ShipRenderContext::RenderDraw(
                 static_cast<GLsizei>(2 * mStressedSpringElementBuffer.size()),
                 GL_UNSIGNED_INT,
                 (GLvoid *)0);
+            ++mDrawCallCount;
 
             // Bind again ship element VBO
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *mElementVBO);
@@ -1710,6 +1880,7 @@ void ShipRenderContext::RenderDraw(
                 static_cast<GLsizei>(2 * mFrontierEdgeElementBuffer.size()),
                 GL_UNSIGNED_INT,
                 (GLvoid *)0);
+            ++mDrawCallCount;
 
             // Bind again ship element VBO
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *mElementVBO);
@@ -1719,15 +1890,13 @@ void ShipRenderContext::RenderDraw(
         // Draw points (orphaned/all non-ephemerals, and ephemerals)
         //
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Points
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Structure
-            || renderParameters.DebugShipRenderMode == DebugShipRenderModeType::None)
+        if (mShipPointsDrawProgram.has_value())
         {
             size_t const totalPoints = mPointElementBuffer.size() + mEphemeralPointElementBuffer.size();
 
             if (totalPoints > 0)
             {
-                mShaderManager.ActivateProgram(mShipPointsProgram);
+                mShaderManager.ActivateProgram(*mShipPointsDrawProgram);
 
                 glPointSize(mPointSize);
 
@@ -1736,6 +1905,7 @@ void ShipRenderContext::RenderDraw(
                     static_cast<GLsizei>(totalPoints),
                     GL_UNSIGNED_INT,
                     (GLvoid *)mPointElementVBOStartIndex);
+                ++mDrawCallCount;
 
                 // Update stats
                 renderStats.LastRenderedShipPoints += totalPoints;
@@ -1826,6 +1996,31 @@ void ShipRenderContext::RenderDraw(
     //
 
     renderStats.LastRenderedShipPlanes += mMaxMaxPlaneId + 1;
+
+    renderStats.LastShipDrawCalls += mDrawCallCount;
+    mDrawCallCount = 0;
+
+    for (size_t k = 0; k < RenderStatistics::UploadKindCount; ++k)
+    {
+        renderStats.LastUploadedBytes[k] += mUploadedBytes[k];
+    }
+
+    mUploadedBytes.fill(0);
+
+    //
+    // Fence the point attribute region we've drawn from, and make sure the
+    // GPU is done with the region that the next upload is going to write
+    //
+
+    if (mIsPointAttributeStreamPersistent)
+    {
+        mPointAttributeGroup1StreamBuffer.fence_region(mPointAttributeStreamDrawRegion);
+        mPointAttributeGroup2StreamBuffer.fence_region(mPointAttributeStreamDrawRegion);
+
+        size_t const nextRegion = (mPointAttributeStreamDrawRegion + 1) % PointAttributeStreamRegionCount;
+        mPointAttributeGroup1StreamBuffer.wait_region(nextRegion);
+        mPointAttributeGroup2StreamBuffer.wait_region(nextRegion);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -1848,6 +2043,7 @@ void ShipRenderContext::RenderPrepareNpcs(RenderParameters const & renderParamet
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, sizeof(Quad) * mNpcPositionBuffer.size(), mNpcPositionBuffer.data(), GL_STREAM_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipNpcs, sizeof(Quad) * mNpcPositionBuffer.size());
 
             mNpcPositionVBOAllocatedVertexSize = mNpcPositionBuffer.size();
         }
@@ -1856,41 +2052,36 @@ void ShipRenderContext::RenderPrepareNpcs(RenderParameters const & renderParamet
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Quad) * mNpcPositionBuffer.size(), mNpcPositionBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipNpcs, sizeof(Quad) * mNpcPositionBuffer.size());
         }
 
-        glBindBuffer(GL_ARRAY_BUFFER, *mNpcAttributesVertexVBO);
-        if (mNpcAttributesVertexBuffer.size() > mNpcAttributesVertexVBOAllocatedVertexSize)
-        {
-            // Re-allocate VBO buffer and upload
-            glBufferData(GL_ARRAY_BUFFER, sizeof(NpcAttributesVertex) * mNpcAttributesVertexBuffer.size(), mNpcAttributesVertexBuffer.data(), GL_STREAM_DRAW);
-            CheckOpenGLError();
+        // Attributes - texture coordinates, light, alpha - and roles mostly stay the
+        // same from one frame to the next, hence we only upload what has changed
 
-            mNpcAttributesVertexVBOAllocatedVertexSize = mNpcAttributesVertexBuffer.size();
-        }
-        else
-        {
-            // No size change, just upload VBO buffer
-            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(NpcAttributesVertex) * mNpcAttributesVertexBuffer.size(), mNpcAttributesVertexBuffer.data());
-            CheckOpenGLError();
-        }
+        glBindBuffer(GL_ARRAY_BUFFER, *mNpcAttributesVertexVBO);
+        AccountUpload(
+            RenderStatistics::UploadKindType::ShipNpcs,
+            UploadChangedVertices(
+                mNpcAttributesVertexBuffer.data(),
+                mNpcAttributesVertexBuffer.size(),
+                mNpcAttributesVertexUploadedBuffer,
+                mNpcAttributesVertexVBOAllocatedVertexSize));
 
         if (renderParameters.NpcRenderMode == NpcRenderModeType::QuadWithRoles)
         {
             glBindBuffer(GL_ARRAY_BUFFER, *mNpcQuadRoleVertexVBO);
-            if (mNpcQuadRoleVertexBuffer.size() > mNpcQuadRoleVertexVBOAllocatedVertexSize)
-            {
-                // Re-allocate VBO buffer and upload
-                glBufferData(GL_ARRAY_BUFFER, sizeof(NpcQuadRoleVertex) * mNpcQuadRoleVertexBuffer.size(), mNpcQuadRoleVertexBuffer.data(), GL_STREAM_DRAW);
-                CheckOpenGLError();
-
-                mNpcQuadRoleVertexVBOAllocatedVertexSize = mNpcQuadRoleVertexBuffer.size();
-            }
-            else
-            {
-                // No size change, just upload VBO buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(NpcQuadRoleVertex) * mNpcQuadRoleVertexBuffer.size(), mNpcQuadRoleVertexBuffer.data());
-                CheckOpenGLError();
-            }
+            AccountUpload(
+                RenderStatistics::UploadKindType::ShipNpcs,
+                UploadChangedVertices(
+                    mNpcQuadRoleVertexBuffer.data(),
+                    mNpcQuadRoleVertexBuffer.size(),
+                    mNpcQuadRoleVertexUploadedBuffer,
+                    mNpcQuadRoleVertexVBOAllocatedVertexSize));
+        }
+        else
+        {
+            // Not uploaded while in other modes, hence no longer known
+            mNpcQuadRoleVertexUploadedBuffer.clear();
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -1928,7 +2119,7 @@ void ShipRenderContext::RenderDrawNpcs(RenderParameters const & renderParameters
         // Intel bug: cannot associate with VAO
         mGlobalRenderContext.GetElementIndices().Bind();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         glDrawElements(
@@ -1936,6 +2127,7 @@ void ShipRenderContext::RenderDrawNpcs(RenderParameters const & renderParameters
             static_cast<GLsizei>(mNpcPositionBuffer.size() * 6),
             GL_UNSIGNED_INT,
             (GLvoid *)0);
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -1952,6 +2144,7 @@ void ShipRenderContext::RenderPrepareElectricSparks(RenderParameters const & /*r
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, mElectricSparkVertexBuffer.size() * sizeof(ElectricSparkVertex), mElectricSparkVertexBuffer.data(), GL_DYNAMIC_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mElectricSparkVertexBuffer.size() * sizeof(ElectricSparkVertex));
 
             mElectricSparkVBOAllocatedVertexSize = mElectricSparkVertexBuffer.size();
         }
@@ -1960,6 +2153,7 @@ void ShipRenderContext::RenderPrepareElectricSparks(RenderParameters const & /*r
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, mElectricSparkVertexBuffer.size() * sizeof(ElectricSparkVertex), mElectricSparkVertexBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mElectricSparkVertexBuffer.size() * sizeof(ElectricSparkVertex));
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -1974,11 +2168,12 @@ void ShipRenderContext::RenderDrawElectricSparks(RenderParameters const & render
 
         mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipElectricSparks>();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         assert(0 == (mElectricSparkVertexBuffer.size() % 6));
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mElectricSparkVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -1999,6 +2194,7 @@ void ShipRenderContext::RenderPrepareFlames()
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, mFlameVertexBuffer.size() * sizeof(FlameVertex), mFlameVertexBuffer.data(), GL_STREAM_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mFlameVertexBuffer.size() * sizeof(FlameVertex));
 
             mFlameVBOAllocatedVertexSize = mFlameVertexBuffer.size();
         }
@@ -2007,6 +2203,7 @@ void ShipRenderContext::RenderPrepareFlames()
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, mFlameVertexBuffer.size() * sizeof(FlameVertex), mFlameVertexBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mFlameVertexBuffer.size() * sizeof(FlameVertex));
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2049,6 +2246,7 @@ void ShipRenderContext::RenderDrawFlames(
             GL_UNSIGNED_INT,
             (GLvoid *)(static_cast<size_t>(startFlameIndex) * 6u * sizeof(int)));
         CheckOpenGLError();
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
 
@@ -2072,6 +2270,7 @@ void ShipRenderContext::RenderPrepareJetEngineFlames()
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, mJetEngineFlameVertexBuffer.size() * sizeof(JetEngineFlameVertex), mJetEngineFlameVertexBuffer.data(), GL_STREAM_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mJetEngineFlameVertexBuffer.size() * sizeof(JetEngineFlameVertex));
 
             mJetEngineFlameVBOAllocatedVertexSize = mJetEngineFlameVertexBuffer.size();
         }
@@ -2080,6 +2279,7 @@ void ShipRenderContext::RenderPrepareJetEngineFlames()
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, mJetEngineFlameVertexBuffer.size() * sizeof(JetEngineFlameVertex), mJetEngineFlameVertexBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mJetEngineFlameVertexBuffer.size() * sizeof(JetEngineFlameVertex));
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2105,6 +2305,7 @@ void ShipRenderContext::RenderDrawJetEngineFlames()
 
         assert(0 == (mJetEngineFlameVertexBuffer.size() % 6));
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mJetEngineFlameVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -2121,6 +2322,7 @@ void ShipRenderContext::RenderPrepareSparkles(RenderParameters const & /*renderP
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, mSparkleVertexBuffer.size() * sizeof(SparkleVertex), mSparkleVertexBuffer.data(), GL_DYNAMIC_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mSparkleVertexBuffer.size() * sizeof(SparkleVertex));
 
             mSparkleVBOAllocatedVertexSize = mSparkleVertexBuffer.size();
         }
@@ -2129,6 +2331,7 @@ void ShipRenderContext::RenderPrepareSparkles(RenderParameters const & /*renderP
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, mSparkleVertexBuffer.size() * sizeof(SparkleVertex), mSparkleVertexBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mSparkleVertexBuffer.size() * sizeof(SparkleVertex));
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2143,11 +2346,12 @@ void ShipRenderContext::RenderDrawSparkles(RenderParameters const & renderParame
 
         mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipSparkles>();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         assert(0 == (mSparkleVertexBuffer.size() % 6));
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mSparkleVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -2218,6 +2422,8 @@ void ShipRenderContext::RenderPrepareGenericMipMappedTextures(RenderParameters c
         // Unmap vertex buffer
         glUnmapBuffer(GL_ARRAY_BUFFER);
 
+        AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mGenericMipMappedTextureTotalVertexCount * sizeof(GenericTextureVertex));
+
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 }
@@ -2235,7 +2441,7 @@ void ShipRenderContext::RenderDrawGenericMipMappedTextures(
 
         mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipGenericMipMappedTextures>();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         assert(0 == (mGenericMipMappedTextureTotalVertexCount % 4));
@@ -2244,6 +2450,7 @@ void ShipRenderContext::RenderDrawGenericMipMappedTextures(
             static_cast<GLsizei>(mGenericMipMappedTextureTotalVertexCount / 4 * 6),
             GL_UNSIGNED_INT,
             (GLvoid *)0);
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
 
@@ -2294,6 +2501,8 @@ void ShipRenderContext::RenderPrepareExplosions(RenderParameters const & /*rende
         // Unmap vertex buffer
         glUnmapBuffer(GL_ARRAY_BUFFER);
 
+        AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mExplosionTotalVertexCount * sizeof(ExplosionVertex));
+
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 }
@@ -2306,11 +2515,12 @@ void ShipRenderContext::RenderDrawExplosions(RenderParameters const & renderPara
 
         mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipExplosions>();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         assert(0 == (mExplosionTotalVertexCount % 6));
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mExplosionTotalVertexCount));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -2318,29 +2528,35 @@ void ShipRenderContext::RenderDrawExplosions(RenderParameters const & renderPara
 
 void ShipRenderContext::RenderPrepareHighlights(RenderParameters const & /*renderParameters*/)
 {
+    //
+    // All modes share the same VBO, one after the other; highlights mostly stay
+    // put for many frames, hence we only upload what has changed
+    //
+
+    mHighlightVBOVertexBuffer.clear();
     for (size_t i = 0; i <= static_cast<size_t>(HighlightModeType::_Last); ++i)
     {
-        if (!mHighlightVertexBuffers[i].empty())
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, *mHighlightVBO);
+        mHighlightVBOVertexOffsets[i] = mHighlightVBOVertexBuffer.size();
 
-            if (mHighlightVertexBuffers[i].size() > mHighlightVBOAllocatedVertexSize)
-            {
-                // Re-allocate VBO buffer and upload
-                glBufferData(GL_ARRAY_BUFFER, mHighlightVertexBuffers[i].size() * sizeof(HighlightVertex), mHighlightVertexBuffers[i].data(), GL_DYNAMIC_DRAW);
-                CheckOpenGLError();
+        mHighlightVBOVertexBuffer.insert(
+            mHighlightVBOVertexBuffer.end(),
+            mHighlightVertexBuffers[i].cbegin(),
+            mHighlightVertexBuffers[i].cend());
+    }
 
-                mHighlightVBOAllocatedVertexSize = mHighlightVertexBuffers[i].size();
-            }
-            else
-            {
-                // No size change, just upload VBO buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, mHighlightVertexBuffers[i].size() * sizeof(HighlightVertex), mHighlightVertexBuffers[i].data());
-                CheckOpenGLError();
-            }
+    if (!mHighlightVBOVertexBuffer.empty())
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, *mHighlightVBO);
 
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
-        }
+        AccountUpload(
+            RenderStatistics::UploadKindType::ShipEffects,
+            UploadChangedVertices(
+                mHighlightVBOVertexBuffer.data(),
+                mHighlightVBOVertexBuffer.size(),
+                mHighlightVBOUploadedVertexBuffer,
+                mHighlightVBOAllocatedVertexSize));
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 }
 
@@ -2373,11 +2589,12 @@ void ShipRenderContext::RenderDrawHighlights(RenderParameters const & renderPara
                 }
             }
 
-            if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+            if (mIsWireframe)
                 glLineWidth(0.1f);
 
             assert(0 == (mHighlightVertexBuffers[i].size() % 6));
-            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mHighlightVertexBuffers[i].size()));
+            glDrawArrays(GL_TRIANGLES, static_cast<GLint>(mHighlightVBOVertexOffsets[i]), static_cast<GLsizei>(mHighlightVertexBuffers[i].size()));
+            ++mDrawCallCount;
 
             glBindVertexArray(0);
         }
@@ -2408,6 +2625,7 @@ void ShipRenderContext::RenderPrepareVectorArrows(RenderParameters const & /*ren
             // Re-allocate VBO buffer and upload
             glBufferData(GL_ARRAY_BUFFER, mVectorArrowVertexBuffer.size() * sizeof(vec3f), mVectorArrowVertexBuffer.data(), GL_DYNAMIC_DRAW);
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mVectorArrowVertexBuffer.size() * sizeof(vec3f));
 
             mVectorArrowVBOAllocatedVertexSize = mVectorArrowVertexBuffer.size();
         }
@@ -2416,6 +2634,7 @@ void ShipRenderContext::RenderPrepareVectorArrows(RenderParameters const & /*ren
             // No size change, just upload VBO buffer
             glBufferSubData(GL_ARRAY_BUFFER, 0, mVectorArrowVertexBuffer.size() * sizeof(vec3f), mVectorArrowVertexBuffer.data());
             CheckOpenGLError();
+            AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mVectorArrowVertexBuffer.size() * sizeof(vec3f));
         }
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2433,6 +2652,7 @@ void ShipRenderContext::RenderDrawVectorArrows(RenderParameters const & /*render
         glLineWidth(1.0f);
 
         glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(mVectorArrowVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -2451,6 +2671,7 @@ void ShipRenderContext::RenderPrepareCenters(RenderParameters const & /*renderPa
                 // Re-allocate VBO buffer and upload
                 glBufferData(GL_ARRAY_BUFFER, mCenterVertexBuffer.size() * sizeof(CenterVertex), mCenterVertexBuffer.data(), GL_DYNAMIC_DRAW);
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mCenterVertexBuffer.size() * sizeof(CenterVertex));
 
                 mCenterVBOAllocatedVertexSize = mCenterVertexBuffer.size();
             }
@@ -2459,6 +2680,7 @@ void ShipRenderContext::RenderPrepareCenters(RenderParameters const & /*renderPa
                 // No size change, just upload VBO buffer
                 glBufferSubData(GL_ARRAY_BUFFER, 0, mCenterVertexBuffer.size() * sizeof(CenterVertex), mCenterVertexBuffer.data());
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mCenterVertexBuffer.size() * sizeof(CenterVertex));
             }
         }
 
@@ -2476,11 +2698,12 @@ void ShipRenderContext::RenderDrawCenters(RenderParameters const & renderParamet
 
         mShaderManager.ActivateProgram<GameShaderSets::ProgramKind::ShipCenters>();
 
-        if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
+        if (mIsWireframe)
             glLineWidth(0.1f);
 
         assert(0 == (mCenterVertexBuffer.size() % 6));
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mCenterVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
@@ -2499,6 +2722,7 @@ void ShipRenderContext::RenderPreparePointToPointArrows(RenderParameters const &
                 // Re-allocate VBO buffer and upload
                 glBufferData(GL_ARRAY_BUFFER, mPointToPointArrowVertexBuffer.size() * sizeof(PointToPointArrowVertex), mPointToPointArrowVertexBuffer.data(), GL_DYNAMIC_DRAW);
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mPointToPointArrowVertexBuffer.size() * sizeof(PointToPointArrowVertex));
 
                 mPointToPointArrowVBOAllocatedVertexSize = mPointToPointArrowVertexBuffer.size();
             }
@@ -2507,6 +2731,7 @@ void ShipRenderContext::RenderPreparePointToPointArrows(RenderParameters const &
                 // No size change, just upload VBO buffer
                 glBufferSubData(GL_ARRAY_BUFFER, 0, mPointToPointArrowVertexBuffer.size() * sizeof(PointToPointArrowVertex), mPointToPointArrowVertexBuffer.data());
                 CheckOpenGLError();
+                AccountUpload(RenderStatistics::UploadKindType::ShipEffects, mPointToPointArrowVertexBuffer.size() * sizeof(PointToPointArrowVertex));
             }
         }
 
@@ -2527,15 +2752,45 @@ void ShipRenderContext::RenderDrawPointToPointArrows(RenderParameters const & /*
         glLineWidth(0.5f);
 
         glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(mPointToPointArrowVertexBuffer.size()));
+        ++mDrawCallCount;
 
         glBindVertexArray(0);
     }
 }
 
+void ShipRenderContext::BindPointAttributeStreamRegion(size_t region)
+{
+    assert(mIsPointAttributeStreamPersistent);
+
+    if (region == mPointAttributeStreamDrawRegion)
+    {
+        // Nothing to do
+        return;
+    }
+
+    glBindVertexArray(*mShipVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup1VBO);
+    glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::ShipPointAttributeGroup1), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void *)(mPointAttributeGroup1StreamBuffer.region_byte_offset(region)));
+    CheckOpenGLError();
+
+    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
+    glVertexAttribPointer(static_cast<GLuint>(GameShaderSets::VertexAttributeKind::ShipPointAttributeGroup2), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void *)(mPointAttributeGroup2StreamBuffer.region_byte_offset(region)));
+    CheckOpenGLError();
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(0);
+
+    mPointAttributeStreamDrawRegion = region;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 void ShipRenderContext::ApplyShipViewModeChanges(RenderParameters const & renderParameters)
 {
+    mIsShipTextureDirty = false;
+
     //
     // Initialize ship texture
     //
@@ -3522,4 +3777,209 @@ void ShipRenderContext::SelectShipPrograms(RenderParameters const & renderParame
             }
         }
     }
+
+    //
+    // Select draw programs, depending on DebugShipRenderMode
+    //
+
+    mShipPointsDrawProgram.reset();
+    mShipRopesDrawProgram.reset();
+    mShipSpringsDrawProgram.reset();
+    mShipTrianglesDrawProgram.reset();
+    mIsWireframe = false;
+
+    switch (renderParameters.DebugShipRenderMode)
+    {
+        case DebugShipRenderModeType::Decay:
+        {
+            mShipSpringsDrawProgram = GameShaderSets::ProgramKind::ShipSpringsDecay;
+            mShipTrianglesDrawProgram = GameShaderSets::ProgramKind::ShipTrianglesDecay;
+            break;
+        }
+
+        case DebugShipRenderModeType::EdgeSprings:
+        case DebugShipRenderModeType::Springs:
+        {
+            // Ropes are uploaded as springs in these modes
+            mShipSpringsDrawProgram = mShipSpringsProgram;
+            break;
+        }
+
+        case DebugShipRenderModeType::InternalPressure:
+        {
+            mShipSpringsDrawProgram = GameShaderSets::ProgramKind::ShipSpringsInternalPressure;
+            mShipTrianglesDrawProgram = GameShaderSets::ProgramKind::ShipTrianglesInternalPressure;
+            break;
+        }
+
+        case DebugShipRenderModeType::None:
+        case DebugShipRenderModeType::Structure:
+        {
+            mShipPointsDrawProgram = mShipPointsProgram;
+            mShipRopesDrawProgram = mShipRopesProgram;
+            mShipSpringsDrawProgram = mShipSpringsProgram;
+            mShipTrianglesDrawProgram = mShipTrianglesProgram;
+            break;
+        }
+
+        case DebugShipRenderModeType::Points:
+        {
+            mShipPointsDrawProgram = mShipPointsProgram;
+            break;
+        }
+
+        case DebugShipRenderModeType::Strength:
+        {
+            mShipSpringsDrawProgram = GameShaderSets::ProgramKind::ShipSpringsStrength;
+            mShipTrianglesDrawProgram = GameShaderSets::ProgramKind::ShipTrianglesStrength;
+            break;
+        }
+
+        case DebugShipRenderModeType::Wireframe:
+        {
+            mShipTrianglesDrawProgram = mShipTrianglesProgram;
+            mIsWireframe = true;
+            break;
+        }
+    }
+}
+
+template<typename TVertex>
+size_t ShipRenderContext::UploadChangedVertices(
+    TVertex const * vertices,
+    size_t vertexCount,
+    std::vector<TVertex> & uploadedVertexBuffer,
+    size_t & vboAllocatedVertexSize)
+{
+    // Vertices are made of floats only, hence we may compare them bytewise
+    static_assert(sizeof(TVertex) % sizeof(float) == 0);
+
+    if (vertexCount > vboAllocatedVertexSize)
+    {
+        // Re-allocate VBO buffer and upload
+        glBufferData(GL_ARRAY_BUFFER, sizeof(TVertex) * vertexCount, vertices, GL_STREAM_DRAW);
+        CheckOpenGLError();
+
+        vboAllocatedVertexSize = vertexCount;
+    }
+    else if (vertexCount != uploadedVertexBuffer.size())
+    {
+        // Different set of elements, just upload VBO buffer
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(TVertex) * vertexCount, vertices);
+        CheckOpenGLError();
+    }
+    else
+    {
+        // Only upload the span between the first and the last changed vertices
+
+        size_t firstChanged = 0;
+        while (firstChanged < vertexCount
+            && 0 == std::memcmp(&(vertices[firstChanged]), &(uploadedVertexBuffer[firstChanged]), sizeof(TVertex)))
+        {
+            ++firstChanged;
+        }
+
+        if (firstChanged == vertexCount)
+        {
+            // Nothing changed
+            return 0;
+        }
+
+        size_t endChanged = vertexCount;
+        while (0 == std::memcmp(&(vertices[endChanged - 1]), &(uploadedVertexBuffer[endChanged - 1]), sizeof(TVertex)))
+        {
+            --endChanged;
+        }
+
+        glBufferSubData(
+            GL_ARRAY_BUFFER,
+            sizeof(TVertex) * firstChanged,
+            sizeof(TVertex) * (endChanged - firstChanged),
+            &(vertices[firstChanged]));
+        CheckOpenGLError();
+
+        std::copy(
+            vertices + firstChanged,
+            vertices + endChanged,
+            uploadedVertexBuffer.begin() + firstChanged);
+
+        return sizeof(TVertex) * (endChanged - firstChanged);
+    }
+
+    uploadedVertexBuffer.assign(vertices, vertices + vertexCount);
+
+    return sizeof(TVertex) * vertexCount;
+}
+
+template<typename TElement>
+void ShipRenderContext::UploadChangedElements(
+    TElement const * elements,
+    size_t elementCount,
+    size_t vboByteOffset,
+    bool doUploadAll)
+{
+    // Elements are made of indices only, hence we may compare them word by word
+    static_assert(sizeof(TElement) % sizeof(std::uint32_t) == 0);
+
+    // Unchanged words below which two changed runs are rather uploaded as one
+    size_t constexpr MaxGapWordCount = 64;
+
+    assert(vboByteOffset % sizeof(std::uint32_t) == 0);
+    size_t const startWord = vboByteOffset / sizeof(std::uint32_t);
+    size_t const wordCount = elementCount * (sizeof(TElement) / sizeof(std::uint32_t));
+    assert(startWord + wordCount <= mElementVBOUploadedBuffer.size());
+
+    std::uint32_t const * const words = reinterpret_cast<std::uint32_t const *>(elements);
+    std::uint32_t * const uploadedWords = mElementVBOUploadedBuffer.data() + startWord;
+
+    auto const uploadRun = [&](size_t first, size_t end)
+        {
+            glBufferSubData(
+                GL_ELEMENT_ARRAY_BUFFER,
+                (startWord + first) * sizeof(std::uint32_t),
+                (end - first) * sizeof(std::uint32_t),
+                words + first);
+            CheckOpenGLError();
+
+            AccountUpload(RenderStatistics::UploadKindType::ShipElements, (end - first) * sizeof(std::uint32_t));
+
+            std::copy(
+                words + first,
+                words + end,
+                uploadedWords + first);
+        };
+
+    if (doUploadAll)
+    {
+        if (wordCount > 0)
+        {
+            uploadRun(0, wordCount);
+        }
+
+        return;
+    }
+
+    for (size_t w = 0; w < wordCount; )
+    {
+        // Find the start of the next changed run
+        if (words[w] == uploadedWords[w])
+        {
+            ++w;
+            continue;
+        }
+
+        size_t const first = w;
+        size_t end = w + 1;
+
+        // Extend the run until we find enough unchanged words
+        for (w = end; w < wordCount && w - end < MaxGapWordCount; ++w)
+        {
+            if (words[w] != uploadedWords[w])
+            {
+                end = w + 1;
+            }
+        }
+
+        uploadRun(first, end);
+    }
 }
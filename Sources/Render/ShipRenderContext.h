@@ -12,11 +12,13 @@
 #include "RenderStatistics.h"
 
 #include <OpenGLCore/GameOpenGL.h>
+#include <OpenGLCore/GameOpenGLPersistentMappedBuffer.h>
 #include <OpenGLCore/ShaderManager.h>
 
 #include <Core/BoundedVector.h>
 #include <Core/GameTypes.h>
 #include <Core/ImageData.h>
+#include <Core/MemoryReport.h>
 #include <Core/SysSpecifics.h>
 #include <Core/TextureAtlas.h>
 #include <Core/Vectors.h>
@@ -25,6 +27,7 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -40,6 +43,10 @@ private:
     static float constexpr BasisNpcFlameHalfQuadWidth = 10.5f * 0.15f;
     static float constexpr BasisNpcFlameQuadHeight = 7.5f * 0.15f;
 
+    // Number of regions point attributes are streamed through, when
+    // persistently-mapped: one being written, and up to two in flight
+    static size_t constexpr PointAttributeStreamRegionCount = 3;
+
 public:
 
     ShipRenderContext(
@@ -60,12 +67,29 @@ public:
 
 public:
 
+    size_t GetPointCount() const
+    {
+        return mPointCount;
+    }
+
     void SetShipCount(size_t shipCount)
     {
         mShipCount = shipCount;
         mIsViewModelDirty = true;
     }
 
+    /*
+     * Replaces the ship's textures, which get uploaded at the next render.
+     */
+    void SetViewImages(
+        RgbaImageData exteriorViewImage,
+        RgbaImageData interiorViewImage)
+    {
+        mExteriorViewImage = std::move(exteriorViewImage);
+        mInteriorViewImage = std::move(interiorViewImage);
+        mIsShipTextureDirty = true;
+    }
+
     void SetShipFlameSizeAdjustment(float shipFlameSizeAdjustment)
     {
         // Recalculate quad dimensions
@@ -78,6 +102,26 @@ public:
         mVectorFieldLengthMultiplier = vectorFieldLengthMultiplier;
     }
 
+    /*
+     * Adds the memory occupied by the ship's CPU-side render buffers and images to the report,
+     * together with an estimate of what its buffers and textures occupy on the GPU.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
+    /*
+     * Ships that are culled skip both their upload and their draw; whatever
+     * they have pending is uploaded once they become visible again.
+     */
+    bool IsVisible() const
+    {
+        return mIsVisible;
+    }
+
+    void SetIsVisible(bool isVisible)
+    {
+        mIsVisible = isVisible;
+    }
+
 public:
 
     void UploadStart(PlaneId maxMaxPlaneId);
@@ -164,6 +208,12 @@ public:
 
     void UploadElementTrianglesStart(size_t trianglesCount);
 
+    /*
+     * Signals that the last uploaded set of triangles is to be kept, except for the triangles
+     * that are going to be tombstoned.
+     */
+    void UploadElementTrianglesPatchStart();
+
     inline void UploadElementTriangle(
         size_t triangleIndex,
         int pointIndex1,
@@ -179,6 +229,18 @@ public:
         triangleElement.pointIndex3 = pointIndex3;
     }
 
+    inline void UploadElementTriangleTombstone(size_t triangleIndex)
+    {
+        assert(triangleIndex < mTriangleElementBuffer.size());
+
+        // Make it degenerate, so that it doesn't get rasterized
+        TriangleElement & triangleElement = mTriangleElementBuffer[triangleIndex];
+        triangleElement.pointIndex2 = triangleElement.pointIndex1;
+        triangleElement.pointIndex3 = triangleElement.pointIndex1;
+
+        ++mTriangleElementTombstoneCount;
+    }
+
     void UploadElementTrianglesEnd();
 
     void UploadElementsEnd();
@@ -1028,37 +1090,27 @@ public:
         vec2f const & vector,
         float lengthAdjustment)
     {
-        static float const CosAlphaLeftRight = std::cosf(-2.f * Pi<float> / 8.f);
-        static float const SinAlphaLeft = std::sinf(-2.f * Pi<float> / 8.f);
-        static float const SinAlphaRight = -SinAlphaLeft;
-
-        static vec2f const XMatrixLeft = vec2f(CosAlphaLeftRight, SinAlphaLeft);
-        static vec2f const YMatrixLeft = vec2f(-SinAlphaLeft, CosAlphaLeftRight);
-        static vec2f const XMatrixRight = vec2f(CosAlphaLeftRight, SinAlphaRight);
-        static vec2f const YMatrixRight = vec2f(-SinAlphaRight, CosAlphaLeftRight);
-
-        float const effectiveVectorLength = lengthAdjustment * mVectorFieldLengthMultiplier;
+        size_t const startVertex = mVectorArrowVertexBuffer.size();
+        mVectorArrowVertexBuffer.resize(startVertex + VectorArrowVertexCount);
 
-        //
-        // Store endpoint positions of each segment
-        //
-
-        // Stem
-        vec2f stemEndpoint = position + vector * effectiveVectorLength;
-        mVectorArrowVertexBuffer.emplace_back(position, planeId);
-        mVectorArrowVertexBuffer.emplace_back(stemEndpoint, planeId);
-
-        // Left
-        vec2f leftDir = vec2f(-vector.dot(XMatrixLeft), -vector.dot(YMatrixLeft)).normalise();
-        mVectorArrowVertexBuffer.emplace_back(stemEndpoint, planeId);
-        mVectorArrowVertexBuffer.emplace_back(stemEndpoint + leftDir * 0.3f, planeId);
-
-        // Right
-        vec2f rightDir = vec2f(-vector.dot(XMatrixRight), -vector.dot(YMatrixRight)).normalise();
-        mVectorArrowVertexBuffer.emplace_back(stemEndpoint, planeId);
-        mVectorArrowVertexBuffer.emplace_back(stemEndpoint + rightDir * 0.3f, planeId);
+        StoreVectorArrow(
+            position,
+            planeId,
+            vector,
+            lengthAdjustment * mVectorFieldLengthMultiplier,
+            mVectorArrowVertexBuffer.data() + startVertex);
     }
 
+    /*
+     * Uploads the vectors of a contiguous range of points at once.
+     */
+    void UploadVectors(
+        size_t count,
+        vec2f const * position,
+        float const * planeId,
+        vec2f const * vector,
+        float lengthAdjustment);
+
     void UploadVectorsEnd();
 
     //
@@ -1177,6 +1229,49 @@ public:
 
 private:
 
+    // Stem, left and right segments
+    static size_t constexpr VectorArrowVertexCount = 3 * 2;
+
+    static inline void StoreVectorArrow(
+        vec2f const & position,
+        float planeId,
+        vec2f const & vector,
+        float effectiveVectorLength,
+        vec3f * restrict vertices)
+    {
+        // The arrow's tips are the reversed vector rotated by -/+ PI/4
+        float constexpr CosAlphaLeftRight = 0.70710678f; // cos(-PI/4)
+        float constexpr SinAlphaLeft = -0.70710678f; // sin(-PI/4)
+        float constexpr SinAlphaRight = -SinAlphaLeft;
+
+        vec2f constexpr XMatrixLeft = vec2f(CosAlphaLeftRight, SinAlphaLeft);
+        vec2f constexpr YMatrixLeft = vec2f(-SinAlphaLeft, CosAlphaLeftRight);
+        vec2f constexpr XMatrixRight = vec2f(CosAlphaLeftRight, SinAlphaRight);
+        vec2f constexpr YMatrixRight = vec2f(-SinAlphaRight, CosAlphaLeftRight);
+
+        //
+        // Store endpoint positions of each segment
+        //
+
+        // Stem
+        vec2f const stemEndpoint = position + vector * effectiveVectorLength;
+        vertices[0] = vec3f(position, planeId);
+        vertices[1] = vec3f(stemEndpoint, planeId);
+
+        // Rotations preserve length, hence we only normalize once
+        vec2f const normalizedVector = vector.normalise(vector.length());
+
+        // Left
+        vec2f const leftDir = vec2f(-normalizedVector.dot(XMatrixLeft), -normalizedVector.dot(YMatrixLeft));
+        vertices[2] = vec3f(stemEndpoint, planeId);
+        vertices[3] = vec3f(stemEndpoint + leftDir * 0.3f, planeId);
+
+        // Right
+        vec2f const rightDir = vec2f(-normalizedVector.dot(XMatrixRight), -normalizedVector.dot(YMatrixRight));
+        vertices[4] = vec3f(stemEndpoint, planeId);
+        vertices[5] = vec3f(stemEndpoint + rightDir * 0.3f, planeId);
+    }
+
     inline void StoreFlameQuad(
         PlaneId planeId,
         vec2f const & baseCenterPosition,
@@ -1367,6 +1462,31 @@ private:
     void RenderPrepareHighlights(RenderParameters const & renderParameters);
     void RenderDrawHighlights(RenderParameters const & renderParameters);
 
+    // Uploads to the currently-bound array buffer only the vertices that differ
+    // from those it is known to hold; returns the number of bytes uploaded
+    template<typename TVertex>
+    static size_t UploadChangedVertices(
+        TVertex const * vertices,
+        size_t vertexCount,
+        std::vector<TVertex> & uploadedVertexBuffer,
+        size_t & vboAllocatedVertexSize);
+
+    // Uploads to the element VBO, at the specified offset, only the runs of elements
+    // that differ from those it is known to hold
+    template<typename TElement>
+    void UploadChangedElements(
+        TElement const * elements,
+        size_t elementCount,
+        size_t vboByteOffset,
+        bool doUploadAll);
+
+    inline void AccountUpload(
+        RenderStatistics::UploadKindType uploadKind,
+        size_t byteCount)
+    {
+        mUploadedBytes[static_cast<size_t>(uploadKind)] += byteCount;
+    }
+
     void RenderPrepareVectorArrows(RenderParameters const & renderParameters);
     void RenderDrawVectorArrows(RenderParameters const & renderParameters);
 
@@ -1376,6 +1496,8 @@ private:
     void RenderPreparePointToPointArrows(RenderParameters const & renderParameters);
     void RenderDrawPointToPointArrows(RenderParameters const & renderParameters);
 
+    void BindPointAttributeStreamRegion(size_t region);
+
     void ApplyShipViewModeChanges(RenderParameters const & renderParameters);
     void ApplyShipStructureRenderModeChanges(RenderParameters const & renderParameters);
     void ApplyViewModelChanges(RenderParameters const & renderParameters);
@@ -1406,6 +1528,7 @@ private:
     size_t mShipCount;
     PlaneId mMaxMaxPlaneId; // Make plane ID ever
     bool mIsViewModelDirty;
+    bool mIsVisible;
 
     //
     // Types
@@ -1693,11 +1816,21 @@ private:
     BoundedVector<vec4f> mPointAttributeGroup2Buffer; // Light, Water, PlaneId, Decay
     GameOpenGLVBO mPointAttributeGroup2VBO;
 
+    // When persistent mapping is supported, the mutable attributes are written straight
+    // into a ring of regions of the VBOs rather than being copied over at each frame;
+    // the CPU buffers above then only hold the attributes that are uploaded sparingly
+    bool const mIsPointAttributeStreamPersistent;
+    GameOpenGLPersistentMappedBuffer<vec4f, PointAttributeStreamRegionCount, GL_ARRAY_BUFFER> mPointAttributeGroup1StreamBuffer;
+    GameOpenGLPersistentMappedBuffer<vec4f, PointAttributeStreamRegionCount, GL_ARRAY_BUFFER> mPointAttributeGroup2StreamBuffer;
+    size_t mPointAttributeStreamDrawRegion; // Region currently bound to the ship VAO
+    std::optional<size_t> mPointAttributeStreamUploadedRegion; // Region written by this cycle's upload, if any
+
     GameOpenGLVBO mPointColorVBO;
 
     GameOpenGLVBO mPointTemperatureVBO;
 
-    GameOpenGLVBO mPointStressVBO;
+    GameOpenGLVBO mPointStressVBO; // Normalized shorts
+    BoundedVector<std::int16_t> mPointStressPackingBuffer;
 
     GameOpenGLVBO mPointAuxiliaryDataVBO;
 
@@ -1717,10 +1850,12 @@ private:
     size_t mNpcPositionVBOAllocatedVertexSize;
 
     BoundedVector<NpcAttributesVertex> mNpcAttributesVertexBuffer;
+    std::vector<NpcAttributesVertex> mNpcAttributesVertexUploadedBuffer; // What the VBO currently holds
     GameOpenGLVBO mNpcAttributesVertexVBO;
     size_t mNpcAttributesVertexVBOAllocatedVertexSize;
 
     BoundedVector<NpcQuadRoleVertex> mNpcQuadRoleVertexBuffer;
+    std::vector<NpcQuadRoleVertex> mNpcQuadRoleVertexUploadedBuffer; // What the VBO currently holds
     GameOpenGLVBO mNpcQuadRoleVertexVBO;
     size_t mNpcQuadRoleVertexVBOAllocatedVertexSize;
 
@@ -1754,6 +1889,9 @@ private:
     size_t mGenericMipMappedTextureVBOAllocatedVertexSize;
 
     std::array<std::vector<HighlightVertex>, static_cast<size_t>(HighlightModeType::_Last) + 1> mHighlightVertexBuffers;
+    std::vector<HighlightVertex> mHighlightVBOVertexBuffer; // All modes, one after the other
+    std::array<size_t, static_cast<size_t>(HighlightModeType::_Last) + 1> mHighlightVBOVertexOffsets;
+    std::vector<HighlightVertex> mHighlightVBOUploadedVertexBuffer; // What the VBO currently holds
     GameOpenGLVBO mHighlightVBO;
     size_t mHighlightVBOAllocatedVertexSize;
 
@@ -1784,9 +1922,11 @@ private:
     std::vector<LineElement> mSpringElementBuffer;
     std::vector<LineElement> mRopeElementBuffer;
     BoundedVector<TriangleElement> mTriangleElementBuffer; // We know in advance how many will be uploaded
+    size_t mTriangleElementTombstoneCount; // Degenerate triangles in mTriangleElementBuffer
     bool mAreElementBuffersDirty;
     GameOpenGLVBO mElementVBO;
     size_t mElementVBOAllocatedIndexSize;
+    std::vector<std::uint32_t> mElementVBOUploadedBuffer; // What the VBO holds, word by word
 
     // Indices at which these elements begin in the VBO; populated
     // when we upload element indices to the VBO
@@ -1823,12 +1963,22 @@ private:
     GameShaderSets::ProgramKind mShipSpringsProgram;
     GameShaderSets::ProgramKind mShipTrianglesProgram;
 
+    // The shaders to draw ship structures with - the above ones, or a debug one - or none
+    // when the current debug render mode does not draw the structure; selected once at
+    // each render mode change, so that draws need not look at modes
+    std::optional<GameShaderSets::ProgramKind> mShipPointsDrawProgram;
+    std::optional<GameShaderSets::ProgramKind> mShipRopesDrawProgram;
+    std::optional<GameShaderSets::ProgramKind> mShipSpringsDrawProgram;
+    std::optional<GameShaderSets::ProgramKind> mShipTrianglesDrawProgram;
+    bool mIsWireframe;
+
     //
     // Textures
     //
 
     RgbaImageData mExteriorViewImage;
     RgbaImageData mInteriorViewImage;
+    bool mIsShipTextureDirty; // When the images have changed since their upload
     ShipViewModeType mShipViewModeType;
 
     GameOpenGLTexture mShipTextureOpenGLHandle;
@@ -1859,4 +2009,11 @@ private:
     float mNpcFlameQuadHeight;
 
     float mVectorFieldLengthMultiplier;
+
+    //
+    // Statistics, accumulated until the next draw
+    //
+
+    std::array<std::uint64_t, RenderStatistics::UploadKindCount> mUploadedBytes;
+    std::uint64_t mDrawCallCount;
 };
@@ -36,6 +36,7 @@ WorldRenderContext::WorldRenderContext(
     , mCloudVBO()
     , mCloudVBOAllocatedVertexSize(0u)
     , mLandSegmentBuffer()
+    , mIsLandSegmentBufferDirty(false)
     , mLandSegmentVBO()
     , mLandSegmentVBOAllocatedVertexSize(0u)
     , mOceanBasicSegmentBuffer()
@@ -563,7 +564,7 @@ void WorldRenderContext::InitializeCloudTextures()
     mShaderManager.SetTextureParameters<GameShaderSets::ProgramKind::CloudsDetailed>();
 }
 
-void WorldRenderContext::InitializeWorldTextures()
+void WorldRenderContext::InitializeWorldTextures(ThreadPool & threadPool)
 {
     // Load texture database
     auto worldTextureDatabase = TextureDatabase<GameTextureDatabases::WorldTextureDatabase>::Load(mAssetManager);
@@ -573,61 +574,37 @@ void WorldRenderContext::InitializeWorldTextures()
     mOceanTextureFrameSpecifications = worldTextureDatabase.GetGroup(GameTextureDatabases::WorldTextureGroups::Ocean).GetFrameSpecifications();
 
     // Create list of available textures for user
-    for (size_t i = 0; i < mOceanTextureFrameSpecifications.size(); ++i)
-    {
-        auto const & tfs = mOceanTextureFrameSpecifications[i];
-
-        auto originalTextureImage = mAssetManager.LoadTextureDatabaseFrameRGBA(
-            GameTextureDatabases::WorldTextureDatabase::DatabaseName,
-            tfs.RelativePath);
-        auto textureThumbnail = ImageTools::Resize(
-            originalTextureImage,
-            originalTextureImage.Size.ShrinkToFit(ThumbnailSize),
-            ImageTools::FilterKind::Bilinear);
-
-        assert(static_cast<size_t>(tfs.Metadata.FrameId.FrameIndex) == mOceanAvailableThumbnails.size());
-
-        mOceanAvailableThumbnails.emplace_back(
-            tfs.Metadata.DisplayName,
-            std::move(textureThumbnail));
-    }
+    MakeAvailableThumbnails(
+        mOceanTextureFrameSpecifications,
+        threadPool,
+        mOceanAvailableThumbnails);
 
     // Land
 
     mLandTextureFrameSpecifications = worldTextureDatabase.GetGroup(GameTextureDatabases::WorldTextureGroups::Land).GetFrameSpecifications();
 
     // Create list of available textures for user
-    for (size_t i = 0; i < mLandTextureFrameSpecifications.size(); ++i)
-    {
-        auto const & tfs = mLandTextureFrameSpecifications[i];
-
-        auto originalTextureImage = mAssetManager.LoadTextureDatabaseFrameRGBA(
-            GameTextureDatabases::WorldTextureDatabase::DatabaseName,
-            tfs.RelativePath);
-        auto textureThumbnail = ImageTools::Resize(
-            originalTextureImage,
-            originalTextureImage.Size.ShrinkToFit(ThumbnailSize),
-            ImageTools::FilterKind::Bilinear);
-
-        assert(static_cast<size_t>(tfs.Metadata.FrameId.FrameIndex) == mLandAvailableThumbnails.size());
-
-        mLandAvailableThumbnails.emplace_back(
-            tfs.Metadata.DisplayName,
-            std::move(textureThumbnail));
-    }
+    MakeAvailableThumbnails(
+        mLandTextureFrameSpecifications,
+        threadPool,
+        mLandAvailableThumbnails);
 }
 
-void WorldRenderContext::InitializeFishTextures()
+void WorldRenderContext::InitializeFishTextures(
+    ThreadPool & threadPool,
+    std::optional<std::filesystem::path> const & textureAtlasCacheFolderPath)
 {
     // Load texture database
     auto fishTextureDatabase = TextureDatabase<GameTextureDatabases::FishTextureDatabase>::Load(mAssetManager);
 
     // Create atlas
-    auto fishTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::FishTextureDatabase>::BuildAtlas(
+    auto fishTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::FishTextureDatabase>::BuildCachedAtlas(
         fishTextureDatabase,
         TextureAtlasOptions::MipMappable,
         1.0f,
         mAssetManager,
+        threadPool,
+        textureAtlasCacheFolderPath,
         SimpleProgressCallback::Dummy());
 
     LogMessage("Fish texture atlas size: ", fishTextureAtlas.Image.Size);
@@ -774,10 +751,12 @@ void WorldRenderContext::UploadCloudShadows(
 void WorldRenderContext::UploadLandStart(size_t slices)
 {
     //
-    // Last segments are not sticky: we upload them at each frame
+    // Land segments are sticky: we only get them when either the land
+    // or the visible world have changed
     //
 
     mLandSegmentBuffer.reset(slices + 1);
+    mIsLandSegmentBufferDirty = true;
 }
 
 void WorldRenderContext::UploadLandEnd()
@@ -1382,6 +1361,12 @@ void WorldRenderContext::RenderDrawOcean(bool opaquely, RenderParameters const &
 
 void WorldRenderContext::RenderPrepareOceanFloor(RenderParameters const & /*renderParameters*/)
 {
+    if (!mIsLandSegmentBufferDirty)
+    {
+        // Nothing new since last upload
+        return;
+    }
+
     glBindBuffer(GL_ARRAY_BUFFER, *mLandSegmentVBO);
 
     if (mLandSegmentVBOAllocatedVertexSize != mLandSegmentBuffer.size())
@@ -1400,6 +1385,8 @@ void WorldRenderContext::RenderPrepareOceanFloor(RenderParameters const & /*rend
     }
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    mIsLandSegmentBufferDirty = false;
 }
 
 void WorldRenderContext::RenderDrawOceanFloor(RenderParameters const & renderParameters)
@@ -2255,3 +2242,67 @@ void WorldRenderContext::RecalculateWorldBorder(RenderParameters const & renderP
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 }
+
+void WorldRenderContext::MakeAvailableThumbnails(
+    std::vector<TextureFrameSpecification<GameTextureDatabases::WorldTextureDatabase>> const & textureFrameSpecifications,
+    ThreadPool & threadPool,
+    std::vector<std::pair<std::string, RgbaImageData>> & availableThumbnails) const
+{
+    //
+    // Decode and shrink textures in parallel, as these are large images
+    //
+
+    std::vector<std::optional<RgbaImageData>> textureThumbnails(textureFrameSpecifications.size());
+
+    auto const makeThumbnail = [&](size_t i)
+        {
+            auto originalTextureImage = mAssetManager.LoadTextureDatabaseFrameRGBA(
+                GameTextureDatabases::WorldTextureDatabase::DatabaseName,
+                textureFrameSpecifications[i].RelativePath);
+
+            textureThumbnails[i].emplace(
+                ImageTools::Resize(
+                    originalTextureImage,
+                    originalTextureImage.Size.ShrinkToFit(ThumbnailSize),
+                    ImageTools::FilterKind::Bilinear));
+        };
+
+    {
+        size_t const parallelism = std::min(threadPool.GetParallelism(), textureFrameSpecifications.size());
+
+        std::vector<ThreadPool::Task> tasks;
+        for (size_t t = 0; t < parallelism; ++t)
+        {
+            tasks.emplace_back(
+                [&, t]()
+                {
+                    for (size_t i = t; i < textureFrameSpecifications.size(); i += parallelism)
+                    {
+                        makeThumbnail(i);
+                    }
+                });
+        }
+
+        if (!tasks.empty())
+        {
+            threadPool.Run(tasks);
+        }
+    }
+
+    for (size_t i = 0; i < textureFrameSpecifications.size(); ++i)
+    {
+        auto const & tfs = textureFrameSpecifications[i];
+
+        if (!textureThumbnails[i].has_value())
+        {
+            // Failed in its task (which swallows errors) - retry here, so to report errors
+            makeThumbnail(i);
+        }
+
+        assert(static_cast<size_t>(tfs.Metadata.FrameId.FrameIndex) == availableThumbnails.size());
+
+        availableThumbnails.emplace_back(
+            tfs.Metadata.DisplayName,
+            std::move(*textureThumbnails[i]));
+    }
+}
@@ -22,11 +22,13 @@
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
 #include <Core/TextureAtlas.h>
+#include <Core/ThreadPool.h>
 #include <Core/Vectors.h>
 
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
@@ -45,9 +47,11 @@ public:
 
     void InitializeCloudTextures();
 
-    void InitializeWorldTextures();
+    void InitializeWorldTextures(ThreadPool & threadPool);
 
-    void InitializeFishTextures();
+    void InitializeFishTextures(
+        ThreadPool & threadPool,
+        std::optional<std::filesystem::path> const & textureAtlasCacheFolderPath);
 
     void OnReset(RenderParameters const & renderParameters);
 
@@ -786,6 +790,11 @@ private:
     void RecalculateClearCanvasColor(RenderParameters const & renderParameters);
     void RecalculateWorldBorder(RenderParameters const & renderParameters);
 
+    void MakeAvailableThumbnails(
+        std::vector<TextureFrameSpecification<GameTextureDatabases::WorldTextureDatabase>> const & textureFrameSpecifications,
+        ThreadPool & threadPool,
+        std::vector<std::pair<std::string, RgbaImageData>> & availableThumbnails) const;
+
 private:
 
     IAssetManager const & mAssetManager;
@@ -1065,6 +1074,7 @@ private:
     size_t mCloudVBOAllocatedVertexSize;
 
     BoundedVector<LandSegment> mLandSegmentBuffer;
+    bool mIsLandSegmentBufferDirty; // Since last VBO upload
     GameOpenGLVBO mLandSegmentVBO;
     size_t mLandSegmentVBOAllocatedVertexSize;
 
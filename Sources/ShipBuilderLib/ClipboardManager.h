@@ -10,12 +10,16 @@
 
 #include <Simulation/Layers.h>
 
+#include <memory>
 #include <optional>
 
 namespace ShipBuilder {
 
 /*
  * Just a glorified optional<LayersRegion>, maintaining current clipboard and notifying of state changes.
+ *
+ * The content is immutable once in the clipboard, and it is shared - rather than cloned - with
+ * whoever pastes it; pasters that need to modify it are responsible for making their own copy.
  */
 class ClipboardManager final
 {
@@ -27,23 +31,31 @@ public:
 
     bool IsEmpty() const
     {
-        return !mClipboard.has_value();
+        return !mClipboard;
     }
 
-    std::optional<ShipLayers> const & GetContent() const
+    std::shared_ptr<ShipLayers const> const & GetContent() const
     {
         return mClipboard;
     }
 
     void SetContent(std::optional<ShipLayers> && content)
     {
-        mClipboard = std::move(content);
-        mUserInterface.OnClipboardChanged(mClipboard.has_value());
+        if (content.has_value())
+        {
+            mClipboard = std::make_shared<ShipLayers>(std::move(*content));
+        }
+        else
+        {
+            mClipboard.reset();
+        }
+
+        mUserInterface.OnClipboardChanged(!!mClipboard);
     }
 
 protected:
 
-    std::optional<ShipLayers> mClipboard;
+    std::shared_ptr<ShipLayers const> mClipboard;
 
     IUserInterface & mUserInterface;
 };
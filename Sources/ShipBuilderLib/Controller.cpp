@@ -19,7 +19,10 @@
 #include "Tools/TextureEraserTool.h"
 #include "Tools/TextureMagicWandTool.h"
 
+#include <Core/CompactBuffer2D.h>
+
 #include <cassert>
+#include <optional>
 
 namespace ShipBuilder {
 
@@ -311,7 +314,7 @@ std::optional<ShipSpaceRect> Controller::CalculateBoundingBox() const
     return mModelController->CalculateBoundingBox();
 }
 
-ModelValidationSession Controller::StartValidation() const
+std::unique_ptr<ModelValidationSession> Controller::StartValidation() const
 {
     auto scopedToolResumeState = SuspendTool();
 
@@ -812,12 +815,12 @@ void Controller::Cut()
 void Controller::Paste()
 {
     //
-    // Clone clipboard
+    // Share clipboard - the paste tool copies it only if and when it modifies it
     //
 
     assert(!mWorkbenchState.GetClipboardManager().IsEmpty());
 
-    ShipLayers clipboardClone = mWorkbenchState.GetClipboardManager().GetContent()->Clone();
+    std::shared_ptr<ShipLayers const> clipboardContent = mWorkbenchState.GetClipboardManager().GetContent();
 
     //
     // Nuke current tool
@@ -835,7 +838,7 @@ void Controller::Paste()
 
     LayerType currentVizLayer = VisualizationToLayer(mWorkbenchState.GetPrimaryVisualization());
 
-    if (clipboardClone.StructuralLayer)
+    if (clipboardContent->StructuralLayer)
     {
         if (!bestLayer || currentVizLayer == LayerType::Structural)
         {
@@ -843,7 +846,7 @@ void Controller::Paste()
         }
     }
 
-    if (clipboardClone.ElectricalLayer)
+    if (clipboardContent->ElectricalLayer)
     {
         if (!bestLayer || currentVizLayer == LayerType::Electrical)
         {
@@ -851,7 +854,7 @@ void Controller::Paste()
         }
     }
 
-    if (clipboardClone.RopesLayer)
+    if (clipboardContent->RopesLayer)
     {
         if (!bestLayer || currentVizLayer == LayerType::Ropes)
         {
@@ -859,7 +862,7 @@ void Controller::Paste()
         }
     }
 
-    if (clipboardClone.ExteriorTextureLayer)
+    if (clipboardContent->ExteriorTextureLayer)
     {
         if (!bestLayer || currentVizLayer == LayerType::ExteriorTexture)
         {
@@ -867,7 +870,7 @@ void Controller::Paste()
         }
     }
 
-    if (clipboardClone.InteriorTextureLayer)
+    if (clipboardContent->InteriorTextureLayer)
     {
         if (!bestLayer || currentVizLayer == LayerType::InteriorTexture)
         {
@@ -927,7 +930,7 @@ void Controller::Paste()
         case LayerType::Structural:
         {
             mCurrentTool = std::make_unique<StructuralPasteTool>(
-                std::move(clipboardClone),
+                clipboardContent,
                 mWorkbenchState.GetPasteIsTransparent(),
                 *this,
                 mGameAssetManager);
@@ -938,7 +941,7 @@ void Controller::Paste()
         case LayerType::Electrical:
         {
             mCurrentTool = std::make_unique<ElectricalPasteTool>(
-                std::move(clipboardClone),
+                clipboardContent,
                 mWorkbenchState.GetPasteIsTransparent(),
                 *this,
                 mGameAssetManager);
@@ -949,7 +952,7 @@ void Controller::Paste()
         case LayerType::Ropes:
         {
             mCurrentTool = std::make_unique<RopePasteTool>(
-                std::move(clipboardClone),
+                clipboardContent,
                 mWorkbenchState.GetPasteIsTransparent(),
                 *this,
                 mGameAssetManager);
@@ -960,7 +963,7 @@ void Controller::Paste()
         case LayerType::ExteriorTexture:
         {
             mCurrentTool = std::make_unique<ExteriorTexturePasteTool>(
-                std::move(clipboardClone),
+                clipboardContent,
                 mWorkbenchState.GetPasteIsTransparent(),
                 *this,
                 mGameAssetManager);
@@ -971,7 +974,7 @@ void Controller::Paste()
         case LayerType::InteriorTexture:
         {
             mCurrentTool = std::make_unique<InteriorTexturePasteTool>(
-                std::move(clipboardClone),
+                clipboardContent,
                 mWorkbenchState.GetPasteIsTransparent(),
                 *this,
                 mGameAssetManager);
@@ -1805,15 +1808,34 @@ void Controller::InternalPushUndoForWholeLayer(wxString const & title)
     if constexpr (TLayerType == LayerType::Electrical)
     {
         auto originalLayerClone = mModelController->CloneElectricalLayer();
-        auto const cloneByteSize = originalLayerClone ? originalLayerClone->Buffer.GetByteSize() : 0;
+
+        // Keep a compact snapshot of the buffer, as whole-layer snapshots are mostly empty
+        std::optional<CompactBuffer2D<ElectricalElement, struct ShipSpaceTag>> originalLayerSnapshot;
+        std::optional<ElectricalPanel> originalPanel;
+        if (originalLayerClone)
+        {
+            originalLayerSnapshot.emplace(originalLayerClone->Buffer);
+            originalPanel.emplace(std::move(originalLayerClone->Panel));
+            originalLayerClone.reset();
+        }
+
+        auto const cloneByteSize = originalLayerSnapshot ? originalLayerSnapshot->GetByteSize() : 0;
 
         mUndoStack.Push(
             title,
             cloneByteSize,
             originalDirtyStateClone,
-            [originalLayerClone = std::move(originalLayerClone)](Controller & controller) mutable
+            [originalLayerSnapshot = std::move(originalLayerSnapshot), originalPanel = std::move(originalPanel)](Controller & controller) mutable
             {
-                controller.RestoreElectricalLayerForUndo(std::move(originalLayerClone));
+                std::unique_ptr<ElectricalLayerData> originalLayer;
+                if (originalLayerSnapshot)
+                {
+                    originalLayer = std::make_unique<ElectricalLayerData>(
+                        originalLayerSnapshot->MakeBuffer(),
+                        std::move(*originalPanel));
+                }
+
+                controller.RestoreElectricalLayerForUndo(std::move(originalLayer));
             });
     }
     else if constexpr (TLayerType == LayerType::Ropes)
@@ -1834,22 +1856,46 @@ void Controller::InternalPushUndoForWholeLayer(wxString const & title)
     else if constexpr (TLayerType == LayerType::Structural)
     {
         auto originalLayerClone = mModelController->CloneStructuralLayer();
-        auto const cloneByteSize = originalLayerClone ? originalLayerClone->Buffer.GetByteSize() : 0;
+
+        // Keep a compact snapshot of the buffer, as whole-layer snapshots are mostly uniform
+        std::optional<CompactBuffer2D<StructuralElement, struct ShipSpaceTag>> originalLayerSnapshot;
+        if (originalLayerClone)
+        {
+            originalLayerSnapshot.emplace(originalLayerClone->Buffer);
+            originalLayerClone.reset();
+        }
+
+        auto const cloneByteSize = originalLayerSnapshot ? originalLayerSnapshot->GetByteSize() : 0;
 
         // Create undo action
         mUndoStack.Push(
             title,
             cloneByteSize,
             originalDirtyStateClone,
-            [originalLayerClone = std::move(originalLayerClone)](Controller & controller) mutable
+            [originalLayerSnapshot = std::move(originalLayerSnapshot)](Controller & controller) mutable
             {
-                controller.RestoreStructuralLayerForUndo(std::move(originalLayerClone));
+                std::unique_ptr<StructuralLayerData> originalLayer;
+                if (originalLayerSnapshot)
+                {
+                    originalLayer = std::make_unique<StructuralLayerData>(originalLayerSnapshot->MakeBuffer());
+                }
+
+                controller.RestoreStructuralLayerForUndo(std::move(originalLayer));
             });
     }
     else if constexpr (TLayerType == LayerType::ExteriorTexture)
     {
         auto originalLayerClone = mModelController->CloneExteriorTextureLayer();
-        auto const cloneByteSize = originalLayerClone ? originalLayerClone->Buffer.GetByteSize() : 0;
+
+        // Keep a compact snapshot of the buffer, as whole-layer snapshots are mostly uniform
+        std::optional<CompactBuffer2D<rgbaColor, struct ImageTag>> originalLayerSnapshot;
+        if (originalLayerClone)
+        {
+            originalLayerSnapshot.emplace(originalLayerClone->Buffer);
+            originalLayerClone.reset();
+        }
+
+        auto const cloneByteSize = originalLayerSnapshot ? originalLayerSnapshot->GetByteSize() : 0;
         auto originalTextureArtCredits = mModelController->GetShipMetadata().ArtCredits;
 
         // Create undo action
@@ -1857,10 +1903,16 @@ void Controller::InternalPushUndoForWholeLayer(wxString const & title)
             title,
             cloneByteSize,
             originalDirtyStateClone,
-            [originalLayerClone = std::move(originalLayerClone), originalTextureArtCredits = std::move(originalTextureArtCredits)](Controller & controller) mutable
+            [originalLayerSnapshot = std::move(originalLayerSnapshot), originalTextureArtCredits = std::move(originalTextureArtCredits)](Controller & controller) mutable
             {
+                std::unique_ptr<TextureLayerData> originalLayer;
+                if (originalLayerSnapshot)
+                {
+                    originalLayer = std::make_unique<TextureLayerData>(originalLayerSnapshot->MakeBuffer());
+                }
+
                 controller.RestoreExteriorTextureLayerForUndo(
-                    std::move(originalLayerClone),
+                    std::move(originalLayer),
                     std::move(originalTextureArtCredits));
             });
     }
@@ -1869,16 +1921,31 @@ void Controller::InternalPushUndoForWholeLayer(wxString const & title)
         static_assert(TLayerType == LayerType::InteriorTexture);
 
         auto originalLayerClone = mModelController->CloneInteriorTextureLayer();
-        auto const cloneByteSize = originalLayerClone ? originalLayerClone->Buffer.GetByteSize() : 0;
+
+        // Keep a compact snapshot of the buffer, as whole-layer snapshots are mostly uniform
+        std::optional<CompactBuffer2D<rgbaColor, struct ImageTag>> originalLayerSnapshot;
+        if (originalLayerClone)
+        {
+            originalLayerSnapshot.emplace(originalLayerClone->Buffer);
+            originalLayerClone.reset();
+        }
+
+        auto const cloneByteSize = originalLayerSnapshot ? originalLayerSnapshot->GetByteSize() : 0;
 
         // Create undo action
         mUndoStack.Push(
             title,
             cloneByteSize,
             originalDirtyStateClone,
-            [originalLayerClone = std::move(originalLayerClone)](Controller & controller) mutable
+            [originalLayerSnapshot = std::move(originalLayerSnapshot)](Controller & controller) mutable
             {
-                controller.RestoreInteriorTextureLayerForUndo(std::move(originalLayerClone));
+                std::unique_ptr<TextureLayerData> originalLayer;
+                if (originalLayerSnapshot)
+                {
+                    originalLayer = std::make_unique<TextureLayerData>(originalLayerSnapshot->MakeBuffer());
+                }
+
+                controller.RestoreInteriorTextureLayerForUndo(std::move(originalLayer));
             });
     }
 
@@ -122,7 +122,7 @@ public:
 
     std::optional<ShipSpaceRect> CalculateBoundingBox() const;
 
-    ModelValidationSession StartValidation() const;
+    std::unique_ptr<ModelValidationSession> StartValidation() const;
 
     //
     // Layer editing
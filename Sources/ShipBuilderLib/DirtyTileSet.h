@@ -0,0 +1,203 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Core/GameTypes.h>
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <vector>
+
+namespace ShipBuilder {
+
+/*
+ * Tracks dirty regions of a visualization as a set of fixed-size tiles, so that
+ * scattered edits - e.g. a long pencil stroke - do not collapse into their (large)
+ * bounding rectangle, and may be updated and uploaded tile-run by tile-run instead.
+ *
+ * Coordinates are non-negative; the tile grid grows as needed.
+ */
+template<typename TIntegralTag>
+class DirtyTileSet
+{
+public:
+
+    using rect_type = _IntegralRect<TIntegralTag>;
+
+    explicit DirtyTileSet(int tileSize)
+        : mTileSize(tileSize)
+        , mTiles()
+        , mTileGridWidth(0)
+        , mTileGridHeight(0)
+        , mDirtyTileCount(0)
+        , mBoundingRect()
+    {
+        assert(tileSize > 0);
+    }
+
+    bool IsEmpty() const
+    {
+        return !mBoundingRect.has_value();
+    }
+
+    std::optional<rect_type> const & GetBoundingRect() const
+    {
+        return mBoundingRect;
+    }
+
+    void Add(rect_type const & rect)
+    {
+        assert(rect.origin.x >= 0 && rect.origin.y >= 0);
+
+        if (rect.IsEmpty())
+        {
+            return;
+        }
+
+        int const tileStartX = rect.origin.x / mTileSize;
+        int const tileEndX = (rect.origin.x + rect.size.width - 1) / mTileSize + 1;
+        int const tileStartY = rect.origin.y / mTileSize;
+        int const tileEndY = (rect.origin.y + rect.size.height - 1) / mTileSize + 1;
+
+        EnsureTileGridSize(tileEndX, tileEndY);
+
+        for (int ty = tileStartY; ty < tileEndY; ++ty)
+        {
+            for (int tx = tileStartX; tx < tileEndX; ++tx)
+            {
+                auto && tile = mTiles[ty * mTileGridWidth + tx];
+                if (!tile)
+                {
+                    tile = true;
+                    ++mDirtyTileCount;
+                }
+            }
+        }
+
+        if (!mBoundingRect.has_value())
+        {
+            mBoundingRect = rect;
+        }
+        else
+        {
+            mBoundingRect->UnionWith(rect);
+        }
+    }
+
+    /*
+     * Returns the dirty regions, clipped to the specified bounds; one rectangle per
+     * horizontal run of dirty tiles, or - when most of the bounding rectangle is dirty
+     * anyway - just the bounding rectangle.
+     */
+    std::vector<rect_type> GetDirtyRects(rect_type const & bounds) const
+    {
+        std::vector<rect_type> dirtyRects;
+
+        if (!mBoundingRect.has_value())
+        {
+            return dirtyRects;
+        }
+
+        int const boundingTileStartX = mBoundingRect->origin.x / mTileSize;
+        int const boundingTileEndX = (mBoundingRect->origin.x + mBoundingRect->size.width - 1) / mTileSize + 1;
+        int const boundingTileStartY = mBoundingRect->origin.y / mTileSize;
+        int const boundingTileEndY = (mBoundingRect->origin.y + mBoundingRect->size.height - 1) / mTileSize + 1;
+
+        size_t const boundingTileCount = static_cast<size_t>(boundingTileEndX - boundingTileStartX) * static_cast<size_t>(boundingTileEndY - boundingTileStartY);
+        if (mDirtyTileCount * 2 > boundingTileCount)
+        {
+            // Not worth splitting
+            auto const clippedRect = mBoundingRect->MakeIntersectionWith(bounds);
+            if (clippedRect.has_value())
+            {
+                dirtyRects.push_back(*clippedRect);
+            }
+
+            return dirtyRects;
+        }
+
+        for (int ty = boundingTileStartY; ty < boundingTileEndY; ++ty)
+        {
+            for (int tx = boundingTileStartX; tx < boundingTileEndX; /* incremented in loop */)
+            {
+                if (!mTiles[ty * mTileGridWidth + tx])
+                {
+                    ++tx;
+                    continue;
+                }
+
+                // Find end of run
+                int runEndX = tx + 1;
+                while (runEndX < boundingTileEndX && mTiles[ty * mTileGridWidth + runEndX])
+                {
+                    ++runEndX;
+                }
+
+                auto const clippedRect = rect_type(
+                    _IntegralCoordinates<TIntegralTag>(tx * mTileSize, ty * mTileSize),
+                    _IntegralSize<TIntegralTag>((runEndX - tx) * mTileSize, mTileSize)).MakeIntersectionWith(bounds);
+
+                if (clippedRect.has_value())
+                {
+                    dirtyRects.push_back(*clippedRect);
+                }
+
+                tx = runEndX;
+            }
+        }
+
+        return dirtyRects;
+    }
+
+    void Clear()
+    {
+        if (mDirtyTileCount > 0)
+        {
+            std::fill(mTiles.begin(), mTiles.end(), false);
+            mDirtyTileCount = 0;
+        }
+
+        mBoundingRect.reset();
+    }
+
+private:
+
+    void EnsureTileGridSize(int width, int height)
+    {
+        if (width <= mTileGridWidth && height <= mTileGridHeight)
+        {
+            return;
+        }
+
+        int const newWidth = std::max(width, mTileGridWidth);
+        int const newHeight = std::max(height, mTileGridHeight);
+
+        std::vector<bool> newTiles(static_cast<size_t>(newWidth) * static_cast<size_t>(newHeight), false);
+        for (int ty = 0; ty < mTileGridHeight; ++ty)
+        {
+            for (int tx = 0; tx < mTileGridWidth; ++tx)
+            {
+                newTiles[ty * newWidth + tx] = mTiles[ty * mTileGridWidth + tx];
+            }
+        }
+
+        mTiles = std::move(newTiles);
+        mTileGridWidth = newWidth;
+        mTileGridHeight = newHeight;
+    }
+
+    int mTileSize;
+
+    std::vector<bool> mTiles; // Row-major
+    int mTileGridWidth;
+    int mTileGridHeight;
+    size_t mDirtyTileCount;
+
+    std::optional<rect_type> mBoundingRect;
+};
+
+}
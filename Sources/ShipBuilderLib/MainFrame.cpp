@@ -30,6 +30,7 @@
 #include <wx/cursor.h>
 #include <wx/gbsizer.h>
 #include <wx/msgdlg.h>
+#include <wx/progdlg.h>
 #include <wx/ribbon/art.h>
 #include <wx/sizer.h>
 #include <wx/statline.h>
@@ -37,7 +38,13 @@
 #include <wx/utils.h>
 #include <wx/wupdlock.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
 
 namespace ShipBuilder {
 
@@ -50,6 +57,11 @@ ImageSize constexpr MaterialSwathSize(50, 65);
 
 int constexpr MaxVisualizationTransparency = 128;
 
+// Saves shorter than this don't get to show progress
+std::chrono::milliseconds constexpr SaveProgressDialogDelay = std::chrono::milliseconds(250);
+std::chrono::milliseconds constexpr SaveProgressPollInterval = std::chrono::milliseconds(20);
+int constexpr MaxSaveProgress = 100;
+
 MainFrame::MainFrame(
     wxApp * mainApp,
     wxIcon const & icon,
@@ -57,7 +69,7 @@ MainFrame::MainFrame(
     LocalizationManager const & localizationManager,
     MaterialDatabase const & materialDatabase,
     ShipTexturizer const & shipTexturizer,
-    std::function<void(std::optional<std::filesystem::path>)> returnToGameFunctor,
+    std::function<void(std::optional<std::filesystem::path>, std::optional<ShipDefinition>)> returnToGameFunctor,
     ProgressCallback const & progressCallback)
     : mMainApp(mainApp)
     , mReturnToGameFunctor(std::move(returnToGameFunctor))
@@ -342,7 +354,6 @@ MainFrame::MainFrame(
                 mController->SetRopeMaterial(event.GetMaterial(), event.GetMaterialPlane());
             },
             mMaterialDatabase,
-            mShipTexturizer,
             mGameAssetManager,
             progressCallback.MakeSubCallback(0.0f, 0.8f));
     }
@@ -5243,10 +5254,11 @@ void MainFrame::SaveAndSwitchBackToGame()
     // Save/SaveAs
     if (DoSaveShipOrSaveShipAsWithValidation())
     {
-        // Return
+        // Return, handing over the ship as it is in memory, so that the game
+        // doesn't have to load back - and decode - what we've just saved
         assert(mCurrentShipFilePath.has_value());
         assert(ShipDeSerializer::IsShipDefinitionFile(*mCurrentShipFilePath));
-        SwitchBackToGame(*mCurrentShipFilePath);
+        SwitchBackToGame(*mCurrentShipFilePath, mController->MakeShipDefinition());
     }
 }
 
@@ -5272,7 +5284,7 @@ void MainFrame::QuitAndSwitchBackToGame()
         }
     }
 
-    SwitchBackToGame(std::nullopt);
+    SwitchBackToGame(std::nullopt, std::nullopt);
 }
 
 void MainFrame::Quit()
@@ -5281,7 +5293,9 @@ void MainFrame::Quit()
     Close();
 }
 
-void MainFrame::SwitchBackToGame(std::optional<std::filesystem::path> shipFilePath)
+void MainFrame::SwitchBackToGame(
+    std::optional<std::filesystem::path> shipFilePath,
+    std::optional<ShipDefinition> shipDefinition)
 {
     // Hide self
     Show(false);
@@ -5291,7 +5305,7 @@ void MainFrame::SwitchBackToGame(std::optional<std::filesystem::path> shipFilePa
 
     // Invoke functor to go back
     assert(mReturnToGameFunctor);
-    mReturnToGameFunctor(std::move(shipFilePath));
+    mReturnToGameFunctor(std::move(shipFilePath), std::move(shipDefinition));
 }
 
 void MainFrame::ImportLayerFromShip(LayerType layer)
@@ -5890,15 +5904,72 @@ void MainFrame::DoSaveShipWithoutValidation(std::filesystem::path const & shipFi
 
 void MainFrame::DoSaveShipDefinition(Controller const & controller, std::filesystem::path const & shipFilePath)
 {
-    // Get ship definition
-    auto shipDefinition = controller.MakeShipDefinition();
+    // Get ship definition - a snapshot of the ship, which the save works on
+    auto const shipDefinition = controller.MakeShipDefinition();
 
     assert(ShipDeSerializer::IsShipDefinitionFile(shipFilePath));
 
-    // Save ship
-    ShipDeSerializer::SaveShip(
-        shipDefinition,
-        shipFilePath);
+    //
+    // Save ship on a worker thread, keeping the UI alive - and showing progress,
+    // if the save is long enough to be noticed - until it's done
+    //
+
+    std::atomic<float> saveProgress(0.0f);
+    std::atomic<bool> isSaveCompleted(false);
+    std::exception_ptr saveException;
+
+    std::thread saveThread(
+        [&]()
+        {
+            try
+            {
+                ShipDeSerializer::SaveShip(
+                    shipDefinition,
+                    shipFilePath,
+                    SimpleProgressCallback([&saveProgress](float progress) { saveProgress.store(progress); }));
+            }
+            catch (...)
+            {
+                saveException = std::current_exception();
+            }
+
+            isSaveCompleted.store(true);
+        });
+
+    {
+        std::unique_ptr<wxProgressDialog> progressDialog;
+
+        auto const startTime = std::chrono::steady_clock::now();
+
+        while (!isSaveCompleted.load())
+        {
+            if (!progressDialog
+                && std::chrono::steady_clock::now() - startTime >= SaveProgressDialogDelay)
+            {
+                progressDialog = std::make_unique<wxProgressDialog>(
+                    _("Saving Ship"),
+                    wxString::Format(_("Saving \"%s\"..."), shipFilePath.filename().string()),
+                    MaxSaveProgress,
+                    this,
+                    wxPD_APP_MODAL | wxPD_SMOOTH);
+            }
+
+            if (progressDialog)
+            {
+                // Also dispatches pending events
+                progressDialog->Update(std::min(static_cast<int>(saveProgress.load() * MaxSaveProgress), MaxSaveProgress - 1));
+            }
+
+            std::this_thread::sleep_for(SaveProgressPollInterval);
+        }
+    }
+
+    saveThread.join();
+
+    if (saveException)
+    {
+        std::rethrow_exception(saveException);
+    }
 }
 
 bool MainFrame::DoPreSaveShipValidation()
@@ -5923,7 +5994,7 @@ void MainFrame::BailOut()
     }
     else
     {
-        SwitchBackToGame(std::nullopt);
+        SwitchBackToGame(std::nullopt, std::nullopt);
     }
 }
 
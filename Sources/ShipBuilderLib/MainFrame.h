@@ -79,7 +79,7 @@ public:
         LocalizationManager const & localizationManager,
         MaterialDatabase const & materialDatabase,
         ShipTexturizer const & shipTexturizer,
-        std::function<void(std::optional<std::filesystem::path>)> returnToGameFunctor,
+        std::function<void(std::optional<std::filesystem::path>, std::optional<ShipDefinition>)> returnToGameFunctor,
         ProgressCallback const & progressCallback);
 
     ~MainFrame();
@@ -232,7 +232,9 @@ private:
 
     void Quit();
 
-    void SwitchBackToGame(std::optional<std::filesystem::path> shipFilePath);
+    void SwitchBackToGame(
+        std::optional<std::filesystem::path> shipFilePath,
+        std::optional<ShipDefinition> shipDefinition);
 
     void ImportLayerFromShip(LayerType layer);
 
@@ -294,7 +296,7 @@ private:
 
     void DoSaveShipWithoutValidation(std::filesystem::path const & shipFilePath);
 
-    static void DoSaveShipDefinition(Controller const & controller, std::filesystem::path const & shipFilePath);
+    void DoSaveShipDefinition(Controller const & controller, std::filesystem::path const & shipFilePath);
 
     bool DoPreSaveShipValidation();
 
@@ -382,7 +384,7 @@ private:
 
     wxApp * const mMainApp;
 
-    std::function<void(std::optional<std::filesystem::path>)> const mReturnToGameFunctor;
+    std::function<void(std::optional<std::filesystem::path>, std::optional<ShipDefinition>)> const mReturnToGameFunctor;
 
     //
     // Owned members
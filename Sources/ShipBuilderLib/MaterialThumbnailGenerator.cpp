@@ -0,0 +1,267 @@
+/***************************************************************************************
+ * Original Author:     Gabriele Giuseppini
+ * Created:             2026-10-14
+ * Copyright:           Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "MaterialThumbnailGenerator.h"
+
+#include <Game/GameVersion.h>
+
+#include <Simulation/ShipTexturizer.h>
+
+#include <Core/GameChronometer.h>
+#include <Core/Log.h>
+#include <Core/ThreadManager.h>
+
+#include <cassert>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace ShipBuilder {
+
+MaterialThumbnailGenerator::MaterialThumbnailGenerator(
+    std::vector<StructuralMaterial const *> materials,
+    ImageSize const & thumbnailSize,
+    ShipAutoTexturizationSettings const & texturizationSettings,
+    std::optional<std::filesystem::path> cacheFilePath,
+    MaterialDatabase const & materialDatabase,
+    GameAssetManager const & gameAssetManager)
+    : mMaterials(std::move(materials))
+    , mThumbnailSize(thumbnailSize)
+    , mTexturizationSettings(texturizationSettings)
+    , mCacheFilePath(std::move(cacheFilePath))
+    , mMaterialDatabase(materialDatabase)
+    , mGameAssetManager(gameAssetManager)
+    , mReadyThumbnails()
+    , mReadyThumbnailsMutex()
+    , mHaveReadyThumbnailsBeenTaken(false)
+    , mWorkerThread()
+    , mIsStop(false)
+    , mIsWorkerCompleted(false)
+{
+    mWorkerThread = std::thread(&MaterialThumbnailGenerator::ThreadLoop, this);
+}
+
+MaterialThumbnailGenerator::~MaterialThumbnailGenerator()
+{
+    mIsStop.store(true);
+    mWorkerThread.join();
+}
+
+MaterialThumbnailGenerator::ThumbnailList MaterialThumbnailGenerator::TakeReadyThumbnails()
+{
+    // Thumbnails are published before the worker flags its completion, hence
+    // if it's completed now, we're taking the last ones
+    bool const isWorkerCompleted = mIsWorkerCompleted.load();
+
+    ThumbnailList readyThumbnails;
+
+    {
+        std::lock_guard<std::mutex> const lock(mReadyThumbnailsMutex);
+        readyThumbnails.swap(mReadyThumbnails);
+    }
+
+    if (isWorkerCompleted)
+    {
+        mHaveReadyThumbnailsBeenTaken = true;
+    }
+
+    return readyThumbnails;
+}
+
+void MaterialThumbnailGenerator::ThreadLoop()
+{
+    ThreadManager::InitializeThisBackgroundThread();
+
+    auto const startTime = GameChronometer::Now();
+
+    try
+    {
+        std::uint64_t const cacheKey = CalculateCacheKey();
+
+        //
+        // Try the cache first
+        //
+
+        if (auto cachedThumbnails = TryLoadCache(cacheKey); cachedThumbnails.has_value())
+        {
+            for (size_t m = 0; m < mMaterials.size(); ++m)
+            {
+                PublishThumbnail(m, std::move((*cachedThumbnails)[m]));
+            }
+
+            LogMessage("MaterialThumbnailGenerator: loaded ", mMaterials.size(), " thumbnails from cache:",
+                " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
+        }
+        else
+        {
+            //
+            // Make them, with our own texturizer - as the texturizer's texture cache is not thread-safe
+            //
+
+            ShipTexturizer const shipTexturizer(mMaterialDatabase, mGameAssetManager);
+
+            std::vector<RgbaImageData> thumbnails;
+            thumbnails.reserve(mMaterials.size());
+
+            for (size_t m = 0; m < mMaterials.size(); ++m)
+            {
+                if (mIsStop.load())
+                {
+                    // Abandoned
+                    mIsWorkerCompleted.store(true);
+                    return;
+                }
+
+                RgbaImageData thumbnail = shipTexturizer.MakeMaterialTextureSample(
+                    mTexturizationSettings,
+                    mThumbnailSize,
+                    *mMaterials[m],
+                    mGameAssetManager);
+
+                thumbnails.emplace_back(thumbnail.Clone());
+
+                PublishThumbnail(m, std::move(thumbnail));
+            }
+
+            LogMessage("MaterialThumbnailGenerator: made ", mMaterials.size(), " thumbnails:",
+                " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
+
+            SaveCache(cacheKey, thumbnails);
+        }
+    }
+    catch (std::exception const & ex)
+    {
+        // Materials will just keep their placeholders
+        LogMessage("MaterialThumbnailGenerator: error making thumbnails: ", ex.what());
+    }
+
+    mIsWorkerCompleted.store(true);
+}
+
+std::uint64_t MaterialThumbnailGenerator::CalculateCacheKey() const
+{
+    // FNV-1a, which - unlike std::hash - is stable across runs and builds
+
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto const hashString = [&hash](std::string const & str)
+        {
+            for (char const c : str)
+            {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            }
+
+            // Separator
+            hash ^= 0xffu;
+            hash *= 0x100000001b3ull;
+        };
+
+    // Material textures come with the game
+    hashString(CurrentGameVersion.ToString());
+
+    hashString(std::to_string(mThumbnailSize.width) + "x" + std::to_string(mThumbnailSize.height));
+    hashString(std::to_string(static_cast<int>(mTexturizationSettings.Mode))
+        + ":" + std::to_string(mTexturizationSettings.MaterialTextureMagnification)
+        + ":" + std::to_string(mTexturizationSettings.MaterialTextureTransparency));
+
+    for (StructuralMaterial const * material : mMaterials)
+    {
+        hashString(material->Name);
+        hashString(material->RenderColor.toString());
+        hashString(material->MaterialTextureName.value_or(""));
+    }
+
+    return hash;
+}
+
+std::optional<std::vector<RgbaImageData>> MaterialThumbnailGenerator::TryLoadCache(std::uint64_t cacheKey) const
+{
+    if (!mCacheFilePath.has_value())
+    {
+        return std::nullopt;
+    }
+
+    //
+    // File layout: key, count, thumbnails' pixels
+    //
+
+    std::ifstream file(*mCacheFilePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        // Not cached yet
+        return std::nullopt;
+    }
+
+    std::uint64_t key;
+    std::uint32_t count;
+    file.read(reinterpret_cast<char *>(&key), sizeof(key));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+    if (!file || key != cacheKey || count != mMaterials.size())
+    {
+        // Stale
+        LogMessage("MaterialThumbnailGenerator: thumbnail cache \"", mCacheFilePath->string(), "\" is stale");
+        return std::nullopt;
+    }
+
+    std::vector<RgbaImageData> thumbnails;
+    thumbnails.reserve(count);
+    for (std::uint32_t t = 0; t < count; ++t)
+    {
+        RgbaImageData thumbnail(mThumbnailSize);
+        file.read(reinterpret_cast<char *>(thumbnail.Data.get()), thumbnail.GetByteSize());
+        if (!file)
+        {
+            // Truncated
+            return std::nullopt;
+        }
+
+        thumbnails.emplace_back(std::move(thumbnail));
+    }
+
+    return thumbnails;
+}
+
+void MaterialThumbnailGenerator::SaveCache(
+    std::uint64_t cacheKey,
+    std::vector<RgbaImageData> const & thumbnails) const
+{
+    if (!mCacheFilePath.has_value())
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(mCacheFilePath->parent_path(), ec);
+
+    std::ofstream file(*mCacheFilePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        // Not a problem, we'll just make them again next time
+        LogMessage("MaterialThumbnailGenerator: cannot write thumbnail cache \"", mCacheFilePath->string(), "\"");
+        return;
+    }
+
+    std::uint32_t const count = static_cast<std::uint32_t>(thumbnails.size());
+    file.write(reinterpret_cast<char const *>(&cacheKey), sizeof(cacheKey));
+    file.write(reinterpret_cast<char const *>(&count), sizeof(count));
+    for (auto const & thumbnail : thumbnails)
+    {
+        assert(thumbnail.Size == mThumbnailSize);
+        file.write(reinterpret_cast<char const *>(thumbnail.Data.get()), thumbnail.GetByteSize());
+    }
+}
+
+void MaterialThumbnailGenerator::PublishThumbnail(
+    size_t materialIndex,
+    RgbaImageData && thumbnail)
+{
+    std::lock_guard<std::mutex> const lock(mReadyThumbnailsMutex);
+    mReadyThumbnails.emplace_back(mMaterials[materialIndex], std::move(thumbnail));
+}
+
+}
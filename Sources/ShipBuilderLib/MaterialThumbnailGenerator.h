@@ -0,0 +1,106 @@
+/***************************************************************************************
+ * Original Author:     Gabriele Giuseppini
+ * Created:             2026-10-14
+ * Copyright:           Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include <Game/GameAssetManager.h>
+
+#include <Simulation/Materials.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/ShipAutoTexturizationSettings.h>
+
+#include <Core/ImageData.h>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ShipBuilder {
+
+/*
+ * Makes the thumbnails of structural materials - samples of their textures - on a background
+ * thread, handing them out as they become ready.
+ *
+ * Thumbnails are cached in a file, keyed by a hash of the materials and of the thumbnail
+ * parameters, so that they are only made again when any of those changes.
+ */
+class MaterialThumbnailGenerator final
+{
+public:
+
+    using ThumbnailList = std::vector<std::pair<StructuralMaterial const *, RgbaImageData>>;
+
+    MaterialThumbnailGenerator(
+        std::vector<StructuralMaterial const *> materials,
+        ImageSize const & thumbnailSize,
+        ShipAutoTexturizationSettings const & texturizationSettings,
+        std::optional<std::filesystem::path> cacheFilePath,
+        MaterialDatabase const & materialDatabase,
+        GameAssetManager const & gameAssetManager);
+
+    /*
+     * Abandons the thumbnails not made yet.
+     */
+    ~MaterialThumbnailGenerator();
+
+    MaterialThumbnailGenerator(MaterialThumbnailGenerator const &) = delete;
+    MaterialThumbnailGenerator & operator=(MaterialThumbnailGenerator const &) = delete;
+
+    /*
+     * Invoked on the main thread; returns the thumbnails that have become ready since
+     * the previous invocation.
+     */
+    ThumbnailList TakeReadyThumbnails();
+
+    /*
+     * Whether there won't be any more thumbnails, i.e. all of them have been taken, or
+     * they can't be made.
+     */
+    bool IsCompleted() const
+    {
+        return mIsWorkerCompleted.load() && mHaveReadyThumbnailsBeenTaken;
+    }
+
+private:
+
+    void ThreadLoop();
+
+    std::uint64_t CalculateCacheKey() const;
+
+    std::optional<std::vector<RgbaImageData>> TryLoadCache(std::uint64_t cacheKey) const;
+
+    void SaveCache(
+        std::uint64_t cacheKey,
+        std::vector<RgbaImageData> const & thumbnails) const;
+
+    void PublishThumbnail(
+        size_t materialIndex,
+        RgbaImageData && thumbnail);
+
+private:
+
+    std::vector<StructuralMaterial const *> const mMaterials;
+    ImageSize const mThumbnailSize;
+    ShipAutoTexturizationSettings const mTexturizationSettings;
+    std::optional<std::filesystem::path> const mCacheFilePath;
+    MaterialDatabase const & mMaterialDatabase;
+    GameAssetManager const & mGameAssetManager;
+
+    // Made by the worker, and taken by the main thread
+    ThumbnailList mReadyThumbnails;
+    std::mutex mReadyThumbnailsMutex;
+    bool mHaveReadyThumbnailsBeenTaken; // Only touched by the main thread
+
+    std::thread mWorkerThread;
+    std::atomic<bool> mIsStop;
+    std::atomic<bool> mIsWorkerCompleted;
+};
+
+}
@@ -21,7 +21,9 @@ Model::Model(
         nullptr,
         nullptr)
     , mDirtyState()
+    , mLayerVersions()
 {
+    mLayerVersions.fill(0);
 }
 
 Model::Model(ShipDefinition && shipDefinition)
@@ -30,7 +32,9 @@ Model::Model(ShipDefinition && shipDefinition)
     , mShipAutoTexturizationSettings(shipDefinition.AutoTexturizationSettings)
     , mLayers(std::move(shipDefinition.Layers))
     , mDirtyState()
+    , mLayerVersions()
 {
+    mLayerVersions.fill(0);
 }
 
 ShipDefinition Model::MakeShipDefinition() const
@@ -54,6 +58,8 @@ void Model::SetStructuralLayer(StructuralLayerData && structuralLayer)
 
     // Update layer
     mLayers.StructuralLayer.reset(new StructuralLayerData(std::move(structuralLayer)));
+
+    BumpLayerVersion(LayerType::Structural);
 }
 
 std::unique_ptr<StructuralLayerData> Model::CloneStructuralLayer() const
@@ -72,6 +78,8 @@ void Model::RestoreStructuralLayer(std::unique_ptr<StructuralLayerData> structur
 {
     // Replace layer
     mLayers.StructuralLayer = std::move(structuralLayer);
+
+    BumpLayerVersion(LayerType::Structural);
 }
 
 void Model::SetElectricalLayer(ElectricalLayerData && electricalLayer)
@@ -80,12 +88,16 @@ void Model::SetElectricalLayer(ElectricalLayerData && electricalLayer)
 
     // Update layer
     mLayers.ElectricalLayer.reset(new ElectricalLayerData(std::move(electricalLayer)));
+
+    BumpLayerVersion(LayerType::Electrical);
 }
 
 void Model::RemoveElectricalLayer()
 {
     // Remove layer
     mLayers.ElectricalLayer.reset();
+
+    BumpLayerVersion(LayerType::Electrical);
 }
 
 std::unique_ptr<ElectricalLayerData> Model::CloneElectricalLayer() const
@@ -104,18 +116,24 @@ void Model::RestoreElectricalLayer(std::unique_ptr<ElectricalLayerData> electric
 {
     // Replace layer
     mLayers.ElectricalLayer = std::move(electricalLayer);
+
+    BumpLayerVersion(LayerType::Electrical);
 }
 
 void Model::SetRopesLayer(RopesLayerData && ropesLayer)
 {
     // Update layer
     mLayers.RopesLayer.reset(new RopesLayerData(std::move(ropesLayer)));
+
+    BumpLayerVersion(LayerType::Ropes);
 }
 
 void Model::RemoveRopesLayer()
 {
     // Remove layer
     mLayers.RopesLayer.reset();
+
+    BumpLayerVersion(LayerType::Ropes);
 }
 
 std::unique_ptr<RopesLayerData> Model::CloneRopesLayer() const
@@ -134,18 +152,24 @@ void Model::RestoreRopesLayer(std::unique_ptr<RopesLayerData> ropesLayer)
 {
     // Replace layer
     mLayers.RopesLayer = std::move(ropesLayer);
+
+    BumpLayerVersion(LayerType::Ropes);
 }
 
 void Model::SetExteriorTextureLayer(TextureLayerData && exteriorTextureLayer)
 {
     // Update layer
     mLayers.ExteriorTextureLayer.reset(new TextureLayerData(std::move(exteriorTextureLayer)));
+
+    BumpLayerVersion(LayerType::ExteriorTexture);
 }
 
 void Model::RemoveExteriorTextureLayer()
 {
     // Remove layer
     mLayers.ExteriorTextureLayer.reset();
+
+    BumpLayerVersion(LayerType::ExteriorTexture);
 }
 
 std::unique_ptr<TextureLayerData> Model::CloneExteriorTextureLayer() const
@@ -164,18 +188,24 @@ void Model::RestoreExteriorTextureLayer(std::unique_ptr<TextureLayerData> exteri
 {
     // Replace layer
     mLayers.ExteriorTextureLayer = std::move(exteriorTextureLayer);
+
+    BumpLayerVersion(LayerType::ExteriorTexture);
 }
 
 void Model::SetInteriorTextureLayer(TextureLayerData && interiorTextureLayer)
 {
     // Update layer
     mLayers.InteriorTextureLayer.reset(new TextureLayerData(std::move(interiorTextureLayer)));
+
+    BumpLayerVersion(LayerType::InteriorTexture);
 }
 
 void Model::RemoveInteriorTextureLayer()
 {
     // Remove layer
     mLayers.InteriorTextureLayer.reset();
+
+    BumpLayerVersion(LayerType::InteriorTexture);
 }
 
 std::unique_ptr<TextureLayerData> Model::CloneInteriorTextureLayer() const
@@ -194,6 +224,8 @@ void Model::RestoreInteriorTextureLayer(std::unique_ptr<TextureLayerData> interi
 {
     // Replace layer
     mLayers.InteriorTextureLayer = std::move(interiorTextureLayer);
+
+    BumpLayerVersion(LayerType::InteriorTexture);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -100,6 +101,8 @@ public:
     {
         assert(mLayers.ElectricalLayer);
         mLayers.ElectricalLayer->Panel = std::move(electricalPanel);
+
+        BumpLayerVersion(LayerType::Electrical);
     }
 
     bool HasLayer(LayerType layer) const
@@ -149,6 +152,12 @@ public:
     void SetDirtyState(ModelDirtyState const & dirtyState)
     {
         mDirtyState = dirtyState;
+
+        // The dirty state is restored by undo, which might have touched any layer
+        for (size_t l = 0; l < LayerCount; ++l)
+        {
+            BumpLayerVersion(static_cast<LayerType>(l));
+        }
     }
 
     bool GetIsDirty() const
@@ -165,6 +174,8 @@ public:
     {
         mDirtyState.IsLayerDirtyMap[static_cast<size_t>(layer)] = true;
         mDirtyState.GlobalIsDirty = true;
+
+        BumpLayerVersion(layer);
     }
 
     void ClearIsDirty()
@@ -178,6 +189,15 @@ public:
         mDirtyState.RecalculateGlobalIsDirty();
     }
 
+    /*
+     * Changes whenever the layer is modified, replaced, or removed; unlike the dirty state,
+     * it is never reset, hence it tells whether a layer has changed since any given time.
+     */
+    std::uint64_t GetLayerVersion(LayerType layer) const
+    {
+        return mLayerVersions[static_cast<size_t>(layer)];
+    }
+
     template<LayerType TLayer>
     typename LayerTypeTraits<TLayer>::layer_data_type CloneExistingLayer() const
     {
@@ -302,6 +322,11 @@ private:
 
     static std::unique_ptr<StructuralLayerData> MakeNewEmptyStructuralLayer(ShipSpaceSize const & shipSize);
 
+    void BumpLayerVersion(LayerType layer)
+    {
+        ++mLayerVersions[static_cast<size_t>(layer)];
+    }
+
 private:
 
     ShipMetadata mShipMetadata;
@@ -316,6 +341,9 @@ private:
 
     // Dirty state
     ModelDirtyState mDirtyState;
+
+    // Layer versions
+    std::array<std::uint64_t, LayerCount> mLayerVersions;
 };
 
 }
\ No newline at end of file
@@ -5,11 +5,16 @@
 ***************************************************************************************/
 #include "ModelController.h"
 
+#include "ScanlineFloodFill.h"
+#include "StructureTracer.h"
+
 #include <cassert>
-#include <queue>
 
 namespace ShipBuilder {
 
+// Size (in ship space) of the tiles we track dirty visualizations with
+int constexpr DirtyVisualizationTileSize = 16;
+
 std::unique_ptr<ModelController> ModelController::CreateNew(
     ShipSpaceSize const & shipSpaceSize,
     std::string const & shipName,
@@ -45,6 +50,7 @@ ModelController::ModelController(
     , mCenterOfMassSum(vec2f::zero())
     , mInstancedElectricalElementSet()
     , mElectricalParticleCount(0)
+    , mValidationCache()
     /////
     , mGameVisualizationMode(GameVisualizationModeType::None)
     , mGameVisualizationAutoTexturizationTexture()
@@ -57,6 +63,8 @@ ModelController::ModelController(
     , mRopesLayerVisualizationMode(RopesLayerVisualizationModeType::None)
     , mExteriorTextureLayerVisualizationMode(ExteriorTextureLayerVisualizationModeType::None)
     , mInteriorTextureLayerVisualizationMode(InteriorTextureLayerVisualizationModeType::None)
+    , mDirtyGameVisualizationRegion(DirtyVisualizationTileSize)
+    , mDirtyStructuralLayerVisualizationRegion(DirtyVisualizationTileSize)
     /////
     , mIsStructuralLayerInEphemeralVisualization(false)
     , mIsElectricalLayerInEphemeralVisualization(false)
@@ -140,10 +148,11 @@ std::optional<ShipSpaceRect> ModelController::CalculateBoundingBox() const
     return boundingBox;
 }
 
-ModelValidationSession ModelController::StartValidation(Finalizer && finalizer) const
+std::unique_ptr<ModelValidationSession> ModelController::StartValidation(Finalizer && finalizer) const
 {
-    return ModelValidationSession(
+    return std::make_unique<ModelValidationSession>(
         mModel,
+        mValidationCache,
         std::move(finalizer));
 }
 
@@ -856,209 +865,6 @@ void ModelController::Restore(GenericUndoPayload && undoPayload)
     }
 }
 
-GenericEphemeralVisualizationRestorePayload ModelController::PasteForEphemeralVisualization(
-    ShipLayers const & sourcePayload,
-    ShipSpaceCoordinates const & pasteOrigin,
-    bool isTransparent)
-{
-    //
-    // Structural, Electrical, Ropes
-    //
-
-    ShipSpaceCoordinates actualPasteOriginShip = pasteOrigin;
-
-    std::optional<typename LayerTypeTraits<LayerType::Structural>::buffer_type> structuralLayerUndoBufferRegion;
-    std::optional<typename LayerTypeTraits<LayerType::Electrical>::buffer_type> electricalLayerUndoBufferRegion;
-    std::optional<typename LayerTypeTraits<LayerType::Ropes>::buffer_type> ropesLayerUndoBuffer;
-
-    std::optional<ShipSpaceRect> const affectedTargetRectShip =
-        ShipSpaceRect(pasteOrigin, sourcePayload.Size)
-        .MakeIntersectionWith(GetWholeShipRect());
-
-    if (affectedTargetRectShip.has_value())
-    {
-        assert(!affectedTargetRectShip->IsEmpty());
-
-        // Adjust paste origin
-        actualPasteOriginShip = affectedTargetRectShip->origin;
-
-        // Calculate affected source region
-        ShipSpaceRect const affectedSourceRegion(
-            ShipSpaceCoordinates(0, 0) + (actualPasteOriginShip - pasteOrigin),
-            affectedTargetRectShip->size);
-
-        if (sourcePayload.StructuralLayer && mModel.HasLayer(LayerType::Structural))
-        {
-            assert(!mIsStructuralLayerInEphemeralVisualization);
-
-            // Prepare undo
-            structuralLayerUndoBufferRegion = mModel.GetStructuralLayer().Buffer.CloneRegion(*affectedTargetRectShip);
-
-            // Paste
-            DoStructuralRegionBufferPaste(
-                sourcePayload.StructuralLayer->Buffer,
-                affectedSourceRegion,
-                actualPasteOriginShip,
-                isTransparent);
-
-            // Remember we are in temp visualization now
-            mIsStructuralLayerInEphemeralVisualization = true;
-        }
-
-        if (sourcePayload.ElectricalLayer && mModel.HasLayer(LayerType::Electrical))
-        {
-            assert(!mIsElectricalLayerInEphemeralVisualization);
-
-            // Prepare undo
-            electricalLayerUndoBufferRegion = mModel.GetElectricalLayer().Buffer.CloneRegion(*affectedTargetRectShip);
-
-            // Paste
-            DoElectricalRegionBufferPaste(
-                sourcePayload.ElectricalLayer->Buffer,
-                affectedSourceRegion,
-                actualPasteOriginShip,
-                isTransparent
-                    ? [](ElectricalElement const & src, ElectricalElement const & dst) -> ElectricalElement const &
-                    {
-                        return src.Material
-                            ? src
-                            : dst;
-                    }
-                    : [](ElectricalElement const & src, ElectricalElement const &) -> ElectricalElement const &
-                    {
-                        return src;
-                    });
-
-            // Remember we are in temp visualization now
-            mIsElectricalLayerInEphemeralVisualization = true;
-        }
-
-        if (sourcePayload.RopesLayer && mModel.HasLayer(LayerType::Ropes))
-        {
-            assert(!mIsRopesLayerInEphemeralVisualization);
-
-            // Prepare undo
-            ropesLayerUndoBuffer = mModel.GetRopesLayer().Buffer.Clone();
-
-            // Paste
-            DoRopesRegionBufferPaste(
-                sourcePayload.RopesLayer->Buffer,
-                affectedSourceRegion,
-                actualPasteOriginShip,
-                isTransparent);
-
-            // Remember we are in temp visualization now
-            mIsRopesLayerInEphemeralVisualization = true;
-        }
-    }
-
-    //
-    // Exterior Texture
-    //
-
-    std::optional<typename LayerTypeTraits<LayerType::ExteriorTexture>::buffer_type> exteriorTextureLayerUndoBufferRegion;
-
-    if (sourcePayload.ExteriorTextureLayer && mModel.HasLayer(LayerType::ExteriorTexture))
-    {
-        ImageCoordinates const pasteOriginTexture = ShipSpaceToExteriorTextureSpace(pasteOrigin);
-
-        ImageCoordinates actualPasteOriginTexture = pasteOriginTexture;
-
-        std::optional<ImageRect> const affectedTargetRectTexture =
-            ImageRect(pasteOriginTexture, sourcePayload.ExteriorTextureLayer->Buffer.Size)
-            .MakeIntersectionWith(GetWholeExteriorTextureRect());
-
-        if (affectedTargetRectTexture)
-        {
-            assert(!affectedTargetRectTexture->IsEmpty());
-
-            // Adjust paste origin
-            actualPasteOriginTexture = affectedTargetRectTexture->origin;
-
-            // Calculate affected source region
-            ImageRect const affectedSourceRegion(
-                ImageCoordinates(0, 0) + (actualPasteOriginTexture - pasteOriginTexture),
-                affectedTargetRectTexture->size);
-
-            if (sourcePayload.ExteriorTextureLayer && mModel.HasLayer(LayerType::ExteriorTexture)) // Rotfl - just for code structure symmetry
-            {
-                assert(!mIsExteriorTextureLayerInEphemeralVisualization);
-
-                // Prepare undo
-                exteriorTextureLayerUndoBufferRegion = mModel.GetExteriorTextureLayer().Buffer.CloneRegion(*affectedTargetRectTexture);
-
-                // Paste
-                DoExteriorTextureRegionBufferPaste(
-                    sourcePayload.ExteriorTextureLayer->Buffer,
-                    affectedSourceRegion,
-                    *affectedTargetRectTexture,
-                    actualPasteOriginTexture,
-                    isTransparent);
-
-                // Remember we are in temp visualization now
-                mIsExteriorTextureLayerInEphemeralVisualization = true;
-            }
-        }
-    }
-
-    //
-    // Interior Texture
-    //
-
-    std::optional<typename LayerTypeTraits<LayerType::InteriorTexture>::buffer_type> interiorTextureLayerUndoBufferRegion;
-
-    if (sourcePayload.InteriorTextureLayer && mModel.HasLayer(LayerType::InteriorTexture))
-    {
-        ImageCoordinates const pasteOriginTexture = ShipSpaceToInteriorTextureSpace(pasteOrigin);
-
-        ImageCoordinates actualPasteOriginTexture = pasteOriginTexture;
-
-        std::optional<ImageRect> const affectedTargetRectTexture =
-            ImageRect(pasteOriginTexture, sourcePayload.InteriorTextureLayer->Buffer.Size)
-            .MakeIntersectionWith(GetWholeInteriorTextureRect());
-
-        if (affectedTargetRectTexture)
-        {
-            assert(!affectedTargetRectTexture->IsEmpty());
-
-            // Adjust paste origin
-            actualPasteOriginTexture = affectedTargetRectTexture->origin;
-
-            // Calculate affected source region
-            ImageRect const affectedSourceRegion(
-                ImageCoordinates(0, 0) + (actualPasteOriginTexture - pasteOriginTexture),
-                affectedTargetRectTexture->size);
-
-            if (sourcePayload.InteriorTextureLayer && mModel.HasLayer(LayerType::InteriorTexture)) // Rotfl - just for code structure symmetry
-            {
-                assert(!mIsInteriorTextureLayerInEphemeralVisualization);
-
-                // Prepare undo
-                interiorTextureLayerUndoBufferRegion = mModel.GetInteriorTextureLayer().Buffer.CloneRegion(*affectedTargetRectTexture);
-
-                // Paste
-                DoInteriorTextureRegionBufferPaste(
-                    sourcePayload.InteriorTextureLayer->Buffer,
-                    affectedSourceRegion,
-                    *affectedTargetRectTexture,
-                    actualPasteOriginTexture,
-                    isTransparent);
-
-                // Remember we are in temp visualization now
-                mIsInteriorTextureLayerInEphemeralVisualization = true;
-            }
-        }
-    }
-
-    return GenericEphemeralVisualizationRestorePayload(
-        actualPasteOriginShip,
-        std::move(structuralLayerUndoBufferRegion),
-        std::move(electricalLayerUndoBufferRegion),
-        std::move(ropesLayerUndoBuffer),
-        std::move(exteriorTextureLayerUndoBufferRegion),
-        std::move(interiorTextureLayerUndoBufferRegion));
-}
-
 void ModelController::RestoreEphemeralVisualization(GenericEphemeralVisualizationRestorePayload && restorePayload)
 {
     for (LayerType const affectedLayerType : restorePayload.GetAffectedLayers())
@@ -1446,15 +1252,7 @@ void ModelController::StructuralRegionFillForEphemeralVisualization(
     // Update model with just material - no analyses
     //
 
-    auto & structuralLayerBuffer = mModel.GetStructuralLayer().Buffer;
-
-    for (int y = region.origin.y; y < region.origin.y + region.size.height; ++y)
-    {
-        for (int x = region.origin.x; x < region.origin.x + region.size.width; ++x)
-        {
-            structuralLayerBuffer[ShipSpaceCoordinates(x, y)].Material = material;
-        }
-    }
+    mModel.GetStructuralLayer().Buffer.FillRegion(region, StructuralElement(material));
 
     //
     // Update visualization
@@ -2664,10 +2462,11 @@ void ModelController::UpdateVisualizations(
             mGameVisualizationAutoTexturizationTexture = std::make_unique<RgbaImageData>(mGameVisualizationTexture->Size);
         }
 
-        if (mDirtyGameVisualizationRegion.has_value())
+        // Update and upload visualization, one run of dirty tiles at a time
+        for (ShipSpaceRect const & dirtyRegion : mDirtyGameVisualizationRegion.GetDirtyRects(GetWholeShipRect()))
         {
             // Update visualization
-            ImageRect const dirtyTextureRegion = UpdateGameVisualization(*mDirtyGameVisualizationRegion, gameAssetManager);
+            ImageRect const dirtyTextureRegion = UpdateGameVisualization(dirtyRegion, gameAssetManager);
 
             // Upload visualization
             if (dirtyTextureRegion != ImageRect(mGameVisualizationTexture->Size))
@@ -2703,7 +2502,7 @@ void ModelController::UpdateVisualizations(
         }
     }
 
-    mDirtyGameVisualizationRegion.reset();
+    mDirtyGameVisualizationRegion.Clear();
 
     // Structural
 
@@ -2715,7 +2514,7 @@ void ModelController::UpdateVisualizations(
             mStructuralLayerVisualizationTexture = std::make_unique<RgbaImageData>(ImageSize(mModel.GetShipSize().width, mModel.GetShipSize().height));
         }
 
-        if (mDirtyStructuralLayerVisualizationRegion.has_value())
+        if (!mDirtyStructuralLayerVisualizationRegion.IsEmpty())
         {
             // Refresh viz mode
             if (mStructuralLayerVisualizationMode == StructuralLayerVisualizationModeType::MeshMode)
@@ -2728,30 +2527,34 @@ void ModelController::UpdateVisualizations(
                 view.SetStructuralLayerVisualizationDrawMode(View::StructuralLayerVisualizationDrawMode::PixelMode);
             }
 
-            // Update visualization
-            ImageRect const dirtyTextureRegion = UpdateStructuralLayerVisualization(*mDirtyStructuralLayerVisualizationRegion);
-
-            // Upload visualization
-            if (dirtyTextureRegion != ImageRect(mStructuralLayerVisualizationTexture->Size))
+            // Update and upload visualization, one run of dirty tiles at a time
+            for (ShipSpaceRect const & dirtyRegion : mDirtyStructuralLayerVisualizationRegion.GetDirtyRects(GetWholeShipRect()))
             {
-                //
-                // For better performance, we only upload the dirty sub-texture
-                //
-
-                auto subTexture = RgbaImageData(dirtyTextureRegion.size);
-                subTexture.BlitFromRegion(
-                    *mStructuralLayerVisualizationTexture,
-                    dirtyTextureRegion,
-                    { 0, 0 });
+                // Update visualization
+                ImageRect const dirtyTextureRegion = UpdateStructuralLayerVisualization(dirtyRegion);
 
-                view.UpdateStructuralLayerVisualization(
-                    subTexture,
-                    dirtyTextureRegion.origin);
-            }
-            else
-            {
-                // Upload whole texture
-                view.UploadStructuralLayerVisualization(*mStructuralLayerVisualizationTexture);
+                // Upload visualization
+                if (dirtyTextureRegion != ImageRect(mStructuralLayerVisualizationTexture->Size))
+                {
+                    //
+                    // For better performance, we only upload the dirty sub-texture
+                    //
+
+                    auto subTexture = RgbaImageData(dirtyTextureRegion.size);
+                    subTexture.BlitFromRegion(
+                        *mStructuralLayerVisualizationTexture,
+                        dirtyTextureRegion,
+                        { 0, 0 });
+
+                    view.UpdateStructuralLayerVisualization(
+                        subTexture,
+                        dirtyTextureRegion.origin);
+                }
+                else
+                {
+                    // Upload whole texture
+                    view.UploadStructuralLayerVisualization(*mStructuralLayerVisualizationTexture);
+                }
             }
         }
     }
@@ -2765,7 +2568,7 @@ void ModelController::UpdateVisualizations(
         }
     }
 
-    mDirtyStructuralLayerVisualizationRegion.reset();
+    mDirtyStructuralLayerVisualizationRegion.Clear();
 
     // Electrical
 
@@ -3127,140 +2930,15 @@ typename LayerTypeTraits<LayerType::Structural>::buffer_type ModelController::Ma
     StructuralMaterial const * fillMaterial,
     std::uint8_t alphaThreshold) const
 {
-    // Here we map the texture coords to the ship coords in the same "texturing" fashion as we do for rendering;
-    // we do this because the texture for a particle at ship coords (x, y) is sampled at the center of the
-    // texture's quad for that particle.
-    //
-    // Here we want to calculate the ship rect whose tessellation guarantees coverage of this texture rect.
-    // By observing that the pixel at coordinate t is covered by the line between ship coordinate s(t) and s(t+1),
-    // we set edge particles as follows:
-    //  Out->In transition: we detect entering texture image at texture coordinates t; assuming more particles will
-    //                      follow, we place an edge particle at s(t)
-    //  In-Out transition: we detecting leaving texture image at texture coordinates t; assuming there were particles
-    //                      earlier (at s(t-1)), we place an edge particle at s(t-1) + 1
-    //
-    // The formula for s(t) is the "texturization" one, i.s. e = (t - o/2) / o, where o is the number of texture
-    // pixels in one ship quad.
-
-    //
-    // Allocate buffer and make it clear (fully "transparent")
-    //
-
-    auto newStructureRegionBuffer = LayerTypeTraits<LayerType::Structural>::buffer_type(shipRect.size);
-    newStructureRegionBuffer.Fill(StructuralElement(nullptr));
-
-    //
-    // Prepare passes
-    //
-
-    auto const & exteriorTextureLayerBuffer = mModel.GetExteriorTextureLayer().Buffer;
-
-    vec2f const shipToTexture = GetShipSpaceToTextureSpaceFactor(GetShipSize(), GetExteriorTextureSize());
-
-    auto const writeParticle = [&](ShipSpaceCoordinates s, bool isEdge) -> void
-    {
-        if (s.IsInSize(shipRect.size))
-        {
-            if (isEdge)
-            {
-                // Always wins
-                newStructureRegionBuffer[s] = StructuralElement(edgeMaterial);
-            }
-            else if (newStructureRegionBuffer[s].Material == nullptr)
-            {
-                // Only if first time
-                newStructureRegionBuffer[s] = StructuralElement(fillMaterial);
-            }
-        }
-    };
-
-    //
-    // Vertical pass - bottom -> up
-    //
-
-    for (int tx = textureRect.origin.x; tx < textureRect.origin.x + textureRect.size.width; ++tx)
-    {
-        // Calculate s.x once for entire scan line
-        int sx = static_cast<int>(std::floorf(static_cast<float>(tx) / shipToTexture.x)) - shipRect.origin.x;
-
-        // Init state at ty = 0
-        bool isScanLineFull = exteriorTextureLayerBuffer[{tx, textureRect.origin.y}].a > alphaThreshold;
-
-        for (int ty = textureRect.origin.y + 1; ty < textureRect.origin.y + textureRect.size.height; ++ty)
-        {
-            bool const isPixelFull = exteriorTextureLayerBuffer[{tx, ty}].a > alphaThreshold;
-
-            if (!isScanLineFull && isPixelFull)
-            {
-                // Out->In
-
-                // Place at s(t)
-                int const sy = static_cast<int>(std::floorf(static_cast<float>(ty) / shipToTexture.y - 0.5f));
-                writeParticle({ sx, sy - shipRect.origin.y }, true);
-            }
-            else if (isScanLineFull && !isPixelFull)
-            {
-                // In->Out
-
-                // Place at s(t-1) + 1
-                int const sy = static_cast<int>(std::floorf(static_cast<float>(ty - 1) / shipToTexture.y - 0.5f)) + 1;
-                writeParticle({ sx, sy - shipRect.origin.y }, true);
-            }
-            else if (isScanLineFull && isPixelFull)
-            {
-                // Filler - at s(t)
-                int const sy = static_cast<int>(std::floorf(static_cast<float>(ty) / shipToTexture.y - 0.5f));
-                writeParticle({ sx, sy - shipRect.origin.y }, false);
-            }
-
-            isScanLineFull = isPixelFull;
-        }
-    }
-
-    //
-    // Horizontal pass - left->right
-    //
-
-    for (int ty = textureRect.origin.y; ty < textureRect.origin.y + textureRect.size.height; ++ty)
-    {
-        // Calculate s.y once for entire scan line
-        int sy = static_cast<int>(std::floorf(static_cast<float>(ty) / shipToTexture.y)) - shipRect.origin.y;
-
-        // Init state at tx = 0
-        bool isScanLineFull = exteriorTextureLayerBuffer[{textureRect.origin.x, ty}].a > alphaThreshold;
-
-        for (int tx = textureRect.origin.x + 1; tx < textureRect.origin.x + textureRect.size.width; ++tx)
-        {
-            bool const isPixelFull = exteriorTextureLayerBuffer[{tx, ty}].a > alphaThreshold;
-
-            if (!isScanLineFull && isPixelFull)
-            {
-                // Out->In
-
-                // Place at s(t)
-                int const sx = static_cast<int>(std::floorf(static_cast<float>(tx) / shipToTexture.x - 0.5f));
-                writeParticle({ sx - shipRect.origin.x, sy }, true);
-            }
-            else if (isScanLineFull && !isPixelFull)
-            {
-                // In->Out
-
-                // Place at s(t-1) + 1
-                int const sx = static_cast<int>(std::floorf(static_cast<float>(tx - 1) / shipToTexture.x - 0.5f)) + 1;
-                writeParticle({ sx - shipRect.origin.x, sy }, true);
-            }
-            else if (isScanLineFull && isPixelFull)
-            {
-                // Filler - at s(t)
-                int const sx = static_cast<int>(std::floorf(static_cast<float>(tx) / shipToTexture.x - 0.5f));
-                writeParticle({ sx - shipRect.origin.x, sy }, false);
-            }
-
-            isScanLineFull = isPixelFull;
-        }
-    }
-
-    return newStructureRegionBuffer;
+    return StructureTracer::MakeTrace(
+        mModel.GetExteriorTextureLayer().Buffer,
+        textureRect,
+        shipRect,
+        GetShipSpaceToTextureSpaceFactor(GetShipSize(), GetExteriorTextureSize()),
+        edgeMaterial,
+        fillMaterial,
+        alphaThreshold,
+        StructureTracer::GetDefaultParallelism());
 }
 
 void ModelController::WriteParticle(
@@ -3421,45 +3099,35 @@ std::optional<ShipSpaceRect> ModelController::DoFlood(
         // Flood from point
         //
 
-        //
-        // Init visit from this point
-        //
-
-        WriteParticle(start, material);
-        ShipSpaceRect affectedRect(start);
-
-        std::queue<ShipSpaceCoordinates> pointsToPropagateFrom;
-        pointsToPropagateFrom.push(start);
-
-        //
-        // Propagate
-        //
+        std::optional<ShipSpaceRect> affectedRect;
 
-        auto const checkPropagateToNeighbor = [&](ShipSpaceCoordinates neighborCoords)
-        {
-            if (neighborCoords.IsInSize(shipSize) && layer.Buffer[neighborCoords].Material == startMaterial)
+        ScanlineFloodFill<false>(
+            start,
+            shipSize,
+            [&](ShipSpaceCoordinates const & coords) -> bool
+            {
+                return layer.Buffer[coords].Material == startMaterial;
+            },
+            [&](int y, int startX, int endX)
             {
-                // Visit point
-                WriteParticle(neighborCoords, material);
-                affectedRect.UnionWith(neighborCoords);
+                for (int x = startX; x < endX; ++x)
+                {
+                    WriteParticle({ x, y }, material);
+                }
 
-                // Propagate from point
-                pointsToPropagateFrom.push(neighborCoords);
-            }
-        };
+                ShipSpaceRect const spanRect(ShipSpaceCoordinates(startX, y), ShipSpaceSize(endX - startX, 1));
+                if (!affectedRect.has_value())
+                {
+                    affectedRect = spanRect;
+                }
+                else
+                {
+                    affectedRect->UnionWith(spanRect);
+                }
+            },
+            [](ShipSpaceCoordinates const &) {});
 
-        while (!pointsToPropagateFrom.empty())
-        {
-            // Pop point that we have to propagate from
-            auto const currentPoint = pointsToPropagateFrom.front();
-            pointsToPropagateFrom.pop();
-
-            // Push neighbors
-            checkPropagateToNeighbor({ currentPoint.x - 1, currentPoint.y });
-            checkPropagateToNeighbor({ currentPoint.x + 1, currentPoint.y });
-            checkPropagateToNeighbor({ currentPoint.x, currentPoint.y - 1 });
-            checkPropagateToNeighbor({ currentPoint.x, currentPoint.y + 1 });
-        }
+        assert(affectedRect.has_value());
 
         return affectedRect;
     }
@@ -3540,12 +3208,16 @@ std::optional<ImageRect> ModelController::DoTextureMagicWandEraseBackground(
     // Transform tolerance into max distance (included)
     float const maxColorDistance = static_cast<float>(tolerance) / 100.0f;
 
-    // Save original alpha mask for neighbors
-    Buffer2D<typename rgbaColor::data_type, ImageTag> originalAlphaMask = layer.Buffer.Transform<typename rgbaColor::data_type>(
-        [](rgbaColor const & color) -> typename rgbaColor::data_type
-        {
-            return color.a;
-        });
+    // Save original alpha mask for neighbors, if we need it
+    std::optional<Buffer2D<typename rgbaColor::data_type, ImageTag>> originalAlphaMask;
+    if (isAntiAlias)
+    {
+        originalAlphaMask.emplace(layer.Buffer.Transform<typename rgbaColor::data_type>(
+            [](rgbaColor const & color) -> typename rgbaColor::data_type
+            {
+                return color.a;
+            }));
+    }
 
     // Initialize affected region
     ImageRect affectedRegion(start); // We're sure we'll erase the start pixel
@@ -3553,7 +3225,8 @@ std::optional<ImageRect> ModelController::DoTextureMagicWandEraseBackground(
     // Anti-alias functor
     auto const doAntiAliasNeighbor = [&](ImageCoordinates const & neighborCoordinates) -> void
     {
-        layer.Buffer[neighborCoordinates].a = originalAlphaMask[neighborCoordinates] / 3;
+        assert(originalAlphaMask.has_value());
+        layer.Buffer[neighborCoordinates].a = (*originalAlphaMask)[neighborCoordinates] / 3;
         affectedRegion.UnionWith(neighborCoordinates);
     };
 
@@ -3563,48 +3236,33 @@ std::optional<ImageRect> ModelController::DoTextureMagicWandEraseBackground(
         // Flood from starting point
         //
 
-        std::queue<ImageCoordinates> pixelsToPropagateFrom;
-
-        // Erase this pixel
-        layer.Buffer[start].a = 0;
-        affectedRegion.UnionWith(start);
-
-        // Visit from here
-        pixelsToPropagateFrom.push(start);
-
-        while (!pixelsToPropagateFrom.empty())
-        {
-            auto const sourceCoords = pixelsToPropagateFrom.front();
-            pixelsToPropagateFrom.pop();
-
-            // Check neighbors
-            for (int yn = sourceCoords.y - 1; yn <= sourceCoords.y + 1; ++yn)
+        ScanlineFloodFill<true>(
+            start,
+            textureSize,
+            [&](ImageCoordinates const & coords) -> bool
             {
-                for (int xn = sourceCoords.x - 1; xn <= sourceCoords.x + 1; ++xn)
+                return layer.Buffer[coords].a != 0
+                    && distanceFromSeed(layer.Buffer[coords].toVec3f()) <= maxColorDistance;
+            },
+            [&](int y, int startX, int endX)
+            {
+                // Erase these pixels
+                for (int x = startX; x < endX; ++x)
                 {
-                    ImageCoordinates const neighborCoordinates{ xn, yn };
-                    if (neighborCoordinates.IsInSize(textureSize)
-                        && layer.Buffer[neighborCoordinates].a != 0)
-                    {
-                        // Check distance
-                        if (distanceFromSeed(layer.Buffer[neighborCoordinates].toVec3f()) <= maxColorDistance)
-                        {
-                            // Erase this pixel
-                            layer.Buffer[neighborCoordinates].a = 0;
-                            affectedRegion.UnionWith(neighborCoordinates);
+                    layer.Buffer[{ x, y }].a = 0;
+                }
 
-                            // Continue visit from here
-                            pixelsToPropagateFrom.push(neighborCoordinates);
-                        }
-                        else if (isAntiAlias)
-                        {
-                            // Anti-alias this neighbor
-                            doAntiAliasNeighbor(neighborCoordinates);
-                        }
-                    }
+                affectedRegion.UnionWith(ImageRect(ImageCoordinates(startX, y), ImageSize(endX - startX, 1)));
+            },
+            [&](ImageCoordinates const & coords)
+            {
+                // Pixels that are too distant but still exist get anti-aliased;
+                // erased pixels have no alpha anymore
+                if (isAntiAlias && layer.Buffer[coords].a != 0)
+                {
+                    doAntiAliasNeighbor(coords);
                 }
-            }
-        }
+            });
     }
     else
     {
@@ -3964,25 +3622,11 @@ void ModelController::RegisterDirtyVisualization(TRect const & region)
 {
     if constexpr (TVisualization == VisualizationType::Game)
     {
-        if (!mDirtyGameVisualizationRegion.has_value())
-        {
-            mDirtyGameVisualizationRegion = region;
-        }
-        else
-        {
-            mDirtyGameVisualizationRegion->UnionWith(region);
-        }
+        mDirtyGameVisualizationRegion.Add(region);
     }
     else if constexpr (TVisualization == VisualizationType::StructuralLayer)
     {
-        if (!mDirtyStructuralLayerVisualizationRegion.has_value())
-        {
-            mDirtyStructuralLayerVisualizationRegion = region;
-        }
-        else
-        {
-            mDirtyStructuralLayerVisualizationRegion->UnionWith(region);
-        }
+        mDirtyStructuralLayerVisualizationRegion.Add(region);
     }
     else if constexpr (TVisualization == VisualizationType::ElectricalLayer)
     {
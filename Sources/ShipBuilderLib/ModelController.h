@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "DirtyTileSet.h"
 #include "GenericEphemeralVisualizationRestorePayload.h"
 #include "GenericUndoPayload.h"
 #include "IModelObservable.h"
@@ -117,7 +118,7 @@ public:
         mModel.ClearIsDirty();
     }
 
-    ModelValidationSession StartValidation(Finalizer && finalizer) const;
+    std::unique_ptr<ModelValidationSession> StartValidation(Finalizer && finalizer) const;
 
 #ifdef _DEBUG
     bool IsInEphemeralVisualization() const
@@ -235,11 +236,6 @@ public:
 
     void Restore(GenericUndoPayload && undoPayload);
 
-    GenericEphemeralVisualizationRestorePayload PasteForEphemeralVisualization(
-        ShipLayers const & sourcePayload,
-        ShipSpaceCoordinates const & pasteOrigin,
-        bool isTransparent);
-
     void RestoreEphemeralVisualization(GenericEphemeralVisualizationRestorePayload && restorePayload);
 
     std::vector<LayerType> CalculateAffectedLayers(ShipLayers const & otherSource) const;
@@ -730,6 +726,9 @@ private:
     InstancedElectricalElementSet mInstancedElectricalElementSet;
     size_t mElectricalParticleCount;
 
+    // Results of previous validations
+    mutable ModelValidationCache mValidationCache;
+
     //
     // Visualizations
     //
@@ -752,8 +751,8 @@ private:
     InteriorTextureLayerVisualizationModeType mInteriorTextureLayerVisualizationMode;
 
     // Regions whose visualization needs to be *updated* and *uploaded*
-    std::optional<ShipSpaceRect> mDirtyGameVisualizationRegion;
-    std::optional<ShipSpaceRect> mDirtyStructuralLayerVisualizationRegion;
+    DirtyTileSet<struct ShipSpaceTag> mDirtyGameVisualizationRegion;
+    DirtyTileSet<struct ShipSpaceTag> mDirtyStructuralLayerVisualizationRegion;
     std::optional<ShipSpaceRect> mDirtyElectricalLayerVisualizationRegion;
     std::optional<ShipSpaceRect> mDirtyRopesLayerVisualizationRegion;
     std::optional<ImageRect> mDirtyExteriorTextureLayerVisualizationRegion;
@@ -12,63 +12,168 @@ namespace ShipBuilder {
 
 ModelValidationSession::ModelValidationSession(
     Model const & model,
+    ModelValidationCache & cache,
     Finalizer && finalizer)
     : mModel(model)
+    , mCache(cache)
     , mFinalizer(std::move(finalizer))
     , mValidationSteps()
-    , mCurrentStep(0)
+    , mLayerVersions()
+    , mPendingSteps()
+    , mCachedStepsCount(0)
+    , mWorkerThread()
+    , mCompletedPendingStepsCount(0)
+    , mIsStopRequested(false)
+    , mWorkerException()
 {
+    for (size_t l = 0; l < LayerCount; ++l)
+    {
+        mLayerVersions[l] = mModel.GetLayerVersion(static_cast<LayerType>(l));
+    }
+
+    InitializeValidationSteps();
+
+    // Pick up results of steps whose layers haven't changed since they were calculated
+    for (size_t s = 0; s < mValidationSteps.size(); ++s)
+    {
+        auto & step = mValidationSteps[s];
+
+        step.Results = mCache.TryGet(step.Type, step.Dependencies, mLayerVersions);
+        if (step.Results.has_value())
+        {
+            ++mCachedStepsCount;
+        }
+        else
+        {
+            mPendingSteps.push_back(s);
+        }
+    }
+
+    // Run the others in the background
+    if (!mPendingSteps.empty())
+    {
+        mWorkerThread = std::thread(&ModelValidationSession::RunPendingSteps, this);
+    }
 }
 
-std::optional<ModelValidationResults> ModelValidationSession::DoNext()
+ModelValidationSession::~ModelValidationSession()
 {
-    if (mValidationSteps.empty())
+    if (mWorkerThread.joinable())
     {
-        InitializeValidationSteps();
+        mIsStopRequested.store(true);
+        mWorkerThread.join();
     }
+}
 
-    if (mCurrentStep < mValidationSteps.size())
+std::optional<ModelValidationResults> ModelValidationSession::PollResults()
+{
+    if (mCompletedPendingStepsCount.load(std::memory_order_acquire) < mPendingSteps.size())
     {
-        mValidationSteps[mCurrentStep]();
-        ++mCurrentStep;
+        // Still running
         return std::nullopt;
     }
-    else
+
+    if (mWorkerThread.joinable())
+    {
+        mWorkerThread.join();
+    }
+
+    if (mWorkerException)
+    {
+        std::rethrow_exception(mWorkerException);
+    }
+
+    //
+    // We're done - update cache and assemble results
+    //
+
+    ModelValidationResults results;
+
+    for (auto const & step : mValidationSteps)
     {
-        // We're done
-        return mResults;
+        assert(step.Results.has_value());
+
+        mCache.Store(step.Type, mLayerVersions, *step.Results);
+
+        for (auto const & issue : step.Results->GetIssues())
+        {
+            results.AddIssue(issue);
+        }
     }
+
+    return results;
 }
 
 /////////////////////////////////////////////////////////////////
 
 void ModelValidationSession::InitializeValidationSteps()
 {
-    // Initialize validations (can't do in cctor)
     assert(mValidationSteps.empty());
+
+    auto const addStep = [this](
+        ModelValidationCache::StepType type,
+        std::vector<LayerType> && dependencies,
+        void (ModelValidationSession::*run)(ModelValidationResults &) const)
+    {
+        mValidationSteps.push_back({
+            type,
+            std::move(dependencies),
+            [this, run](ModelValidationResults & results)
+            {
+                (this->*run)(results);
+            },
+            std::nullopt });
+    };
+
     if (mModel.HasLayer(LayerType::Structural))
     {
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::PrevisitStructuralLayer, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::CheckEmptyStructuralLayer, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::CheckStructureTooLarge, this));
+        addStep(ModelValidationCache::StepType::StructuralLayer, { LayerType::Structural }, &ModelValidationSession::ValidateStructuralLayer);
     }
+
     if (mModel.HasLayer(LayerType::Electrical))
     {
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::PrevisitElectricalLayer, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::CheckElectricalSubstratum, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::CheckTooManyLights, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::CheckTooManyElectricalPanelElements, this));
-        mValidationSteps.emplace_back(std::bind(&ModelValidationSession::ValidateElectricalConnectivity, this));
+        addStep(ModelValidationCache::StepType::ElectricalSubstratum, { LayerType::Structural, LayerType::Electrical, LayerType::Ropes }, &ModelValidationSession::CheckElectricalSubstratum);
+        addStep(ModelValidationCache::StepType::ElectricalElements, { LayerType::Electrical }, &ModelValidationSession::ValidateElectricalElements);
+        addStep(ModelValidationCache::StepType::ElectricalConnectivity, { LayerType::Electrical }, &ModelValidationSession::ValidateElectricalConnectivity);
+    }
+}
+
+void ModelValidationSession::RunPendingSteps()
+{
+    try
+    {
+        for (size_t const s : mPendingSteps)
+        {
+            if (mIsStopRequested.load())
+            {
+                return;
+            }
+
+            ModelValidationResults stepResults;
+            mValidationSteps[s].Run(stepResults);
+            mValidationSteps[s].Results.emplace(std::move(stepResults));
+
+            mCompletedPendingStepsCount.fetch_add(1, std::memory_order_release);
+        }
+    }
+    catch (...)
+    {
+        mWorkerException = std::current_exception();
+        mCompletedPendingStepsCount.store(mPendingSteps.size(), std::memory_order_release);
     }
 }
 
-void ModelValidationSession::PrevisitStructuralLayer()
+void ModelValidationSession::ValidateStructuralLayer(ModelValidationResults & results) const
 {
     assert(mModel.HasLayer(LayerType::Structural));
 
     StructuralLayerData const & structuralLayer = mModel.GetStructuralLayer();
 
-    mStructuralParticlesCount = 0;
+    //
+    // Visit structural layer
+    //
+
+    size_t structuralParticlesCount = 0;
 
     for (int y = 0; y < structuralLayer.Buffer.Size.height; ++y)
     {
@@ -76,67 +181,89 @@ void ModelValidationSession::PrevisitStructuralLayer()
         {
             if (structuralLayer.Buffer[{x, y}].Material != nullptr)
             {
-                ++mStructuralParticlesCount;
+                ++structuralParticlesCount;
             }
         }
     }
-}
 
-void ModelValidationSession::CheckEmptyStructuralLayer()
-{
-    mResults.AddIssue(
+    //
+    // Check empty structural layer
+    //
+
+    results.AddIssue(
         ModelValidationIssue::CheckClassType::EmptyStructuralLayer,
-        (mStructuralParticlesCount == 0) ? ModelValidationIssue::SeverityType::Error : ModelValidationIssue::SeverityType::Success);
-}
+        (structuralParticlesCount == 0) ? ModelValidationIssue::SeverityType::Error : ModelValidationIssue::SeverityType::Success);
 
-void ModelValidationSession::CheckStructureTooLarge()
-{
-    if (mStructuralParticlesCount != 0)
+    //
+    // Check structure too large
+    //
+
+    if (structuralParticlesCount != 0)
     {
         size_t constexpr MaxStructuralParticles = 100000;
 
-        mResults.AddIssue(
+        results.AddIssue(
             ModelValidationIssue::CheckClassType::StructureTooLarge,
-            (mStructuralParticlesCount > MaxStructuralParticles) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
+            (structuralParticlesCount > MaxStructuralParticles) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
     }
 }
 
-void ModelValidationSession::PrevisitElectricalLayer()
+void ModelValidationSession::CheckElectricalSubstratum(ModelValidationResults & results) const
 {
     assert(mModel.HasLayer(LayerType::Electrical));
 
-    mElectricalParticlesWithNoStructuralSubstratumCount = 0;
-    mLightEmittingParticlesCount = 0;
-    mVisibleElectricalPanelElementsCount = 0;
-
-    //
-    // Visit electrical layer
-    //
-
     StructuralLayerData const & structuralLayer = mModel.GetStructuralLayer();
     ElectricalLayerData const & electricalLayer = mModel.GetElectricalLayer();
-    std::optional<RopesLayerData> const & ropesLayer = mModel.HasLayer(LayerType::Ropes)
-        ? mModel.GetRopesLayer()
-        : std::optional<RopesLayerData>();
+    RopesLayerData const * const ropesLayer = mModel.HasLayer(LayerType::Ropes)
+        ? &(mModel.GetRopesLayer())
+        : nullptr;
+
+    size_t electricalParticlesWithNoStructuralSubstratumCount = 0;
 
     assert(structuralLayer.Buffer.Size == electricalLayer.Buffer.Size);
     for (int y = 0; y < structuralLayer.Buffer.Size.height; ++y)
     {
         for (int x = 0; x < structuralLayer.Buffer.Size.width; ++x)
+        {
+            auto const coords = ShipSpaceCoordinates(x, y);
+            if (electricalLayer.Buffer[coords].Material != nullptr
+                && structuralLayer.Buffer[coords].Material == nullptr
+                && (ropesLayer == nullptr || !ropesLayer->Buffer.HasEndpointAt(coords)))
+            {
+                ++electricalParticlesWithNoStructuralSubstratumCount;
+            }
+        }
+    }
+
+    results.AddIssue(
+        ModelValidationIssue::CheckClassType::MissingElectricalSubstratum,
+        (electricalParticlesWithNoStructuralSubstratumCount > 0) ? ModelValidationIssue::SeverityType::Error : ModelValidationIssue::SeverityType::Success);
+}
+
+void ModelValidationSession::ValidateElectricalElements(ModelValidationResults & results) const
+{
+    assert(mModel.HasLayer(LayerType::Electrical));
+
+    ElectricalLayerData const & electricalLayer = mModel.GetElectricalLayer();
+
+    //
+    // Visit electrical layer
+    //
+
+    size_t lightEmittingParticlesCount = 0;
+    size_t visibleElectricalPanelElementsCount = 0;
+
+    for (int y = 0; y < electricalLayer.Buffer.Size.height; ++y)
+    {
+        for (int x = 0; x < electricalLayer.Buffer.Size.width; ++x)
         {
             auto const coords = ShipSpaceCoordinates(x, y);
             auto const electricalMaterial = electricalLayer.Buffer[coords].Material;
             if (electricalMaterial != nullptr)
             {
-                if (structuralLayer.Buffer[coords].Material == nullptr
-                    && (!ropesLayer.has_value() || !ropesLayer->Buffer.HasEndpointAt(coords)))
-                {
-                    ++mElectricalParticlesWithNoStructuralSubstratumCount;
-                }
-
                 if (electricalMaterial->Luminiscence != 0.0f)
                 {
-                    ++mLightEmittingParticlesCount;
+                    ++lightEmittingParticlesCount;
                 }
 
                 if (electricalMaterial->IsInstanced)
@@ -145,47 +272,35 @@ void ModelValidationSession::PrevisitElectricalLayer()
                     if (auto const searchIt = electricalLayer.Panel.Find(electricalLayer.Buffer[coords].InstanceIndex);
                         searchIt == electricalLayer.Panel.end() || !searchIt->second.IsHidden)
                     {
-                        ++mVisibleElectricalPanelElementsCount;
+                        ++visibleElectricalPanelElementsCount;
                     }
                 }
             }
         }
     }
-}
-
-void ModelValidationSession::CheckElectricalSubstratum()
-{
-    assert(mModel.HasLayer(LayerType::Electrical));
-
-    mResults.AddIssue(
-        ModelValidationIssue::CheckClassType::MissingElectricalSubstratum,
-        (mElectricalParticlesWithNoStructuralSubstratumCount > 0) ? ModelValidationIssue::SeverityType::Error : ModelValidationIssue::SeverityType::Success);
-}
 
-void ModelValidationSession::CheckTooManyLights()
-{
-    assert(mModel.HasLayer(LayerType::Electrical));
+    //
+    // Check too many lights
+    //
 
     size_t constexpr MaxLightEmittingParticles = 5000;
 
-    mResults.AddIssue(
+    results.AddIssue(
         ModelValidationIssue::CheckClassType::TooManyLights,
-        (mLightEmittingParticlesCount > MaxLightEmittingParticles) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
-}
+        (lightEmittingParticlesCount > MaxLightEmittingParticles) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
 
-void ModelValidationSession::CheckTooManyElectricalPanelElements()
-{
-    assert(mModel.HasLayer(LayerType::Electrical));
+    //
+    // Check too many electrical panel elements
+    //
 
     size_t constexpr MaxVisibleElectricalPanelElements = 22;
 
-    mResults.AddIssue(
+    results.AddIssue(
         ModelValidationIssue::CheckClassType::TooManyVisibleElectricalPanelElements,
-        (mVisibleElectricalPanelElementsCount > MaxVisibleElectricalPanelElements) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
+        (visibleElectricalPanelElementsCount > MaxVisibleElectricalPanelElements) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
 }
 
-
-void ModelValidationSession::ValidateElectricalConnectivity()
+void ModelValidationSession::ValidateElectricalConnectivity(ModelValidationResults & results) const
 {
     assert(mModel.HasLayer(LayerType::Electrical));
 
@@ -396,7 +511,7 @@ void ModelValidationSession::ValidateElectricalConnectivity()
                 electricalComponents,
                 electricalConnectivityVisitBuffer);
 
-            mResults.AddIssue(
+            results.AddIssue(
                 ModelValidationIssue::CheckClassType::UnpoweredElectricalComponent,
                 (unpoweredElectricalComponentCount > 0) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
         }
@@ -408,7 +523,7 @@ void ModelValidationSession::ValidateElectricalConnectivity()
                 electricalSources,
                 electricalConnectivityVisitBuffer);
 
-            mResults.AddIssue(
+            results.AddIssue(
                 ModelValidationIssue::CheckClassType::UnconsumedElectricalSource,
                 (unconsumedElectricalSourceCount > 0) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
         }
@@ -423,7 +538,7 @@ void ModelValidationSession::ValidateElectricalConnectivity()
                 engineComponents,
                 engineConnectivityVisitBuffer);
 
-            mResults.AddIssue(
+            results.AddIssue(
                 ModelValidationIssue::CheckClassType::UnpoweredEngineComponent,
                 (unpoweredEngineComponentCount > 0) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
         }
@@ -435,7 +550,7 @@ void ModelValidationSession::ValidateElectricalConnectivity()
                 engineSources,
                 engineConnectivityVisitBuffer);
 
-            mResults.AddIssue(
+            results.AddIssue(
                 ModelValidationIssue::CheckClassType::UnconsumedEngineSource,
                 (unconsumedEngineSourceCount > 0) ? ModelValidationIssue::SeverityType::Warning : ModelValidationIssue::SeverityType::Success);
         }
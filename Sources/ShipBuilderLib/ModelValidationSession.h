@@ -7,56 +7,159 @@
 
 #include "Model.h"
 #include "ModelValidationResults.h"
+#include "ShipBuilderTypes.h"
 
 #include <Core/Buffer2D.h>
 #include <Core/Finalizer.h>
 #include <Core/GameTypes.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace ShipBuilder {
 
+/*
+ * The results of the validation steps of previous sessions, each together with the
+ * versions of the layers it has been calculated from.
+ *
+ * Lives as long as the model, so that a session only re-runs the steps whose layers
+ * have changed since the last validation.
+ */
+class ModelValidationCache final
+{
+public:
+
+    enum class StepType : size_t
+    {
+        StructuralLayer = 0,
+        ElectricalSubstratum,
+        ElectricalElements,
+        ElectricalConnectivity,
+
+        _Last = ElectricalConnectivity
+    };
+
+    using LayerVersions = std::array<std::uint64_t, LayerCount>;
+
+    ModelValidationCache()
+        : mEntries()
+    {}
+
+    std::optional<ModelValidationResults> TryGet(
+        StepType step,
+        std::vector<LayerType> const & dependencies,
+        LayerVersions const & layerVersions) const
+    {
+        auto const & entry = mEntries[static_cast<size_t>(step)];
+        if (!entry.has_value())
+        {
+            return std::nullopt;
+        }
+
+        for (LayerType const layer : dependencies)
+        {
+            if (entry->Versions[static_cast<size_t>(layer)] != layerVersions[static_cast<size_t>(layer)])
+            {
+                // Stale
+                return std::nullopt;
+            }
+        }
+
+        return entry->Results;
+    }
+
+    void Store(
+        StepType step,
+        LayerVersions const & layerVersions,
+        ModelValidationResults const & results)
+    {
+        mEntries[static_cast<size_t>(step)].emplace(Entry({ layerVersions, results }));
+    }
+
+private:
+
+    struct Entry
+    {
+        LayerVersions Versions;
+        ModelValidationResults Results;
+    };
+
+    std::array<std::optional<Entry>, static_cast<size_t>(StepType::_Last) + 1> mEntries;
+};
+
+/*
+ * Runs the validation steps that are not in the cache on a background thread.
+ *
+ * The model must not change for the whole lifetime of the session (which is why the
+ * session holds the tool suspension); once started, a session cannot be moved.
+ */
 class ModelValidationSession final
 {
 public:
 
     ModelValidationSession(
         Model const & model,
+        ModelValidationCache & cache,
         Finalizer && finalizer);
 
-    size_t GetNumberOfSteps()
-    {
-        if (mValidationSteps.empty())
-        {
-            InitializeValidationSteps();
-        }
+    ~ModelValidationSession();
 
+    ModelValidationSession(ModelValidationSession const &) = delete;
+    ModelValidationSession & operator=(ModelValidationSession const &) = delete;
+
+    size_t GetNumberOfSteps() const
+    {
         return mValidationSteps.size();
     }
 
-    std::optional<ModelValidationResults> DoNext();
+    size_t GetNumberOfCompletedSteps() const
+    {
+        return mCachedStepsCount + mCompletedPendingStepsCount.load(std::memory_order_acquire);
+    }
+
+    /*
+     * Returns the results once all steps have completed; invoked from the UI thread.
+     */
+    std::optional<ModelValidationResults> PollResults();
 
 private:
 
     Model const & mModel;
+    ModelValidationCache & mCache;
     Finalizer mFinalizer;
 
     //
     // State
     //
 
-    std::vector<std::function<void()>> mValidationSteps;
+    struct ValidationStep
+    {
+        ModelValidationCache::StepType Type;
+        std::vector<LayerType> Dependencies;
+        std::function<void(ModelValidationResults &)> Run;
+        std::optional<ModelValidationResults> Results;
+    };
 
-    size_t mCurrentStep;
+    std::vector<ValidationStep> mValidationSteps;
+    ModelValidationCache::LayerVersions mLayerVersions;
 
-    size_t mStructuralParticlesCount;
-    size_t mElectricalParticlesWithNoStructuralSubstratumCount;
-    size_t mLightEmittingParticlesCount;
-    size_t mVisibleElectricalPanelElementsCount;
+    std::vector<size_t> mPendingSteps;
+    size_t mCachedStepsCount;
 
-    ModelValidationResults mResults;
+    //
+    // Worker
+    //
+
+    std::thread mWorkerThread;
+    std::atomic<size_t> mCompletedPendingStepsCount;
+    std::atomic<bool> mIsStopRequested;
+    std::exception_ptr mWorkerException;
 
 private:
 
@@ -72,24 +175,17 @@ private:
         ConnectivityFlags flags;
     };
 
-    // Initialize validations (can't do in cctor)
     void InitializeValidationSteps();
 
-    void PrevisitStructuralLayer();
-
-    void CheckEmptyStructuralLayer();
-
-    void CheckStructureTooLarge();
-
-    void PrevisitElectricalLayer();
+    void RunPendingSteps();
 
-    void CheckElectricalSubstratum();
+    void ValidateStructuralLayer(ModelValidationResults & results) const;
 
-    void CheckTooManyLights();
+    void CheckElectricalSubstratum(ModelValidationResults & results) const;
 
-    void CheckTooManyElectricalPanelElements();
+    void ValidateElectricalElements(ModelValidationResults & results) const;
 
-	void ValidateElectricalConnectivity();
+	void ValidateElectricalConnectivity(ModelValidationResults & results) const;
 
     static size_t CountElectricallyUnconnected(
         std::vector<ShipSpaceCoordinates> const & propagationSources,
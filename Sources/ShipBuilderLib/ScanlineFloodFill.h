@@ -0,0 +1,116 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Core/GameTypes.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace ShipBuilder {
+
+/*
+ * Flood-fills the region connected to the seed one horizontal span at a time, keeping on
+ * the stack one seed per span rather than one per pixel.
+ *
+ * - isFillable(coords): whether the pixel belongs to the region and has not been filled yet;
+ *   it must turn false once the pixel has been filled.
+ * - fillSpan(y, startX, endX): fills the pixels in [startX, endX) of row y.
+ * - visitBorder(coords): invoked on the in-bounds, non-fillable neighbors of filled pixels;
+ *   it may be invoked more than once on the same pixel, and on pixels filled already.
+ */
+template<bool IsEightConnected, typename TIntegralTag, typename TIsFillable, typename TFillSpan, typename TVisitBorder>
+void ScanlineFloodFill(
+    _IntegralCoordinates<TIntegralTag> const & seed,
+    _IntegralSize<TIntegralTag> const & size,
+    TIsFillable && isFillable,
+    TFillSpan && fillSpan,
+    TVisitBorder && visitBorder)
+{
+    using coordinates_type = _IntegralCoordinates<TIntegralTag>;
+
+    assert(seed.IsInSize(size));
+
+    std::vector<coordinates_type> seeds;
+    seeds.push_back(seed);
+
+    while (!seeds.empty())
+    {
+        coordinates_type const current = seeds.back();
+        seeds.pop_back();
+
+        if (!isFillable(current))
+        {
+            // Filled already from another span
+            continue;
+        }
+
+        //
+        // Extend span and fill it
+        //
+
+        int startX = current.x;
+        while (startX > 0 && isFillable(coordinates_type(startX - 1, current.y)))
+        {
+            --startX;
+        }
+
+        int endX = current.x + 1;
+        while (endX < size.width && isFillable(coordinates_type(endX, current.y)))
+        {
+            ++endX;
+        }
+
+        fillSpan(current.y, startX, endX);
+
+        if (startX > 0)
+        {
+            visitBorder(coordinates_type(startX - 1, current.y));
+        }
+
+        if (endX < size.width)
+        {
+            visitBorder(coordinates_type(endX, current.y));
+        }
+
+        //
+        // Scan rows above and below, seeding one span per run of fillable pixels
+        //
+
+        int const scanStartX = IsEightConnected ? std::max(startX - 1, 0) : startX;
+        int const scanEndX = IsEightConnected ? std::min(endX + 1, size.width) : endX;
+
+        for (int const y : { current.y - 1, current.y + 1 })
+        {
+            if (y < 0 || y >= size.height)
+            {
+                continue;
+            }
+
+            bool isInRun = false;
+            for (int x = scanStartX; x < scanEndX; ++x)
+            {
+                coordinates_type const coords(x, y);
+                if (isFillable(coords))
+                {
+                    if (!isInRun)
+                    {
+                        seeds.push_back(coords);
+                        isInRun = true;
+                    }
+                }
+                else
+                {
+                    visitBorder(coords);
+                    isInRun = false;
+                }
+            }
+        }
+    }
+}
+
+}
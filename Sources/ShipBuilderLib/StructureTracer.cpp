@@ -0,0 +1,263 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "StructureTracer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace ShipBuilder {
+
+namespace {
+
+    std::uint8_t constexpr FillFlag = 1;
+    std::uint8_t constexpr EdgeFlag = 2;
+
+    int constexpr MinRowsPerBand = 32;
+
+    template<typename TBandFunction>
+    void RunBands(
+        size_t bandCount,
+        TBandFunction const & bandFunction)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(bandCount - 1);
+
+        for (size_t b = 1; b < bandCount; ++b)
+        {
+            threads.emplace_back(bandFunction, b);
+        }
+
+        // Run first band on this thread
+        bandFunction(0);
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+typename LayerTypeTraits<LayerType::Structural>::buffer_type StructureTracer::MakeTrace(
+    RgbaImageData const & texture,
+    ImageRect const & textureRect,
+    ShipSpaceRect const & shipRect,
+    vec2f const & shipToTexture,
+    StructuralMaterial const * edgeMaterial,
+    StructuralMaterial const * fillMaterial,
+    std::uint8_t alphaThreshold,
+    size_t parallelism)
+{
+    // Here we map the texture coords to the ship coords in the same "texturing" fashion as we do for rendering;
+    // we do this because the texture for a particle at ship coords (x, y) is sampled at the center of the
+    // texture's quad for that particle.
+    //
+    // Here we want to calculate the ship rect whose tessellation guarantees coverage of this texture rect.
+    // By observing that the pixel at coordinate t is covered by the line between ship coordinate s(t) and s(t+1),
+    // we set edge particles as follows:
+    //  Out->In transition: we detect entering texture image at texture coordinates t; assuming more particles will
+    //                      follow, we place an edge particle at s(t)
+    //  In-Out transition: we detecting leaving texture image at texture coordinates t; assuming there were particles
+    //                      earlier (at s(t-1)), we place an edge particle at s(t-1) + 1
+    //
+    // The formula for s(t) is the "texturization" one, i.s. e = (t - o/2) / o, where o is the number of texture
+    // pixels in one ship quad.
+    //
+    // Transitions are detected both along columns (vertical pass) and along rows (horizontal pass); both passes
+    // only look at pairs of adjacent pixels, hence we run them together, row by row, on an opacity mask.
+
+    assert(textureRect.IsContainedInRect(ImageRect(texture.Size)));
+
+    int const textureWidth = textureRect.size.width;
+    int const textureHeight = textureRect.size.height;
+
+    auto newStructureRegionBuffer = LayerTypeTraits<LayerType::Structural>::buffer_type(shipRect.size);
+    newStructureRegionBuffer.Fill(StructuralElement(nullptr));
+
+    if (textureWidth == 0 || textureHeight == 0)
+    {
+        return newStructureRegionBuffer;
+    }
+
+    //
+    // Pre-calculate ship coordinates - relative to ship rect - of each texture column and row:
+    //  - Scan line: s.x of a column in the vertical pass, s.y of a row in the horizontal pass
+    //  - Enter: s(t), for Out->In transitions and filler
+    //  - Leave: s(t-1) + 1, for In->Out transitions
+    //
+
+    std::vector<int> scanLineShipX(textureWidth);
+    std::vector<int> enterShipX(textureWidth);
+    std::vector<int> leaveShipX(textureWidth);
+    for (int x = 0; x < textureWidth; ++x)
+    {
+        int const tx = textureRect.origin.x + x;
+        scanLineShipX[x] = static_cast<int>(std::floor(static_cast<float>(tx) / shipToTexture.x)) - shipRect.origin.x;
+        enterShipX[x] = static_cast<int>(std::floor(static_cast<float>(tx) / shipToTexture.x - 0.5f)) - shipRect.origin.x;
+        leaveShipX[x] = static_cast<int>(std::floor(static_cast<float>(tx - 1) / shipToTexture.x - 0.5f)) + 1 - shipRect.origin.x;
+    }
+
+    std::vector<int> scanLineShipY(textureHeight);
+    std::vector<int> enterShipY(textureHeight);
+    std::vector<int> leaveShipY(textureHeight);
+    for (int y = 0; y < textureHeight; ++y)
+    {
+        int const ty = textureRect.origin.y + y;
+        scanLineShipY[y] = static_cast<int>(std::floor(static_cast<float>(ty) / shipToTexture.y)) - shipRect.origin.y;
+        enterShipY[y] = static_cast<int>(std::floor(static_cast<float>(ty) / shipToTexture.y - 0.5f)) - shipRect.origin.y;
+        leaveShipY[y] = static_cast<int>(std::floor(static_cast<float>(ty - 1) / shipToTexture.y - 0.5f)) + 1 - shipRect.origin.y;
+    }
+
+    //
+    // Split rows into bands
+    //
+
+    size_t const maxBandCount = static_cast<size_t>(std::max((textureHeight + MinRowsPerBand - 1) / MinRowsPerBand, 1));
+    size_t const bandCount = std::clamp(parallelism, size_t(1), maxBandCount);
+    int const rowsPerBand = (textureHeight + static_cast<int>(bandCount) - 1) / static_cast<int>(bandCount);
+
+    //
+    // Pass 1: opacity mask
+    //
+
+    std::vector<std::uint8_t> opacityMask(static_cast<size_t>(textureWidth) * static_cast<size_t>(textureHeight));
+
+    RunBands(
+        bandCount,
+        [&](size_t b)
+        {
+            int const startY = static_cast<int>(b) * rowsPerBand;
+            int const endY = std::min(startY + rowsPerBand, textureHeight);
+            for (int y = startY; y < endY; ++y)
+            {
+                rgbaColor const * const srcRow = &(texture.Data[(textureRect.origin.y + y) * texture.Size.width + textureRect.origin.x]);
+                std::uint8_t * const dstRow = &(opacityMask[static_cast<size_t>(y) * textureWidth]);
+                for (int x = 0; x < textureWidth; ++x)
+                {
+                    dstRow[x] = (srcRow[x].a > alphaThreshold) ? 1 : 0;
+                }
+            }
+        });
+
+    //
+    // Pass 2: transitions, into per-band particle flags
+    //
+
+    size_t const shipCellCount = newStructureRegionBuffer.GetLinearSize();
+
+    std::vector<std::vector<std::uint8_t>> bandParticleFlags(bandCount);
+
+    RunBands(
+        bandCount,
+        [&](size_t b)
+        {
+            auto & particleFlags = bandParticleFlags[b];
+            particleFlags.resize(shipCellCount, 0);
+
+            auto const placeParticle = [&](int sx, int sy, std::uint8_t flag)
+            {
+                if (sx >= 0 && sx < shipRect.size.width && sy >= 0 && sy < shipRect.size.height)
+                {
+                    particleFlags[sy * shipRect.size.width + sx] |= flag;
+                }
+            };
+
+            int const startY = static_cast<int>(b) * rowsPerBand;
+            int const endY = std::min(startY + rowsPerBand, textureHeight);
+            for (int y = startY; y < endY; ++y)
+            {
+                std::uint8_t const * const row = &(opacityMask[static_cast<size_t>(y) * textureWidth]);
+
+                // Horizontal pass - left->right along this row
+                {
+                    int const sy = scanLineShipY[y];
+
+                    for (int x = 1; x < textureWidth; ++x)
+                    {
+                        bool const isScanLineFull = row[x - 1] != 0;
+                        bool const isPixelFull = row[x] != 0;
+
+                        if (!isScanLineFull && isPixelFull)
+                        {
+                            // Out->In
+                            placeParticle(enterShipX[x], sy, EdgeFlag);
+                        }
+                        else if (isScanLineFull && !isPixelFull)
+                        {
+                            // In->Out
+                            placeParticle(leaveShipX[x], sy, EdgeFlag);
+                        }
+                        else if (isScanLineFull && isPixelFull)
+                        {
+                            // Filler
+                            placeParticle(enterShipX[x], sy, FillFlag);
+                        }
+                    }
+                }
+
+                // Vertical pass - bottom->up, between the previous row and this one
+                if (y > 0)
+                {
+                    std::uint8_t const * const previousRow = row - textureWidth;
+
+                    for (int x = 0; x < textureWidth; ++x)
+                    {
+                        bool const isScanLineFull = previousRow[x] != 0;
+                        bool const isPixelFull = row[x] != 0;
+
+                        if (!isScanLineFull && isPixelFull)
+                        {
+                            // Out->In
+                            placeParticle(scanLineShipX[x], enterShipY[y], EdgeFlag);
+                        }
+                        else if (isScanLineFull && !isPixelFull)
+                        {
+                            // In->Out
+                            placeParticle(scanLineShipX[x], leaveShipY[y], EdgeFlag);
+                        }
+                        else if (isScanLineFull && isPixelFull)
+                        {
+                            // Filler
+                            placeParticle(scanLineShipX[x], enterShipY[y], FillFlag);
+                        }
+                    }
+                }
+            }
+        });
+
+    //
+    // Merge bands and make particles; edges always win
+    //
+
+    for (size_t i = 0; i < shipCellCount; ++i)
+    {
+        std::uint8_t flags = 0;
+        for (auto const & particleFlags : bandParticleFlags)
+        {
+            flags |= particleFlags[i];
+        }
+
+        if (flags & EdgeFlag)
+        {
+            newStructureRegionBuffer.Data[i] = StructuralElement(edgeMaterial);
+        }
+        else if (flags & FillFlag)
+        {
+            newStructureRegionBuffer.Data[i] = StructuralElement(fillMaterial);
+        }
+    }
+
+    return newStructureRegionBuffer;
+}
+
+size_t StructureTracer::GetDefaultParallelism()
+{
+    return std::clamp(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1), size_t(8));
+}
+
+}
@@ -0,0 +1,44 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Simulation/Layers.h>
+#include <Simulation/Materials.h>
+
+#include <Core/GameTypes.h>
+#include <Core/ImageData.h>
+#include <Core/Vectors.h>
+
+#include <cstdint>
+
+namespace ShipBuilder {
+
+/*
+ * Traces the structure of a texture region, placing edge particles where the texture's opacity
+ * changes and fill particles where it's opaque.
+ *
+ * The texture region is split into bands of rows, which are traced in parallel; since an edge
+ * particle always wins over a fill particle, the result does not depend on the order in which
+ * particles are placed, and bands may be traced independently and merged afterwards.
+ */
+class StructureTracer final
+{
+public:
+
+    static typename LayerTypeTraits<LayerType::Structural>::buffer_type MakeTrace(
+        RgbaImageData const & texture,
+        ImageRect const & textureRect,
+        ShipSpaceRect const & shipRect,
+        vec2f const & shipToTexture,
+        StructuralMaterial const * edgeMaterial,
+        StructuralMaterial const * fillMaterial,
+        std::uint8_t alphaThreshold,
+        size_t parallelism);
+
+    static size_t GetDefaultParallelism();
+};
+
+}
@@ -7,6 +7,7 @@
 
 #include "../Controller.h"
 
+#include "Core/GameGeometry.h"
 #include "Core/GameMath.h"
 
 #include <cmath>
@@ -14,7 +15,7 @@
 namespace ShipBuilder {
 
 StructuralPasteTool::StructuralPasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     Controller & controller,
     GameAssetManager const & gameAssetManager)
@@ -27,7 +28,7 @@ StructuralPasteTool::StructuralPasteTool(
 {}
 
 ElectricalPasteTool::ElectricalPasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     Controller & controller,
     GameAssetManager const & gameAssetManager)
@@ -40,7 +41,7 @@ ElectricalPasteTool::ElectricalPasteTool(
 {}
 
 RopePasteTool::RopePasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     Controller & controller,
     GameAssetManager const & gameAssetManager)
@@ -53,7 +54,7 @@ RopePasteTool::RopePasteTool(
 {}
 
 ExteriorTexturePasteTool::ExteriorTexturePasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     Controller & controller,
     GameAssetManager const & gameAssetManager)
@@ -66,7 +67,7 @@ ExteriorTexturePasteTool::ExteriorTexturePasteTool(
 {}
 
 InteriorTexturePasteTool::InteriorTexturePasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     Controller & controller,
     GameAssetManager const & gameAssetManager)
@@ -79,7 +80,7 @@ InteriorTexturePasteTool::InteriorTexturePasteTool(
 {}
 
 PasteTool::PasteTool(
-    ShipLayers && pasteRegion,
+    std::shared_ptr<ShipLayers const> pasteRegion,
     bool isTransparent,
     ToolType toolType,
     Controller & controller,
@@ -99,9 +100,10 @@ PasteTool::PasteTool(
         isTransparent,
         CalculateInitialMouseOrigin());
 
-    DrawEphemeralVisualization();
+    UploadPasteOverlay();
+    UploadPasteOverlayRect();
 
-    mController.LayerChangeEpilog();
+    mController.GetUserInterface().RefreshView();
 }
 
 PasteTool::~PasteTool()
@@ -118,7 +120,7 @@ void PasteTool::OnMouseMove(DisplayLogicalCoordinates const & mouseCoordinates)
 
     if (mDragSessionData)
     {
-        UpdateEphemeralVisualization(ScreenToShipSpace(mouseCoordinates));
+        MovePasteRegion(ScreenToShipSpace(mouseCoordinates));
     }
 }
 
@@ -145,7 +147,7 @@ void PasteTool::OnShiftKeyDown()
     {
         mDragSessionData->LockedOrigin = mDragSessionData->LastMousePosition;
 
-        UpdateEphemeralVisualization(GetCurrentMouseShipCoordinates());
+        MovePasteRegion(GetCurrentMouseShipCoordinates());
     }
 }
 
@@ -157,7 +159,7 @@ void PasteTool::OnShiftKeyUp()
     {
         mDragSessionData->LockedOrigin.reset();
 
-        UpdateEphemeralVisualization(GetCurrentMouseShipCoordinates());
+        MovePasteRegion(GetCurrentMouseShipCoordinates());
     }
 }
 
@@ -165,25 +167,22 @@ void PasteTool::Commit()
 {
     assert (mPendingSessionData);
 
-    if (mPendingSessionData->EphemeralVisualization)
-    {
-        UndoEphemeralVisualization();
-        assert(!mPendingSessionData->EphemeralVisualization);
-    }
+    mController.GetView().RemovePasteOverlay();
+    mController.GetView().RemoveDashedRectangleOverlay();
 
     // Calculate affected layers
 
-    auto const affectedLayers = mController.GetModelController().CalculateAffectedLayers(mPendingSessionData->PasteRegion);
+    auto const affectedLayers = mController.GetModelController().CalculateAffectedLayers(*(mPendingSessionData->PasteRegion));
     if (!affectedLayers.empty())
     {
         // Commit
 
         ShipSpaceCoordinates const pasteOrigin = MousePasteCoordsToActualPasteOrigin(
             mPendingSessionData->MousePasteCoords,
-            mPendingSessionData->PasteRegion.Size);
+            mPendingSessionData->PasteRegion->Size);
 
         GenericUndoPayload undoPayload = mController.GetModelController().Paste(
-            mPendingSessionData->PasteRegion,
+            *(mPendingSessionData->PasteRegion),
             pasteOrigin,
             mPendingSessionData->IsTransparent);
 
@@ -212,13 +211,10 @@ void PasteTool::Abort()
 {
     assert(mPendingSessionData);
 
-    if (mPendingSessionData->EphemeralVisualization)
-    {
-        UndoEphemeralVisualization();
-        assert(!mPendingSessionData->EphemeralVisualization);
-    }
+    mController.GetView().RemovePasteOverlay();
+    mController.GetView().RemoveDashedRectangleOverlay();
 
-    mController.LayerChangeEpilog();
+    mController.GetUserInterface().RefreshView();
 
     mPendingSessionData.reset();
 }
@@ -227,17 +223,11 @@ void PasteTool::SetIsTransparent(bool isTransparent)
 {
     assert(mPendingSessionData);
 
-    if (mPendingSessionData->EphemeralVisualization)
-    {
-        UndoEphemeralVisualization();
-        assert(!mPendingSessionData->EphemeralVisualization);
-    }
-
     mPendingSessionData->IsTransparent = isTransparent;
 
-    DrawEphemeralVisualization();
+    UploadPasteOverlay();
 
-    mController.LayerChangeEpilog();
+    mController.GetUserInterface().RefreshView();
 }
 
 void PasteTool::Rotate90CW()
@@ -314,17 +304,8 @@ ShipSpaceCoordinates PasteTool::ClampMousePasteCoords(
         Clamp(mousePasteCoords.y, -1, mController.GetModelController().GetShipSize().height + pasteRegionSize.height - 1));
 }
 
-void PasteTool::UpdateEphemeralVisualization(ShipSpaceCoordinates const & mouseCoordinates)
+void PasteTool::MovePasteRegion(ShipSpaceCoordinates const & mouseCoordinates)
 {
-    // Undo ephemeral viz
-    if (mPendingSessionData->EphemeralVisualization)
-    {
-        UndoEphemeralVisualization();
-        assert(!mPendingSessionData->EphemeralVisualization);
-
-        mController.LayerChangeEpilog(); // Since we're moving, it's likely that 2xregion is less expensive than union of two regions
-    }
-
     // Calc new mouse coords
     auto newMouseCoordinates = mouseCoordinates;
     if (mDragSessionData->LockedOrigin)
@@ -342,47 +323,166 @@ void PasteTool::UpdateEphemeralVisualization(ShipSpaceCoordinates const & mouseC
     // Move mouse coords
     mPendingSessionData->MousePasteCoords = ClampMousePasteCoords(
         mPendingSessionData->MousePasteCoords + (newMouseCoordinates - mDragSessionData->LastMousePosition),
-        mPendingSessionData->PasteRegion.Size);
+        mPendingSessionData->PasteRegion->Size);
 
-    // Draw eph vix
-    DrawEphemeralVisualization();
+    // Move overlay - the texture stays as it is
+    UploadPasteOverlayRect();
 
-    mController.LayerChangeEpilog();
+    mController.GetUserInterface().RefreshView();
 
     mDragSessionData->LastMousePosition = newMouseCoordinates;
 }
 
-void PasteTool::DrawEphemeralVisualization()
+void PasteTool::UploadPasteOverlay()
+{
+    assert(mPendingSessionData);
+
+    mController.GetView().UploadPasteOverlay(MakePasteOverlayTexture());
+}
+
+void PasteTool::UploadPasteOverlayRect()
 {
     assert(mPendingSessionData);
-    assert(!mPendingSessionData->EphemeralVisualization);
 
     ShipSpaceCoordinates const pasteOrigin = MousePasteCoordsToActualPasteOrigin(
         mPendingSessionData->MousePasteCoords,
-        mPendingSessionData->PasteRegion.Size);
+        mPendingSessionData->PasteRegion->Size);
 
-    GenericEphemeralVisualizationRestorePayload pasteEphVizRestore = mController.GetModelController().PasteForEphemeralVisualization(
-        mPendingSessionData->PasteRegion,
-        pasteOrigin,
-        mPendingSessionData->IsTransparent);
+    mController.GetView().UploadPasteOverlayRect(
+        ShipSpaceRect(
+            pasteOrigin,
+            mPendingSessionData->PasteRegion->Size));
 
     mController.GetView().UploadDashedRectangleOverlay(
         pasteOrigin,
-        pasteOrigin + mPendingSessionData->PasteRegion.Size);
-
-    mPendingSessionData->EphemeralVisualization.emplace(std::move(pasteEphVizRestore));
+        pasteOrigin + mPendingSessionData->PasteRegion->Size);
 }
 
-void PasteTool::UndoEphemeralVisualization()
+RgbaImageData PasteTool::MakePasteOverlayTexture() const
 {
     assert(mPendingSessionData);
-    assert(mPendingSessionData->EphemeralVisualization);
 
-    mController.GetView().RemoveDashedRectangleOverlay();
+    ShipLayers const & pasteRegion = *(mPendingSessionData->PasteRegion);
+
+    //
+    // We only preview the layer of this tool; when not transparent, empty
+    // structural and texture pixels are shown as the canvas they'll reveal
+    //
+
+    rgbaColor const transparentColor = rgbaColor(EmptyMaterialColorKey, 0);
+    rgbaColor const canvasColor = rgbaColor(mController.GetWorkbenchState().GetCanvasBackgroundColor(), 255);
+    rgbaColor const emptyColor = mPendingSessionData->IsTransparent ? transparentColor : canvasColor;
 
-    mController.GetModelController().RestoreEphemeralVisualization(std::move(*(mPendingSessionData->EphemeralVisualization)));
+    switch (GetType())
+    {
+        case ToolType::StructuralPaste:
+        {
+            if (pasteRegion.StructuralLayer)
+            {
+                auto const & buffer = pasteRegion.StructuralLayer->Buffer;
+
+                RgbaImageData texture(ImageSize(buffer.Size.width, buffer.Size.height));
+                for (int y = 0; y < buffer.Size.height; ++y)
+                {
+                    for (int x = 0; x < buffer.Size.width; ++x)
+                    {
+                        auto const material = buffer[{x, y}].Material;
+
+                        texture[{x, y}] = (material != nullptr)
+                            ? material->RenderColor
+                            : emptyColor;
+                    }
+                }
+
+                return texture;
+            }
+
+            break;
+        }
+
+        case ToolType::ElectricalPaste:
+        {
+            if (pasteRegion.ElectricalLayer)
+            {
+                auto const & buffer = pasteRegion.ElectricalLayer->Buffer;
+
+                RgbaImageData texture(ImageSize(buffer.Size.width, buffer.Size.height));
+                for (int y = 0; y < buffer.Size.height; ++y)
+                {
+                    for (int x = 0; x < buffer.Size.width; ++x)
+                    {
+                        auto const material = buffer[{x, y}].Material;
+
+                        texture[{x, y}] = (material != nullptr)
+                            ? rgbaColor(material->RenderColor, 255)
+                            : transparentColor;
+                    }
+                }
+
+                return texture;
+            }
+
+            break;
+        }
+
+        case ToolType::RopePaste:
+        {
+            if (pasteRegion.RopesLayer)
+            {
+                RgbaImageData texture(ImageSize(pasteRegion.Size.width, pasteRegion.Size.height), transparentColor);
+                for (auto const & rope : pasteRegion.RopesLayer->Buffer)
+                {
+                    GenerateIntegralLinePath<IntegralLineType::Minimal>(
+                        rope.StartCoords,
+                        rope.EndCoords,
+                        [&](ShipSpaceCoordinates const & coords)
+                        {
+                            if (coords.IsInSize(pasteRegion.Size))
+                            {
+                                texture[{coords.x, coords.y}] = rope.RenderColor;
+                            }
+                        });
+                }
+
+                return texture;
+            }
+
+            break;
+        }
+
+        case ToolType::ExteriorTexturePaste:
+        case ToolType::InteriorTexturePaste:
+        {
+            auto const & textureLayer = (GetType() == ToolType::ExteriorTexturePaste)
+                ? pasteRegion.ExteriorTextureLayer
+                : pasteRegion.InteriorTextureLayer;
+
+            if (textureLayer)
+            {
+                RgbaImageData texture = textureLayer->Buffer.Clone();
+                if (!mPendingSessionData->IsTransparent)
+                {
+                    for (size_t i = 0; i < texture.GetLinearSize(); ++i)
+                    {
+                        texture.Data[i] = canvasColor.blend(texture.Data[i]);
+                    }
+                }
+
+                return texture;
+            }
+
+            break;
+        }
+
+        default:
+        {
+            assert(false);
+            break;
+        }
+    }
 
-    mPendingSessionData->EphemeralVisualization.reset();
+    // Nothing to preview for this tool's layer
+    return RgbaImageData(ImageSize(1, 1), transparentColor);
 }
 
 template<typename TModifier>
@@ -390,17 +490,20 @@ void PasteTool::ModifyPasteRegion(TModifier && modifier)
 {
     assert(mPendingSessionData);
 
-    if (mPendingSessionData->EphemeralVisualization)
+    // Copy-on-write: the region is shared with the clipboard until we modify it for the first time
+    if (mPendingSessionData->PasteRegion.use_count() > 1)
     {
-        UndoEphemeralVisualization();
-        assert(!mPendingSessionData->EphemeralVisualization);
+        mPendingSessionData->PasteRegion = std::make_shared<ShipLayers>(mPendingSessionData->PasteRegion->Clone());
     }
 
-    modifier(mPendingSessionData->PasteRegion);
+    // Safe, as we're now the only owners of the region - which is never made as const, but
+    // only held as such to keep it from being modified while shared
+    modifier(const_cast<ShipLayers &>(*(mPendingSessionData->PasteRegion)));
 
-    DrawEphemeralVisualization();
+    UploadPasteOverlay();
+    UploadPasteOverlayRect();
 
-    mController.LayerChangeEpilog();
+    mController.GetUserInterface().RefreshView();
 }
 
 }
\ No newline at end of file
@@ -7,7 +7,6 @@
 
 #include "Tool.h"
 
-#include "../GenericEphemeralVisualizationRestorePayload.h"
 #include "../GenericUndoPayload.h"
 
 #include <UILib/WxHelpers.h>
@@ -17,6 +16,7 @@
 #include <Simulation/Layers.h>
 
 #include <Core/GameTypes.h>
+#include <Core/ImageData.h>
 
 #include <memory>
 #include <optional>
@@ -55,7 +55,7 @@ public:
 protected:
 
     PasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         ToolType toolType,
         Controller & controller,
@@ -73,11 +73,13 @@ private:
         ShipSpaceCoordinates const & mousePasteCoords,
         ShipSpaceSize const & pasteRegionSize) const;
 
-    void UpdateEphemeralVisualization(ShipSpaceCoordinates const & mouseCoordinates);
+    void MovePasteRegion(ShipSpaceCoordinates const & mouseCoordinates);
 
-    void DrawEphemeralVisualization();
+    void UploadPasteOverlay();
 
-    void UndoEphemeralVisualization();
+    void UploadPasteOverlayRect();
+
+    RgbaImageData MakePasteOverlayTexture() const;
 
     template<typename TModifier>
     void ModifyPasteRegion(TModifier && modifier);
@@ -88,26 +90,24 @@ private:
 
     struct PendingSessionData
     {
-        ShipLayers PasteRegion;
+        // Shared with the clipboard until it's first modified
+        std::shared_ptr<ShipLayers const> PasteRegion;
         bool IsTransparent;
 
         ShipSpaceCoordinates MousePasteCoords;
 
-        // When set we have an ephemeral visualization
-        std::optional<GenericEphemeralVisualizationRestorePayload> EphemeralVisualization;
-
         PendingSessionData(
-            ShipLayers && pasteRegion,
+            std::shared_ptr<ShipLayers const> pasteRegion,
             bool isTransparent,
             ShipSpaceCoordinates const & mousePasteCoords)
             : PasteRegion(std::move(pasteRegion))
             , IsTransparent(isTransparent)
             , MousePasteCoords(mousePasteCoords)
-            , EphemeralVisualization()
         {}
     };
 
-    // Only set when the current paste has not been committed nor aborted yet
+    // Only set when the current paste has not been committed nor aborted yet;
+    // while pending, the paste is only shown as an overlay, and the model is untouched
     std::optional<PendingSessionData> mPendingSessionData;
 
     struct DragSessionData
@@ -132,7 +132,7 @@ class StructuralPasteTool : public PasteTool
 public:
 
     StructuralPasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         Controller & controller,
         GameAssetManager const & gameAssetManager);
@@ -143,7 +143,7 @@ class ElectricalPasteTool : public PasteTool
 public:
 
     ElectricalPasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         Controller & controller,
         GameAssetManager const & gameAssetManager);
@@ -154,7 +154,7 @@ class RopePasteTool : public PasteTool
 public:
 
     RopePasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         Controller & controller,
         GameAssetManager const & gameAssetManager);
@@ -165,7 +165,7 @@ class ExteriorTexturePasteTool : public PasteTool
 public:
 
     ExteriorTexturePasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         Controller & controller,
         GameAssetManager const & gameAssetManager);
@@ -176,7 +176,7 @@ class InteriorTexturePasteTool : public PasteTool
 public:
 
     InteriorTexturePasteTool(
-        ShipLayers && pasteRegion,
+        std::shared_ptr<ShipLayers const> pasteRegion,
         bool isTransparent,
         Controller & controller,
         GameAssetManager const & gameAssetManager);
@@ -13,7 +13,6 @@ CompositeMaterialPalette::CompositeMaterialPalette(
     std::function<void(fsElectricalMaterialSelectedEvent const & event)> onElectricalLayerMaterialSelected,
     std::function<void(fsStructuralMaterialSelectedEvent const & event)> onRopeLayerMaterialSelected,
     MaterialDatabase const & materialDatabase,
-    ShipTexturizer const & shipTexturizer,
     GameAssetManager const & gameAssetManager,
     ProgressCallback const & progressCallback)
     : mOnStructuralLayerMaterialSelected(std::move(onStructuralLayerMaterialSelected))
@@ -24,7 +23,7 @@ CompositeMaterialPalette::CompositeMaterialPalette(
     mStructuralMaterialPalette = std::make_unique<MaterialPalette<LayerType::Structural>>(
         parent,
         materialDatabase.GetStructuralMaterialPalette(),
-        shipTexturizer,
+        materialDatabase,
         gameAssetManager,
         progressCallback.MakeSubCallback(0.0f, 0.33f));
 
@@ -38,7 +37,7 @@ CompositeMaterialPalette::CompositeMaterialPalette(
     mElectricalMaterialPalette = std::make_unique<MaterialPalette<LayerType::Electrical>>(
         parent,
         materialDatabase.GetElectricalMaterialPalette(),
-        shipTexturizer,
+        materialDatabase,
         gameAssetManager,
         progressCallback.MakeSubCallback(0.33f, 0.33f));
 
@@ -52,7 +51,7 @@ CompositeMaterialPalette::CompositeMaterialPalette(
     mRopesMaterialPalette = std::make_unique<MaterialPalette<LayerType::Ropes>>(
         parent,
         materialDatabase.GetRopeMaterialPalette(),
-        shipTexturizer,
+        materialDatabase,
         gameAssetManager,
         progressCallback.MakeSubCallback(0.66f, 0.33f));
 
@@ -11,7 +11,6 @@
 
 #include <Simulation/Layers.h>
 #include <Simulation/MaterialDatabase.h>
-#include <Simulation/ShipTexturizer.h>
 
 #include <Core/GameTypes.h>
 #include <Core/ProgressCallback.h>
@@ -33,7 +32,6 @@ public:
         std::function<void(fsElectricalMaterialSelectedEvent const & event)> onElectricalLayerMaterialSelected,
         std::function<void(fsStructuralMaterialSelectedEvent const & event)> onRopeLayerMaterialSelected,
         MaterialDatabase const & materialDatabase,
-        ShipTexturizer const & shipTexturizer,
         GameAssetManager const & gameAssetManager,
         ProgressCallback const & progressCallback);
 
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #include "MaterialPalette.h"
 
+#include <UILib/StandardSystemPaths.h>
 #include <UILib/WxHelpers.h>
 
 #include <wx/gbsizer.h>
@@ -23,18 +24,22 @@ wxDEFINE_EVENT(fsEVT_ELECTRICAL_MATERIAL_SELECTED, fsElectricalMaterialSelectedE
 int constexpr MinCategoryPanelsContainerHeight = 400; // Min height of the scrollable panel that contains the swaths; without a min height, a palette that only has a few categories would be too short
 ImageSize constexpr CategoryButtonSize(80, 60);
 ImageSize constexpr PaletteButtonSize(80, 60);
+int constexpr ThumbnailTimerPeriodMsec = 50;
 
 template<LayerType TLayer>
 MaterialPalette<TLayer>::MaterialPalette(
     wxWindow * parent,
     MaterialDatabase::Palette<TMaterial> const & materialPalette,
-    ShipTexturizer const & shipTexturizer,
+    MaterialDatabase const & materialDatabase,
     GameAssetManager const & gameAssetManager,
     ProgressCallback const & progressCallback)
     : wxPopupTransientWindow(parent, wxPU_CONTAINS_CONTROLS | wxBORDER_SIMPLE)
     , mMaterialPalette(materialPalette)
     , mCurrentMaterialInPropertyGrid(nullptr)
     , mCurrentPlane()
+    , mThumbnailGenerator()
+    , mThumbnailButtons()
+    , mThumbnailTimer()
 {
     SetBackgroundColour(wxColour("WHITE"));
 
@@ -76,7 +81,7 @@ MaterialPalette<TLayer>::MaterialPalette(
 
                 // Create category button
                 {
-                    wxToggleButton * categoryButton = CreateMaterialButton(mCategoryListPanel, CategoryButtonSize, categoryHeadMaterial, shipTexturizer, gameAssetManager);
+                    wxToggleButton * categoryButton = CreateMaterialButton(mCategoryListPanel, CategoryButtonSize, categoryHeadMaterial);
 
                     categoryButton->Bind(
                         wxEVT_LEFT_DOWN,
@@ -181,9 +186,7 @@ MaterialPalette<TLayer>::MaterialPalette(
 
                 wxPanel * categoryPanel = CreateCategoryPanel(
                     mCategoryPanelsContainer,
-                    category,
-                    shipTexturizer,
-                    gameAssetManager);
+                    category);
 
                 mCategoryPanelsContainerSizer->Add(
                     categoryPanel,
@@ -246,6 +249,44 @@ MaterialPalette<TLayer>::MaterialPalette(
     }
 
     SetSizerAndFit(mRootHSizer);
+
+    //
+    // Start making thumbnails
+    //
+
+    if constexpr (TMaterial::MaterialLayer == MaterialLayerType::Structural)
+    {
+        assert(CategoryButtonSize == PaletteButtonSize); // Sharing thumbnails
+
+        // In palette order, which is stable across runs
+        std::vector<StructuralMaterial const *> materials;
+        for (auto const & category : materialPalette.Categories)
+        {
+            for (auto const & subCategory : category.SubCategories)
+            {
+                for (auto const & material : subCategory.Materials)
+                {
+                    materials.push_back(&(material.get()));
+                }
+            }
+        }
+
+        ShipAutoTexturizationSettings texturizationSettings;
+        texturizationSettings.MaterialTextureMagnification = 0.5f;
+
+        mThumbnailGenerator = std::make_unique<MaterialThumbnailGenerator>(
+            std::move(materials),
+            PaletteButtonSize,
+            texturizationSettings,
+            StandardSystemPaths::GetInstance().GetUserGameRootFolderPath() / "ThumbnailCache"
+                / (std::string(TLayer == LayerType::Ropes ? "ropes" : "structural") + "_material_thumbnails.bin"),
+            materialDatabase,
+            gameAssetManager);
+
+        mThumbnailTimer = std::make_unique<wxTimer>(this, wxID_ANY);
+        Connect(mThumbnailTimer->GetId(), wxEVT_TIMER, (wxObjectEventFunction)&MaterialPalette<TLayer>::OnThumbnailTimer);
+        mThumbnailTimer->Start(ThumbnailTimerPeriodMsec, false);
+    }
 }
 
 template<LayerType TLayer>
@@ -319,9 +360,7 @@ private:
 template<LayerType TLayer>
 wxPanel * MaterialPalette<TLayer>::CreateCategoryPanel(
     wxWindow * parent,
-    typename MaterialDatabase::Palette<TMaterial>::Category const & materialCategory,
-    ShipTexturizer const & shipTexturizer,
-    GameAssetManager const & gameAssetManager)
+    typename MaterialDatabase::Palette<TMaterial>::Category const & materialCategory)
 {
     // Make sure we have room for this category in the list of material buttons
     mMaterialButtons.resize(mMaterialButtons.size() + 1);
@@ -376,7 +415,7 @@ wxPanel * MaterialPalette<TLayer>::CreateCategoryPanel(
 
                 // Button
                 {
-                    wxToggleButton * materialButton = CreateMaterialButton(categoryPanel, PaletteButtonSize, *material, shipTexturizer, gameAssetManager);
+                    wxToggleButton * materialButton = CreateMaterialButton(categoryPanel, PaletteButtonSize, *material);
 
                     // Bind mouse click
                     materialButton->Bind(
@@ -475,24 +514,19 @@ template<LayerType TLayer>
 wxToggleButton * MaterialPalette<TLayer>::CreateMaterialButton(
     wxWindow * parent,
     ImageSize const & size,
-    TMaterial const & material,
-    ShipTexturizer const & shipTexturizer,
-    GameAssetManager const & gameAssetManager)
+    TMaterial const & material)
 {
     wxToggleButton * categoryButton = new wxToggleButton(parent, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize, wxBU_EXACTFIT);
 
     if constexpr (TMaterial::MaterialLayer == MaterialLayerType::Structural)
     {
-        ShipAutoTexturizationSettings texturizationSettings;
-        texturizationSettings.MaterialTextureMagnification = 0.5f;
-
+        // Plain color until its thumbnail is ready
         categoryButton->SetBitmap(
-            WxHelpers::MakeBitmap(
-                shipTexturizer.MakeMaterialTextureSample(
-                    texturizationSettings,
-                    size,
-                    material,
-                    gameAssetManager)));
+            WxHelpers::MakeMatteBitmap(
+                material.RenderColor,
+                size));
+
+        mThumbnailButtons[&material].push_back(categoryButton);
     }
     else
     {
@@ -1014,6 +1048,33 @@ void MaterialPalette<TLayer>::SetMaterialSelected(TMaterial const * material)
     }
 }
 
+template<LayerType TLayer>
+void MaterialPalette<TLayer>::OnThumbnailTimer(wxTimerEvent & /*event*/)
+{
+    assert(mThumbnailGenerator);
+
+    auto const readyThumbnails = mThumbnailGenerator->TakeReadyThumbnails();
+    for (auto const & [material, thumbnail] : readyThumbnails)
+    {
+        auto const it = mThumbnailButtons.find(material);
+        assert(it != mThumbnailButtons.end());
+
+        wxBitmap const bitmap = WxHelpers::MakeBitmap(thumbnail);
+        for (wxToggleButton * button : it->second)
+        {
+            button->SetBitmap(bitmap);
+        }
+    }
+
+    if (mThumbnailGenerator->IsCompleted())
+    {
+        mThumbnailTimer->Stop();
+
+        // Not needed anymore
+        mThumbnailGenerator.reset();
+    }
+}
+
 template<LayerType TLayer>
 void MaterialPalette<TLayer>::OnMaterialClicked(TMaterial const * material)
 {
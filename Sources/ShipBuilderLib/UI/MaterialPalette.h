@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "../MaterialThumbnailGenerator.h"
 #include "../ShipBuilderTypes.h"
 
 #include <Game/GameAssetManager.h>
@@ -12,7 +13,6 @@
 #include <Simulation/Layers.h>
 #include <Simulation/Materials.h>
 #include <Simulation/MaterialDatabase.h>
-#include <Simulation/ShipTexturizer.h>
 
 #include <Core/GameTypes.h>
 #include <Core/ProgressCallback.h>
@@ -23,8 +23,11 @@
 #include <wx/scrolwin.h>
 #include <wx/sizer.h>
 #include <wx/tglbtn.h>
+#include <wx/timer.h>
 
 #include <array>
+#include <map>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -108,7 +111,7 @@ public:
     MaterialPalette(
         wxWindow * parent,
         MaterialDatabase::Palette<TMaterial> const & materialPalette,
-        ShipTexturizer const & shipTexturizer,
+        MaterialDatabase const & materialDatabase,
         GameAssetManager const & gameAssetManager,
         ProgressCallback const & progressCallback);
 
@@ -128,16 +131,14 @@ private:
 
     wxPanel * CreateCategoryPanel(
         wxWindow * parent,
-        typename MaterialDatabase::Palette<TMaterial>::Category const & materialCategory,
-        ShipTexturizer const & shipTexturizer,
-        GameAssetManager const & gameAssetManager);
+        typename MaterialDatabase::Palette<TMaterial>::Category const & materialCategory);
 
     wxToggleButton * CreateMaterialButton(
         wxWindow * parent,
         ImageSize const & size,
-        TMaterial const & material,
-        ShipTexturizer const & shipTexturizer,
-        GameAssetManager const & gameAssetManager);
+        TMaterial const & material);
+
+    void OnThumbnailTimer(wxTimerEvent & event);
 
     std::array<wxPropertyGrid *, 2> CreateStructuralMaterialPropertyGrids(wxWindow * parent);
 
@@ -194,6 +195,16 @@ private:
     //
 
     std::optional<MaterialPlaneType> mCurrentPlane;
+
+    //
+    // Thumbnails
+    //
+
+    // Generating structural materials' thumbnails, which buttons show - in lieu of their
+    // placeholders - as they become ready
+    std::unique_ptr<MaterialThumbnailGenerator> mThumbnailGenerator;
+    std::map<TMaterial const *, std::vector<wxToggleButton *>> mThumbnailButtons;
+    std::unique_ptr<wxTimer> mThumbnailTimer;
 };
 
 }
\ No newline at end of file
@@ -211,11 +211,11 @@ void ModelValidationDialog::StartValidation()
 
     // Start validation session
     assert(!mSessionData->ValidationSession);
-    mSessionData->ValidationSession.emplace(mSessionData->BuilderController.StartValidation());
+    mSessionData->ValidationSession = mSessionData->BuilderController.StartValidation();
 
     // Setup gauge
     mValidationWaitGauge->SetValue(0);
-    mValidationWaitGauge->SetRange(mSessionData->ValidationSession->GetNumberOfSteps());
+    mValidationWaitGauge->SetRange(static_cast<int>(mSessionData->ValidationSession->GetNumberOfSteps()));
 
     // Start timer
     mValidationTimer->Start(ValidationTimerPeriodMsec, true);
@@ -226,6 +226,15 @@ void ModelValidationDialog::OnValidationTimer(wxTimerEvent & /*event*/)
     assert(mSessionData);
     assert(mSessionData->ValidationSession);
 
+    if (!mSessionData->ValidationResults)
+    {
+        // Check on validation
+        mSessionData->ValidationResults = mSessionData->ValidationSession->PollResults();
+
+        // Advance gauge
+        mValidationWaitGauge->SetValue(static_cast<int>(mSessionData->ValidationSession->GetNumberOfCompletedSteps()));
+    }
+
     // Check whether we're done
     if (mSessionData->ValidationResults)
     {
@@ -256,13 +265,7 @@ void ModelValidationDialog::OnValidationTimer(wxTimerEvent & /*event*/)
     }
     else
     {
-        // Do next validation
-        mSessionData->ValidationResults = mSessionData->ValidationSession->DoNext();
-
-        // Advance gauge
-        mValidationWaitGauge->SetValue(mValidationWaitGauge->GetValue() + 1);
-
-        // Schedule next timer step
+        // Schedule next check
         mValidationTimer->Start(ValidationTimerPeriodMsec, true);
     }
 }
@@ -71,7 +71,7 @@ private:
 
     struct SessionData
     {
-        std::optional<ModelValidationSession> ValidationSession;
+        std::unique_ptr<ModelValidationSession> ValidationSession;
         Controller & BuilderController;
         bool const IsForSave;
         bool IsInValidationWorkflow;
@@ -10,6 +10,9 @@
 #include <Core/Log.h>
 #include <Core/SysSpecifics.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace ShipBuilder {
 
 float constexpr DashedLineOverlayPixelStep = 4.0f;
@@ -39,7 +42,9 @@ View::View(
     , mHasStructuralLayerVisualization(false)
     , mStructuralLayerVisualizationShader(ProgramKind::Texture) // Will be overwritten
     , mHasElectricalLayerVisualization(false)
-    , mRopeCount(false)
+    , mRopesVertexBuffer()
+    , mRopesVBOAllocatedVertexCount(0)
+    , mRopeCount(0)
     , mHasExteriorTextureLayerVisualization(false)
     , mHasInteriorTextureLayerVisualization(false)
     , mIsGridEnabled(isGridEnabled)
@@ -53,6 +58,7 @@ View::View(
     , mRectOverlayInteriorTextureSpaceRect()
     , mRectOverlayColor(vec3f::zero()) // Will be overwritten
     , mDashedLineOverlayColor(vec3f::zero()) // Will be overwritten
+    , mHasPasteOverlay(false)
     , mHasCenterOfBuoyancyWaterlineMarker(false)
     , mHasCenterOfMassWaterlineMarker(false)
     , mHasWaterline(false)
@@ -671,6 +677,53 @@ View::View(
         glBindVertexArray(0);
     }
 
+    //
+    // Initialize paste overlay texture and VAO
+    //
+
+    {
+        GLuint tmpGLuint;
+
+        //
+        // Texture
+        //
+
+        // Create texture OpenGL handle
+        glGenTextures(1, &tmpGLuint);
+        mPasteOverlayTexture = tmpGLuint;
+
+        // Configure texture
+        mShaderManager->ActivateTexture<ProgramParameterKind::TextureUnit1>();
+        glBindTexture(GL_TEXTURE_2D, *mPasteOverlayTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        CheckOpenGLError();
+
+        //
+        // VAO
+        //
+
+        // Create VAO
+        glGenVertexArrays(1, &tmpGLuint);
+        mPasteOverlayVAO = tmpGLuint;
+        glBindVertexArray(*mPasteOverlayVAO);
+        CheckOpenGLError();
+
+        // Create VBO
+        glGenBuffers(1, &tmpGLuint);
+        mPasteOverlayVBO = tmpGLuint;
+
+        // Describe vertex attributes
+        glBindBuffer(GL_ARRAY_BUFFER, *mPasteOverlayVBO);
+        glEnableVertexAttribArray(static_cast<GLuint>(VertexAttributeKind::Texture));
+        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeKind::Texture), 4, GL_FLOAT, GL_FALSE, sizeof(TextureVertex), (void *)0);
+        CheckOpenGLError();
+
+        glBindVertexArray(0);
+    }
+
     //
     // Initialize waterline markers VAO
     //
@@ -965,41 +1018,98 @@ void View::RemoveElectricalLayerVisualization()
 void View::UploadRopesLayerVisualization(RopeBuffer const & ropeBuffer)
 {
     //
-    // Create vertices
+    // Each rope has its own slot of two vertices in the VBO; we only upload
+    // the slots that have changed since the last upload, so that e.g. moving
+    // the endpoint of one rope only uploads that rope
     //
 
-    std::vector<RopeVertex> vertexBuffer;
-    vertexBuffer.reserve(ropeBuffer.GetElementCount());
+    size_t const ropeCount = ropeBuffer.GetElementCount();
+    size_t const vertexCount = ropeCount * 2;
+
+    size_t const previousVertexCount = mRopesVertexBuffer.size();
+    mRopesVertexBuffer.resize(std::max(vertexCount, previousVertexCount));
+
+    glBindBuffer(GL_ARRAY_BUFFER, *mRopesVBO);
+
+    bool const doReallocate = (vertexCount > mRopesVBOAllocatedVertexCount);
+
+    std::optional<size_t> dirtyRunStart;
 
-    for (auto const & e : ropeBuffer)
+    for (size_t r = 0; r <= ropeCount; ++r)
     {
-        vertexBuffer.emplace_back(
-            vec2f(
-                static_cast<float>(e.StartCoords.x) + 0.5f,
-                static_cast<float>(e.StartCoords.y) + 0.5f),
-            e.RenderColor.toVec4f());
+        bool isDirty = false;
 
-        vertexBuffer.emplace_back(
-            vec2f(
-                static_cast<float>(e.EndCoords.x) + 0.5f,
-                static_cast<float>(e.EndCoords.y) + 0.5f),
-            e.RenderColor.toVec4f());
+        if (r < ropeCount)
+        {
+            auto const & e = ropeBuffer[r];
+
+            RopeVertex const startVertex(
+                vec2f(
+                    static_cast<float>(e.StartCoords.x) + 0.5f,
+                    static_cast<float>(e.StartCoords.y) + 0.5f),
+                e.RenderColor.toVec4f());
+
+            RopeVertex const endVertex(
+                vec2f(
+                    static_cast<float>(e.EndCoords.x) + 0.5f,
+                    static_cast<float>(e.EndCoords.y) + 0.5f),
+                e.RenderColor.toVec4f());
+
+            size_t const v = r * 2;
+            if (v >= previousVertexCount
+                || std::memcmp(&(mRopesVertexBuffer[v]), &startVertex, sizeof(RopeVertex)) != 0
+                || std::memcmp(&(mRopesVertexBuffer[v + 1]), &endVertex, sizeof(RopeVertex)) != 0)
+            {
+                mRopesVertexBuffer[v] = startVertex;
+                mRopesVertexBuffer[v + 1] = endVertex;
+                isDirty = true;
+            }
+        }
+
+        if (doReallocate)
+        {
+            // We'll upload everything anyway
+            continue;
+        }
+
+        if (isDirty)
+        {
+            if (!dirtyRunStart.has_value())
+            {
+                dirtyRunStart = r;
+            }
+        }
+        else if (dirtyRunStart.has_value())
+        {
+            // Upload run of dirty ropes
+            glBufferSubData(
+                GL_ARRAY_BUFFER,
+                *dirtyRunStart * 2 * sizeof(RopeVertex),
+                (r - *dirtyRunStart) * 2 * sizeof(RopeVertex),
+                &(mRopesVertexBuffer[*dirtyRunStart * 2]));
+            CheckOpenGLError();
+
+            dirtyRunStart.reset();
+        }
     }
 
-    //
-    // Upload vertices
-    //
+    if (doReallocate)
+    {
+        // Grow with some room to spare, so that adding ropes one at a time doesn't re-allocate each time
+        mRopesVBOAllocatedVertexCount = std::max(vertexCount + vertexCount / 2, size_t(64));
+        mRopesVertexBuffer.resize(std::max(mRopesVertexBuffer.size(), mRopesVBOAllocatedVertexCount));
+
+        glBufferData(GL_ARRAY_BUFFER, mRopesVBOAllocatedVertexCount * sizeof(RopeVertex), mRopesVertexBuffer.data(), GL_DYNAMIC_DRAW);
+        CheckOpenGLError();
+    }
 
-    glBindBuffer(GL_ARRAY_BUFFER, *mRopesVBO);
-    glBufferData(GL_ARRAY_BUFFER, vertexBuffer.size() * sizeof(RopeVertex), vertexBuffer.data(), GL_STATIC_DRAW);
-    CheckOpenGLError();
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
     //
     // Remember we have ropes
     //
 
-    mRopeCount = ropeBuffer.GetElementCount();
+    mRopeCount = ropeCount;
 }
 
 void View::RemoveRopesLayerVisualization()
@@ -1344,6 +1454,36 @@ void View::RemoveDashedRectangleOverlay()
     mDashedRectangleOverlayRect.reset();
 }
 
+void View::UploadPasteOverlay(RgbaImageData const & texture)
+{
+    // Bind texture
+    glBindTexture(GL_TEXTURE_2D, *mPasteOverlayTexture);
+    CheckOpenGLError();
+
+    // Upload texture
+    GameOpenGL::UploadTexture(texture);
+
+    // Remember we have this overlay - its rect is uploaded separately
+    mHasPasteOverlay = true;
+}
+
+void View::UploadPasteOverlayRect(ShipSpaceRect const & rect)
+{
+    // Just four vertices, regardless of the size of the region
+    UploadTextureVerticesTriangleStripQuad(
+        static_cast<float>(rect.origin.x), 0.0f,
+        static_cast<float>(rect.origin.x + rect.size.width), 1.0f,
+        static_cast<float>(rect.origin.y), 0.0f,
+        static_cast<float>(rect.origin.y + rect.size.height), 1.0f,
+        mPasteOverlayVBO);
+}
+
+void View::RemovePasteOverlay()
+{
+    // Note: we might not have it
+    mHasPasteOverlay = false;
+}
+
 void View::UploadWaterlineMarker(
     vec2f const & center,
     WaterlineMarkerType type)
@@ -1649,6 +1789,27 @@ void View::Render()
         RenderRopesLayerVisualization();
     }
 
+    // Paste overlay, on top of all visualizations
+    if (mHasPasteOverlay)
+    {
+        // Set this texture in the shader's sampler
+        mShaderManager->ActivateTexture<ProgramParameterKind::TextureUnit1>();
+        glBindTexture(GL_TEXTURE_2D, *mPasteOverlayTexture);
+
+        // Bind VAO
+        glBindVertexArray(*mPasteOverlayVAO);
+
+        // Activate program
+        mShaderManager->ActivateProgram<ProgramKind::Texture>();
+
+        // Set opacity
+        mShaderManager->SetProgramParameter<ProgramKind::Texture, ProgramParameterKind::Opacity>(1.0f);
+
+        // Draw
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        CheckOpenGLError();
+    }
+
     //
     // Misc stuff on top of visualizations
     //
@@ -326,6 +326,14 @@ public:
 
     void RemoveDashedRectangleOverlay();
 
+    // Pre-rendered preview of a paste region, which may then be moved
+    // around by only re-uploading its rect
+    void UploadPasteOverlay(RgbaImageData const & texture);
+
+    void UploadPasteOverlayRect(ShipSpaceRect const & rect);
+
+    void RemovePasteOverlay();
+
     //
     // Misc
     //
@@ -600,6 +608,8 @@ private:
     // Ropes layer visualization
     GameOpenGLVAO mRopesVAO;
     GameOpenGLVBO mRopesVBO;
+    std::vector<RopeVertex> mRopesVertexBuffer; // Mirror of VBO contents, two vertices per rope
+    size_t mRopesVBOAllocatedVertexCount;
     size_t mRopeCount;
 
     // Exterior Texture layer visualization
@@ -651,6 +661,12 @@ private:
     GameOpenGLVBO mDashedRectangleOverlayVBO;
     std::optional<std::pair<vec2f, vec2f>> mDashedRectangleOverlayRect; // In fractional ship space
 
+    // PasteOverlay
+    GameOpenGLVAO mPasteOverlayVAO;
+    GameOpenGLVBO mPasteOverlayVBO;
+    GameOpenGLTexture mPasteOverlayTexture;
+    bool mHasPasteOverlay;
+
     // Waterline markers
     GameOpenGLVAO mWaterlineMarkersVAO;
     GameOpenGLVBO mWaterlineMarkersVBO;
@@ -8,6 +8,7 @@
 #include <Core/GameMath.h>
 
 #include <cassert>
+#include <cmath>
 #include <limits>
 
 namespace ShipBuilder {
@@ -18,7 +19,40 @@ vec2f constexpr Vertical2f = vec2f(0.0f, -1.0f); // Vertical down
 WaterlineAnalyzer::WaterlineAnalyzer(IModelObservable const & model)
     : mModel(model)
     , mModelMacroProperties(mModel.GetModelMacroProperties())
+    , mBuoyantForcePrefixSums()
+    , mBuoyantForceXPrefixSums()
 {
+    //
+    // Build prefix sums
+    //
+
+    auto const & structuralLayerBuffer = mModel.GetStructuralLayer().Buffer;
+    size_t const rowStride = static_cast<size_t>(structuralLayerBuffer.Size.width) + 1;
+
+    mBuoyantForcePrefixSums.resize(rowStride * static_cast<size_t>(structuralLayerBuffer.Size.height));
+    mBuoyantForceXPrefixSums.resize(rowStride * static_cast<size_t>(structuralLayerBuffer.Size.height));
+
+    for (int y = 0; y < structuralLayerBuffer.Size.height; ++y)
+    {
+        float * const rowBuoyantForcePrefixSums = &(mBuoyantForcePrefixSums[rowStride * y]);
+        float * const rowBuoyantForceXPrefixSums = &(mBuoyantForceXPrefixSums[rowStride * y]);
+
+        rowBuoyantForcePrefixSums[0] = 0.0f;
+        rowBuoyantForceXPrefixSums[0] = 0.0f;
+
+        for (int x = 0; x < structuralLayerBuffer.Size.width; ++x)
+        {
+            auto const * material = structuralLayerBuffer[{x, y}].Material;
+
+            // Note: here we do the same as the simulator currently does wrt "buoyancy volume fill"
+            float const buoyantForce = (material != nullptr)
+                ? WaterDensity * material->BuoyancyVolumeFill
+                : 0.0f;
+
+            rowBuoyantForcePrefixSums[x + 1] = rowBuoyantForcePrefixSums[x] + buoyantForce;
+            rowBuoyantForceXPrefixSums[x + 1] = rowBuoyantForceXPrefixSums[x] + buoyantForce * static_cast<float>(x);
+        }
+    }
 }
 
 bool WaterlineAnalyzer::Update()
@@ -283,35 +317,84 @@ std::tuple<float, float> WaterlineAnalyzer::CalculateLevelSearchLimits(
 
 std::tuple<float, vec2f> WaterlineAnalyzer::CalculateBuoyancyWithWaterline(
     vec2f const & waterlineCenter,
-    vec2f const & waterlineDirection)
+    vec2f const & waterlineDirection) const
 {
+    //
+    // A particle is underwater when it's on the "underwater" side of the center, along the direction;
+    // on each row, underwater particles thus form a single span, which we find in constant time
+    // and of which we take the buoyancy from the prefix sums.
+    //
+    // Note: here we take a particle's bottom-left corner as the point for which
+    // we check its direction
+    //
+
     float totalBuoyantForce = 0.0f;
     vec2f centerOfBuoyancySum = vec2f::zero();
 
-    auto const & structuralLayerBuffer = mModel.GetStructuralLayer().Buffer;
-    for (int y = 0; y < structuralLayerBuffer.Size.height; ++y)
+    ShipSpaceSize const & shipSize = mModel.GetShipSize();
+    size_t const rowStride = static_cast<size_t>(shipSize.width) + 1;
+
+    for (int y = 0; y < shipSize.height; ++y)
     {
-        for (int x = 0; x < structuralLayerBuffer.Size.width; ++x)
+        auto const isUnderwater = [&](int x) -> bool
+        {
+            return (ShipSpaceCoordinates(x, y).ToFloat() - waterlineCenter).dot(waterlineDirection) >= 0.0f;
+        };
+
+        int startX;
+        int endX;
+        if (waterlineDirection.x > 0.0f)
+        {
+            // Underwater span extends to the right
+            float const t = waterlineCenter.x - (static_cast<float>(y) - waterlineCenter.y) * waterlineDirection.y / waterlineDirection.x;
+            startX = static_cast<int>(std::ceil(Clamp(t, 0.0f, static_cast<float>(shipSize.width))));
+            endX = shipSize.width;
+
+            // Settle rounding, to stay consistent with per-particle check
+            while (startX > 0 && isUnderwater(startX - 1))
+            {
+                --startX;
+            }
+
+            while (startX < endX && !isUnderwater(startX))
+            {
+                ++startX;
+            }
+        }
+        else if (waterlineDirection.x < 0.0f)
         {
-            auto const coords = ShipSpaceCoordinates(x, y);
-            auto const * material = structuralLayerBuffer[coords].Material;
-            if (material != nullptr)
+            // Underwater span extends to the left
+            float const t = waterlineCenter.x - (static_cast<float>(y) - waterlineCenter.y) * waterlineDirection.y / waterlineDirection.x;
+            startX = 0;
+            endX = static_cast<int>(std::floor(Clamp(t, -1.0f, static_cast<float>(shipSize.width - 1)))) + 1;
+
+            // Settle rounding, to stay consistent with per-particle check
+            while (endX < shipSize.width && isUnderwater(endX))
             {
-                // Check alignment with direction
-                //
-                // Note: here we take a particle's bottom-left corner as the point for which
-                // we check its direction
-                auto const coordsF = coords.ToFloat();
-                float const alignment = (coordsF - waterlineCenter).dot(waterlineDirection);
-                if (alignment >= 0.0f)
-                {
-                    // This point is on the "underwater" side of the center, along the direction
-
-                    // Note: here we do the same as the simulator currently does wrt "buoyancy volume fill"
-                    totalBuoyantForce += WaterDensity * material->BuoyancyVolumeFill;
-                    centerOfBuoyancySum += coordsF * WaterDensity * material->BuoyancyVolumeFill;
-                }
+                ++endX;
             }
+
+            while (endX > startX && !isUnderwater(endX - 1))
+            {
+                --endX;
+            }
+        }
+        else
+        {
+            // Whole row or nothing
+            startX = 0;
+            endX = isUnderwater(0) ? shipSize.width : 0;
+        }
+
+        if (startX < endX)
+        {
+            size_t const rowStart = rowStride * y;
+
+            float const spanBuoyantForce = mBuoyantForcePrefixSums[rowStart + endX] - mBuoyantForcePrefixSums[rowStart + startX];
+            float const spanBuoyantForceX = mBuoyantForceXPrefixSums[rowStart + endX] - mBuoyantForceXPrefixSums[rowStart + startX];
+
+            totalBuoyantForce += spanBuoyantForce;
+            centerOfBuoyancySum += vec2f(spanBuoyantForceX, spanBuoyantForce * static_cast<float>(y));
         }
     }
 
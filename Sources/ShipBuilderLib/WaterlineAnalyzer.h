@@ -10,6 +10,8 @@
 #include <Core/Vectors.h>
 
 #include <optional>
+#include <tuple>
+#include <vector>
 
 namespace ShipBuilder {
 
@@ -86,13 +88,24 @@ private:
     // Total buoyance force, center of buoyancy
     std::tuple<float, vec2f> CalculateBuoyancyWithWaterline(
         vec2f const & waterlineCenter, // Ship coordinates
-        vec2f const & waterlineDirection);
+        vec2f const & waterlineDirection) const;
 
 private:
 
+    friend class WaterlineAnalyzerTests_Buoyancy_MatchesPerParticleSum_Test;
+
     IModelObservable const & mModel;
     ModelMacroProperties const mModelMacroProperties;
 
+    //
+    // Per-row prefix sums of buoyant force, and of buoyant force * x, each row
+    // having width + 1 entries - so that the buoyancy of any row span may be
+    // calculated in constant time
+    //
+
+    std::vector<float> mBuoyantForcePrefixSums;
+    std::vector<float> mBuoyantForceXPrefixSums;
+
     //
     // Search state
     //
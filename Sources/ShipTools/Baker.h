@@ -4,12 +4,19 @@
 * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
 ***************************************************************************************/
 
+#include <Core/FontSet.h>
 #include <Core/TextureAtlas.h>
 #include <Core/TextureDatabase.h>
+#include <Core/ThreadManager.h>
+#include <Core/ThreadPool.h>
 #include <Core/Utils.h>
 
 #include <Game/FileStreams.h>
 #include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/ShipTexturizer.h>
 
 #include <filesystem>
 #include <iostream>
@@ -85,12 +92,19 @@ public:
         if (options.SuppressDuplicates)
             atlasOptions = atlasOptions | TextureAtlasOptions::SuppressDuplicates;
 
+        // Decode and resize frames on all processors
+        ThreadManager threadManager(
+            false,
+            ThreadManager::GetNumberOfProcessors(),
+            [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
         auto textureAtlas = options.Regular
             ? TextureAtlasBuilder<TTextureDatabase>::BuildRegularAtlas(
                 textureDatabase,
                 atlasOptions,
                 resizeFactor,
                 assetManager,
+                threadManager.GetSimulationThreadPool(),
                 SimpleProgressCallback([](float)
                 {
                     std::cout << ".";
@@ -100,6 +114,7 @@ public:
                 atlasOptions,
                 resizeFactor,
                 assetManager,
+                threadManager.GetSimulationThreadPool(),
                 SimpleProgressCallback([](float)
                 {
                     std::cout << ".";
@@ -114,4 +129,97 @@ public:
 
         return { textureAtlas.Metadata.GetFrameCount(), textureAtlas.Image.Size };
     }
+
+    /*
+     * Bakes the font set into a single blob with its atlas and metadata, which the
+     * game then loads in place of the individual fonts.
+     */
+    template<typename TFontSet>
+    static std::tuple<size_t, ImageSize> BakeFontSet(
+        std::filesystem::path const & outputDirectoryPath,
+        GameAssetManager const & assetManager)
+    {
+        if (!std::filesystem::exists(outputDirectoryPath))
+        {
+            throw std::runtime_error("Output directory '" + outputDirectoryPath.string() + "' does not exist");
+        }
+
+        std::cout << "Building font set...";
+
+        // Explicitly from the fonts, as there might be a stale blob already
+        auto const fontSet = FontSet<TFontSet>::LoadFromBffFonts(
+            assetManager,
+            SimpleProgressCallback([](float)
+            {
+                std::cout << ".";
+            }));
+
+        std::cout << std::endl;
+
+        FileBinaryWriteStream outputStream(outputDirectoryPath / GameAssetManager::MakeBakedFontSetFilename(TFontSet::FontSetName));
+        fontSet.Serialize(outputStream);
+        outputStream.Close();
+
+        return { fontSet.Metadata.size(), fontSet.Atlas.Size };
+    }
+
+    /*
+     * Saves a copy of the ship with the textures that the game would otherwise have to
+     * auto-texturize at each load; returns whether the exterior and interior textures
+     * have been baked, respectively.
+     */
+    static std::tuple<bool, bool> BakeShip(
+        std::filesystem::path const & inputShipFilePath,
+        std::filesystem::path const & outputShipFilePath,
+        GameAssetManager const & assetManager)
+    {
+        if (!std::filesystem::exists(inputShipFilePath))
+        {
+            throw std::runtime_error("Input ship file '" + inputShipFilePath.string() + "' does not exist");
+        }
+
+        if (!ShipDeSerializer::IsShipDefinitionFile(outputShipFilePath))
+        {
+            throw std::runtime_error("Output ship file '" + outputShipFilePath.string() + "' is not a "
+                + ShipDeSerializer::GetShipDefinitionFileExtension() + " file");
+        }
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(assetManager);
+        ShipTexturizer const shipTexturizer(materialDatabase, assetManager);
+
+        // Load ship
+        ShipDefinition shipDefinition = ShipDeSerializer::LoadShip(inputShipFilePath, materialDatabase);
+        assert(shipDefinition.Layers.StructuralLayer);
+
+        // Bake textures, exactly as the ship factory would make them
+        bool hasBakedExterior = false;
+        if (!shipDefinition.Layers.ExteriorTextureLayer)
+        {
+            shipDefinition.Layers.ExteriorTextureLayer = std::make_unique<TextureLayerData>(
+                shipTexturizer.MakeAutoTexture(
+                    *shipDefinition.Layers.StructuralLayer,
+                    shipDefinition.AutoTexturizationSettings,
+                    ShipTexturizer::MaxHighDefinitionTextureSize,
+                    assetManager));
+
+            hasBakedExterior = true;
+        }
+
+        bool hasBakedInterior = false;
+        if (!shipDefinition.Layers.InteriorTextureLayer)
+        {
+            shipDefinition.Layers.InteriorTextureLayer = std::make_unique<TextureLayerData>(
+                shipTexturizer.MakeInteriorAutoTexture(
+                    *shipDefinition.Layers.StructuralLayer,
+                    ShipTexturizer::MaxHighDefinitionTextureSize,
+                    assetManager));
+
+            hasBakedInterior = true;
+        }
+
+        // Save ship
+        ShipDeSerializer::SaveShip(shipDefinition, outputShipFilePath);
+
+        return { hasBakedExterior, hasBakedInterior };
+    }
 };
@@ -7,6 +7,9 @@
 #include "AndroidTextureDatabases.h"
 #include "Baker.h"
 
+#include <Game/AssetArchive.h>
+
+#include <Render/GameFontSets.h>
 #include <Render/GameTextureDatabases.h>
 
 #include <Core/ImageData.h>
@@ -20,6 +23,9 @@
 #define SEPARATOR "------------------------------------------------------"
 
 int DoBakeAtlas(int argc, char ** argv);
+int DoBakeFonts(int argc, char ** argv);
+int DoBakeShip(int argc, char ** argv);
+int DoPackAssets(int argc, char ** argv);
 
 void PrintUsage();
 
@@ -38,6 +44,18 @@ int main(int argc, char ** argv)
         {
             return DoBakeAtlas(argc, argv);
         }
+        else if (verb == "bake_fonts")
+        {
+            return DoBakeFonts(argc, argv);
+        }
+        else if (verb == "bake_ship")
+        {
+            return DoBakeShip(argc, argv);
+        }
+        else if (verb == "pack_assets")
+        {
+            return DoPackAssets(argc, argv);
+        }
         else
         {
             throw std::runtime_error("Unrecognized verb '" + verb + "'");
@@ -185,9 +203,101 @@ int DoBakeAtlas(int argc, char ** argv)
     return 0;
 }
 
+int DoBakeFonts(int argc, char ** argv)
+{
+    if (argc < 4)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const gameRootDirectoryPath(argv[2]);
+    std::filesystem::path const outputDirectoryPath(argv[3]);
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running bake_fonts:" << std::endl;
+    std::cout << "  game root directory           : " << gameRootDirectoryPath << std::endl;
+    std::cout << "  output directory              : " << outputDirectoryPath << std::endl;
+
+    // The asset manager finds the game's root as the parent of what it's given
+    GameAssetManager const assetManager((gameRootDirectoryPath / "Data").string());
+
+    auto const [fontCount, atlasSize] = Baker::BakeFontSet<GameFontSets::FontSet>(
+        outputDirectoryPath,
+        assetManager);
+
+    std::cout << "Baking completed - " << fontCount << " fonts, " << atlasSize.width
+        << "x" << atlasSize.height << "." << std::endl;
+
+    return 0;
+}
+
+int DoBakeShip(int argc, char ** argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const inputShipFilePath(argv[2]);
+    std::filesystem::path const outputShipFilePath(argv[3]);
+    std::filesystem::path const gameRootDirectoryPath(argv[4]);
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running bake_ship:" << std::endl;
+    std::cout << "  input ship file               : " << inputShipFilePath << std::endl;
+    std::cout << "  output ship file              : " << outputShipFilePath << std::endl;
+    std::cout << "  game root directory           : " << gameRootDirectoryPath << std::endl;
+
+    // The asset manager finds the game's root as the parent of what it's given
+    GameAssetManager const assetManager((gameRootDirectoryPath / "Data").string());
+
+    auto const [hasBakedExterior, hasBakedInterior] = Baker::BakeShip(
+        inputShipFilePath,
+        outputShipFilePath,
+        assetManager);
+
+    std::cout << "Baking completed - exterior texture: " << (hasBakedExterior ? "baked" : "already present")
+        << ", interior texture: " << (hasBakedInterior ? "baked" : "already present") << "." << std::endl;
+
+    return 0;
+}
+
+int DoPackAssets(int argc, char ** argv)
+{
+    if (argc < 4)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const dataDirectoryPath(argv[2]);
+    std::filesystem::path const outputArchiveFilePath(argv[3]);
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running pack_assets:" << std::endl;
+    std::cout << "  data directory                : " << dataDirectoryPath << std::endl;
+    std::cout << "  output archive file           : " << outputArchiveFilePath << std::endl;
+
+    size_t const fileCount = AssetArchive::Pack(
+        dataDirectoryPath,
+        outputArchiveFilePath);
+
+    std::cout << "Packing completed - " << fileCount << " files." << std::endl;
+
+    return 0;
+}
+
 void PrintUsage()
 {
     std::cout << std::endl;
     std::cout << "Usage:" << std::endl;
     std::cout << " bake_atlas Cloud|Explosion|NPC|AndroidUI <textures_root_dir> <out_dir> [[-a] [-b] [-m] [-d] [-r] | -o <options_json>] [-z <resize_factor>]" << std::endl;
+    std::cout << " bake_fonts <game_root_dir> <out_dir>" << std::endl;
+    std::cout << " bake_ship <in_ship_file> <out_shp2_file> <game_root_dir>" << std::endl;
+    std::cout << " pack_assets <data_dir> <out_archive_file>" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,236 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "EventRecorder.h"
+
+#include <Core/GameException.h>
+#include <Core/Log.h>
+
+#include <cassert>
+#include <cstring>
+
+namespace {
+
+    // File header: magic, format version, record size
+    char constexpr FileMagic[4] = { 'F', 'S', 'E', 'R' };
+    std::uint32_t constexpr FileFormatVersion = 1;
+}
+
+RecordedEvents RecordedEvents::Load(std::filesystem::path const & filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        throw GameException("Cannot open recorded events file \"" + filePath.string() + "\"");
+    }
+
+    size_t const fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+
+    size_t constexpr HeaderSize = sizeof(FileMagic) + sizeof(std::uint32_t) * 2;
+
+    char magic[sizeof(FileMagic)];
+    std::uint32_t version = 0;
+    std::uint32_t recordSize = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&recordSize), sizeof(recordSize));
+
+    if (!file
+        || std::memcmp(magic, FileMagic, sizeof(FileMagic)) != 0
+        || version != FileFormatVersion
+        || recordSize != sizeof(RecordedEvent))
+    {
+        throw GameException("Recorded events file \"" + filePath.string() + "\" is not a valid recorded events file");
+    }
+
+    // Read all records in one go
+    std::vector<RecordedEvent> events((fileSize - HeaderSize) / sizeof(RecordedEvent));
+    file.read(reinterpret_cast<char *>(events.data()), events.size() * sizeof(RecordedEvent));
+
+    return RecordedEvents(std::move(events));
+}
+
+EventRecorder::EventRecorder(
+    std::function<void(uint32_t, RecordedEvent const &)> onEventCallback,
+    std::optional<std::filesystem::path> streamFilePath)
+    : mOnEventCallback(std::move(onEventCallback))
+    , mCurrentChunk(std::make_unique<Chunk>())
+    , mEventCount(0)
+    , mFullChunks()
+    , mStreamFilePath(std::move(streamFilePath))
+    , mStreamFile()
+    , mWriterThread()
+    , mWriterLock()
+    , mWriterSignal()
+    , mChunksToWrite()
+    , mFreeChunks()
+    , mIsWriterStopRequested(false)
+{
+    if (mStreamFilePath.has_value())
+    {
+        mStreamFile.open(*mStreamFilePath, std::ios::binary | std::ios::trunc);
+        if (!mStreamFile.is_open())
+        {
+            throw GameException("Cannot create recorded events file \"" + mStreamFilePath->string() + "\"");
+        }
+
+        std::uint32_t const recordSize = static_cast<std::uint32_t>(sizeof(RecordedEvent));
+        mStreamFile.write(FileMagic, sizeof(FileMagic));
+        mStreamFile.write(reinterpret_cast<char const *>(&FileFormatVersion), sizeof(FileFormatVersion));
+        mStreamFile.write(reinterpret_cast<char const *>(&recordSize), sizeof(recordSize));
+
+        mWriterThread = std::thread(&EventRecorder::WriterThreadLoop, this);
+
+        LogMessage("EventRecorder: streaming to \"", mStreamFilePath->string(), "\"");
+    }
+}
+
+EventRecorder::~EventRecorder()
+{
+    if (mWriterThread.joinable())
+    {
+        {
+            std::lock_guard const lock{ mWriterLock };
+            mIsWriterStopRequested = true;
+        }
+
+        mWriterSignal.notify_one();
+        mWriterThread.join();
+    }
+}
+
+RecordedEvents EventRecorder::StopRecording()
+{
+    if (mStreamFilePath.has_value())
+    {
+        //
+        // Hand over the last chunk, wait for the writer to drain, and read everything back
+        //
+
+        assert(mWriterThread.joinable());
+
+        {
+            std::lock_guard const lock{ mWriterLock };
+
+            mChunksToWrite.emplace_back(std::move(mCurrentChunk));
+            mIsWriterStopRequested = true;
+        }
+
+        mWriterSignal.notify_one();
+        mWriterThread.join();
+
+        mStreamFile.close();
+
+        mCurrentChunk = std::make_unique<Chunk>();
+
+        LogMessage("EventRecorder: streamed ", mEventCount, " events");
+
+        return RecordedEvents::Load(*mStreamFilePath);
+    }
+    else
+    {
+        //
+        // Concatenate chunks
+        //
+
+        std::vector<RecordedEvent> events;
+        events.reserve(mEventCount);
+
+        for (auto const & chunk : mFullChunks)
+        {
+            events.insert(events.end(), chunk->Events.cbegin(), chunk->Events.cbegin() + chunk->Count);
+        }
+
+        events.insert(events.end(), mCurrentChunk->Events.cbegin(), mCurrentChunk->Events.cbegin() + mCurrentChunk->Count);
+
+        mFullChunks.clear();
+        mCurrentChunk->Count = 0;
+
+        return RecordedEvents(std::move(events));
+    }
+}
+
+void EventRecorder::OnChunkFull()
+{
+    if (mStreamFilePath.has_value())
+    {
+        std::unique_ptr<Chunk> newChunk;
+
+        {
+            std::lock_guard const lock{ mWriterLock };
+
+            mChunksToWrite.emplace_back(std::move(mCurrentChunk));
+
+            if (!mFreeChunks.empty())
+            {
+                newChunk = std::move(mFreeChunks.back());
+                mFreeChunks.pop_back();
+            }
+        }
+
+        mWriterSignal.notify_one();
+
+        mCurrentChunk = newChunk ? std::move(newChunk) : std::make_unique<Chunk>();
+    }
+    else
+    {
+        mFullChunks.emplace_back(std::move(mCurrentChunk));
+        mCurrentChunk = std::make_unique<Chunk>();
+    }
+
+    mCurrentChunk->Count = 0;
+}
+
+void EventRecorder::WriterThreadLoop()
+{
+    std::vector<std::unique_ptr<Chunk>> chunksToWrite;
+
+    while (true)
+    {
+        bool isStopRequested;
+
+        {
+            std::unique_lock lock{ mWriterLock };
+
+            mWriterSignal.wait(
+                lock,
+                [this]
+                {
+                    return !mChunksToWrite.empty() || mIsWriterStopRequested;
+                });
+
+            std::swap(chunksToWrite, mChunksToWrite);
+            isStopRequested = mIsWriterStopRequested;
+        }
+
+        // Write without holding the lock
+        for (auto const & chunk : chunksToWrite)
+        {
+            mStreamFile.write(
+                reinterpret_cast<char const *>(chunk->Events.data()),
+                chunk->Count * sizeof(RecordedEvent));
+        }
+
+        mStreamFile.flush();
+
+        {
+            std::lock_guard const lock{ mWriterLock };
+
+            // Recycle chunks
+            for (auto & chunk : chunksToWrite)
+            {
+                mFreeChunks.emplace_back(std::move(chunk));
+            }
+        }
+
+        chunksToWrite.clear();
+
+        if (isStopRequested)
+        {
+            break;
+        }
+    }
+}
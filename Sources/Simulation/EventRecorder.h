@@ -8,123 +8,123 @@
 #include <Core/GameTypes.h>
 #include <Core/Vectors.h>
 
+#include <array>
+#include <condition_variable>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
-#include <sstream>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
-class RecordedEvent
+/*
+ * A recorded event; a tagged, plain-old-data record, so that events may be stored
+ * contiguously and streamed to disk verbatim.
+ */
+struct RecordedEvent final
 {
 public:
 
-    virtual ~RecordedEvent()
-    {}
-
-    enum class RecordedEventType
+    enum class RecordedEventType : std::uint32_t
     {
         PointDetachForDestroy,
         TriangleDestroy
     };
 
-    RecordedEventType GetType() const
+    static RecordedEvent MakePointDetachForDestroy(
+        ElementIndex pointIndex,
+        vec2f const & detachVelocity,
+        float simulationTime)
     {
-        return mType;
+        return RecordedEvent(RecordedEventType::PointDetachForDestroy, pointIndex, detachVelocity, simulationTime);
     }
 
-    virtual std::string ToString() const = 0;
-
-protected:
-
-    RecordedEvent(RecordedEventType type)
-        : mType(type)
+    static RecordedEvent MakeTriangleDestroy(ElementIndex pointIndex)
     {
+        return RecordedEvent(RecordedEventType::TriangleDestroy, pointIndex, vec2f::zero(), 0.0f);
     }
 
-private:
-
-    RecordedEventType const mType;
-};
+    RecordedEvent() = default;
 
-class RecordedPointDetachForDestroyEvent final : public RecordedEvent
-{
-public:
-
-    RecordedPointDetachForDestroyEvent(
-        ElementIndex pointIndex,
-        vec2f detachVelocity,
-        float simulationTime)
-        : RecordedEvent(RecordedEventType::PointDetachForDestroy)
-        , mPointIndex(pointIndex)
-        , mDetachVelocity(detachVelocity)
-        , mSimulationTime(simulationTime)
-    {}
+    RecordedEventType GetType() const
+    {
+        return mType;
+    }
 
     ElementIndex GetPointIndex() const
     {
         return mPointIndex;
     }
 
+    // Only for PointDetachForDestroy
     vec2f const & GetDetachVelocity() const
     {
         return mDetachVelocity;
     }
 
+    // Only for PointDetachForDestroy
     float GetSimulationTime() const
     {
         return mSimulationTime;
     }
 
-    std::string ToString() const override
+    std::string ToString() const
     {
-        std::stringstream ss;
-        ss << "PointDetachOnDestroy:" << mPointIndex;
-        return ss.str();
-    }
+        switch (mType)
+        {
+            case RecordedEventType::PointDetachForDestroy:
+                return "PointDetachOnDestroy:" + std::to_string(mPointIndex);
 
-private:
+            case RecordedEventType::TriangleDestroy:
+                return "TriangleDestroy:" + std::to_string(mPointIndex);
+        }
 
-    ElementIndex const mPointIndex;
-    vec2f const mDetachVelocity;
-    float const mSimulationTime;
-};
+        return "?";
+    }
 
-class RecordedTriangleDestroyEvent final : public RecordedEvent
-{
-public:
+private:
 
-    RecordedTriangleDestroyEvent(ElementIndex pointIndex)
-        : RecordedEvent(RecordedEventType::TriangleDestroy)
+    RecordedEvent(
+        RecordedEventType type,
+        ElementIndex pointIndex,
+        vec2f const & detachVelocity,
+        float simulationTime)
+        : mType(type)
         , mPointIndex(pointIndex)
+        , mDetachVelocity(detachVelocity)
+        , mSimulationTime(simulationTime)
     {}
 
-    ElementIndex GetPointIndex() const
-    {
-        return mPointIndex;
-    }
-
-    std::string ToString() const override
-    {
-        std::stringstream ss;
-        ss << "TriangleDestroy:" << mPointIndex;
-        return ss.str();
-    }
-
-private:
-
-    ElementIndex const mPointIndex;
+    RecordedEventType mType;
+    ElementIndex mPointIndex;
+    vec2f mDetachVelocity;
+    float mSimulationTime;
 };
 
+static_assert(std::is_trivially_copyable_v<RecordedEvent>);
+
+/*
+ * A recorded event sequence, stored contiguously.
+ */
 class RecordedEvents
 {
 public:
 
-    RecordedEvents(std::vector<std::unique_ptr<RecordedEvent>> && recordedEvents)
+    explicit RecordedEvents(std::vector<RecordedEvent> && recordedEvents)
         : mEvents(std::move(recordedEvents))
     {
     }
 
+    /*
+     * Loads events streamed to a file by an EventRecorder.
+     */
+    static RecordedEvents Load(std::filesystem::path const & filePath);
+
     size_t GetSize() const
     {
         return mEvents.size();
@@ -132,45 +132,97 @@ public:
 
     RecordedEvent const & GetEvent(size_t index) const
     {
-        return *mEvents[index];
+        return mEvents[index];
     }
 
 private:
 
-    std::vector<std::unique_ptr<RecordedEvent>> mEvents;
+    std::vector<RecordedEvent> mEvents;
 };
 
+/*
+ * Records events into fixed-size chunks of records, hence without any per-event allocation.
+ *
+ * When given a file, full chunks are handed over to a background thread which appends
+ * them to the file and recycles them, so that memory stays bounded however long
+ * the recording.
+ */
 class EventRecorder
 {
 public:
 
-    EventRecorder(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback)
-        : mEvents()
-        , mOnEventCallback(std::move(onEventCallback))
-    {}
+    explicit EventRecorder(
+        std::function<void(uint32_t, RecordedEvent const &)> onEventCallback,
+        std::optional<std::filesystem::path> streamFilePath = std::nullopt);
+
+    ~EventRecorder();
+
+    EventRecorder(EventRecorder const &) = delete;
+    EventRecorder & operator=(EventRecorder const &) = delete;
 
-    template<typename TRecordedEvent, typename... Args>
-    void RecordEvent(Args&&... args)
+    void RecordEvent(RecordedEvent const & event)
     {
-        mEvents.emplace_back(
-            new TRecordedEvent(std::forward<Args>(args)...));
+        if (mCurrentChunk->Count == ChunkSize)
+        {
+            OnChunkFull();
+        }
+
+        mCurrentChunk->Events[mCurrentChunk->Count++] = event;
+        ++mEventCount;
 
         if (mOnEventCallback)
         {
             mOnEventCallback(
-                static_cast<uint32_t>(mEvents.size() - 1),
-                *(mEvents.back()));
+                static_cast<uint32_t>(mEventCount - 1),
+                event);
         }
     }
 
-    RecordedEvents StopRecording()
+    size_t GetEventCount() const
     {
-        return RecordedEvents(std::move(mEvents));
+        return mEventCount;
     }
 
+    RecordedEvents StopRecording();
+
 private:
 
-    std::vector<std::unique_ptr<RecordedEvent>> mEvents;
+    static size_t constexpr ChunkSize = 4096; // Events
+
+    struct Chunk
+    {
+        std::array<RecordedEvent, ChunkSize> Events;
+        size_t Count{ 0 };
+    };
+
+    void OnChunkFull();
+
+    std::unique_ptr<Chunk> AcquireChunk();
+
+    void WriterThreadLoop();
+
+private:
 
     std::function<void(uint32_t, RecordedEvent const &)> mOnEventCallback;
-};
\ No newline at end of file
+
+    std::unique_ptr<Chunk> mCurrentChunk;
+    size_t mEventCount;
+
+    // Only when not streaming
+    std::vector<std::unique_ptr<Chunk>> mFullChunks;
+
+    //
+    // Streaming
+    //
+
+    std::optional<std::filesystem::path> const mStreamFilePath;
+    std::ofstream mStreamFile;
+    std::thread mWriterThread;
+
+    // Guarded by lock
+    std::mutex mWriterLock;
+    std::condition_variable mWriterSignal;
+    std::vector<std::unique_ptr<Chunk>> mChunksToWrite;
+    std::vector<std::unique_ptr<Chunk>> mFreeChunks;
+    bool mIsWriterStopRequested;
+};
@@ -17,6 +17,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <optional>
 #include <string>
@@ -124,11 +125,11 @@ public:
 
     StructuralMaterial const * FindStructuralMaterial(MaterialColorKey const & colorKey) const
     {
-        if (auto const srchIt = mStructuralMaterialColorMap.find(colorKey);
-            srchIt != mStructuralMaterialColorMap.cend())
+        if (StructuralMaterial const * const material = mStructuralMaterialColorKeyIndex.Find(ColorKeyIndex<StructuralMaterial>::MakeKey(colorKey));
+            material != nullptr)
         {
             // Found color key verbatim!
-            return &(srchIt->second);
+            return material;
         }
 
         // Check whether it's a rope endpoint
@@ -196,15 +197,8 @@ public:
 
     ElectricalMaterial const * FindElectricalMaterial(MaterialColorKey const & colorKey) const
     {
-        if (auto const srchIt = mElectricalMaterialColorMap.find(colorKey);
-            srchIt != mElectricalMaterialColorMap.cend())
-        {
-            // Found color key verbatim!
-            return &(srchIt->second);
-        }
-
-        // No luck
-        return nullptr;
+        // Found color key verbatim, or no luck
+        return mElectricalMaterialColorKeyIndex.Find(ColorKeyIndex<ElectricalMaterial>::MakeKey(colorKey));
     }
 
     ElectricalMaterial const * FindElectricalMaterialLegacy(MaterialColorKey const & colorKey) const
@@ -217,15 +211,8 @@ public:
             return verbatimMatch;
         }
 
-        // Try just instanced now (i.e. matching on r and g only)
-        if (auto srchIt = mInstancedElectricalMaterialMap.find(colorKey);
-            srchIt != mInstancedElectricalMaterialMap.end())
-        {
-            return srchIt->second;
-        }
-
-        // No luck
-        return nullptr;
+        // Try just instanced now (i.e. matching on r and g only), or no luck
+        return mInstancedElectricalMaterialColorKeyIndex.Find(ColorKeyIndex<ElectricalMaterial>::MakeInstancedKey(colorKey));
     }
 
     MaterialColorMap<ElectricalMaterial> const & GetElectricalMaterialColorMap() const
@@ -255,6 +242,130 @@ private:
         }
     };
 
+    /*
+     * Open-addressing hash index from color keys to materials, for the per-pixel
+     * lookups done while loading ships. Built once at load, and kept at a low load
+     * factor so that a lookup is nearly always a single probe.
+     *
+     * Points into the color maps, whose nodes stay put when the database is moved.
+     */
+    template<typename TMaterial>
+    class ColorKeyIndex
+    {
+    public:
+
+        static std::uint32_t MakeKey(MaterialColorKey const & colorKey)
+        {
+            return (static_cast<std::uint32_t>(colorKey.r) << 16)
+                | (static_cast<std::uint32_t>(colorKey.g) << 8)
+                | static_cast<std::uint32_t>(colorKey.b);
+        }
+
+        static std::uint32_t MakeInstancedKey(MaterialColorKey const & colorKey)
+        {
+            return (static_cast<std::uint32_t>(colorKey.r) << 8)
+                | static_cast<std::uint32_t>(colorKey.g);
+        }
+
+        ColorKeyIndex()
+            : mEntries()
+            , mShift(0)
+        {}
+
+        explicit ColorKeyIndex(std::vector<std::pair<std::uint32_t, TMaterial const *>> const & entries)
+        {
+            // Capacity: power of two, at least four times the number of entries
+            size_t capacityLog2 = 4;
+            while ((size_t(1) << capacityLog2) < entries.size() * 4)
+            {
+                ++capacityLog2;
+            }
+
+            mEntries.assign(size_t(1) << capacityLog2, Entry{ EmptyKey, nullptr });
+            mShift = static_cast<std::uint32_t>(32 - capacityLog2);
+
+            for (auto const & entry : entries)
+            {
+                assert(entry.first != EmptyKey);
+
+                size_t i = Hash(entry.first);
+                while (mEntries[i].Key != EmptyKey)
+                {
+                    assert(mEntries[i].Key != entry.first);
+                    i = (i + 1) & (mEntries.size() - 1);
+                }
+
+                mEntries[i] = Entry{ entry.first, entry.second };
+            }
+        }
+
+        inline TMaterial const * Find(std::uint32_t key) const
+        {
+            if (mEntries.empty())
+            {
+                return nullptr;
+            }
+
+            for (size_t i = Hash(key); ; i = (i + 1) & (mEntries.size() - 1))
+            {
+                if (mEntries[i].Key == key)
+                {
+                    return mEntries[i].Material;
+                }
+
+                if (mEntries[i].Key == EmptyKey)
+                {
+                    return nullptr;
+                }
+            }
+        }
+
+    private:
+
+        // Keys are at most 24 bits
+        static std::uint32_t constexpr EmptyKey = std::numeric_limits<std::uint32_t>::max();
+
+        struct Entry
+        {
+            std::uint32_t Key;
+            TMaterial const * Material;
+        };
+
+        inline size_t Hash(std::uint32_t key) const
+        {
+            // Fibonacci hashing
+            return static_cast<size_t>((key * 2654435769u) >> mShift);
+        }
+
+        std::vector<Entry> mEntries;
+        std::uint32_t mShift;
+    };
+
+    template<typename TMaterial>
+    static ColorKeyIndex<TMaterial> MakeColorKeyIndex(MaterialColorMap<TMaterial> const & colorMap)
+    {
+        std::vector<std::pair<std::uint32_t, TMaterial const *>> entries;
+        entries.reserve(colorMap.size());
+        for (auto const & entry : colorMap)
+        {
+            entries.emplace_back(ColorKeyIndex<TMaterial>::MakeKey(entry.first), &(entry.second));
+        }
+
+        return ColorKeyIndex<TMaterial>(entries);
+    }
+
+    static ColorKeyIndex<ElectricalMaterial> MakeInstancedColorKeyIndex(std::map<MaterialColorKey, ElectricalMaterial const *, InstancedColorKeyComparer> const & instancedMap)
+    {
+        std::vector<std::pair<std::uint32_t, ElectricalMaterial const *>> entries;
+        entries.reserve(instancedMap.size());
+        for (auto const & entry : instancedMap)
+        {
+            entries.emplace_back(ColorKeyIndex<ElectricalMaterial>::MakeInstancedKey(entry.first), entry.second);
+        }
+
+        return ColorKeyIndex<ElectricalMaterial>(entries);
+    }
+
 private:
 
     MaterialDatabase(
@@ -276,6 +387,9 @@ private:
         , mElectricalMaterialColorMap(std::move(electricalMaterialColorMap))
         , mInstancedElectricalMaterialMap(std::move(instancedElectricalMaterialMap))
         , mElectricalMaterialPalette(std::move(electricalMaterialPalette))
+        , mStructuralMaterialColorKeyIndex(MakeColorKeyIndex(mStructuralMaterialColorMap))
+        , mElectricalMaterialColorKeyIndex(MakeColorKeyIndex(mElectricalMaterialColorMap))
+        , mInstancedElectricalMaterialColorKeyIndex(MakeInstancedColorKeyIndex(mInstancedElectricalMaterialMap))
     {
     }
 
@@ -293,4 +407,9 @@ private:
     MaterialColorMap<ElectricalMaterial> mElectricalMaterialColorMap;
     std::map<MaterialColorKey, ElectricalMaterial const *, InstancedColorKeyComparer> mInstancedElectricalMaterialMap; // Redundant map for (legacy) instanced material lookup
     Palette<ElectricalMaterial> mElectricalMaterialPalette;
+
+    // Lookup indices
+    ColorKeyIndex<StructuralMaterial> mStructuralMaterialColorKeyIndex;
+    ColorKeyIndex<ElectricalMaterial> mElectricalMaterialColorKeyIndex;
+    ColorKeyIndex<ElectricalMaterial> mInstancedElectricalMaterialColorKeyIndex;
 };
@@ -39,6 +39,10 @@ Clouds::Clouds()
     , mClouds()
     , mStormClouds()
     , mShadowBuffer(ShadowBufferSize)
+    , mAreShadowsDirty(true)
+    , mShadowsCameraWorldPosition(vec2f::zero())
+    , mUploadedShadowBuffer(ShadowBufferSize)
+    , mHaveShadowsBeenUploaded(false)
 {
 }
 
@@ -48,6 +52,9 @@ void Clouds::Update(
     Storm::Parameters const & stormParameters,
     SimulationParameters const & simulationParameters)
 {
+    // Clouds are about to move
+    mAreShadowsDirty = true;
+
     float const windSign = baseAndStormSpeedMagnitude < 0.0f ? -1.0f : 1.0f;
 
     //
@@ -250,20 +257,38 @@ void Clouds::Upload(RenderContext & renderContext)
 
     if (renderContext.GetOceanRenderDetail() == OceanRenderDetailType::Detailed)
     {
-        // Update shadows
+        ViewModel const & viewModel = renderContext.GetViewModel();
+
+        // Update shadows, if clouds or camera have changed
+        if (mAreShadowsDirty
+            || viewModel.GetCameraWorldPosition() != mShadowsCameraWorldPosition)
         {
             mShadowBuffer.fill<ShadowBufferSize>(1.0f);
 
-            UpdateShadows(mClouds, renderContext.GetViewModel());
-            UpdateShadows(mStormClouds, renderContext.GetViewModel());
+            UpdateShadows(mClouds, viewModel);
+            UpdateShadows(mStormClouds, viewModel);
 
             OffsetShadowsBuffer_Min();
+
+            mAreShadowsDirty = false;
+            mShadowsCameraWorldPosition = viewModel.GetCameraWorldPosition();
         }
 
-        // Upload shadows
-        renderContext.UploadCloudShadows(
-            mShadowBuffer.data(),
-            mShadowBuffer.GetSize());
+        // Upload shadows, if they have changed visibly
+        if (!mHaveShadowsBeenUploaded || HaveShadowsChangedSinceUpload())
+        {
+            renderContext.UploadCloudShadows(
+                mShadowBuffer.data(),
+                mShadowBuffer.GetSize());
+
+            mUploadedShadowBuffer.copy_from(mShadowBuffer);
+            mHaveShadowsBeenUploaded = true;
+        }
+    }
+    else
+    {
+        // Make sure we upload fresh shadows once we're back to detailed
+        mHaveShadowsBeenUploaded = false;
     }
 }
 
@@ -442,4 +467,21 @@ void Clouds::OffsetShadowsBuffer_Min()
     }
 }
 
+bool Clouds::HaveShadowsChangedSinceUpload() const
+{
+    // Shadow changes smaller than this are not noticeable, as clouds drift slowly
+    float constexpr Tolerance = 1.0f / 512.0f;
+
+    float const * restrict const shadowBuffer = mShadowBuffer.data();
+    float const * restrict const uploadedShadowBuffer = mUploadedShadowBuffer.data();
+
+    float maxDelta = 0.0f;
+    for (size_t i = 0; i < ShadowBufferSize; ++i)
+    {
+        maxDelta = std::max(maxDelta, std::abs(shadowBuffer[i] - uploadedShadowBuffer[i]));
+    }
+
+    return maxDelta > Tolerance;
+}
+
 }
\ No newline at end of file
@@ -48,6 +48,8 @@ private:
 
     inline void OffsetShadowsBuffer_Min();
 
+    inline bool HaveShadowsChangedSinceUpload() const;
+
 private:
 
     //
@@ -112,6 +114,16 @@ private:
     //
 
     Buffer<float> mShadowBuffer;
+
+    // The shadow buffer only depends on the clouds and on the camera; we only
+    // recalculate it when either has changed since the last calculation
+    bool mAreShadowsDirty;
+    vec2f mShadowsCameraWorldPosition;
+
+    // What we've uploaded last, if anything; we only upload shadows when they
+    // differ visibly from these
+    Buffer<float> mUploadedShadowBuffer;
+    bool mHaveShadowsBeenUploaded;
 };
 
 }
@@ -549,6 +549,42 @@ void ElectricalElements::Query(ElementIndex elementIndex) const
     }
 }
 
+void ElectricalElements::ReportMemory(MemoryReport & report) const
+{
+    report.Add("ElectricalElements", "IsDeleted", mIsDeletedBuffer);
+    report.Add("ElectricalElements", "PointIndex", mPointIndexBuffer);
+    report.Add("ElectricalElements", "Material", mMaterialBuffer);
+    report.Add("ElectricalElements", "MaterialType", mMaterialTypeBuffer);
+    report.Add("ElectricalElements", "Conductivity", mConductivityBuffer);
+    report.Add("ElectricalElements", "MaterialHeatGenerated", mMaterialHeatGeneratedBuffer);
+    report.Add("ElectricalElements", "MaterialOperatingTemperatures", mMaterialOperatingTemperaturesBuffer);
+    report.Add("ElectricalElements", "MaterialLuminiscence", mMaterialLuminiscenceBuffer);
+    report.Add("ElectricalElements", "MaterialLightColor", mMaterialLightColorBuffer);
+    report.Add("ElectricalElements", "MaterialLightSpread", mMaterialLightSpreadBuffer);
+    report.Add("ElectricalElements", "ConnectedElectricalElements", mConnectedElectricalElementsBuffer);
+    report.Add("ElectricalElements", "ConductingConnectedElectricalElements", mConductingConnectedElectricalElementsBuffer);
+    report.Add("ElectricalElements", "ElementState", mElementStateBuffer);
+    report.Add("ElectricalElements", "EngineGroupStates", mEngineGroupStates);
+    report.Add("ElectricalElements", "AvailableLight", mAvailableLightBuffer);
+    report.Add("ElectricalElements", "CurrentConnectivityVisitSequenceNumber", mCurrentConnectivityVisitSequenceNumberBuffer);
+    report.Add("ElectricalElements", "InstanceInfos", mInstanceInfos);
+    report.Add("ElectricalElements", "LampRawDistanceCoefficient", mLampRawDistanceCoefficientBuffer);
+    report.Add("ElectricalElements", "LampLightSpreadMaxDistance", mLampLightSpreadMaxDistanceBuffer);
+    report.Add("ElectricalElements", "LampPositionWork", mLampPositionWorkBuffer);
+    report.Add("ElectricalElements", "LampPlaneIdWork", mLampPlaneIdWorkBuffer);
+    report.Add("ElectricalElements", "LampDistanceCoefficientWork", mLampDistanceCoefficientWorkBuffer);
+    report.Add("ElectricalElements", "AutomaticConductivityTogglingElements", mAutomaticConductivityTogglingElements);
+    report.Add("ElectricalElements", "Sources", mSources);
+    report.Add("ElectricalElements", "Sinks", mSinks);
+    report.Add("ElectricalElements", "Lamps", mLamps);
+    report.Add("ElectricalElements", "EngineControllers", mEngineControllers);
+    report.Add("ElectricalElements", "Engines", mEngines);
+    report.Add("ElectricalElements", "JetEnginesSortedByPlaneId", mJetEnginesSortedByPlaneId);
+    report.Add("ElectricalElements", "PoweredSources", mPoweredSourcesBuffer);
+    report.Add("ElectricalElements", "PowerFloodPoweredSources", mPowerFloodPoweredSources);
+    report.Add("ElectricalElements", "PowerFloodFloodingSources", mPowerFloodFloodingSources);
+}
+
 void ElectricalElements::SetSwitchState(
     GlobalElectricalElementId electricalElementId,
     ElectricalState switchState,
@@ -824,6 +860,7 @@ void ElectricalElements::Destroy(
 
     // Remember that connectivity structure has changed during this step
     mHasConnectivityStructureChangedInCurrentStep = true;
+    mHasConductingGraphChangedSincePowerFlood = true;
 
     // Remember there's been a power failure in this step;
     // note we also set it in case a *lamp* is broken, not only when a generator
@@ -968,6 +1005,7 @@ void ElectricalElements::Restore(ElementIndex electricalElementIndex)
 
     // Remember that connectivity structure has changed during this step
     mHasConnectivityStructureChangedInCurrentStep = true;
+    mHasConductingGraphChangedSincePowerFlood = true;
 }
 
 void ElectricalElements::OnPhysicalStructureChanged(Points const & points)
@@ -1110,8 +1148,9 @@ void ElectricalElements::Update(
     //
     // 3. Update sources and connectivity
     //
-    // We do this regardless of dirty elements, as elements might have changed their state autonomously
-    // (e.g. generators might have become wet, switches might have been toggled, etc.)
+    // We check sources regardless of dirty elements, as they might have changed their state autonomously
+    // (e.g. generators might have become wet); we flood again only if powered sources or conductivity
+    // have changed
     //
 
     UpdateSourcesAndPropagation(
@@ -1129,7 +1168,7 @@ void ElectricalElements::Update(
     UpdateSinks(
         currentWallClockTime,
         currentSimulationTime,
-        newConnectivityVisitSequenceNumber,
+        mPowerFloodVisitSequenceNumber, // Might be from an earlier step, if there was no need to flood again
         points,
         effectiveAirDensity,
         effectiveWaterDensity,
@@ -1253,6 +1292,11 @@ void ElectricalElements::InternalChangeConductivity(
         }
     }
 
+    if (mConductivityBuffer[elementIndex].ConductsElectricity != value)
+    {
+        mHasConductingGraphChangedSincePowerFlood = true;
+    }
+
     // Change current value
     mConductivityBuffer[elementIndex].ConductsElectricity = value;
 }
@@ -1622,57 +1666,95 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                 }
             }
 
-            if (preconditionsSatisfied
-                // Make sure we haven't visited it already
-                && newConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex])
+            if (preconditionsSatisfied)
             {
-                //
-                // Flood graph
-                //
+                mPoweredSourcesBuffer.push_back(sourceElementIndex);
+            }
+        }
+    }
 
-                // Mark starting point as visited
-                mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex] = newConnectivityVisitSequenceNumber;
+    if (!mHasConductingGraphChangedSincePowerFlood
+        && mPoweredSourcesBuffer == mPowerFloodPoweredSources)
+    {
+        //
+        // Nothing changed since the last flood, hence the elements it reached are still the ones
+        // connected to power; we just generate heat at the sources that flooded
+        //
 
-                // Add source to queue
-                assert(electricalElementsToVisit.empty());
-                electricalElementsToVisit.push(sourceElementIndex);
+        for (auto const sourceElementIndex : mPowerFloodFloodingSources)
+        {
+            points.AddHeat(GetPointIndex(sourceElementIndex),
+                mMaterialHeatGeneratedBuffer[sourceElementIndex]
+                * simulationParameters.ElectricalElementHeatProducedAdjustment
+                * SimulationParameters::SimulationStepTimeDuration<float>);
+        }
 
-                // Visit all electrical elements electrically reachable from this source
-                while (!electricalElementsToVisit.empty())
-                {
-                    auto const e = electricalElementsToVisit.front();
-                    electricalElementsToVisit.pop();
+        mPoweredSourcesBuffer.clear();
 
-                    // Already marked as visited
-                    assert(newConnectivityVisitSequenceNumber == mCurrentConnectivityVisitSequenceNumberBuffer[e]);
+        return;
+    }
 
-                    for (auto const cce : mConductingConnectedElectricalElementsBuffer[e])
-                    {
-                        assert(!IsDeleted(cce));
+    mPowerFloodFloodingSources.clear();
 
-                        // Make sure not visited already
-                        if (newConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumberBuffer[cce])
-                        {
-                            // Mark it as visited
-                            mCurrentConnectivityVisitSequenceNumberBuffer[cce] = newConnectivityVisitSequenceNumber;
+    for (auto const sourceElementIndex : mPoweredSourcesBuffer)
+    {
+        // Make sure we haven't visited it already
+        if (newConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex])
+        {
+            //
+            // Flood graph
+            //
 
-                            // Add to queue
-                            electricalElementsToVisit.push(cce);
-                        }
+            // Mark starting point as visited
+            mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex] = newConnectivityVisitSequenceNumber;
+
+            // Add source to queue
+            assert(electricalElementsToVisit.empty());
+            electricalElementsToVisit.push(sourceElementIndex);
+
+            // Visit all electrical elements electrically reachable from this source
+            while (!electricalElementsToVisit.empty())
+            {
+                auto const e = electricalElementsToVisit.front();
+                electricalElementsToVisit.pop();
+
+                // Already marked as visited
+                assert(newConnectivityVisitSequenceNumber == mCurrentConnectivityVisitSequenceNumberBuffer[e]);
+
+                for (auto const cce : mConductingConnectedElectricalElementsBuffer[e])
+                {
+                    assert(!IsDeleted(cce));
+
+                    // Make sure not visited already
+                    if (newConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumberBuffer[cce])
+                    {
+                        // Mark it as visited
+                        mCurrentConnectivityVisitSequenceNumberBuffer[cce] = newConnectivityVisitSequenceNumber;
+
+                        // Add to queue
+                        electricalElementsToVisit.push(cce);
                     }
                 }
+            }
 
-                //
-                // Generate heat
-                //
+            //
+            // Generate heat
+            //
 
-                points.AddHeat(sourcePointIndex,
-                    mMaterialHeatGeneratedBuffer[sourceElementIndex]
-                    * simulationParameters.ElectricalElementHeatProducedAdjustment
-                    * SimulationParameters::SimulationStepTimeDuration<float>);
-            }
+            points.AddHeat(GetPointIndex(sourceElementIndex),
+                mMaterialHeatGeneratedBuffer[sourceElementIndex]
+                * simulationParameters.ElectricalElementHeatProducedAdjustment
+                * SimulationParameters::SimulationStepTimeDuration<float>);
+
+            mPowerFloodFloodingSources.push_back(sourceElementIndex);
         }
     }
+
+    // Remember this flood
+    std::swap(mPowerFloodPoweredSources, mPoweredSourcesBuffer);
+    mPoweredSourcesBuffer.clear();
+    mPowerFloodVisitSequenceNumber = newConnectivityVisitSequenceNumber;
+    mHasConductingGraphChangedSincePowerFlood = false;
 }
 
 void ElectricalElements::UpdateSinks(
@@ -2261,7 +2343,7 @@ void ElectricalElements::UpdateSinks(
                 }
 
                 // Apply force to point
-                points.GetLeakingComposite(pointIndex).LeakingSources.WaterPumpForce = waterPumpForce;
+                points.SetWaterPumpForce(pointIndex, waterPumpForce);
 
                 // Eventually publish force change notification
                 if (waterPumpState.CurrentNormalizedForce != waterPumpState.LastPublishedNormalizedForce)
@@ -2388,6 +2470,26 @@ void ElectricalElements::UpdateSinks(
                 engineState.SuperElectrificationSimulationTimestampEnd.reset();
             }
 
+            //
+            // Skip idle engines - i.e. engines whose group is at rest and which have wound down
+            // completely - as they'd apply no thrust, make no heat nor wake, and publish nothing;
+            // they wake up as soon as a controller of their group moves or their group changes
+            //
+
+            EngineGroupState const & engineGroupState = mEngineGroupStates[engineState.EngineGroup];
+            if (engineGroupState.GroupRpm == 0.0f
+                && engineGroupState.GroupThrustMagnitude == 0.0f
+                && engineState.CurrentAbsRpm == 0.0f
+                && engineState.CurrentThrustMagnitude == 0.0f
+                && engineState.CurrentJetEngineFlameVector == vec2f::zero()
+                && engineState.LastPublishedAbsRpm == 0.0f
+                && engineState.LastPublishedThrustMagnitude == 0.0f
+                && (engineState.LastHighlightedRpm == 0.0f || !simulationParameters.DoShowElectricalNotifications)
+                && !mConductivityBuffer[engineSinkElementIndex].ConductsElectricity)
+            {
+                continue;
+            }
+
             //
             // Calculate thrust direction based off reference point - as long as this engine
             // is connected (i.e. it does have a reference point)
@@ -2444,7 +2546,7 @@ void ElectricalElements::UpdateSinks(
             }
 
             // Update current RPM to match group target (via responsiveness)
-            float const targetRpm = mEngineGroupStates[engineState.EngineGroup].GroupRpm * powerMultiplier;
+            float const targetRpm = engineGroupState.GroupRpm * powerMultiplier;
             {
                 float const targetAbsRpm = std::abs(targetRpm);
 
@@ -2460,7 +2562,7 @@ void ElectricalElements::UpdateSinks(
 
             // Update current thrust magnitude to match group target (via responsiveness)
             {
-                float const targetThrustMagnitude = mEngineGroupStates[engineState.EngineGroup].GroupThrustMagnitude * powerMultiplier;
+                float const targetThrustMagnitude = engineGroupState.GroupThrustMagnitude * powerMultiplier;
 
                 engineState.CurrentThrustMagnitude =
                     engineState.CurrentThrustMagnitude
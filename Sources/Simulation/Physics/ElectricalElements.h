@@ -12,6 +12,7 @@
 #include <Core/ElementContainer.h>
 #include <Core/FixedSizeVector.h>
 #include <Core/GameWallClock.h>
+#include <Core/MemoryReport.h>
 
 #include <cassert>
 #include <chrono>
@@ -514,6 +515,11 @@ public:
         , mCurrentLightSpreadAdjustment(simulationParameters.LightSpreadAdjustment)
         , mCurrentLuminiscenceAdjustment(simulationParameters.LuminiscenceAdjustment)
         , mHasConnectivityStructureChangedInCurrentStep(true)
+        , mHasConductingGraphChangedSincePowerFlood(true)
+        , mPoweredSourcesBuffer()
+        , mPowerFloodPoweredSources()
+        , mPowerFloodFloodingSources()
+        , mPowerFloodVisitSequenceNumber()
         , mPowerFailureReasonInCurrentStep()
     {
         mInstanceInfos.reserve(mElementCount);
@@ -563,6 +569,11 @@ public:
 
     void Query(ElementIndex electricalElementIndex) const;
 
+    /*
+     * Adds the memory occupied by the electrical elements to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
     void SetSwitchState(
         GlobalElectricalElementId electricalElementId,
         ElectricalState switchState,
@@ -681,6 +692,7 @@ public:
 
         // Remember that connectivity structure has changed during this step
         mHasConnectivityStructureChangedInCurrentStep = true;
+        mHasConductingGraphChangedSincePowerFlood = true;
     }
 
     inline void RemoveConnectedElectricalElement(
@@ -702,6 +714,7 @@ public:
 
         // Remember that connectivity structure has changed during this step
         mHasConnectivityStructureChangedInCurrentStep = true;
+        mHasConductingGraphChangedSincePowerFlood = true;
 
         if (hasBeenSevered)
         {
@@ -990,6 +1003,15 @@ private:
     // to happen at these changes
     bool mHasConnectivityStructureChangedInCurrentStep;
 
+    // The power flood from the sources is only re-run when the conducting graph has changed
+    // or the set of powered sources has changed; otherwise, the elements reached by the last
+    // flood are still the powered ones
+    bool mHasConductingGraphChangedSincePowerFlood;
+    std::vector<ElementIndex> mPoweredSourcesBuffer; // Sources satisfying their preconditions in the current step
+    std::vector<ElementIndex> mPowerFloodPoweredSources; // Sources satisfying their preconditions at the last flood
+    std::vector<ElementIndex> mPowerFloodFloodingSources; // Sources that were not reached by earlier ones at the last flood
+    SequenceNumber mPowerFloodVisitSequenceNumber; // Visit sequence number of the last flood
+
     // Flag indicating the cause of a power failure during the current
     // simulation step; cleared at the end of sinks' update.
     // Set only when there's been a failure; not set if power disappears
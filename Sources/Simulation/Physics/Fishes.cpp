@@ -33,6 +33,10 @@ Fishes::Fishes(
     , mFishShoals()
     , mFishes()
     , mInteractions()
+    , mShoalNeighborGrid()
+    , mShoalNeighborGridEntries()
+    , mShipAABBGrid()
+    , mShipAABBGridEntries()
     , mCurrentFishSizeMultiplier(0.0f)
     , mCurrentFishSpeedAdjustment(0.0f)
     , mCurrentDoFishShoaling(false)
@@ -466,6 +470,22 @@ void Fishes::UpdateDynamics(
     float const outOfWaterVelocityAmplification = (1.0f + std::max(5.0f - mCurrentFishSpeedAdjustment, 0.0f)); // 5 at adj==1
 
     ElementCount const fishCount = static_cast<ElementCount>(mFishes.size());
+
+    // Build broadphase of ship AABBs, so that each fish only checks the AABBs it's close to
+    mShipAABBGridEntries.clear();
+    for (size_t a = 0; a < aabbSet.GetItems().size(); ++a)
+    {
+        auto const & aabb = aabbSet.GetItems()[a];
+        mShipAABBGridEntries.emplace_back(
+            static_cast<ElementIndex>(a),
+            Geometry::AABB(
+                aabb.BottomLeft.x - AABBMargin,
+                aabb.TopRight.x + AABBMargin,
+                aabb.TopRight.y + AABBMargin,
+                aabb.BottomLeft.y - AABBMargin));
+    }
+
+    mShipAABBGrid.Build(mShipAABBGridEntries, 1.0f);
     for (ElementIndex f = 0; f < fishCount; ++f)
     {
         Fish & fish = mFishes[f];
@@ -913,54 +933,61 @@ void Fishes::UpdateDynamics(
         //if (fish.PanicCharge <= 0.3f) // Only if we're not in panic
         if (fish.PanicCharge <= 0.1f) // Only if we're not in panic
         {
-            for (auto const & aabb : aabbSet.GetItems())
-            {
-                float const lMargin = fishHeadPosition.x - (aabb.BottomLeft.x - AABBMargin);
-                float const rMargin = (aabb.TopRight.x + AABBMargin) - fishHeadPosition.x;
-                float const tMargin = (aabb.TopRight.y + AABBMargin) - fishHeadPosition.y;
-                float const bMargin = fishHeadPosition.y - (aabb.BottomLeft.y - AABBMargin);
-
-                if (lMargin >= 0.0f && rMargin >= 0.0f && tMargin >= 0.0f && bMargin >= 0.0f)
+            mShipAABBGrid.VisitCandidates(
+                fishHeadPosition,
+                [&](ElementIndex a)
                 {
-                    // Fish head is in AABB (plus margin)...
-                    // ...find to which side of the AABB it's closest
+                    auto const & aabb = aabbSet.GetItems()[a];
 
-                    vec2f outwardNormal;
-                    if (std::min(lMargin, rMargin) < std::min(bMargin, tMargin))
-                    {
-                        // Vertical axes
-                        outwardNormal = vec2f(
-                            lMargin < rMargin ? -1.0f : 1.0f,
-                            0.0f);
-                    }
-                    else
+                    float const lMargin = fishHeadPosition.x - (aabb.BottomLeft.x - AABBMargin);
+                    float const rMargin = (aabb.TopRight.x + AABBMargin) - fishHeadPosition.x;
+                    float const tMargin = (aabb.TopRight.y + AABBMargin) - fishHeadPosition.y;
+                    float const bMargin = fishHeadPosition.y - (aabb.BottomLeft.y - AABBMargin);
+
+                    if (lMargin >= 0.0f && rMargin >= 0.0f && tMargin >= 0.0f && bMargin >= 0.0f)
                     {
-                        // Horizontal axes
-                        outwardNormal = vec2f(
-                            0.0f,
-                            bMargin < tMargin ? -1.0f : 1.0f);
-                    }
+                        // Fish head is in AABB (plus margin)...
+                        // ...find to which side of the AABB it's closest
 
-                    // Rotate target velocity towards normal
-                    float const targetVelocityMagnitude = fish.TargetVelocity.length();
-                    fish.TargetVelocity =
-                        (fish.TargetVelocity.normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
-                        * targetVelocityMagnitude;
+                        vec2f outwardNormal;
+                        if (std::min(lMargin, rMargin) < std::min(bMargin, tMargin))
+                        {
+                            // Vertical axes
+                            outwardNormal = vec2f(
+                                lMargin < rMargin ? -1.0f : 1.0f,
+                                0.0f);
+                        }
+                        else
+                        {
+                            // Horizontal axes
+                            outwardNormal = vec2f(
+                                0.0f,
+                                bMargin < tMargin ? -1.0f : 1.0f);
+                        }
 
-                    // Converge direction change at a fast rate
-                    fish.CurrentDirectionSmoothingConvergenceRate = std::max(
-                        0.15f,
-                        fish.CurrentDirectionSmoothingConvergenceRate);
+                        // Rotate target velocity towards normal
+                        float const targetVelocityMagnitude = fish.TargetVelocity.length();
+                        fish.TargetVelocity =
+                            (fish.TargetVelocity.normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
+                            * targetVelocityMagnitude;
 
-                    // Panic a bit
-                    fish.PanicCharge = std::max(
-                        0.5f,
-                        fish.PanicCharge);
+                        // Converge direction change at a fast rate
+                        fish.CurrentDirectionSmoothingConvergenceRate = std::max(
+                            0.15f,
+                            fish.CurrentDirectionSmoothingConvergenceRate);
 
-                    // Stop steering, if we're steering
-                    fish.CruiseSteeringState.reset();
-                }
-            }
+                        // Panic a bit
+                        fish.PanicCharge = std::max(
+                            0.5f,
+                            fish.PanicCharge);
+
+                        // Stop steering, if we're steering
+                        fish.CruiseSteeringState.reset();
+                    }
+
+                    // Continue visiting
+                    return false;
+                });
         }
     }
 }
@@ -979,8 +1006,39 @@ void Fishes::UpdateShoaling(
             * simulationParameters.FishShoalRadiusAdjustment
             * fishShoal.MaxWorldDimension; // Inclusive of FishSizeMultiplier
 
-        // Visit all fishes in this shoal
         ElementIndex const endFishIndex = fishShoal.StartFishIndex + fishShoal.CurrentMemberCount;
+
+        // In large shoals, find neighbors by means of a grid of the fishes' neighborhoods, which
+        // yields - in increasing index order - the fishes whose neighborhood contains a position
+        bool const doUseNeighborGrid = (fishShoal.CurrentMemberCount >= MinShoalSizeForNeighborGrid);
+        if (doUseNeighborGrid)
+        {
+            // The largest fish shoal radius in this shoal, plus some tolerance
+            float maxFishShoalRadius = shoalRadius;
+            for (ElementIndex f = fishShoal.StartFishIndex; f < endFishIndex; ++f)
+            {
+                maxFishShoalRadius = std::max(maxFishShoalRadius, shoalRadius + mFishes[f].PersonalitySeed);
+            }
+
+            maxFishShoalRadius = maxFishShoalRadius * 1.01f + 0.01f;
+
+            mShoalNeighborGridEntries.clear();
+            for (ElementIndex f = fishShoal.StartFishIndex; f < endFishIndex; ++f)
+            {
+                vec2f const & position = mFishes[f].CurrentPosition;
+                mShoalNeighborGridEntries.emplace_back(
+                    f,
+                    Geometry::AABB(
+                        position.x - maxFishShoalRadius,
+                        position.x + maxFishShoalRadius,
+                        position.y + maxFishShoalRadius,
+                        position.y - maxFishShoalRadius));
+            }
+
+            mShoalNeighborGrid.Build(mShoalNeighborGridEntries, 8.0f);
+        }
+
+        // Visit all fishes in this shoal
         for (ElementIndex f = fishShoal.StartFishIndex; f < endFishIndex; ++f)
         {
             Fish & fish = mFishes[f];
@@ -1007,7 +1065,8 @@ void Fishes::UpdateShoaling(
                     ElementIndex furthestFishIndex = NoneElementIndex; // Furthest neighbour among those that are further from fish than spacing
                     float furthestFishDistance = std::numeric_limits<float>::lowest();
 
-                    for (ElementIndex n = fishShoal.StartFishIndex; n < endFishIndex; ++n)
+                    // Returns true when no other neighbors need to be visited
+                    auto const visitNeighbor = [&](ElementIndex n) -> bool
                     {
                         assert(mFishes[n].ShoalId == fish.ShoalId);
                         if (n != f) // Not same fish
@@ -1066,10 +1125,25 @@ void Fishes::UpdateShoaling(
                                     fish.LastSteeringSimulationTime = currentSimulationTime;
 
                                     // No need to look at other neighbors
-                                    break;
+                                    return true;
                                 }
                             }
                         }
+
+                        return false;
+                    };
+
+                    if (doUseNeighborGrid)
+                    {
+                        mShoalNeighborGrid.VisitCandidates(fish.CurrentPosition, visitNeighbor);
+                    }
+                    else
+                    {
+                        for (ElementIndex n = fishShoal.StartFishIndex; n < endFishIndex; ++n)
+                        {
+                            if (visitNeighbor(n))
+                                break;
+                        }
                     }
 
                     // If we've decided we're gonna u-turn, then stop here
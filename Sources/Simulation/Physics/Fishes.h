@@ -12,6 +12,7 @@
 #include <Render/GameTextureDatabases.h>
 #include <Render/RenderContext.h>
 
+#include <Core/AABBGrid.h>
 #include <Core/AABBSet.h>
 #include <Core/GameTypes.h>
 #include <Core/GameWallClock.h>
@@ -293,6 +294,15 @@ private:
     // Delayed interactions
     std::vector<Interaction> mInteractions;
 
+    // Neighbor search in large shoals; rebuilt for each shoal at each update
+    static ElementCount constexpr MinShoalSizeForNeighborGrid = 32;
+    Geometry::AABBGrid mShoalNeighborGrid;
+    std::vector<Geometry::AABBGrid::Entry> mShoalNeighborGridEntries;
+
+    // Broadphase of fish against ship AABBs - plus margin; rebuilt at each update
+    Geometry::AABBGrid mShipAABBGrid;
+    std::vector<Geometry::AABBGrid::Entry> mShipAABBGridEntries;
+
     // Parameters that the calculated values are current with
     float mCurrentFishSizeMultiplier;
     float mCurrentFishSpeedAdjustment;
@@ -590,6 +590,16 @@ void Frontiers::HandleTriangleRestore(
     mIsDirtyForRendering = true;
 }
 
+void Frontiers::ReportMemory(MemoryReport & report) const
+{
+    report.Add("Frontiers", "Edges", mEdges);
+    report.Add("Frontiers", "FrontierEdges", mFrontierEdges);
+    report.Add("Frontiers", "Frontiers", mFrontiers);
+    report.Add("Frontiers", "FrontierIds", mFrontierIds);
+    report.Add("Frontiers", "FrontierIdsCompactionVisitFlags", mFrontierIdsCompactionVisitFlags);
+    report.Add("Frontiers", "PointColors", mPointColors);
+}
+
 void Frontiers::Upload(
     ShipId shipId,
     RenderContext & renderContext)
@@ -665,14 +675,20 @@ FrontierId Frontiers::CreateNewFrontier(
 {
     // Check if we may find an unused slot
     FrontierId newFrontierId;
-    for (newFrontierId = 0; newFrontierId < mFrontiers.size() && mFrontiers[newFrontierId].has_value(); ++newFrontierId);
-
-    if (newFrontierId == mFrontiers.size())
+    if (!mFreeFrontierIds.empty())
+    {
+        newFrontierId = mFreeFrontierIds.top();
+        mFreeFrontierIds.pop();
+    }
+    else
     {
         // Create new slot
+        newFrontierId = static_cast<FrontierId>(mFrontiers.size());
         mFrontiers.emplace_back();
     }
 
+    assert(!mFrontiers[newFrontierId].has_value());
+
     assert(newFrontierId < mFrontiers.size());
 
     mFrontiers[newFrontierId].emplace(
@@ -694,16 +710,70 @@ void Frontiers::DestroyFrontier(
 
     mFrontiers[frontierId].reset();
 
-    // Remove from frontier indices
+    mFreeFrontierIds.push(frontierId);
+
+    // Remove from frontier indices - later
+    mAreFrontierIdsDirty = true;
+}
+
+void Frontiers::CompactFrontierIds() const
+{
+    //
+    // Remove the IDs of destroyed frontiers, keeping the order of the rest;
+    // an ID that has been reused after its frontier was destroyed appears twice,
+    // and it's its last occurrence - the one of the new frontier - that we keep
+    //
+
+    mFrontierIdsCompactionVisitFlags.assign(mFrontiers.size(), false);
+
+    size_t w = mFrontierIds.size();
+    for (size_t r = mFrontierIds.size(); r-- > 0; )
+    {
+        FrontierId const frontierId = mFrontierIds[r];
+        if (mFrontiers[frontierId].has_value()
+            && !mFrontierIdsCompactionVisitFlags[frontierId])
+        {
+            mFrontierIdsCompactionVisitFlags[frontierId] = true;
+            mFrontierIds[--w] = frontierId;
+        }
+    }
+
+    mFrontierIds.erase(mFrontierIds.begin(), mFrontierIds.begin() + w);
+
+    mAreFrontierIdsDirty = false;
+}
+
+bool Frontiers::IsFrontierRegionShorterThanRest(
+    ElementIndex const edgeIn,
+    ElementIndex const edgeOut) const
+{
+    //
+    // Compares the region of a frontier that goes from after edgeIn to before edgeOut,
+    // with the rest of the frontier (from edgeOut to edgeIn), walking both at the same
+    // time and thus only as far as the shortest of the two
+    //
+
+    assert(mFrontierEdges[edgeIn].NextEdgeIndex != edgeOut);
+
+    ElementIndex const regionEndEdgeIndex = mFrontierEdges[edgeOut].PrevEdgeIndex;
 
-    auto const indexIt = std::find(
-        mFrontierIds.cbegin(),
-        mFrontierIds.cend(),
-        frontierId);
+    ElementIndex regionEdgeIndex = mFrontierEdges[edgeIn].NextEdgeIndex;
+    ElementIndex restEdgeIndex = edgeOut;
+    while (true)
+    {
+        if (regionEdgeIndex == regionEndEdgeIndex)
+        {
+            return true;
+        }
 
-    assert(indexIt != mFrontierIds.cend());
+        if (restEdgeIndex == edgeIn)
+        {
+            return false;
+        }
 
-    mFrontierIds.erase(indexIt);
+        regionEdgeIndex = mFrontierEdges[regionEdgeIndex].NextEdgeIndex;
+        restEdgeIndex = mFrontierEdges[restEdgeIndex].NextEdgeIndex;
+    }
 }
 
 FrontierId Frontiers::SplitIntoNewFrontier(
@@ -939,18 +1009,30 @@ inline bool Frontiers::ProcessTriangleCuspDestroy(
                 // After coming into the cusp from edge1, the external frontier travels around
                 // a region before returning back to the cusp and then away through edge2...
                 //
-                // ...quite arbitrarily, we decide that that region's frontier then becomes a
-                // new external frontier (we could have chosen instead that that region's frontier
-                // stays and the other portion becomes the new frontier)
+                // ...it is arbitrary which of the two portions becomes a new external
+                // frontier, so for performance we let the shorter one become it
                 //
 
-                SplitIntoNewFrontier(
-                    mFrontierEdges[edgeIn].NextEdgeIndex,
-                    mFrontierEdges[edgeOut].PrevEdgeIndex,
-                    frontierInId,
-                    FrontierType::External,
-                    edgeIn,
-                    edgeOut);
+                if (IsFrontierRegionShorterThanRest(edgeIn, edgeOut))
+                {
+                    SplitIntoNewFrontier(
+                        mFrontierEdges[edgeIn].NextEdgeIndex,
+                        mFrontierEdges[edgeOut].PrevEdgeIndex,
+                        frontierInId,
+                        FrontierType::External,
+                        edgeIn,
+                        edgeOut);
+                }
+                else
+                {
+                    SplitIntoNewFrontier(
+                        edgeOut,
+                        edgeIn,
+                        frontierInId,
+                        FrontierType::External,
+                        mFrontierEdges[edgeOut].PrevEdgeIndex,
+                        mFrontierEdges[edgeIn].NextEdgeIndex);
+                }
             }
         }
         else
@@ -963,18 +1045,36 @@ inline bool Frontiers::ProcessTriangleCuspDestroy(
 
             //
             // The external and internal frontiers are going to get merged into one,
-            // single *external* frontier
+            // single *external* frontier; for performance, the longer takes over the
+            // shorter
             //
 
-            // Replace the internal frontier (frontierOutId, connecting edgeOut to beforeEdgeOut)
-            // with the external frontier (frontierInId)
-            ReplaceAndCutFrontier(
-                edgeOut, // Start
-                mFrontierEdges[edgeOut].PrevEdgeIndex, // End
-                frontierOutId, // Old
-                frontierInId, // New
-                edgeIn,
-                edgeOut);
+            if (mFrontiers[frontierOutId]->Size <= mFrontiers[frontierInId]->Size)
+            {
+                // Replace the internal frontier (frontierOutId, connecting edgeOut to beforeEdgeOut)
+                // with the external frontier (frontierInId)
+                ReplaceAndCutFrontier(
+                    edgeOut, // Start
+                    mFrontierEdges[edgeOut].PrevEdgeIndex, // End
+                    frontierOutId, // Old
+                    frontierInId, // New
+                    edgeIn,
+                    edgeOut);
+            }
+            else
+            {
+                // Replace the external frontier (frontierInId, connecting afterEdgeIn to edgeIn)
+                // with the internal frontier (frontierOutId), which becomes external
+                ReplaceAndCutFrontier(
+                    mFrontierEdges[edgeIn].NextEdgeIndex, // Start
+                    edgeIn, // End
+                    frontierInId, // Old
+                    frontierOutId, // New
+                    edgeIn,
+                    edgeOut);
+
+                mFrontiers[frontierOutId]->Type = FrontierType::External;
+            }
         }
     }
     else if (mFrontiers[frontierOutId]->Type == FrontierType::External)
@@ -987,18 +1087,36 @@ inline bool Frontiers::ProcessTriangleCuspDestroy(
 
         //
         // The internal and external frontiers are going to get merged into one,
-        // single *external* frontier
+        // single *external* frontier; for performance, the longer takes over the
+        // shorter
         //
 
-        // Replace the internal frontier (frontierInId, connecting afterEdgeIn to edgeIn)
-        // with the external frontier (frontierOutId)
-        ReplaceAndCutFrontier(
-            mFrontierEdges[edgeIn].NextEdgeIndex, // Start
-            edgeIn, // End
-            frontierInId, // Old
-            frontierOutId, // New
-            edgeIn,
-            edgeOut);
+        if (mFrontiers[frontierInId]->Size <= mFrontiers[frontierOutId]->Size)
+        {
+            // Replace the internal frontier (frontierInId, connecting afterEdgeIn to edgeIn)
+            // with the external frontier (frontierOutId)
+            ReplaceAndCutFrontier(
+                mFrontierEdges[edgeIn].NextEdgeIndex, // Start
+                edgeIn, // End
+                frontierInId, // Old
+                frontierOutId, // New
+                edgeIn,
+                edgeOut);
+        }
+        else
+        {
+            // Replace the external frontier (frontierOutId, connecting edgeOut to beforeEdgeOut)
+            // with the internal frontier (frontierInId), which becomes external
+            ReplaceAndCutFrontier(
+                edgeOut, // Start
+                mFrontierEdges[edgeOut].PrevEdgeIndex, // End
+                frontierOutId, // Old
+                frontierInId, // New
+                edgeIn,
+                edgeOut);
+
+            mFrontiers[frontierInId]->Type = FrontierType::External;
+        }
     }
     else
     {
@@ -1045,16 +1163,20 @@ inline bool Frontiers::ProcessTriangleCuspDestroy(
                 // a clockwise frontier.
                 //
 
-                // Start by splitting here, arbitrarily making the other one an internal frontier for the moment
-                auto const newRegionStartEdgeIndex = mFrontierEdges[edgeIn].NextEdgeIndex;
-                auto const newRegionEndEdgeIndex = mFrontierEdges[edgeOut].PrevEdgeIndex;
+                // Start by splitting the shorter portion off, arbitrarily making it an internal
+                // frontier for the moment
+                bool const isRegionShorter = IsFrontierRegionShorterThanRest(edgeIn, edgeOut);
+                auto const newRegionStartEdgeIndex = isRegionShorter ? mFrontierEdges[edgeIn].NextEdgeIndex : edgeOut;
+                auto const newRegionEndEdgeIndex = isRegionShorter ? mFrontierEdges[edgeOut].PrevEdgeIndex : edgeIn;
+                auto const cutEdgeIn = isRegionShorter ? edgeIn : mFrontierEdges[edgeOut].PrevEdgeIndex;
+                auto const cutEdgeOut = isRegionShorter ? edgeOut : mFrontierEdges[edgeIn].NextEdgeIndex;
                 FrontierId const newFrontierId = SplitIntoNewFrontier(
                     newRegionStartEdgeIndex,
                     newRegionEndEdgeIndex,
                     frontierInId,
                     FrontierType::Internal,
-                    edgeIn,
-                    edgeOut);
+                    cutEdgeIn,
+                    cutEdgeOut);
 
                 // Now check whether the new region is counter-clockwise
                 if (IsCounterClockwiseFrontier(
@@ -1601,6 +1723,8 @@ void Frontiers::VerifyInvariants(
     Springs const & springs,
     Triangles const & triangles) const
 {
+    EnsureFrontierIdsCompact();
+
     std::set<ElementIndex> edgesWithFrontiers;
 
     //
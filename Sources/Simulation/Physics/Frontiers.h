@@ -11,9 +11,12 @@
 
 #include <Core/AABB.h>
 #include <Core/Buffer.h>
+#include <Core/MemoryReport.h>
 
 #include <array>
+#include <functional>
 #include <optional>
+#include <queue>
 #include <vector>
 
 namespace Physics
@@ -75,7 +78,10 @@ public:
         , mEdges(mEdgeCount, 0, Edge())
         , mFrontierEdges(mEdgeCount, 0, FrontierEdge())
         , mFrontiers()
+        , mFreeFrontierIds()
         , mFrontierIds()
+        , mAreFrontierIdsDirty(false)
+        , mFrontierIdsCompactionVisitFlags()
         , mPointColors(pointCount, 0, ColorWithProgress(vec3f::zero(), 0.0f))
         , mCurrentVisitSequenceNumber()
         , mIsDirtyForRendering(true)
@@ -106,6 +112,11 @@ public:
         Springs const & springs,
         Triangles const & triangles);
 
+    /*
+     * Adds the memory occupied by the frontiers to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
     void Upload(
         ShipId shipId,
         RenderContext & renderContext);
@@ -121,12 +132,16 @@ public:
 
     inline ElementCount GetElementCount() const
     {
+        EnsureFrontierIdsCompact();
+
         assert(mFrontiers.size() >= mFrontierIds.size());
         return static_cast<ElementCount>(mFrontierIds.size());
     }
 
     inline auto const & GetFrontierIds() const noexcept
     {
+        EnsureFrontierIdsCompact();
+
         return mFrontierIds;
     }
 
@@ -200,6 +215,20 @@ private:
     void DestroyFrontier(
         FrontierId frontierId);
 
+    inline void EnsureFrontierIdsCompact() const
+    {
+        if (mAreFrontierIdsDirty)
+        {
+            CompactFrontierIds();
+        }
+    }
+
+    void CompactFrontierIds() const;
+
+    inline bool IsFrontierRegionShorterThanRest(
+        ElementIndex const edgeIn,
+        ElementIndex const edgeOut) const;
+
     inline FrontierId SplitIntoNewFrontier(
         ElementIndex const newFrontierStartEdgeIndex,
         ElementIndex const newFrontierEndEdgeIndex,
@@ -284,9 +313,18 @@ private:
     // Cardinality: any.
     std::vector<std::optional<Frontier>> mFrontiers;
 
+    // The unused slots in the Frontiers vector; new frontiers
+    // take the lowest one
+    std::priority_queue<FrontierId, std::vector<FrontierId>, std::greater<FrontierId>> mFreeFrontierIds;
+
     // The indices in the Frontiers vector, all
-    // contiguous and compact
-    std::vector<FrontierId> mFrontierIds;
+    // contiguous and compact - once compacted.
+    // Destroying frontiers only marks this dirty, as an explosion may destroy
+    // thousands of them in a single step; compaction then happens at the first
+    // access.
+    std::vector<FrontierId> mutable mFrontierIds;
+    bool mutable mAreFrontierIdsDirty;
+    std::vector<bool> mutable mFrontierIdsCompactionVisitFlags;
 
     // Frontier coloring info.
     // Cardinality: points
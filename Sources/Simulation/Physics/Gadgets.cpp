@@ -174,6 +174,12 @@ void Gadgets::OnElectricSpark(
     float currentSimulationTime,
     SimulationParameters const & simulationParameters)
 {
+    // Sparks visit many points, only few of which have gadgets
+    if (!mShipPoints.IsGadgetAttached(pointElementIndex))
+    {
+        return;
+    }
+
     //
     // Gadgets
     //
@@ -30,11 +30,19 @@ Npcs::Npcs(
     , mStateBuffer()
     , mShips()
     , mParticles(static_cast<ElementCount>(mMaxNpcs * SimulationParameters::MaxParticlesPerNpc))
+    , mParticleSpatialGrid(2.0f, 4)
+    , mParticleSpatialGridPositions()
+    , mParticleSpatialGridParticles()
+    , mParticleSpatialGridNpcs()
+    , mIsParticleSpatialGridDirty(true)
     // State
     , mCurrentSimulationSequenceNumber()
     , mCurrentlySelectedNpc()
     , mCurrentlySelectedNpcWallClockTimestamp()
     , mGeneralizedPanicLevel(0.0f)
+    , mPhysicsActiveNpcs()
+    , mNpcForcesTasks()
+    , mNpcForcesTaskOceanSurfaceDisplacements()
     // Stats
     , mFreeRegimeHumanNpcCount(0)
     , mConstrainedRegimeHumanNpcCount(0)
@@ -186,7 +194,9 @@ Main principles:
 void Npcs::Update(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    VisibleWorld const & visibleWorld,
+    ThreadManager & threadManager)
 {
     //
     // Check invariants
@@ -250,9 +260,27 @@ void Npcs::Update(
     // Advance the current simulation sequence
     ++mCurrentSimulationSequenceNumber;
 
-    UpdateNpcPhysics(currentSimulationTime, stormParameters, simulationParameters);
+    // Ships' points do not move while we update, hence triangle
+    // containment queries may use the triangles' grids
+    for (auto & ship : mShips)
+    {
+        if (ship.has_value())
+        {
+            ship->HomeShip.GetTriangles().EnableContainmentGrid();
+        }
+    }
+
+    UpdateNpcPhysics(currentSimulationTime, stormParameters, simulationParameters, threadManager);
 
-    UpdateNpcBehavior(currentSimulationTime, simulationParameters);
+    UpdateNpcBehavior(currentSimulationTime, simulationParameters, visibleWorld);
+
+    for (auto & ship : mShips)
+    {
+        if (ship.has_value())
+        {
+            ship->HomeShip.GetTriangles().DisableContainmentGrid();
+        }
+    }
 
     //
     // Decays
@@ -343,6 +371,12 @@ void Npcs::Upload(RenderContext & renderContext) const
         {
             auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
 
+            if (!shipRenderContext.IsVisible())
+            {
+                // Culled together with its ship, whose render AABB includes its NPCs
+                continue;
+            }
+
             shipRenderContext.UploadNpcsStart(
                 mShips[shipId]->TotalNpcStats.FurnitureNpcCount			// Furniture: one single quad
                 + mShips[shipId]->TotalNpcStats.HumanNpcCount * (6 + 2)); // Human: max 8 quads (limbs)
@@ -486,6 +520,28 @@ Geometry::AABB Npcs::GetNpcAABB(NpcId npcId) const
     return aabb;
 }
 
+Geometry::AABB Npcs::CalculateShipNpcAABB(ShipId shipId) const
+{
+    size_t const s = static_cast<size_t>(shipId);
+
+    // We know about this ship
+    assert(s < mShips.size());
+    assert(mShips[s].has_value());
+
+    Geometry::AABB aabb;
+    for (NpcId const npcId : mShips[s]->Npcs)
+    {
+        assert(mStateBuffer[npcId].has_value());
+
+        for (auto const & particle : mStateBuffer[npcId]->ParticleMesh.Particles)
+        {
+            aabb.ExtendTo(mParticles.GetPosition(particle.ParticleIndex));
+        }
+    }
+
+    return aabb;
+}
+
 ///////////////////////////////
 
 void Npcs::OnShipAdded(Ship & ship)
@@ -981,6 +1037,8 @@ std::tuple<std::optional<PickedNpc>, NpcCreationFailureReasonType> Npcs::BeginPl
     assert(mShips[shipId].has_value());
     mShips[shipId]->AddNpc(npcId);
 
+    mIsParticleSpatialGridDirty = true;
+
     //
     // Update ship stats
     //
@@ -1200,6 +1258,8 @@ std::tuple<std::optional<PickedNpc>, NpcCreationFailureReasonType> Npcs::BeginPl
     assert(mShips[shipId].has_value());
     mShips[shipId]->AddNpc(npcId);
 
+    mIsParticleSpatialGridDirty = true;
+
     //
     // Update ship stats
     //
@@ -1986,22 +2046,24 @@ bool Npcs::QueryNearestNpcAt(
     NpcId bestNpc = NoneNpcId;
     float bestSquareDistance = std::numeric_limits<float>::max();
 
-    for (auto const & npc : mStateBuffer)
-    {
-        if (npc.has_value()
-            && npc->IsActive())
+    GetParticleSpatialGrid().VisitInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex e)
         {
-            for (auto const & p : npc->ParticleMesh.Particles)
+            NpcId const npcId = mParticleSpatialGridNpcs[e];
+            assert(mStateBuffer[npcId].has_value());
+            if (mStateBuffer[npcId]->IsActive())
             {
-                float squareDistance = (mParticles.GetPosition(p.ParticleIndex) - targetPos).squareLength();
-                if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+                float squareDistance = (mParticles.GetPosition(mParticleSpatialGridParticles[e]) - targetPos).squareLength();
+                if (squareDistance < squareRadius
+                    && (squareDistance < bestSquareDistance || (squareDistance == bestSquareDistance && npcId < bestNpc)))
                 {
-                    bestNpc = npc->Id;
+                    bestNpc = npcId;
                     bestSquareDistance = squareDistance;
                 }
             }
-        }
-    }
+        });
 
     if (NoneElementIndex != bestNpc)
     {
@@ -2042,6 +2104,8 @@ void Npcs::MoveShipBy(
         * simulationParameters.MoveToolInertia
         * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
+    mIsParticleSpatialGridDirty = true;
+
     assert(mShips[shipId].has_value());
     auto const & homeShip = mShips[shipId]->HomeShip;
     for (auto npcId : mShips[shipId]->Npcs)
@@ -2098,6 +2162,8 @@ void Npcs::RotateShipBy(
     vec2f const inertialRotX(cos(inertialAngle), sin(inertialAngle));
     vec2f const inertialRotY(-sin(inertialAngle), cos(inertialAngle));
 
+    mIsParticleSpatialGridDirty = true;
+
     assert(mShips[shipId].has_value());
     auto const & homeShip = mShips[shipId]->HomeShip;
     for (auto npcId : mShips[shipId]->Npcs)
@@ -2853,6 +2919,8 @@ void Npcs::MoveParticleBy(
         particleIndex,
         mParticles.GetPosition(particleIndex) + offset);
 
+    mIsParticleSpatialGridDirty = true;
+
     mParticles.SetVelocity(
         particleIndex,
         vec2f::zero()); // Zero-out velocity
@@ -2958,6 +3026,8 @@ void Npcs::RotateParticleWithShip(
     }
 
     mParticles.SetPosition(npcParticleState.ParticleIndex, newPosition);
+
+    mIsParticleSpatialGridDirty = true;
 }
 
 void Npcs::OnPointMoved(float currentSimulationTime)
@@ -3242,31 +3312,63 @@ void Npcs::VisitNpcsInQuad(
     float const minY = std::min(corner1.y, corner2.y);
     float const maxY = std::max(corner1.y, corner2.y);
 
-    for (auto const & npc : mStateBuffer)
-    {
-        if (npc.has_value())
-        {
-            // We visit the NPC if at least one of its particles is in the quad
+    // We visit the NPC if at least one of its particles is in the quad
 
-            bool isChosen = false;
+    std::vector<NpcId> chosenNpcs;
 
-            for (size_t p = 0; p < npc->ParticleMesh.Particles.size(); ++p)
+    GetParticleSpatialGrid().VisitInRectangle(
+        vec2f(minX, minY),
+        vec2f(maxX, maxY),
+        [&](ElementIndex e)
+        {
+            vec2f const & pos = mParticles.GetPosition(mParticleSpatialGridParticles[e]);
+            if (pos.x >= minX && pos.x <= maxX && pos.y >= minY && pos.y <= maxY)
             {
-                vec2f const & pos = mParticles.GetPosition(npc->ParticleMesh.Particles[p].ParticleIndex);
-                if (pos.x >= minX && pos.x <= maxX && pos.y >= minY && pos.y <= maxY)
-                {
-                    // Found!
-                    isChosen = true;
-                    break;
-                }
+                chosenNpcs.push_back(mParticleSpatialGridNpcs[e]);
             }
+        });
+
+    // Visit each NPC once, in NPC ID order
+    std::sort(chosenNpcs.begin(), chosenNpcs.end());
+    chosenNpcs.erase(std::unique(chosenNpcs.begin(), chosenNpcs.end()), chosenNpcs.end());
+
+    for (NpcId const npcId : chosenNpcs)
+    {
+        assert(mStateBuffer[npcId].has_value());
+        action(npcId);
+    }
+}
+
+SpatialGrid const & Npcs::GetParticleSpatialGrid() const
+{
+    if (mIsParticleSpatialGridDirty)
+    {
+        mParticleSpatialGridPositions.clear();
+        mParticleSpatialGridParticles.clear();
+        mParticleSpatialGridNpcs.clear();
 
-            if (isChosen)
+        for (auto const & npc : mStateBuffer)
+        {
+            if (npc.has_value())
             {
-                action(npc->Id);
+                for (auto const & p : npc->ParticleMesh.Particles)
+                {
+                    mParticleSpatialGridPositions.push_back(mParticles.GetPosition(p.ParticleIndex));
+                    mParticleSpatialGridParticles.push_back(p.ParticleIndex);
+                    mParticleSpatialGridNpcs.push_back(npc->Id);
+                }
             }
         }
+
+        mParticleSpatialGrid.Rebuild(
+            mParticleSpatialGridPositions.data(),
+            0,
+            static_cast<ElementIndex>(mParticleSpatialGridPositions.size()));
+
+        mIsParticleSpatialGridDirty = false;
     }
+
+    return mParticleSpatialGrid;
 }
 
 void Npcs::InternalBeginMoveNpc(
@@ -3335,6 +3437,8 @@ void Npcs::InternalMoveNpcBy(
 
     auto & npc = *mStateBuffer[id];
 
+    mIsParticleSpatialGridDirty = true;
+
     // Calculate absolute velocity for this delta movement - we want it clamped
     vec2f const targetAbsoluteVelocity = (deltaAnchorPosition / SimulationParameters::SimulationStepTimeDuration<float> *mGlobalDampingFactor).clamp_length_upper(SimulationParameters::MaxNpcToolMoveVelocityMagnitude);
 
@@ -3544,6 +3648,8 @@ void Npcs::InternalFreeNpcParticles(StateType const & npc)
     {
         mParticles.Remove(p.ParticleIndex);
     }
+
+    mIsParticleSpatialGridDirty = true;
 }
 
 void Npcs::PublishCount()
@@ -3691,26 +3797,31 @@ std::optional<GlobalElementId> Npcs::FindTopmostWorkableTriangleContaining(vec2f
 
             std::optional<ElementIndex> bestTriangleIndex;
             PlaneId bestPlaneId = std::numeric_limits<PlaneId>::lowest();
-            for (auto const triangleIndex : homeShip.GetTriangles())
-            {
-                if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
+            homeShip.GetTriangles().VisitContainmentCandidates(
+                position,
+                homeShip.GetPoints(),
+                [&](ElementIndex triangleIndex)
                 {
-                    // Arbitrary representative for plane and connected component
-                    auto const pointAIndex = homeShip.GetTriangles().GetPointAIndex(triangleIndex);
+                    if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
+                    {
+                        // Arbitrary representative for plane and connected component
+                        auto const pointAIndex = homeShip.GetTriangles().GetPointAIndex(triangleIndex);
 
-                    vec2f const aPosition = homeShip.GetPoints().GetPosition(pointAIndex);
-                    vec2f const bPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointBIndex(triangleIndex));
-                    vec2f const cPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointCIndex(triangleIndex));
+                        vec2f const aPosition = homeShip.GetPoints().GetPosition(pointAIndex);
+                        vec2f const bPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointBIndex(triangleIndex));
+                        vec2f const cPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointCIndex(triangleIndex));
 
-                    if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition)
-                        && (!bestTriangleIndex || homeShip.GetPoints().GetPlaneId(pointAIndex) > bestPlaneId)
-                        && !IsTriangleFolded(aPosition, bPosition, cPosition))
-                    {
-                        bestTriangleIndex = triangleIndex;
-                        bestPlaneId = homeShip.GetPoints().GetPlaneId(pointAIndex);
+                        if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition)
+                            && (!bestTriangleIndex || homeShip.GetPoints().GetPlaneId(pointAIndex) > bestPlaneId)
+                            && !IsTriangleFolded(aPosition, bPosition, cPosition))
+                        {
+                            bestTriangleIndex = triangleIndex;
+                            bestPlaneId = homeShip.GetPoints().GetPlaneId(pointAIndex);
+                        }
                     }
-                }
-            }
+
+                    return false;
+                });
 
             if (bestTriangleIndex)
             {
@@ -3733,27 +3844,35 @@ ElementIndex Npcs::FindWorkableTriangleContaining(
     Ship const & homeShip,
     std::optional<ConnectedComponentId> constrainedConnectedComponentId)
 {
-    for (auto const triangleIndex : homeShip.GetTriangles())
-    {
-        if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
+    ElementIndex result = NoneElementIndex;
+
+    homeShip.GetTriangles().VisitContainmentCandidates(
+        position,
+        homeShip.GetPoints(),
+        [&](ElementIndex triangleIndex)
         {
-            // Arbitrary representative for plane and connected component
-            auto const pointAIndex = homeShip.GetTriangles().GetPointAIndex(triangleIndex);
+            if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
+            {
+                // Arbitrary representative for plane and connected component
+                auto const pointAIndex = homeShip.GetTriangles().GetPointAIndex(triangleIndex);
 
-            vec2f const aPosition = homeShip.GetPoints().GetPosition(pointAIndex);
-            vec2f const bPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointBIndex(triangleIndex));
-            vec2f const cPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointCIndex(triangleIndex));
+                vec2f const aPosition = homeShip.GetPoints().GetPosition(pointAIndex);
+                vec2f const bPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointBIndex(triangleIndex));
+                vec2f const cPosition = homeShip.GetPoints().GetPosition(homeShip.GetTriangles().GetPointCIndex(triangleIndex));
 
-            if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition)
-                && !IsTriangleFolded(aPosition, bPosition, cPosition)
-                && (!constrainedConnectedComponentId.has_value() || homeShip.GetPoints().GetConnectedComponentId(pointAIndex) == *constrainedConnectedComponentId))
-            {
-                return triangleIndex;
+                if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition)
+                    && !IsTriangleFolded(aPosition, bPosition, cPosition)
+                    && (!constrainedConnectedComponentId.has_value() || homeShip.GetPoints().GetConnectedComponentId(pointAIndex) == *constrainedConnectedComponentId))
+                {
+                    result = triangleIndex;
+                    return true;
+                }
             }
-        }
-    }
 
-    return NoneElementIndex;
+            return false;
+        });
+
+    return result;
 }
 
 void Npcs::TransferNpcToShip(
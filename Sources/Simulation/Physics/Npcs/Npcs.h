@@ -20,8 +20,10 @@
 #include <Core/GameTypes.h>
 #include <Core/GameWallClock.h>
 #include <Core/Log.h>
+#include <Core/SpatialGrid.h>
 #include <Core/StrongTypeDef.h>
 #include <Core/SysSpecifics.h>
+#include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
 #include <algorithm>
@@ -1079,6 +1081,23 @@ private:
 		{}
 	};
 
+	//
+	// Ocean surface displacement, deferred while NPCs are visited in parallel
+	//
+
+	struct OceanSurfaceDisplacement final
+	{
+		float X;
+		float YOffset;
+
+		OceanSurfaceDisplacement(
+			float x,
+			float yOffset)
+			: X(x)
+			, YOffset(yOffset)
+		{}
+	};
+
 	//
 	// (Human) dance moves
 	//
@@ -1104,7 +1123,9 @@ public:
 	void Update(
 		float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
-		SimulationParameters const & simulationParameters);
+		SimulationParameters const & simulationParameters,
+		VisibleWorld const & visibleWorld,
+		ThreadManager & threadManager);
 
 	void UpdateEnd();
 
@@ -1122,6 +1143,9 @@ public:
 
 	Geometry::AABB GetNpcAABB(NpcId npcId) const;
 
+	// Of all the NPCs of this ship, active or not
+	Geometry::AABB CalculateShipNpcAABB(ShipId shipId) const;
+
 	size_t GetFlameCount(ShipId shipId) const
 	{
 		assert(shipId < mShips.size());
@@ -1465,6 +1489,8 @@ private:
 		vec2f const & corner2,
 		std::function<void(NpcId)> action) const;
 
+	SpatialGrid const & GetParticleSpatialGrid() const;
+
 	void InternalBeginMoveNpc(
 		NpcId id,
 		int particleOrdinal,
@@ -1608,11 +1634,22 @@ private:
 	void UpdateNpcPhysics(
 		float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
-		SimulationParameters const & simulationParameters);
+		SimulationParameters const & simulationParameters,
+		ThreadManager & threadManager);
+
+	void CalculateNpcForces(
+		vec2f const & globalWindForce,
+		SimulationParameters const & simulationParameters,
+		ThreadManager & threadManager);
 
 	void UpdateNpcBehavior(
 		float currentSimulationTime,
-		SimulationParameters const & simulationParameters);
+		SimulationParameters const & simulationParameters,
+		VisibleWorld const & visibleWorld);
+
+	bool IsNpcInVisibleWorld(
+		StateType const & npc,
+		VisibleWorld const & visibleWorld) const;
 
 	void UpdateNpcsEnd();
 
@@ -1627,7 +1664,8 @@ private:
 		StateType const & npc,
 		int npcParticleOrdinal,
 		vec2f const & globalWindForce,
-		SimulationParameters const & simulationParameters);
+		SimulationParameters const & simulationParameters,
+		std::vector<OceanSurfaceDisplacement> & oceanSurfaceDisplacements);
 
 	inline void CalculateNpcParticleSpringForces(StateType const & npc);
 
@@ -2345,6 +2383,15 @@ private:
 	// All of the NPC particles.
 	NpcParticles mParticles;
 
+	// Spatial index of the particles of all NPCs, for region queries; rebuilt
+	// lazily, at most once per simulation step unless NPCs are moved by tools.
+	// Indexes a compact snapshot of the particles, with the owner of each.
+	SpatialGrid mutable mParticleSpatialGrid;
+	std::vector<vec2f> mutable mParticleSpatialGridPositions;
+	std::vector<ElementIndex> mutable mParticleSpatialGridParticles;
+	std::vector<NpcId> mutable mParticleSpatialGridNpcs;
+	bool mutable mIsParticleSpatialGridDirty;
+
 	//
 	// State
 	//
@@ -2358,6 +2405,14 @@ private:
 
 	float mGeneralizedPanicLevel; // [0.0f ... +1.0f], manually decayed
 
+	// The NPCs that are active after the first physics pass, in NPC ID order; saves the
+	// following passes from visiting the (large) states of all NPCs
+	std::vector<NpcId> mPhysicsActiveNpcs;
+
+	// Tasks calculating NPC forces in parallel, each with its own deferred ocean surface displacements
+	std::vector<ThreadPool::Task> mNpcForcesTasks;
+	std::vector<std::vector<OceanSurfaceDisplacement>> mNpcForcesTaskOceanSurfaceDisplacements;
+
 	//
 	// Stats
 	//
@@ -319,7 +319,8 @@ Npcs::StateType::RegimeType Npcs::CalculateRegime(StateType const & npc)
 void Npcs::UpdateNpcPhysics(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     LogNpcDebug("----------------------------------");
     LogNpcDebug("----------------------------------");
@@ -337,11 +338,15 @@ void Npcs::UpdateNpcPhysics(
     // 2. Low-frequency and high-frequency updates of Npc and NpcParticle attributes
     // 3. Check if a particle's constrained state is still valid (deleted/folded triangles)
     // 4. Check if a free secondary particle should become constrained
-    // 5. Calculate preliminary forces
-    // 6. Calculate spring forces
+    // 5. Calculate preliminary forces (in parallel)
+    // 6. Calculate spring forces (in parallel)
     // 7. Update physical state
     // 8. Maintain world bounds
     //
+    // NPCs do not interact with each other before step 7; we thus run steps 2-4 for all NPCs,
+    // then steps 5-6, and finally steps 7-8, which is the same as running all of them for
+    // one NPC after the other.
+    //
 
     // Calculate all physics constants needed for physics update
 
@@ -364,6 +369,8 @@ void Npcs::UpdateNpcPhysics(
 
     // Visit all NPCs
 
+    mPhysicsActiveNpcs.clear();
+
     for (auto & npcState : mStateBuffer)
     {
         if (npcState.has_value()
@@ -702,7 +709,7 @@ void Npcs::UpdateNpcPhysics(
             if (!npcState->IsActive())
                 continue;
 
-            // Check validity of constrained triangles, and calculate preliminary forces
+            // Check validity of constrained triangles
 
             for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
             {
@@ -737,81 +744,171 @@ void Npcs::UpdateNpcPhysics(
                         }
                     }
                 }
-
-                // Preliminary forces
-
-                CalculateNpcParticlePreliminaryForces(
-                    *npcState,
-                    static_cast<int>(p),
-                    globalWindForce,
-                    simulationParameters);
             }
 
             assert(npcState->IsActive());
 
-            // Spring forces for whole NPC
+            mPhysicsActiveNpcs.push_back(npcState->Id);
+        }
+    }
+
+    // Preliminary and spring forces
+
+    CalculateNpcForces(
+        globalWindForce,
+        simulationParameters,
+        threadManager);
+
+    // Visit all active NPCs again
+
+    for (NpcId const npcId : mPhysicsActiveNpcs)
+    {
+        auto & npcState = mStateBuffer[npcId];
+        assert(npcState.has_value());
+        assert(npcState->IsActive());
 
-            CalculateNpcParticleSpringForces(*npcState);
+        assert(mShips[npcState->CurrentShipId].has_value());
+        auto & homeShip = mShips[npcState->CurrentShipId]->HomeShip;
 
-            // Update physical state for all particles and maintain world bounds
+        // Update physical state for all particles and maintain world bounds
 
+        for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+        {
             assert(npcState->IsActive());
 
-            for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
-            {
-                assert(npcState->IsActive());
+            UpdateNpcParticlePhysics(
+                *npcState,
+                static_cast<int>(p),
+                homeShip,
+                currentSimulationTime,
+                simulationParameters);
 
-                UpdateNpcParticlePhysics(
+            if (!npcState->IsActive())
+                break;
+
+            MaintainInWorldBounds(
+                *npcState,
+                static_cast<int>(p),
+                homeShip,
+                simulationParameters);
+
+            if (npcState->CurrentRegime == StateType::RegimeType::Free)
+            {
+                // Only maintain over land if _all_ particles are free
+                MaintainOverLand(
                     *npcState,
                     static_cast<int>(p),
                     homeShip,
                     currentSimulationTime,
                     simulationParameters);
+            }
+        }
 
-                if (!npcState->IsActive())
-                    break;
+        // If being moved: now that all particles have been moved, make sure
+        // the NPC triangles are not folded
+        if (npcState->CurrentRegime == StateType::RegimeType::BeingPlaced
+            && !npcState->BeingPlacedState->DoMoveWholeMesh)
+        {
+            MaintainNpcUnfolded(
+                *npcState,
+                homeShip,
+                simulationParameters);
+        }
+    }
+}
 
-                MaintainInWorldBounds(
-                    *npcState,
-                    static_cast<int>(p),
-                    homeShip,
-                    simulationParameters);
+void Npcs::CalculateNpcForces(
+    vec2f const & globalWindForce,
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    //
+    // Forces only depend on each NPC's own particles and on the world, hence we
+    // split active NPCs into batches that run in parallel; ocean surface displacements
+    // are the only world changes, and they are deferred and applied afterwards,
+    // in batch order
+    //
 
-                if (npcState->CurrentRegime == StateType::RegimeType::Free)
+    // Less than this many NPCs per batch is not worth the task overhead
+    size_t constexpr MinNpcsPerBatch = 32;
+
+    size_t const npcCount = mPhysicsActiveNpcs.size();
+    size_t const batchCount = std::max(
+        std::min(threadManager.GetSimulationParallelism(), npcCount / MinNpcsPerBatch),
+        size_t(1));
+    size_t const npcsPerBatch = (npcCount + batchCount - 1) / batchCount;
+
+    if (mNpcForcesTaskOceanSurfaceDisplacements.size() < batchCount)
+    {
+        mNpcForcesTaskOceanSurfaceDisplacements.resize(batchCount);
+    }
+
+    mNpcForcesTasks.clear();
+    for (size_t b = 0; b < batchCount; ++b)
+    {
+        size_t const startNpc = b * npcsPerBatch;
+        size_t const endNpc = std::min(startNpc + npcsPerBatch, npcCount);
+
+        mNpcForcesTasks.emplace_back(
+            [this, startNpc, endNpc, b, &globalWindForce, &simulationParameters]()
+            {
+                auto & oceanSurfaceDisplacements = mNpcForcesTaskOceanSurfaceDisplacements[b];
+
+                for (size_t n = startNpc; n < endNpc; ++n)
                 {
-                    // Only maintain over land if _all_ particles are free
-                    MaintainOverLand(
-                        *npcState,
-                        static_cast<int>(p),
-                        homeShip,
-                        currentSimulationTime,
-                        simulationParameters);
+                    auto const & npcState = mStateBuffer[mPhysicsActiveNpcs[n]];
+                    assert(npcState.has_value() && npcState->IsActive());
+
+                    for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+                    {
+                        CalculateNpcParticlePreliminaryForces(
+                            *npcState,
+                            static_cast<int>(p),
+                            globalWindForce,
+                            simulationParameters,
+                            oceanSurfaceDisplacements);
+                    }
+
+                    CalculateNpcParticleSpringForces(*npcState);
                 }
-            }
+            });
+    }
 
-            // If being moved: now that all particles have been moved, make sure
-            // the NPC triangles are not folded
-            if (npcState->CurrentRegime == StateType::RegimeType::BeingPlaced
-                && !npcState->BeingPlacedState->DoMoveWholeMesh)
-            {
-                MaintainNpcUnfolded(
-                    *npcState,
-                    homeShip,
-                    simulationParameters);
-            }
+    if (mNpcForcesTasks.size() == 1)
+    {
+        mNpcForcesTasks[0]();
+    }
+    else
+    {
+        threadManager.GetSimulationThreadPool().Run(mNpcForcesTasks);
+    }
+
+    for (size_t b = 0; b < batchCount; ++b)
+    {
+        for (auto const & displacement : mNpcForcesTaskOceanSurfaceDisplacements[b])
+        {
+            mParentWorld.DisplaceOceanSurfaceAt(displacement.X, displacement.YOffset);
         }
+
+        mNpcForcesTaskOceanSurfaceDisplacements[b].clear();
     }
 }
 
 void Npcs::UpdateNpcBehavior(
     float currentSimulationTime,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    VisibleWorld const & visibleWorld)
 {
     LogNpcDebug("----------------------------------");
     LogNpcDebug("----------------------------------");
 
     assert(mDeferredRemovalNpcs.empty()); // Only made deferred removable by behavior updates
 
+    // Behavior always runs at full rate, as it drives the NPCs' physics; animation
+    // and light are only seen, hence NPCs out of view get them at a lower rate,
+    // staggered by ID
+    unsigned int constexpr OutOfViewUpdatePeriod = 4;
+
     for (auto & npcState : mStateBuffer)
     {
         if (npcState.has_value())
@@ -819,6 +916,11 @@ void Npcs::UpdateNpcBehavior(
             assert(mShips[npcState->CurrentShipId].has_value());
             auto & homeShip = mShips[npcState->CurrentShipId]->HomeShip;
 
+            bool const doUpdateLooks =
+                mCurrentSimulationSequenceNumber.IsStepOf(npcState->Id % OutOfViewUpdatePeriod, OutOfViewUpdatePeriod)
+                || mCurrentlySelectedNpc == npcState->Id
+                || IsNpcInVisibleWorld(*npcState, visibleWorld);
+
             // Behavior and animation
 
             switch (npcState->Kind)
@@ -830,9 +932,12 @@ void Npcs::UpdateNpcBehavior(
                         currentSimulationTime,
                         simulationParameters);
 
-                    UpdateFurnitureNpcAnimation(
-                        *npcState,
-                        currentSimulationTime);
+                    if (doUpdateLooks)
+                    {
+                        UpdateFurnitureNpcAnimation(
+                            *npcState,
+                            currentSimulationTime);
+                    }
 
                     break;
                 }
@@ -844,9 +949,12 @@ void Npcs::UpdateNpcBehavior(
                         currentSimulationTime,
                         simulationParameters);
 
-                    UpdateHumanNpcAnimation(
-                        *npcState,
-                        currentSimulationTime);
+                    if (doUpdateLooks)
+                    {
+                        UpdateHumanNpcAnimation(
+                            *npcState,
+                            currentSimulationTime);
+                    }
 
                     break;
                 }
@@ -854,31 +962,54 @@ void Npcs::UpdateNpcBehavior(
 
             // Light
 
-            for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+            if (doUpdateLooks)
             {
-                float light;
-
-                // Only lighten constrained particles
-                if (npcState->ParticleMesh.Particles[p].ConstrainedState.has_value())
-                {
-                    auto const & triangleIndices = homeShip.GetTriangles().GetPointIndices(npcState->ParticleMesh.Particles[p].ConstrainedState->CurrentBCoords.TriangleElementIndex);
-                    auto const & bcoords = npcState->ParticleMesh.Particles[p].ConstrainedState->CurrentBCoords.BCoords;
-                    light =
-                        homeShip.GetPoints().GetLight(triangleIndices[0]) * bcoords[0]
-                        + homeShip.GetPoints().GetLight(triangleIndices[1]) * bcoords[1]
-                        + homeShip.GetPoints().GetLight(triangleIndices[2]) * bcoords[2];
-                }
-                else
+                for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
                 {
-                    light = 0.0f;
-                }
+                    float light;
 
-                mParticles.SetLight(npcState->ParticleMesh.Particles[p].ParticleIndex, light);
+                    // Only lighten constrained particles
+                    if (npcState->ParticleMesh.Particles[p].ConstrainedState.has_value())
+                    {
+                        auto const & triangleIndices = homeShip.GetTriangles().GetPointIndices(npcState->ParticleMesh.Particles[p].ConstrainedState->CurrentBCoords.TriangleElementIndex);
+                        auto const & bcoords = npcState->ParticleMesh.Particles[p].ConstrainedState->CurrentBCoords.BCoords;
+                        light =
+                            homeShip.GetPoints().GetLight(triangleIndices[0]) * bcoords[0]
+                            + homeShip.GetPoints().GetLight(triangleIndices[1]) * bcoords[1]
+                            + homeShip.GetPoints().GetLight(triangleIndices[2]) * bcoords[2];
+                    }
+                    else
+                    {
+                        light = 0.0f;
+                    }
+
+                    mParticles.SetLight(npcState->ParticleMesh.Particles[p].ParticleIndex, light);
+                }
             }
         }
     }
 }
 
+bool Npcs::IsNpcInVisibleWorld(
+    StateType const & npc,
+    VisibleWorld const & visibleWorld) const
+{
+    // NPCs extend beyond their particles - e.g. with their limbs
+    float const margin = 3.0f * mCurrentSizeMultiplier; // Magic number
+
+    for (auto const & particle : npc.ParticleMesh.Particles)
+    {
+        vec2f const & position = mParticles.GetPosition(particle.ParticleIndex);
+        if (position.x >= visibleWorld.TopLeft.x - margin && position.x <= visibleWorld.BottomRight.x + margin
+            && position.y >= visibleWorld.BottomRight.y - margin && position.y <= visibleWorld.TopLeft.y + margin)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void Npcs::UpdateNpcsEnd()
 {
     //
@@ -934,6 +1065,12 @@ void Npcs::UpdateNpcsEnd()
     //
 
     mParticles.ResetExternalForces();
+
+    //
+    // NPCs have moved; the spatial grid is rebuilt at the first query
+    //
+
+    mIsParticleSpatialGridDirty = true;
 }
 
 void Npcs::UpdateNpcParticlePhysics(
@@ -1872,7 +2009,8 @@ void Npcs::CalculateNpcParticlePreliminaryForces(
     StateType const & npc,
     int npcParticleOrdinal,
     vec2f const & globalWindForce,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    std::vector<OceanSurfaceDisplacement> & oceanSurfaceDisplacements)
 {
     auto & npcParticle = npc.ParticleMesh.Particles[npcParticleOrdinal];
 
@@ -2017,7 +2155,7 @@ void Npcs::CalculateNpcParticlePreliminaryForces(
                     * std::min(1.0f, 2.0f / static_cast<float>(npc.ParticleMesh.Particles.size())) // Other particles in this mesh will generate waves
                     * 0.6f; // Magic number
 
-                mParentWorld.DisplaceOceanSurfaceAt(particlePosition.x, waveDisplacement);
+                oceanSurfaceDisplacements.emplace_back(particlePosition.x, waveDisplacement);
             }
         }
 
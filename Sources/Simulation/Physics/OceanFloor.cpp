@@ -24,6 +24,9 @@ OceanFloor::OceanFloor(OceanFloorHeightMap && heightMap)
     , mCurrentSeaDepth(0.0f)
     , mCurrentOceanFloorBumpiness(0.0f)
     , mCurrentOceanFloorDetailAmplification(0.0f)
+    , mAreSamplesDirtyForRendering(true)
+    , mLastUploadedVisibleWorldTopLeft(vec2f::zero())
+    , mLastUploadedVisibleWorldBottomRight(vec2f::zero())
 {
     // Initialize constant sample values
     mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f; // Because extra sample is == mSamples[SamplesCount - 1].SampleValue
@@ -79,17 +82,35 @@ void OceanFloor::Upload(
     SimulationParameters const & /*simulationParameters*/,
     RenderContext & renderContext) const
 {
+    VisibleWorld const & visibleWorld = renderContext.GetVisibleWorld();
+
+    //
+    // Land is sticky in the render context: only re-upload it
+    // when it would be different
+    //
+
+    if (!mAreSamplesDirtyForRendering
+        && visibleWorld.TopLeft == mLastUploadedVisibleWorldTopLeft
+        && visibleWorld.BottomRight == mLastUploadedVisibleWorldBottomRight)
+    {
+        return;
+    }
+
+    mAreSamplesDirtyForRendering = false;
+    mLastUploadedVisibleWorldTopLeft = visibleWorld.TopLeft;
+    mLastUploadedVisibleWorldBottomRight = visibleWorld.BottomRight;
+
     //
     // We want to upload at most RenderSlices slices
     //
 
     // Find index of leftmost sample, and its corresponding world X
-    auto const sampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + SimulationParameters::HalfMaxWorldWidth) / Dx);
+    auto const sampleIndex = FastTruncateToArchInt((visibleWorld.TopLeft.x + SimulationParameters::HalfMaxWorldWidth) / Dx);
     float sampleIndexX = -SimulationParameters::HalfMaxWorldWidth + (Dx * sampleIndex);
 
     // Calculate number of samples required to cover screen from leftmost sample
     // up to the visible world right (included)
-    float const coverageWidth = renderContext.GetVisibleWorld().BottomRight.x - sampleIndexX;
+    float const coverageWidth = visibleWorld.BottomRight.x - sampleIndexX;
     size_t const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWidth / Dx));
 
     if (numberOfSamplesToRender >= RenderSlices<size_t>)
@@ -281,6 +302,8 @@ void OceanFloor::SetTerrainHeight(
 
     // Make sure extra sample has same value as previous one
     mSamples[SamplesCount].SampleValue = mSamples[SamplesCount - 1].SampleValue;
+
+    mAreSamplesDirtyForRendering = true;
 }
 
 void OceanFloor::CalculateBumpProfile()
@@ -327,6 +350,8 @@ void OceanFloor::CalculateResultantSampleValues()
     mSamples[SamplesCount].SampleValue = previousSampleValue;
 
     assert(mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+
+    mAreSamplesDirtyForRendering = true;
 }
 
 }
\ No newline at end of file
@@ -11,8 +11,12 @@
 #include "../SimulationParameters.h"
 
 #include <Core/GameMath.h>
+#include <Core/SysSpecifics.h>
 #include <Core/UniqueBuffer.h>
+#include <Core/Vectors.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -112,6 +116,59 @@ public:
         return std::make_tuple(y < sampleValue, sampleValue, sampleIndexI);
     }
 
+    /*
+     * Equivalent to invoking GetHeightAt() on each of count positions' x - clamped to
+     * world boundaries, as positions might be outside of them - but evaluating four
+     * positions at a time.
+     */
+    void GetHeightsAt(
+        vec2f const * restrict positions,
+        float * restrict outHeights,
+        size_t count) const noexcept
+    {
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+        size_t const vectorizedCount = GetHeightsAt_SSEVectorized(positions, outHeights, count);
+#elif FS_IS_ARM_NEON()
+        size_t const vectorizedCount = GetHeightsAt_NeonVectorized(positions, outHeights, count);
+#else
+        size_t const vectorizedCount = 0;
+#endif
+
+        for (size_t i = vectorizedCount; i < count; ++i)
+        {
+            outHeights[i] = GetHeightAt(Clamp(positions[i].x, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth));
+        }
+    }
+
+    /*
+     * Returns the maximum height of the floor between the two x's - clamped to
+     * world boundaries; a point above this height is above the floor anywhere
+     * in-between.
+     */
+    float GetMaxHeightIn(
+        float left,
+        float right) const noexcept
+    {
+        assert(left <= right);
+
+        register_int const leftSampleIndexI = FastTruncateToArchInt(
+            (Clamp(left, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth) + SimulationParameters::HalfMaxWorldWidth) / Dx);
+        register_int const rightSampleIndexI = FastTruncateToArchInt(
+            (Clamp(right, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth) + SimulationParameters::HalfMaxWorldWidth) / Dx);
+
+        assert(leftSampleIndexI >= 0 && rightSampleIndexI < SamplesCount);
+
+        // Heights are interpolated linearly, hence the maximum is at a sample;
+        // the one after the right one included (we allocate an extra sample just for this)
+        float maxHeight = mSamples[leftSampleIndexI].SampleValue;
+        for (register_int i = leftSampleIndexI + 1; i <= rightSampleIndexI + 1; ++i)
+        {
+            maxHeight = std::max(maxHeight, mSamples[i].SampleValue);
+        }
+
+        return maxHeight;
+    }
+
     /*
      * Assumption: x is within world boundaries.
      */
@@ -134,6 +191,108 @@ private:
 
     void CalculateResultantSampleValues();
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    size_t GetHeightsAt_SSEVectorized(
+        vec2f const * restrict positions,
+        float * restrict outHeights,
+        size_t count) const noexcept
+    {
+        __m128 const minX_4 = _mm_set1_ps(-SimulationParameters::HalfMaxWorldWidth);
+        __m128 const maxX_4 = _mm_set1_ps(SimulationParameters::HalfMaxWorldWidth);
+        __m128 const dx_4 = _mm_set1_ps(Dx);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // x0 y0 x1 y1, x2 y2 x3 y3 => x0 x1 x2 x3
+            __m128 const xy01_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i));
+            __m128 const xy23_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i + 2));
+            __m128 const x_4 = _mm_min_ps(_mm_max_ps(_mm_shuffle_ps(xy01_4, xy23_4, _MM_SHUFFLE(2, 0, 2, 0)), minX_4), maxX_4);
+
+            // Fractional index in the sample array
+            __m128 const sampleIndexF_4 = _mm_div_ps(_mm_add_ps(x_4, maxX_4), dx_4);
+
+            // Integral part - never negative, hence truncation is flooring
+            __m128i const sampleIndexI_4 = _mm_cvttps_epi32(sampleIndexF_4);
+
+            // Fractional part within sample index and the next sample index
+            __m128 const sampleIndexDx_4 = _mm_sub_ps(sampleIndexF_4, _mm_cvtepi32_ps(sampleIndexI_4));
+
+            alignas(16) std::int32_t sampleIndices[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(sampleIndices), sampleIndexI_4);
+
+            // Fetch the (value, delta) pairs - no gathers
+            __m128 const samples01_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[0]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[1]])));
+            __m128 const samples23_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[2]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[3]])));
+
+            __m128 const sampleValues_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const sampleDeltas_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm_storeu_ps(
+                outHeights + i,
+                _mm_add_ps(
+                    sampleValues_4,
+                    _mm_mul_ps(sampleDeltas_4, sampleIndexDx_4)));
+        }
+
+        return i;
+    }
+#endif
+
+#if FS_IS_ARM_NEON()
+    size_t GetHeightsAt_NeonVectorized(
+        vec2f const * restrict positions,
+        float * restrict outHeights,
+        size_t count) const noexcept
+    {
+        float32x4_t const minX_4 = vdupq_n_f32(-SimulationParameters::HalfMaxWorldWidth);
+        float32x4_t const maxX_4 = vdupq_n_f32(SimulationParameters::HalfMaxWorldWidth);
+        float32x4_t const dxReciprocal_4 = vdupq_n_f32(1.0f / Dx); // No division on all Neons
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // De-interleave x's and y's
+            float32x4x2_t const xy_4 = vld2q_f32(reinterpret_cast<float const *>(positions + i));
+            float32x4_t const x_4 = vminq_f32(vmaxq_f32(xy_4.val[0], minX_4), maxX_4);
+
+            // Fractional index in the sample array
+            float32x4_t const sampleIndexF_4 = vmulq_f32(vaddq_f32(x_4, maxX_4), dxReciprocal_4);
+
+            // Integral part - never negative, hence truncation is flooring
+            int32x4_t const sampleIndexI_4 = vcvtq_s32_f32(sampleIndexF_4);
+
+            // Fractional part within sample index and the next sample index
+            float32x4_t const sampleIndexDx_4 = vsubq_f32(sampleIndexF_4, vcvtq_f32_s32(sampleIndexI_4));
+
+            std::int32_t sampleIndices[4];
+            vst1q_s32(sampleIndices, sampleIndexI_4);
+
+            // Fetch the (value, delta) pairs - no gathers
+            float32x4x2_t const samples_4 = vuzpq_f32(
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[0]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[1]].SampleValue))),
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[2]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[3]].SampleValue))));
+
+            vst1q_f32(
+                outHeights + i,
+                vmlaq_f32(
+                    samples_4.val[0],
+                    samples_4.val[1],
+                    sampleIndexDx_4));
+        }
+
+        return i;
+    }
+#endif
+
     inline float CalculateResultantSampleValue(size_t sampleIndex) const
     {
         assert(sampleIndex < SamplesCount);
@@ -181,6 +340,15 @@ private:
     float mCurrentSeaDepth;
     float mCurrentOceanFloorBumpiness;
     float mCurrentOceanFloorDetailAmplification;
+
+    //
+    // Rendering: we only re-upload the land when either the samples or the
+    // visible world have changed since the last upload
+    //
+
+    bool mutable mAreSamplesDirtyForRendering;
+    vec2f mutable mLastUploadedVisibleWorldTopLeft;
+    vec2f mutable mLastUploadedVisibleWorldBottomRight;
 };
 
 }
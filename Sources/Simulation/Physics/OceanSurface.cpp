@@ -77,7 +77,7 @@ OceanSurface::OceanSurface(
     mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Won't really be used
 }
 
-void OceanSurface::Update(
+void OceanSurface::UpdateWaves(
     float currentSimulationTime,
     Wind const & wind,
     SimulationParameters const & simulationParameters)
@@ -186,7 +186,13 @@ void OceanSurface::Update(
                 RogueWaveGracePeriod);
         }
     }
+}
 
+void OceanSurface::UpdateFluidDynamics(
+    float currentSimulationTime,
+    Wind const & wind,
+    SimulationParameters const & simulationParameters)
+{
     //
     // 2. Radial wind (if any)
     //
@@ -372,6 +378,64 @@ void OceanSurface::TriggerRogueWave(
         currentSimulationTime);
 }
 
+void OceanSurface::SaveSnapshot(SnapshotWriter & writer) const
+{
+    writer.Write(mSamples);
+    writer.Write(mSWEHeightField);
+    writer.Write(mSWEVelocityField);
+    writer.Write(mInteractiveWaveTargetHeight);
+    writer.Write(mInteractiveWaveCurrentHeightGrowthCoefficient);
+    writer.Write(mInteractiveWaveTargetHeightGrowthCoefficient);
+    writer.Write(mInteractiveWaveHeightGrowthCoefficientGrowthRate);
+    writer.Write(mDeltaHeightBuffer);
+
+    writer.Write(mWindIncisivenessRunningAverage);
+
+    for (auto const * stateMachine : { &mSWETsunamiWaveStateMachine, &mSWERogueWaveWaveStateMachine })
+    {
+        writer.Write(stateMachine->has_value());
+        if (stateMachine->has_value())
+        {
+            writer.Write((*stateMachine)->GetCenterX());
+            writer.Write((*stateMachine)->GetTargetRelativeHeight());
+            writer.Write((*stateMachine)->GetRate());
+            writer.Write((*stateMachine)->GetStartSimulationTime());
+        }
+    }
+}
+
+void OceanSurface::RestoreSnapshot(SnapshotReader & reader)
+{
+    reader.Read(mSamples);
+    reader.Read(mSWEHeightField);
+    reader.Read(mSWEVelocityField);
+    reader.Read(mInteractiveWaveTargetHeight);
+    reader.Read(mInteractiveWaveCurrentHeightGrowthCoefficient);
+    reader.Read(mInteractiveWaveTargetHeightGrowthCoefficient);
+    reader.Read(mInteractiveWaveHeightGrowthCoefficientGrowthRate);
+    reader.Read(mDeltaHeightBuffer);
+
+    reader.Read(mWindIncisivenessRunningAverage);
+
+    for (auto * stateMachine : { &mSWETsunamiWaveStateMachine, &mSWERogueWaveWaveStateMachine })
+    {
+        stateMachine->reset();
+        if (reader.Read<bool>())
+        {
+            float const centerX = reader.Read<float>();
+            float const targetRelativeHeight = reader.Read<float>();
+            float const rate = reader.Read<float>();
+            float const startSimulationTime = reader.Read<float>();
+
+            stateMachine->emplace(
+                centerX,
+                targetRelativeHeight,
+                rate,
+                startSimulationTime);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
 template<OceanRenderDetailType DetailType>
@@ -758,20 +822,27 @@ void OceanSurface::ImpartInteractiveWave(
 
 void OceanSurface::UpdateInteractiveWaves()
 {
+    // Note: all buffers via restrict pointers, so that the loop may be vectorized
+    float const * const restrict targetHeightGrowthCoefficientBuffer = mInteractiveWaveTargetHeightGrowthCoefficient.data();
+    float const * const restrict heightGrowthCoefficientGrowthRateBuffer = mInteractiveWaveHeightGrowthCoefficientGrowthRate.data();
+    float const * const restrict targetHeightBuffer = mInteractiveWaveTargetHeight.data();
     float * const restrict currentHeightGrowthCoefficientBuffer = mInteractiveWaveCurrentHeightGrowthCoefficient.data();
     float * const restrict sweHeightFieldBuffer = mSWEHeightField.data() + SWEBufferPrefixSize;
 
     for (size_t i = 0; i < SamplesCount; ++i)
     {
         // Update growth coefficient
-        currentHeightGrowthCoefficientBuffer[i] +=
-            (mInteractiveWaveTargetHeightGrowthCoefficient[i] - currentHeightGrowthCoefficientBuffer[i])
-            * mInteractiveWaveHeightGrowthCoefficientGrowthRate[i];
+        float const currentHeightGrowthCoefficient =
+            currentHeightGrowthCoefficientBuffer[i]
+            + (targetHeightGrowthCoefficientBuffer[i] - currentHeightGrowthCoefficientBuffer[i])
+            * heightGrowthCoefficientGrowthRateBuffer[i];
+
+        currentHeightGrowthCoefficientBuffer[i] = currentHeightGrowthCoefficient;
 
         // Smooth current height to target according to current growth coefficient
         sweHeightFieldBuffer[i] +=
-            (mInteractiveWaveTargetHeight[i] - sweHeightFieldBuffer[i])
-            * currentHeightGrowthCoefficientBuffer[i];
+            (targetHeightBuffer[i] - sweHeightFieldBuffer[i])
+            * currentHeightGrowthCoefficient;
     }
 }
 
@@ -12,9 +12,12 @@
 #include <Core/GameMath.h>
 #include <Core/PrecalculatedFunction.h>
 #include <Core/RunningAverage.h>
+#include <Core/Snapshot.h>
 #include <Core/StrongTypeDef.h>
 #include <Core/SysSpecifics.h>
+#include <Core/Vectors.h>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -30,6 +33,29 @@ public:
         SimulationEventDispatcher & simulationEventDispatcher);
 
     void Update(
+        float currentSimulationTime,
+        Wind const & wind,
+        SimulationParameters const & simulationParameters)
+    {
+        UpdateWaves(currentSimulationTime, wind, simulationParameters);
+        UpdateFluidDynamics(currentSimulationTime, wind, simulationParameters);
+    }
+
+    /*
+     * First half of Update(): advances the abnormal waves; may use the random engine
+     * and fire events, hence it has to run in the world's update sequence.
+     */
+    void UpdateWaves(
+        float currentSimulationTime,
+        Wind const & wind,
+        SimulationParameters const & simulationParameters);
+
+    /*
+     * Second half of Update(): advances the SWE fields and generates the samples;
+     * only touches the surface's own state, hence it may run concurrently with
+     * the update of other (non-ocean-surface) world pieces.
+     */
+    void UpdateFluidDynamics(
         float currentSimulationTime,
         Wind const & wind,
         SimulationParameters const & simulationParameters);
@@ -73,6 +99,31 @@ public:
         return GetHeightAt(position.x) - position.y;
     }
 
+    /*
+     * Equivalent to invoking GetDepth() on each of count positions, but evaluating
+     * four positions at a time.
+     *
+     * Assumption: all x's are in world boundaries.
+     */
+    void GetDepths(
+        vec2f const * restrict positions,
+        float * restrict outDepths,
+        size_t count) const noexcept
+    {
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+        size_t const vectorizedCount = GetDepths_SSEVectorized(positions, outDepths, count);
+#elif FS_IS_ARM_NEON()
+        size_t const vectorizedCount = GetDepths_NeonVectorized(positions, outDepths, count);
+#else
+        size_t const vectorizedCount = 0;
+#endif
+
+        for (size_t i = vectorizedCount; i < count; ++i)
+        {
+            outDepths[i] = GetDepth(positions[i]);
+        }
+    }
+
     /*
      * Assumption: x is in world boundaries.
      */
@@ -141,11 +192,119 @@ public:
         float currentSimulationTime,
         Wind const & wind);
 
+    void SaveSnapshot(SnapshotWriter & writer) const;
+
+    void RestoreSnapshot(SnapshotReader & reader);
+
 private:
 
     template<OceanRenderDetailType DetailType>
     void InternalUpload(RenderContext & renderContext) const;
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    size_t GetDepths_SSEVectorized(
+        vec2f const * restrict positions,
+        float * restrict outDepths,
+        size_t count) const noexcept
+    {
+        __m128 const halfMaxWorldWidth_4 = _mm_set1_ps(SimulationParameters::HalfMaxWorldWidth);
+        __m128 const dx_4 = _mm_set1_ps(Dx);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // x0 y0 x1 y1, x2 y2 x3 y3 => x0 x1 x2 x3, y0 y1 y2 y3
+            __m128 const xy01_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i));
+            __m128 const xy23_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i + 2));
+            __m128 const x_4 = _mm_shuffle_ps(xy01_4, xy23_4, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const y_4 = _mm_shuffle_ps(xy01_4, xy23_4, _MM_SHUFFLE(3, 1, 3, 1));
+
+            // Fractional index in the sample array
+            __m128 const sampleIndexF_4 = _mm_div_ps(_mm_add_ps(x_4, halfMaxWorldWidth_4), dx_4);
+
+            // Integral part - never negative, hence truncation is flooring
+            __m128i const sampleIndexI_4 = _mm_cvttps_epi32(sampleIndexF_4);
+
+            // Fractional part within sample index and the next sample index
+            __m128 const sampleIndexDx_4 = _mm_sub_ps(sampleIndexF_4, _mm_cvtepi32_ps(sampleIndexI_4));
+
+            alignas(16) std::int32_t sampleIndices[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(sampleIndices), sampleIndexI_4);
+
+            // Fetch the (value, delta) pairs - no gathers
+            __m128 const samples01_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[0]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[1]])));
+            __m128 const samples23_4 = _mm_loadh_pi(
+                _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[2]]))),
+                reinterpret_cast<__m64 const *>(&(mSamples[sampleIndices[3]])));
+
+            __m128 const sampleValues_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const sampleDeltas_4 = _mm_shuffle_ps(samples01_4, samples23_4, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm_storeu_ps(
+                outDepths + i,
+                _mm_sub_ps(
+                    _mm_add_ps(
+                        sampleValues_4,
+                        _mm_mul_ps(sampleDeltas_4, sampleIndexDx_4)),
+                    y_4));
+        }
+
+        return i;
+    }
+#endif
+
+#if FS_IS_ARM_NEON()
+    size_t GetDepths_NeonVectorized(
+        vec2f const * restrict positions,
+        float * restrict outDepths,
+        size_t count) const noexcept
+    {
+        float32x4_t const halfMaxWorldWidth_4 = vdupq_n_f32(SimulationParameters::HalfMaxWorldWidth);
+        float32x4_t const dxReciprocal_4 = vdupq_n_f32(1.0f / Dx); // No division on all Neons
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // De-interleave x's and y's
+            float32x4x2_t const xy_4 = vld2q_f32(reinterpret_cast<float const *>(positions + i));
+
+            // Fractional index in the sample array
+            float32x4_t const sampleIndexF_4 = vmulq_f32(vaddq_f32(xy_4.val[0], halfMaxWorldWidth_4), dxReciprocal_4);
+
+            // Integral part - never negative, hence truncation is flooring
+            int32x4_t const sampleIndexI_4 = vcvtq_s32_f32(sampleIndexF_4);
+
+            // Fractional part within sample index and the next sample index
+            float32x4_t const sampleIndexDx_4 = vsubq_f32(sampleIndexF_4, vcvtq_f32_s32(sampleIndexI_4));
+
+            std::int32_t sampleIndices[4];
+            vst1q_s32(sampleIndices, sampleIndexI_4);
+
+            // Fetch the (value, delta) pairs - no gathers
+            float32x4x2_t const samples_4 = vuzpq_f32(
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[0]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[1]].SampleValue))),
+                vcombine_f32(
+                    vld1_f32(&(mSamples[sampleIndices[2]].SampleValue)),
+                    vld1_f32(&(mSamples[sampleIndices[3]].SampleValue))));
+
+            vst1q_f32(
+                outDepths + i,
+                vsubq_f32(
+                    vmlaq_f32(
+                        samples_4.val[0],
+                        samples_4.val[1],
+                        sampleIndexDx_4),
+                    xy_4.val[1]));
+        }
+
+        return i;
+    }
+#endif
+
     static inline auto ToSampleIndex(float x) noexcept
     {
         // Calculate sample index, minimizing error
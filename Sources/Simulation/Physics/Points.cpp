@@ -5,11 +5,14 @@
 ***************************************************************************************/
 #include "Physics.h"
 
+#include <Core/Algorithms.h>
 #include <Core/Log.h>
 #include <Core/PrecalculatedFunction.h>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 namespace Physics {
 
@@ -43,8 +46,9 @@ void Points::Add(
     mAugmentedMaterialMassBuffer.emplace_back(structuralMaterial.GetMass());
     mTransientAdditionalMassBuffer.emplace_back(0.0f);
     mMassBuffer.emplace_back(structuralMaterial.GetMass());
+    mIsMassDirtyBuffer.emplace_back(false);
     mMaterialBuoyancyVolumeFillBuffer.emplace_back(structuralMaterial.BuoyancyVolumeFill);
-    mStrengthBuffer.emplace_back(strength);
+    mStrengthBuffer.emplace_back(Float16(strength));
     mStressBuffer.emplace_back(0.0f);
     mDecayBuffer.emplace_back(1.0f);
     mPinningCoefficientBuffer.emplace_back(1.0f);
@@ -76,7 +80,7 @@ void Points::Add(
     mWaterVelocityBuffer.emplace_back(vec2f::zero());
     mWaterMomentumBuffer.emplace_back(vec2f::zero());
     mCumulatedIntakenWater.emplace_back(0.0f);
-    mLeakingCompositeBuffer.emplace_back(LeakingComposite(isStructurallyLeaking));
+    mLeakingCompositeBuffer.emplace_back(LeakingComposite(false));
     if (isStructurallyLeaking)
         SetStructurallyLeaking(pointIndex);
     mFactoryIsStructurallyLeakingBuffer.emplace_back(isStructurallyLeaking);
@@ -88,11 +92,14 @@ void Points::Add(
     mMaterialHeatCapacityReciprocalBuffer.emplace_back(1.0f / structuralMaterial.GetHeatCapacity());
     mMaterialThermalExpansionCoefficientBuffer.emplace_back(structuralMaterial.ThermalExpansionCoefficient);
     mMaterialIgnitionTemperatureBuffer.emplace_back(structuralMaterial.IgnitionTemperature);
+    mCombustionCandidateTemperatureBuffer.emplace_back(CalculateCombustionCandidateTemperature(pointIndex));
     mMaterialCombustionTypeBuffer.emplace_back(structuralMaterial.CombustionType);
     mCombustionStateBuffer.emplace_back(CombustionState());
 
     // Water raction dynamics
     mWaterReactionStateBuffer.emplace_back(structuralMaterial.WaterReactivity);
+    if (mWaterReactionStateBuffer[pointIndex].State != WaterReactionState::StateType::Inert)
+        mWaterReactivePoints.push_back(pointIndex);
 
     // Electrical dynamics
     mElectricalElementBuffer.emplace_back(electricalElementIndex);
@@ -103,6 +110,8 @@ void Points::Add(
 
     // Rust dynamics
     mMaterialRustReceptivityBuffer.emplace_back(structuralMaterial.RustReceptivity);
+    if (structuralMaterial.RustReceptivity != 0.0f)
+        mRustablePoints.push_back(pointIndex);
 
     // Ephemeral particles
     mEphemeralParticleAttributes1Buffer.emplace_back();
@@ -127,13 +136,166 @@ void Points::Add(
     mIsGadgetAttachedBuffer.emplace_back(false);
 
     // Randomness
-    mRandomNormalizedUniformFloatBuffer.emplace_back(randomNormalizedUniformFloat);
+    mRandomNormalizedUniformFloatBuffer.emplace_back(Float16(randomNormalizedUniformFloat));
 
     // Immutable render attributes
     mColorBuffer.emplace_back(color.toVec4f());
     mTextureCoordinatesBuffer.emplace_back(textureCoordinates);
 }
 
+void Points::AddRange(
+    std::vector<ShipFactoryPoint> const & pointInfos,
+    float internalPressure,
+    std::vector<float> const & randomNormalizedUniformFloats)
+{
+    ElementIndex const startPointIndex = static_cast<ElementIndex>(mIsDamagedBuffer.GetCurrentPopulatedSize());
+    size_t const count = pointInfos.size();
+
+    assert(randomNormalizedUniformFloats.size() == count);
+
+    auto const structuralMaterial = [&pointInfos](size_t p) -> StructuralMaterial const &
+        {
+            return pointInfos[p].StructuralMtl;
+        };
+
+    mIsDamagedBuffer.emplace_back_n(count, false);
+    mMaterialsBuffer.emplace_back_range(count, [&](size_t p) { return Materials(&structuralMaterial(p), pointInfos[p].ElectricalMtl); });
+    mIsRopeBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].IsRope; });
+
+    mPositionBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].Position; });
+    mFactoryPositionBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].Position; });
+    mVelocityBuffer.emplace_back_n(count, vec2f::zero());
+    // First buffer implicitly
+    assert(mDynamicForceBuffers.size() >= 1);
+    mDynamicForceBuffers[0].emplace_back_n(count, vec2f::zero());
+    mStaticForceBuffer.emplace_back_n(count, vec2f::zero());
+    mAugmentedMaterialMassBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).GetMass(); });
+    mTransientAdditionalMassBuffer.emplace_back_n(count, 0.0f);
+    mMassBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).GetMass(); });
+    mIsMassDirtyBuffer.emplace_back_n(count, false);
+    mMaterialBuoyancyVolumeFillBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).BuoyancyVolumeFill; });
+    mStrengthBuffer.emplace_back_range(count, [&](size_t p) { return Float16(pointInfos[p].Strength); });
+    mStressBuffer.emplace_back_n(count, 0.0f);
+    mDecayBuffer.emplace_back_n(count, 1.0f);
+    mPinningCoefficientBuffer.emplace_back_n(count, 1.0f);
+    mIntegrationFactorTimeCoefficientBuffer.emplace_back_n(count, CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f));
+    mOceanFloorCollisionFactorsBuffer.emplace_back_range(count, [&](size_t p)
+        {
+            return CalculateOceanFloorCollisionFactors(
+                mCurrentElasticityAdjustment,
+                mCurrentStaticFrictionAdjustment,
+                mCurrentKineticFrictionAdjustment,
+                mCurrentOceanFloorElasticityCoefficient,
+                mCurrentOceanFloorFrictionCoefficient,
+                structuralMaterial(p).ElasticityCoefficient,
+                structuralMaterial(p).StaticFrictionCoefficient,
+                structuralMaterial(p).KineticFrictionCoefficient);
+        });
+    mAirWaterInterfaceInverseWidthBuffer.emplace_back_n(count, 1.0f / SimulationParameters::ShipParticleAirWaterInterfaceWidth);
+    mBuoyancyCoefficientsBuffer.emplace_back_range(count, [&](size_t p)
+        {
+            return CalculateBuoyancyCoefficients(
+                structuralMaterial(p).BuoyancyVolumeFill,
+                structuralMaterial(p).ThermalExpansionCoefficient);
+        });
+    mCachedDepthBuffer.emplace_back_range(count, [&](size_t p) { return mParentWorld.GetOceanSurface().GetDepth(pointInfos[p].Position); });
+
+    mIntegrationFactorBuffer.emplace_back_n(count, vec2f::zero());
+
+    mInternalPressureBuffer.emplace_back_n(count, internalPressure);
+    mIsHullBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).IsHull; }); // Default is from material
+    mMaterialWaterIntakeBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).WaterIntake; });
+    mMaterialWaterRestitutionBuffer.emplace_back_range(count, [&](size_t p) { return 1.0f - structuralMaterial(p).WaterRetention; });
+    mMaterialWaterDiffusionSpeedBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).WaterDiffusionSpeed; });
+
+    mWaterBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].Water; });
+    mWaterVelocityBuffer.emplace_back_n(count, vec2f::zero());
+    mWaterMomentumBuffer.emplace_back_n(count, vec2f::zero());
+    mCumulatedIntakenWater.emplace_back_n(count, 0.0f);
+    mLeakingCompositeBuffer.emplace_back_n(count, false);
+    mFactoryIsStructurallyLeakingBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].IsLeaking; });
+    for (size_t p = 0; p < count; ++p)
+    {
+        // In order, as each leak consumes randomness
+        if (pointInfos[p].IsLeaking)
+            SetStructurallyLeaking(startPointIndex + static_cast<ElementIndex>(p));
+
+        mTotalFactoryWetPoints += (pointInfos[p].Water > 0.0f ? 1 : 0);
+    }
+
+    // Heat dynamics
+    mTemperatureBuffer.emplace_back_n(count, SimulationParameters::Temperature0);
+    mMaterialHeatCapacityReciprocalBuffer.emplace_back_range(count, [&](size_t p)
+        {
+            assert(structuralMaterial(p).GetHeatCapacity() > 0.0f);
+            return 1.0f / structuralMaterial(p).GetHeatCapacity();
+        });
+    mMaterialThermalExpansionCoefficientBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).ThermalExpansionCoefficient; });
+    mMaterialIgnitionTemperatureBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).IgnitionTemperature; });
+    mCombustionCandidateTemperatureBuffer.emplace_back_range(count, [&](size_t p) { return CalculateCombustionCandidateTemperature(startPointIndex + static_cast<ElementIndex>(p)); });
+    mMaterialCombustionTypeBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).CombustionType; });
+    mCombustionStateBuffer.emplace_back_n(count);
+
+    // Water raction dynamics
+    mWaterReactionStateBuffer.emplace_back_range(count, [&](size_t p) { return WaterReactionState(structuralMaterial(p).WaterReactivity); });
+    for (size_t p = 0; p < count; ++p)
+    {
+        ElementIndex const pointIndex = startPointIndex + static_cast<ElementIndex>(p);
+        if (mWaterReactionStateBuffer[pointIndex].State != WaterReactionState::StateType::Inert)
+            mWaterReactivePoints.push_back(pointIndex);
+    }
+
+    // Electrical dynamics
+    ElementIndex electricalElementCounter = 0;
+    mElectricalElementBuffer.emplace_back_range(count, [&](size_t p)
+        {
+            return (nullptr != pointInfos[p].ElectricalMtl)
+                ? electricalElementCounter++
+                : NoneElementIndex;
+        });
+    mLightBuffer.emplace_back_n(count, 0.0f);
+
+    // Wind dynamics
+    mMaterialWindReceptivityBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).WindReceptivity; });
+
+    // Rust dynamics
+    mMaterialRustReceptivityBuffer.emplace_back_range(count, [&](size_t p) { return structuralMaterial(p).RustReceptivity; });
+    for (size_t p = 0; p < count; ++p)
+    {
+        if (structuralMaterial(p).RustReceptivity != 0.0f)
+            mRustablePoints.push_back(startPointIndex + static_cast<ElementIndex>(p));
+    }
+
+    // Ephemeral particles
+    mEphemeralParticleAttributes1Buffer.emplace_back_n(count);
+    mEphemeralParticleAttributes2Buffer.emplace_back_n(count);
+
+    // Structure
+    mConnectedSpringsBuffer.emplace_back_n(count);
+    mFactoryConnectedSpringsBuffer.emplace_back_n(count);
+    mConnectedTrianglesBuffer.emplace_back_n(count);
+    mFactoryConnectedTrianglesBuffer.emplace_back_n(count);
+
+    // Connectivity
+    mConnectedComponentIdBuffer.emplace_back_n(count, NoneConnectedComponentId);
+    mPlaneIdBuffer.emplace_back_n(count, NonePlaneId);
+    mPlaneIdFloatBuffer.emplace_back_n(count, 0.0f);
+    mCurrentConnectivityVisitSequenceNumberBuffer.emplace_back_n(count);
+
+    // Repair state
+    mRepairStateBuffer.emplace_back_n(count);
+
+    // Gadgets
+    mIsGadgetAttachedBuffer.emplace_back_n(count, false);
+
+    // Randomness
+    mRandomNormalizedUniformFloatBuffer.emplace_back_range(count, [&](size_t p) { return Float16(randomNormalizedUniformFloats[p]); });
+
+    // Immutable render attributes
+    mColorBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].RenderColor.toVec4f(); });
+    mTextureCoordinatesBuffer.emplace_back_range(count, [&](size_t p) { return pointInfos[p].TextureCoordinates; });
+}
+
 void Points::CreateEphemeralParticleAirBubble(
     vec2f const & position,
     float depth,
@@ -146,7 +308,7 @@ void Points::CreateEphemeralParticleAirBubble(
     PlaneId planeId)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = FindFreeEphemeralParticle(false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -174,6 +336,7 @@ void Points::CreateEphemeralParticleAirBubble(
     //mDecayBuffer[pointIndex] = 1.0f;
     mPinningCoefficientBuffer[pointIndex] = 1.0f;
     mIntegrationFactorTimeCoefficientBuffer[pointIndex] = CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f);
+    MarkMassAsDirty(pointIndex);
     mOceanFloorCollisionFactorsBuffer[pointIndex] = CalculateOceanFloorCollisionFactors(
         mCurrentElasticityAdjustment,
         mCurrentStaticFrictionAdjustment,
@@ -230,7 +393,7 @@ void Points::CreateEphemeralParticleAirBubble(
     mIsPlaneIdBufferEphemeralDirty = true;
 
     mColorBuffer[pointIndex] = airStructuralMaterial.RenderColor.toVec4f();
-    mIsEphemeralColorBufferDirty = true;
+    mColorBufferDirtyIntervals.Add(pointIndex);
 }
 
 void Points::CreateEphemeralParticleDebris(
@@ -244,7 +407,7 @@ void Points::CreateEphemeralParticleDebris(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = FindFreeEphemeralParticle(true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -265,6 +428,7 @@ void Points::CreateEphemeralParticleDebris(
     //mDecayBuffer[pointIndex] = 1.0f;
     mPinningCoefficientBuffer[pointIndex] = 1.0f;
     mIntegrationFactorTimeCoefficientBuffer[pointIndex] = CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f);
+    MarkMassAsDirty(pointIndex);
     mAirWaterInterfaceInverseWidthBuffer[pointIndex] = 1.0f / SimulationParameters::ShipParticleAirWaterInterfaceWidth;
     mBuoyancyCoefficientsBuffer[pointIndex] = BuoyancyCoefficients(0.0f, 0.0f); // No buoyancy
     mCachedDepthBuffer[pointIndex] = depth;
@@ -307,7 +471,7 @@ void Points::CreateEphemeralParticleDebris(
     mIsPlaneIdBufferEphemeralDirty = true;
 
     mColorBuffer[pointIndex] = structuralMaterial.RenderColor.toVec4f();
-    mIsEphemeralColorBufferDirty = true;
+    mColorBufferDirtyIntervals.Add(pointIndex);
 
     // Remember that ephemeral point elements are dirty now
     mAreEphemeralPointElementsDirtyForRendering = true;
@@ -324,7 +488,7 @@ void Points::CreateEphemeralParticleSmoke(
     SimulationParameters const & simulationParameters)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = FindFreeEphemeralParticle(true);
     assert(NoneElementIndex != pointIndex);
 
     // Choose a lifetime
@@ -354,6 +518,7 @@ void Points::CreateEphemeralParticleSmoke(
     //mDecayBuffer[pointIndex] = 1.0f;
     mPinningCoefficientBuffer[pointIndex] = 1.0f;
     mIntegrationFactorTimeCoefficientBuffer[pointIndex] = CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f);
+    MarkMassAsDirty(pointIndex);
     mOceanFloorCollisionFactorsBuffer[pointIndex] = CalculateOceanFloorCollisionFactors(
         mCurrentElasticityAdjustment,
         mCurrentStaticFrictionAdjustment,
@@ -410,7 +575,7 @@ void Points::CreateEphemeralParticleSmoke(
     mIsPlaneIdBufferEphemeralDirty = true;
 
     mColorBuffer[pointIndex] = airStructuralMaterial.RenderColor.toVec4f();
-    mIsEphemeralColorBufferDirty = true;
+    mColorBufferDirtyIntervals.Add(pointIndex);
 }
 
 void Points::CreateEphemeralParticleSparkle(
@@ -423,7 +588,7 @@ void Points::CreateEphemeralParticleSparkle(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = FindFreeEphemeralParticle(true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -444,6 +609,7 @@ void Points::CreateEphemeralParticleSparkle(
     //mDecayBuffer[pointIndex] = 1.0f;
     mPinningCoefficientBuffer[pointIndex] = 1.0f;
     mIntegrationFactorTimeCoefficientBuffer[pointIndex] = CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f);
+    MarkMassAsDirty(pointIndex);
     mAirWaterInterfaceInverseWidthBuffer[pointIndex] = 1.0f / SimulationParameters::ShipParticleAirWaterInterfaceWidth;
     mBuoyancyCoefficientsBuffer[pointIndex] = BuoyancyCoefficients(0.0f, 0.0f); // No buoyancy
     mCachedDepthBuffer[pointIndex] = depth;
@@ -495,7 +661,7 @@ void Points::CreateEphemeralParticleWakeBubble(
     SimulationParameters const & simulationParameters)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = FindFreeEphemeralParticle(false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -519,6 +685,7 @@ void Points::CreateEphemeralParticleWakeBubble(
     //mDecayBuffer[pointIndex] = 1.0f;
     mPinningCoefficientBuffer[pointIndex] = 1.0f;
     mIntegrationFactorTimeCoefficientBuffer[pointIndex] = CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f);
+    MarkMassAsDirty(pointIndex);
     mOceanFloorCollisionFactorsBuffer[pointIndex] = CalculateOceanFloorCollisionFactors(
         mCurrentElasticityAdjustment,
         mCurrentStaticFrictionAdjustment,
@@ -572,7 +739,7 @@ void Points::CreateEphemeralParticleWakeBubble(
     mIsPlaneIdBufferEphemeralDirty = true;
 
     mColorBuffer[pointIndex] = waterStructuralMaterial.RenderColor.toVec4f();
-    mIsEphemeralColorBufferDirty = true;
+    mColorBufferDirtyIntervals.Add(pointIndex);
 }
 
 void Points::Detach(
@@ -621,8 +788,10 @@ void Points::Restore(
     mIsDamagedBuffer[pointElementIndex] = false;
 
     // Restore factory-time structural IsLeaking
+    bool const wasLeaking = (mLeakingCompositeBuffer[pointElementIndex].IsCumulativelyLeaking != 0);
     mLeakingCompositeBuffer[pointElementIndex].LeakingSources.StructuralLeak =
         mFactoryIsStructurallyLeakingBuffer[pointElementIndex] ? 1.0f : 0.0f;
+    OnLeakingChanged(pointElementIndex, wasLeaking);
 
     // Reset combustion state, in case it was not neutral
     if (mCombustionStateBuffer[pointElementIndex].State != CombustionState::StateType::NotBurning)
@@ -661,7 +830,7 @@ void Points::OnOrphaned(ElementIndex pointElementIndex)
         // New target: fraction of current size plus something
         mCombustionStateBuffer[pointElementIndex].MaxFlameDevelopment =
             mCombustionStateBuffer[pointElementIndex].FlameDevelopment / 3.0f
-            + 0.04f * mRandomNormalizedUniformFloatBuffer[pointElementIndex];
+            + 0.04f * GetRandomNormalizedUniformPersonalitySeed(pointElementIndex);
 
         mCombustionStateBuffer[pointElementIndex].State = CombustionState::StateType::Developing_2;
     }
@@ -684,6 +853,87 @@ void Points::DestroyEphemeralParticle(
     ExpireEphemeralParticle(pointElementIndex);
 }
 
+void Points::SaveSnapshot(SnapshotWriter & writer) const
+{
+    ElementCount const count = mAlignedShipPointCount;
+
+    writer.Write(mPositionBuffer, count);
+    writer.Write(mVelocityBuffer, count);
+    writer.Write(mMassBuffer, count);
+    writer.Write(mStressBuffer, count);
+    writer.Write(mDecayBuffer, count);
+    writer.Write(mPinningCoefficientBuffer, count);
+    writer.Write(mIntegrationFactorTimeCoefficientBuffer, count);
+    writer.Write(mCachedDepthBuffer, count);
+    writer.Write(mIntegrationFactorBuffer, count);
+    writer.Write(mInternalPressureBuffer, count);
+    writer.Write(mWaterBuffer, count);
+    writer.Write(mWaterVelocityBuffer, count);
+    writer.Write(mWaterMomentumBuffer, count);
+    writer.Write(mCumulatedIntakenWater, count);
+    writer.Write(mLeakingCompositeBuffer, count);
+    writer.Write(mTemperatureBuffer, count);
+    writer.Write(mCombustionStateBuffer, count);
+    writer.Write(mWaterReactionStateBuffer, count);
+    writer.Write(mLightBuffer, count);
+    writer.Write(mIsElectrifiedBuffer, count);
+
+    writer.Write(mBurningPoints);
+    writer.Write(mStoppedBurningPoints);
+}
+
+void Points::RestoreSnapshot(SnapshotReader & reader)
+{
+    ElementCount const count = mAlignedShipPointCount;
+
+    reader.Read(mPositionBuffer, count);
+    reader.Read(mVelocityBuffer, count);
+    reader.Read(mMassBuffer, count);
+    reader.Read(mStressBuffer, count);
+    reader.Read(mDecayBuffer, count);
+    reader.Read(mPinningCoefficientBuffer, count);
+    reader.Read(mIntegrationFactorTimeCoefficientBuffer, count);
+    reader.Read(mCachedDepthBuffer, count);
+    reader.Read(mIntegrationFactorBuffer, count);
+    reader.Read(mInternalPressureBuffer, count);
+    reader.Read(mWaterBuffer, count);
+    reader.Read(mWaterVelocityBuffer, count);
+    reader.Read(mWaterMomentumBuffer, count);
+    reader.Read(mCumulatedIntakenWater, count);
+    reader.Read(mLeakingCompositeBuffer, count);
+    reader.Read(mTemperatureBuffer, count);
+    reader.Read(mCombustionStateBuffer, count);
+    reader.Read(mWaterReactionStateBuffer, count);
+    reader.Read(mLightBuffer, count);
+    reader.Read(mIsElectrifiedBuffer, count);
+
+    reader.Read(mBurningPoints);
+    reader.Read(mStoppedBurningPoints);
+
+    RebuildLeakingPoints();
+
+    MarkAllMassesAsDirty();
+
+    //
+    // Expire all ephemeral particles
+    //
+
+    assert(nullptr != mShipPhysicsHandler);
+
+    VisitLiveEphemeralParticles(
+        [this](ElementIndex pointIndex)
+        {
+            mShipPhysicsHandler->HandleEphemeralParticleDestroy(pointIndex);
+            ExpireEphemeralParticle(pointIndex);
+        });
+
+    mEphemeralParticleAllocations.clear();
+
+    mAreEphemeralPointElementsDirtyForRendering = true;
+
+    MarkDecayBufferAsDirty();
+}
+
 void Points::UpdateForSimulationParameters(SimulationParameters const & simulationParameters)
 {
     //
@@ -701,6 +951,9 @@ void Points::UpdateForSimulationParameters(SimulationParameters const & simulati
                 mPinningCoefficientBuffer[i]);
         }
 
+        // Integration factors follow
+        MarkAllMassesAsDirty();
+
         // Remember the new value
         mCurrentNumMechanicalDynamicsIterations = numMechanicalDynamicsIterations;
     }
@@ -745,12 +998,9 @@ void Points::UpdateForSimulationParameters(SimulationParameters const & simulati
     if (cumulatedIntakenWaterThresholdForAirBubbles != mCurrentCumulatedIntakenWaterThresholdForAirBubbles)
     {
         // Randomize cumulated water intaken for each leaking point
-        for (ElementIndex i : RawShipPoints())
+        for (ElementIndex i : GetLeakingPoints())
         {
-            if (GetLeakingComposite(i).IsCumulativelyLeaking)
-            {
-                mCumulatedIntakenWater[i] = RandomizeCumulatedIntakenWater(cumulatedIntakenWaterThresholdForAirBubbles);
-            }
+            mCumulatedIntakenWater[i] = RandomizeCumulatedIntakenWater(cumulatedIntakenWaterThresholdForAirBubbles);
         }
 
         // Remember the new value
@@ -766,6 +1016,22 @@ void Points::UpdateForSimulationParameters(SimulationParameters const & simulati
         // Remember the new value
         mCurrentCombustionSpeedAdjustment = combustionSpeedAdjustment;
     }
+
+    float const ignitionTemperatureAdjustment = simulationParameters.IgnitionTemperatureAdjustment;
+    if (ignitionTemperatureAdjustment != mCurrentIgnitionTemperatureAdjustment)
+    {
+        // Remember the new value first, as the candidate temperatures depend on it
+        mCurrentIgnitionTemperatureAdjustment = ignitionTemperatureAdjustment;
+
+        // Recalc combustion candidate temperatures
+        for (ElementIndex i : RawShipPoints())
+        {
+            mCombustionCandidateTemperatureBuffer[i] = CalculateCombustionCandidateTemperature(i);
+
+            // Points might have become candidates now
+            OnTemperatureChanged(i);
+        }
+    }
 }
 
 void Points::UpdateCombustionLowFrequency(
@@ -795,13 +1061,50 @@ void Points::UpdateCombustionLowFrequency(
     float const rainExtinguishCdf = FastPow(stormParameters.RainDensity / 2.0f, 3.3f);
 
     //
-    // Visit all points
+    // Gather the points of this stride that may transition: those that are hot enough
+    // to ignite, those that are burning, and those that may react with water; all
+    // other points would be no-ops below, hence the cost of this pass scales with
+    // the number of points that are hot (or reactive) rather than with the size of the ship.
     //
     // No real reason not to do ephemeral points as well, other than they're
     // currently not expected to burn
     //
 
-    for (ElementIndex pointIndex = pointOffset; pointIndex < mRawShipPointCount; pointIndex += pointStride)
+    mCombustionLowFrequencyPoints.clear();
+
+    auto const gatherPoint = [&](ElementIndex pointIndex)
+    {
+        if (pointIndex % pointStride == pointOffset)
+        {
+            mCombustionLowFrequencyPoints.push_back(pointIndex);
+        }
+    };
+
+    for (ElementIndex const pointIndex : mCombustionCandidatePoints)
+    {
+        gatherPoint(pointIndex);
+    }
+
+    for (ElementIndex const pointIndex : mBurningPoints)
+    {
+        if (mCombustionStateBuffer[pointIndex].State == CombustionState::StateType::Burning)
+        {
+            gatherPoint(pointIndex);
+        }
+    }
+
+    for (ElementIndex const pointIndex : mWaterReactivePoints)
+    {
+        gatherPoint(pointIndex);
+    }
+
+    // Visit in index order, as a full visit would
+    std::sort(mCombustionLowFrequencyPoints.begin(), mCombustionLowFrequencyPoints.end());
+    mCombustionLowFrequencyPoints.erase(
+        std::unique(mCombustionLowFrequencyPoints.begin(), mCombustionLowFrequencyPoints.end()),
+        mCombustionLowFrequencyPoints.end());
+
+    for (ElementIndex const pointIndex : mCombustionLowFrequencyPoints)
     {
         //
         // Combustion
@@ -994,7 +1297,7 @@ void Points::UpdateCombustionLowFrequency(
                 static_cast<float>(mConnectedSpringsBuffer[pointIndex].ConnectedSprings.size())
                 * 0.0625f; // 0.0625 -> 0.50 (@8)
             mCombustionStateBuffer[pointIndex].MaxFlameDevelopment = std::max(
-                0.25f + deltaSizeDueToConnectedSprings + 0.5f * mRandomNormalizedUniformFloatBuffer[pointIndex], // 0.25 + dsdtcs -> 0.75 + dsdtcs
+                0.25f + deltaSizeDueToConnectedSprings + 0.5f * GetRandomNormalizedUniformPersonalitySeed(pointIndex), // 0.25 + dsdtcs -> 0.75 + dsdtcs
                 mCombustionStateBuffer[pointIndex].FlameDevelopment);
 
             // Initialize flame vector
@@ -1458,15 +1761,30 @@ void Points::UpdateCombustionHighFrequency(
 
 void Points::ReorderBurningPointsForDepth()
 {
-    std::sort(
-        mBurningPoints.begin(),
-        mBurningPoints.end(),
-        [this](auto p1, auto p2)
+    auto const isBehind = [this](ElementIndex p1, ElementIndex p2)
+    {
+        // Sort by plane and then by vertical position, so bottommost flames cover uppermost ones
+        return mPlaneIdBuffer[p1] < mPlaneIdBuffer[p2]
+            || (mPlaneIdBuffer[p1] == mPlaneIdBuffer[p2] && mPositionBuffer[p1].y > mPositionBuffer[p2].y);
+    };
+
+    //
+    // Burning points are kept sorted as they ignite, and only few of them change
+    // between reorders; an insertion sort is thus linear in practice
+    //
+
+    for (size_t i = 1; i < mBurningPoints.size(); ++i)
+    {
+        ElementIndex const pointIndex = mBurningPoints[i];
+
+        size_t j = i;
+        for (; j > 0 && isBehind(pointIndex, mBurningPoints[j - 1]); --j)
         {
-            // Sort by plane and then by vertical position, so bottommost flames cover uppermost ones
-            return mPlaneIdBuffer[p1] < mPlaneIdBuffer[p2]
-                || (mPlaneIdBuffer[p1] == mPlaneIdBuffer[p2] && mPositionBuffer[p1].y > mPositionBuffer[p2].y);
-        });
+            mBurningPoints[j] = mBurningPoints[j - 1];
+        }
+
+        mBurningPoints[j] = pointIndex;
+    }
 }
 
 void Points::UpdateEphemeralParticles(
@@ -1483,210 +1801,219 @@ void Points::UpdateEphemeralParticles(
         (simulationParameters.DoDisplaceWater ? 1.0f : 0.0f)
         * 1.0f;
 
-    // Visit all ephemeral particles
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    //
+    // Sort live ephemeral particles by type, so that each type runs in its own
+    // tight loop; free slots are skipped 64 at a time
+    //
+
+    for (auto & particles : mLiveEphemeralParticlesByType)
     {
-        auto const ephemeralType = GetEphemeralType(pointIndex);
-        if (EphemeralType::None != ephemeralType)
+        particles.clear();
+    }
+
+    VisitLiveEphemeralParticles(
+        [this](ElementIndex pointIndex)
         {
-            //
-            // Run this particle's state machine
-            //
+            auto const ephemeralType = GetEphemeralType(pointIndex);
+            assert(EphemeralType::None != ephemeralType);
+
+            mLiveEphemeralParticlesByType[static_cast<size_t>(ephemeralType)].push_back(pointIndex);
+        });
+
+    //
+    // Air bubbles
+    //
 
-            switch (ephemeralType)
+    for (ElementIndex const pointIndex : mLiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::AirBubble)])
+    {
+        // Do not advance air bubble if it's pinned
+        if (!IsPinned(pointIndex))
+        {
+            float const depth = GetCachedDepth(pointIndex);
+            if (depth <= 0.0f)
             {
-                case EphemeralType::AirBubble:
-                {
-                    // Do not advance air bubble if it's pinned
-                    if (!IsPinned(pointIndex))
-                    {
-                        float const depth = GetCachedDepth(pointIndex);
-                        if (depth <= 0.0f)
-                        {
-                            // Got to the surface, expire
-                            ExpireEphemeralParticle(pointIndex);
-                        }
-                        else
-                        {
-                            //
-                            // Update state
-                            //
-
-                            auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                            // DeltaY
-
-                            state.CurrentDeltaY = depth;
-
-                            // Simulation lifetime
-
-                            auto const simulationLifetime =
-                                currentSimulationTime
-                                - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-
-                            state.SimulationLifetime = simulationLifetime;
-
-                            //
-                            // Update vortex
-                            //
-
-                            float const vortexValue =
-                                state.VortexAmplitude
-                                * PrecalcLoFreqSin.GetNearestPeriodic(
-                                    state.NormalizedVortexAngularVelocity * simulationLifetime);
-
-                            // Apply vortex to bubble
-                            AddStaticForce(
-                                pointIndex,
-                                vec2f(
-                                    vortexValue,
-                                    0.0f));
-
-                            //
-                            // Displace ocean surface, if surfacing
-                            //
-
-                            if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
-                            {
-                                mParentWorld.DisplaceOceanSurfaceAt(
-                                    GetPosition(pointIndex).x,
-                                    // Magnitude is lower with depth and higher with scale
-                                    (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
-
-                                mSimulationEventHandler.OnAirBubbleSurfaced(1);
-                            }
-                        }
-                    }
+                // Got to the surface, expire
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                //
+                // Update state
+                //
 
-                    break;
-                }
+                auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                case EphemeralType::Debris:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(pointIndex);
+                // DeltaY
 
-                        // Remember that ephemeral point elements are now dirty
-                        mAreEphemeralPointElementsDirtyForRendering = true;
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
+                state.CurrentDeltaY = depth;
 
-                        float alpha = std::max(
-                            1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
-                            0.0f);
+                // Simulation lifetime
 
-                        mColorBuffer[pointIndex].w = alpha;
-                        mIsEphemeralColorBufferDirty = true;
-                    }
+                auto const simulationLifetime =
+                    currentSimulationTime
+                    - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
 
-                    break;
-                }
+                state.SimulationLifetime = simulationLifetime;
 
-                case EphemeralType::Smoke:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        //
-                        /// Expired
-                        //
+                //
+                // Update vortex
+                //
 
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
-                        if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
-                        {
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                std::min(1.0f, elapsedSimulationLifetime / 5.0f);
-                        }
-                        else
-                        {
-                            assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
-                        }
-
-                        // Inject random walk in direction orthogonal to current velocity
-                        float const randomWalkMagnitude =
-                            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
-                        vec2f const deviationDirection =
-                            GetVelocity(pointIndex).normalise().to_perpendicular();
-                        AddStaticForce(
-                            pointIndex,
-                            deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
-                    }
+                float const vortexValue =
+                    state.VortexAmplitude
+                    * PrecalcLoFreqSin.GetNearestPeriodic(
+                        state.NormalizedVortexAngularVelocity * simulationLifetime);
 
-                    break;
-                }
+                // Apply vortex to bubble
+                AddStaticForce(
+                    pointIndex,
+                    vec2f(
+                        vortexValue,
+                        0.0f));
 
-                case EphemeralType::Sparkle:
+                //
+                // Displace ocean surface, if surfacing
+                //
+
+                if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
                 {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+                    mParentWorld.DisplaceOceanSurfaceAt(
+                        GetPosition(pointIndex).x,
+                        // Magnitude is lower with depth and higher with scale
+                        (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
 
-                    break;
+                    mSimulationEventHandler.OnAirBubbleSurfaced(1);
                 }
+            }
+        }
+    }
 
-                case EphemeralType::WakeBubble:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || !IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+    //
+    // Debris
+    //
 
-                    break;
-                }
+    for (ElementIndex const pointIndex : mLiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Debris)])
+    {
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime)
+        {
+            ExpireEphemeralParticle(pointIndex);
 
-                default:
-                {
-                    // Do nothing
-                }
+            // Remember that ephemeral point elements are now dirty
+            mAreEphemeralPointElementsDirtyForRendering = true;
+        }
+        else
+        {
+            // Update alpha based off remaining time
+
+            float alpha = std::max(
+                1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
+                0.0f);
+
+            mColorBuffer[pointIndex].w = alpha;
+            mColorBufferDirtyIntervals.Add(pointIndex);
+        }
+    }
+
+    //
+    // Smoke
+    //
+
+    for (ElementIndex const pointIndex : mLiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Smoke)])
+    {
+        // Calculate progress
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+        assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
+        float const lifetimeProgress =
+            elapsedSimulationLifetime
+            / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+
+        // Check if expired
+        if (lifetimeProgress >= 1.0f
+            || IsCachedUnderwater(pointIndex))
+        {
+            //
+            /// Expired
+            //
+
+            ExpireEphemeralParticle(pointIndex);
+        }
+        else
+        {
+            //
+            // Still alive
+            //
+
+            // Update progress
+            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
+            if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
+            {
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                    std::min(1.0f, elapsedSimulationLifetime / 5.0f);
             }
+            else
+            {
+                assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                    1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
+            }
+
+            // Inject random walk in direction orthogonal to current velocity
+            float const randomWalkMagnitude =
+                0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
+            vec2f const deviationDirection =
+                GetVelocity(pointIndex).normalise().to_perpendicular();
+            AddStaticForce(
+                pointIndex,
+                deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
+        }
+    }
+
+    //
+    // Sparkles
+    //
+
+    for (ElementIndex const pointIndex : mLiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Sparkle)])
+    {
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime
+            || IsCachedUnderwater(pointIndex))
+        {
+            ExpireEphemeralParticle(pointIndex);
+        }
+        else
+        {
+            // Update progress based off remaining time
+            assert(maxSimulationLifetime > 0.0f);
+            mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
+                elapsedSimulationLifetime / maxSimulationLifetime;
+        }
+    }
+
+    //
+    // Wake bubbles
+    //
+
+    for (ElementIndex const pointIndex : mLiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WakeBubble)])
+    {
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime
+            || !IsCachedUnderwater(pointIndex))
+        {
+            ExpireEphemeralParticle(pointIndex);
+        }
+        else
+        {
+            // Update progress based off remaining time
+            assert(maxSimulationLifetime > 0.0f);
+            mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
+                elapsedSimulationLifetime / maxSimulationLifetime;
         }
     }
 }
@@ -1745,6 +2072,24 @@ void Points::UpdateHighlights(GameWallClock::float_time currentWallClockTime)
     }
 }
 
+Geometry::AABB Points::CalculateAABB() const
+{
+    // Vectorized over the whole vectorization words of raw ship points, as
+    // the padding points after them are not part of the ship
+    ElementCount const vectorizedCount = (mRawShipPointCount / vectorization_float_count<ElementCount>) * vectorization_float_count<ElementCount>;
+
+    vec2f const * restrict const positionBuffer = mPositionBuffer.data();
+
+    Geometry::AABB box = Algorithms::MakePointsAABB(0, vectorizedCount, positionBuffer);
+
+    for (ElementIndex pointIndex = vectorizedCount; pointIndex < mRawShipPointCount; ++pointIndex)
+    {
+        box.ExtendTo(positionBuffer[pointIndex]);
+    }
+
+    return box;
+}
+
 void Points::Query(ElementIndex pointElementIndex) const
 {
     LogMessage("PointIndex: ", pointElementIndex, (nullptr != mMaterialsBuffer[pointElementIndex].Structural) ? (" (" + mMaterialsBuffer[pointElementIndex].Structural->Name) + ")" : "");
@@ -1753,17 +2098,100 @@ void Points::Query(ElementIndex pointElementIndex) const
     LogMessage("PlaneID: ", mPlaneIdBuffer[pointElementIndex], " ConnectedComponentID: ", mConnectedComponentIdBuffer[pointElementIndex]);
 }
 
+void Points::ReportMemory(MemoryReport & report) const
+{
+    for (size_t t = 0; t < mDynamicForceBuffers.size(); ++t)
+    {
+        report.Add("Points", "DynamicForce" + std::to_string(t), mDynamicForceBuffers[t]);
+    }
+
+    report.Add("Points", "IsDamaged", mIsDamagedBuffer);
+    report.Add("Points", "Materials", mMaterialsBuffer);
+    report.Add("Points", "IsRope", mIsRopeBuffer);
+    report.Add("Points", "Position", mPositionBuffer);
+    report.Add("Points", "FactoryPosition", mFactoryPositionBuffer);
+    report.Add("Points", "Velocity", mVelocityBuffer);
+    report.Add("Points", "StaticForce", mStaticForceBuffer);
+    report.Add("Points", "AugmentedMaterialMass", mAugmentedMaterialMassBuffer);
+    report.Add("Points", "TransientAdditionalMass", mTransientAdditionalMassBuffer);
+    report.Add("Points", "Mass", mMassBuffer);
+    report.Add("Points", "MaterialBuoyancyVolumeFill", mMaterialBuoyancyVolumeFillBuffer);
+    report.Add("Points", "Strength", mStrengthBuffer);
+    report.Add("Points", "Stress", mStressBuffer);
+    report.Add("Points", "Decay", mDecayBuffer);
+    report.Add("Points", "PinningCoefficient", mPinningCoefficientBuffer);
+    report.Add("Points", "IntegrationFactorTimeCoefficient", mIntegrationFactorTimeCoefficientBuffer);
+    report.Add("Points", "OceanFloorCollisionFactors", mOceanFloorCollisionFactorsBuffer);
+    report.Add("Points", "AirWaterInterfaceInverseWidth", mAirWaterInterfaceInverseWidthBuffer);
+    report.Add("Points", "BuoyancyCoefficients", mBuoyancyCoefficientsBuffer);
+    report.Add("Points", "CachedDepth", mCachedDepthBuffer);
+    report.Add("Points", "IntegrationFactor", mIntegrationFactorBuffer);
+    report.Add("Points", "IsHull", mIsHullBuffer);
+    report.Add("Points", "InternalPressure", mInternalPressureBuffer);
+    report.Add("Points", "MaterialWaterIntake", mMaterialWaterIntakeBuffer);
+    report.Add("Points", "MaterialWaterRestitution", mMaterialWaterRestitutionBuffer);
+    report.Add("Points", "MaterialWaterDiffusionSpeed", mMaterialWaterDiffusionSpeedBuffer);
+    report.Add("Points", "Water", mWaterBuffer);
+    report.Add("Points", "WaterVelocity", mWaterVelocityBuffer);
+    report.Add("Points", "WaterMomentum", mWaterMomentumBuffer);
+    report.Add("Points", "CumulatedIntakenWater", mCumulatedIntakenWater);
+    report.Add("Points", "LeakingComposite", mLeakingCompositeBuffer);
+    report.Add("Points", "FactoryIsStructurallyLeaking", mFactoryIsStructurallyLeakingBuffer);
+    report.Add("Points", "Temperature", mTemperatureBuffer);
+    report.Add("Points", "MaterialHeatCapacityReciprocal", mMaterialHeatCapacityReciprocalBuffer);
+    report.Add("Points", "MaterialThermalExpansionCoefficient", mMaterialThermalExpansionCoefficientBuffer);
+    report.Add("Points", "MaterialIgnitionTemperature", mMaterialIgnitionTemperatureBuffer);
+    report.Add("Points", "CombustionCandidateTemperature", mCombustionCandidateTemperatureBuffer);
+    report.Add("Points", "MaterialCombustionType", mMaterialCombustionTypeBuffer);
+    report.Add("Points", "CombustionState", mCombustionStateBuffer);
+    report.Add("Points", "WaterReactionState", mWaterReactionStateBuffer);
+    report.Add("Points", "ElectricalElement", mElectricalElementBuffer);
+    report.Add("Points", "Light", mLightBuffer);
+    report.Add("Points", "MaterialWindReceptivity", mMaterialWindReceptivityBuffer);
+    report.Add("Points", "MaterialRustReceptivity", mMaterialRustReceptivityBuffer);
+    report.Add("Points", "RustablePoints", mRustablePoints);
+    report.Add("Points", "IsElectrified", mIsElectrifiedBuffer);
+    report.Add("Points", "EphemeralParticleAttributes1", mEphemeralParticleAttributes1Buffer);
+    report.Add("Points", "EphemeralParticleAttributes2", mEphemeralParticleAttributes2Buffer);
+    report.Add("Points", "ConnectedSprings", mConnectedSpringsBuffer);
+    report.Add("Points", "FactoryConnectedSprings", mFactoryConnectedSpringsBuffer);
+    report.Add("Points", "ConnectedTriangles", mConnectedTrianglesBuffer);
+    report.Add("Points", "FactoryConnectedTriangles", mFactoryConnectedTrianglesBuffer);
+    report.Add("Points", "ConnectedComponentId", mConnectedComponentIdBuffer);
+    report.Add("Points", "PlaneId", mPlaneIdBuffer);
+    report.Add("Points", "PlaneIdFloat", mPlaneIdFloatBuffer);
+    report.Add("Points", "CurrentConnectivityVisitSequenceNumber", mCurrentConnectivityVisitSequenceNumberBuffer);
+    report.Add("Points", "RepairState", mRepairStateBuffer);
+    report.Add("Points", "ElectricalElementHighlightedPoints", mElectricalElementHighlightedPoints);
+    report.Add("Points", "CircleHighlightedPoints", mCircleHighlightedPoints);
+    report.Add("Points", "IsGadgetAttached", mIsGadgetAttachedBuffer);
+    report.Add("Points", "RandomNormalizedUniformFloat", mRandomNormalizedUniformFloatBuffer);
+    report.Add("Points", "Color", mColorBuffer);
+    report.Add("Points", "TextureCoordinates", mTextureCoordinatesBuffer);
+    report.Add("Points", "PreviousPosition", mPreviousPositionBuffer);
+    report.Add("Points", "InterpolatedPosition", mInterpolatedPositionBuffer);
+    report.Add("Points", "LeakingPoints", mLeakingPoints);
+    report.Add("Points", "CombustionCandidatePoints", mCombustionCandidatePoints);
+    report.Add("Points", "WaterReactivePoints", mWaterReactivePoints);
+    report.Add("Points", "CombustionLowFrequencyPoints", mCombustionLowFrequencyPoints);
+    report.Add("Points", "BurningPoints", mBurningPoints);
+    report.Add("Points", "StoppedBurningPoints", mStoppedBurningPoints);
+    report.Add("Points", "FreeEphemeralParticles", mFreeEphemeralParticles);
+    report.Add("Points", "LiveEphemeralParticleMask", mLiveEphemeralParticleMask);
+}
+
 void Points::ColorPointForDebugging(
     ElementIndex pointIndex,
     rgbaColor const & color)
 {
     mColorBuffer[pointIndex] = color.toVec4f();
-    mIsWholeColorBufferDirty = true;
+    mColorBufferDirtyIntervals.Add(pointIndex);
 }
 
 void Points::UploadAttributes(
     ShipId shipId,
-    RenderContext & renderContext) const
+    RenderContext & renderContext,
+    float renderInterpolationFactor) const
 {
     auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
 
@@ -1775,38 +2203,58 @@ void Points::UploadAttributes(
         mIsTextureCoordinatesBufferDirty = false;
     }
 
-    // Upload colors, if dirty
-    if (mIsWholeColorBufferDirty)
+    // Upload colors: whole buffer the first time, and then only the
+    // portions that are dirty
+    if (!mHaveWholeBuffersBeenUploadedOnce)
     {
         renderContext.UploadShipPointColorsAsync(
             shipId,
             mColorBuffer.data(),
             0,
             mAllPointCount);
-
-        mIsWholeColorBufferDirty = false;
-        mIsEphemeralColorBufferDirty = false;
     }
-    else if (mIsEphemeralColorBufferDirty)
+    else
     {
-        // Only upload ephemeral particle portion
-        renderContext.UploadShipPointColorsAsync(
-            shipId,
-            &(mColorBuffer.data()[mAlignedShipPointCount]),
-            mAlignedShipPointCount,
-            mEphemeralPointCount);
-
-        mIsEphemeralColorBufferDirty = false;
+        for (auto const & interval : mColorBufferDirtyIntervals.Coalesce())
+        {
+            renderContext.UploadShipPointColorsAsync(
+                shipId,
+                &(mColorBuffer.data()[interval.Start]),
+                interval.Start,
+                interval.GetSize());
+        }
     }
 
+    mColorBufferDirtyIntervals.Clear();
+
     //
     // Upload mutable attributes
     //
 
     shipRenderContext.UploadPointMutableAttributesStart();
 
+    vec2f const * renderPositions = mPositionBuffer.data();
+    if (renderInterpolationFactor < 1.0f && !mPreviousPositionBuffer.empty())
+    {
+        assert(mPreviousPositionBuffer.size() == mBufferElementCount);
+
+        mInterpolatedPositionBuffer.resize(mBufferElementCount);
+
+        vec2f const * const restrict previousPositions = mPreviousPositionBuffer.data();
+        vec2f const * const restrict currentPositions = mPositionBuffer.data();
+        vec2f * const restrict interpolatedPositions = mInterpolatedPositionBuffer.data();
+        for (size_t p = 0; p < mBufferElementCount; ++p)
+        {
+            interpolatedPositions[p] =
+                previousPositions[p]
+                + (currentPositions[p] - previousPositions[p]) * renderInterpolationFactor;
+        }
+
+        renderPositions = interpolatedPositions;
+    }
+
     shipRenderContext.UploadPointMutableAttributes(
-        mPositionBuffer.data(),
+        renderPositions,
         mLightBuffer.data(),
         mWaterBuffer.data());
 
@@ -1853,16 +2301,26 @@ void Points::UploadAttributes(
     // not for the ephemeral ones
     size_t const partialPointCount = mHaveWholeBuffersBeenUploadedOnce ? mRawShipPointCount : mAllPointCount;
 
-    if (mIsDecayBufferDirty)
+    if (!mHaveWholeBuffersBeenUploadedOnce)
     {
         shipRenderContext.UploadPointMutableAttributesDecay(
             mDecayBuffer.data(),
             0,
-            partialPointCount);
-
-        mIsDecayBufferDirty = false;
+            mAllPointCount);
+    }
+    else
+    {
+        for (auto const & interval : mDecayBufferDirtyIntervals.Coalesce())
+        {
+            shipRenderContext.UploadPointMutableAttributesDecay(
+                &(mDecayBuffer.data()[interval.Start]),
+                interval.Start,
+                interval.GetSize());
+        }
     }
 
+    mDecayBufferDirtyIntervals.Clear();
+
     if (renderContext.GetHeatRenderMode() != HeatRenderModeType::None)
     {
         renderContext.UploadShipPointTemperatureAsync(
@@ -1891,9 +2349,17 @@ void Points::UploadAttributes(
     }
     else if (renderContext.GetDebugShipRenderMode() == DebugShipRenderModeType::Strength)
     {
+        // Strength is stored in half-precision; this is only a debug render mode, hence
+        // we don't bother pooling the conversion buffer
+        std::vector<float> strengthBuffer(partialPointCount);
+        for (size_t p = 0; p < partialPointCount; ++p)
+        {
+            strengthBuffer[p] = mStrengthBuffer[p].ToFloat();
+        }
+
         renderContext.UploadShipPointAuxiliaryDataAsync(
             shipId,
-            mStrengthBuffer.data(),
+            strengthBuffer.data(),
             0,
             partialPointCount);
     }
@@ -1944,7 +2410,7 @@ void Points::UploadFlames(ShipRenderContext & shipRenderContext) const
                 mCombustionStateBuffer[pointIndex].FlameVector,
                 mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
                 mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
-                mRandomNormalizedUniformFloatBuffer[pointIndex]);
+                GetRandomNormalizedUniformPersonalitySeed(pointIndex));
         }
     }
 
@@ -1959,7 +2425,7 @@ void Points::UploadFlames(ShipRenderContext & shipRenderContext) const
                 mCombustionStateBuffer[pointIndex].FlameVector,
                 mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
                 mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
-                mRandomNormalizedUniformFloatBuffer[pointIndex]);
+                GetRandomNormalizedUniformPersonalitySeed(pointIndex));
         }
     }
 }
@@ -2031,26 +2497,22 @@ void Points::UploadVectors(
 
     shipRenderContext.UploadVectorsStart(mElementCount, color);
 
-    for (auto const p : this->RawShipPoints())
-    {
-        shipRenderContext.UploadVector(
-            GetPosition(p),
-            mPlaneIdFloatBuffer[p],
-            vectorBuffer[p],
-            lengthAdjustment);
-    }
+    shipRenderContext.UploadVectors(
+        mRawShipPointCount,
+        mPositionBuffer.data(),
+        mPlaneIdFloatBuffer.data(),
+        vectorBuffer,
+        lengthAdjustment);
 
-    for (auto const p : this->EphemeralPoints())
-    {
-        if (GetEphemeralType(p) != EphemeralType::None)
+    VisitLiveEphemeralParticles(
+        [&](ElementIndex p)
         {
             shipRenderContext.UploadVector(
                 GetPosition(p),
                 mPlaneIdFloatBuffer[p],
                 vectorBuffer[p],
                 lengthAdjustment);
-        }
-    }
+        });
 
     shipRenderContext.UploadVectorsEnd();
 }
@@ -2070,100 +2532,101 @@ void Points::UploadEphemeralParticles(
         shipRenderContext.UploadElementEphemeralPointsStart();
     }
 
-    for (ElementIndex pointIndex : this->EphemeralPoints())
-    {
-        switch (GetEphemeralType(pointIndex))
+    VisitLiveEphemeralParticles(
+        [&](ElementIndex pointIndex)
         {
-            case EphemeralType::AirBubble:
+            switch (GetEphemeralType(pointIndex))
             {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                // Calculate scale based on lifetime
-                float const scaleMax = state.FinalScale;
-                float const scaleMin = state.FinalScale / 5.0f;
-                float const scale =
-                    scaleMin + (scaleMax - scaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
+                case EphemeralType::AirBubble:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                shipRenderContext.UploadAirBubble(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    scale,
-                    std::min(0.6f, state.CurrentDeltaY), // Alpha
-                    state.SimulationLifetime * Pi<float> * 2.0f); // Angle
+                    // Calculate scale based on lifetime
+                    float const scaleMax = state.FinalScale;
+                    float const scaleMin = state.FinalScale / 5.0f;
+                    float const scale =
+                        scaleMin + (scaleMax - scaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
 
-                break;
-            }
+                    shipRenderContext.UploadAirBubble(
+                        GetPlaneId(pointIndex),
+                        GetPosition(pointIndex),
+                        scale,
+                        std::min(0.6f, state.CurrentDeltaY), // Alpha
+                        state.SimulationLifetime * Pi<float> * 2.0f); // Angle
 
-            case EphemeralType::Debris:
-            {
-                // Don't upload point unless there's been a change
-                if (mAreEphemeralPointElementsDirtyForRendering)
-                {
-                    shipRenderContext.UploadElementEphemeralPoint(pointIndex);
+                    break;
                 }
 
-                break;
-            }
-
-            case EphemeralType::Smoke:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
-
-                // Calculate scale
-                float const scale = state.ScaleProgress;
+                case EphemeralType::Debris:
+                {
+                    // Don't upload point unless there's been a change
+                    if (mAreEphemeralPointElementsDirtyForRendering)
+                    {
+                        shipRenderContext.UploadElementEphemeralPoint(pointIndex);
+                    }
 
-                // Calculate alpha
-                float const lifetimeProgress = state.LifetimeProgress;
-                float const alpha =
-                    SmoothStep(0.0f, 0.05f, lifetimeProgress)
-                    - SmoothStep(0.7f, 1.0f, lifetimeProgress);
+                    break;
+                }
 
-                // Upload smoke
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    state.PersonalitySeed,
-                    state.TextureGroup,
-                    GetPosition(pointIndex),
-                    scale,
-                    alpha);
+                case EphemeralType::Smoke:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
+
+                    // Calculate scale
+                    float const scale = state.ScaleProgress;
+
+                    // Calculate alpha
+                    float const lifetimeProgress = state.LifetimeProgress;
+                    float const alpha =
+                        SmoothStep(0.0f, 0.05f, lifetimeProgress)
+                        - SmoothStep(0.7f, 1.0f, lifetimeProgress);
+
+                    // Upload smoke
+                    shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                        GetPlaneId(pointIndex),
+                        state.PersonalitySeed,
+                        state.TextureGroup,
+                        GetPosition(pointIndex),
+                        scale,
+                        alpha);
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::Sparkle:
-            {
-                shipRenderContext.UploadSparkle(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    GetVelocity(pointIndex),
-                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
+                case EphemeralType::Sparkle:
+                {
+                    shipRenderContext.UploadSparkle(
+                        GetPlaneId(pointIndex),
+                        GetPosition(pointIndex),
+                        GetVelocity(pointIndex),
+                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::WakeBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
+                case EphemeralType::WakeBubble:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
 
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    TextureFrameId(GameTextureDatabases::GenericMipMappedTextureGroups::EngineWake, 0),
-                    GetPosition(pointIndex),
-                    0.10f + 1.22f * state.Progress, // Scale, magic formula
-                    mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
-                    1.0f - state.Progress); // Alpha
+                    shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                        GetPlaneId(pointIndex),
+                        TextureFrameId(GameTextureDatabases::GenericMipMappedTextureGroups::EngineWake, 0),
+                        GetPosition(pointIndex),
+                        0.10f + 1.22f * state.Progress, // Scale, magic formula
+                        GetRandomNormalizedUniformPersonalitySeed(pointIndex) * 2.0f * Pi<float>, // Angle
+                        1.0f - state.Progress); // Alpha
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::None:
-            default:
-            {
-                // Ignore
-                break;
+                case EphemeralType::None:
+                default:
+                {
+                    // Ignore
+                    break;
+                }
             }
-        }
-    }
+        });
 
     if (mAreEphemeralPointElementsDirtyForRendering)
     {
@@ -2214,6 +2677,8 @@ void Points::AugmentMaterialMass(
         GetStructuralMaterial(pointElementIndex).GetMass()
         + offset;
 
+    MarkMassAsDirty(pointElementIndex);
+
     // Notify all connected springs
     for (auto connectedSpring : mConnectedSpringsBuffer[pointElementIndex].ConnectedSprings)
     {
@@ -2230,6 +2695,12 @@ void Points::UpdateMasses(SimulationParameters const & simulationParameters)
     //
 
     float const densityAdjustedWaterMass = Formulae::CalculateWaterDensity(simulationParameters.WaterTemperature, simulationParameters);
+    if (densityAdjustedWaterMass != mCurrentDensityAdjustedWaterMass)
+    {
+        MarkAllMassesAsDirty();
+
+        mCurrentDensityAdjustedWaterMass = densityAdjustedWaterMass;
+    }
 
     float const * restrict const augmentedMaterialMassBuffer = mAugmentedMaterialMassBuffer.data();
     float const * restrict const transientAdditionalMassBuffer = mTransientAdditionalMassBuffer.data();
@@ -2239,25 +2710,81 @@ void Points::UpdateMasses(SimulationParameters const & simulationParameters)
     float const * restrict const integrationFactorTimeCoefficientBuffer = mIntegrationFactorTimeCoefficientBuffer.data();
     float * restrict const integrationFactorBuffer = reinterpret_cast<float *>(mIntegrationFactorBuffer.data());
 
-    size_t const count = GetBufferElementCount();
-    for (size_t i = 0; i < count; ++i)
+    if (mAreAllMassesDirty)
+    {
+        //
+        // Visit all points
+        //
+
+        size_t const count = GetBufferElementCount();
+        for (size_t i = 0; i < count; ++i)
+        {
+            // The mass we want
+            float const targetMass =
+                augmentedMaterialMassBuffer[i]
+                + transientAdditionalMassBuffer[i]
+                + std::min(waterBuffer[i], materialBuoyancyVolumeFillBuffer[i]) * densityAdjustedWaterMass;
+
+            // The mass we get: current mass slowly converging towards the mass we want
+            // (nature abhors discontinuities)
+            float const newMass = massBuffer[i] + (targetMass - massBuffer[i]) * 0.12f;
+
+            assert(newMass > 0.0f);
+
+            massBuffer[i] = newMass;
+
+            integrationFactorBuffer[i * 2] = integrationFactorTimeCoefficientBuffer[i] / newMass;
+            integrationFactorBuffer[i * 2 + 1] = integrationFactorTimeCoefficientBuffer[i] / newMass;
+        }
+
+        // All of them might still be converging; the next update prunes those that are not
+        mMassDirtyPoints.resize(count);
+        std::iota(mMassDirtyPoints.begin(), mMassDirtyPoints.end(), ElementIndex(0));
+        mIsMassDirtyBuffer.fill(true);
+
+        mAreAllMassesDirty = false;
+    }
+    else
     {
-        // The mass we want
-        float const targetMass =
-            augmentedMaterialMassBuffer[i]
-            + transientAdditionalMassBuffer[i]
-            + std::min(waterBuffer[i], materialBuoyancyVolumeFillBuffer[i]) * densityAdjustedWaterMass;
+        //
+        // Visit dirty points only, keeping those whose mass has not converged yet;
+        // once a mass doesn't change anymore, it won't until its inputs do
+        //
+
+        size_t remainingCount = 0;
+        for (size_t d = 0; d < mMassDirtyPoints.size(); ++d)
+        {
+            ElementIndex const i = mMassDirtyPoints[d];
+
+            // The mass we want
+            float const targetMass =
+                augmentedMaterialMassBuffer[i]
+                + transientAdditionalMassBuffer[i]
+                + std::min(waterBuffer[i], materialBuoyancyVolumeFillBuffer[i]) * densityAdjustedWaterMass;
+
+            // The mass we get: current mass slowly converging towards the mass we want
+            // (nature abhors discontinuities)
+            float const oldMass = massBuffer[i];
+            float const newMass = oldMass + (targetMass - oldMass) * 0.12f;
 
-        // The mass we get: current mass slowly converging towards the mass we want
-        // (nature abhors discontinuities)
-        float const newMass = massBuffer[i] + (targetMass - massBuffer[i]) * 0.12f;
+            assert(newMass > 0.0f);
 
-        assert(newMass > 0.0f);
+            massBuffer[i] = newMass;
 
-        massBuffer[i] = newMass;
+            integrationFactorBuffer[i * 2] = integrationFactorTimeCoefficientBuffer[i] / newMass;
+            integrationFactorBuffer[i * 2 + 1] = integrationFactorTimeCoefficientBuffer[i] / newMass;
 
-        integrationFactorBuffer[i * 2] = integrationFactorTimeCoefficientBuffer[i] / newMass;
-        integrationFactorBuffer[i * 2 + 1] = integrationFactorTimeCoefficientBuffer[i] / newMass;
+            if (newMass != oldMass)
+            {
+                mMassDirtyPoints[remainingCount++] = i;
+            }
+            else
+            {
+                mIsMassDirtyBuffer[i] = false;
+            }
+        }
+
+        mMassDirtyPoints.resize(remainingCount);
     }
 }
 
@@ -2316,75 +2843,115 @@ void Points::CalculateCombustionDecayParameters(
     mCombustionDecayAlphaFunctionC = c_num / den;
 }
 
-ElementIndex Points::FindFreeEphemeralParticle(
-    float currentSimulationTime,
-    bool doForce)
+void Points::CompactCombustionCandidatePoints()
 {
-    //
-    // Search for the firt free ephemeral particle; if a free one is not found, reuse the
-    // oldest particle
-    //
-
-    ElementIndex oldestParticle = NoneElementIndex;
-    float oldestParticleLifetime = 0.0f;
+    std::sort(mCombustionCandidatePoints.begin(), mCombustionCandidatePoints.end());
 
-    assert(mFreeEphemeralParticleSearchStartIndex >= mAlignedShipPointCount
-        && mFreeEphemeralParticleSearchStartIndex < mAllPointCount);
+    mCombustionCandidatePoints.erase(
+        std::unique(mCombustionCandidatePoints.begin(), mCombustionCandidatePoints.end()),
+        mCombustionCandidatePoints.end());
+}
 
-    for (ElementIndex p = mFreeEphemeralParticleSearchStartIndex; ; /*incremented in loop*/)
-    {
-        if (EphemeralType::None == mEphemeralParticleAttributes1Buffer[p].Type)
-        {
-            // Found!
+void Points::CompactLeakingPoints()
+{
+    std::sort(mLeakingPoints.begin(), mLeakingPoints.end());
 
-            // Remember to start after this one next time
-            mFreeEphemeralParticleSearchStartIndex = p + 1;
-            if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-                mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
+    mLeakingPoints.erase(
+        std::unique(mLeakingPoints.begin(), mLeakingPoints.end()),
+        mLeakingPoints.end());
 
-            return p;
-        }
+    mLeakingPoints.erase(
+        std::remove_if(
+            mLeakingPoints.begin(),
+            mLeakingPoints.end(),
+            [this](ElementIndex pointIndex)
+            {
+                return !mLeakingCompositeBuffer[pointIndex].IsCumulativelyLeaking;
+            }),
+        mLeakingPoints.end());
 
-        // Check whether it's the oldest
-        auto const lifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[p].StartSimulationTime;
-        if (lifetime >= oldestParticleLifetime)
-        {
-            oldestParticle = p;
-            oldestParticleLifetime = lifetime;
-        }
+    mAreLeakingPointsDirty = false;
+}
 
-        // Advance
-        ++p;
-        if (p >= mAllPointCount)
-            p = mAlignedShipPointCount;
+void Points::RebuildLeakingPoints()
+{
+    mLeakingPoints.clear();
 
-        if (p == mFreeEphemeralParticleSearchStartIndex)
+    for (ElementIndex pointIndex : RawShipPoints())
+    {
+        if (mLeakingCompositeBuffer[pointIndex].IsCumulativelyLeaking)
         {
-            // Went around
-            break;
+            mLeakingPoints.push_back(pointIndex);
         }
     }
 
+    mAreLeakingPointsDirty = false;
+}
+
+ElementIndex Points::FindFreeEphemeralParticle(bool doForce)
+{
     //
-    // No luck
+    // Take a free ephemeral particle; if there are no free ones, steal the oldest
+    // particle
     //
 
-    if (!doForce)
-        return NoneElementIndex;
+    ElementIndex pointIndex;
 
+    if (!mFreeEphemeralParticles.empty())
+    {
+        pointIndex = mFreeEphemeralParticles.back();
+        mFreeEphemeralParticles.pop_back();
+    }
+    else
+    {
+        if (!doForce)
+            return NoneElementIndex;
+
+        // Allocations are in order of age, but some might have
+        // been expired - and maybe re-allocated - in the meantime
+        while (true)
+        {
+            assert(!mEphemeralParticleAllocations.empty());
+
+            auto const allocation = mEphemeralParticleAllocations.front();
+            mEphemeralParticleAllocations.pop_front();
+
+            if (IsEphemeralParticleAllocationCurrent(allocation))
+            {
+                pointIndex = allocation.PointIndex;
+                break;
+            }
+        }
+    }
 
     //
-    // Steal the oldest
+    // Remember allocation
     //
 
-    assert(NoneElementIndex != oldestParticle);
+    // Keep stale allocations bounded; only before adding the new
+    // allocation, which is not current yet
+    if (mEphemeralParticleAllocations.size() >= 2 * mEphemeralPointCount)
+    {
+        mEphemeralParticleAllocations.erase(
+            std::remove_if(
+                mEphemeralParticleAllocations.begin(),
+                mEphemeralParticleAllocations.end(),
+                [this](EphemeralParticleAllocation const & allocation)
+                {
+                    return !IsEphemeralParticleAllocationCurrent(allocation);
+                }),
+            mEphemeralParticleAllocations.end());
+    }
+
+    // Remember the slot is taken
+    ElementIndex const slot = pointIndex - mAlignedShipPointCount;
+    mLiveEphemeralParticleMask[slot / 64] |= std::uint64_t(1) << (slot % 64);
 
-    // Remember to start after this one next time
-    mFreeEphemeralParticleSearchStartIndex = oldestParticle + 1;
-    if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-        mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
+    std::uint32_t const allocationSequenceNumber = mNextEphemeralParticleAllocationSequenceNumber++;
+    mEphemeralParticleAttributes1Buffer[pointIndex].AllocationSequenceNumber = allocationSequenceNumber;
+    mEphemeralParticleAllocations.emplace_back(pointIndex, allocationSequenceNumber);
 
-    return oldestParticle;
+    return pointIndex;
 }
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "../ShipFactoryTypes.h"
 #include "../SimulationEventDispatcher.h"
 #include "../SimulationParameters.h"
 #include "../MaterialDatabase.h"
@@ -16,21 +17,29 @@
 #include <Core/AABB.h>
 #include <Core/Buffer.h>
 #include <Core/BufferAllocator.h>
+#include <Core/DirtyIntervalSet.h>
 #include <Core/ElementContainer.h>
 #include <Core/ElementIndexRangeIterator.h>
 #include <Core/EnumFlags.h>
 #include <Core/FixedSizeVector.h>
+#include <Core/Float16.h>
 #include <Core/GameMath.h>
 #include <Core/GameRandomEngine.h>
 #include <Core/GameTypes.h>
 #include <Core/GameWallClock.h>
+#include <Core/MemoryReport.h>
+#include <Core/Snapshot.h>
 #include <Core/Vectors.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <vector>
 
 namespace Physics
@@ -438,10 +447,29 @@ private:
     {
         EphemeralType Type;
         float StartSimulationTime;
+        std::uint32_t AllocationSequenceNumber;
 
         EphemeralParticleAttributes1()
             : Type(EphemeralType::None)
             , StartSimulationTime(0.0f)
+            , AllocationSequenceNumber(0)
+        {}
+    };
+
+    /*
+     * An allocation of an ephemeral particle slot; it is current as long
+     * as the particle has been neither expired nor re-allocated since.
+     */
+    struct EphemeralParticleAllocation
+    {
+        ElementIndex PointIndex;
+        std::uint32_t SequenceNumber;
+
+        EphemeralParticleAllocation(
+            ElementIndex pointIndex,
+            std::uint32_t sequenceNumber)
+            : PointIndex(pointIndex)
+            , SequenceNumber(sequenceNumber)
         {}
     };
 
@@ -589,97 +617,102 @@ public:
         MaterialDatabase const & materialDatabase,
         SimulationEventDispatcher & simulationEventDispatcher,
         SimulationParameters const & simulationParameters)
-        : ElementContainer(make_aligned_float_element_count(shipPointCount) + SimulationParameters::MaxEphemeralParticles)
+        : ElementContainer(make_aligned_float_element_count(shipPointCount) + SimulationParameters::MaxEphemeralParticles, simulationParameters.DoUseContiguousElementBuffers)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDamagedBuffer(mBufferElementCount, shipPointCount, false)
+        , mIsDamagedBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
         // Materials
-        , mMaterialsBuffer(mBufferElementCount, shipPointCount, Materials(nullptr, nullptr))
-        , mIsRopeBuffer(mBufferElementCount, shipPointCount, false)
+        , mMaterialsBuffer(mBufferArena, mBufferElementCount, shipPointCount, Materials(nullptr, nullptr))
+        , mIsRopeBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
         // Mechanical dynamics
-        , mPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mFactoryPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mPositionBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
+        , mFactoryPositionBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
+        , mVelocityBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
         , mDynamicForceBuffers() // We'll start later with at least one
         , mDynamicForceRawBuffers()
-        , mStaticForceBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mAugmentedMaterialMassBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mTransientAdditionalMassBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMassBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mMaterialBuoyancyVolumeFillBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mStrengthBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mStressBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mDecayBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mIsDecayBufferDirty(true)
-        , mPinningCoefficientBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mIntegrationFactorTimeCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mOceanFloorCollisionFactorsBuffer(mBufferElementCount, shipPointCount, OceanFloorCollisionFactors(0.0f, 0.0f, 0.0f))
-        , mAirWaterInterfaceInverseWidthBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mBuoyancyCoefficientsBuffer(mBufferElementCount, shipPointCount, BuoyancyCoefficients(0.0f, 0.0f))
-        , mCachedDepthBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mIntegrationFactorBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mStaticForceBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
+        , mAugmentedMaterialMassBuffer(mBufferArena, mBufferElementCount, shipPointCount, 1.0f)
+        , mTransientAdditionalMassBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMassBuffer(mBufferArena, mBufferElementCount, shipPointCount, 1.0f)
+        , mIsMassDirtyBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
+        , mMaterialBuoyancyVolumeFillBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mStrengthBuffer(mBufferArena, mBufferElementCount, shipPointCount, Float16(0.0f))
+        , mStressBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mDecayBuffer(mBufferArena, mBufferElementCount, shipPointCount, 1.0f)
+        , mDecayBufferDirtyIntervals(64, 16)
+        , mPinningCoefficientBuffer(mBufferArena, mBufferElementCount, shipPointCount, 1.0f)
+        , mIntegrationFactorTimeCoefficientBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mOceanFloorCollisionFactorsBuffer(mBufferArena, mBufferElementCount, shipPointCount, OceanFloorCollisionFactors(0.0f, 0.0f, 0.0f))
+        , mAirWaterInterfaceInverseWidthBuffer(mBufferArena, mBufferElementCount, shipPointCount, 1.0f)
+        , mBuoyancyCoefficientsBuffer(mBufferArena, mBufferElementCount, shipPointCount, BuoyancyCoefficients(0.0f, 0.0f))
+        , mCachedDepthBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mIntegrationFactorBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
         // Pressure and water dynamics
-        , mIsHullBuffer(mBufferElementCount, shipPointCount, false)
-        , mInternalPressureBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialWaterIntakeBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialWaterRestitutionBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialWaterDiffusionSpeedBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mWaterBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mWaterVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mWaterMomentumBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mCumulatedIntakenWater(mBufferElementCount, shipPointCount, 0.0f)
-        , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false))
-        , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false)
+        , mIsHullBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
+        , mInternalPressureBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialWaterIntakeBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialWaterRestitutionBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialWaterDiffusionSpeedBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mWaterBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mWaterVelocityBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
+        , mWaterMomentumBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
+        , mCumulatedIntakenWater(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mLeakingCompositeBuffer(mBufferArena, mBufferElementCount, shipPointCount, LeakingComposite(false))
+        , mFactoryIsStructurallyLeakingBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
         , mTotalFactoryWetPoints(0)
         // Heat dynamics
-        , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialThermalExpansionCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialCombustionTypeBuffer(mBufferElementCount, shipPointCount, StructuralMaterial::MaterialCombustionType::Combustion) // Arbitrary
-        , mCombustionStateBuffer(mBufferElementCount, shipPointCount, CombustionState())
+        , mTemperatureBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialHeatCapacityReciprocalBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialThermalExpansionCoefficientBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialIgnitionTemperatureBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mCombustionCandidateTemperatureBuffer(mBufferArena, mBufferElementCount, shipPointCount, std::numeric_limits<float>::max()) // Ephemerals never burn
+        , mMaterialCombustionTypeBuffer(mBufferArena, mBufferElementCount, shipPointCount, StructuralMaterial::MaterialCombustionType::Combustion) // Arbitrary
+        , mCombustionStateBuffer(mBufferArena, mBufferElementCount, shipPointCount, CombustionState())
         // Water reaction dynamics
-        , mWaterReactionStateBuffer(mBufferElementCount, shipPointCount, WaterReactionState(0.0f))
+        , mWaterReactionStateBuffer(mBufferArena, mBufferElementCount, shipPointCount, WaterReactionState(0.0f))
         // Electrical dynamics
-        , mElectricalElementBuffer(mBufferElementCount, shipPointCount, NoneElementIndex)
-        , mLightBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mElectricalElementBuffer(mBufferArena, mBufferElementCount, shipPointCount, NoneElementIndex)
+        , mLightBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
         // Wind dynamics
-        , mMaterialWindReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialWindReceptivityBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
         // Rust dynamics
-        , mMaterialRustReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialRustReceptivityBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0f)
+        , mRustablePoints()
         // Various interactions
-        , mIsElectrifiedBuffer(mBufferElementCount, shipPointCount, false)
+        , mIsElectrifiedBuffer(mBufferArena, mBufferElementCount, shipPointCount, false)
         // Ephemeral particles
-        , mEphemeralParticleAttributes1Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes1())
-        , mEphemeralParticleAttributes2Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes2())
+        , mEphemeralParticleAttributes1Buffer(mBufferArena, mBufferElementCount, shipPointCount, EphemeralParticleAttributes1())
+        , mEphemeralParticleAttributes2Buffer(mBufferArena, mBufferElementCount, shipPointCount, EphemeralParticleAttributes2())
         // Structure
-        , mConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mFactoryConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
-        , mFactoryConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
+        , mConnectedSpringsBuffer(mBufferArena, mBufferElementCount, shipPointCount, ConnectedSpringsVector())
+        , mFactoryConnectedSpringsBuffer(mBufferArena, mBufferElementCount, shipPointCount, ConnectedSpringsVector())
+        , mConnectedTrianglesBuffer(mBufferArena, mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
+        , mFactoryConnectedTrianglesBuffer(mBufferArena, mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
         // Connected component and plane ID
-        , mConnectedComponentIdBuffer(mBufferElementCount, shipPointCount, NoneConnectedComponentId)
-        , mPlaneIdBuffer(mBufferElementCount, shipPointCount, NonePlaneId)
-        , mPlaneIdFloatBuffer(mBufferElementCount, shipPointCount, 0.0)
+        , mConnectedComponentIdBuffer(mBufferArena, mBufferElementCount, shipPointCount, NoneConnectedComponentId)
+        , mPlaneIdBuffer(mBufferArena, mBufferElementCount, shipPointCount, NonePlaneId)
+        , mPlaneIdFloatBuffer(mBufferArena, mBufferElementCount, shipPointCount, 0.0)
         , mIsPlaneIdBufferNonEphemeralDirty(true)
         , mIsPlaneIdBufferEphemeralDirty(true)
-        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, shipPointCount, SequenceNumber())
+        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferArena, mBufferElementCount, shipPointCount, SequenceNumber())
         // Repair
-        , mRepairStateBuffer(mBufferElementCount, shipPointCount, RepairState())
+        , mRepairStateBuffer(mBufferArena, mBufferElementCount, shipPointCount, RepairState())
         // Highlights
         , mElectricalElementHighlightedPoints()
         , mCircleHighlightedPoints()
         // Gadgets
-        , mIsGadgetAttachedBuffer(mBufferElementCount, mElementCount, false)
+        , mIsGadgetAttachedBuffer(mBufferArena, mBufferElementCount, mElementCount, false)
         // Randomness
-        , mRandomNormalizedUniformFloatBuffer(mBufferElementCount, shipPointCount, [](size_t){ return GameRandomEngine::GetInstance().GenerateNormalizedUniformReal(); })
+        , mRandomNormalizedUniformFloatBuffer(mBufferArena, mBufferElementCount, shipPointCount, Float16(0.0f)) // Ephemeral range filled below
         // Immutable render attributes
-        , mColorBuffer(mBufferElementCount, shipPointCount, vec4f::zero())
-        , mIsWholeColorBufferDirty(true)
-        , mIsEphemeralColorBufferDirty(true)
-        , mTextureCoordinatesBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mColorBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec4f::zero())
+        , mColorBufferDirtyIntervals(64, 16)
+        , mTextureCoordinatesBuffer(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero())
         , mIsTextureCoordinatesBufferDirty(true)
+        // Render interpolation
+        , mPreviousPositionBuffer()
+        , mInterpolatedPositionBuffer()
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -701,24 +734,52 @@ public:
         , mCurrentOceanFloorFrictionCoefficient(simulationParameters.OceanFloorFrictionCoefficient)
         , mCurrentCumulatedIntakenWaterThresholdForAirBubbles(SimulationParameters::AirBubblesDensityToCumulatedIntakenWater(simulationParameters.AirBubblesDensity))
         , mCurrentCombustionSpeedAdjustment(simulationParameters.CombustionSpeedAdjustment)
+        , mCurrentIgnitionTemperatureAdjustment(simulationParameters.IgnitionTemperatureAdjustment)
+        , mCurrentDensityAdjustedWaterMass(0.0f)
         , mFloatBufferAllocator(mBufferElementCount)
         , mVec2fBufferAllocator(mBufferElementCount)
         , mCombustionIgnitionCandidates(mRawShipPointCount)
         , mCombustionExplosionCandidates(mRawShipPointCount)
         , mWaterReactionExplosionCandidates(mRawShipPointCount)
+        , mLeakingPoints()
+        , mAreLeakingPointsDirty(false)
+        , mMassDirtyPoints()
+        , mAreAllMassesDirty(true) // Integration factors are yet to be calculated
+        , mTransientAdditionalMassPoints()
+        , mCombustionCandidatePoints()
+        , mWaterReactivePoints()
+        , mCombustionLowFrequencyPoints()
         , mBurningPoints()
         , mStoppedBurningPoints()
-        , mFreeEphemeralParticleSearchStartIndex(mAlignedShipPointCount)
+        , mFreeEphemeralParticles()
+        , mLiveEphemeralParticleMask()
+        , mLiveEphemeralParticlesByType()
+        , mEphemeralParticleAllocations()
+        , mNextEphemeralParticleAllocationSequenceNumber(1)
         , mAreEphemeralPointElementsDirtyForRendering(false)
 #ifdef _DEBUG
         , mDiagnostic_ArePositionsDirty(false)
 #endif
     {
         // Add first (implicit) buffer
-        mDynamicForceBuffers.emplace_back(mBufferElementCount, shipPointCount, vec2f::zero());
+        mDynamicForceBuffers.emplace_back(mBufferArena, mBufferElementCount, shipPointCount, vec2f::zero());
         mDynamicForceRawBuffers.emplace_back(reinterpret_cast<float *>(mDynamicForceBuffers[0].data()));
 
         CalculateCombustionDecayParameters(mCurrentCombustionSpeedAdjustment, SimulationParameters::ParticleUpdateLowFrequencyStepTimeDuration<float>);
+
+        for (ElementIndex p = static_cast<ElementIndex>(shipPointCount); p < mBufferElementCount; ++p)
+        {
+            mRandomNormalizedUniformFloatBuffer[p] = Float16(GameRandomEngine::GetInstance().GenerateNormalizedUniformReal());
+        }
+
+        // All ephemeral particles are free, and are to be taken in index order at first
+        mFreeEphemeralParticles.reserve(mEphemeralPointCount);
+        for (ElementIndex p = mAllPointCount; p > mAlignedShipPointCount; --p)
+        {
+            mFreeEphemeralParticles.push_back(p - 1);
+        }
+
+        mLiveEphemeralParticleMask.resize((mEphemeralPointCount + 63) / 64, 0);
     }
 
     Points(Points && other) = default;
@@ -757,6 +818,26 @@ public:
         return ElementIndexRangeIterable(mAlignedShipPointCount, mAllPointCount);
     }
 
+    /*
+     * Visits the live ephemeral particles, in index order; free slots are
+     * skipped 64 at a time. The visitor may expire the visited particle.
+     */
+    template<typename TVisitor>
+    inline void VisitLiveEphemeralParticles(TVisitor && visitor) const
+    {
+        for (size_t w = 0; w < mLiveEphemeralParticleMask.size(); ++w)
+        {
+            std::uint64_t liveMask = mLiveEphemeralParticleMask[w];
+            for (ElementIndex pointIndex = mAlignedShipPointCount + static_cast<ElementIndex>(w * 64); liveMask != 0; liveMask >>= 1, ++pointIndex)
+            {
+                if (liveMask & 1)
+                {
+                    visitor(pointIndex);
+                }
+            }
+        }
+    }
+
     /*
      * Returns a flag indicating whether the point is active in the world.
      *
@@ -773,16 +854,21 @@ public:
         return pointIndex >= mAlignedShipPointCount;
     }
 
-    Geometry::AABB CalculateAABB() const
+    Geometry::AABB CalculateAABB() const;
+
+    /*
+     * Like CalculateAABB, but also including the live ephemeral particles, so
+     * to bound everything that the points render.
+     */
+    Geometry::AABB CalculateRenderAABB() const
     {
-        Geometry::AABB box;
+        Geometry::AABB box = CalculateAABB();
 
-        vec2f const * restrict pPtr = mPositionBuffer.data();
-        for (ElementIndex pointIndex : RawShipPoints())
-        {
-            vec2f const pos = pPtr[pointIndex];
-            box.ExtendTo(pos);
-        }
+        VisitLiveEphemeralParticles(
+            [&](ElementIndex pointIndex)
+            {
+                box.ExtendTo(mPositionBuffer[pointIndex]);
+            });
 
         return box;
     }
@@ -792,6 +878,14 @@ public:
         mShipPhysicsHandler = shipPhysicsHandler;
     }
 
+    /*
+     * Saves the dynamic state of the ship points. Ephemeral particles are not part of
+     * snapshots, and are all expired when a snapshot is restored.
+     */
+    void SaveSnapshot(SnapshotWriter & writer) const;
+
+    void RestoreSnapshot(SnapshotReader & reader);
+
     void Add(
         vec2f const & position,
         float water,
@@ -806,6 +900,17 @@ public:
         vec2f const & textureCoordinates,
         float randomNormalizedUniformFloat);
 
+    /*
+     * Adds all of the ship's points at once, equivalently to invoking Add() for each one of
+     * them in order, but filling each buffer in a single pass.
+     *
+     * Points with an electrical material are assigned consecutive electrical element indices.
+     */
+    void AddRange(
+        std::vector<ShipFactoryPoint> const & pointInfos,
+        float internalPressure,
+        std::vector<float> const & randomNormalizedUniformFloats);
+
     void CreateEphemeralParticleAirBubble(
         vec2f const & position,
         float depth,
@@ -935,6 +1040,11 @@ public:
 
     void Query(ElementIndex pointElementIndex) const;
 
+    /*
+     * Adds the memory occupied by the points to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
     // For debugging
     void ColorPointForDebugging(
         ElementIndex pointIndex,
@@ -944,9 +1054,25 @@ public:
     // Render
     //
 
+    /*
+     * Remembers the current positions as the ones that rendered positions are
+     * interpolated from, until the next invocation.
+     */
+    void SnapshotPositionsForRenderInterpolation()
+    {
+        mPreviousPositionBuffer.assign(
+            mPositionBuffer.data(),
+            mPositionBuffer.data() + mBufferElementCount);
+    }
+
+    /*
+     * The render interpolation factor is the fraction of the way from the positions
+     * at the last snapshot to the current positions, at which positions are rendered.
+     */
     void UploadAttributes(
         ShipId shipId,
-        RenderContext & renderContext) const;
+        RenderContext & renderContext,
+        float renderInterpolationFactor) const;
 
     void UploadNonEphemeralPointElements(
         ShipId shipId,
@@ -1033,7 +1159,7 @@ public:
         return reinterpret_cast<float *>(mPositionBuffer.data());
     }
 
-    std::shared_ptr<Buffer<vec2f>> MakePositionBufferCopy()
+    PooledBuffer<vec2f> MakePositionBufferCopy()
     {
         auto positionBufferCopy = mVec2fBufferAllocator.Allocate();
         positionBufferCopy->copy_from(mPositionBuffer);
@@ -1077,7 +1203,7 @@ public:
         return reinterpret_cast<float *>(mVelocityBuffer.data());
     }
 
-    std::shared_ptr<Buffer<vec2f>> MakeVelocityBufferCopy()
+    PooledBuffer<vec2f> MakeVelocityBufferCopy()
     {
         auto velocityBufferCopy = mVec2fBufferAllocator.Allocate();
         velocityBufferCopy->copy_from(mVelocityBuffer);
@@ -1154,10 +1280,17 @@ public:
         mDynamicForceBuffers[0].fill(vec2f::zero());
     }
 
-    void SetDynamicForceParallelism(size_t parallelism)
+    /*
+     * Returns the index of the first buffer that has been added; such buffers are
+     * left uninitialized, and must be initialized via InitializeParallelDynamicForceBuffer()
+     * before use - ideally by the thread that uses them.
+     */
+    size_t SetDynamicForceParallelism(size_t parallelism)
     {
         assert(parallelism >= 1);
 
+        size_t const firstNewBuffer = std::min(parallelism, mDynamicForceBuffers.size());
+
         // Maintain current buffers' contents, so to save contents of first buffer
         if (parallelism < mDynamicForceBuffers.size())
         {
@@ -1171,10 +1304,18 @@ public:
         {
             for (size_t b = mDynamicForceBuffers.size(); b < parallelism; ++b)
             {
-                mDynamicForceBuffers.emplace_back(mBufferElementCount, vec2f::zero());
+                mDynamicForceBuffers.emplace_back(mBufferElementCount);
                 mDynamicForceRawBuffers.emplace_back(reinterpret_cast<float *>(mDynamicForceBuffers.back().data()));
             }
         }
+
+        return firstNewBuffer;
+    }
+
+    void InitializeParallelDynamicForceBuffer(size_t parallelIndex)
+    {
+        assert(parallelIndex < mDynamicForceBuffers.size());
+        mDynamicForceBuffers[parallelIndex].fill(vec2f::zero());
     }
 
     vec2f const & GetStaticForce(ElementIndex pointElementIndex) const noexcept
@@ -1225,12 +1366,26 @@ public:
         ElementIndex pointElementIndex,
         float value)
     {
+        if (mTransientAdditionalMassBuffer[pointElementIndex] == 0.0f)
+        {
+            mTransientAdditionalMassPoints.push_back(pointElementIndex);
+        }
+
         mTransientAdditionalMassBuffer[pointElementIndex] += value;
+
+        MarkMassAsDirty(pointElementIndex);
     }
 
     void ResetTransientAdditionalMasses()
     {
-        mTransientAdditionalMassBuffer.fill(0.0f);
+        for (ElementIndex const p : mTransientAdditionalMassPoints)
+        {
+            mTransientAdditionalMassBuffer[p] = 0.0f;
+
+            MarkMassAsDirty(p);
+        }
+
+        mTransientAdditionalMassPoints.clear();
     }
 
     void AugmentMaterialMass(
@@ -1250,11 +1405,41 @@ public:
         return mMassBuffer[pointElementIndex];
     }
 
+    float const * GetMassBufferAsFloat() const noexcept
+    {
+        return mMassBuffer.data();
+    }
+
+    /*
+     * Only visits the points whose mass inputs (water, augmented material mass, transient
+     * additional mass, integration factor time coefficient) have changed, until their
+     * masses have converged.
+     */
     void UpdateMasses(SimulationParameters const & simulationParameters);
 
+    /*
+     * Marks the point's mass as needing to be re-calculated, after
+     * one of its inputs has changed.
+     *
+     * Invoked by writers of water, hence only from phases that write water, or serially.
+     */
+    void MarkMassAsDirty(ElementIndex pointElementIndex)
+    {
+        if (!mIsMassDirtyBuffer[pointElementIndex])
+        {
+            mIsMassDirtyBuffer[pointElementIndex] = true;
+            mMassDirtyPoints.push_back(pointElementIndex);
+        }
+    }
+
+    void MarkAllMassesAsDirty()
+    {
+        mAreAllMassesDirty = true;
+    }
+
     float GetStrength(ElementIndex pointElementIndex) const
     {
-        return mStrengthBuffer[pointElementIndex];
+        return mStrengthBuffer[pointElementIndex].ToFloat();
     }
 
     float GetStress(ElementIndex pointElementIndex) const
@@ -1284,11 +1469,12 @@ public:
         float value)
     {
         mDecayBuffer[pointElementIndex] = value;
+        mDecayBufferDirtyIntervals.Add(pointElementIndex);
     }
 
     void MarkDecayBufferAsDirty()
     {
-        mIsDecayBufferDirty = true;
+        mDecayBufferDirtyIntervals.Add(0, mRawShipPointCount);
     }
 
     bool IsPinned(ElementIndex pointElementIndex) const
@@ -1325,11 +1511,21 @@ public:
         return mAirWaterInterfaceInverseWidthBuffer[pointElementIndex];
     }
 
+    float const * GetAirWaterInterfaceInverseWidthBufferAsFloat() const
+    {
+        return mAirWaterInterfaceInverseWidthBuffer.data();
+    }
+
     BuoyancyCoefficients const & GetBuoyancyCoefficients(ElementIndex pointElementIndex)
     {
         return mBuoyancyCoefficientsBuffer[pointElementIndex];
     }
 
+    BuoyancyCoefficients const * GetBuoyancyCoefficientsBuffer() const
+    {
+        return mBuoyancyCoefficientsBuffer.data();
+    }
+
     /*
      * Valid only when positions haven't changed since the last time depths have been calculated.
      */
@@ -1390,6 +1586,8 @@ public:
         mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
             mCurrentNumMechanicalDynamicsIterations,
             mPinningCoefficientBuffer[pointElementIndex] * receptivity);
+
+        MarkMassAsDirty(pointElementIndex);
     }
 
     // Changes the point's dynamics so that it freezes in place
@@ -1404,6 +1602,8 @@ public:
             mCurrentNumMechanicalDynamicsIterations,
             mPinningCoefficientBuffer[pointElementIndex]);
 
+        MarkMassAsDirty(pointElementIndex);
+
         // Also zero-out velocity, wiping all traces of this point moving
         mVelocityBuffer[pointElementIndex] = vec2f(0.0f, 0.0f);
     }
@@ -1418,6 +1618,8 @@ public:
         mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
             mCurrentNumMechanicalDynamicsIterations,
             mPinningCoefficientBuffer[pointElementIndex]);
+
+        MarkMassAsDirty(pointElementIndex);
     }
 
     //
@@ -1482,7 +1684,12 @@ public:
         ElementIndex pointElementIndex,
         float value)
     {
-        mWaterBuffer[pointElementIndex] = value;
+        if (value != mWaterBuffer[pointElementIndex])
+        {
+            mWaterBuffer[pointElementIndex] = value;
+
+            MarkMassAsDirty(pointElementIndex);
+        }
     }
 
     float * GetWaterBufferAsFloat()
@@ -1497,7 +1704,7 @@ public:
         return mWaterBuffer[pointElementIndex] > threshold;
     }
 
-    std::shared_ptr<Buffer<float>> MakeWaterBufferCopy()
+    PooledBuffer<float> MakeWaterBufferCopy()
     {
         auto waterBufferCopy = mFloatBufferAllocator.Allocate();
         waterBufferCopy->copy_from(mWaterBuffer);
@@ -1505,9 +1712,11 @@ public:
         return waterBufferCopy;
     }
 
-    void UpdateWaterBuffer(std::shared_ptr<Buffer<float>> newWaterBuffer)
+    void UpdateWaterBuffer(PooledBuffer<float> const & newWaterBuffer)
     {
         mWaterBuffer.copy_from(*newWaterBuffer);
+
+        MarkAllMassesAsDirty();
     }
 
     vec2f const & GetWaterVelocity(ElementIndex pointElementIndex) const
@@ -1589,9 +1798,28 @@ public:
         return mLeakingCompositeBuffer[pointElementIndex];
     }
 
-    LeakingComposite & GetLeakingComposite(ElementIndex pointElementIndex)
+    void SetWaterPumpForce(
+        ElementIndex pointElementIndex,
+        float waterPumpForce)
     {
-        return mLeakingCompositeBuffer[pointElementIndex];
+        bool const wasLeaking = (mLeakingCompositeBuffer[pointElementIndex].IsCumulativelyLeaking != 0);
+
+        mLeakingCompositeBuffer[pointElementIndex].LeakingSources.WaterPumpForce = waterPumpForce;
+
+        OnLeakingChanged(pointElementIndex, wasLeaking);
+    }
+
+    /*
+     * Returns the (non-ephemeral) points that are currently leaking, in index order.
+     */
+    std::vector<ElementIndex> const & GetLeakingPoints()
+    {
+        if (mAreLeakingPointsDirty)
+        {
+            CompactLeakingPoints();
+        }
+
+        return mLeakingPoints;
     }
 
     ElementCount GetTotalFactoryWetPoints() const
@@ -1628,6 +1856,11 @@ public:
         return mTemperatureBuffer[pointElementIndex];
     }
 
+    float const * GetTemperatureBufferAsFloat() const
+    {
+        return mTemperatureBuffer.data();
+    }
+
     float * GetTemperatureBufferAsFloat()
     {
         return mTemperatureBuffer.data();
@@ -1638,9 +1871,11 @@ public:
         float value)
     {
         mTemperatureBuffer[pointElementIndex] = value;
+
+        OnTemperatureChanged(pointElementIndex);
     }
 
-    std::shared_ptr<Buffer<float>> MakeTemperatureBufferCopy()
+    PooledBuffer<float> MakeTemperatureBufferCopy()
     {
         auto temperatureBufferCopy = mFloatBufferAllocator.Allocate();
         temperatureBufferCopy->copy_from(mTemperatureBuffer);
@@ -1648,7 +1883,7 @@ public:
         return temperatureBufferCopy;
     }
 
-    void UpdateTemperatureBuffer(std::shared_ptr<Buffer<float>> newTemperatureBuffer)
+    void UpdateTemperatureBuffer(PooledBuffer<float> const & newTemperatureBuffer)
     {
         mTemperatureBuffer.copy_from(*newTemperatureBuffer);
     }
@@ -1658,11 +1893,38 @@ public:
         return mMaterialHeatCapacityReciprocalBuffer[pointElementIndex];
     }
 
+    float const * GetMaterialHeatCapacityReciprocalBufferAsFloat() const
+    {
+        return mMaterialHeatCapacityReciprocalBuffer.data();
+    }
+
     float GetMaterialIgnitionTemperature(ElementIndex pointElementIndex) const
     {
         return mMaterialIgnitionTemperatureBuffer[pointElementIndex];
     }
 
+    float const * GetCombustionCandidateTemperatureBufferAsFloat() const
+    {
+        return mCombustionCandidateTemperatureBuffer.data();
+    }
+
+    /*
+     * Forgets all combustion candidates; invoked right before heat propagation,
+     * which then hands over the points it finds hot enough to ignite.
+     */
+    void ClearCombustionCandidatePoints()
+    {
+        mCombustionCandidatePoints.clear();
+    }
+
+    void AddCombustionCandidatePoints(std::vector<ElementIndex> const & pointIndices)
+    {
+        mCombustionCandidatePoints.insert(
+            mCombustionCandidatePoints.end(),
+            pointIndices.cbegin(),
+            pointIndices.cend());
+    }
+
     /*
      * Checks whether a point is simply burning.
      */
@@ -1731,6 +1993,8 @@ public:
         mTemperatureBuffer[pointElementIndex] +=
             heat
             * GetMaterialHeatCapacityReciprocal(pointElementIndex);
+
+        OnTemperatureChanged(pointElementIndex);
     }
 
     //
@@ -1761,6 +2025,11 @@ public:
         return mMaterialWindReceptivityBuffer[pointElementIndex];
     }
 
+    float const * GetMaterialWindReceptivityBufferAsFloat() const
+    {
+        return mMaterialWindReceptivityBuffer.data();
+    }
+
     //
     // Rust dynamics
     //
@@ -1770,6 +2039,14 @@ public:
         return mMaterialRustReceptivityBuffer[pointElementIndex];
     }
 
+    /*
+     * Returns the (non-ephemeral) points whose material may rust, in index order.
+     */
+    std::vector<ElementIndex> const & GetRustablePoints() const
+    {
+        return mRustablePoints;
+    }
+
     //
     // Various interactions
     //
@@ -1941,6 +2218,11 @@ public:
         return mConnectedComponentIdBuffer[pointElementIndex];
     }
 
+    ConnectedComponentId const * GetConnectedComponentIdBuffer() const
+    {
+        return mConnectedComponentIdBuffer.data();
+    }
+
     void SetConnectedComponentId(
         ElementIndex pointElementIndex,
         ConnectedComponentId connectedComponentId)
@@ -2102,7 +2384,7 @@ public:
     // [0.0, 1.0]
     float GetRandomNormalizedUniformPersonalitySeed(ElementIndex pointElementIndex) const
     {
-        return mRandomNormalizedUniformFloatBuffer[pointElementIndex];
+        return mRandomNormalizedUniformFloatBuffer[pointElementIndex].ToFloat();
     }
 
     //
@@ -2122,19 +2404,19 @@ public:
     // Mostly for debugging
     void MarkColorBufferAsDirty()
     {
-        mIsWholeColorBufferDirty = true;
+        mColorBufferDirtyIntervals.Add(0, mAllPointCount);
     }
 
     //
     // Temporary buffer
     //
 
-    std::shared_ptr<Buffer<float>> AllocateWorkBufferFloat()
+    PooledBuffer<float> AllocateWorkBufferFloat()
     {
         return mFloatBufferAllocator.Allocate();
     }
 
-    std::shared_ptr<Buffer<vec2f>> AllocateWorkBufferVec2f()
+    PooledBuffer<vec2f> AllocateWorkBufferVec2f()
     {
         return mVec2fBufferAllocator.Allocate();
     }
@@ -2225,15 +2507,68 @@ private:
 
     inline void SetStructurallyLeaking(ElementIndex pointElementIndex)
     {
+        bool const wasLeaking = (mLeakingCompositeBuffer[pointElementIndex].IsCumulativelyLeaking != 0);
+
         mLeakingCompositeBuffer[pointElementIndex].LeakingSources.StructuralLeak = 1.0f;
 
+        OnLeakingChanged(pointElementIndex, wasLeaking);
+
         // Randomize the initial water intaken, so that air bubbles won't come out all at the same moment
         mCumulatedIntakenWater[pointElementIndex] = RandomizeCumulatedIntakenWater(mCurrentCumulatedIntakenWaterThresholdForAirBubbles);
     }
 
-    inline ElementIndex FindFreeEphemeralParticle(
-        float currentSimulationTime,
-        bool doForce);
+    inline void OnLeakingChanged(
+        ElementIndex pointElementIndex,
+        bool wasLeaking)
+    {
+        bool const isLeaking = (mLeakingCompositeBuffer[pointElementIndex].IsCumulativelyLeaking != 0);
+        if (isLeaking != wasLeaking)
+        {
+            if (isLeaking)
+            {
+                mLeakingPoints.push_back(pointElementIndex);
+            }
+
+            // Points that have stopped leaking - and duplicates - are removed lazily
+            mAreLeakingPointsDirty = true;
+        }
+    }
+
+    void CompactLeakingPoints();
+
+    inline void OnTemperatureChanged(ElementIndex pointElementIndex)
+    {
+        if (mTemperatureBuffer[pointElementIndex] >= mCombustionCandidateTemperatureBuffer[pointElementIndex])
+        {
+            mCombustionCandidatePoints.push_back(pointElementIndex);
+
+            // Heat may be added for a long time without heat propagation ever running, e.g. while paused
+            if (mCombustionCandidatePoints.size() > 2 * static_cast<size_t>(mRawShipPointCount))
+            {
+                CompactCombustionCandidatePoints();
+            }
+        }
+    }
+
+    void CompactCombustionCandidatePoints();
+
+    inline float CalculateCombustionCandidateTemperature(ElementIndex pointElementIndex) const
+    {
+        return
+            mMaterialIgnitionTemperatureBuffer[pointElementIndex] * mCurrentIgnitionTemperatureAdjustment
+            + SimulationParameters::IgnitionTemperatureHighWatermark;
+    }
+
+    void RebuildLeakingPoints();
+
+    inline ElementIndex FindFreeEphemeralParticle(bool doForce);
+
+    inline bool IsEphemeralParticleAllocationCurrent(EphemeralParticleAllocation const & allocation) const
+    {
+        auto const & attributes = mEphemeralParticleAttributes1Buffer[allocation.PointIndex];
+        return attributes.Type != EphemeralType::None
+            && attributes.AllocationSequenceNumber == allocation.SequenceNumber;
+    }
 
     inline void ExpireEphemeralParticle(ElementIndex pointElementIndex)
     {
@@ -2244,7 +2579,14 @@ private:
         // - Being rendered
         // - Being updated
         // ...and it will allow its slot to be chosen for a new ephemeral particle
-        mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = EphemeralType::None;
+        if (mEphemeralParticleAttributes1Buffer[pointElementIndex].Type != EphemeralType::None)
+        {
+            mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = EphemeralType::None;
+            mFreeEphemeralParticles.push_back(pointElementIndex);
+
+            ElementIndex const slot = pointElementIndex - mAlignedShipPointCount;
+            mLiveEphemeralParticleMask[slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+        }
     }
 
 private:
@@ -2275,11 +2617,12 @@ private:
     Buffer<float> mAugmentedMaterialMassBuffer; // Structural + Offset
     Buffer<float> mTransientAdditionalMassBuffer; // Anything; total mass is slowly updated to include this. Reset at end of Update()
     Buffer<float> mMassBuffer; // Augmented + Transient + Water
+    Buffer<bool> mIsMassDirtyBuffer; // Whether the point is in mMassDirtyPoints
     Buffer<float> mMaterialBuoyancyVolumeFillBuffer;
-    Buffer<float> mStrengthBuffer; // Immutable
+    Buffer<Float16> mStrengthBuffer; // Immutable; cold, hence half-precision
     Buffer<float> mStressBuffer; // -1.0 -> 1.0, only calculated (at springs) if rendering it
     Buffer<float> mDecayBuffer; // 1.0 -> 0.0 (completely decayed)
-    bool mutable mIsDecayBufferDirty; // Only tracks non-ephemerals
+    DirtyIntervalSet mutable mDecayBufferDirtyIntervals; // Since last render upload; only tracks non-ephemerals
     Buffer<float> mPinningCoefficientBuffer; // 1.0: not pinned; 0.0f: pinned
     Buffer<float> mIntegrationFactorTimeCoefficientBuffer; // dt^2 or zero when the point is frozen
     Buffer<OceanFloorCollisionFactors> mOceanFloorCollisionFactorsBuffer;
@@ -2328,6 +2671,7 @@ private:
     Buffer<float> mMaterialHeatCapacityReciprocalBuffer;
     Buffer<float> mMaterialThermalExpansionCoefficientBuffer;
     Buffer<float> mMaterialIgnitionTemperatureBuffer;
+    Buffer<float> mCombustionCandidateTemperatureBuffer; // Temperature from which a point may ignite; includes adjustment and watermark
     Buffer<StructuralMaterial::MaterialCombustionType> mMaterialCombustionTypeBuffer;
     Buffer<CombustionState> mCombustionStateBuffer;
 
@@ -2358,6 +2702,7 @@ private:
     //
 
     Buffer<float> mMaterialRustReceptivityBuffer;
+    std::vector<ElementIndex> mRustablePoints; // Points with non-zero rust receptivity; materials don't change, hence neither does this
 
     //
     // Various interactions
@@ -2415,18 +2760,24 @@ private:
     // Randomness
     //
 
-    Buffer<float> mRandomNormalizedUniformFloatBuffer; // [0.0, 1.0]
+    Buffer<Float16> mRandomNormalizedUniformFloatBuffer; // [0.0, 1.0]; cold, hence half-precision
 
     //
     // Immutable render attributes
     //
 
     Buffer<vec4f> mColorBuffer;
-    bool mutable mIsWholeColorBufferDirty;  // Whether or not whole buffer is dirty since last render upload
-    bool mutable mIsEphemeralColorBufferDirty; // Whether or not ephemeral portion of buffer is dirty since last render upload
+    DirtyIntervalSet mutable mColorBufferDirtyIntervals; // Since last render upload
     Buffer<vec2f> mTextureCoordinatesBuffer;
     bool mutable mIsTextureCoordinatesBufferDirty; // Whether or not is dirty since last render upload
 
+    //
+    // Render interpolation
+    //
+
+    std::vector<vec2f> mPreviousPositionBuffer; // Empty until the first snapshot
+    std::vector<vec2f> mutable mInterpolatedPositionBuffer;
+
     //////////////////////////////////////////////////////////
     // Container
     //////////////////////////////////////////////////////////
@@ -2462,6 +2813,8 @@ private:
     float mCurrentOceanFloorFrictionCoefficient;
     float mCurrentCumulatedIntakenWaterThresholdForAirBubbles;
     float mCurrentCombustionSpeedAdjustment;
+    float mCurrentIgnitionTemperatureAdjustment;
+    float mCurrentDensityAdjustedWaterMass;
 
     // Allocators for work buffers
     BufferAllocator<float> mFloatBufferAllocator;
@@ -2474,6 +2827,32 @@ private:
     BoundedVector<std::tuple<ElementIndex, float>> mCombustionExplosionCandidates;
     BoundedVector<std::tuple<ElementIndex, float>> mWaterReactionExplosionCandidates;
 
+    // The indices of the points that are leaking, in index order, once compacted;
+    // when dirty, it may also contain duplicates and points that are not leaking anymore
+    std::vector<ElementIndex> mLeakingPoints;
+    bool mAreLeakingPointsDirty;
+
+    // The indices of the points whose masses are still to converge after a change
+    // in their inputs, without duplicates; when all are dirty, all masses are
+    // re-calculated at the next UpdateMasses()
+    std::vector<ElementIndex> mMassDirtyPoints;
+    bool mAreAllMassesDirty;
+
+    // The indices of the points with a non-zero transient additional mass
+    std::vector<ElementIndex> mTransientAdditionalMassPoints;
+
+    // The indices of the points that may be hot enough to ignite, as found by the last
+    // heat propagation and by the heat added since; in no particular order, and
+    // possibly with duplicates
+    std::vector<ElementIndex> mCombustionCandidatePoints;
+
+    // The indices of the points whose material reacts with water
+    std::vector<ElementIndex> mWaterReactivePoints;
+
+    // The points visited by a low-frequency combustion update;
+    // member only to save allocations at use time
+    std::vector<ElementIndex> mCombustionLowFrequencyPoints;
+
     // The indices of the points that are currently burning
     std::vector<ElementIndex> mBurningPoints;
 
@@ -2481,9 +2860,19 @@ private:
     // member only to save allocations at use time
     std::vector<ElementIndex> mStoppedBurningPoints;
 
-    // The index at which to start searching for free ephemeral particles
-    // (just an optimization over restarting from zero each time)
-    ElementIndex mFreeEphemeralParticleSearchStartIndex;
+    // The free ephemeral particles, as a stack; and the ephemeral particle allocations,
+    // oldest first, for stealing particles in constant time when there are no free
+    // ones. Allocations that are not current anymore are skipped lazily.
+    std::vector<ElementIndex> mFreeEphemeralParticles;
+
+    // One bit per ephemeral particle slot, set while the slot is taken
+    std::vector<std::uint64_t> mLiveEphemeralParticleMask;
+
+    // The live ephemeral particles, by type;
+    // member only to save allocations at use time
+    std::array<std::vector<ElementIndex>, static_cast<size_t>(EphemeralType::WakeBubble) + 1> mLiveEphemeralParticlesByType;
+    std::deque<EphemeralParticleAllocation> mEphemeralParticleAllocations;
+    std::uint32_t mNextEphemeralParticleAllocationSequenceNumber;
 
     // Flag remembering whether the set of ephemeral point *elements* is dirty
     // (i.e. whether there are more or less points than previously
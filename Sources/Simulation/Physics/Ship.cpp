@@ -15,6 +15,7 @@
 #include <Core/GameMath.h>
 #include <Core/GameRandomEngine.h>
 #include <Core/Log.h>
+#include <Core/PhaseGraph.h>
 #include <Core/SysSpecifics.h>
 
 #include <algorithm>
@@ -55,6 +56,39 @@ static int constexpr RotPointsStep4 = 35;
 
 static_assert(RotPointsStep4 < SimulationParameters::ParticleUpdateLowFrequencyPeriod);
 
+// Magic number - we only count a point as wet if its water is above this threshold
+static float constexpr WetPointWaterThreshold = 0.5f;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Update phase resources
+//
+// The data read and written by the update phases that we run as a graph, from which
+// the dependencies among the phases are derived.
+//
+
+enum class UpdatePhaseResource
+{
+    Position,
+    Water,
+    WaterDynamics, // Water velocity and momentum
+    InternalPressure,
+    DynamicForces,
+    StaticForces,
+    Temperature,
+    HeatPropagation, // Heat propagation work buffers
+    Decay,
+    Leaking,
+    Hullness,
+    EphemeralParticles,
+    Electricals,
+    Events,
+    RandomEngine,
+    World, // Anything outside of this ship
+
+    _Last = World
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,23 +149,52 @@ Ship::Ship(
     , mCurrentElectricalVisitSequenceNumber()
     , mConnectedComponentSizes()
     , mIsStructureDirty(true)
+    , mSeveredSpringEndpointsSinceLastConnectivityVisit()
+    , mIsFullConnectivityVisitRequired(true)
+    , mConnectivityFloodPointsBuffer()
+    , mAreElementsDirtyForRendering(true)
     , mDamagedPointsCount(0)
     , mBrokenSpringsCount(0)
     , mBrokenTrianglesCount(0)
+    , mPointAggregates()
     , mIsSinking(false)
     , mWaterSplashedRunningAverage()
     , mLastLuminiscenceAdjustmentDiffused(-1.0f)
     , mRepairGracePeriodMultiplier(1.0f)
+    , mRepairSessionState()
     , mLastQueriedPointIndex(NoneElementIndex)
+    , mPointSpatialGrid(2.0f, 4) // Cells of a few points each; at most 4 cells per point
+    , mIsPointSpatialGridDirty(true)
+    , mLightningTargetCandidatePoints()
+    , mAreLightningTargetCandidatePointsDirty(true)
+    , mLightningTargetCandidatePointsSimulationTime(0.0f)
     , mAirBubblesCreatedCount(0)
     , mCurrentSimulationParallelism(0) // We'll detect a difference on first run
-    , mCurrentSpringRelaxationParallelComputationMode() // We'll detect a difference on first run
+    , mAssignedSpringRelaxationParallelism(0) // We'll detect a difference on first run
+    , mCurrentSpringRelaxationParallelism(0)
+    , mSpringRelaxation_Chebyshev_RelaxationFactor(1.0f)
+    , mRequestedSpringRelaxationParallelComputationMode() // We'll detect a difference on first run
+    , mCurrentSpringRelaxationParallelComputationMode()
+    , mSpringRelaxationModeSelector()
+    , mLastSpringRelaxationMillis()
+    , mSpringRelaxation_DynamicForceInitializationTasks()
+    , mSpringRelaxation_FirstUninitializedDynamicForceBuffer(std::numeric_limits<size_t>::max())
+    // Resting
+    , mRestingStepCount(0)
+    , mIsAsleep(false)
+    , mRestingSpringForceBuffer(mPoints.GetAlignedShipPointCount())
     // Static pressure
     , mStaticPressureBuffer(mPoints.GetAlignedShipPointCount())
     , mStaticPressureNetForceMagnitudeSum(0.0f)
     , mStaticPressureNetForceMagnitudeCount(0.0f)
     , mStaticPressureIterationsPercentagesSum(0.0f)
     , mStaticPressureIterationsCount(0.0f)
+    // Ship-to-ship collisions
+    , mCollisionTriangleIndices()
+    , mCollisionTriangleGridEntries()
+    , mCollisionTriangleGrid()
+    // Tools
+    , mToolSpringIndices()
     // Render
     , mLastUploadedDebugShipRenderMode()
     , mPlaneTriangleIndicesToRender()
@@ -204,83 +267,222 @@ bool Ship::ReplayRecordedEvent(
 {
     if (event.GetType() == RecordedEvent::RecordedEventType::PointDetachForDestroy)
     {
-        RecordedPointDetachForDestroyEvent const & detachEvent = static_cast<RecordedPointDetachForDestroyEvent const &>(event);
-
         DetachPointForDestroy(
-            detachEvent.GetPointIndex(),
-            detachEvent.GetDetachVelocity(),
-            detachEvent.GetSimulationTime(),
+            event.GetPointIndex(),
+            event.GetDetachVelocity(),
+            event.GetSimulationTime(),
             simulationParameters);
     }
 
     return false;
 }
 
-void Ship::Update(
-    float currentSimulationTime,
-    Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters,
-    StressRenderModeType stressRenderMode,
-    Geometry::ShipAABBSet & externalAabbSet, // output
-    ThreadManager & threadManager,
-    PerfStats & perfStats)
+void Ship::SaveSnapshot(SnapshotWriter & writer) const
 {
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateStartTimestamp = GameChronometer::Now();
-#endif
+    if (mDamagedPointsCount != 0 || mBrokenSpringsCount != 0 || mBrokenTrianglesCount != 0)
+    {
+        throw GameException("Cannot take a snapshot of a ship whose structure has been damaged");
+    }
 
-    /////////////////////////////////////////////////////////////////
-    //         This is where most of the magic happens             //
-    /////////////////////////////////////////////////////////////////
+    writer.Write(static_cast<std::uint32_t>(mPoints.GetRawShipPointCount()));
+    writer.Write(static_cast<std::uint32_t>(mSprings.GetElementCount()));
 
-    std::vector<ThreadPool::Task> parallelTasks;
+    mPoints.SaveSnapshot(writer);
+    mSprings.SaveSnapshot(writer);
 
-    /////////////////////////////////////////////////////////////////
-    // At this moment:
-    //  - Particle positions are within world boundaries
-    //  - Particle non-spring forces contain (some of) interaction-provided forces
-    /////////////////////////////////////////////////////////////////
+    writer.Write(mCurrentSimulationSequenceNumber);
+    writer.Write(mIsSinking);
+    writer.Write(mWaterSplashedRunningAverage);
+    writer.Write(mLastLuminiscenceAdjustmentDiffused);
+    writer.Write(mAirBubblesCreatedCount);
+    writer.Write(mRestingStepCount);
+    writer.Write(mIsAsleep);
+    writer.Write(mRestingSpringForceBuffer);
+}
 
-    // Get the current wall clock time
-    auto const currentWallClockTime = GameWallClock::GetInstance().Now();
-    auto const currentWallClockTimeFloat = GameWallClock::GetInstance().AsFloat(currentWallClockTime);
+void Ship::ReportMemory(MemoryReport & report) const
+{
+    mPoints.ReportMemory(report);
+    mSprings.ReportMemory(report);
+    mTriangles.ReportMemory(report);
+    mElectricalElements.ReportMemory(report);
+    mFrontiers.ReportMemory(report);
 
-    // Advance the current simulation sequence
-    ++mCurrentSimulationSequenceNumber;
+    report.Add("Ship", "InteriorTextureImage", mInteriorTextureImage.GetByteSize());
+}
 
-#ifdef _DEBUG
-    VerifyInvariants();
-#endif
+void Ship::RestoreSnapshot(SnapshotReader & reader)
+{
+    if (mDamagedPointsCount != 0 || mBrokenSpringsCount != 0 || mBrokenTrianglesCount != 0)
+    {
+        throw GameException("Cannot restore a snapshot onto a ship whose structure has been damaged");
+    }
 
-    ///////////////////////////////////////////////////////////////////
-    // Process eventual parameter changes
-    ///////////////////////////////////////////////////////////////////
+    if (reader.Read<std::uint32_t>() != mPoints.GetRawShipPointCount()
+        || reader.Read<std::uint32_t>() != mSprings.GetElementCount())
+    {
+        throw GameException("The snapshot was taken of a different ship");
+    }
+
+    mPoints.RestoreSnapshot(reader);
+    mSprings.RestoreSnapshot(reader);
+
+    reader.Read(mCurrentSimulationSequenceNumber);
+    reader.Read(mIsSinking);
+    reader.Read(mWaterSplashedRunningAverage);
+    reader.Read(mLastLuminiscenceAdjustmentDiffused);
+    reader.Read(mAirBubblesCreatedCount);
+    reader.Read(mRestingStepCount);
+    reader.Read(mIsAsleep);
+    reader.Read(mRestingSpringForceBuffer);
+
+    // Points have moved
+    mIsPointSpatialGridDirty = true;
+    mAreLightningTargetCandidatePointsDirty = true;
+}
 
+void Ship::UpdateForSimulationParameters(
+    SimulationParameters const & simulationParameters,
+    size_t simulationParallelism,
+    size_t springRelaxationParallelism,
+    ThreadManager & threadManager)
+{
     mPoints.UpdateForSimulationParameters(
         simulationParameters);
 
-    mSprings.UpdateForSimulationParameters(
-        simulationParameters,
-        mPoints);
+    if (mSprings.UpdateForSimulationParameters(simulationParameters))
+    {
+        UpdateSpringCoefficientsForSimulationParameters(
+            simulationParallelism,
+            threadManager);
+    }
 
     mElectricalElements.UpdateForSimulationParameters(
         simulationParameters);
 
-    UpdateForSimulationParameters(
-        simulationParameters,
-        threadManager);
+    //
+    // Decide the spring relaxation computation - the requested one, or the automatic selector's
+    //
 
-    ///////////////////////////////////////////////////////////////////
-    // Calculate some widely-used physical constants
-    ///////////////////////////////////////////////////////////////////
+    std::optional<SpringRelaxationModeSelector::Choice> springRelaxationChoice;
 
-    float const effectiveAirDensity = Formulae::CalculateAirDensity(
-        simulationParameters.AirTemperature + stormParameters.AirTemperatureDelta,
-        simulationParameters);
+    if (springRelaxationParallelism != mAssignedSpringRelaxationParallelism
+        || simulationParameters.SpringRelaxationParallelComputationMode != mRequestedSpringRelaxationParallelComputationMode)
+    {
+        if (simulationParameters.SpringRelaxationParallelComputationMode == SpringRelaxationParallelComputationModeType::Automatic)
+        {
+            mSpringRelaxationModeSelector.Reset(mSprings.GetElementCount(), springRelaxationParallelism);
+            springRelaxationChoice = mSpringRelaxationModeSelector.GetChoice();
+        }
+        else
+        {
+            springRelaxationChoice = SpringRelaxationModeSelector::Choice{ simulationParameters.SpringRelaxationParallelComputationMode, springRelaxationParallelism };
+        }
 
-    float const effectiveWaterDensity = Formulae::CalculateWaterDensity(
-        simulationParameters.WaterTemperature,
-        simulationParameters);
+        // Remember new values
+        mAssignedSpringRelaxationParallelism = springRelaxationParallelism;
+        mRequestedSpringRelaxationParallelComputationMode = simulationParameters.SpringRelaxationParallelComputationMode;
+    }
+    else if (mLastSpringRelaxationMillis.has_value())
+    {
+        assert(simulationParameters.SpringRelaxationParallelComputationMode == SpringRelaxationParallelComputationModeType::Automatic);
+
+        if (mSpringRelaxationModeSelector.Update(*mLastSpringRelaxationMillis, static_cast<size_t>(mBrokenSpringsCount)))
+        {
+            springRelaxationChoice = mSpringRelaxationModeSelector.GetChoice();
+        }
+    }
+
+    mLastSpringRelaxationMillis.reset();
+
+    if (springRelaxationChoice.has_value()
+        && (springRelaxationChoice->Mode != mCurrentSpringRelaxationParallelComputationMode
+            || springRelaxationChoice->Parallelism != mCurrentSpringRelaxationParallelism))
+    {
+        // Re-calculate spring relaxation parallelism
+        RecalculateSpringRelaxationParallelism(springRelaxationChoice->Parallelism, springRelaxationChoice->Mode, simulationParameters);
+
+        // Remember new values
+        mCurrentSpringRelaxationParallelism = springRelaxationChoice->Parallelism;
+        mCurrentSpringRelaxationParallelComputationMode = springRelaxationChoice->Mode;
+    }
+
+    if (simulationParallelism != mCurrentSimulationParallelism)
+    {
+        // Re-calculate world particle forces parallelism
+        RecalculateWorldParticleForcesParallelism(simulationParallelism);
+
+        // Re-calculate light diffusion parallelism
+        RecalculateLightDiffusionParallelism(simulationParallelism);
+
+        // Re-calculate heat propagation parallelism
+        RecalculateHeatPropagationParallelism(simulationParallelism);
+
+        // Remember new value
+        mCurrentSimulationParallelism = simulationParallelism;
+    }
+}
+
+void Ship::UpdateSpringCoefficientsForSimulationParameters(
+    size_t simulationParallelism,
+    ThreadManager & threadManager)
+{
+    // Fewer springs than these per task are not worth a task
+    ElementCount constexpr MinSpringsPerTask = 4096;
+
+    ElementCount const partitionCount = std::min(
+        static_cast<ElementCount>(simulationParallelism),
+        std::max(mSprings.GetElementCount() / MinSpringsPerTask, ElementCount(1)));
+
+    if (partitionCount == 1)
+    {
+        mSprings.UpdateCoefficientsForSimulationParameters(
+            0, 1,
+            mPoints);
+    }
+    else
+    {
+        // Partitions are disjoint sets of springs, and points are only read
+        std::vector<typename ThreadPool::Task> tasks;
+        tasks.reserve(partitionCount);
+
+        for (ElementCount p = 0; p < partitionCount; ++p)
+        {
+            tasks.emplace_back(
+                [this, p, partitionCount]()
+                {
+                    mSprings.UpdateCoefficientsForSimulationParameters(
+                        p, partitionCount,
+                        mPoints);
+                });
+        }
+
+        threadManager.GetSimulationThreadPool().Run(tasks);
+    }
+}
+
+void Ship::UpdateMechanics(
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    /////////////////////////////////////////////////////////////////
+    // At this moment:
+    //  - Particle positions are within world boundaries
+    //  - Particle non-spring forces contain (some of) interaction-provided forces
+    //
+    // Note: this stage may run concurrently with the same stage of other ships,
+    // hence it must not fire events, use the random engine, nor touch the world
+    /////////////////////////////////////////////////////////////////
+
+#ifdef _DEBUG
+    VerifyInvariants();
+#endif
+
+    // Remember where this step starts from, for rendering in-between steps
+    if (simulationParameters.DoInterpolateRenderedPositions)
+    {
+        mPoints.SnapshotPositionsForRenderInterpolation();
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Recalculate current masses and everything else that derives from them
@@ -295,21 +497,51 @@ void Ship::Update(
     // and ocean floor collision handling
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto startTimestamp1 = GameChronometer::Now();
-#endif
+    // - Ships that have been at rest for a while only check whether they still are
+    if (mRestingStepCount >= SimulationParameters::RestingStepsToSleep)
+    {
+        if (IsAtRest(simulationParameters))
+        {
+            if (!mIsAsleep)
+            {
+                // Fall asleep - points stay where they are from now on
+                vec2f * const restrict velocityBuffer = mPoints.GetVelocityBufferAsVec2();
+                std::fill(
+                    velocityBuffer,
+                    velocityBuffer + mPoints.GetAlignedShipPointCount(),
+                    vec2f::zero());
+
+                mIsAsleep = true;
+            }
+        }
+        else
+        {
+            WakeUp();
+        }
+    }
 
+    if (!mIsAsleep)
     {
-        auto const springsStartTime = GameChronometer::Now();
+        if (simulationParameters.SpringRelaxationParallelComputationMode == SpringRelaxationParallelComputationModeType::Automatic)
+        {
+            // Time it for the selector
+            auto const startTime = GameChronometer::Now();
 
-        RunSpringRelaxation(threadManager, simulationParameters);
+            RunSpringRelaxation(threadManager, simulationParameters);
 
-        perfStats.Update<PerfMeasurement::TotalShipsSpringsUpdate>(GameChronometer::Now() - springsStartTime);
-    }
+            mLastSpringRelaxationMillis = std::chrono::duration<float, std::milli>(GameChronometer::Now() - startTime).count();
+        }
+        else
+        {
+            RunSpringRelaxation(threadManager, simulationParameters);
+        }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedSpringRelaxation = GameChronometer::Now() - startTimestamp1;
-#endif
+        UpdateRestingStepCount();
+    }
+    else
+    {
+        RunEphemeralParticlesDynamics(simulationParameters);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Trim for world bounds
@@ -323,6 +555,45 @@ void Ship::Update(
 #ifdef _DEBUG
     mPoints.Diagnostic_ClearDirtyPositions();
 #endif
+}
+
+void Ship::Update(
+    float currentSimulationTime,
+    Storm::Parameters const & stormParameters,
+    SimulationParameters const & simulationParameters,
+    StressRenderModeType stressRenderMode,
+    Geometry::ShipAABBSet & externalAabbSet, // output
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    /////////////////////////////////////////////////////////////////
+    //         This is where most of the magic happens             //
+    /////////////////////////////////////////////////////////////////
+
+    /////////////////////////////////////////////////////////////////
+    // At this moment:
+    //  - Spring relaxation has run (in UpdateMechanics())
+    //  - Particle positions are within world boundaries
+    /////////////////////////////////////////////////////////////////
+
+    // Get the current wall clock time
+    auto const currentWallClockTime = GameWallClock::GetInstance().Now();
+    auto const currentWallClockTimeFloat = GameWallClock::GetInstance().AsFloat(currentWallClockTime);
+
+    // Advance the current simulation sequence
+    ++mCurrentSimulationSequenceNumber;
+
+    ///////////////////////////////////////////////////////////////////
+    // Calculate some widely-used physical constants
+    ///////////////////////////////////////////////////////////////////
+
+    float const effectiveAirDensity = Formulae::CalculateAirDensity(
+        simulationParameters.AirTemperature + stormParameters.AirTemperatureDelta,
+        simulationParameters);
+
+    float const effectiveWaterDensity = Formulae::CalculateWaterDensity(
+        simulationParameters.WaterTemperature,
+        simulationParameters);
 
     ///////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////
@@ -342,22 +613,18 @@ void Ship::Update(
         mPoints.ResetStress();
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     // - Inputs: P.Position, S.SpringDeletion, S.RestLength, S.BreakingElongation
     // - Outputs: S.Destroy(), P.Stress, S.CachedVectorialInfo
     // - Fires events, updates frontiers
-    mSprings.UpdateForStrainsAndCacheSpringVectors(
-        currentSimulationTime,
-        simulationParameters,
-        mPoints,
-        stressRenderMode);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsStrainUpdate> const perfMeasurement(perfStats);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateForStress = GameChronometer::Now() - startTimestamp1;
-#endif
+        mSprings.UpdateForStrainsAndCacheSpringVectors(
+            currentSimulationTime,
+            simulationParameters,
+            mPoints,
+            stressRenderMode);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Reset static forces, now that we have integrated them
@@ -379,65 +646,18 @@ void Ship::Update(
     // geometric centers - hence needs to come _after _ UpdateForStrains()
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    ApplyWorldForces(
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        simulationParameters,
-        externalAabbSet);
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWorldForces = GameChronometer::Now() - startTimestamp1;
-#endif
-
-    // Cached depths are valid from now on --------------------------->
-
-    ///////////////////////////////////////////////////////////////////
-    // Rot points
-    ///////////////////////////////////////////////////////////////////
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    // - Inputs: Position, Water, IsLeaking
-    // - Output: Decay
-
-    if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        RotPoints(
-            0, 4,
-            currentSimulationTime,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep2, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        RotPoints(
-            1, 4,
-            currentSimulationTime,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep3, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        RotPoints(
-            2, 4,
-            currentSimulationTime,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep4, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        RotPoints(
-            3, 4,
-            currentSimulationTime,
-            simulationParameters);
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsWorldForcesUpdate> const perfMeasurement(perfStats);
+
+        ApplyWorldForces(
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            simulationParameters,
+            threadManager,
+            externalAabbSet);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedRotPoints = GameChronometer::Now() - startTimestamp1;
-#endif
+    // Cached depths and point aggregates are valid from now on ------>
 
     /////////////////////////////////////////////////////////////////
     // Update gadgets
@@ -463,15 +683,13 @@ void Ship::Update(
     // Update water dynamics - may generate ephemeral particles
     /////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     //
     // Update intake of pressure and water
     //
 
     {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsWaterDynamicsUpdate> const perfMeasurement(perfStats);
+
         float waterTakenInStep = 0.f;
 
         // - Inputs: P.Position, P.Water, P.IsLeaking, P.Temperature, P.PlaneId
@@ -483,39 +701,34 @@ void Ship::Update(
             currentSimulationTime,
             stormParameters,
             simulationParameters,
+            threadManager,
             waterTakenInStep);
 
         // Notify intaken water
         mSimulationEventHandler.OnWaterTaken(waterTakenInStep);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWaterDynamics = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////
     // Parallel run 1 START
     ///////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    GameChronometer::duration elapsedWaterDiffusion;
-    GameChronometer::duration elapsedEqualizeInternalPressure;
-    GameChronometer::duration elapsedStaticPressure;
-    GameChronometer::duration elapsedHeatPropagation;
-#endif
+    //
+    // These phases form a graph, whose dependencies are derived from the data each
+    // phase declares to read and write: phases are guaranteed to see the same data
+    // they would see if they ran in the order in which they are added, while those
+    // that don't conflict with each other may run at the same time
+    //
 
-    assert(parallelTasks.empty());
+    PhaseGraph<UpdatePhaseResource> phaseGraph;
 
-    parallelTasks.emplace_back(
+    phaseGraph.AddPhase(
         [&]()
         {
             //
             // Diffuse water (Cost: 14)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
+            ScopedPerfMeasurement<PerfMeasurement::TotalShipsWaterDiffusionUpdate> const perfMeasurement(perfStats);
 
             float waterSplashedInStep = 0.f;
 
@@ -525,88 +738,154 @@ void Ship::Update(
 
             // Notify
             mSimulationEventHandler.OnWaterSplashed(waterSplashedInStep);
+        },
+        { UpdatePhaseResource::Position, UpdatePhaseResource::Hullness },
+        { UpdatePhaseResource::Water, UpdatePhaseResource::WaterDynamics, UpdatePhaseResource::Events });
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedWaterDiffusion = GameChronometer::Now() - startTimestamp2;
-#endif
-        });
-
-    parallelTasks.emplace_back(
+    phaseGraph.AddPhase(
         [&]()
         {
             //
             // Equalize internal pressure (Cost: 1.5)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
+            ScopedPerfMeasurement<PerfMeasurement::TotalShipsPressureUpdate> const perfMeasurement(perfStats);
 
             // - Inputs: InternalPressure, ConnectedSprings
             // - Outpus: InternalPressure
             EqualizeInternalPressure(simulationParameters);
+        },
+        {},
+        { UpdatePhaseResource::InternalPressure });
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedEqualizeInternalPressure = GameChronometer::Now() - startTimestamp2;
-#endif
-
-            //
-            // Apply static pressure forces (Cost: 10)
-            //
+    if (simulationParameters.StaticPressureForceAdjustment > 0.0f)
+    {
+        phaseGraph.AddPhase(
+            [&]()
+            {
+                //
+                // Apply static pressure forces (Cost: 10)
+                //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
+                ScopedPerfMeasurement<PerfMeasurement::TotalShipsPressureUpdate> const perfMeasurement(perfStats);
 
-            if (simulationParameters.StaticPressureForceAdjustment > 0.0f)
-            {
                 // - Inputs: frontiers, P.Position, P.InternalPressure
                 // - Outputs: P.DynamicForces
                 ApplyStaticPressureForces(
                     effectiveAirDensity,
                     effectiveWaterDensity,
                     simulationParameters);
-            }
+            },
+            { UpdatePhaseResource::Position, UpdatePhaseResource::InternalPressure },
+            { UpdatePhaseResource::DynamicForces });
+    }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedStaticPressure = GameChronometer::Now() - startTimestamp2;
-#endif
+    //
+    // Propagate heat (Cost: 4)
+    //
+    // Runs on point partitions, in two passes: the first snapshots temperatures and
+    // calculates the normalization factors of the heat flowing out of each point,
+    // the second has each point gather its flows from the snapshot and dissipate heat;
+    // this way each partition only writes to its own points
+    //
 
-            //
-            // Propagate heat (Cost: 4)
-            //
+    HeatPropagationParameters const heatPropagationParameters = CalculateHeatPropagationParameters(
+        SimulationParameters::SimulationStepTimeDuration<float>,
+        stormParameters,
+        simulationParameters);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
+    auto const oldPointTemperatureBuffer = mPoints.AllocateWorkBufferFloat();
+    auto const heatOutflowNormalizationFactorBuffer = mPoints.AllocateWorkBufferFloat();
 
-            // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
-            // - Outputs: P.Temperature
-            PropagateHeat(
-                currentSimulationTime,
-                SimulationParameters::SimulationStepTimeDuration<float>,
-                stormParameters,
-                simulationParameters);
+    {
+        frame_vector<ThreadPool::Task> heatOutflowTasks{ FrameArenaAllocator<ThreadPool::Task>(mParentWorld.GetFrameArena()) };
+        heatOutflowTasks.reserve(mHeatPropagationPointRanges.size());
+        for (auto const & pointRange : mHeatPropagationPointRanges)
+        {
+            heatOutflowTasks.emplace_back(
+                [&, pointRange]()
+                {
+                    ScopedPerfMeasurement<PerfMeasurement::TotalShipsHeatUpdate> const perfMeasurement(perfStats);
+
+                    // - Inputs: P.Temperature, P.ConnectedSprings
+                    // - Outputs: temperature snapshot, outflow normalization factors
+                    CalculateHeatOutflowNormalizationFactors(
+                        pointRange.first,
+                        pointRange.second,
+                        heatPropagationParameters,
+                        oldPointTemperatureBuffer->data(),
+                        heatOutflowNormalizationFactorBuffer->data());
+                });
+        }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedHeatPropagation = GameChronometer::Now() - startTimestamp2;
-#endif
-        });
+        phaseGraph.AddPhases(
+            std::move(heatOutflowTasks),
+            { UpdatePhaseResource::Temperature },
+            { UpdatePhaseResource::HeatPropagation });
+    }
+
+    {
+        frame_vector<ThreadPool::Task> heatPropagationTasks{ FrameArenaAllocator<ThreadPool::Task>(mParentWorld.GetFrameArena()) };
+        heatPropagationTasks.reserve(mHeatPropagationPointRanges.size());
+        for (size_t t = 0; t < mHeatPropagationPointRanges.size(); ++t)
+        {
+            heatPropagationTasks.emplace_back(
+                [&, t]()
+                {
+                    ScopedPerfMeasurement<PerfMeasurement::TotalShipsHeatUpdate> const perfMeasurement(perfStats);
+
+                    // - Inputs: temperature snapshot, outflow normalization factors, P.Position, P.Water
+                    // - Outputs: P.Temperature, hot points
+                    PropagateHeat(
+                        mHeatPropagationPointRanges[t].first,
+                        mHeatPropagationPointRanges[t].second,
+                        heatPropagationParameters,
+                        oldPointTemperatureBuffer->data(),
+                        heatOutflowNormalizationFactorBuffer->data(),
+                        mHeatPropagationHotPoints[t]);
+                });
+        }
 
-    threadManager.GetSimulationThreadPool().RunAndClear(parallelTasks);
+        // Note: we don't declare P.Water, as heat only uses it for a coarse smothering
+        // threshold that doesn't care whether it sees water before or after diffusion
+        phaseGraph.AddPhases(
+            std::move(heatPropagationTasks),
+            { UpdatePhaseResource::HeatPropagation, UpdatePhaseResource::Position, UpdatePhaseResource::EphemeralParticles },
+            { UpdatePhaseResource::Temperature });
+    }
 
-    // Publish static pressure stats
-    mSimulationEventHandler.OnStaticPressureUpdated(
-        mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
-        mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
+    //
+    // Rot points
+    //
+    // Note: this sees water after diffusion, which makes no difference to
+    // its low-frequency estimate
+    //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedParallel1 = GameChronometer::Now() - startTimestamp1;
-#endif
+    std::optional<ElementIndex> rotPointsPartition;
+    if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        rotPointsPartition = 0;
+    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep2, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        rotPointsPartition = 1;
+    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep3, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        rotPointsPartition = 2;
+    else if (mCurrentSimulationSequenceNumber.IsStepOf(RotPointsStep4, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        rotPointsPartition = 3;
 
-    ///////////////////////////////
-    // Parallel run 1 END
-    ///////////////////////////////
+    if (rotPointsPartition.has_value())
+    {
+        phaseGraph.AddPhase(
+            [&]()
+            {
+                // - Inputs: Position, Water, IsLeaking
+                // - Output: Decay
+                RotPoints(
+                    *rotPointsPartition, 4,
+                    currentSimulationTime,
+                    simulationParameters);
+            },
+            { UpdatePhaseResource::Position, UpdatePhaseResource::Water, UpdatePhaseResource::Leaking },
+            { UpdatePhaseResource::Decay });
+    }
 
     //
     // Run sinking/unsinking detection
@@ -614,57 +893,100 @@ void Ship::Update(
 
     if (mCurrentSimulationSequenceNumber.IsStepOf(UpdateSinkingStep, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        UpdateSinking(currentSimulationTime);
+        phaseGraph.AddPhase(
+            [&]()
+            {
+                // - Inputs: point aggregates
+                // - Tells NPCs, fires events
+                UpdateSinking(currentSimulationTime);
+            },
+            {},
+            { UpdatePhaseResource::Events, UpdatePhaseResource::World });
     }
 
-#ifdef _DEBUG
-    Verify(!mPoints.Diagnostic_ArePositionsDirty());
-#endif
-
     //
     // Update electrical dynamics
     //
 
-    // Generate a new visit sequence number
-    ++mCurrentElectricalVisitSequenceNumber;
+    phaseGraph.AddPhase(
+        [&]()
+        {
+            ScopedPerfMeasurement<PerfMeasurement::TotalShipsElectricalUpdate> const perfMeasurement(perfStats);
 
-    mElectricalElements.Update(
-        currentWallClockTime,
-        currentSimulationTime,
-        mCurrentElectricalVisitSequenceNumber,
-        mPoints,
-        mSprings,
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        stormParameters,
-        simulationParameters);
+            // Generate a new visit sequence number
+            ++mCurrentElectricalVisitSequenceNumber;
+
+            // - Inputs: P.Position, P.Water, P.Temperature
+            // - Outputs: P.Temperature (heat), P.StaticForces (engines), P.Leaking (pumps),
+            //            P.Water and hullness (watertight doors), ephemeral particles (smoke)
+            // - Fires events, uses the random engine
+            mElectricalElements.Update(
+                currentWallClockTime,
+                currentSimulationTime,
+                mCurrentElectricalVisitSequenceNumber,
+                mPoints,
+                mSprings,
+                effectiveAirDensity,
+                effectiveWaterDensity,
+                stormParameters,
+                simulationParameters);
+        },
+        { UpdatePhaseResource::Position },
+        {
+            UpdatePhaseResource::Water,
+            UpdatePhaseResource::Temperature,
+            UpdatePhaseResource::StaticForces,
+            UpdatePhaseResource::Leaking,
+            UpdatePhaseResource::Hullness,
+            UpdatePhaseResource::EphemeralParticles,
+            UpdatePhaseResource::Electricals,
+            UpdatePhaseResource::Events,
+            UpdatePhaseResource::RandomEngine
+        });
+
+    // Heat propagation re-discovers all points that are hot enough to ignite
+    mPoints.ClearCombustionCandidatePoints();
+
+    phaseGraph.Run(threadManager.GetSimulationThreadPool());
+
+    for (auto const & hotPoints : mHeatPropagationHotPoints)
+    {
+        mPoints.AddCombustionCandidatePoints(hotPoints);
+    }
+
+    // Publish static pressure stats
+    mSimulationEventHandler.OnStaticPressureUpdated(
+        mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
+        mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
+
+    ///////////////////////////////
+    // Parallel run 1 END
+    ///////////////////////////////
+
+#ifdef _DEBUG
+    Verify(!mPoints.Diagnostic_ArePositionsDirty());
+#endif
 
     //
     // Diffuse light
     //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
     //      - EL.AvailableLight depends on electricals which depend on water
     // - Outputs: P.Light
-    DiffuseLight(
-        simulationParameters,
-        threadManager);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsLightDiffusionUpdate> const perfMeasurement(perfStats);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedLightDiffusion = GameChronometer::Now() - startTimestamp1;
-#endif
+        DiffuseLight(
+            simulationParameters,
+            threadManager);
+    }
 
     //
     // Update slow combustion state machine
     //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
+    auto const combustionStartTime = GameChronometer::Now();
 
     if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
@@ -718,9 +1040,7 @@ void Ship::Update(
         mParentWorld.GetCurrentRadialWindField(),
         simulationParameters);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedCombustion = GameChronometer::Now() - startTimestamp1;
-#endif
+    perfStats.Update<PerfMeasurement::TotalShipsCombustionUpdate>(GameChronometer::Now() - combustionStartTime);
 
     //
     // Update highlights
@@ -738,10 +1058,6 @@ void Ship::Update(
     // Update spring parameters
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
         mSprings.UpdateForDecayAndTemperature(
@@ -767,25 +1083,17 @@ void Ship::Update(
             mPoints);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateSpringParameters = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////////////////////////////////////////
     // Update ephemeral particles
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    mPoints.UpdateEphemeralParticles(
-        currentSimulationTime,
-        simulationParameters);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsEphemeralParticlesUpdate> const perfMeasurement(perfStats);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateEphemeralParticles = GameChronometer::Now() - startTimestamp1;
-#endif
+        mPoints.UpdateEphemeralParticles(
+            currentSimulationTime,
+            simulationParameters);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Update cleanup
@@ -806,80 +1114,6 @@ void Ship::Update(
     VerifyInvariants();
 
 #endif
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateEndTimestamp = GameChronometer::Now();
-
-    static std::chrono::microseconds springRelaxationTotal{0};
-    static std::chrono::microseconds updateForStressTotal{0};
-    static std::chrono::microseconds rotPointsTotal{0};
-    static std::chrono::microseconds worldForcesTotal{0};
-    static std::chrono::microseconds waterDynamicsTotal{0};
-    static std::chrono::microseconds parallel1Total{0};
-    static std::chrono::microseconds lightDiffusionTotal{0};
-    static std::chrono::microseconds combustionTotal{0};
-    static std::chrono::microseconds updateSpringParametersTotal{0};
-    static std::chrono::microseconds waterDiffusionTotal{0};
-    static std::chrono::microseconds equalizeInternalPressureTotal{0};
-    static std::chrono::microseconds staticPressureTotal{0};
-    static std::chrono::microseconds heatPropagationTotal{0};
-    static std::chrono::microseconds ephemeralParticlesTotal{0};
-    static std::chrono::microseconds totalUpdateTotal{0};
-    static int profilingFrameCounter = 0;
-
-    springRelaxationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedSpringRelaxation);
-    updateForStressTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateForStress);
-    rotPointsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedRotPoints);
-    worldForcesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWorldForces);
-    waterDynamicsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDynamics);
-    parallel1Total += std::chrono::duration_cast<std::chrono::microseconds>(elapsedParallel1);
-    lightDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedLightDiffusion);
-    combustionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedCombustion);
-    updateSpringParametersTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateSpringParameters);
-    waterDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDiffusion);
-    equalizeInternalPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedEqualizeInternalPressure);
-    staticPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedStaticPressure);
-    heatPropagationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedHeatPropagation);
-    ephemeralParticlesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateEphemeralParticles);
-    totalUpdateTotal += std::chrono::duration_cast<std::chrono::microseconds>(updateEndTimestamp - updateStartTimestamp);
-    ++profilingFrameCounter;
-
-    if (0 == (profilingFrameCounter % 40))
-    {
-        LogMessage("*** Ship update: springRelax=", springRelaxationTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateForStress=", updateForStressTotal.count() / profilingFrameCounter / 1000.0f,
-                   " rotPoints=", rotPointsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " worldForces=", worldForcesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " waterDynamics=", waterDynamicsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " parallel1=", parallel1Total.count() / profilingFrameCounter / 1000.0f,
-                   " (waterDiffusion=", waterDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " equalizeInternalPressure=", equalizeInternalPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " staticPressure=", staticPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " heatPropagation=", heatPropagationTotal.count() / profilingFrameCounter / 1000.0f, ")",
-                   " lightDiffusion=", lightDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " combustion=", combustionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateSpringParameters=", updateSpringParametersTotal.count() / profilingFrameCounter / 1000.0f,
-                   " ephemeralParticles=", ephemeralParticlesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " total: ", totalUpdateTotal.count() / profilingFrameCounter / 1000.0f, "ms");
-
-        springRelaxationTotal = std::chrono::microseconds(0);
-        updateForStressTotal = std::chrono::microseconds(0);
-        rotPointsTotal = std::chrono::microseconds(0);
-        worldForcesTotal = std::chrono::microseconds(0);
-        waterDynamicsTotal = std::chrono::microseconds(0);
-        parallel1Total = std::chrono::microseconds(0);
-        lightDiffusionTotal = std::chrono::microseconds(0);
-        combustionTotal = std::chrono::microseconds(0);
-        updateSpringParametersTotal = std::chrono::microseconds(0);
-        waterDiffusionTotal = std::chrono::microseconds(0);
-        equalizeInternalPressureTotal = std::chrono::microseconds(0);
-        staticPressureTotal = std::chrono::microseconds(0);
-        heatPropagationTotal = std::chrono::microseconds(0);
-        ephemeralParticlesTotal = std::chrono::microseconds(0);
-        totalUpdateTotal = std::chrono::microseconds(0);
-        profilingFrameCounter = 0;
-    }
-#endif
 }
 
 void Ship::UpdateEnd()
@@ -898,7 +1132,10 @@ void Ship::UpdateEnd()
     mPoints.ResetIsElectrifiedBuffer();
 }
 
-void Ship::RenderUpload(RenderContext & renderContext)
+void Ship::RenderUpload(
+    RenderContext & renderContext,
+    float renderInterpolationFactor,
+    PerfStats & perfStats)
 {
     //
     // Run all tasks that need to run when connectivity has changed
@@ -912,6 +1149,8 @@ void Ship::RenderUpload(RenderContext & renderContext)
 
     if (mIsStructureDirty)
     {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsStructureUpdate> const perfMeasurement(perfStats);
+
         // Re-calculate connected components
         RunConnectivityVisit();
 
@@ -920,14 +1159,52 @@ void Ship::RenderUpload(RenderContext & renderContext)
 
         // Notify NPCs
         mParentWorld.GetNpcs().OnShipConnectivityChanged(mId);
+
+        // Elements have to be re-uploaded, whenever we're visible
+        mAreElementsDirtyForRendering = true;
+
+        mIsStructureDirty = false;
+    }
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
+
+    //
+    // Cull ship if it's not visible at all; we check the AABB of everything
+    // the ship renders - its points, its ephemeral particles, and its NPCs -
+    // extended by a margin accounting for whatever is rendered around points
+    // (flames, explosions, vectors, etc.)
+    //
+    // Note: all state that is dirty for rendering stays so while we're culled,
+    // and thus gets uploaded once we're visible again
+    //
+
+    {
+        float constexpr CullingMargin = 50.0f;
+
+        Geometry::AABB renderAabb = mPoints.CalculateRenderAABB();
+        renderAabb.ExtendTo(mParentWorld.GetNpcs().CalculateShipNpcAABB(mId));
+
+        VisibleWorld const & visibleWorld = renderContext.GetVisibleWorld();
+        Geometry::AABB const visibleWorldAabb(
+            visibleWorld.TopLeft.x,
+            visibleWorld.BottomRight.x,
+            visibleWorld.TopLeft.y,
+            visibleWorld.BottomRight.y);
+
+        bool const isVisible = visibleWorldAabb.Intersects(renderAabb, CullingMargin);
+
+        shipRenderContext.SetIsVisible(isVisible);
+
+        if (!isVisible)
+        {
+            return;
+        }
     }
 
     //
     // Initialize upload
     //
 
-    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
-
     shipRenderContext.UploadStart(mMaxMaxPlaneId);
 
     //////////////////////////////////////////////////////////////////////////////
@@ -936,18 +1213,25 @@ void Ship::RenderUpload(RenderContext & renderContext)
     // Upload points's immutable and mutable attributes
     //
 
-    mPoints.UploadAttributes(
-        mId,
-        renderContext);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsPointsRenderUpload> const perfMeasurement(perfStats);
+
+        mPoints.UploadAttributes(
+            mId,
+            renderContext,
+            renderInterpolationFactor);
+    }
 
     //
     // Upload elements, if needed
     //
 
-    if (mIsStructureDirty
+    if (mAreElementsDirtyForRendering
         || !mLastUploadedDebugShipRenderMode
         || *mLastUploadedDebugShipRenderMode != renderContext.GetDebugShipRenderMode())
     {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsElementsRenderUpload> const perfMeasurement(perfStats);
+
         shipRenderContext.UploadElementsStart();
 
         //
@@ -973,19 +1257,15 @@ void Ship::RenderUpload(RenderContext & renderContext)
         // (we can't upload more frequently as mPlaneTriangleIndicesToRender is a one-time use)
         //
 
-        if (mIsStructureDirty)
+        if (mAreElementsDirtyForRendering)
         {
             assert(mPlaneTriangleIndicesToRender.size() >= 1);
 
-            shipRenderContext.UploadElementTrianglesStart(mPlaneTriangleIndicesToRender.back());
-
             mTriangles.UploadElements(
                 mId,
                 mPlaneTriangleIndicesToRender,
                 mPoints,
                 renderContext);
-
-            shipRenderContext.UploadElementTrianglesEnd();
         }
 
         shipRenderContext.UploadElementsEnd();
@@ -1030,9 +1310,13 @@ void Ship::RenderUpload(RenderContext & renderContext)
     // Upload frontiers
     //
 
-    mFrontiers.Upload(
-        mId,
-        renderContext);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsFrontiersRenderUpload> const perfMeasurement(perfStats);
+
+        mFrontiers.Upload(
+            mId,
+            renderContext);
+    }
 
     //
     // Upload flames
@@ -1111,7 +1395,7 @@ void Ship::RenderUpload(RenderContext & renderContext)
     // Reset render state
     //
 
-    mIsStructureDirty = false;
+    mAreElementsDirtyForRendering = false;
     mLastUploadedDebugShipRenderMode = renderContext.GetDebugShipRenderMode();
 }
 
@@ -1147,6 +1431,13 @@ void Ship::Finalize()
 
 void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationParameters)
 {
+    //
+    // Interactions that act on a region or on a single point visit only their own points;
+    // interactions that act on all points are fused into one single pass over the points
+    //
+
+    bool hasFieldInteractions = false;
+
     for (auto const & interaction : mQueuedInteractions)
     {
         switch (interaction.Type)
@@ -1158,13 +1449,6 @@ void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationP
                 break;
             }
 
-            case Interaction::InteractionType::Draw:
-            {
-                DrawTo(interaction.Arguments.Draw);
-
-                break;
-            }
-
             case Interaction::InteractionType::Pull:
             {
                 Pull(interaction.Arguments.Pull);
@@ -1172,15 +1456,21 @@ void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationP
                 break;
             }
 
+            case Interaction::InteractionType::Draw:
             case Interaction::InteractionType::Swirl:
             {
-                SwirlAt(interaction.Arguments.Swirl);
+                hasFieldInteractions = true;
 
                 break;
             }
         }
     }
 
+    if (hasFieldInteractions)
+    {
+        ApplyQueuedFieldInteractionForces();
+    }
+
     mQueuedInteractions.clear();
 }
 
@@ -1188,16 +1478,17 @@ void Ship::ApplyWorldForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
     SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager,
     Geometry::ShipAABBSet & externalAabbSet) // output
 {
     // New buffer to which new cached depths will be written to
-    std::shared_ptr<Buffer<float>> newCachedPointDepths = mPoints.AllocateWorkBufferFloat();
+    auto const newCachedPointDepths = mPoints.AllocateWorkBufferFloat();
 
     //
     // Particle forces
     //
 
-    ApplyWorldParticleForces(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, simulationParameters);
+    ApplyWorldParticleForces(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, simulationParameters, threadManager);
 
     //
     // Surface forces
@@ -1212,11 +1503,59 @@ void Ship::ApplyWorldForces(
     mPoints.SwapCachedDepthBuffer(*newCachedPointDepths);
 }
 
+void Ship::RecalculateWorldParticleForcesParallelism(size_t simulationParallelism)
+{
+    // Clear threading state
+    mWorldParticleForcesPointRanges.clear();
+    mWorldParticleForcesPartitionAggregates.clear();
+
+    //
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for world particle forces
+    //
+
+    ElementCount const numberOfPoints = mPoints.GetBufferElementCount(); // Includes ephemerals, as they feel world forces
+
+    ElementCount constexpr PointsPerThread = 5000;
+
+    size_t const worldParticleForcesParallelism = std::max(
+        std::min(static_cast<size_t>(numberOfPoints) / PointsPerThread, simulationParallelism),
+        size_t(1));
+
+    LogMessage("Ship::RecalculateWorldParticleForcesParallelism: points=", numberOfPoints, " simulationParallelism=", simulationParallelism,
+        " worldParticleForcesParallelism=", worldParticleForcesParallelism);
+
+    //
+    // Prepare point ranges
+    //
+    // We want each thread to work on a multiple of our vectorization word size
+    //
+
+    assert(numberOfPoints >= static_cast<ElementCount>(worldParticleForcesParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(worldParticleForcesParallelism) * vectorization_float_count<ElementCount>);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < worldParticleForcesParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < worldParticleForcesParallelism - 1)
+            ? pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>
+            : numberOfPoints;
+
+        assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
+
+        mWorldParticleForcesPointRanges.emplace_back(pointStart, pointEnd);
+        mWorldParticleForcesPartitionAggregates.emplace_back();
+
+        pointStart = pointEnd;
+    }
+}
+
 void Ship::ApplyWorldParticleForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
     Buffer<float> & newCachedPointDepths,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     // Global wind force
     vec2f const globalWindForce = Formulae::WindSpeedToForceDensity(
@@ -1237,80 +1576,74 @@ void Ship::ApplyWorldParticleForces(
 
     float * const restrict newCachedPointDepthsBuffer = newCachedPointDepths.data();
     vec2f * const restrict staticForcesBuffer = mPoints.GetStaticForceBufferAsVec2();
+    float const * const restrict pointWaterBuffer = mPoints.GetWaterBufferAsFloat();
+
+    ElementIndex const shipPointCount = mPoints.GetRawShipPointCount();
 
     //
-    // 1. Various world forces
+    // 1. Calculate and store depths, and apply gravity, buoyancy, friction drag,
+    //    and global wind - concurrently on point partitions; also aggregate the
+    //    partitions' ship points
     //
 
-    for (auto pointIndex : mPoints.BufferElements())
-    {
-        vec2f staticForce = vec2f::zero();
-
-        //
-        // Calculate and store depth
-        //
-
-        newCachedPointDepthsBuffer[pointIndex] = oceanSurface.GetDepth(mPoints.GetPosition(pointIndex));
-
-        //
-        // Calculate above/under-water coefficient
-        //
-        // 0.0: above water
-        // 1.0: under water
-        // in-between: smooth air-water interface (nature abhors discontinuities)
-        //
-
-        float const airWaterInterfaceInverseWidth = mPoints.GetAirWaterInterfaceInverseWidth(pointIndex);
-        float const uwCoefficient = Clamp(newCachedPointDepthsBuffer[pointIndex] * airWaterInterfaceInverseWidth, 0.0f, 1.0f);
-
-        //
-        // Apply gravity
-        //
-
-        staticForce +=
-            SimulationParameters::Gravity
-            * mPoints.GetMass(pointIndex); // Material + Augmentation + Water
+    std::vector<typename ThreadPool::Task> worldParticleForcesTasks;
+    worldParticleForcesTasks.reserve(mWorldParticleForcesPointRanges.size());
 
-        //
-        // Apply water/air buoyancy
-        //
+    assert(mWorldParticleForcesPartitionAggregates.size() == mWorldParticleForcesPointRanges.size());
 
-        // Calculate upward push of water/air mass
-        auto const & buoyancyCoefficients = mPoints.GetBuoyancyCoefficients(pointIndex);
-        float const buoyancyPush =
-            buoyancyCoefficients.Coefficient1
-            + buoyancyCoefficients.Coefficient2 * mPoints.GetTemperature(pointIndex);
-
-        // Apply buoyancy
-        staticForce.y +=
-            buoyancyPush
-            * Mix(effectiveAirDensity, effectiveWaterDensity, uwCoefficient);
+    for (size_t t = 0; t < mWorldParticleForcesPointRanges.size(); ++t)
+    {
+        worldParticleForcesTasks.emplace_back(
+            [&, t]()
+            {
+                auto const & pointRange = mWorldParticleForcesPointRanges[t];
+
+                oceanSurface.GetDepths(
+                    mPoints.GetPositionBufferAsVec2() + pointRange.first,
+                    newCachedPointDepthsBuffer + pointRange.first,
+                    pointRange.second - pointRange.first);
+
+                Algorithms::ApplyWorldParticleForces(
+                    pointRange.first,
+                    pointRange.second,
+                    newCachedPointDepthsBuffer,
+                    mPoints.GetAirWaterInterfaceInverseWidthBufferAsFloat(),
+                    mPoints.GetMassBufferAsFloat(),
+                    mPoints.GetBuoyancyCoefficientsBuffer(),
+                    mPoints.GetTemperatureBufferAsFloat(),
+                    mPoints.GetVelocityBufferAsVec2(),
+                    mPoints.GetMaterialWindReceptivityBufferAsFloat(),
+                    SimulationParameters::Gravity,
+                    effectiveAirDensity,
+                    effectiveWaterDensity,
+                    airFrictionDragCoefficient,
+                    waterFrictionDragCoefficient,
+                    globalWindForce,
+                    staticForcesBuffer);
 
-        //
-        // Apply friction drag
-        //
-        // We use a linear law for simplicity.
-        //
-        // With a linear law, we know that the force will never overcome the current velocity
-        // as long as m > (C * dt) (~=0.0016 for water drag), which is a mass we won't have in our system (air is 1.2754);
-        // hence we don't care here about capping the force to prevent overcoming accelerations.
-        //
+                // Ephemerals are at the end
+                ElementIndex const shipPointEnd = std::min(pointRange.second, shipPointCount);
 
-        staticForce +=
-            -mPoints.GetVelocity(pointIndex)
-            * Mix(airFrictionDragCoefficient, waterFrictionDragCoefficient, uwCoefficient);
+                ElementCount wetPointCount = 0;
+                ElementCount underwaterPointCount = 0;
+                for (ElementIndex p = pointRange.first; p < shipPointEnd; ++p)
+                {
+                    wetPointCount += (pointWaterBuffer[p] >= WetPointWaterThreshold) ? 1 : 0;
+                    underwaterPointCount += (newCachedPointDepthsBuffer[p] > 0.0f) ? 1 : 0;
+                }
 
-        //
-        // Global (linear) wind force
-        //
+                mWorldParticleForcesPartitionAggregates[t].WetPointCount = wetPointCount;
+                mWorldParticleForcesPartitionAggregates[t].UnderwaterPointCount = underwaterPointCount;
+            });
+    }
 
-        // Note: should be based on relative velocity, but we simplify here for performance reasons
-        staticForce +=
-            globalWindForce
-            * mPoints.GetMaterialWindReceptivity(pointIndex)
-            * (1.0f - uwCoefficient); // Only above-water (modulated)
+    threadManager.GetSimulationThreadPool().Run(worldParticleForcesTasks);
 
-        staticForcesBuffer[pointIndex] += staticForce;
+    mPointAggregates = PointAggregates();
+    for (auto const & partitionAggregates : mWorldParticleForcesPartitionAggregates)
+    {
+        mPointAggregates.WetPointCount += partitionAggregates.WetPointCount;
+        mPointAggregates.UnderwaterPointCount += partitionAggregates.UnderwaterPointCount;
     }
 
     //
@@ -1320,38 +1653,59 @@ void Ship::ApplyWorldParticleForces(
     auto const & radialWindField = mParentWorld.GetCurrentRadialWindField();
     if (radialWindField.has_value())
     {
-        for (auto pointIndex : mPoints.BufferElements())
-        {
-            // Only above-water points
-            if (newCachedPointDepthsBuffer[pointIndex] <= 0.0f)
+        float const squarePreFrontRadius = radialWindField->PreFrontRadius * radialWindField->PreFrontRadius;
+
+        auto const applyRadialWind =
+            [&](ElementIndex pointIndex)
             {
-                vec2f const pointPosition = mPoints.GetPosition(pointIndex);
-                vec2f const displacement = pointPosition - radialWindField->SourcePos;
-                float const radius = displacement.length();
-                if (radius < radialWindField->PreFrontRadius) // Within sphere
+                // Only above-water points
+                if (newCachedPointDepthsBuffer[pointIndex] <= 0.0f)
                 {
-                    // Calculate force magnitude
-                    float windForceMagnitude;
-                    if (radius < radialWindField->MainFrontRadius)
+                    vec2f const pointPosition = mPoints.GetPosition(pointIndex);
+                    vec2f const displacement = pointPosition - radialWindField->SourcePos;
+                    float const squareRadius = displacement.squareLength();
+                    if (squareRadius < squarePreFrontRadius) // Within sphere
                     {
-                        windForceMagnitude = radialWindField->MainFrontWindForceMagnitude;
-                    }
-                    else
-                    {
-                        windForceMagnitude = radialWindField->PreFrontWindForceMagnitude;
-                    }
+                        float const radius = std::sqrt(squareRadius);
+
+                        // Calculate force magnitude
+                        float windForceMagnitude;
+                        if (radius < radialWindField->MainFrontRadius)
+                        {
+                            windForceMagnitude = radialWindField->MainFrontWindForceMagnitude;
+                        }
+                        else
+                        {
+                            windForceMagnitude = radialWindField->PreFrontWindForceMagnitude;
+                        }
 
-                    // Calculate force
-                    vec2f const force =
-                        displacement.normalise_approx(radius)
-                        * windForceMagnitude
-                        * mPoints.GetMaterialWindReceptivity(pointIndex);
+                        // Calculate force
+                        vec2f const force =
+                            displacement.normalise_approx(radius)
+                            * windForceMagnitude
+                            * mPoints.GetMaterialWindReceptivity(pointIndex);
 
-                    // Apply force
-                    staticForcesBuffer[pointIndex] += force;
+                        // Apply force
+                        staticForcesBuffer[pointIndex] += force;
+                    }
                 }
+            };
+
+        // Ship points - unless the ship is entirely outside of the sphere
+        Geometry::AABB const shipAABB = mPoints.CalculateAABB();
+        vec2f const shipAABBClosestPosition = vec2f(
+            Clamp(radialWindField->SourcePos.x, shipAABB.BottomLeft.x, shipAABB.TopRight.x),
+            Clamp(radialWindField->SourcePos.y, shipAABB.BottomLeft.y, shipAABB.TopRight.y));
+        if ((shipAABBClosestPosition - radialWindField->SourcePos).squareLength() < squarePreFrontRadius)
+        {
+            for (auto pointIndex : mPoints.RawShipPoints())
+            {
+                applyRadialWind(pointIndex);
             }
         }
+
+        // Ephemeral particles - only the live ones
+        mPoints.VisitLiveEphemeralParticles(applyRadialWind);
     }
 }
 
@@ -2025,88 +2379,134 @@ void Ship::HandleCollisionsWithSeaFloor(
     float const siltingFactor1 = simulationParameters.OceanFloorSiltHardness;
     float const siltingFactor2 = 1.0f - simulationParameters.OceanFloorSiltHardness;
 
-    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+    // Points are processed in chunks: chunks entirely above the floor are rejected at once,
+    // and for the others the floor height is sampled for all points at once
+    ElementCount constexpr ChunkSize = 64;
+    alignas(16) float oceanFloorHeights[ChunkSize];
+
+    vec2f const * const positionBuffer = mPoints.GetPositionBufferAsVec2();
+
+    for (ElementIndex chunkStartPointIndex = startPointIndex; chunkStartPointIndex < endPointIndex; chunkStartPointIndex += ChunkSize)
     {
-        auto const & position = mPoints.GetPosition(pointIndex);
+        ElementIndex const chunkEndPointIndex = std::min(chunkStartPointIndex + ChunkSize, endPointIndex);
 
-        // Check if point is below the sea floor
         //
-        // At this moment the point might be outside of world boundaries,
-        // so better clamp its x before sampling ocean floor height
-        float const clampedX = Clamp(position.x, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth);
-        auto const [isUnderneathFloor, oceanFloorHeight, integralIndex] = oceanFloor.GetHeightIfUnderneathAt(clampedX, position.y);
-        if (isUnderneathFloor)
+        // Rough check: whole chunk above the floor
+        //
+
+        float minX = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float minY = std::numeric_limits<float>::max();
+        for (ElementIndex pointIndex = chunkStartPointIndex; pointIndex < chunkEndPointIndex; ++pointIndex)
         {
-            // Collision!
+            minX = std::min(minX, positionBuffer[pointIndex].x);
+            maxX = std::max(maxX, positionBuffer[pointIndex].x);
+            minY = std::min(minY, positionBuffer[pointIndex].y);
+        }
 
-            //
-            // Calculate post-bounce velocity
-            //
+        if (minY > oceanFloor.GetMaxHeightIn(minX, maxX))
+        {
+            continue;
+        }
 
-            vec2f const pointVelocity = mPoints.GetVelocity(pointIndex);
+        //
+        // Sample floor for all points in the chunk
+        //
+        // At this moment points might be outside of world boundaries,
+        // and sampling clamps their x
+        //
+
+        oceanFloor.GetHeightsAt(
+            positionBuffer + chunkStartPointIndex,
+            oceanFloorHeights,
+            chunkEndPointIndex - chunkStartPointIndex);
 
-            // Calculate sea floor anti-normal
-            // (positive points down)
-            vec2f const seaFloorAntiNormal = -oceanFloor.GetNormalAt(integralIndex);
+        for (ElementIndex pointIndex = chunkStartPointIndex; pointIndex < chunkEndPointIndex; ++pointIndex)
+        {
+            auto const & position = mPoints.GetPosition(pointIndex);
 
-            // Calculate the component of the point's velocity along the anti-normal,
-            // i.e. towards the interior of the floor...
-            float const pointVelocityAlongAntiNormal = pointVelocity.dot(seaFloorAntiNormal);
+            if (position.y >= oceanFloorHeights[pointIndex - chunkStartPointIndex])
+            {
+                // Above the floor
+                continue;
+            }
 
-            // ...if negative, it's already pointing outside the floor, hence we leave it as-is
-            if (pointVelocityAlongAntiNormal > 0.0f)
+            // Check again, also getting the floor's sample index
+            float const clampedX = Clamp(position.x, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth);
+            auto const [isUnderneathFloor, oceanFloorHeight, integralIndex] = oceanFloor.GetHeightIfUnderneathAt(clampedX, position.y);
+            if (isUnderneathFloor)
             {
-                // Decompose point velocity into normal and tangential
-                vec2f const normalVelocity = seaFloorAntiNormal * pointVelocityAlongAntiNormal;
-                vec2f const tangentialVelocity = pointVelocity - normalVelocity;
-
-                // Calculate normal reponse: Vn' = -e*Vn (e = elasticity, [0.0 - 1.0])
-                float const elasticityFactor = mPoints.GetOceanFloorCollisionFactors(pointIndex).ElasticityFactor;
-                vec2f const normalResponse =
-                    normalVelocity
-                    * elasticityFactor; // Already negative
-
-                // Calculate tangential response: Vt' = a*Vt (a = (1.0-friction), [0.0 - 1.0])
-                float constexpr KineticThreshold = 2.0f;
-                float const frictionFactor = (std::abs(tangentialVelocity.x) > KineticThreshold || std::abs(tangentialVelocity.y) > KineticThreshold)
-                    ? mPoints.GetOceanFloorCollisionFactors(pointIndex).KineticFrictionFactor
-                    : mPoints.GetOceanFloorCollisionFactors(pointIndex).StaticFrictionFactor;
-                vec2f const tangentialResponse =
-                    tangentialVelocity
-                    * frictionFactor;
-
-                // Calculate floor hardness:
-                //  0.0: full silting - i.e. burrowing into floor; also zero accumulation of velocity
-                //  1.0: full restore of before-impact position; also full impact response velocity
-                // As follows:
-                //  Changes from current param (e.g. 0.5) to 1.0 linearly with magnitude of velocity, up to a maximum velocity at which
-                //  moment hardness is max/1.0 (simulating mud where you borrow when still and stay still if move)
-                float const velocitySquared = pointVelocity.squareLength();
-                float constexpr MaxVelocityForSilting = 2.0f; // Empirical - was 10.0 < 1.19
-                float const floorHardness = (oceanFloorHeight - position.y < 40.f) // Just make sure won't ever get buried too deep
-                    ? siltingFactor1 + siltingFactor2 * LinearStep(0.0f, MaxVelocityForSilting, velocitySquared) // The faster, the less silting
-                    : 1.0f;
-
-                assert(floorHardness <= 1.0f);
+                // Collision!
 
                 //
-                // Impart final position and velocity
+                // Calculate post-bounce velocity
                 //
 
-                // Move point back along its velocity direction (i.e. towards where it was in the previous step,
-                // which is guaranteed to be more towards the outside), but not too much - or else springs
-                // might start oscillating between the point burrowing down and then bouncing up
-                vec2f deltaPosition = pointVelocity * dt * floorHardness;
-                float const deltaPositionLength = deltaPosition.length();
-                deltaPosition = deltaPosition.normalise_approx(deltaPositionLength) * std::min(deltaPositionLength, 0.01f); // Magic number, empirical
-                mPoints.SetPosition(
-                    pointIndex,
-                    position - deltaPosition);
+                vec2f const pointVelocity = mPoints.GetVelocity(pointIndex);
 
-                // Set velocity to resultant collision velocity
-                mPoints.SetVelocity(
-                    pointIndex,
-                    (normalResponse + tangentialResponse) * floorHardness);
+                // Calculate sea floor anti-normal
+                // (positive points down)
+                vec2f const seaFloorAntiNormal = -oceanFloor.GetNormalAt(integralIndex);
+
+                // Calculate the component of the point's velocity along the anti-normal,
+                // i.e. towards the interior of the floor...
+                float const pointVelocityAlongAntiNormal = pointVelocity.dot(seaFloorAntiNormal);
+
+                // ...if negative, it's already pointing outside the floor, hence we leave it as-is
+                if (pointVelocityAlongAntiNormal > 0.0f)
+                {
+                    // Decompose point velocity into normal and tangential
+                    vec2f const normalVelocity = seaFloorAntiNormal * pointVelocityAlongAntiNormal;
+                    vec2f const tangentialVelocity = pointVelocity - normalVelocity;
+
+                    // Calculate normal reponse: Vn' = -e*Vn (e = elasticity, [0.0 - 1.0])
+                    float const elasticityFactor = mPoints.GetOceanFloorCollisionFactors(pointIndex).ElasticityFactor;
+                    vec2f const normalResponse =
+                        normalVelocity
+                        * elasticityFactor; // Already negative
+
+                    // Calculate tangential response: Vt' = a*Vt (a = (1.0-friction), [0.0 - 1.0])
+                    float constexpr KineticThreshold = 2.0f;
+                    float const frictionFactor = (std::abs(tangentialVelocity.x) > KineticThreshold || std::abs(tangentialVelocity.y) > KineticThreshold)
+                        ? mPoints.GetOceanFloorCollisionFactors(pointIndex).KineticFrictionFactor
+                        : mPoints.GetOceanFloorCollisionFactors(pointIndex).StaticFrictionFactor;
+                    vec2f const tangentialResponse =
+                        tangentialVelocity
+                        * frictionFactor;
+
+                    // Calculate floor hardness:
+                    //  0.0: full silting - i.e. burrowing into floor; also zero accumulation of velocity
+                    //  1.0: full restore of before-impact position; also full impact response velocity
+                    // As follows:
+                    //  Changes from current param (e.g. 0.5) to 1.0 linearly with magnitude of velocity, up to a maximum velocity at which
+                    //  moment hardness is max/1.0 (simulating mud where you borrow when still and stay still if move)
+                    float const velocitySquared = pointVelocity.squareLength();
+                    float constexpr MaxVelocityForSilting = 2.0f; // Empirical - was 10.0 < 1.19
+                    float const floorHardness = (oceanFloorHeight - position.y < 40.f) // Just make sure won't ever get buried too deep
+                        ? siltingFactor1 + siltingFactor2 * LinearStep(0.0f, MaxVelocityForSilting, velocitySquared) // The faster, the less silting
+                        : 1.0f;
+
+                    assert(floorHardness <= 1.0f);
+
+                    //
+                    // Impart final position and velocity
+                    //
+
+                    // Move point back along its velocity direction (i.e. towards where it was in the previous step,
+                    // which is guaranteed to be more towards the outside), but not too much - or else springs
+                    // might start oscillating between the point burrowing down and then bouncing up
+                    vec2f deltaPosition = pointVelocity * dt * floorHardness;
+                    float const deltaPositionLength = deltaPosition.length();
+                    deltaPosition = deltaPosition.normalise_approx(deltaPositionLength) * std::min(deltaPositionLength, 0.01f); // Magic number, empirical
+                    mPoints.SetPosition(
+                        pointIndex,
+                        position - deltaPosition);
+
+                    // Set velocity to resultant collision velocity
+                    mPoints.SetVelocity(
+                        pointIndex,
+                        (normalResponse + tangentialResponse) * floorHardness);
+                }
             }
         }
     }
@@ -2127,57 +2527,166 @@ void Ship::TrimForWorldBounds(SimulationParameters const & simulationParameters)
     // We clamp velocity to damp system instabilities at extreme events
     static constexpr float MaxBounceVelocity = 150.0f; // Magic number
 
-    // Visit all points
+    // Points are practically never out of bounds, hence we check the bounds of blocks
+    // of points, and only visit the points of the rare blocks that are out of bounds
+    ElementCount constexpr BlockSize = 256;
+    static_assert((BlockSize % vectorization_float_count<ElementCount>) == 0);
+
     vec2f * const restrict positionBuffer = mPoints.GetPositionBufferAsVec2();
     vec2f * const restrict velocityBuffer = mPoints.GetVelocityBufferAsVec2();
-    size_t const count = mPoints.GetBufferElementCount();
-    for (size_t p = 0; p < count; ++p)
+    ElementCount const count = mPoints.GetBufferElementCount();
+    for (ElementIndex blockStart = 0; blockStart < count; blockStart += BlockSize)
     {
-        auto const & pos = positionBuffer[p];
+        ElementIndex const blockEnd = std::min(blockStart + BlockSize, count);
 
-        if (pos.x < MaxWorldLeft)
+        Geometry::AABB const blockAABB = Algorithms::MakePointsAABB(blockStart, blockEnd, positionBuffer);
+        if (blockAABB.BottomLeft.x >= MaxWorldLeft
+            && blockAABB.TopRight.x <= MaxWorldRight
+            && blockAABB.TopRight.y <= MaxWorldTop
+            && blockAABB.BottomLeft.y >= MaxWorldBottom)
         {
-            // Simulate bounce, bounded
-            positionBuffer[p].x = std::min(MaxWorldLeft + elasticity * (MaxWorldLeft - pos.x), 0.0f);
-
-            // Bounce bounded
-            velocityBuffer[p].x = std::min(-velocityBuffer[p].x, MaxBounceVelocity);
+            // All in bounds
+            continue;
         }
-        else if (pos.x > MaxWorldRight)
+
+        for (ElementIndex p = blockStart; p < blockEnd; ++p)
         {
-            // Simulate bounce, bounded
-            positionBuffer[p].x = std::max(MaxWorldRight - elasticity * (pos.x - MaxWorldRight), 0.0f);
+            auto const & pos = positionBuffer[p];
+
+            if (pos.x < MaxWorldLeft)
+            {
+                // Simulate bounce, bounded
+                positionBuffer[p].x = std::min(MaxWorldLeft + elasticity * (MaxWorldLeft - pos.x), 0.0f);
 
-            // Bounce bounded
-            velocityBuffer[p].x = std::max(-velocityBuffer[p].x, -MaxBounceVelocity);
+                // Bounce bounded
+                velocityBuffer[p].x = std::min(-velocityBuffer[p].x, MaxBounceVelocity);
+            }
+            else if (pos.x > MaxWorldRight)
+            {
+                // Simulate bounce, bounded
+                positionBuffer[p].x = std::max(MaxWorldRight - elasticity * (pos.x - MaxWorldRight), 0.0f);
+
+                // Bounce bounded
+                velocityBuffer[p].x = std::max(-velocityBuffer[p].x, -MaxBounceVelocity);
+            }
+
+            if (pos.y > MaxWorldTop)
+            {
+                // Simulate bounce, bounded
+                positionBuffer[p].y = std::max(MaxWorldTop - elasticity * (pos.y - MaxWorldTop), 0.0f);
+
+                // Bounce bounded
+                velocityBuffer[p].y = std::max(-velocityBuffer[p].y, -MaxBounceVelocity);
+            }
+            else if (pos.y < MaxWorldBottom)
+            {
+                // Simulate bounce, bounded
+                positionBuffer[p].y = std::min(MaxWorldBottom + elasticity * (MaxWorldBottom - pos.y), 0.0f);
+
+                // Bounce bounded
+                velocityBuffer[p].y = std::min(-velocityBuffer[p].y, MaxBounceVelocity);
+            }
+
+            assert(positionBuffer[p].x >= MaxWorldLeft);
+            assert(positionBuffer[p].x <= MaxWorldRight);
+            assert(positionBuffer[p].y >= MaxWorldBottom);
+            assert(positionBuffer[p].y <= MaxWorldTop);
         }
+    }
 
-        if (pos.y > MaxWorldTop)
-        {
-            // Simulate bounce, bounded
-            positionBuffer[p].y = std::max(MaxWorldTop - elasticity * (pos.y - MaxWorldTop), 0.0f);
+#ifdef _DEBUG
+    mPoints.Diagnostic_MarkPositionsAsDirty();
+#endif
 
-            // Bounce bounded
-            velocityBuffer[p].y = std::max(-velocityBuffer[p].y, -MaxBounceVelocity);
+    // Points have moved
+    mIsPointSpatialGridDirty = true;
+}
+
+SpatialGrid const & Ship::GetPointSpatialGrid() const
+{
+    if (mIsPointSpatialGridDirty)
+    {
+        mPointSpatialGrid.Rebuild(
+            mPoints.GetPositionBufferAsVec2(),
+            0,
+            mPoints.GetRawShipPointCount());
+
+        mIsPointSpatialGridDirty = false;
+    }
+
+    return mPointSpatialGrid;
+}
+
+std::vector<ElementIndex> const & Ship::GetLightningTargetCandidatePoints() const
+{
+    // Width of the vertical strips of the ship each contributing its topmost point
+    float constexpr StripWidth = 1.0f;
+
+    // Candidates are found in world space, hence they drift off the top as the ship rotates;
+    // we bound that by finding them again after a while, even if the structure hasn't changed
+    float constexpr MaxCandidatesAge = 30.0f;
+
+    float const currentSimulationTime = mParentWorld.GetCurrentSimulationTime();
+
+    if (mAreLightningTargetCandidatePointsDirty
+        || currentSimulationTime - mLightningTargetCandidatePointsSimulationTime > MaxCandidatesAge)
+    {
+        mLightningTargetCandidatePoints.clear();
+
+        //
+        // Find extent of the non-deleted, non-orphaned points
+        //
+
+        float minX = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        for (auto const pointIndex : mPoints.RawShipPoints())
+        {
+            if (mPoints.IsActive(pointIndex)
+                && !mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+            {
+                minX = std::min(minX, mPoints.GetPosition(pointIndex).x);
+                maxX = std::max(maxX, mPoints.GetPosition(pointIndex).x);
+            }
         }
-        else if (pos.y < MaxWorldBottom)
+
+        if (minX <= maxX)
         {
-            // Simulate bounce, bounded
-            positionBuffer[p].y = std::min(MaxWorldBottom + elasticity * (MaxWorldBottom - pos.y), 0.0f);
+            //
+            // Find topmost point of each strip
+            //
+
+            size_t const stripCount = static_cast<size_t>((maxX - minX) / StripWidth) + 1;
+            std::vector<ElementIndex> stripTopPoints(stripCount, NoneElementIndex);
 
-            // Bounce bounded
-            velocityBuffer[p].y = std::min(-velocityBuffer[p].y, MaxBounceVelocity);
+            for (auto const pointIndex : mPoints.RawShipPoints())
+            {
+                if (mPoints.IsActive(pointIndex)
+                    && !mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+                {
+                    auto const & pos = mPoints.GetPosition(pointIndex);
+                    size_t const s = std::min(static_cast<size_t>((pos.x - minX) / StripWidth), stripCount - 1);
+                    if (stripTopPoints[s] == NoneElementIndex
+                        || pos.y > mPoints.GetPosition(stripTopPoints[s]).y)
+                    {
+                        stripTopPoints[s] = pointIndex;
+                    }
+                }
+            }
+
+            for (auto const pointIndex : stripTopPoints)
+            {
+                if (pointIndex != NoneElementIndex)
+                {
+                    mLightningTargetCandidatePoints.push_back(pointIndex);
+                }
+            }
         }
 
-        assert(positionBuffer[p].x >= MaxWorldLeft);
-        assert(positionBuffer[p].x <= MaxWorldRight);
-        assert(positionBuffer[p].y >= MaxWorldBottom);
-        assert(positionBuffer[p].y <= MaxWorldTop);
+        mAreLightningTargetCandidatePointsDirty = false;
+        mLightningTargetCandidatePointsSimulationTime = currentSimulationTime;
     }
 
-#ifdef _DEBUG
-    mPoints.Diagnostic_MarkPositionsAsDirty();
-#endif
+    return mLightningTargetCandidatePoints;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -2190,6 +2699,7 @@ void Ship::UpdatePressureAndWaterInflow(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
     SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager,
     float & waterTakenInStep)
 {
     //
@@ -2199,222 +2709,308 @@ void Ship::UpdatePressureAndWaterInflow(
     // Ephemeral points are never leaking, hence we ignore them
     //
 
-    // Multiplier to get internal pressure delta from water delta
-    float const volumetricWaterPressure = Formulae::CalculateVolumetricWaterPressure(simulationParameters.WaterTemperature, simulationParameters);
+    // We only visit the points that are leaking, as we expect a tiny fraction of all
+    // points to be leaking at any moment - and an intact ship to have none at all
+    auto const & leakingPoints = mPoints.GetLeakingPoints();
+    if (leakingPoints.empty())
+    {
+        return;
+    }
 
-    // Equivalent depth of a point when it's exposed to rain
-    float const rainEquivalentWaterHeight =
+    WaterInflowParameters const waterInflowParameters(
+        effectiveAirDensity,
+        effectiveWaterDensity,
+        // Multiplier to get internal pressure delta from water delta
+        Formulae::CalculateVolumetricWaterPressure(simulationParameters.WaterTemperature, simulationParameters),
+        // Equivalent depth of a point when it's exposed to rain
         stormParameters.RainQuantity // m/h
-        / 3600.0f // -> m/s
-        * SimulationParameters::SimulationStepTimeDuration<float> // -> m/step
-        * simulationParameters.RainFloodAdjustment;
-
-    float const waterPumpPowerMultiplier =
+            / 3600.0f // -> m/s
+            * SimulationParameters::SimulationStepTimeDuration<float> // -> m/step
+            * simulationParameters.RainFloodAdjustment,
         simulationParameters.WaterPumpPowerAdjustment
-        * (simulationParameters.IsUltraViolentMode ? 20.0f : 1.0f);
+            * (simulationParameters.IsUltraViolentMode ? 20.0f : 1.0f),
+        SimulationParameters::AirBubblesDensityToCumulatedIntakenWater(simulationParameters.AirBubblesDensity),
+        simulationParameters.AirBubblesDensity != 0.0f);
 
-    bool const doGenerateAirBubbles = (simulationParameters.AirBubblesDensity != 0.0f);
+    //
+    // 1. Update pressure and water - concurrently on partitions of the leaking points,
+    //    collecting the points that are due to produce air bubbles
+    //
 
-    float const cumulatedIntakenWaterThresholdForAirBubbles =
-        SimulationParameters::AirBubblesDensityToCumulatedIntakenWater(simulationParameters.AirBubblesDensity);
+    size_t constexpr LeakingPointsPerThread = 500;
 
-    for (auto pointIndex : mPoints.RawShipPoints())
-    {
-        // This is one of the few cases in which we prefer branching over calculating
-        // for all points, mostly because we expect a tiny fraction of all points to
-        // be leaking at any moment
-        auto const & pointCompositeLeaking = mPoints.GetLeakingComposite(pointIndex);
-        if (pointCompositeLeaking.IsCumulativelyLeaking)
-        {
-            assert(!mPoints.GetIsHull(pointIndex)); // Hull points are never leaking
+    size_t const parallelism = std::max(
+        std::min(leakingPoints.size() / LeakingPointsPerThread, mCurrentSimulationParallelism),
+        size_t(1));
 
-            float const pointDepth = mPoints.GetCachedDepth(pointIndex);
+    mAirBubbleSourcePointsByTask.resize(parallelism);
 
-            // External water height
-            //
-            // We also incorporate rain in the sources of external water height:
-            // - If point is below water surface: external water height is due to depth
-            // - If point is above water surface: external water height is due to rain
-            float const externalWaterHeight = std::max(
-                pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
-                rainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
+    std::vector<float> waterTakenByTask(parallelism, 0.0f);
 
-            // Internal water height
-            float const internalWaterHeight = mPoints.GetWater(pointIndex);
+    if (parallelism == 1)
+    {
+        waterTakenByTask[0] = UpdateLeakingPointsPressureAndWaterInflow(
+            leakingPoints,
+            0,
+            leakingPoints.size(),
+            waterInflowParameters,
+            simulationParameters,
+            mAirBubbleSourcePointsByTask[0]);
+    }
+    else
+    {
+        std::vector<typename ThreadPool::Task> tasks;
+        tasks.reserve(parallelism);
 
-            float totalDeltaWater = 0.0f;
+        size_t const leakingPointsPerTask = leakingPoints.size() / parallelism;
 
-            if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
-            {
-                //
-                // 1. Update water due to structural leaks (holes)
-                //
+        for (size_t t = 0; t < parallelism; ++t)
+        {
+            size_t const start = t * leakingPointsPerTask;
+            size_t const end = (t < parallelism - 1)
+                ? start + leakingPointsPerTask
+                : leakingPoints.size();
 
+            tasks.emplace_back(
+                [&, t, start, end]()
                 {
-                    //
-                    // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
-                    //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
-                    //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
-                    //
-                    // Considering that at equilibrium we have v=0 and p=external_pressure,
-                    // then c=external_pressure/density;
-                    // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
-                    // hence, the velocity of water incoming at point p, when the "water height" in the point is already
-                    // wh and the external water pressure is d*height_of_water_at_y*g, is:
-                    //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
-                    //
+                    waterTakenByTask[t] = UpdateLeakingPointsPressureAndWaterInflow(
+                        leakingPoints,
+                        start,
+                        end,
+                        waterInflowParameters,
+                        simulationParameters,
+                        mAirBubbleSourcePointsByTask[t]);
+                });
+        }
 
-                    float incomingWaterVelocity_Structural;
-                    if (externalWaterHeight >= internalWaterHeight)
-                    {
-                        // Incoming water
-                        incomingWaterVelocity_Structural = sqrtf(2.0f * SimulationParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
-                    }
-                    else
-                    {
-                        // Outgoing water
-                        incomingWaterVelocity_Structural = -sqrtf(2.0f * SimulationParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
-                    }
+        threadManager.GetSimulationThreadPool().Run(tasks);
+    }
 
-                    //
-                    // 1.2) In/Outtake water according to velocity:
-                    // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
-                    //   height is thus Vw/A, i.e. v*dt
-                    //
+    //
+    // 2. Spawn air bubbles - serially and in point order, as this allocates
+    //    ephemeral particles
+    //
 
-                    float deltaWater_Structural =
-                        incomingWaterVelocity_Structural
-                        * SimulationParameters::SimulationStepTimeDuration<float>
-                        * mPoints.GetMaterialWaterIntake(pointIndex)
-                        * simulationParameters.WaterIntakeAdjustment;
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        for (ElementIndex const pointIndex : mAirBubbleSourcePointsByTask[t])
+        {
+            InternalSpawnAirBubble(
+                mPoints.GetPosition(pointIndex),
+                mPoints.GetCachedDepth(pointIndex),
+                SimulationParameters::ShipAirBubbleFinalScale,
+                mPoints.GetTemperature(pointIndex),
+                currentSimulationTime,
+                mPoints.GetPlaneId(pointIndex),
+                simulationParameters);
+        }
 
-                    //
-                    // 1.3) Update water
-                    //
+        mAirBubbleSourcePointsByTask[t].clear();
 
-                    if (deltaWater_Structural < 0.0f)
-                    {
-                        // Outgoing water
+        waterTakenInStep += waterTakenByTask[t];
+    }
+}
 
-                        // Make sure we don't over-drain the point
-                        deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
+float Ship::UpdateLeakingPointsPressureAndWaterInflow(
+    std::vector<ElementIndex> const & leakingPoints,
+    size_t startLeakingPoint,
+    size_t endLeakingPoint,
+    WaterInflowParameters const & waterInflowParameters,
+    SimulationParameters const & simulationParameters,
+    std::vector<ElementIndex> & airBubbleSourcePoints)
+{
+    float waterTaken = 0.0f;
 
-                        // Honor the water retention of this material
-                        deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
-                    }
+    for (size_t l = startLeakingPoint; l < endLeakingPoint; ++l)
+    {
+        ElementIndex const pointIndex = leakingPoints[l];
 
-                    // Adjust water
-                    mPoints.SetWater(
-                        pointIndex,
-                        mPoints.GetWater(pointIndex) + deltaWater_Structural);
+        auto const & pointCompositeLeaking = mPoints.GetLeakingComposite(pointIndex);
+        assert(pointCompositeLeaking.IsCumulativelyLeaking);
+        assert(!mPoints.GetIsHull(pointIndex)); // Hull points are never leaking
 
-                    totalDeltaWater += deltaWater_Structural;
-                }
+        float const pointDepth = mPoints.GetCachedDepth(pointIndex);
 
-                //
-                // 2. Update internal pressure due to structural leaks (holes)
-                //    (positive is incoming)
-                //
-                //    Structural delta pressure is independent from structural delta water
-                //
+        // External water height
+        //
+        // We also incorporate rain in the sources of external water height:
+        // - If point is below water surface: external water height is due to depth
+        // - If point is above water surface: external water height is due to rain
+        float const externalWaterHeight = std::max(
+            pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
+            waterInflowParameters.RainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
 
-                {
-                    float const externalPressure = Formulae::CalculateTotalPressureAt(
-                        mPoints.GetPosition(pointIndex).y,
-                        mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
-                        effectiveAirDensity,
-                        effectiveWaterDensity,
-                        simulationParameters);
-
-                    mPoints.SetInternalPressure(
-                        pointIndex,
-                        externalPressure);
-                }
-            }
+        // Internal water height
+        float const internalWaterHeight = mPoints.GetWater(pointIndex);
+
+        float totalDeltaWater = 0.0f;
+
+        if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
+        {
+            //
+            // 1. Update water due to structural leaks (holes)
+            //
 
-            float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
-            if (waterPumpForce != 0.0f)
             {
                 //
-                // 3) Update water due to forced leaks (pumps)
-                //    (positive is incoming)
+                // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
+                //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
+                //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
+                //
+                // Considering that at equilibrium we have v=0 and p=external_pressure,
+                // then c=external_pressure/density;
+                // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
+                // hence, the velocity of water incoming at point p, when the "water height" in the point is already
+                // wh and the external water pressure is d*height_of_water_at_y*g, is:
+                //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
                 //
 
-                float deltaWater_Forced = 0.0f;
-                if (waterPumpForce > 0.0f)
+                float incomingWaterVelocity_Structural;
+                if (externalWaterHeight >= internalWaterHeight)
                 {
-                    // Inward pump: only works if underwater
-                    deltaWater_Forced = (externalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // No need to cap as sea is infinite
-                        : 0.0f;
+                    // Incoming water
+                    incomingWaterVelocity_Structural = sqrtf(2.0f * SimulationParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
                 }
                 else
                 {
-                    // Outward pump: only works if water inside
-                    deltaWater_Forced = (internalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // We'll cap it
-                        : 0.0f;
+                    // Outgoing water
+                    incomingWaterVelocity_Structural = -sqrtf(2.0f * SimulationParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
                 }
 
-                // Make sure we don't over-drain the point
-                deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
+                //
+                // 1.2) In/Outtake water according to velocity:
+                // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
+                //   height is thus Vw/A, i.e. v*dt
+                //
+
+                float deltaWater_Structural =
+                    incomingWaterVelocity_Structural
+                    * SimulationParameters::SimulationStepTimeDuration<float>
+                    * mPoints.GetMaterialWaterIntake(pointIndex)
+                    * simulationParameters.WaterIntakeAdjustment;
+
+                //
+                // 1.3) Update water
+                //
+
+                if (deltaWater_Structural < 0.0f)
+                {
+                    // Outgoing water
+
+                    // Make sure we don't over-drain the point
+                    deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
+
+                    // Honor the water retention of this material
+                    deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
+                }
 
                 // Adjust water
                 mPoints.SetWater(
                     pointIndex,
-                    mPoints.GetWater(pointIndex) + deltaWater_Forced);
+                    mPoints.GetWater(pointIndex) + deltaWater_Structural);
 
-                totalDeltaWater += deltaWater_Forced;
+                totalDeltaWater += deltaWater_Structural;
+            }
 
-                //
-                // 4) Update pressure due to forced leaks (pumps)
-                //    (positive is incoming)
-                //
-                //    Forced delta pressure depends on (effective) forced delta water only
-                //
+            //
+            // 2. Update internal pressure due to structural leaks (holes)
+            //    (positive is incoming)
+            //
+            //    Structural delta pressure is independent from structural delta water
+            //
 
-                float const deltaPressure_Forced = deltaWater_Forced * volumetricWaterPressure;
+            {
+                float const externalPressure = Formulae::CalculateTotalPressureAt(
+                    mPoints.GetPosition(pointIndex).y,
+                    mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
+                    waterInflowParameters.EffectiveAirDensity,
+                    waterInflowParameters.EffectiveWaterDensity,
+                    simulationParameters);
 
                 mPoints.SetInternalPressure(
                     pointIndex,
-                    std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
+                    externalPressure);
             }
+        }
 
+        float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
+        if (waterPumpForce != 0.0f)
+        {
             //
-            // 5) Check if it's time to produce air bubbles
+            // 3) Update water due to forced leaks (pumps)
+            //    (positive is incoming)
             //
 
-            mPoints.GetCumulatedIntakenWater(pointIndex) += totalDeltaWater;
-            if (mPoints.GetCumulatedIntakenWater(pointIndex) > cumulatedIntakenWaterThresholdForAirBubbles)
+            float deltaWater_Forced = 0.0f;
+            if (waterPumpForce > 0.0f)
             {
-                // Generate air bubbles - but not on ropes as that looks awful
-                if (doGenerateAirBubbles
-                    && !mPoints.IsRope(pointIndex))
-                {
-                    InternalSpawnAirBubble(
-                        mPoints.GetPosition(pointIndex),
-                        pointDepth,
-                        SimulationParameters::ShipAirBubbleFinalScale,
-                        mPoints.GetTemperature(pointIndex),
-                        currentSimulationTime,
-                        mPoints.GetPlaneId(pointIndex),
-                        simulationParameters);
-                }
-
-                // Consume all cumulated water
-                mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
+                // Inward pump: only works if underwater
+                deltaWater_Forced = (externalWaterHeight > 0.0f)
+                    ? waterPumpForce * waterInflowParameters.WaterPumpPowerMultiplier // No need to cap as sea is infinite
+                    : 0.0f;
+            }
+            else
+            {
+                // Outward pump: only works if water inside
+                deltaWater_Forced = (internalWaterHeight > 0.0f)
+                    ? waterPumpForce * waterInflowParameters.WaterPumpPowerMultiplier // We'll cap it
+                    : 0.0f;
             }
 
-            // Adjust total water taken during this step, but not counting
-            // ropes, to prevent "rushing water" sound from playing for
-            // ropes, and also to prevent rope-only ships from playing
-            // "farewell"
-            if (!mPoints.IsRope(pointIndex))
+            // Make sure we don't over-drain the point
+            deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
+
+            // Adjust water
+            mPoints.SetWater(
+                pointIndex,
+                mPoints.GetWater(pointIndex) + deltaWater_Forced);
+
+            totalDeltaWater += deltaWater_Forced;
+
+            //
+            // 4) Update pressure due to forced leaks (pumps)
+            //    (positive is incoming)
+            //
+            //    Forced delta pressure depends on (effective) forced delta water only
+            //
+
+            float const deltaPressure_Forced = deltaWater_Forced * waterInflowParameters.VolumetricWaterPressure;
+
+            mPoints.SetInternalPressure(
+                pointIndex,
+                std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
+        }
+
+        //
+        // 5) Check if it's time to produce air bubbles
+        //
+
+        mPoints.GetCumulatedIntakenWater(pointIndex) += totalDeltaWater;
+        if (mPoints.GetCumulatedIntakenWater(pointIndex) > waterInflowParameters.CumulatedIntakenWaterThresholdForAirBubbles)
+        {
+            // Generate air bubbles - but not on ropes as that looks awful
+            if (waterInflowParameters.DoGenerateAirBubbles
+                && !mPoints.IsRope(pointIndex))
             {
-                waterTakenInStep += totalDeltaWater;
+                airBubbleSourcePoints.push_back(pointIndex);
             }
+
+            // Consume all cumulated water
+            mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
+        }
+
+        // Adjust total water taken during this step, but not counting
+        // ropes, to prevent "rushing water" sound from playing for
+        // ropes, and also to prevent rope-only ships from playing
+        // "farewell"
+        if (!mPoints.IsRope(pointIndex))
+        {
+            waterTaken += totalDeltaWater;
         }
     }
+
+    return waterTaken;
 }
 
 void Ship::EqualizeInternalPressure(SimulationParameters const & /*simulationParameters*/)
@@ -2517,6 +3113,10 @@ void Ship::UpdateWaterVelocities(
     //
     // Implementation of https://gabrielegiuseppini.wordpress.com/2018/09/08/momentum-based-simulation-of-water-flooding-2d-spaces/
     //
+    // We visit springs rather than points, looking at each spring from both of its endpoints:
+    // this way the expensive part - the velocities along the springs - is calculated four
+    // springs at a time, while the rest consists of cheap scatters onto the endpoints
+    //
 
 #ifdef _DEBUG
     // We use cached springs vectors
@@ -2530,19 +3130,48 @@ void Ship::UpdateWaterVelocities(
     auto oldPointWaterBuffer = mPoints.MakeWaterBufferCopy();
     float const * restrict oldPointWaterBufferData = oldPointWaterBuffer->data();
     float * restrict newPointWaterBufferData = mPoints.GetWaterBufferAsFloat();
-    vec2f * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
+    vec2f const * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
     vec2f * restrict newPointWaterMomentumBufferData = mPoints.GetWaterMomentumBufferAsVec2f();
 
-    // Weights of outbound water flows along each spring, including impermeable ones;
-    // set to zero for springs whose resultant scalar water velocities are
-    // directed towards the point being visited
-    std::array<float, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
+    Springs::Endpoints const * restrict const springEndpointsBufferData = mSprings.GetEndpointsBuffer();
+    vec2f const * restrict const springNormalizedVectorBufferData = mSprings.GetCachedVectorialNormalizedVectorBuffer();
 
-    // Total weight
-    float totalOutboundWaterFlowWeight;
+    //
+    // 1) Calculate outbound water velocities along *all* springs, from both endpoints,
+    //    together with the weights of the flows along them - including impermeable
+    //    springs, as we'll eventually bounce back along those
+    //
+    // The velocities are scalar, along the spring's normalized vector as seen from
+    // each endpoint
+    //
+
+    auto springPointAOutboundWaterVelocityBuffer = mSprings.AllocateWorkBufferFloat();
+    float * restrict const springPointAOutboundWaterVelocityBufferData = springPointAOutboundWaterVelocityBuffer->data();
+    auto springPointBOutboundWaterVelocityBuffer = mSprings.AllocateWorkBufferFloat();
+    float * restrict const springPointBOutboundWaterVelocityBufferData = springPointBOutboundWaterVelocityBuffer->data();
+    auto springPointAOutboundWaterFlowWeightBuffer = mSprings.AllocateWorkBufferFloat();
+    float * restrict const springPointAOutboundWaterFlowWeightBufferData = springPointAOutboundWaterFlowWeightBuffer->data();
+    auto springPointBOutboundWaterFlowWeightBuffer = mSprings.AllocateWorkBufferFloat();
+    float * restrict const springPointBOutboundWaterFlowWeightBufferData = springPointBOutboundWaterFlowWeightBuffer->data();
 
-    // Resultant water velocities along each spring
-    std::array<vec2f, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+    assert(is_aligned_to_float_element_count(mSprings.GetBufferElementCount()));
+    for (ElementIndex s = 0; s < mSprings.GetBufferElementCount(); s += 4)
+    {
+        Algorithms::CalculateSpringOutboundWaterVelocities(
+            s,
+            springEndpointsBufferData,
+            springNormalizedVectorBufferData,
+            mSprings.GetFactoryRestLengthBuffer(),
+            mPoints.GetPositionBufferAsVec2(),
+            oldPointWaterBufferData,
+            oldPointWaterVelocityBufferData,
+            simulationParameters.WaterCrazyness,
+            SimulationParameters::GravityMagnitude,
+            springPointAOutboundWaterVelocityBufferData,
+            springPointBOutboundWaterVelocityBufferData,
+            springPointAOutboundWaterFlowWeightBufferData,
+            springPointBOutboundWaterFlowWeightBufferData);
+    }
 
     //
     // Quantities for water kinetic energy loss, used
@@ -2568,267 +3197,233 @@ void Ship::UpdateWaterVelocities(
             FastExp(-oldPointWaterBufferData[pointIndex] * 10.0f);
     }
 
-    // Count of non-hull free and drowned neighbor points for a given point
-    float pointSplashNeighbors;
-    float pointSplashFreeNeighbors;
-
-    // Kinetic energy lost for a given point
-    float pointKineticEnergyLoss;
+    // Count of non-hull free and drowned neighbor points for each point
+    auto pointSplashNeighborsBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict pointSplashNeighborsBufferData = pointSplashNeighborsBuffer->data();
+    pointSplashNeighborsBuffer->fill(0.0f);
+    auto pointSplashFreeNeighborsBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict pointSplashFreeNeighborsBufferData = pointSplashFreeNeighborsBuffer->data();
+    pointSplashFreeNeighborsBuffer->fill(0.0f);
+
+    // Kinetic energy lost at each point
+    auto pointKineticEnergyLossBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict pointKineticEnergyLossBufferData = pointKineticEnergyLossBuffer->data();
+    pointKineticEnergyLossBuffer->fill(0.0f);
 #endif
 
     //
-    // Visit all non-ephemeral points and move water and its momenta
+    // 2) Calculate total outbound flow weight at each point
     //
-    // No need to visit ephemeral points as they have no springs
+    // Deleted springs are skipped, as they have been removed from points' connected springs
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    auto pointWaterQuantityNormalizationFactorBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict pointWaterQuantityNormalizationFactorBufferData = pointWaterQuantityNormalizationFactorBuffer->data();
+    pointWaterQuantityNormalizationFactorBuffer->fill(0.0f);
+
+    for (ElementIndex s = 0; s < mSprings.GetElementCount(); ++s)
     {
-        //
-        // 1) Calculate water momenta along *all* springs connected to this point,
-        //    including impermeable ones - as we'll eventually bounce back along those
-        //
+        if (mSprings.IsDeleted(s))
+            continue;
+
+        auto const pointAIndex = springEndpointsBufferData[s].PointAIndex;
+        auto const pointBIndex = springEndpointsBufferData[s].PointBIndex;
+
+        pointWaterQuantityNormalizationFactorBufferData[pointAIndex] += springPointAOutboundWaterFlowWeightBufferData[s];
+        pointWaterQuantityNormalizationFactorBufferData[pointBIndex] += springPointBOutboundWaterFlowWeightBufferData[s];
 
-        // A higher crazyness gives more emphasis to bernoulli's velocity, as if pressures
-        // and gravity were exaggerated
+#if !FS_IS_PLATFORM_MOBILE()
         //
-        // WV[t] = WV[t-1] + alpha * Bernoulli
+        // Update splash neighbors counts
         //
-        // WaterCrazyness=0   -> alpha=1
-        // WaterCrazyness=0.5 -> alpha=0.5 + 0.5*Wh
-        // WaterCrazyness=1   -> alpha=Wh
-        float const alphaCrazyness = 1.0f + simulationParameters.WaterCrazyness * (oldPointWaterBufferData[pointIndex] - 1.0f);
 
-#if !FS_IS_PLATFORM_MOBILE()
-        pointSplashNeighbors = 0.0f;
-        pointSplashFreeNeighbors = 0.0f;
-#endif
+        float const waterPermeability = mSprings.GetWaterPermeability(s);
 
-        totalOutboundWaterFlowWeight = 0.0f;
+        pointSplashFreeNeighborsBufferData[pointAIndex] += waterPermeability * pointFreenessFactorBufferData[pointBIndex];
+        pointSplashFreeNeighborsBufferData[pointBIndex] += waterPermeability * pointFreenessFactorBufferData[pointAIndex];
 
-        size_t const connectedSpringCount = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size();
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+        pointSplashNeighborsBufferData[pointAIndex] += waterPermeability;
+        pointSplashNeighborsBufferData[pointBIndex] += waterPermeability;
+#endif
+    }
 
-            // Normalized spring vector, oriented point -> other endpoint
-            vec2f const springNormalizedVector = (pointIndex == mSprings.GetEndpointAIndex(cs.SpringIndex))
-                ? mSprings.GetCachedVectorialNormalizedVector(cs.SpringIndex)
-                : -mSprings.GetCachedVectorialNormalizedVector(cs.SpringIndex);
+    //
+    // 3) Calculate normalization factor for water flows:
+    //    the quantity of water along a spring is proportional to the weight of the spring
+    //    (resultant velocity along that spring), and the sum of all outbound water flows must
+    //    match the water currently at the point times the water speed fraction and the adjustment
+    //
+    //    Water only moves out of points with a non-zero factor, and into their neighbors,
+    //    whose masses hence need to be updated
+    //
 
-            // Component of the point's own water velocity along the spring
-            float const pointWaterVelocityAlongSpring =
-                oldPointWaterVelocityBufferData[pointIndex]
-                .dot(springNormalizedVector);
+    for (auto pointIndex : mPoints.RawShipPoints())
+    {
+        float const totalOutboundWaterFlowWeight = pointWaterQuantityNormalizationFactorBufferData[pointIndex];
 
-            //
-            // Calulate Bernoulli's velocity gained along this spring, from this point to
-            // the other endpoint
-            //
+        assert(totalOutboundWaterFlowWeight >= 0.0f);
 
-            // Pressure difference (positive implies point -> other endpoint flow)
-            float const dw = oldPointWaterBufferData[pointIndex] - oldPointWaterBufferData[cs.OtherEndpointIndex];
+        float const normalizationFactor = (totalOutboundWaterFlowWeight != 0.0f)
+            ? oldPointWaterBufferData[pointIndex]
+                * mPoints.GetMaterialWaterDiffusionSpeed(pointIndex) * simulationParameters.WaterDiffusionSpeedAdjustment
+                / totalOutboundWaterFlowWeight
+            : 0.0f;
 
-            // Gravity potential difference (positive implies point -> other endpoint flow)
-            float const dy = mPoints.GetPosition(pointIndex).y - mPoints.GetPosition(cs.OtherEndpointIndex).y;
+        pointWaterQuantityNormalizationFactorBufferData[pointIndex] = normalizationFactor;
 
-            // Calculate gained water velocity along this spring, from point to other endpoint
-            // (Bernoulli, 1738)
-            float bernoulliVelocityAlongSpring;
-            float const dwy = dw + dy;
-            if (dwy >= 0.0f)
-            {
-                // Gained velocity goes from point to other endpoint
-                bernoulliVelocityAlongSpring = sqrtf(2.0f * SimulationParameters::GravityMagnitude * dwy);
-            }
-            else
+        if (normalizationFactor != 0.0f)
+        {
+            mPoints.MarkMassAsDirty(pointIndex);
+
+            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
             {
-                // Gained velocity goes from other endpoint to point
-                bernoulliVelocityAlongSpring = -sqrtf(2.0f * SimulationParameters::GravityMagnitude * -dwy);
+                mPoints.MarkMassAsDirty(cs.OtherEndpointIndex);
             }
-
-            // Resultant scalar velocity along spring; outbound only, as
-            // if this were inbound it wouldn't result in any movement of the point's
-            // water between these two springs. Morevoer, Bernoulli's velocity injected
-            // along this spring will be picked up later also by the other endpoint,
-            // and at that time it would move water if it agrees with its velocity
-            float const springOutboundScalarWaterVelocity = std::max(
-                pointWaterVelocityAlongSpring + bernoulliVelocityAlongSpring * alphaCrazyness,
-                0.0f);
-
-            // Store weight along spring, scaling for the greater distance traveled along
-            // diagonal springs
-            springOutboundWaterFlowWeights[s] =
-                springOutboundScalarWaterVelocity
-                / mSprings.GetFactoryRestLength(cs.SpringIndex);
-
-            // Resultant outbound velocity along spring
-            springOutboundWaterVelocities[s] =
-                springNormalizedVector
-                * springOutboundScalarWaterVelocity;
-
-            // Update total outbound flow weight
-            totalOutboundWaterFlowWeight += springOutboundWaterFlowWeights[s];
-
-#if !FS_IS_PLATFORM_MOBILE()
-            //
-            // Update splash neighbors counts
-            //
-
-            pointSplashFreeNeighbors +=
-                mSprings.GetWaterPermeability(cs.SpringIndex)
-                * pointFreenessFactorBufferData[cs.OtherEndpointIndex];
-
-            pointSplashNeighbors += mSprings.GetWaterPermeability(cs.SpringIndex);
-#endif
         }
+    }
 
-        //
-        // 2) Calculate normalization factor for water flows:
-        //    the quantity of water along a spring is proportional to the weight of the spring
-        //    (resultant velocity along that spring), and the sum of all outbound water flows must
-        //    match the water currently at the point times the water speed fraction and the adjustment
-        //
-
-        assert(totalOutboundWaterFlowWeight >= 0.0f);
+    //
+    // 4) Move water along all springs according to their flows,
+    //    and update destinations' momenta accordingly
+    //
 
-        float waterQuantityNormalizationFactor = 0.0f;
-        if (totalOutboundWaterFlowWeight != 0.0f)
-        {
-            waterQuantityNormalizationFactor =
-                oldPointWaterBufferData[pointIndex]
-                * mPoints.GetMaterialWaterDiffusionSpeed(pointIndex) * simulationParameters.WaterDiffusionSpeedAdjustment
-                / totalOutboundWaterFlowWeight;
-        }
+    for (ElementIndex s = 0; s < mSprings.GetElementCount(); ++s)
+    {
+        if (mSprings.IsDeleted(s))
+            continue;
 
-        //
-        // 3) Move water along all springs according to their flows,
-        //    and update destination's momenta accordingly
-        //
+        auto const pointAIndex = springEndpointsBufferData[s].PointAIndex;
+        auto const pointBIndex = springEndpointsBufferData[s].PointBIndex;
 
-#if !FS_IS_PLATFORM_MOBILE()
-        // Kinetic energy lost at this point
-        pointKineticEnergyLoss = 0.0f;
-#endif
+        // Normalized spring vector, oriented A -> B
+        vec2f const springNormalizedVector = springNormalizedVectorBufferData[s];
 
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+        float const pointAOutboundScalarWaterVelocity = springPointAOutboundWaterVelocityBufferData[s];
+        float const pointBOutboundScalarWaterVelocity = springPointBOutboundWaterVelocityBufferData[s];
 
-            // Calculate quantity of water directed outwards
-            float const springOutboundQuantityOfWater =
-                springOutboundWaterFlowWeights[s]
-                * waterQuantityNormalizationFactor;
+        // Resultant outbound velocities along spring
+        vec2f const pointAOutboundWaterVelocity = springNormalizedVector * pointAOutboundScalarWaterVelocity;
+        vec2f const pointBOutboundWaterVelocity = -springNormalizedVector * pointBOutboundScalarWaterVelocity;
 
-            assert(springOutboundQuantityOfWater >= 0.0f);
+        // Calculate quantities of water directed outwards
+        float const pointAOutboundQuantityOfWater =
+            springPointAOutboundWaterFlowWeightBufferData[s]
+            * pointWaterQuantityNormalizationFactorBufferData[pointAIndex];
+        float const pointBOutboundQuantityOfWater =
+            springPointBOutboundWaterFlowWeightBufferData[s]
+            * pointWaterQuantityNormalizationFactorBufferData[pointBIndex];
 
-            if (mSprings.GetWaterPermeability(cs.SpringIndex) != 0.0f)
-            {
-                //
-                // Water - and momentum - move from point to endpoint
-                //
+        assert(pointAOutboundQuantityOfWater >= 0.0f);
+        assert(pointBOutboundQuantityOfWater >= 0.0f);
 
-                // Move water quantity
-                newPointWaterBufferData[pointIndex] -= springOutboundQuantityOfWater;
-                newPointWaterBufferData[cs.OtherEndpointIndex] += springOutboundQuantityOfWater;
+        if (mSprings.GetWaterPermeability(s) != 0.0f)
+        {
+            //
+            // Water - and momentum - move from each endpoint to the other
+            //
 
-                // Remove "old momentum" (old velocity) from point
-                newPointWaterMomentumBufferData[pointIndex] -=
-                    oldPointWaterVelocityBufferData[pointIndex]
-                    * springOutboundQuantityOfWater;
+            // Move water quantity
+            newPointWaterBufferData[pointAIndex] += pointBOutboundQuantityOfWater - pointAOutboundQuantityOfWater;
+            newPointWaterBufferData[pointBIndex] += pointAOutboundQuantityOfWater - pointBOutboundQuantityOfWater;
 
-                // Add "new momentum" (old velocity + velocity gained) to other endpoint
-                newPointWaterMomentumBufferData[cs.OtherEndpointIndex] +=
-                    springOutboundWaterVelocities[s]
-                    * springOutboundQuantityOfWater;
+            // Remove "old momentum" (old velocity) from each endpoint, and add "new momentum"
+            // (old velocity + velocity gained) to the other endpoint
+            newPointWaterMomentumBufferData[pointAIndex] +=
+                pointBOutboundWaterVelocity * pointBOutboundQuantityOfWater
+                - oldPointWaterVelocityBufferData[pointAIndex] * pointAOutboundQuantityOfWater;
+            newPointWaterMomentumBufferData[pointBIndex] +=
+                pointAOutboundWaterVelocity * pointAOutboundQuantityOfWater
+                - oldPointWaterVelocityBufferData[pointBIndex] * pointBOutboundQuantityOfWater;
 
 #if !FS_IS_PLATFORM_MOBILE()
-                //
-                // Update point's kinetic energy loss:
-                // splintered water colliding with whole other endpoint
-                //
+            //
+            // Update endpoints' kinetic energy losses:
+            // splintered water colliding with whole other endpoint
+            //
+            // Note: deltaK might be negative, in which case the other endpoint's
+            // deltaK would have been more positive (perfectly inelastic -> deltaK == max)
+            //
 
-                // Normalized spring vector, oriented point -> other endpoint
-                vec2f const springNormalizedVector = (pointIndex == mSprings.GetEndpointAIndex(cs.SpringIndex))
-                    ? mSprings.GetCachedVectorialNormalizedVector(cs.SpringIndex)
-                    : -mSprings.GetCachedVectorialNormalizedVector(cs.SpringIndex);
-
-                float ma = springOutboundQuantityOfWater;
-                float va = springOutboundWaterVelocities[s].length();
-                float mb = oldPointWaterBufferData[cs.OtherEndpointIndex];
-                float vb = oldPointWaterVelocityBufferData[cs.OtherEndpointIndex].dot(springNormalizedVector);
-
-                float vf = 0.0f;
-                if (ma + mb != 0.0f)
-                    vf = (ma * va + mb * vb) / (ma + mb);
-
-                float deltaKa =
-                    0.5f
-                    * ma
-                    * (va * va - vf * vf);
-
-                // Note: deltaKa might be negative, in which case deltaKb would have been
-                // more positive (perfectly inelastic -> deltaK == max); we will pickup
-                // deltaKb later
-                pointKineticEnergyLoss += std::max(deltaKa, 0.0f);
+            auto const calculateKineticEnergyLoss = [](float ma, float va, float mb, float vb)
+                {
+                    float vf = 0.0f;
+                    if (ma + mb != 0.0f)
+                        vf = (ma * va + mb * vb) / (ma + mb);
+
+                    return std::max(
+                        0.5f * ma * (va * va - vf * vf),
+                        0.0f);
+                };
+
+            pointKineticEnergyLossBufferData[pointAIndex] += calculateKineticEnergyLoss(
+                pointAOutboundQuantityOfWater,
+                pointAOutboundScalarWaterVelocity,
+                oldPointWaterBufferData[pointBIndex],
+                oldPointWaterVelocityBufferData[pointBIndex].dot(springNormalizedVector));
+
+            pointKineticEnergyLossBufferData[pointBIndex] += calculateKineticEnergyLoss(
+                pointBOutboundQuantityOfWater,
+                pointBOutboundScalarWaterVelocity,
+                oldPointWaterBufferData[pointAIndex],
+                -oldPointWaterVelocityBufferData[pointAIndex].dot(springNormalizedVector));
 #endif
-            }
-            else
-            {
-                // Wall hit
+        }
+        else
+        {
+            // Wall hit
 
-                // Deleted springs are removed from points' connected springs
-                assert(!mSprings.IsDeleted(cs.SpringIndex));
+            //
+            // New momentum (old velocity + velocity gained) bounces back
+            // (and zeroes outgoing), assuming perfectly inelastic collision
+            //
+            // No changes to other endpoint
+            //
 
-                //
-                // New momentum (old velocity + velocity gained) bounces back
-                // (and zeroes outgoing), assuming perfectly inelastic collision
-                //
-                // No changes to other endpoint
-                //
+            newPointWaterMomentumBufferData[pointAIndex] -=
+                pointAOutboundWaterVelocity
+                * pointAOutboundQuantityOfWater;
 
-                newPointWaterMomentumBufferData[pointIndex] -=
-                    springOutboundWaterVelocities[s]
-                    * springOutboundQuantityOfWater;
+            newPointWaterMomentumBufferData[pointBIndex] -=
+                pointBOutboundWaterVelocity
+                * pointBOutboundQuantityOfWater;
 
 #if !FS_IS_PLATFORM_MOBILE()
-                //
-                // Update point's kinetic energy loss:
-                // entire splintered water
-                //
-
-                float ma = springOutboundQuantityOfWater;
-                float va = springOutboundWaterVelocities[s].length();
+            //
+            // Update endpoints' kinetic energy losses:
+            // entire splintered water
+            //
 
-                float deltaKa =
-                    0.5f
-                    * ma
-                    * va * va;
+            pointKineticEnergyLossBufferData[pointAIndex] +=
+                0.5f
+                * pointAOutboundQuantityOfWater
+                * pointAOutboundScalarWaterVelocity * pointAOutboundScalarWaterVelocity;
 
-                assert(deltaKa >= 0.0f);
-                pointKineticEnergyLoss += deltaKa;
+            pointKineticEnergyLossBufferData[pointBIndex] +=
+                0.5f
+                * pointBOutboundQuantityOfWater
+                * pointBOutboundScalarWaterVelocity * pointBOutboundScalarWaterVelocity;
 #endif
-            }
         }
+    }
 
 #if !FS_IS_PLATFORM_MOBILE()
-        //
-        // 4) Update water splash
-        //
+    //
+    // 5) Update water splash
+    //
 
-        if (pointSplashNeighbors != 0.0f)
+    for (auto pointIndex : mPoints.RawShipPoints())
+    {
+        if (pointSplashNeighborsBufferData[pointIndex] != 0.0f)
         {
             // Water splashed is proportional to kinetic energy loss that took
             // place near free points (i.e. not drowned by water)
             waterSplashed +=
-                pointKineticEnergyLoss
-                * pointSplashFreeNeighbors
-                / pointSplashNeighbors;
+                pointKineticEnergyLossBufferData[pointIndex]
+                * pointSplashFreeNeighborsBufferData[pointIndex]
+                / pointSplashNeighborsBufferData[pointIndex];
         }
-#endif
     }
 
-#if !FS_IS_PLATFORM_MOBILE()
     //
     // Average kinetic energy loss
     //
@@ -2836,7 +3431,6 @@ void Ship::UpdateWaterVelocities(
     waterSplashed = mWaterSplashedRunningAverage.Update(waterSplashed);
 #endif
 
-
     //
     // Transforming momenta into velocities
     //
@@ -2846,17 +3440,8 @@ void Ship::UpdateWaterVelocities(
 
 void Ship::UpdateSinking(float currentSimulationTime)
 {
-    //
-    // Calculate total number of wet points
-    //
-
-    size_t wetPointCount = 0;
-
-    for (auto p : mPoints.RawShipPoints())
-    {
-        if (mPoints.GetWater(p) >= 0.5f) // Magic number - we only count a point as wet if its water is above this threshold
-            ++wetPointCount;
-    }
+    // Counted by the world forces
+    ElementCount const wetPointCount = mPointAggregates.WetPointCount;
 
     if (!mIsSinking)
     {
@@ -2925,7 +3510,7 @@ void Ship::RecalculateLightDiffusionParallelism(size_t simulationParallelism)
         mLightDiffusionTasks.emplace_back(
             [this, pointStart, pointEnd]()
             {
-                Algorithms::DiffuseLight(
+                Algorithms::DiffuseLight_Tiled(
                     pointStart,
                     pointEnd,
                     mPoints.GetPositionBufferAsVec2(),
@@ -2993,35 +3578,107 @@ void Ship::DiffuseLight(
 // Heat
 ///////////////////////////////////////////////////////////////////////////////////
 
-void Ship::PropagateHeat(
-    float /*currentSimulationTime*/,
-    float dt,
-    Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+void Ship::RecalculateHeatPropagationParallelism(size_t simulationParallelism)
 {
+    // Clear threading state
+    mHeatPropagationPointRanges.clear();
+    mHeatPropagationHotPoints.clear();
+
     //
-    // Propagate temperature (via heat), and dissipate temperature
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for heat propagation
     //
 
-    // Source and result temperature buffers
-    auto oldPointTemperatureBuffer = mPoints.MakeTemperatureBufferCopy();
-    float const * restrict const oldPointTemperatureBufferData = oldPointTemperatureBuffer->data();
-    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    ElementCount const numberOfPoints = mPoints.GetBufferElementCount(); // Includes ephemerals, as they dissipate heat
+
+    ElementCount constexpr PointsPerThread = 2000;
+
+    size_t const heatPropagationParallelism = std::max(
+        std::min(static_cast<size_t>(numberOfPoints) / PointsPerThread, simulationParallelism),
+        size_t(1));
 
-    // Outbound heat flows along each spring
-    std::array<float, SimulationParameters::MaxSpringsPerPoint> springOutboundHeatFlows;
+    LogMessage("Ship::RecalculateHeatPropagationParallelism: points=", numberOfPoints, " simulationParallelism=", simulationParallelism,
+        " heatPropagationParallelism=", heatPropagationParallelism);
 
     //
-    // Visit all non-ephemeral points
+    // Prepare point ranges
+    //
+    // We want each thread to work on a multiple of our vectorization word size
+    //
+
+    assert(numberOfPoints >= static_cast<ElementCount>(heatPropagationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(heatPropagationParallelism) * vectorization_float_count<ElementCount>);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < heatPropagationParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < heatPropagationParallelism - 1)
+            ? pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>
+            : numberOfPoints;
+
+        assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
+
+        mHeatPropagationPointRanges.emplace_back(pointStart, pointEnd);
+        mHeatPropagationHotPoints.emplace_back();
+
+        pointStart = pointEnd;
+    }
+}
+
+Ship::HeatPropagationParameters Ship::CalculateHeatPropagationParameters(
+    float dt,
+    Storm::Parameters const & stormParameters,
+    SimulationParameters const & simulationParameters) const
+{
+    float const effectiveWaterConvectiveHeatTransferCoefficient =
+        SimulationParameters::WaterConvectiveHeatTransferCoefficient
+        * dt
+        * simulationParameters.HeatDissipationAdjustment
+        * 2.0f; // We exaggerate a bit to take into account water wetting the material and thus making it more difficult for fire to re-kindle
+
+    // We include rain in air
+    float const effectiveAirConvectiveHeatTransferCoefficient =
+        SimulationParameters::AirConvectiveHeatTransferCoefficient
+        * dt
+        * simulationParameters.HeatDissipationAdjustment
+        + FastPow(stormParameters.RainDensity, 0.3f) * effectiveWaterConvectiveHeatTransferCoefficient;
+
+    return HeatPropagationParameters(
+        simulationParameters.ThermalConductivityAdjustment * dt,
+        // Water temperature
+        // We approximate the thermocline as a linear decrease of
+        // temperature: 15 degrees in MaxSeaDepth meters
+        simulationParameters.WaterTemperature,
+        -15.0f / SimulationParameters::MaxSeaDepth,
+        effectiveWaterConvectiveHeatTransferCoefficient,
+        simulationParameters.AirTemperature + stormParameters.AirTemperatureDelta,
+        effectiveAirConvectiveHeatTransferCoefficient);
+}
+
+void Ship::CalculateHeatOutflowNormalizationFactors(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    HeatPropagationParameters const & heatPropagationParameters,
+    float * restrict const oldPointTemperatureBufferData,
+    float * restrict const outflowNormalizationFactorBufferData)
+{
+    float const * restrict const pointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+
+    //
+    // Visit all non-ephemeral points in the partition
     //
     // No particular reason to not do ephemeral points as well - it's just
     // that at the moment ephemeral particles are not connected to each other
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    ElementIndex const endShipPointIndex = std::min(endPointIndex, mPoints.GetRawShipPointCount());
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endShipPointIndex; ++pointIndex)
     {
         // Temperature of this point
-        float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
+        float const pointTemperature = pointTemperatureBufferData[pointIndex];
+
+        // Snapshot it
+        oldPointTemperatureBufferData[pointIndex] = pointTemperature;
 
         //
         // 1) Calculate total outgoing heat
@@ -3029,29 +3686,17 @@ void Ship::PropagateHeat(
 
         float totalOutgoingHeat = 0.0f;
 
-        // Visit all springs
-        size_t const connectedSpringCount = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size();
-        for (size_t s = 0; s < connectedSpringCount; ++s)
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
         {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
-
             // Calculate outgoing heat flow per unit of time
             //
             // q = Ki * (Tp - Tpi) * dt / Li
-            float const outgoingHeatFlow =
-                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * simulationParameters.ThermalConductivityAdjustment
-                * std::max(pointTemperature - oldPointTemperatureBufferData[cs.OtherEndpointIndex], 0.0f) // DeltaT, positive if going out
-                * dt
+            totalOutgoingHeat +=
+                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * heatPropagationParameters.ThermalConductivityCoefficient
+                * std::max(pointTemperature - pointTemperatureBufferData[cs.OtherEndpointIndex], 0.0f) // DeltaT, positive if going out
                 / mSprings.GetFactoryRestLength(cs.SpringIndex);
-
-            // Store flow
-            springOutboundHeatFlows[s] = outgoingHeatFlow;
-
-            // Update total outgoing heat
-            totalOutgoingHeat += outgoingHeatFlow;
         }
 
-
         //
         // 2) Calculate normalization factor - to ensure that point's temperature won't go below zero (Kelvin)
         //
@@ -3073,89 +3718,103 @@ void Ship::PropagateHeat(
             normalizationFactor = 0.0f;
         }
 
+        outflowNormalizationFactorBufferData[pointIndex] = normalizationFactor;
+    }
+}
+
+void Ship::PropagateHeat(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    HeatPropagationParameters const & heatPropagationParameters,
+    float const * restrict const oldPointTemperatureBufferData,
+    float const * restrict const outflowNormalizationFactorBufferData,
+    std::vector<ElementIndex> & hotPoints)
+{
+    //
+    // Propagate temperature (via heat), and dissipate temperature
+    //
+
+    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
 
-        //
-        // 3) Transfer outgoing heat, lowering temperature of point and increasing temperature of target points
-        //
+    //
+    // Visit all non-ephemeral points in the partition, gathering the heat
+    // flowing out of them and into them
+    //
+
+    ElementIndex const endShipPointIndex = std::min(endPointIndex, mPoints.GetRawShipPointCount());
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endShipPointIndex; ++pointIndex)
+    {
+        // Temperature of this point
+        float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
+
+        float totalOutgoingHeat = 0.0f;
+        float totalIncomingHeat = 0.0f;
 
-        for (size_t s = 0; s < connectedSpringCount; ++s)
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
         {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+            // q = Ki * (Tp - Tpi) * dt / Li
+            float const heatFlowCoefficient =
+                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * heatPropagationParameters.ThermalConductivityCoefficient
+                / mSprings.GetFactoryRestLength(cs.SpringIndex);
 
-            // Raise target temperature due to this flow
-            newPointTemperatureBufferData[cs.OtherEndpointIndex] +=
-                springOutboundHeatFlows[s] * normalizationFactor
-                * mPoints.GetMaterialHeatCapacityReciprocal(cs.OtherEndpointIndex);
+            float const deltaT = pointTemperature - oldPointTemperatureBufferData[cs.OtherEndpointIndex];
+            if (deltaT > 0.0f)
+            {
+                // Going out
+                totalOutgoingHeat += heatFlowCoefficient * deltaT;
+            }
+            else
+            {
+                // Coming in, normalized at its source
+                totalIncomingHeat +=
+                    heatFlowCoefficient * -deltaT
+                    * outflowNormalizationFactorBufferData[cs.OtherEndpointIndex];
+            }
         }
 
-        // Update point's temperature due to total flow
-        newPointTemperatureBufferData[pointIndex] -=
-            totalOutgoingHeat * normalizationFactor
+        // Update point's temperature due to total flows
+        newPointTemperatureBufferData[pointIndex] =
+            pointTemperature
+            + (totalIncomingHeat - totalOutgoingHeat * outflowNormalizationFactorBufferData[pointIndex])
             * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
     }
 
     //
     // Dissipate heat
     //
+    // We also include ephemeral points, as they may be heated
+    // and have a temperature
+    //
 
-    float const effectiveWaterConvectiveHeatTransferCoefficient =
-        SimulationParameters::WaterConvectiveHeatTransferCoefficient
-        * dt
-        * simulationParameters.HeatDissipationAdjustment
-        * 2.0f; // We exaggerate a bit to take into account water wetting the material and thus making it more difficult for fire to re-kindle
+    Algorithms::DissipateHeat(
+        startPointIndex,
+        endPointIndex,
+        mPoints.GetPositionBufferAsVec2(),
+        mPoints.GetCachedDepthBufferAsFloat(),
+        mPoints.GetWaterBufferAsFloat(),
+        mPoints.GetMaterialHeatCapacityReciprocalBufferAsFloat(),
+        SimulationParameters::SmotheringWaterHighWatermark,
+        heatPropagationParameters.SurfaceWaterTemperature,
+        heatPropagationParameters.ThermoclineSlope,
+        heatPropagationParameters.WaterConvectiveHeatTransferCoefficient,
+        heatPropagationParameters.AirTemperature,
+        heatPropagationParameters.AirConvectiveHeatTransferCoefficient,
+        newPointTemperatureBufferData);
 
-    // Water temperature
-    // We approximate the thermocline as a linear decrease of
-    // temperature: 15 degrees in MaxSeaDepth meters
-    float const surfaceWaterTemperature = simulationParameters.WaterTemperature;
-    float constexpr ThermoclineSlope = -15.0f / SimulationParameters::MaxSeaDepth;
+    //
+    // Collect the points that are now hot enough to ignite, for combustion
+    // to only visit those
+    //
 
-    // We include rain in air
-    float const effectiveAirConvectiveHeatTransferCoefficient =
-        SimulationParameters::AirConvectiveHeatTransferCoefficient
-        * dt
-        * simulationParameters.HeatDissipationAdjustment
-        + FastPow(stormParameters.RainDensity, 0.3f) * effectiveWaterConvectiveHeatTransferCoefficient;
+    float const * restrict const combustionCandidateTemperatureBufferData = mPoints.GetCombustionCandidateTemperatureBufferAsFloat();
 
-    float const airTemperature =
-        simulationParameters.AirTemperature
-        + stormParameters.AirTemperatureDelta;
+    hotPoints.clear();
 
-    // We also include ephemeral points, as they may be heated
-    // and have a temperature
-    for (auto pointIndex : mPoints)
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endShipPointIndex; ++pointIndex)
     {
-        float deltaT; // Temperature delta (particle - env)
-        float heatLost; // Heat lost in this time quantum (positive when outgoing)
-
-        if (mPoints.IsCachedUnderwater(pointIndex)
-            || mPoints.GetWater(pointIndex) > SimulationParameters::SmotheringWaterHighWatermark)
-        {
-            // Dissipation in water
-            float const waterTemperature = surfaceWaterTemperature - Clamp(mPoints.GetPosition(pointIndex).y * ThermoclineSlope, 0.0f, surfaceWaterTemperature);
-            deltaT = newPointTemperatureBufferData[pointIndex] - waterTemperature;
-            heatLost = effectiveWaterConvectiveHeatTransferCoefficient * deltaT;
-        }
-        else
-        {
-            // Dissipation in air
-            deltaT = newPointTemperatureBufferData[pointIndex] - airTemperature;
-            heatLost = effectiveAirConvectiveHeatTransferCoefficient * deltaT;
-        }
-
-        // Temperature delta due to heat removal
-        float const dissipationDeltaT = heatLost * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
-
-        // Remove this heat from the point, making sure we don't overshoot
-        if (deltaT >= 0)
-        {
-            newPointTemperatureBufferData[pointIndex] -=
-                std::min(dissipationDeltaT, deltaT);
-        }
-        else
+        if (newPointTemperatureBufferData[pointIndex] >= combustionCandidateTemperatureBufferData[pointIndex])
         {
-            newPointTemperatureBufferData[pointIndex] -=
-                std::max(dissipationDeltaT, deltaT);
+            hotPoints.push_back(pointIndex);
         }
     }
 }
@@ -3223,17 +3882,27 @@ void Ship::RotPoints(
     float const x_uw = (1.0f - a_uw) / (a_uw - a_uw_fl);
     float const beta = (1.0f - a_uw) / x_uw;
 
-    // Process all non-ephemeral points in this partition - no real reason
-    // to exclude ephemerals, other than they're not expected to rot
-    ElementCount const partitionSize = (mPoints.GetRawShipPointCount() / partitionCount) + ((mPoints.GetRawShipPointCount() % partitionCount) ? 1 : 0);
-    ElementCount const startPointIndex = partition * partitionSize;
-    ElementCount const endPointIndex = std::min(startPointIndex + partitionSize, mPoints.GetRawShipPointCount());
-    for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+    // Process the rustable points in this partition - points whose material doesn't rust
+    // would never decay; no real reason to exclude ephemerals, other than they're not
+    // expected to rot
+    auto const & rustablePoints = mPoints.GetRustablePoints();
+    size_t const partitionSize = (rustablePoints.size() / partitionCount) + ((rustablePoints.size() % partitionCount) ? 1 : 0);
+    size_t const startRustablePoint = std::min(partition * partitionSize, rustablePoints.size());
+    size_t const endRustablePoint = std::min(startRustablePoint + partitionSize, rustablePoints.size());
+    for (size_t r = startRustablePoint; r < endRustablePoint; ++r)
     {
+        ElementIndex const p = rustablePoints[r];
+
         float x =
             (mPoints.IsCachedUnderwater(p) ? x_uw : 0.0f) // x_uw
             + std::min(mPoints.GetWater(p), 1.0f); // x_fl
 
+        if (x <= 0.0f)
+        {
+            // Dry and above water: no decay, and nothing to upload
+            continue;
+        }
+
         // Adjust with leaking: if leaking and subject to rusting, then rusts faster
         x += mPoints.GetLeakingComposite(p).LeakingSources.StructuralLeak * x * x_uw;
 
@@ -3243,41 +3912,41 @@ void Ship::RotPoints(
         // Calculate alpha
         float const alpha = std::max(1.0f - beta * x, 0.0f);
 
-        // Decay
+        // Decay; also remembers that this portion of the decay buffer is dirty
         mPoints.SetDecay(p, mPoints.GetDecay(p) * alpha);
     }
-
-    // Remember that the decay buffer is dirty
-    mPoints.MarkDecayBufferAsDirty();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 // Private helpers
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-void Ship::UpdateForSimulationParameters(
-    SimulationParameters const & simulationParameters,
-    ThreadManager & threadManager)
-{
-    size_t const simulationParallelism = threadManager.GetSimulationParallelism();
-    if (simulationParallelism != mCurrentSimulationParallelism
-        || simulationParameters.SpringRelaxationParallelComputationMode != mCurrentSpringRelaxationParallelComputationMode)
-    {
-        // Re-calculate spring relaxation parallelism
-        RecalculateSpringRelaxationParallelism(simulationParallelism, simulationParameters);
+//#define RENDER_FLOOD_DISTANCE
 
-        // Re-calculate light diffusion parallelism
-        RecalculateLightDiffusionParallelism(simulationParallelism);
+void Ship::RunConnectivityVisit()
+{
+    //
+    // Most structural changes - e.g. a spring broken within a mesh, or a triangle destroyed - leave
+    // connected components untouched, in which case point planes are unchanged and we only have to
+    // re-count the triangles in each plane; we thus only run the full visit when we can't rule out
+    // a change in connected components
+    //
 
-        // Remember new values
-        mCurrentSimulationParallelism = simulationParallelism;
-        mCurrentSpringRelaxationParallelComputationMode = simulationParameters.SpringRelaxationParallelComputationMode;
+    if (mIsFullConnectivityVisitRequired
+        || HaveConnectedComponentsChangedSinceLastConnectivityVisit())
+    {
+        RunFullConnectivityVisit();
+    }
+    else
+    {
+        RecalculatePlaneTriangleIndicesToRender();
     }
-}
 
-//#define RENDER_FLOOD_DISTANCE
+    mSeveredSpringEndpointsSinceLastConnectivityVisit.clear();
+    mIsFullConnectivityVisitRequired = false;
+}
 
-void Ship::RunConnectivityVisit()
+void Ship::RunFullConnectivityVisit()
 {
     //
     //
@@ -3469,6 +4138,85 @@ void Ship::RunConnectivityVisit()
     mPoints.ReorderBurningPointsForDepth();
 }
 
+bool Ship::HaveConnectedComponentsChangedSinceLastConnectivityVisit()
+{
+    //
+    // Connected components are unchanged if the endpoints of each severed spring are
+    // still connected to each other - which we check by means of a flood from one endpoint,
+    // bounded to a small neighborhood (as in a mesh the other endpoint is usually a couple
+    // of springs away); a flood that can't reach the other endpoint within the neighborhood
+    // is taken as a change
+    //
+    // Note: springs restored in the meantime are taken care of by the flag requiring a full visit
+    //
+
+    size_t constexpr MaxFloodPointCount = 64;
+
+    for (auto const & severedSpringEndpoints : mSeveredSpringEndpointsSinceLastConnectivityVisit)
+    {
+        ElementIndex const targetPointIndex = severedSpringEndpoints.second;
+
+        // Generate a new visit sequence number for this flood
+        auto const visitSequenceNumber = ++mCurrentConnectivityVisitSequenceNumber;
+
+        mConnectivityFloodPointsBuffer.clear();
+        mConnectivityFloodPointsBuffer.push_back(severedSpringEndpoints.first);
+        mPoints.SetCurrentConnectivityVisitSequenceNumber(severedSpringEndpoints.first, visitSequenceNumber);
+
+        bool hasReachedTarget = false;
+        for (size_t f = 0; f < mConnectivityFloodPointsBuffer.size() && !hasReachedTarget; ++f)
+        {
+            for (auto const & cs : mPoints.GetConnectedSprings(mConnectivityFloodPointsBuffer[f]).ConnectedSprings)
+            {
+                if (cs.OtherEndpointIndex == targetPointIndex)
+                {
+                    hasReachedTarget = true;
+                    break;
+                }
+
+                if (visitSequenceNumber != mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex)
+                    && mConnectivityFloodPointsBuffer.size() < MaxFloodPointCount)
+                {
+                    mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+                    mConnectivityFloodPointsBuffer.push_back(cs.OtherEndpointIndex);
+                }
+            }
+        }
+
+        if (!hasReachedTarget)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Ship::RecalculatePlaneTriangleIndicesToRender()
+{
+    //
+    // Same as what the full visit does, with planes as they are now
+    //
+
+    assert(mPlaneTriangleIndicesToRender.size() >= 1);
+    size_t const planeCount = mPlaneTriangleIndicesToRender.size() - 1;
+
+    // Count triangles in each plane, at plane + 1
+    std::fill(mPlaneTriangleIndicesToRender.begin(), mPlaneTriangleIndicesToRender.end(), 0);
+    for (auto const pointIndex : mPoints.RawShipPoints())
+    {
+        auto const planeId = mPoints.GetPlaneId(pointIndex);
+        assert(static_cast<size_t>(planeId) < planeCount);
+        mPlaneTriangleIndicesToRender[planeId + 1] += mPoints.GetConnectedOwnedTrianglesCount(pointIndex);
+    }
+
+    // Transform counts into starting indices
+    for (size_t p = 1; p <= planeCount; ++p)
+    {
+        mPlaneTriangleIndicesToRender[p] += mPlaneTriangleIndicesToRender[p - 1];
+    }
+}
+
 void Ship::SetAndPropagateResultantPointHullness(
     ElementIndex pointElementIndex,
     bool isHull)
@@ -3728,6 +4476,8 @@ void Ship::HandlePointDetach(
     float currentSimulationTime,
     SimulationParameters const & simulationParameters)
 {
+    WakeUp();
+
     bool hasAnythingBeenDestroyed = false;
 
     //
@@ -3834,6 +4584,8 @@ void Ship::HandlePointRestore(
     ElementIndex pointElementIndex,
     float currentSimulationTime)
 {
+    WakeUp();
+
     //
     // Restore the connected electrical element, if any and if it's deleted
     //
@@ -3865,6 +4617,11 @@ void Ship::HandleSpringDestroy(
     float currentSimulationTime,
     SimulationParameters const & simulationParameters)
 {
+    WakeUp();
+
+    // Structure has changed
+    mAreLightningTargetCandidatePointsDirty = true;
+
     auto const pointAIndex = mSprings.GetEndpointAIndex(springElementIndex);
     auto const pointBIndex = mSprings.GetEndpointBIndex(springElementIndex);
 
@@ -3882,6 +4639,22 @@ void Ship::HandleSpringDestroy(
     if (mPoints.GetConnectedSprings(pointBIndex).ConnectedSprings.empty())
         mPoints.OnOrphaned(pointBIndex);
 
+    // Remember to check whether this has split a connected component
+    if (!mIsFullConnectivityVisitRequired)
+    {
+        size_t constexpr MaxSeveredSpringsForConnectivityCheck = 256;
+
+        if (mSeveredSpringEndpointsSinceLastConnectivityVisit.size() < MaxSeveredSpringsForConnectivityCheck)
+        {
+            mSeveredSpringEndpointsSinceLastConnectivityVisit.emplace_back(pointAIndex, pointBIndex);
+        }
+        else
+        {
+            // Too many to check, a full visit is cheaper
+            mIsFullConnectivityVisitRequired = true;
+        }
+    }
+
     /////////////////////////////////////////////////
 
     //
@@ -3962,6 +4735,11 @@ void Ship::HandleSpringRestore(
     ElementIndex springElementIndex,
     SimulationParameters const & /*simulationParameters*/)
 {
+    WakeUp();
+
+    // Structure has changed
+    mAreLightningTargetCandidatePointsDirty = true;
+
     auto const pointAIndex = mSprings.GetEndpointAIndex(springElementIndex);
     auto const pointBIndex = mSprings.GetEndpointBIndex(springElementIndex);
 
@@ -3980,6 +4758,15 @@ void Ship::HandleSpringRestore(
     mPoints.ConnectSpring(pointAIndex, springElementIndex, pointBIndex);
     mPoints.ConnectSpring(pointBIndex, springElementIndex, pointAIndex);
 
+    // Remember that this might have joined two connected components - including an
+    // orphaned point, which does not make a connected component of its own
+    if (mPoints.GetConnectedComponentId(pointAIndex) != mPoints.GetConnectedComponentId(pointBIndex)
+        || mPoints.GetConnectedSprings(pointAIndex).ConnectedSprings.size() == 1
+        || mPoints.GetConnectedSprings(pointBIndex).ConnectedSprings.size() == 1)
+    {
+        mIsFullConnectivityVisitRequired = true;
+    }
+
     //
     // If both endpoints are electrical elements, and neither is deleted,
     // then connect them - i.e. add them to each other's set of connected electrical elements
@@ -15,22 +15,28 @@
 #include "../ShipOverlays.h"
 #include "../SimulationEventDispatcher.h"
 #include "../SimulationParameters.h"
+#include "../SpringRelaxationModeSelector.h"
 
 #include <Render/RenderContext.h>
 
+#include <Core/AABBGrid.h>
 #include <Core/AABBSet.h>
 #include <Core/Buffer.h>
 #include <Core/GameTypes.h>
 #include <Core/ImageData.h>
 #include <Core/PerfStats.h>
 #include <Core/RunningAverage.h>
+#include <Core/Snapshot.h>
+#include <Core/SpatialGrid.h>
 #include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
 #include <atomic>
+#include <functional>
 #include <list>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace Physics
@@ -70,12 +76,27 @@ public:
 
     size_t GetPointCount() const { return mPoints.GetElementCount(); }
 
+    ShipSpringRelaxationState GetSpringRelaxationState() const
+    {
+        return ShipSpringRelaxationState{
+            mId,
+            mCurrentSpringRelaxationParallelComputationMode.value_or(SpringRelaxationParallelComputationModeType::Automatic),
+            mCurrentSpringRelaxationParallelism,
+            mRequestedSpringRelaxationParallelComputationMode == SpringRelaxationParallelComputationModeType::Automatic && mSpringRelaxationModeSelector.IsEvaluating() };
+    }
+
     Points const & GetPoints() const { return mPoints; }
     Points & GetPoints() { return mPoints; }
 
     Springs const & GetSprings() const { return mSprings; }
 
     Triangles const & GetTriangles() const { return mTriangles; }
+    Triangles & GetTriangles() { return mTriangles; }
+
+    void SetInteriorTextureImage(RgbaImageData && interiorTextureImage)
+    {
+        mInteriorTextureImage = std::move(interiorTextureImage);
+    }
 
     bool IsUnderwater(ElementIndex pointElementIndex) const
     {
@@ -93,6 +114,53 @@ public:
         RecordedEvent const & event,
         SimulationParameters const & simulationParameters);
 
+    /*
+     * Saves the dynamic state of the ship - i.e. its points and springs - so that it may
+     * later be restored onto the same ship, or onto a newly-loaded instance of the same
+     * ship definition.
+     *
+     * Only structurally-intact ships may be snapshotted, as the structure itself is not
+     * part of snapshots. Not saved either: electrical elements, pins, gadgets, and
+     * ephemeral particles.
+     */
+    void SaveSnapshot(SnapshotWriter & writer) const;
+
+    void RestoreSnapshot(SnapshotReader & reader);
+
+    /*
+     * Adds the memory occupied by the ship's element containers to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
+    /*
+     * Processes eventual parameter changes; to be invoked at each simulation step,
+     * before any of the update stages.
+     *
+     * The spring relaxation parallelism is the parallelism that UpdateMechanics() may
+     * use; it is 1 when the ship's mechanics are updated at the same time as other ships'.
+     */
+    void UpdateForSimulationParameters(
+        SimulationParameters const & simulationParameters,
+        size_t simulationParallelism,
+        size_t springRelaxationParallelism,
+        ThreadManager & threadManager);
+
+    /*
+     * First update stage: masses, spring relaxation, and world bounds.
+     *
+     * Only touches this ship's own state, and thus it may run concurrently with the
+     * same stage of other ships.
+     */
+    void UpdateMechanics(
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+    /*
+     * Second update stage: all the rest.
+     *
+     * Generates events and interacts with the world, and thus it must run serially,
+     * in ship order.
+     */
     void Update(
         float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
@@ -102,9 +170,24 @@ public:
         ThreadManager & threadManager,
         PerfStats & perfStats);
 
+    /*
+     * Third update stage, once all ships have run their second stage: pushes apart
+     * the points of either ship that have penetrated the other ship's triangles,
+     * within the specified regions - the intersections of the ships' AABBs.
+     *
+     * Forces are applied as static forces, and are thus integrated at the next step.
+     */
+    void ApplyShipCollisions(
+        Ship & otherShip,
+        std::vector<Geometry::AABB> const & regions,
+        SimulationParameters const & simulationParameters);
+
     void UpdateEnd();
 
-    void RenderUpload(RenderContext & renderContext);
+    void RenderUpload(
+        RenderContext & renderContext,
+        float renderInterpolationFactor,
+        PerfStats & perfStats);
 
 public:
 
@@ -122,25 +205,29 @@ public:
         ConnectedComponentId connectedComponentId,
         vec2f const & moveOffset,
         vec2f const & inertialVelocity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void MoveBy(
         vec2f const & moveOffset,
         vec2f const & inertialVelocity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void RotateBy(
         ConnectedComponentId connectedComponentId,
         float angle,
         vec2f const & center,
         float inertialAngle,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void RotateBy(
         float angle,
         vec2f const & center,
         float inertialAngle,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void MoveGrippedBy(
         std::vector<GrippedMoveParameters> const & moves,
@@ -464,15 +551,15 @@ private:
         }
     };
 
-    std::list<Interaction> mQueuedInteractions;
+    // Re-used across steps, so as to not allocate at each interaction
+    std::vector<Interaction> mQueuedInteractions;
 
     void ApplyBlastAt(Interaction::ArgumentsUnion::BlastArguments const & args, SimulationParameters const & simulationParameters);
 
-    void DrawTo(Interaction::ArgumentsUnion::DrawArguments const & args);
-
     void Pull(Interaction::ArgumentsUnion::PullArguments const & args);
 
-    void SwirlAt(Interaction::ArgumentsUnion::SwirlArguments const & args);
+    // Applies all the queued interactions that act on all points - Draw and Swirl - in a single pass
+    void ApplyQueuedFieldInteractionForces();
 
 private:
 
@@ -482,19 +569,27 @@ private:
 
     // Mechanical
 
+    void UpdateSpringCoefficientsForSimulationParameters(
+        size_t simulationParallelism,
+        ThreadManager & threadManager);
+
     void ApplyQueuedInteractionForces(SimulationParameters const & simulationParameters);
 
     void ApplyWorldForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
         SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager,
         Geometry::ShipAABBSet & externalAabbSet);
 
+    void RecalculateWorldParticleForcesParallelism(size_t simulationParallelism);
+
     void ApplyWorldParticleForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
         Buffer<float> & newCachedPointDepths,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     template<bool DoDisplaceWater>
     void ApplyWorldSurfaceForces(
@@ -521,6 +616,7 @@ private:
 
     void RecalculateSpringRelaxationParallelism(
         size_t simulationParallelism,
+        SpringRelaxationParallelComputationModeType mode,
         SimulationParameters const & simulationParameters);
 
     void RecalculateSpringRelaxationParallelism_FullSpeed(
@@ -535,6 +631,12 @@ private:
         size_t simulationParallelism,
         SimulationParameters const & simulationParameters);
 
+    void RecalculateSpringRelaxationParallelism_Chebyshev(
+        size_t simulationParallelism,
+        SimulationParameters const & simulationParameters);
+
+    void PrepareSpringRelaxationDynamicForceBuffers(size_t simulationParallelism);
+
     void RunSpringRelaxation(
         ThreadManager & threadManager,
         SimulationParameters const & simulationParameters);
@@ -558,6 +660,10 @@ private:
         ThreadManager & threadManager,
         SimulationParameters const & simulationParameters);
 
+    void RunSpringRelaxation_Chebyshev(
+        ThreadManager & threadManager,
+        SimulationParameters const & simulationParameters);
+
     void RunSpringRelaxation_Hybrid_Thread_1(
         size_t threadIndex,
         ElementIndex startSpringIndex,
@@ -582,6 +688,27 @@ private:
         size_t parallelism,
         SimulationParameters const & simulationParameters);
 
+    inline void IntegrateAndResetDynamicForcesWithOverRelaxation(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        size_t parallelism,
+        float dynamicForceRelaxationFactor,
+        SimulationParameters const & simulationParameters);
+
+    // Resting
+
+    bool IsAtRest(SimulationParameters const & simulationParameters);
+
+    void RunEphemeralParticlesDynamics(SimulationParameters const & simulationParameters);
+
+    void UpdateRestingStepCount();
+
+    inline void WakeUp()
+    {
+        mIsAsleep = false;
+        mRestingStepCount = 0;
+    }
+
     inline float CalculateIntegrationVelocityFactor(float dt, SimulationParameters const & simulationParameters) const;
 
     //
@@ -595,16 +722,69 @@ private:
 
     void TrimForWorldBounds(SimulationParameters const & simulationParameters);
 
+    // Runs the transformation - of points in [start, end) - over the [0, pointCount) range,
+    // partitioned among the simulation threads when there are enough points
+    void RunPointTransformation(
+        ElementCount pointCount,
+        ThreadManager & threadManager,
+        std::function<void(ElementIndex, ElementIndex)> const & transformation);
+
+    // Returns the spatial index of the raw ship points, rebuilding it first if
+    // points have been moved since it was last built
+    SpatialGrid const & GetPointSpatialGrid() const;
+
+    // Returns the points that are candidate lightning targets, finding them first if
+    // the structure has changed - or enough time has elapsed - since they were last found
+    std::vector<ElementIndex> const & GetLightningTargetCandidatePoints() const;
+
     // Pressure and water
 
+    struct WaterInflowParameters
+    {
+        float EffectiveAirDensity;
+        float EffectiveWaterDensity;
+        float VolumetricWaterPressure; // Internal pressure delta per water delta
+        float RainEquivalentWaterHeight; // Depth equivalent of rain
+        float WaterPumpPowerMultiplier;
+        float CumulatedIntakenWaterThresholdForAirBubbles;
+        bool DoGenerateAirBubbles;
+
+        WaterInflowParameters(
+            float effectiveAirDensity,
+            float effectiveWaterDensity,
+            float volumetricWaterPressure,
+            float rainEquivalentWaterHeight,
+            float waterPumpPowerMultiplier,
+            float cumulatedIntakenWaterThresholdForAirBubbles,
+            bool doGenerateAirBubbles)
+            : EffectiveAirDensity(effectiveAirDensity)
+            , EffectiveWaterDensity(effectiveWaterDensity)
+            , VolumetricWaterPressure(volumetricWaterPressure)
+            , RainEquivalentWaterHeight(rainEquivalentWaterHeight)
+            , WaterPumpPowerMultiplier(waterPumpPowerMultiplier)
+            , CumulatedIntakenWaterThresholdForAirBubbles(cumulatedIntakenWaterThresholdForAirBubbles)
+            , DoGenerateAirBubbles(doGenerateAirBubbles)
+        {}
+    };
+
     void UpdatePressureAndWaterInflow(
         float effectiveAirDensity,
         float effectiveWaterDensity,
         float currentSimulationTime,
         Storm::Parameters const & stormParameters,
         SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager,
         float & waterTakenInStep);
 
+    // Returns the water taken by the points in the range
+    float UpdateLeakingPointsPressureAndWaterInflow(
+        std::vector<ElementIndex> const & leakingPoints,
+        size_t startLeakingPoint,
+        size_t endLeakingPoint,
+        WaterInflowParameters const & waterInflowParameters,
+        SimulationParameters const & simulationParameters,
+        std::vector<ElementIndex> & airBubbleSourcePoints);
+
     void EqualizeInternalPressure(SimulationParameters const & simulationParameters);
 
     void UpdateWaterVelocities(
@@ -623,11 +803,52 @@ private:
 
     // Heat
 
-    void PropagateHeat(
-        float currentSimulationTime,
+    struct HeatPropagationParameters
+    {
+        float ThermalConductivityCoefficient; // Adjustment * dt
+        float SurfaceWaterTemperature;
+        float ThermoclineSlope;
+        float WaterConvectiveHeatTransferCoefficient;
+        float AirTemperature; // Includes storm
+        float AirConvectiveHeatTransferCoefficient; // Includes rain
+
+        HeatPropagationParameters(
+            float thermalConductivityCoefficient,
+            float surfaceWaterTemperature,
+            float thermoclineSlope,
+            float waterConvectiveHeatTransferCoefficient,
+            float airTemperature,
+            float airConvectiveHeatTransferCoefficient)
+            : ThermalConductivityCoefficient(thermalConductivityCoefficient)
+            , SurfaceWaterTemperature(surfaceWaterTemperature)
+            , ThermoclineSlope(thermoclineSlope)
+            , WaterConvectiveHeatTransferCoefficient(waterConvectiveHeatTransferCoefficient)
+            , AirTemperature(airTemperature)
+            , AirConvectiveHeatTransferCoefficient(airConvectiveHeatTransferCoefficient)
+        {}
+    };
+
+    void RecalculateHeatPropagationParallelism(size_t simulationParallelism);
+
+    HeatPropagationParameters CalculateHeatPropagationParameters(
         float dt,
-		Storm::Parameters const & stormParameters,
-        SimulationParameters const & simulationParameters);
+        Storm::Parameters const & stormParameters,
+        SimulationParameters const & simulationParameters) const;
+
+    void CalculateHeatOutflowNormalizationFactors(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        HeatPropagationParameters const & heatPropagationParameters,
+        float * restrict oldPointTemperatureBufferData,
+        float * restrict outflowNormalizationFactorBufferData);
+
+    void PropagateHeat(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        HeatPropagationParameters const & heatPropagationParameters,
+        float const * restrict oldPointTemperatureBufferData,
+        float const * restrict outflowNormalizationFactorBufferData,
+        std::vector<ElementIndex> & hotPoints);
 
     // Misc
 
@@ -651,12 +872,14 @@ private:
     // Misc
     /////////////////////////////////////////////////////////////////////////
 
-    inline void UpdateForSimulationParameters(
-        SimulationParameters const & simulationParameters,
-        ThreadManager & threadManager);
-
     void RunConnectivityVisit();
 
+    void RunFullConnectivityVisit();
+
+    bool HaveConnectedComponentsChangedSinceLastConnectivityVisit();
+
+    void RecalculatePlaneTriangleIndicesToRender();
+
     inline void SetAndPropagateResultantPointHullness(
         ElementIndex pointElementIndex,
         bool isHull);
@@ -671,6 +894,11 @@ private:
         ElementIndex pointElementIndex,
         float currentSimulationTime);
 
+    // Populates mToolSpringIndices with the (sorted) springs that might intersect the segment
+    void GatherSpringsAlongSegment(
+        vec2f const & startPos,
+        vec2f const & endPos);
+
     void InternalSpawnAirBubble(
         vec2f const & position,
         float depth,
@@ -881,6 +1109,15 @@ private:
         float currentSimulationTime,
         SimulationParameters const & simulationParameters);
 
+    /////////////////////////////////////////////////////////////////////////
+    // Collision Helpers
+    /////////////////////////////////////////////////////////////////////////
+
+    // Returns the number of contacts
+    size_t CollidePointsWithTrianglesOf(
+        Ship & triangleShip,
+        std::vector<Geometry::AABB> const & regions);
+
 private:
 
     ShipId const mId;
@@ -930,12 +1167,45 @@ private:
     // to the rendering context
     bool mIsStructureDirty;
 
+    // The endpoints of the springs destroyed since the last connectivity visit; when all of them
+    // are still connected to each other, connected components (and thus planes) are unchanged and
+    // the next visit may be skipped
+    std::vector<std::pair<ElementIndex, ElementIndex>> mSeveredSpringEndpointsSinceLastConnectivityVisit;
+
+    // Flag remembering whether the next connectivity visit has to be a full one regardless,
+    // e.g. because a restored spring might have joined two connected components
+    bool mIsFullConnectivityVisitRequired;
+
+    // Work buffer for the floods checking severed springs
+    std::vector<ElementIndex> mConnectivityFloodPointsBuffer;
+
+    // Flag remembering whether elements have to be re-uploaded to the rendering context,
+    // which happens at the first upload after the structure has changed (we skip uploads
+    // while we're not visible)
+    bool mAreElementsDirtyForRendering;
+
     // Counts of elements currently broken - updated each time an element is broken
     // or restored
     ElementCount mDamagedPointsCount;
     ElementCount mBrokenSpringsCount;
     ElementCount mBrokenTrianglesCount;
 
+    // Aggregates of the (non-ephemeral) ship points, calculated by the world forces
+    // as a by-product of their visit of the points, and hence valid from then on
+    // during a step
+    struct PointAggregates
+    {
+        ElementCount WetPointCount;
+        ElementCount UnderwaterPointCount;
+
+        PointAggregates()
+            : WetPointCount(0)
+            , UnderwaterPointCount(0)
+        {}
+    };
+
+    PointAggregates mPointAggregates;
+
     // Sinking detection
     bool mIsSinking;
 
@@ -951,9 +1221,55 @@ private:
     // repair process
     float mRepairGracePeriodMultiplier;
 
+    // State of the current repair session - a run of consecutive repair steps - so that
+    // each step need not re-derive from scratch what the previous steps have found out
+    struct RepairSessionState
+    {
+        // The max number of points that may take the role of attractor in one step;
+        // the ones beyond are deferred to the next step
+        static size_t constexpr MaxAttractorsPerStep = 1024;
+
+        SequenceNumber LastRepairStepId;
+
+        // The points that have taken the role of attractor in the current step,
+        // and in the two previous steps
+        std::vector<ElementIndex> CurrentStepAttractors;
+        std::vector<ElementIndex> PreviousStepAttractors;
+        std::vector<ElementIndex> PreviousPreviousStepAttractors;
+
+        // The points that were eligible as attractors after the budget ran out,
+        // in the current step and in the previous step
+        std::vector<ElementIndex> CurrentStepDeferredAttractors;
+        std::vector<ElementIndex> PreviousStepDeferredAttractors;
+
+        size_t RemainingAttractorBudget;
+
+        // Scratch buffers, kept to reuse their capacity
+        std::vector<ElementIndex> PointsInRadius;
+        std::vector<ElementIndex> PriorityPoints;
+
+        RepairSessionState()
+            : LastRepairStepId()
+            , RemainingAttractorBudget(MaxAttractorsPerStep)
+        {}
+    };
+
+    RepairSessionState mRepairSessionState;
+
     // Index of last-queried point - used as an aid to debugging
     ElementIndex mutable mLastQueriedPointIndex;
 
+    // Spatial index of the raw ship points, for tool queries; rebuilt lazily,
+    // at the first query after points have been moved
+    SpatialGrid mutable mPointSpatialGrid;
+    bool mutable mIsPointSpatialGridDirty;
+
+    // Candidate lightning targets: the topmost connected point of each vertical strip
+    // of the ship, as of when they were last found; found again lazily
+    std::vector<ElementIndex> mutable mLightningTargetCandidatePoints;
+    bool mutable mAreLightningTargetCandidatePointsDirty;
+    float mutable mLightningTargetCandidatePointsSimulationTime;
+
     // Counter of created bubble ephemeral particles
     std::uint64_t mAirBubblesCreatedCount;
 
@@ -961,6 +1277,13 @@ private:
     // detect changes
     size_t mCurrentSimulationParallelism;
 
+    // The last spring relaxation parallelism we've been assigned; used to
+    // detect changes
+    size_t mAssignedSpringRelaxationParallelism;
+
+    // The spring relaxation parallelism we're running with; at most the assigned one
+    size_t mCurrentSpringRelaxationParallelism;
+
     //
     // Spring relaxation
     //
@@ -990,9 +1313,50 @@ private:
     // The signals for completions for threads to synchronize with each other
     std::atomic<int> mSpringRelaxation_Hybrid_IterationCompleted;
 
-    // The last spring relaxation computation parameters; used to detect changes
+    // Chebyshev mode; spring forces are calculated by the StepByStep spring forces tasks
+
+    // The spring relaxation tasks
+    std::vector<typename ThreadPool::Task> mSpringRelaxation_Chebyshev_IntegrationTasks;
+    std::vector<typename ThreadPool::Task> mSpringRelaxation_Chebyshev_IntegrationAndSeaFloorCollisionTasks;
+
+    // The over-relaxation factor of the current iteration, read by the integration tasks
+    float mSpringRelaxation_Chebyshev_RelaxationFactor;
+
+    // The last spring relaxation computation mode we've been asked for; used to detect changes
+    std::optional<SpringRelaxationParallelComputationModeType> mRequestedSpringRelaxationParallelComputationMode;
+
+    // The spring relaxation computation mode we're running with; never Automatic
     std::optional<SpringRelaxationParallelComputationModeType> mCurrentSpringRelaxationParallelComputationMode;
 
+    // Chooses the mode and parallelism when the requested mode is Automatic
+    SpringRelaxationModeSelector mSpringRelaxationModeSelector;
+
+    // The duration of the last spring relaxation, when timed for the selector
+    std::optional<float> mLastSpringRelaxationMillis;
+
+    // The tasks that zero - and thus first-touch - new dynamic force buffers from the threads
+    // that use them; empty when no buffers await initialization
+    std::vector<typename ThreadPool::Task> mSpringRelaxation_DynamicForceInitializationTasks;
+
+    // The index of the first dynamic force buffer awaiting initialization, if any
+    size_t mSpringRelaxation_FirstUninitializedDynamicForceBuffer;
+
+    //
+    // Resting
+    //
+    // A ship whose points have been still for a while, and whose forces are still
+    // in balance, skips spring relaxation until anything disturbs it
+    //
+
+    // Consecutive steps during which all ship points have been still
+    int mRestingStepCount;
+
+    // Whether we're currently skipping spring relaxation
+    bool mIsAsleep;
+
+    // Spring forces, for checking whether forces are still in balance
+    Buffer<vec2f> mRestingSpringForceBuffer;
+
     //
     // Static pressure
     //
@@ -1026,6 +1390,24 @@ private:
     float mStaticPressureIterationsPercentagesSum;
     float mStaticPressureIterationsCount;
 
+    //
+    // Water inflow
+    //
+
+    // The points that are due to produce air bubbles, by water inflow task;
+    // member only to save allocations at use time
+    std::vector<std::vector<ElementIndex>> mAirBubbleSourcePointsByTask;
+
+    //
+    // World particle forces
+    //
+
+    // The point partitions on which world particle forces are applied concurrently
+    std::vector<std::pair<ElementIndex, ElementIndex>> mWorldParticleForcesPointRanges;
+
+    // The point aggregates of each partition, reduced into mPointAggregates
+    std::vector<PointAggregates> mWorldParticleForcesPartitionAggregates;
+
     //
     // Light diffusion
     //
@@ -1033,6 +1415,33 @@ private:
     // The light diffusion tasks
     std::vector<typename ThreadPool::Task> mLightDiffusionTasks;
 
+    //
+    // Heat propagation
+    //
+
+    // The point partitions on which heat propagation runs concurrently
+    std::vector<std::pair<ElementIndex, ElementIndex>> mHeatPropagationPointRanges;
+
+    // The points that each heat propagation partition found hot enough to ignite
+    std::vector<std::vector<ElementIndex>> mHeatPropagationHotPoints;
+
+    //
+    // Ship-to-ship collisions
+    //
+
+    // Scratch space for gathering the other ship's triangles near the collision regions;
+    // re-used across steps so as to not allocate at each step
+    std::vector<ElementIndex> mCollisionTriangleIndices;
+    std::vector<Geometry::AABBGrid::Entry> mCollisionTriangleGridEntries;
+    Geometry::AABBGrid mCollisionTriangleGrid;
+
+    //
+    // Tools
+    //
+
+    // Scratch space for the springs that "through" tools test against their segment
+    std::vector<ElementIndex> mToolSpringIndices;
+
     //
     // Render members
     //
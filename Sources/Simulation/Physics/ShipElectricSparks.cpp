@@ -17,11 +17,16 @@ ShipElectricSparks::ShipElectricSparks(
     Points const & points,
     Springs const & springs)
     : mShipPhysicsHandler(shipPhysicsHandler)
-    , mIsSpringElectrifiedOld(springs.GetElementCount(), 0, false)
-    , mIsSpringElectrifiedNew(springs.GetElementCount(), 0, false)
-    , mPointElectrificationCounter(points.GetElementCount(), 0, std::numeric_limits<std::uint64_t>::max())
+    , mCurrentGeneration(1) // So that at the first interaction, nothing looks like it had been electrified at the previous one
+    , mSpringElectrificationGeneration(springs.GetElementCount(), 0, 0)
+    , mPointElectrificationGeneration(points.GetElementCount(), 0, 0)
     , mAreSparksPopulatedBeforeNextUpdate(false)
     , mSparksToRender()
+    , mCurrentPointsToVisit()
+    , mNextPointsToVisit()
+    , mInitialSprings()
+    , mOtherInitialSprings()
+    , mNextSprings()
 {
 }
 
@@ -140,46 +145,17 @@ void ShipElectricSparks::PropagateSparks(
         * lengthMultiplier
         * (simulationParameters.IsUltraViolentMode ? 2.0f : 1.0f);
 
-    // The information associated with a point that the next expansion will start from
-    struct SparkPointToVisit
-    {
-        ElementIndex PointIndex;
-        vec2f PreferredDirection; // Normalized direction that this arc started with
-        float EquivalentPathLength; // Cumulative equivalent length of path so far, up to the point that the spark starts at
-        ElementIndex IncomingSpringIndex; // The index of the spring that we traveled to reach this point
-        size_t IncomingRenderableSparkIndex; // The index of the spark we traveled through to reach this point
-        float EquivalentPathLengthToNextFork; // We'll fork when the equivalent path length is longer than this
-
-        SparkPointToVisit(
-            ElementIndex pointIndex,
-            vec2f const & preferredDirection,
-            float equivalentPathLength,
-            ElementIndex incomingSpringIndex,
-            size_t incomingRenderableSparkIndex,
-            float equivalentPathLengthToNextFork)
-            : PointIndex(pointIndex)
-            , PreferredDirection(preferredDirection)
-            , EquivalentPathLength(equivalentPathLength)
-            , IncomingSpringIndex(incomingSpringIndex)
-            , IncomingRenderableSparkIndex(incomingRenderableSparkIndex)
-            , EquivalentPathLengthToNextFork(equivalentPathLengthToNextFork)
-        {}
-    };
-
     //
     // Initialize
     //
 
-    // Prepare IsSpringElectrified buffer
-    mIsSpringElectrifiedNew.fill(false);
-    bool * const wasSpringElectrifiedInPreviousInteraction = mIsSpringElectrifiedOld.data();
-    bool * const isSpringElectrifiedInThisInteraction = mIsSpringElectrifiedNew.data();
-
-    // Prepare point electrification flag
-    if (counter == 0)
-    {
-        mPointElectrificationCounter.fill(std::numeric_limits<std::uint64_t>::max());
-    }
+    // Start a new generation: this implicitly clears all the flags of this interaction,
+    // and turns the flags of the last one into the flags of the previous one
+    ++mCurrentGeneration;
+    std::uint64_t const currentGeneration = mCurrentGeneration;
+    std::uint64_t const previousGeneration = mCurrentGeneration - 1;
+    std::uint64_t * const springElectrificationGeneration = mSpringElectrificationGeneration.data();
+    std::uint64_t * const pointElectrificationGeneration = mPointElectrificationGeneration.data();
 
     // Clear the sparks that have to be rendered after this step
     mSparksToRender.clear();
@@ -211,13 +187,14 @@ void ShipElectricSparks::PropagateSparks(
         currentSimulationTime,
         simulationParameters);
 
-    mPointElectrificationCounter[initialPointIndex] = counter;
+    pointElectrificationGeneration[initialPointIndex] = currentGeneration;
 
     //
     // 2. Jump-start: find the initial springs outgoing from the initial point
     //
 
-    std::vector<ElementIndex> initialSprings;
+    std::vector<ElementIndex> & initialSprings = mInitialSprings;
+    initialSprings.clear();
 
     {
         // Decide number of initial springs for this interaction
@@ -227,13 +204,14 @@ void ShipElectricSparks::PropagateSparks(
         // 1. Fetch all springs that were electrified in the previous iteration
         //
 
-        std::vector<std::tuple<ElementIndex, float>> otherSprings;
+        auto & otherSprings = mOtherInitialSprings;
+        otherSprings.clear();
 
         for (auto const & cs : points.GetConnectedSprings(initialPointIndex).ConnectedSprings)
         {
-            assert(mPointElectrificationCounter[cs.OtherEndpointIndex] != counter);
+            assert(pointElectrificationGeneration[cs.OtherEndpointIndex] != currentGeneration);
 
-            if (wasSpringElectrifiedInPreviousInteraction[cs.SpringIndex]
+            if (springElectrificationGeneration[cs.SpringIndex] == previousGeneration
                 && initialSprings.size() < initialArcsCount)
             {
                 initialSprings.emplace_back(cs.SpringIndex);
@@ -270,7 +248,8 @@ void ShipElectricSparks::PropagateSparks(
     // 3. Electrify the initial springs and initialize expansions
     //
 
-    std::vector<SparkPointToVisit> currentPointsToVisit;
+    std::vector<SparkPointToVisit> & currentPointsToVisit = mCurrentPointsToVisit;
+    currentPointsToVisit.clear();
 
     {
         auto const initialPointPosition = points.GetPosition(initialPointIndex);
@@ -297,8 +276,8 @@ void ShipElectricSparks::PropagateSparks(
                 simulationParameters);
 
             // Remember the point is electrified now
-            assert(mPointElectrificationCounter[targetEndpointIndex] != counter);
-            mPointElectrificationCounter[targetEndpointIndex] = counter;
+            assert(pointElectrificationGeneration[targetEndpointIndex] != currentGeneration);
+            pointElectrificationGeneration[targetEndpointIndex] = currentGeneration;
 
             // Queue for next expansion
             if (equivalentPathLength < maxEquivalentPathLengthForThisInteraction)
@@ -328,9 +307,10 @@ void ShipElectricSparks::PropagateSparks(
     // 3. Expand now
     //
 
-    std::vector<SparkPointToVisit> nextPointsToVisit;
+    std::vector<SparkPointToVisit> & nextPointsToVisit = mNextPointsToVisit;
+    nextPointsToVisit.clear();
 
-    std::vector<ElementIndex> nextSprings; // Allocated once for perf
+    std::vector<ElementIndex> & nextSprings = mNextSprings;
 
     while (!currentPointsToVisit.empty())
     {
@@ -374,9 +354,9 @@ void ShipElectricSparks::PropagateSparks(
                     vec2f const springDirection = (points.GetPosition(cs.OtherEndpointIndex) - startingPointPosition).normalise();
                     float const springAlignment = springDirection.dot(pv.PreferredDirection);
 
-                    if (nextSprings.empty() && wasSpringElectrifiedInPreviousInteraction[cs.SpringIndex])
+                    if (nextSprings.empty() && springElectrificationGeneration[cs.SpringIndex] == previousGeneration)
                     {
-                        if (mPointElectrificationCounter[cs.OtherEndpointIndex] != counter
+                        if (pointElectrificationGeneration[cs.OtherEndpointIndex] != currentGeneration
                             && springAlignment > 0.0f)
                         {
                             // We take this one for sure
@@ -518,10 +498,10 @@ void ShipElectricSparks::PropagateSparks(
                 }
 
                 // Propagate visit
-                if (mPointElectrificationCounter[targetEndpointIndex] != counter)
+                if (pointElectrificationGeneration[targetEndpointIndex] != currentGeneration)
                 {
                     // Electrify spring
-                    isSpringElectrifiedInThisInteraction[s] = true;
+                    springElectrificationGeneration[s] = currentGeneration;
 
                     // Electrify point
                     mShipPhysicsHandler.HandleElectricSpark(
@@ -530,8 +510,8 @@ void ShipElectricSparks::PropagateSparks(
                         currentSimulationTime,
                         simulationParameters);
 
-                    // Remember this point is not electrified
-                    mPointElectrificationCounter[targetEndpointIndex] = counter;
+                    // Remember this point is now electrified
+                    pointElectrificationGeneration[targetEndpointIndex] = currentGeneration;
 
                     // Next expansion
                     if (endEquivalentPathLength < maxEquivalentPathLengthForThisInteraction)
@@ -557,9 +537,6 @@ void ShipElectricSparks::PropagateSparks(
     // Finalize
     //
 
-    // Swap IsElectrified buffers
-    mIsSpringElectrifiedNew.swap(mIsSpringElectrifiedOld);
-
     // Remember that we have populated electric sparks
     mAreSparksPopulatedBeforeNextUpdate = true;
 }
@@ -11,6 +11,7 @@
 #include <Core/BufferAllocator.h>
 #include <Core/Vectors.h>
 
+#include <tuple>
 #include <vector>
 
 namespace Physics
@@ -57,14 +58,18 @@ private:
     // The handler to invoke for acting on the ship
     IShipPhysicsHandler & mShipPhysicsHandler;
 
-    // Flag remembering whether a spring is electrified or not;
+    // The generation of the current interaction, incremented at each interaction;
+    // flags below are "set" when they equal the generation, so that they never
+    // need to be cleared
+    std::uint64_t mCurrentGeneration;
+
+    // The generation of the last interaction that electrified a spring;
     // cardinality=springs
-    Buffer<bool> mIsSpringElectrifiedOld;
-    Buffer<bool> mIsSpringElectrifiedNew;
+    Buffer<std::uint64_t> mSpringElectrificationGeneration;
 
-    // Work buffer for flagging points as visited during an interaction;
+    // The generation of the last interaction that visited a point;
     // cardinality=points
-    Buffer<std::uint64_t> mPointElectrificationCounter;
+    Buffer<std::uint64_t> mPointElectrificationGeneration;
 
     // Flag remembering whether electric sparks have been populated prior to the next Update() step
     bool mAreSparksPopulatedBeforeNextUpdate;
@@ -108,6 +113,45 @@ private:
     };
 
     std::vector<RenderableElectricSpark> mSparksToRender;
+
+    //
+    // Propagation work buffers, re-used across interactions so as to not allocate at each
+    // interaction
+    //
+
+    // The information associated with a point that the next expansion will start from
+    struct SparkPointToVisit
+    {
+        ElementIndex PointIndex;
+        vec2f PreferredDirection; // Normalized direction that this arc started with
+        float EquivalentPathLength; // Cumulative equivalent length of path so far, up to the point that the spark starts at
+        ElementIndex IncomingSpringIndex; // The index of the spring that we traveled to reach this point
+        size_t IncomingRenderableSparkIndex; // The index of the spark we traveled through to reach this point
+        float EquivalentPathLengthToNextFork; // We'll fork when the equivalent path length is longer than this
+
+        SparkPointToVisit(
+            ElementIndex pointIndex,
+            vec2f const & preferredDirection,
+            float equivalentPathLength,
+            ElementIndex incomingSpringIndex,
+            size_t incomingRenderableSparkIndex,
+            float equivalentPathLengthToNextFork)
+            : PointIndex(pointIndex)
+            , PreferredDirection(preferredDirection)
+            , EquivalentPathLength(equivalentPathLength)
+            , IncomingSpringIndex(incomingSpringIndex)
+            , IncomingRenderableSparkIndex(incomingRenderableSparkIndex)
+            , EquivalentPathLengthToNextFork(equivalentPathLengthToNextFork)
+        {}
+    };
+
+    // The wavefronts of the current and of the next expansion
+    std::vector<SparkPointToVisit> mCurrentPointsToVisit;
+    std::vector<SparkPointToVisit> mNextPointsToVisit;
+
+    std::vector<ElementIndex> mInitialSprings;
+    std::vector<std::tuple<ElementIndex, float>> mOtherInitialSprings;
+    std::vector<ElementIndex> mNextSprings;
 };
 
 }
@@ -0,0 +1,271 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "Physics.h"
+
+#include <Core/GameGeometry.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace Physics {
+
+void Ship::ApplyShipCollisions(
+    Ship & otherShip,
+    std::vector<Geometry::AABB> const & regions,
+    SimulationParameters const & /*simulationParameters*/)
+{
+    assert(&otherShip != this);
+
+    // Each ship's points against the other ship's triangles
+    size_t const contactCount =
+        CollidePointsWithTrianglesOf(otherShip, regions)
+        + otherShip.CollidePointsWithTrianglesOf(*this, regions);
+
+    if (contactCount > 0)
+    {
+        // Sleeping ships would ignore the forces
+        WakeUp();
+        otherShip.WakeUp();
+    }
+}
+
+size_t Ship::CollidePointsWithTrianglesOf(
+    Ship & triangleShip,
+    std::vector<Geometry::AABB> const & regions)
+{
+    // How far from a region a triangle's endpoint may be for the triangle to still
+    // overlap the region; triangles are not larger than this
+    float constexpr TriangleSearchMargin = 2.0f;
+
+    // Boxes are slightly larger than the triangles, so that positions that are found to be in a triangle
+    // despite rounding are also found to be in its box
+    float constexpr BoxMargin = 0.01f;
+
+    // Each cell to hold a few triangles
+    float constexpr TargetTrianglesPerCell = 4.0f;
+
+    float constexpr Dt = SimulationParameters::SimulationStepTimeDuration<float>;
+
+    Points & trianglePoints = triangleShip.mPoints;
+    Triangles const & triangles = triangleShip.mTriangles;
+
+    //
+    // Gather the other ship's triangles near the regions, and index them
+    //
+
+    mCollisionTriangleIndices.clear();
+
+    SpatialGrid const & trianglePointGrid = triangleShip.GetPointSpatialGrid();
+    for (auto const & region : regions)
+    {
+        trianglePointGrid.VisitInRectangle(
+            region.BottomLeft - vec2f(TriangleSearchMargin, TriangleSearchMargin),
+            region.TopRight + vec2f(TriangleSearchMargin, TriangleSearchMargin),
+            [&](ElementIndex pointIndex)
+            {
+                for (auto const t : trianglePoints.GetConnectedTriangles(pointIndex).ConnectedTriangles)
+                {
+                    mCollisionTriangleIndices.push_back(t);
+                }
+            });
+    }
+
+    if (mCollisionTriangleIndices.empty())
+    {
+        return 0;
+    }
+
+    // Sort, so that the grid - and thus the contacts - only depend on the ships' state
+    std::sort(mCollisionTriangleIndices.begin(), mCollisionTriangleIndices.end());
+    mCollisionTriangleIndices.erase(
+        std::unique(mCollisionTriangleIndices.begin(), mCollisionTriangleIndices.end()),
+        mCollisionTriangleIndices.end());
+
+    mCollisionTriangleGridEntries.clear();
+    for (auto const t : mCollisionTriangleIndices)
+    {
+        if (triangles.IsDeleted(t))
+        {
+            continue;
+        }
+
+        Geometry::AABB box;
+        box.ExtendTo(trianglePoints.GetPosition(triangles.GetPointAIndex(t)));
+        box.ExtendTo(trianglePoints.GetPosition(triangles.GetPointBIndex(t)));
+        box.ExtendTo(trianglePoints.GetPosition(triangles.GetPointCIndex(t)));
+
+        box.TopRight += vec2f(BoxMargin, BoxMargin);
+        box.BottomLeft -= vec2f(BoxMargin, BoxMargin);
+
+        mCollisionTriangleGridEntries.emplace_back(t, box);
+    }
+
+    if (mCollisionTriangleGridEntries.empty())
+    {
+        return 0;
+    }
+
+    mCollisionTriangleGrid.Build(mCollisionTriangleGridEntries, TargetTrianglesPerCell);
+
+    //
+    // Visit our points in the regions, and push out those that are in a triangle
+    //
+
+    size_t contactCount = 0;
+
+    SpatialGrid const & pointGrid = GetPointSpatialGrid();
+    for (size_t r = 0; r < regions.size(); ++r)
+    {
+        pointGrid.VisitInRectangle(
+            regions[r].BottomLeft,
+            regions[r].TopRight,
+            [&](ElementIndex pointIndex)
+            {
+                vec2f const & pointPosition = mPoints.GetPosition(pointIndex);
+
+                // Cells overlap the rectangle, rather than being contained in it
+                if (!regions[r].Contains(pointPosition))
+                {
+                    return;
+                }
+
+                // Points in multiple regions are only collided once
+                for (size_t r2 = 0; r2 < r; ++r2)
+                {
+                    if (regions[r2].Contains(pointPosition))
+                    {
+                        return;
+                    }
+                }
+
+                mCollisionTriangleGrid.VisitCandidates(
+                    pointPosition,
+                    [&](ElementIndex t) -> bool
+                    {
+                        auto const & endpoints = triangles.GetPointIndices(t);
+                        vec2f const vertexPositions[3] = {
+                            trianglePoints.GetPosition(endpoints[0]),
+                            trianglePoints.GetPosition(endpoints[1]),
+                            trianglePoints.GetPosition(endpoints[2]) };
+
+                        if (!Geometry::IsPointInTriangle(pointPosition, vertexPositions[0], vertexPositions[1], vertexPositions[2]))
+                        {
+                            return false;
+                        }
+
+                        //
+                        // Find the edge to push the point out through: the closest one,
+                        // preferring edges on the ship's frontier
+                        //
+
+                        vec2f bestNormal = vec2f::zero();
+                        float bestDepth = std::numeric_limits<float>::max();
+                        bool isBestOnFrontier = false;
+
+                        for (int e = 0; e < 3; ++e)
+                        {
+                            vec2f const & edgeStart = vertexPositions[e];
+                            vec2f const & edgeEnd = vertexPositions[(e + 1) % 3];
+                            vec2f const & oppositeVertex = vertexPositions[(e + 2) % 3];
+
+                            vec2f const edge = edgeEnd - edgeStart;
+                            float const edgeLength = edge.length();
+                            if (edgeLength < 0.0001f)
+                            {
+                                // Degenerate
+                                continue;
+                            }
+
+                            // Outward normal
+                            vec2f normal = edge.to_perpendicular() / edgeLength;
+                            if ((oppositeVertex - edgeStart).dot(normal) > 0.0f)
+                            {
+                                normal = -normal;
+                            }
+
+                            float const depth = -(pointPosition - edgeStart).dot(normal);
+
+                            ElementIndex const oppositeTriangle = triangles.GetOppositeTriangle(t, e).TriangleElementIndex;
+                            bool const isOnFrontier =
+                                oppositeTriangle == NoneElementIndex
+                                || triangles.IsDeleted(oppositeTriangle);
+
+                            if ((isOnFrontier && !isBestOnFrontier)
+                                || (isOnFrontier == isBestOnFrontier && depth < bestDepth))
+                            {
+                                bestNormal = normal;
+                                bestDepth = depth;
+                                isBestOnFrontier = isOnFrontier;
+                            }
+                        }
+
+                        if (bestDepth == std::numeric_limits<float>::max())
+                        {
+                            // Degenerate triangle
+                            return false;
+                        }
+
+                        bestDepth = std::max(bestDepth, 0.0f);
+
+                        //
+                        // Barycentric weights of the point in the triangle
+                        //
+
+                        float const area = (vertexPositions[1] - vertexPositions[0]).cross(vertexPositions[2] - vertexPositions[0]);
+                        if (area == 0.0f)
+                        {
+                            return false;
+                        }
+
+                        float const weights[3] = {
+                            (vertexPositions[1] - pointPosition).cross(vertexPositions[2] - pointPosition) / area,
+                            (vertexPositions[2] - pointPosition).cross(vertexPositions[0] - pointPosition) / area,
+                            (vertexPositions[0] - pointPosition).cross(vertexPositions[1] - pointPosition) / area };
+
+                        vec2f triangleVelocity = vec2f::zero();
+                        float triangleMass = 0.0f;
+                        for (int v = 0; v < 3; ++v)
+                        {
+                            triangleVelocity += trianglePoints.GetVelocity(endpoints[v]) * weights[v];
+                            triangleMass += trianglePoints.GetMass(endpoints[v]) * weights[v];
+                        }
+
+                        //
+                        // Penalty force: springs the penetration back, and damps the
+                        // approaching relative velocity
+                        //
+
+                        float const pointMass = mPoints.GetMass(pointIndex);
+                        float const reducedMass = (pointMass * triangleMass) / (pointMass + triangleMass);
+
+                        float const normalVelocity = (mPoints.GetVelocity(pointIndex) - triangleVelocity).dot(bestNormal);
+
+                        float const forceMagnitude =
+                            reducedMass
+                            * (SimulationParameters::ShipCollisionStiffness * bestDepth / (Dt * Dt)
+                                - SimulationParameters::ShipCollisionDamping * std::min(normalVelocity, 0.0f) / Dt);
+
+                        vec2f const force = bestNormal * forceMagnitude;
+
+                        mPoints.AddStaticForce(pointIndex, force);
+                        for (int v = 0; v < 3; ++v)
+                        {
+                            trianglePoints.AddStaticForce(endpoints[v], -force * weights[v]);
+                        }
+
+                        ++contactCount;
+
+                        // One triangle is enough
+                        return true;
+                    });
+            });
+    }
+
+    return contactCount;
+}
+
+}
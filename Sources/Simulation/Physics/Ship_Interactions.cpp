@@ -86,31 +86,46 @@ void Ship::MoveBy(
     ConnectedComponentId connectedComponentId,
     vec2f const & moveOffset,
     vec2f const & inertialVelocity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
+    WakeUp();
+
     vec2f const actualInertialVelocity =
         inertialVelocity
         * simulationParameters.MoveToolInertia
         * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    // Move all points (ephemeral and non-ephemeral) that belong to the same connected component
-    for (auto const p : mPoints)
-    {
-        if (mPoints.GetConnectedComponentId(p) == connectedComponentId)
-        {
-            mPoints.SetPosition(p, mPoints.GetPosition(p) + moveOffset);
+    ConnectedComponentId const * const restrict connectedComponentIdBuffer = mPoints.GetConnectedComponentIdBuffer();
+    float const * const restrict pinningCoefficientBuffer = mPoints.GetIsPinnedBufferAsFloat();
+    vec2f * const restrict positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * const restrict velocityBuffer = mPoints.GetVelocityBufferAsVec2();
+    vec2f * const restrict waterVelocityBuffer = mPoints.GetWaterVelocityBufferAsVec2();
+    vec2f * const restrict staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
+    vec2f * const restrict dynamicForceBuffer = mPoints.GetDynamicForceBufferAsVec2();
 
-            if (!mPoints.IsPinned(p))
+    // Move all points (ephemeral and non-ephemeral) that belong to the same connected component;
+    // branch-free, so that it vectorizes: points out of the component get their own values back
+    RunPointTransformation(
+        mPoints.GetElementCount(),
+        threadManager,
+        [&](ElementIndex startPointIndex, ElementIndex endPointIndex)
+        {
+            for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
             {
-                mPoints.SetVelocity(p, actualInertialVelocity);
-                mPoints.SetWaterVelocity(p, -actualInertialVelocity);
-            }
+                bool const isMoved = (connectedComponentIdBuffer[p] == connectedComponentId);
+                bool const isVelocityChanged = isMoved && (pinningCoefficientBuffer[p] != 0.0f);
 
-            // Zero-out already-existing forces
-            mPoints.SetStaticForce(p, vec2f::zero());
-            mPoints.SetDynamicForce(p, vec2f::zero());
-        }
-    }
+                positionBuffer[p] = isMoved ? positionBuffer[p] + moveOffset : positionBuffer[p];
+
+                velocityBuffer[p] = isVelocityChanged ? actualInertialVelocity : velocityBuffer[p];
+                waterVelocityBuffer[p] = isVelocityChanged ? -actualInertialVelocity : waterVelocityBuffer[p];
+
+                // Zero-out already-existing forces
+                staticForceBuffer[p] = isMoved ? vec2f::zero() : staticForceBuffer[p];
+                dynamicForceBuffer[p] = isMoved ? vec2f::zero() : dynamicForceBuffer[p];
+            }
+        });
 
     TrimForWorldBounds(simulationParameters);
 }
@@ -118,8 +133,11 @@ void Ship::MoveBy(
 void Ship::MoveBy(
     vec2f const & moveOffset,
     vec2f const & inertialVelocity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
+    WakeUp();
+
     vec2f const actualInertialVelocity =
         inertialVelocity
         * simulationParameters.MoveToolInertia
@@ -131,16 +149,22 @@ void Ship::MoveBy(
     vec2f * const restrict staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
     vec2f * const restrict dynamicForceBuffer = mPoints.GetDynamicForceBufferAsVec2();
 
-    for (auto const p : mPoints.BufferElements())
-    {
-        positionBuffer[p] += moveOffset;
-        velocityBuffer[p] = actualInertialVelocity;
-        waterVelocityBuffer[p] = -actualInertialVelocity;
+    RunPointTransformation(
+        mPoints.GetBufferElementCount(),
+        threadManager,
+        [&](ElementIndex startPointIndex, ElementIndex endPointIndex)
+        {
+            for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+            {
+                positionBuffer[p] += moveOffset;
+                velocityBuffer[p] = actualInertialVelocity;
+                waterVelocityBuffer[p] = -actualInertialVelocity;
 
-        // Zero-out already-existing forces
-        staticForceBuffer[p] = vec2f::zero();
-        dynamicForceBuffer[p] = vec2f::zero();
-    }
+                // Zero-out already-existing forces
+                staticForceBuffer[p] = vec2f::zero();
+                dynamicForceBuffer[p] = vec2f::zero();
+            }
+        });
 
     TrimForWorldBounds(simulationParameters);
 }
@@ -150,8 +174,11 @@ void Ship::RotateBy(
     float angle,
     vec2f const & center,
     float inertialAngle,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
+    WakeUp();
+
     vec2f const rotX(cos(angle), sin(angle));
     vec2f const rotY(-sin(angle), cos(angle));
 
@@ -162,27 +189,39 @@ void Ship::RotateBy(
     vec2f const inertialRotX(cos(inertialAngle), sin(inertialAngle));
     vec2f const inertialRotY(-sin(inertialAngle), cos(inertialAngle));
 
-    // Rotate all points (ephemeral and non-ephemeral) that belong to the same connected component
-    for (auto const p : mPoints)
-    {
-        if (mPoints.GetConnectedComponentId(p) == connectedComponentId)
-        {
-            vec2f const centeredPos = mPoints.GetPosition(p) - center;
-            vec2f const newPosition = vec2f(centeredPos.dot(rotX), centeredPos.dot(rotY)) + center;
-            mPoints.SetPosition(p, newPosition);
+    ConnectedComponentId const * const restrict connectedComponentIdBuffer = mPoints.GetConnectedComponentIdBuffer();
+    float const * const restrict pinningCoefficientBuffer = mPoints.GetIsPinnedBufferAsFloat();
+    vec2f * const restrict positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * const restrict velocityBuffer = mPoints.GetVelocityBufferAsVec2();
+    vec2f * const restrict waterVelocityBuffer = mPoints.GetWaterVelocityBufferAsVec2();
+    vec2f * const restrict staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
+    vec2f * const restrict dynamicForceBuffer = mPoints.GetDynamicForceBufferAsVec2();
 
-            if (!mPoints.IsPinned(p))
+    // Rotate all points (ephemeral and non-ephemeral) that belong to the same connected component;
+    // branch-free, so that it vectorizes: points out of the component get their own values back
+    RunPointTransformation(
+        mPoints.GetElementCount(),
+        threadManager,
+        [&](ElementIndex startPointIndex, ElementIndex endPointIndex)
+        {
+            for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
             {
+                bool const isMoved = (connectedComponentIdBuffer[p] == connectedComponentId);
+                bool const isVelocityChanged = isMoved && (pinningCoefficientBuffer[p] != 0.0f);
+
+                vec2f const centeredPos = positionBuffer[p] - center;
+                vec2f const newPosition = vec2f(centeredPos.dot(rotX), centeredPos.dot(rotY)) + center;
+                positionBuffer[p] = isMoved ? newPosition : positionBuffer[p];
+
                 vec2f const linearInertialVelocity = (vec2f(centeredPos.dot(inertialRotX), centeredPos.dot(inertialRotY)) - centeredPos) * inertiaMagnitude;
-                mPoints.SetVelocity(p, linearInertialVelocity);
-                mPoints.SetWaterVelocity(p, -linearInertialVelocity);
-            }
+                velocityBuffer[p] = isVelocityChanged ? linearInertialVelocity : velocityBuffer[p];
+                waterVelocityBuffer[p] = isVelocityChanged ? -linearInertialVelocity : waterVelocityBuffer[p];
 
-            // Zero-out already-existing forces
-            mPoints.SetStaticForce(p, vec2f::zero());
-            mPoints.SetDynamicForce(p, vec2f::zero());
-        }
-    }
+                // Zero-out already-existing forces
+                staticForceBuffer[p] = isMoved ? vec2f::zero() : staticForceBuffer[p];
+                dynamicForceBuffer[p] = isMoved ? vec2f::zero() : dynamicForceBuffer[p];
+            }
+        });
 
     TrimForWorldBounds(simulationParameters);
 }
@@ -191,8 +230,11 @@ void Ship::RotateBy(
     float angle,
     vec2f const & center,
     float inertialAngle,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
+    WakeUp();
+
     vec2f const rotX(cos(angle), sin(angle));
     vec2f const rotY(-sin(angle), cos(angle));
 
@@ -209,28 +251,75 @@ void Ship::RotateBy(
     vec2f * const restrict staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
     vec2f * const restrict dynamicForceBuffer = mPoints.GetDynamicForceBufferAsVec2();
 
-    for (auto const p : mPoints.BufferElements())
-    {
-        vec2f const centeredPos = positionBuffer[p] - center;
-        vec2f const newPosition = vec2f(centeredPos.dot(rotX), centeredPos.dot(rotY)) + center;
-        positionBuffer[p] = newPosition;
+    RunPointTransformation(
+        mPoints.GetBufferElementCount(),
+        threadManager,
+        [&](ElementIndex startPointIndex, ElementIndex endPointIndex)
+        {
+            for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+            {
+                vec2f const centeredPos = positionBuffer[p] - center;
+                vec2f const newPosition = vec2f(centeredPos.dot(rotX), centeredPos.dot(rotY)) + center;
+                positionBuffer[p] = newPosition;
 
-        vec2f const linearInertialVelocity = (vec2f(centeredPos.dot(inertialRotX), centeredPos.dot(inertialRotY)) - centeredPos) * inertiaMagnitude;
-        velocityBuffer[p] = linearInertialVelocity;
-        waterVelocityBuffer[p] = -linearInertialVelocity;
+                vec2f const linearInertialVelocity = (vec2f(centeredPos.dot(inertialRotX), centeredPos.dot(inertialRotY)) - centeredPos) * inertiaMagnitude;
+                velocityBuffer[p] = linearInertialVelocity;
+                waterVelocityBuffer[p] = -linearInertialVelocity;
 
-        // Zero-out already-existing forces
-        staticForceBuffer[p] = vec2f::zero();
-        dynamicForceBuffer[p] = vec2f::zero();
-    }
+                // Zero-out already-existing forces
+                staticForceBuffer[p] = vec2f::zero();
+                dynamicForceBuffer[p] = vec2f::zero();
+            }
+        });
 
     TrimForWorldBounds(simulationParameters);
 }
 
+void Ship::RunPointTransformation(
+    ElementCount pointCount,
+    ThreadManager & threadManager,
+    std::function<void(ElementIndex, ElementIndex)> const & transformation)
+{
+    // Fewer points than these per task are not worth a task
+    ElementCount constexpr MinPointsPerTask = 16384;
+
+    ElementCount const partitionCount = std::min(
+        static_cast<ElementCount>(threadManager.GetSimulationParallelism()),
+        std::max(pointCount / MinPointsPerTask, ElementCount(1)));
+
+    if (partitionCount == 1)
+    {
+        transformation(0, pointCount);
+    }
+    else
+    {
+        // Partitions are disjoint ranges of points, each a multiple of the vectorization word
+        ElementCount const partitionSize = make_aligned_float_element_count((pointCount + partitionCount - 1) / partitionCount);
+
+        std::vector<typename ThreadPool::Task> tasks;
+        tasks.reserve(partitionCount);
+
+        for (ElementCount startPointIndex = 0; startPointIndex < pointCount; startPointIndex += partitionSize)
+        {
+            ElementCount const endPointIndex = std::min(startPointIndex + partitionSize, pointCount);
+
+            tasks.emplace_back(
+                [&transformation, startPointIndex, endPointIndex]()
+                {
+                    transformation(startPointIndex, endPointIndex);
+                });
+        }
+
+        threadManager.GetSimulationThreadPool().Run(tasks);
+    }
+}
+
 void Ship::MoveGrippedBy(
     std::vector<GrippedMoveParameters> const & moves,
     SimulationParameters const & simulationParameters)
 {
+    WakeUp();
+
     std::vector<float> squareAugmentedGripRadii;
     std::transform(
         moves.cbegin(),
@@ -312,6 +401,8 @@ void Ship::RotateGrippedBy(
     float inertialAngle,
     SimulationParameters const & simulationParameters)
 {
+    WakeUp();
+
     float const squareAugmentedGripRadius =
         (gripRadius * (1.0f + SimulationParameters::GripToolRadiusTransitionWidthFraction / 2.0f))
         * (gripRadius * (1.0f + SimulationParameters::GripToolRadiusTransitionWidthFraction / 2.0f));
@@ -455,6 +546,8 @@ void Ship::Pull(
 
 void Ship::Pull(Interaction::ArgumentsUnion::PullArguments const & args)
 {
+    WakeUp();
+
     //
     //
     // Exhert a pull on the specified particle, according to a Hookean force
@@ -528,10 +621,11 @@ bool Ship::DestroyAt(
             // Record event, if requested to
             if (mEventRecorder != nullptr)
             {
-                mEventRecorder->RecordEvent<RecordedPointDetachForDestroyEvent>(
-                    pointIndex,
-                    detachVelocity,
-                    currentSimulationTime);
+                mEventRecorder->RecordEvent(
+                    RecordedEvent::MakePointDetachForDestroy(
+                        pointIndex,
+                        detachVelocity,
+                        currentSimulationTime));
             }
         };
 
@@ -550,56 +644,81 @@ bool Ship::DestroyAt(
     float const largerSearchSquareRadius = std::max(squareRadius, FallbackSquareRadius);
 
     // Detach/destroy all active, attached points within the radius
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-
-        if (mPoints.IsActive(pointIndex)
-            && pointSquareDistance < largerSearchSquareRadius)
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            //
-            // - Air bubble ephemeral points: destroy
-            // - Non-ephemeral, attached points: detach probabilistically
-            //
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
 
-            if (Points::EphemeralType::None == mPoints.GetEphemeralType(pointIndex)
-                && mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() > 0)
+            if (mPoints.IsActive(pointIndex)
+                && pointSquareDistance < largerSearchSquareRadius)
             {
-                if (pointSquareDistance < squareRadius)
+                //
+                // - Air bubble ephemeral points: destroy
+                // - Non-ephemeral, attached points: detach probabilistically
+                //
+
+                if (Points::EphemeralType::None == mPoints.GetEphemeralType(pointIndex)
+                    && mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() > 0)
                 {
-                    //
-                    // Calculate probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
-                    // however, we always destroy if we're in a very small fraction of the radius
-                    //
+                    if (pointSquareDistance < squareRadius)
+                    {
+                        //
+                        // Calculate probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
+                        // however, we always destroy if we're in a very small fraction of the radius
+                        //
 
-                    float destroyProbability =
-                        (pointSquareDistance < 1.0f)
-                        ? 1.0f
-                        : (1.0f - (pointSquareDistance / squareRadius)) * (1.0f - (pointSquareDistance / squareRadius));
+                        float destroyProbability =
+                            (pointSquareDistance < 1.0f)
+                            ? 1.0f
+                            : (1.0f - (pointSquareDistance / squareRadius)) * (1.0f - (pointSquareDistance / squareRadius));
 
-                    if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
-                    {
-                        doDestroyPoint(pointIndex);
+                        if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+                        {
+                            doDestroyPoint(pointIndex);
 
-                        hasDestroyed = true;
+                            hasDestroyed = true;
+                        }
                     }
-                }
 
-                if (pointSquareDistance < nearestFallbackPointRadius)
+                    if (pointSquareDistance < nearestFallbackPointRadius)
+                    {
+                        nearestFallbackPointInRadiusIndex = pointIndex;
+                        nearestFallbackPointRadius = pointSquareDistance;
+                    }
+                }
+                else if (Points::EphemeralType::AirBubble == mPoints.GetEphemeralType(pointIndex)
+                    && pointSquareDistance < squareRadius)
                 {
-                    nearestFallbackPointInRadiusIndex = pointIndex;
-                    nearestFallbackPointRadius = pointSquareDistance;
+                    // Destroy
+                    mPoints.DestroyEphemeralParticle(pointIndex);
+
+                    hasDestroyed = true;
                 }
             }
-            else if (Points::EphemeralType::AirBubble == mPoints.GetEphemeralType(pointIndex)
-                && pointSquareDistance < squareRadius)
-            {
-                // Destroy
-                mPoints.DestroyEphemeralParticle(pointIndex);
+        };
 
-                hasDestroyed = true;
-            }
-        }
+    // Ship points: we visit them in index order, as we consume random numbers
+    // for each of them
+    std::vector<ElementIndex> candidatePoints;
+    GetPointSpatialGrid().VisitInRadius(
+        targetPos,
+        std::sqrt(largerSearchSquareRadius),
+        [&](ElementIndex pointIndex)
+        {
+            candidatePoints.push_back(pointIndex);
+        });
+
+    std::sort(candidatePoints.begin(), candidatePoints.end());
+
+    for (auto const pointIndex : candidatePoints)
+    {
+        visitPoint(pointIndex);
+    }
+
+    // Ephemeral points
+    for (auto const pointIndex : mPoints.EphemeralPoints())
+    {
+        visitPoint(pointIndex);
     }
 
     // Make sure we always destroy something, if we had a particle in-radius
@@ -631,7 +750,9 @@ bool Ship::SawThrough(
     unsigned int metalsSawed = 0;
     unsigned int nonMetalsSawed = 0;
 
-    for (auto springIndex : mSprings)
+    GatherSpringsAlongSegment(adjustedStartPos, endPos);
+
+    for (auto springIndex : mToolSpringIndices)
     {
         if (!mSprings.IsDeleted(springIndex))
         {
@@ -699,36 +820,44 @@ bool Ship::ApplyHeatBlasterAt(
     //
     // We also do ephemeral points in order to change buoyancy of air bubbles
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius
-            && mPoints.IsActive(pointIndex))
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            //
-            // Inject/remove heat at this point
-            //
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+            if (pointSquareDistance < squareRadius
+                && mPoints.IsActive(pointIndex))
+            {
+                //
+                // Inject/remove heat at this point
+                //
 
-            // Smooth heat out for radius
-            float const smoothing = 1.0f - SmoothStep(
-                0.0f,
-                radius,
-                sqrt(pointSquareDistance));
+                // Smooth heat out for radius
+                float const smoothing = 1.0f - SmoothStep(
+                    0.0f,
+                    radius,
+                    sqrt(pointSquareDistance));
 
-            // Calc temperature delta
-            // T = Q/HeatCapacity
-            float deltaT =
-                heatBlasterHeat * smoothing
-                * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+                // Calc temperature delta
+                // T = Q/HeatCapacity
+                float deltaT =
+                    heatBlasterHeat * smoothing
+                    * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
 
-            // Increase/lower temperature
-            mPoints.SetTemperature(
-                pointIndex,
-                std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
+                // Increase/lower temperature
+                mPoints.SetTemperature(
+                    pointIndex,
+                    std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
 
-            // Remember we've found a point
-            atLeastOnePointFound = true;
-        }
+                // Remember we've found a point
+                atLeastOnePointFound = true;
+            }
+        };
+
+    GetPointSpatialGrid().VisitInRadius(targetPos, radius, visitPoint);
+
+    for (auto const pointIndex : mPoints.EphemeralPoints())
+    {
+        visitPoint(pointIndex);
     }
 
     return atLeastOnePointFound;
@@ -752,39 +881,42 @@ bool Ship::ExtinguishFireAt(
     // No real reason to ignore ephemeral points, other than they're currently
     // not expected to burn
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius)
+    GetPointSpatialGrid().VisitInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex)
         {
-            // Check if the point is in a state in which we can smother its combustion
-            if (mPoints.IsBurningForSmothering(pointIndex))
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+            if (pointSquareDistance < squareRadius)
             {
-                //
-                // Extinguish point - fake it's with water
-                //
+                // Check if the point is in a state in which we can smother its combustion
+                if (mPoints.IsBurningForSmothering(pointIndex))
+                {
+                    //
+                    // Extinguish point - fake it's with water
+                    //
 
-                mPoints.SmotherCombustion(pointIndex, true);
-            }
+                    mPoints.SmotherCombustion(pointIndex, true);
+                }
 
-            // Check if the point is in a state in which we can lower its temperature, so that
-            // it won't start burning again right away
-            if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
-            {
-                float const strength = 1.0f - SmoothStep(
-                    squareRadius * 3.0f / 4.0f,
-                    squareRadius,
-                    pointSquareDistance);
+                // Check if the point is in a state in which we can lower its temperature, so that
+                // it won't start burning again right away
+                if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
+                {
+                    float const strength = 1.0f - SmoothStep(
+                        squareRadius * 3.0f / 4.0f,
+                        squareRadius,
+                        pointSquareDistance);
+
+                    mPoints.AddHeat(
+                        pointIndex,
+                        -heatRemoved * strength);
+                }
 
-                mPoints.AddHeat(
-                    pointIndex,
-                    -heatRemoved * strength);
+                // Remember we've found a point
+                atLeastOnePointFound = true;
             }
-
-            // Remember we've found a point
-            atLeastOnePointFound = true;
-        }
-    }
+        });
 
     return atLeastOnePointFound;
 }
@@ -809,25 +941,33 @@ void Ship::ApplyBlastAt(
 {
     float const squareRadius = args.Radius * args.Radius;
 
-    // Visit all points
-    for (auto pointIndex : mPoints)
-    {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - args.CenterPos;
-        float const squarePointDistance = pointRadius.squareLength();
-        if (squarePointDistance < squareRadius)
+    // Visit all points in radius
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            float const pointRadiusLength = std::sqrt(squarePointDistance);
+            vec2f const pointRadius = mPoints.GetPosition(pointIndex) - args.CenterPos;
+            float const squarePointDistance = pointRadius.squareLength();
+            if (squarePointDistance < squareRadius)
+            {
+                float const pointRadiusLength = std::sqrt(squarePointDistance);
 
-            //
-            // Apply blast force
-            //
-            // (inversely proportional to square root of distance, not second power as one would expect though)
-            //
+                //
+                // Apply blast force
+                //
+                // (inversely proportional to square root of distance, not second power as one would expect though)
+                //
 
-            mPoints.AddStaticForce(
-                pointIndex,
-                pointRadius.normalise(pointRadiusLength) * args.ForceMagnitude / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f)));
-        }
+                mPoints.AddStaticForce(
+                    pointIndex,
+                    pointRadius.normalise(pointRadiusLength) * args.ForceMagnitude / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f)));
+            }
+        };
+
+    GetPointSpatialGrid().VisitInRadius(args.CenterPos, args.Radius, visitPoint);
+
+    for (auto const pointIndex : mPoints.EphemeralPoints())
+    {
+        visitPoint(pointIndex);
     }
 }
 
@@ -861,7 +1001,9 @@ bool Ship::ApplyLaserCannonThrough(
 
     int cutCount = 0;
 
-    for (auto springIndex : mSprings)
+    GatherSpringsAlongSegment(startPos, endPos);
+
+    for (auto springIndex : mToolSpringIndices)
     {
         if (!mSprings.IsDeleted(springIndex)
             && GameRandomEngine::GetInstance().GenerateUniformBoolean(10.0f * strength / mSprings.GetBaseStructuralMaterial(springIndex).GetMass()))
@@ -900,17 +1042,25 @@ bool Ship::ApplyLaserCannonThrough(
         * SimulationParameters::SimulationStepTimeDuration<float>
         * (1.0f + (strength - 1.0f) * 4.0f);
 
-    for (auto p : mPoints)
-    {
-        float const distance = Geometry::Segment::DistanceToPoint(startPos, endPos, mPoints.GetPosition(p));
-        if (distance < SimulationParameters::LaserRayRadius)
+    auto const visitPoint =
+        [&](ElementIndex p)
         {
-            //
-            // Inject/remove heat at this point
-            //
+            float const distance = Geometry::Segment::DistanceToPoint(startPos, endPos, mPoints.GetPosition(p));
+            if (distance < SimulationParameters::LaserRayRadius)
+            {
+                //
+                // Inject/remove heat at this point
+                //
 
-            mPoints.AddHeat(p, effectiveLaserHeat);
-        }
+                mPoints.AddHeat(p, effectiveLaserHeat);
+            }
+        };
+
+    GetPointSpatialGrid().VisitAlongSegment(startPos, endPos, SimulationParameters::LaserRayRadius, visitPoint);
+
+    for (auto const p : mPoints.EphemeralPoints())
+    {
+        visitPoint(p);
     }
 
     mSimulationEventHandler.OnLaserCut(cutCount);
@@ -929,28 +1079,6 @@ void Ship::DrawTo(
             strength));
 }
 
-void Ship::DrawTo(Interaction::ArgumentsUnion::DrawArguments const & args)
-{
-    //
-    // F = ForceStrength/sqrt(distance), along radius
-    //
-
-    for (auto pointIndex : mPoints)
-    {
-        vec2f displacement = (args.CenterPos - mPoints.GetPosition(pointIndex));
-        float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
-
-        // Scale back force if mass is small
-        // 0  -> 0
-        // 50 -> 1
-        // +INF -> 1
-        forceMagnitude *= std::min(mPoints.GetMass(pointIndex) / 50.0f, 1.0f);
-
-        mPoints.AddStaticForce(
-            pointIndex,
-            displacement.normalise() * forceMagnitude);
-    }
-}
 
 void Ship::SwirlAt(
     vec2f const & targetPos,
@@ -963,20 +1091,66 @@ void Ship::SwirlAt(
             strength));
 }
 
-void Ship::SwirlAt(Interaction::ArgumentsUnion::SwirlArguments const & args)
+void Ship::ApplyQueuedFieldInteractionForces()
 {
-    //
-    // F = ForceStrength*radius/sqrt(distance), perpendicular to radius
-    //
-
     for (auto pointIndex : mPoints)
     {
-        vec2f displacement = (args.CenterPos - mPoints.GetPosition(pointIndex));
-        float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
+        vec2f const pointPosition = mPoints.GetPosition(pointIndex);
+
+        vec2f force = vec2f::zero();
+
+        for (auto const & interaction : mQueuedInteractions)
+        {
+            switch (interaction.Type)
+            {
+                case Interaction::InteractionType::Draw:
+                {
+                    //
+                    // F = ForceStrength/sqrt(distance), along radius
+                    //
 
-        mPoints.AddStaticForce(
-            pointIndex,
-            vec2f(-displacement.y, displacement.x) * forceMagnitude);
+                    auto const & args = interaction.Arguments.Draw;
+
+                    vec2f displacement = (args.CenterPos - pointPosition);
+                    float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
+
+                    // Scale back force if mass is small
+                    // 0  -> 0
+                    // 50 -> 1
+                    // +INF -> 1
+                    forceMagnitude *= std::min(mPoints.GetMass(pointIndex) / 50.0f, 1.0f);
+
+                    force += displacement.normalise() * forceMagnitude;
+
+                    break;
+                }
+
+                case Interaction::InteractionType::Swirl:
+                {
+                    //
+                    // F = ForceStrength*radius/sqrt(distance), perpendicular to radius
+                    //
+
+                    auto const & args = interaction.Arguments.Swirl;
+
+                    vec2f displacement = (args.CenterPos - pointPosition);
+                    float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
+
+                    force += vec2f(-displacement.y, displacement.x) * forceMagnitude;
+
+                    break;
+                }
+
+                case Interaction::InteractionType::Blast:
+                case Interaction::InteractionType::Pull:
+                {
+                    // Not a field interaction
+                    break;
+                }
+            }
+        }
+
+        mPoints.AddStaticForce(pointIndex, force);
     }
 }
 
@@ -1305,37 +1479,42 @@ bool Ship::ScrubThrough(
         std::max(startPos.y, endPos.y) + scrubRadius,   // Top
         std::min(startPos.y, endPos.y) - scrubRadius);  // Bottom
 
-    // Visit all points (excluding ephemerals, they don't rot and
-    // thus we don't need to scrub them!)
+    // Visit all points along the segment (excluding ephemerals, they don't rot and
+    // thus we don't need to scrub them!); the bounding box reaches beyond the segment's
+    // ends, by up to sqrt(3) times the radius along the strip around the segment
     bool hasScrubbed = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        auto const & pointPosition = mPoints.GetPosition(pointIndex);
-
-        // First check whether the point is in the bounding box
-        if (boundingBox.Contains(pointPosition))
+    GetPointSpatialGrid().VisitAlongSegment(
+        startPos,
+        endPos,
+        scrubRadius * 1.7321f,
+        [&](ElementIndex pointIndex)
         {
-            // Distance = projection of (start->point) vector on segment normal
-            float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+            auto const & pointPosition = mPoints.GetPosition(pointIndex);
 
-            // Check whether this point is in the radius
-            if (distance <= scrubRadius)
+            // First check whether the point is in the bounding box
+            if (boundingBox.Contains(pointPosition))
             {
-                //
-                // Scrub this point, with magnitude dependent from distance
-                //
+                // Distance = projection of (start->point) vector on segment normal
+                float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+
+                // Check whether this point is in the radius
+                if (distance <= scrubRadius)
+                {
+                    //
+                    // Scrub this point, with magnitude dependent from distance
+                    //
 
-                float const newDecay =
-                    mPoints.GetDecay(pointIndex)
-                    + 0.5f * (1.0f - mPoints.GetDecay(pointIndex)) * (scrubRadius - distance) / scrubRadius;
+                    float const newDecay =
+                        mPoints.GetDecay(pointIndex)
+                        + 0.5f * (1.0f - mPoints.GetDecay(pointIndex)) * (scrubRadius - distance) / scrubRadius;
 
-                mPoints.SetDecay(pointIndex, newDecay);
+                    mPoints.SetDecay(pointIndex, newDecay);
 
-                // Remember at least one point has been scrubbed
-                hasScrubbed |= true;
+                    // Remember at least one point has been scrubbed
+                    hasScrubbed |= true;
+                }
             }
-        }
-    }
+        });
 
     if (hasScrubbed)
     {
@@ -1372,42 +1551,47 @@ bool Ship::RotThrough(
         std::max(startPos.y, endPos.y) + rotRadius,   // Top
         std::min(startPos.y, endPos.y) - rotRadius);  // Bottom
 
-    // Visit all points (excluding ephemerals, they don't rot and
-    // thus we don't need to rot them!)
+    // Visit all points along the segment (excluding ephemerals, they don't rot and
+    // thus we don't need to rot them!); the bounding box reaches beyond the segment's
+    // ends, by up to sqrt(3) times the radius along the strip around the segment
     bool hasRotted = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        auto const & pointPosition = mPoints.GetPosition(pointIndex);
-
-        // First check whether the point is in the bounding box
-        if (boundingBox.Contains(pointPosition))
+    GetPointSpatialGrid().VisitAlongSegment(
+        startPos,
+        endPos,
+        rotRadius * 1.7321f,
+        [&](ElementIndex pointIndex)
         {
-            // Distance = projection of (start->point) vector on segment normal
-            float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+            auto const & pointPosition = mPoints.GetPosition(pointIndex);
 
-            // Check whether this point is in the radius
-            if (distance <= rotRadius)
+            // First check whether the point is in the bounding box
+            if (boundingBox.Contains(pointPosition))
             {
-                //
-                // Rot this point, with magnitude dependent from distance,
-                // and more pronounced when the point is underwater or has water
-                //
+                // Distance = projection of (start->point) vector on segment normal
+                float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+
+                // Check whether this point is in the radius
+                if (distance <= rotRadius)
+                {
+                    //
+                    // Rot this point, with magnitude dependent from distance,
+                    // and more pronounced when the point is underwater or has water
+                    //
 
-                float const decayCoeff = (mParentWorld.GetOceanSurface().IsUnderwater(pointPosition) || mPoints.GetWater(pointIndex) >= 1.0f)
-                    ? 0.0175f
-                    : 0.010f;
+                    float const decayCoeff = (mParentWorld.GetOceanSurface().IsUnderwater(pointPosition) || mPoints.GetWater(pointIndex) >= 1.0f)
+                        ? 0.0175f
+                        : 0.010f;
 
-                float const newDecay =
-                    mPoints.GetDecay(pointIndex)
-                    * (1.0f - decayCoeff * decayCoeffMultiplier * (rotRadius - distance) / rotRadius);
+                    float const newDecay =
+                        mPoints.GetDecay(pointIndex)
+                        * (1.0f - decayCoeff * decayCoeffMultiplier * (rotRadius - distance) / rotRadius);
 
-                mPoints.SetDecay(pointIndex, newDecay);
+                    mPoints.SetDecay(pointIndex, newDecay);
 
-                // Remember at least one point has been rotted
-                hasRotted |= true;
+                    // Remember at least one point has been rotted
+                    hasRotted |= true;
+                }
             }
-        }
-    }
+        });
 
     if (hasRotted)
     {
@@ -1449,6 +1633,13 @@ void Ship::ApplyThanosSnap(
         direction = 1.0f;
     }
 
+    // Nothing to do if the band doesn't reach the ship at all
+    Geometry::AABB const shipAABB = mPoints.CalculateAABB();
+    if (shipAABB.TopRight.x < leftX || shipAABB.BottomLeft.x > rightX)
+    {
+        return;
+    }
+
     // Calculate detach probability
     float const detachProbability = isSparseMode
         ? 0.01f
@@ -1507,17 +1698,27 @@ ElementIndex Ship::GetNearestPointAt(
     ElementIndex bestPointIndex = NoneElementIndex;
     float bestSquareDistance = std::numeric_limits<float>::max();
 
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
+    // Note: on ties we pick the lowest index, irrespective of visit order
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+            if (mPoints.IsActive(pointIndex))
             {
-                bestPointIndex = pointIndex;
-                bestSquareDistance = squareDistance;
+                float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                if (squareDistance < squareRadius
+                    && (squareDistance < bestSquareDistance || (squareDistance == bestSquareDistance && pointIndex < bestPointIndex)))
+                {
+                    bestPointIndex = pointIndex;
+                    bestSquareDistance = squareDistance;
+                }
             }
-        }
+        };
+
+    GetPointSpatialGrid().VisitInRadius(targetPos, radius, visitPoint);
+
+    for (auto const pointIndex : mPoints.EphemeralPoints())
+    {
+        visitPoint(pointIndex);
     }
 
     return bestPointIndex;
@@ -1533,23 +1734,7 @@ bool Ship::QueryNearestPointAt(
 
     bool pointWasFound = false;
 
-    float const squareRadius = radius * radius;
-
-    ElementIndex bestPointIndex = NoneElementIndex;
-    float bestSquareDistance = std::numeric_limits<float>::max();
-
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
-        {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
-            {
-                bestPointIndex = pointIndex;
-                bestSquareDistance = squareDistance;
-            }
-        }
-    }
+    ElementIndex const bestPointIndex = GetNearestPointAt(targetPos, radius);
 
     if (NoneElementIndex != bestPointIndex)
     {
@@ -1612,9 +1797,10 @@ std::optional<vec2f> Ship::FindSuitableLightningTarget() const
     // Sorted by y, largest first
     std::vector<vec2f> candidatePositions;
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
+    // Only the topmost points may be the top N
+    for (auto const pointIndex : GetLightningTargetCandidatePoints())
     {
-        // Non-deleted, non-orphaned point
+        // Non-deleted, non-orphaned point - as the candidates might be stale
         if (mPoints.IsActive(pointIndex)
             && !mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
         {
@@ -1679,81 +1865,84 @@ void Ship::ApplyLightning(
     float const searchSquareRadiusBlast = searchSquareRadius / 2.0f;
     float const searchSquareRadiusHeat = searchSquareRadius;
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-
-        bool wasDestroyed = false;
-
-        if (squareDistance < searchSquareRadiusBlast)
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            //
-            // Calculate destroy probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
-            // however, we always destroy if we're in a very small fraction of the radius
-            //
+            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
 
-            float destroyProbability =
-                (searchSquareRadiusBlast < 1.0f)
-                ? 1.0f
-                : (1.0f - (squareDistance / searchSquareRadiusBlast)) * (1.0f - (squareDistance / searchSquareRadiusBlast));
+            bool wasDestroyed = false;
 
-            if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+            if (squareDistance < searchSquareRadiusBlast)
             {
                 //
-                // Destroy
+                // Calculate destroy probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
+                // however, we always destroy if we're in a very small fraction of the radius
                 //
 
-                // Choose a detach velocity - using the same distribution as Debris
-                vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
-                    SimulationParameters::MinDebrisParticlesVelocity,
-                    SimulationParameters::MaxDebrisParticlesVelocity);
+                float destroyProbability =
+                    (searchSquareRadiusBlast < 1.0f)
+                    ? 1.0f
+                    : (1.0f - (squareDistance / searchSquareRadiusBlast)) * (1.0f - (squareDistance / searchSquareRadiusBlast));
 
-                // Detach
-                mPoints.Detach(
-                    pointIndex,
-                    detachVelocity,
-                    Points::DetachOptions::GenerateDebris,
-                    currentSimulationTime,
-                    simulationParameters);
+                if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+                {
+                    //
+                    // Destroy
+                    //
 
-                // Generate sparkles
-                InternalSpawnSparklesForLightning(
-                    pointIndex,
-                    currentSimulationTime,
-                    simulationParameters);
+                    // Choose a detach velocity - using the same distribution as Debris
+                    vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
+                        SimulationParameters::MinDebrisParticlesVelocity,
+                        SimulationParameters::MaxDebrisParticlesVelocity);
+
+                    // Detach
+                    mPoints.Detach(
+                        pointIndex,
+                        detachVelocity,
+                        Points::DetachOptions::GenerateDebris,
+                        currentSimulationTime,
+                        simulationParameters);
+
+                    // Generate sparkles
+                    InternalSpawnSparklesForLightning(
+                        pointIndex,
+                        currentSimulationTime,
+                        simulationParameters);
 
-                // Notify
-                mSimulationEventHandler.OnLightningHit(mPoints.GetStructuralMaterial(pointIndex));
+                    // Notify
+                    mSimulationEventHandler.OnLightningHit(mPoints.GetStructuralMaterial(pointIndex));
 
-                wasDestroyed = true;
+                    wasDestroyed = true;
+                }
             }
-        }
 
-        if (!wasDestroyed
-            && squareDistance < searchSquareRadiusHeat)
-        {
-            //
-            // Apply heat
-            //
+            if (!wasDestroyed
+                && squareDistance < searchSquareRadiusHeat)
+            {
+                //
+                // Apply heat
+                //
 
-            // Smooth heat out for radius
-            float const smoothing = 1.0f - SmoothStep(
-                searchSquareRadiusHeat * 3.0f / 4.0f,
-                searchSquareRadiusHeat,
-                squareDistance);
+                // Smooth heat out for radius
+                float const smoothing = 1.0f - SmoothStep(
+                    searchSquareRadiusHeat * 3.0f / 4.0f,
+                    searchSquareRadiusHeat,
+                    squareDistance);
 
-            // Calc temperature delta
-            // T = Q/HeatCapacity
-            float deltaT =
-                lightningHeat * smoothing
-                * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+                // Calc temperature delta
+                // T = Q/HeatCapacity
+                float deltaT =
+                    lightningHeat * smoothing
+                    * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
 
-            // Increase/lower temperature
-            mPoints.SetTemperature(
-                pointIndex,
-                std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
-        }
-    }
+                // Increase/lower temperature
+                mPoints.SetTemperature(
+                    pointIndex,
+                    std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
+            }
+        };
+
+    GetPointSpatialGrid().VisitInRadius(targetPos, searchRadius, visitPoint);
 }
 
 void Ship::HighlightElectricalElement(GlobalElectricalElementId electricalElementId)
@@ -1838,4 +2027,36 @@ bool Ship::RestoreTriangle(ElementIndex triangleIndex)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////////
+
+void Ship::GatherSpringsAlongSegment(
+    vec2f const & startPos,
+    vec2f const & endPos)
+{
+    // A spring crossing the segment has its closer endpoint within half of its
+    // length from the segment; springs break well before they are this long
+    float constexpr SpringEndpointSearchRadius = 2.0f;
+
+    mToolSpringIndices.clear();
+
+    GetPointSpatialGrid().VisitAlongSegment(
+        startPos,
+        endPos,
+        SpringEndpointSearchRadius,
+        [&](ElementIndex pointIndex)
+        {
+            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+            {
+                mToolSpringIndices.push_back(cs.SpringIndex);
+            }
+        });
+
+    // Springs are found from both of their endpoints; also, visiting
+    // springs in index order keeps the same order as a full sweep
+    std::sort(mToolSpringIndices.begin(), mToolSpringIndices.end());
+    mToolSpringIndices.erase(
+        std::unique(mToolSpringIndices.begin(), mToolSpringIndices.end()),
+        mToolSpringIndices.end());
+}
+
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <Core/GameMath.h>
 #include <Core/Log.h>
 
+#include <algorithm>
 #include <cassert>
 #include <deque>
 
@@ -27,49 +28,122 @@ void Ship::RepairAt(
     float const squareSearchRadius = searchRadius * searchRadius;
 
     //
-    // Pass 1: straighten one-spring and two-spring naked springs
+    // Advance the session
     //
 
-    // We store points in radius here in order to speedup subsequent passes
-    std::vector<ElementIndex> pointsInRadius;
+    auto & session = mRepairSessionState;
+
+    auto const previousStep = repairStepId.Previous();
+    auto const previousPreviousStep = previousStep.Previous();
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
+    if (session.LastRepairStepId == previousStep)
     {
-        if (float const squareRadius = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            squareRadius <= squareSearchRadius)
+        // Continuing the session
+        std::swap(session.PreviousPreviousStepAttractors, session.PreviousStepAttractors);
+        std::swap(session.PreviousStepAttractors, session.CurrentStepAttractors);
+        std::swap(session.PreviousStepDeferredAttractors, session.CurrentStepDeferredAttractors);
+    }
+    else
+    {
+        // New session - whatever we know is stale
+        session.PreviousPreviousStepAttractors.clear();
+        session.PreviousStepAttractors.clear();
+        session.PreviousStepDeferredAttractors.clear();
+    }
+
+    session.CurrentStepAttractors.clear();
+    session.CurrentStepDeferredAttractors.clear();
+    session.RemainingAttractorBudget = RepairSessionState::MaxAttractorsPerStep;
+    session.LastRepairStepId = repairStepId;
+
+    //
+    // Pass 1: straighten one-spring and two-spring naked springs
+    //
+
+    // We store points in radius here in order to speedup subsequent passes;
+    // we visit them in index order, as a full scan would
+    auto & pointsInRadius = session.PointsInRadius;
+    pointsInRadius.clear();
+
+    GetPointSpatialGrid().VisitInRadius(
+        targetPos,
+        searchRadius,
+        [&](ElementIndex pointIndex)
         {
-            StraightenOneSpringChains(pointIndex);
+            if (float const squareRadius = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                squareRadius <= squareSearchRadius)
+            {
+                pointsInRadius.push_back(pointIndex);
+            }
+        });
 
-            StraightenTwoSpringChains(pointIndex);
+    std::sort(pointsInRadius.begin(), pointsInRadius.end());
 
-            pointsInRadius.push_back(pointIndex);
-        }
+    // We're going to move points
+    mIsPointSpatialGridDirty = true;
+
+    for (auto const pointIndex : pointsInRadius)
+    {
+        StraightenOneSpringChains(pointIndex);
+
+        StraightenTwoSpringChains(pointIndex);
     }
 
     //
-    // Pass 2: visit all points that had been attractors in the previous 2 step2
+    // Pass 2: visit all points that had been deferred in the previous step, and then
+    // all points that had been attractors in the previous 2 steps
     //
-    // This is to prevent attractors and attractees from flipping roles during a session;
+    // The former is to resume the work we've left behind when we ran out of budget;
+    // the latter is to prevent attractors and attractees from flipping roles during a session:
     // an attractor will continue to be an attractor until it needs reparation
     //
 
-    auto const previousStep = repairStepId.Previous();
-    auto const previousPreviousStep = previousStep.Previous();
-    for (auto const pointIndex : pointsInRadius)
+    auto const visitPriorityPoints = [&](std::vector<ElementIndex> & priorityPoints)
     {
-        if (mPoints.GetRepairState(pointIndex).LastAttractorRepairStepId == previousStep
-            || mPoints.GetRepairState(pointIndex).LastAttractorRepairStepId == previousPreviousStep)
+        // Visit in index order, and only once
+        std::sort(priorityPoints.begin(), priorityPoints.end());
+        priorityPoints.erase(
+            std::unique(priorityPoints.begin(), priorityPoints.end()),
+            priorityPoints.end());
+
+        for (auto const pointIndex : priorityPoints)
         {
-            TryRepairAndPropagateFromPoint(
-                pointIndex,
-                targetPos,
-                squareSearchRadius,
-                repairStepId,
-                currentSimulationTime,
-                simulationParameters);
+            if (float const squareRadius = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                squareRadius <= squareSearchRadius)
+            {
+                TryRepairAndPropagateFromPoint(
+                    pointIndex,
+                    targetPos,
+                    squareSearchRadius,
+                    repairStepId,
+                    currentSimulationTime,
+                    simulationParameters);
+            }
+        }
+    };
+
+    session.PriorityPoints.assign(
+        session.PreviousStepDeferredAttractors.cbegin(),
+        session.PreviousStepDeferredAttractors.cend());
+
+    visitPriorityPoints(session.PriorityPoints);
+
+    session.PriorityPoints.clear();
+    for (auto const * attractors : { &session.PreviousStepAttractors, &session.PreviousPreviousStepAttractors })
+    {
+        for (auto const pointIndex : *attractors)
+        {
+            // Still an attractor of those steps, i.e. it has not been repaired meanwhile
+            if (mPoints.GetRepairState(pointIndex).LastAttractorRepairStepId == previousStep
+                || mPoints.GetRepairState(pointIndex).LastAttractorRepairStepId == previousPreviousStep)
+            {
+                session.PriorityPoints.push_back(pointIndex);
+            }
         }
     }
 
+    visitPriorityPoints(session.PriorityPoints);
+
     //
     // Pass 3: visit all other points now, to give a chance to everyone else to be
     // an attractor
@@ -389,25 +463,35 @@ bool Ship::TryRepairAndPropagateFromPoint(
                 && mPoints.GetFactoryConnectedSprings(pointIndex).ConnectedSprings.size() > mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() // Needs reparation
                 && mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() > 0) // Not orphaned
             {
-                //
-                // This point has now taken the role of an attractor
-                //
-
-                // Calculate repair strength (1.0 at center and zero at border, fourth power)
-                float const squareRadius = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-                float const repairStrength =
-                    (1.0f - (squareRadius / squareSearchRadius) * (squareRadius / squareSearchRadius))
-                    * (simulationParameters.IsUltraViolentMode ? 10.0f : 1.0f);
+                if (mRepairSessionState.RemainingAttractorBudget == 0)
+                {
+                    // Out of budget for this step; this point will have priority at the next step
+                    mRepairSessionState.CurrentStepDeferredAttractors.push_back(pointIndex);
+                }
+                else
+                {
+                    --mRepairSessionState.RemainingAttractorBudget;
 
-                // Repair from this point
-                bool const hasRepaired = RepairFromAttractor(
-                    pointIndex,
-                    repairStrength,
-                    repairStepId,
-                    currentSimulationTime,
-                    simulationParameters);
+                    //
+                    // This point has now taken the role of an attractor
+                    //
 
-                hasRepairedAnything |= hasRepaired;
+                    // Calculate repair strength (1.0 at center and zero at border, fourth power)
+                    float const squareRadius = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                    float const repairStrength =
+                        (1.0f - (squareRadius / squareSearchRadius) * (squareRadius / squareSearchRadius))
+                        * (simulationParameters.IsUltraViolentMode ? 10.0f : 1.0f);
+
+                    // Repair from this point
+                    bool const hasRepaired = RepairFromAttractor(
+                        pointIndex,
+                        repairStrength,
+                        repairStepId,
+                        currentSimulationTime,
+                        simulationParameters);
+
+                    hasRepairedAnything |= hasRepaired;
+                }
             }
 
             //
@@ -471,6 +555,7 @@ bool Ship::RepairFromAttractor(
 
     // Remember that this point has taken over the role of attractor in this step
     mPoints.GetRepairState(attractorPointIndex).LastAttractorRepairStepId = repairStepId;
+    mRepairSessionState.CurrentStepAttractors.push_back(attractorPointIndex);
 
     //
     // (Attempt to) restore this point's deleted springs
@@ -8,13 +8,17 @@
 #include <Core/Algorithms.h>
 #include <Core/SysSpecifics.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace Physics {
 
 void Ship::RecalculateSpringRelaxationParallelism(
     size_t simulationParallelism,
+    SpringRelaxationParallelComputationModeType mode,
     SimulationParameters const & simulationParameters)
 {
-    switch (simulationParameters.SpringRelaxationParallelComputationMode)
+    switch (mode)
     {
         case SpringRelaxationParallelComputationModeType::FullSpeed:
         {
@@ -33,6 +37,19 @@ void Ship::RecalculateSpringRelaxationParallelism(
             RecalculateSpringRelaxationParallelism_Hybrid(simulationParallelism, simulationParameters);
             break;
         }
+
+        case SpringRelaxationParallelComputationModeType::Chebyshev:
+        {
+            RecalculateSpringRelaxationParallelism_Chebyshev(simulationParallelism, simulationParameters);
+            break;
+        }
+
+        case SpringRelaxationParallelComputationModeType::Automatic:
+        {
+            // The selector only chooses actual modes
+            assert(false);
+            break;
+        }
     }
 }
 
@@ -46,21 +63,22 @@ void Ship::RecalculateSpringRelaxationParallelism_FullSpeed(
     // Prepare dynamic force buffers
     //
 
-    mPoints.SetDynamicForceParallelism(simulationParallelism);
+    PrepareSpringRelaxationDynamicForceBuffers(simulationParallelism);
 
     //
     // Prepare tasks
     //
-    // We want threads to work on a multiple of the vectorization word size - unless there aren't enough elements
+    // We want threads to work on a multiple of the cache line's float count - and hence of the vectorization
+    // word size - unless there aren't enough elements; so that no two threads write to the same cache line
     //
 
     mSpringRelaxation_FullSpeed_Tasks.clear();
 
     ElementCount const numberOfSprings = mSprings.GetElementCount();
-    ElementCount const numberOfVecSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLineSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementCount const numberOfPoints = mPoints.GetBufferElementCount();
-    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLinePointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementIndex springStart = 0;
     ElementIndex pointStart = 0;
@@ -68,13 +86,13 @@ void Ship::RecalculateSpringRelaxationParallelism_FullSpeed(
     {
         ElementIndex const springEnd = (t < simulationParallelism - 1)
             ? std::min(
-                springStart + numberOfVecSpringsPerThread * vectorization_float_count<ElementCount>,
+                springStart + numberOfLineSpringsPerThread * cache_line_float_count<ElementCount>,
                 numberOfSprings)
             : numberOfSprings;
 
         ElementIndex const pointEnd = (t < simulationParallelism - 1)
             ? std::min(
-                pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>,
+                pointStart + numberOfLinePointsPerThread * cache_line_float_count<ElementCount>,
                 numberOfPoints)
             : numberOfPoints;
 
@@ -107,12 +125,13 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
     // Prepare dynamic force buffers
     //
 
-    mPoints.SetDynamicForceParallelism(simulationParallelism);
+    PrepareSpringRelaxationDynamicForceBuffers(simulationParallelism);
 
     //
     // Prepare tasks
     //
-    // We want all but the last thread to work on a multiple of the vectorization word size
+    // We want all but the last thread to work on a multiple of the cache line's float count - and hence of
+    // the vectorization word size - so that no two threads write to the same cache line
     //
 
     mSpringRelaxation_StepByStep_SpringForcesTasks.clear();
@@ -120,17 +139,17 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
     mSpringRelaxation_StepByStep_IntegrationAndSeaFloorCollisionTasks.clear();
 
     ElementCount const numberOfSprings = mSprings.GetElementCount();
-    ElementCount const numberOfVecSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLineSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementCount const numberOfPoints = mPoints.GetBufferElementCount();
-    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLinePointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementIndex springStart = 0;
     ElementIndex pointStart = 0;
     for (size_t t = 0; t < simulationParallelism; ++t)
     {
         ElementIndex const springEnd = (t < simulationParallelism - 1)
-            ? springStart + numberOfVecSpringsPerThread * vectorization_float_count<ElementCount>
+            ? springStart + numberOfLineSpringsPerThread * cache_line_float_count<ElementCount>
             : numberOfSprings;
 
         vec2f * restrict const dynamicForceBuffer = mPoints.GetParallelDynamicForceBuffer(t);
@@ -149,7 +168,7 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
         springStart = springEnd;
 
         ElementIndex const pointEnd = (t < simulationParallelism - 1)
-            ? pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>
+            ? pointStart + numberOfLinePointsPerThread * cache_line_float_count<ElementCount>
             : numberOfPoints;
 
         assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
@@ -196,22 +215,23 @@ void Ship::RecalculateSpringRelaxationParallelism_Hybrid(
     // Prepare dynamic force buffers
     //
 
-    mPoints.SetDynamicForceParallelism(simulationParallelism);
+    PrepareSpringRelaxationDynamicForceBuffers(simulationParallelism);
 
     //
     // Prepare tasks
     //
-    // We want threads to work on a multiple of the vectorization word size - unless there aren't enough elements
+    // We want threads to work on a multiple of the cache line's float count - and hence of the vectorization
+    // word size - unless there aren't enough elements; so that no two threads write to the same cache line
     //
 
     mSpringRelaxation_Hybrid_1_Tasks.clear();
     mSpringRelaxation_Hybrid_2_Tasks.clear();
 
     ElementCount const numberOfSprings = mSprings.GetElementCount();
-    ElementCount const numberOfVecSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLineSpringsPerThread = numberOfSprings / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementCount const numberOfPoints = mPoints.GetBufferElementCount();
-    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfLinePointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
 
     ElementIndex springStart = 0;
     ElementIndex pointStart = 0;
@@ -219,13 +239,13 @@ void Ship::RecalculateSpringRelaxationParallelism_Hybrid(
     {
         ElementIndex const springEnd = (t < simulationParallelism - 1)
             ? std::min(
-                springStart + numberOfVecSpringsPerThread * vectorization_float_count<ElementCount>,
+                springStart + numberOfLineSpringsPerThread * cache_line_float_count<ElementCount>,
                 numberOfSprings)
             : numberOfSprings;
 
         ElementIndex const pointEnd = (t < simulationParallelism - 1)
             ? std::min(
-                pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>,
+                pointStart + numberOfLinePointsPerThread * cache_line_float_count<ElementCount>,
                 numberOfPoints)
             : numberOfPoints;
 
@@ -260,11 +280,116 @@ void Ship::RecalculateSpringRelaxationParallelism_Hybrid(
     }
 }
 
+void Ship::RecalculateSpringRelaxationParallelism_Chebyshev(
+    size_t simulationParallelism,
+    SimulationParameters const & simulationParameters)
+{
+    LogMessage("Ship::RecalculateSpringRelaxationParallelism_Chebyshev: simulationParallelism=", simulationParallelism);
+
+    //
+    // Spring forces are calculated as in StepByStep mode, which also
+    // prepares dynamic force buffers
+    //
+
+    RecalculateSpringRelaxationParallelism_StepByStep(simulationParallelism, simulationParameters);
+
+    //
+    // Prepare integration tasks, on the same point slices as StepByStep's
+    //
+
+    mSpringRelaxation_Chebyshev_IntegrationTasks.clear();
+    mSpringRelaxation_Chebyshev_IntegrationAndSeaFloorCollisionTasks.clear();
+
+    ElementCount const numberOfPoints = mPoints.GetBufferElementCount();
+    ElementCount const numberOfLinePointsPerThread = numberOfPoints / (static_cast<ElementCount>(simulationParallelism) * cache_line_float_count<ElementCount>);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < simulationParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < simulationParallelism - 1)
+            ? pointStart + numberOfLinePointsPerThread * cache_line_float_count<ElementCount>
+            : numberOfPoints;
+
+        assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
+
+        // Note: we store a reference to SimulationParameters in the lambda; this is only safe
+        // if SimulationParameters is never re-created
+
+        mSpringRelaxation_Chebyshev_IntegrationTasks.emplace_back(
+            [this, pointStart, pointEnd, simulationParallelism, &simulationParameters]()
+            {
+                IntegrateAndResetDynamicForcesWithOverRelaxation(
+                    pointStart,
+                    pointEnd,
+                    simulationParallelism,
+                    mSpringRelaxation_Chebyshev_RelaxationFactor,
+                    simulationParameters);
+            });
+
+        mSpringRelaxation_Chebyshev_IntegrationAndSeaFloorCollisionTasks.emplace_back(
+            [this, pointStart, pointEnd, simulationParallelism, &simulationParameters]()
+            {
+                IntegrateAndResetDynamicForcesWithOverRelaxation(
+                    pointStart,
+                    pointEnd,
+                    simulationParallelism,
+                    mSpringRelaxation_Chebyshev_RelaxationFactor,
+                    simulationParameters);
+
+                HandleCollisionsWithSeaFloor(
+                    pointStart,
+                    pointEnd,
+                    simulationParameters);
+            });
+
+        pointStart = pointEnd;
+    }
+}
+
+void Ship::PrepareSpringRelaxationDynamicForceBuffers(size_t simulationParallelism)
+{
+    // New buffers are left uninitialized by Points, so that we may zero them from the threads
+    // that will use them; by first-touch, their memory then gets local to those threads' NUMA
+    // nodes. Task t of a batch is mostly run by the same thread, hence we use a batch of
+    // the same size as the spring relaxation batches.
+
+    size_t const firstNewBuffer = mPoints.SetDynamicForceParallelism(simulationParallelism);
+
+    // Buffers may still be awaiting initialization from a previous change
+    mSpringRelaxation_FirstUninitializedDynamicForceBuffer = std::min(mSpringRelaxation_FirstUninitializedDynamicForceBuffer, firstNewBuffer);
+
+    mSpringRelaxation_DynamicForceInitializationTasks.clear();
+
+    if (mSpringRelaxation_FirstUninitializedDynamicForceBuffer < simulationParallelism)
+    {
+        for (size_t t = 0; t < simulationParallelism; ++t)
+        {
+            mSpringRelaxation_DynamicForceInitializationTasks.emplace_back(
+                [this, t]()
+                {
+                    if (t >= mSpringRelaxation_FirstUninitializedDynamicForceBuffer)
+                    {
+                        mPoints.InitializeParallelDynamicForceBuffer(t);
+                    }
+                });
+        }
+    }
+}
+
 void Ship::RunSpringRelaxation(
     ThreadManager & threadManager,
     SimulationParameters const & simulationParameters)
 {
-    switch (simulationParameters.SpringRelaxationParallelComputationMode)
+    if (!mSpringRelaxation_DynamicForceInitializationTasks.empty())
+    {
+        // First-touch new dynamic force buffers
+        threadManager.GetSimulationThreadPool().RunAndClear(mSpringRelaxation_DynamicForceInitializationTasks);
+        mSpringRelaxation_FirstUninitializedDynamicForceBuffer = std::numeric_limits<size_t>::max();
+    }
+
+    assert(mCurrentSpringRelaxationParallelComputationMode.has_value());
+
+    switch (*mCurrentSpringRelaxationParallelComputationMode)
     {
         case SpringRelaxationParallelComputationModeType::FullSpeed:
         {
@@ -283,6 +408,18 @@ void Ship::RunSpringRelaxation(
             RunSpringRelaxation_Hybrid(threadManager, simulationParameters);
             break;
         }
+
+        case SpringRelaxationParallelComputationModeType::Chebyshev:
+        {
+            RunSpringRelaxation_Chebyshev(threadManager, simulationParameters);
+            break;
+        }
+
+        case SpringRelaxationParallelComputationModeType::Automatic:
+        {
+            assert(false);
+            break;
+        }
     }
 }
 
@@ -511,6 +648,97 @@ void Ship::RunSpringRelaxation_Hybrid(
 #endif
 }
 
+void Ship::RunSpringRelaxation_Chebyshev(
+    ThreadManager & threadManager,
+    SimulationParameters const & simulationParameters)
+{
+    //
+    // Each spring relaxation iteration relaxes springs by a fraction of their strain,
+    // with all springs acting at once on the positions of the previous iteration -
+    // much like a Jacobi iteration; hence stiff structures need many iterations to
+    // get rid of their strain.
+    //
+    // Here we over-relax spring forces with the Chebyshev semi-iterative sequence of
+    // factors:
+    //
+    //  w(1) = 1
+    //  w(2) = 2 / (2 - r^2)
+    //  w(k) = 4 / (4 - r^2 * w(k-1))
+    //
+    // ...with r being the (estimated) spectral radius of the plain iteration; the factors
+    // grow towards the optimal SOR factor 2 / (1 + sqrt(1 - r^2)), removing more strain per
+    // iteration and thus letting structures hold their stiffness with fewer iterations.
+    //
+    // Only spring forces are over-relaxed: static forces - and thus the motion of the ship
+    // as a whole - are integrated as usual.
+    //
+
+    // We run the sea floor collision detection every these many iterations of the spring relaxation loop
+    int constexpr SeaFloorCollisionPeriod = 2;
+
+    float constexpr SquareSpectralRadius =
+        SimulationParameters::ChebyshevSpringRelaxationSpectralRadius
+        * SimulationParameters::ChebyshevSpringRelaxationSpectralRadius;
+
+    auto & threadPool = threadManager.GetSimulationThreadPool();
+
+    int const numMechanicalDynamicsIterations = simulationParameters.NumMechanicalDynamicsIterations<int>();
+    for (int iter = 0; iter < numMechanicalDynamicsIterations; ++iter)
+    {
+        // - DynamicForces = 0 | others at first iteration only
+
+        // Calculate this iteration's factor; the first iteration also integrates
+        // other dynamic forces, hence it may not be over-relaxed
+        if (iter == 0)
+        {
+            mSpringRelaxation_Chebyshev_RelaxationFactor = 1.0f;
+        }
+        else if (iter == 1)
+        {
+            mSpringRelaxation_Chebyshev_RelaxationFactor = 2.0f / (2.0f - SquareSpectralRadius);
+        }
+        else
+        {
+            mSpringRelaxation_Chebyshev_RelaxationFactor = 4.0f / (4.0f - SquareSpectralRadius * mSpringRelaxation_Chebyshev_RelaxationFactor);
+        }
+
+        // Apply spring forces
+        threadPool.Run(mSpringRelaxation_StepByStep_SpringForcesTasks);
+
+        // - DynamicForces = sf | sf + others at first iteration only
+
+        if ((iter % SeaFloorCollisionPeriod) < SeaFloorCollisionPeriod - 1)
+        {
+            // Integrate dynamic - over-relaxed - and static forces,
+            // and reset dynamic forces
+
+            threadPool.Run(mSpringRelaxation_Chebyshev_IntegrationTasks);
+        }
+        else
+        {
+            assert((iter % SeaFloorCollisionPeriod) == SeaFloorCollisionPeriod - 1);
+
+            // Integrate dynamic - over-relaxed - and static forces,
+            // and reset dynamic forces
+
+            // Handle collisions with sea floor
+            //  - Changes position and velocity
+
+            threadPool.Run(mSpringRelaxation_Chebyshev_IntegrationAndSeaFloorCollisionTasks);
+        }
+
+        // - DynamicForces = 0
+    }
+
+#ifdef _DEBUG
+    //
+    // We have dirtied positions
+    //
+
+    mPoints.Diagnostic_MarkPositionsAsDirty();
+#endif
+}
+
 void Ship::RunSpringRelaxation_Hybrid_Thread_1(
     size_t threadIndex,
     ElementIndex startSpringIndex,
@@ -722,6 +950,27 @@ void Ship::IntegrateAndResetDynamicForces(
     }
 }
 
+void Ship::IntegrateAndResetDynamicForcesWithOverRelaxation(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    size_t parallelism,
+    float dynamicForceRelaxationFactor,
+    SimulationParameters const & simulationParameters)
+{
+    float const dt = simulationParameters.MechanicalSimulationStepTimeDuration<float>();
+    float const velocityFactor = CalculateIntegrationVelocityFactor(dt, simulationParameters);
+
+    Algorithms::IntegrateAndResetDynamicForcesWithOverRelaxation<Points>(
+        mPoints,
+        parallelism,
+        startPointIndex,
+        endPointIndex,
+        mPoints.GetDynamicForceBuffersAsFloat(),
+        dt,
+        velocityFactor,
+        dynamicForceRelaxationFactor);
+}
+
 float Ship::CalculateIntegrationVelocityFactor(
     float dt,
     SimulationParameters const & simulationParameters) const
@@ -764,4 +1013,114 @@ float Ship::CalculateIntegrationVelocityFactor(
     return velocityFactor;
 }
 
+bool Ship::IsAtRest(SimulationParameters const & simulationParameters)
+{
+    //
+    // A ship is at rest when the forces on each of its points - those from springs
+    // included - are still in balance, and when none of its points touches the sea floor,
+    // which would push it back with no forces we could account for
+    //
+
+    ElementCount const shipPointCount = mPoints.GetAlignedShipPointCount();
+
+    vec2f * restrict const springForceBuffer = mRestingSpringForceBuffer.data();
+    std::fill(
+        springForceBuffer,
+        springForceBuffer + shipPointCount,
+        vec2f::zero());
+
+    Algorithms::ApplySpringsForces(
+        mPoints,
+        mSprings,
+        0,
+        mSprings.GetElementCount(),
+        springForceBuffer);
+
+    vec2f const * restrict const staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
+    vec2f const * restrict const dynamicForceBuffer = mPoints.GetDynamicForceBufferAsVec2();
+    float const * restrict const isPinnedBuffer = mPoints.GetIsPinnedBufferAsFloat();
+
+    OceanFloor const & oceanFloor = mParentWorld.GetOceanFloor();
+
+    float constexpr MaxAcceleration = SimulationParameters::RestingMaxAcceleration;
+
+    for (auto const p : mPoints.RawShipPoints())
+    {
+        // Pinned points are held by their pins
+        vec2f const totalForce = (springForceBuffer[p] + staticForceBuffer[p] + dynamicForceBuffer[p]) * isPinnedBuffer[p];
+        float const mass = mPoints.GetMass(p);
+        if (totalForce.squareLength() > MaxAcceleration * MaxAcceleration * mass * mass)
+        {
+            return false;
+        }
+
+        vec2f const & position = mPoints.GetPosition(p);
+        float const clampedX = Clamp(position.x, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth);
+        if (std::get<0>(oceanFloor.GetHeightIfUnderneathAt(clampedX, position.y)))
+        {
+            return false;
+        }
+    }
+
+    // Forces on ship points are in balance, hence we may discard them
+    std::fill(
+        mPoints.GetDynamicForceBufferAsVec2(),
+        mPoints.GetDynamicForceBufferAsVec2() + shipPointCount,
+        vec2f::zero());
+
+    return true;
+}
+
+void Ship::RunEphemeralParticlesDynamics(SimulationParameters const & simulationParameters)
+{
+    //
+    // Ephemeral particles have no springs, and thus they only need integration
+    // and sea floor collisions
+    //
+
+    ElementIndex const startPointIndex = mPoints.GetAlignedShipPointCount();
+    ElementIndex const endPointIndex = mPoints.GetBufferElementCount();
+
+    int const numMechanicalDynamicsIterations = simulationParameters.NumMechanicalDynamicsIterations<int>();
+    for (int iter = 0; iter < numMechanicalDynamicsIterations; ++iter)
+    {
+        IntegrateAndResetDynamicForces(
+            startPointIndex,
+            endPointIndex,
+            mCurrentSpringRelaxationParallelism,
+            simulationParameters);
+
+        HandleCollisionsWithSeaFloor(
+            startPointIndex,
+            endPointIndex,
+            simulationParameters);
+    }
+
+#ifdef _DEBUG
+    //
+    // We have dirtied positions
+    //
+
+    mPoints.Diagnostic_MarkPositionsAsDirty();
+#endif
+}
+
+void Ship::UpdateRestingStepCount()
+{
+    vec2f const * restrict const velocityBuffer = mPoints.GetVelocityBufferAsVec2();
+
+    float constexpr MaxVelocity = SimulationParameters::RestingMaxVelocity;
+
+    for (auto const p : mPoints.RawShipPoints())
+    {
+        if (velocityBuffer[p].squareLength() > MaxVelocity * MaxVelocity)
+        {
+            mRestingStepCount = 0;
+            return;
+        }
+    }
+
+    ++mRestingStepCount;
+}
+
 }
\ No newline at end of file
@@ -86,7 +86,7 @@ void Ship::InternalUpdateExplosionStateMachine(
     //
     // Blast force and heat
     //
-    // Go through all points and, for each point in radius:
+    // Go through all points in radius and, for each of them:
     //  - Apply blast force
     //  - Apply blast heat (note: it's supposed to be negative for fire=extionguishing explosions)
     //  - Keep non-ephemeral point that is closest to blast position; we'll Detach() it later
@@ -104,84 +104,98 @@ void Ship::InternalUpdateExplosionStateMachine(
     float nearestStructuralPointSquareDistance = std::numeric_limits<float>::max();
     ElementIndex nearestStructuralPointIndex = NoneElementIndex;
 
-    // Visit all points
-    for (auto const pointIndex : mPoints)
-    {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
-        float const squarePointDistance = pointRadius.squareLength();
-
-        if (squarePointDistance < squareHeatRadius)
+    auto const visitPoint =
+        [&](ElementIndex pointIndex)
         {
-            float const scalingFactor = (1.0f - squarePointDistance / squareHeatRadius);
-
-            //
-            // Inject heat at this point
-            //
-
-            mPoints.AddHeat(
-                pointIndex,
-                blastHeat * scalingFactor);
+            vec2f const pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
+            float const squarePointDistance = pointRadius.squareLength();
 
-            if constexpr (DoExtinguishFire)
+            if (squarePointDistance < squareHeatRadius)
             {
-                //
-                // Extinguish it if burning
-                //
-
-                if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
-                {
-                    mPoints.SmotherCombustion(pointIndex, true); // Fake it's water
-                }
+                float const scalingFactor = (1.0f - squarePointDistance / squareHeatRadius);
 
                 //
-                // Also send temperature below combustion point
+                // Inject heat at this point
                 //
 
-                float const oldTemperature = mPoints.GetTemperature(pointIndex);
-                float const deltaTemperature = mPoints.GetMaterialIgnitionTemperature(pointIndex) / 2.0f - oldTemperature;
-
-                mPoints.SetTemperature(
+                mPoints.AddHeat(
                     pointIndex,
-                    oldTemperature + std::min(deltaTemperature * scalingFactor, 0.0f));
-            }
-        }
+                    blastHeat * scalingFactor);
 
-        if (squarePointDistance < squareForceRadius)
-        {
-            //
-            // Apply blast force
-            //
-            // (inversely proportional to square root of distance, not second power as one would expect though)
-            //
+                if constexpr (DoExtinguishFire)
+                {
+                    //
+                    // Extinguish it if burning
+                    //
 
-            float const pointRadiusLength = std::sqrt(squarePointDistance);
+                    if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
+                    {
+                        mPoints.SmotherCombustion(pointIndex, true); // Fake it's water
+                    }
 
-            vec2f const blastDir = pointRadius.normalise_approx(pointRadiusLength);
+                    //
+                    // Also send temperature below combustion point
+                    //
 
-            mPoints.AddStaticForce(
-                pointIndex,
-                blastDir * explosionStateMachine.BlastForceMagnitude / std::sqrt(std::max((pointRadiusLength * 0.3f) + 0.7f, 1.0f)));
+                    float const oldTemperature = mPoints.GetTemperature(pointIndex);
+                    float const deltaTemperature = mPoints.GetMaterialIgnitionTemperature(pointIndex) / 2.0f - oldTemperature;
 
-            // Update water velocity
-            mPoints.SetWaterVelocity(
-                pointIndex,
-                mPoints.GetWaterVelocity(pointIndex) + blastDir * 100.0f * mPoints.GetWater(pointIndex)); // Magic number
+                    mPoints.SetTemperature(
+                        pointIndex,
+                        oldTemperature + std::min(deltaTemperature * scalingFactor, 0.0f));
+                }
+            }
 
-            if constexpr (DoDetachNearestPoint)
+            if (squarePointDistance < squareForceRadius)
             {
                 //
-                // Check whether this point is the closest point, if it's structural
+                // Apply blast force
                 //
+                // (inversely proportional to square root of distance, not second power as one would expect though)
+                //
+
+                float const pointRadiusLength = std::sqrt(squarePointDistance);
+
+                vec2f const blastDir = pointRadius.normalise_approx(pointRadiusLength);
+
+                mPoints.AddStaticForce(
+                    pointIndex,
+                    blastDir * explosionStateMachine.BlastForceMagnitude / std::sqrt(std::max((pointRadiusLength * 0.3f) + 0.7f, 1.0f)));
 
-                if (squarePointDistance < nearestStructuralPointSquareDistance
-                    && pointIndex < mPoints.GetRawShipPointCount()
-                    && !mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+                // Update water velocity
+                mPoints.SetWaterVelocity(
+                    pointIndex,
+                    mPoints.GetWaterVelocity(pointIndex) + blastDir * 100.0f * mPoints.GetWater(pointIndex)); // Magic number
+
+                if constexpr (DoDetachNearestPoint)
                 {
-                    nearestStructuralPointSquareDistance = squarePointDistance;
-                    nearestStructuralPointIndex = pointIndex;
+                    //
+                    // Check whether this point is the closest point, if it's structural
+                    //
+
+                    // (ties go to the lowest index, as ship points are not visited in index order)
+                    if ((squarePointDistance < nearestStructuralPointSquareDistance
+                            || (squarePointDistance == nearestStructuralPointSquareDistance && pointIndex < nearestStructuralPointIndex))
+                        && pointIndex < mPoints.GetRawShipPointCount()
+                        && !mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+                    {
+                        nearestStructuralPointSquareDistance = squarePointDistance;
+                        nearestStructuralPointIndex = pointIndex;
+                    }
                 }
             }
-        }
+        };
+
+    // Ship points: only those in the cells touched by the larger of the two radii
+    GetPointSpatialGrid().VisitInRadius(
+        centerPosition,
+        std::max(blastForceRadius, blastHeatRadius),
+        visitPoint);
+
+    // Ephemeral points
+    for (auto const pointIndex : mPoints.EphemeralPoints())
+    {
+        visitPoint(pointIndex);
     }
 
     //
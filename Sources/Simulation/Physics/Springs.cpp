@@ -103,6 +103,101 @@ void Springs::Add(
         points);
 }
 
+void Springs::AddRange(
+    std::vector<ShipFactorySpring> const & springInfos,
+    Points const & points)
+{
+    ElementIndex const startSpringIndex = static_cast<ElementIndex>(mIsDeletedBuffer.GetCurrentPopulatedSize());
+    size_t const count = springInfos.size();
+
+    auto const materialA = [&](size_t s) -> StructuralMaterial const & { return points.GetStructuralMaterial(springInfos[s].PointAIndex); };
+    auto const materialB = [&](size_t s) -> StructuralMaterial const & { return points.GetStructuralMaterial(springInfos[s].PointBIndex); };
+    auto const factoryRestLength = [&](size_t s) { return (points.GetPosition(springInfos[s].PointAIndex) - points.GetPosition(springInfos[s].PointBIndex)).length(); };
+
+    mIsDeletedBuffer.emplace_back_n(count, false);
+
+    mEndpointsBuffer.emplace_back_range(count, [&](size_t s) { return Endpoints(springInfos[s].PointAIndex, springInfos[s].PointBIndex); });
+
+    mFactoryEndpointOctantsBuffer.emplace_back_range(count, [&](size_t s) { return EndpointOctants(springInfos[s].PointAAngle, springInfos[s].PointBAngle); });
+
+    mSuperTrianglesBuffer.emplace_back_range(count, [&](size_t s) { return springInfos[s].Triangles; });
+    mFactorySuperTrianglesBuffer.emplace_back_range(count, [&](size_t s) { return springInfos[s].Triangles; });
+
+    mCoveringTrianglesCountBuffer.emplace_back_range(count, [&](size_t s)
+        {
+            assert(springInfos[s].CoveringTrianglesCount >= springInfos[s].Triangles.size()); // Covering triangles count includes super triangles
+            return springInfos[s].CoveringTrianglesCount;
+        });
+
+    // Strain threshold is average, and randomized - +/-
+    mStrainStateBuffer.emplace_back_range(count, [&](size_t s)
+        {
+            float constexpr RandomWidth = 0.7f; // 70%: 35% less or 35% more
+            float const averageStrainThreshold = (materialA(s).StrainThresholdFraction + materialB(s).StrainThresholdFraction) / 2.0f;
+            float const strainThreshold = averageStrainThreshold
+                * (1.0f - RandomWidth / 2.0f + RandomWidth * points.GetRandomNormalizedUniformPersonalitySeed(springInfos[s].PointAIndex));
+
+            return StrainState(
+                0.0f, // Breaking elongation recalculated later
+                strainThreshold,
+                false);
+        });
+
+    mFactoryRestLengthBuffer.emplace_back_range(count, factoryRestLength);
+    mRestLengthBuffer.emplace_back_range(count, factoryRestLength);
+
+    // Dynamics coefficients recalculated later, but stiffness grows slowly and shrinks fast, hence we want to start high
+    mStiffnessCoefficientBuffer.emplace_back_n(count, std::numeric_limits<float>::max());
+    mDampingCoefficientBuffer.emplace_back_n(count, 0.0f);
+
+    // Stiffness, strength, and melting temperature are average
+    mMaterialPropertiesBuffer.emplace_back_range(count, [&](size_t s)
+        {
+            float const averageStrength =
+                (points.GetStrength(springInfos[s].PointAIndex) + points.GetStrength(springInfos[s].PointBIndex))
+                / 2.0f;
+
+            return MaterialProperties(
+                (materialA(s).Stiffness + materialB(s).Stiffness) / 2.0f,
+                averageStrength,
+                (materialA(s).MeltingTemperature + materialB(s).MeltingTemperature) / 2.0f,
+                CalculateExtraMeltingInducedTolerance(averageStrength));
+        });
+
+    // Base structural material is arbitrarily the weakest of the two;
+    // only affects sound and name, anyway
+    mBaseStructuralMaterialBuffer.emplace_back_range(count, [&](size_t s)
+        {
+            return materialA(s).Strength < materialB(s).Strength
+                ? &(materialA(s))
+                : &(materialB(s));
+        });
+
+    // If both nodes are rope, then the spring is rope
+    // (non-rope <-> rope springs are "connections" and not to be treated as ropes)
+    mIsRopeBuffer.emplace_back_range(count, [&](size_t s) { return points.IsRope(springInfos[s].PointAIndex) && points.IsRope(springInfos[s].PointBIndex); });
+
+    // Spring is permeable by default - will be changed later
+    mWaterPermeabilityBuffer.emplace_back_n(count, 1.0f);
+
+    // Heat properties are average
+    mMaterialThermalConductivityBuffer.emplace_back_range(count, [&](size_t s) { return (materialA(s).ThermalConductivity + materialB(s).ThermalConductivity) / 2.0f; });
+
+    // Make room
+    mCachedVectorialLengthBuffer.emplace_back_n(count, 0.0f);
+    mCachedVectorialNormalizedVectorBuffer.emplace_back_n(count, vec2f::zero());
+
+    // Calculate parameters for these springs
+    CoefficientsParameters const coefficientsParameters = MakeCoefficientsParameters();
+    for (size_t s = 0; s < count; ++s)
+    {
+        inline_UpdateCoefficients(
+            startSpringIndex + static_cast<ElementIndex>(s),
+            coefficientsParameters,
+            points);
+    }
+}
+
 void Springs::Destroy(
     ElementIndex springElementIndex,
     DestroyOptions destroyOptions,
@@ -161,9 +256,51 @@ void Springs::Restore(
         simulationParameters);
 }
 
-void Springs::UpdateForSimulationParameters(
-    SimulationParameters const & simulationParameters,
-    Points const & points)
+void Springs::SaveSnapshot(SnapshotWriter & writer) const
+{
+    writer.Write(mStrainStateBuffer);
+    writer.Write(mRestLengthBuffer);
+    writer.Write(mStiffnessCoefficientBuffer);
+    writer.Write(mDampingCoefficientBuffer);
+    writer.Write(mCachedVectorialLengthBuffer);
+    writer.Write(mCachedVectorialNormalizedVectorBuffer);
+}
+
+void Springs::RestoreSnapshot(SnapshotReader & reader)
+{
+    reader.Read(mStrainStateBuffer);
+    reader.Read(mRestLengthBuffer);
+    reader.Read(mStiffnessCoefficientBuffer);
+    reader.Read(mDampingCoefficientBuffer);
+    reader.Read(mCachedVectorialLengthBuffer);
+    reader.Read(mCachedVectorialNormalizedVectorBuffer);
+}
+
+void Springs::ReportMemory(MemoryReport & report) const
+{
+    report.Add("Springs", "IsDeleted", mIsDeletedBuffer);
+    report.Add("Springs", "Endpoints", mEndpointsBuffer);
+    report.Add("Springs", "FactoryEndpointOctants", mFactoryEndpointOctantsBuffer);
+    report.Add("Springs", "SuperTriangles", mSuperTrianglesBuffer);
+    report.Add("Springs", "FactorySuperTriangles", mFactorySuperTrianglesBuffer);
+    report.Add("Springs", "CoveringTrianglesCount", mCoveringTrianglesCountBuffer);
+    report.Add("Springs", "StrainState", mStrainStateBuffer);
+    report.Add("Springs", "FactoryRestLength", mFactoryRestLengthBuffer);
+    report.Add("Springs", "RestLength", mRestLengthBuffer);
+    report.Add("Springs", "StiffnessCoefficient", mStiffnessCoefficientBuffer);
+    report.Add("Springs", "DampingCoefficient", mDampingCoefficientBuffer);
+    report.Add("Springs", "MaterialProperties", mMaterialPropertiesBuffer);
+    report.Add("Springs", "BaseStructuralMaterial", mBaseStructuralMaterialBuffer);
+    report.Add("Springs", "IsRope", mIsRopeBuffer);
+    report.Add("Springs", "CachedVectorialLength", mCachedVectorialLengthBuffer);
+    report.Add("Springs", "CachedVectorialNormalizedVector", mCachedVectorialNormalizedVectorBuffer);
+    report.Add("Springs", "WaterPermeability", mWaterPermeabilityBuffer);
+    report.Add("Springs", "MaterialThermalConductivity", mMaterialThermalConductivityBuffer);
+    report.Add("Springs", "BreakingSprings", mBreakingSpringsBuffer);
+    report.Add("Springs", "StressedSprings", mStressedSpringsBuffer);
+}
+
+bool Springs::UpdateForSimulationParameters(SimulationParameters const & simulationParameters)
 {
     if (simulationParameters.NumMechanicalDynamicsIterations<float>() != mCurrentNumMechanicalDynamicsIterations
         || simulationParameters.SpringStiffnessAdjustment != mCurrentSpringStiffnessAdjustment
@@ -179,11 +316,11 @@ void Springs::UpdateForSimulationParameters(
         mCurrentSpringStrengthAdjustment = simulationParameters.SpringStrengthAdjustment;
         mCurrentMeltingTemperatureAdjustment = simulationParameters.MeltingTemperatureAdjustment;
 
-        // Recalc whole
-        UpdateCoefficientsForPartition(
-            0, 1,
-            points);
+        // Whole needs to be recalculated
+        return true;
     }
+
+    return false;
 }
 
 void Springs::UploadElements(
@@ -232,16 +369,14 @@ void Springs::UploadStressedSpringElements(
 {
     auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
 
-    for (ElementIndex i : *this)
+    for (ElementIndex const i : mStressedSpringsBuffer)
     {
-        if (!mIsDeletedBuffer[i])
+        // Springs might have been destroyed - or restored - since the strain checks
+        if (!mIsDeletedBuffer[i] && mStrainStateBuffer[i].IsStressed)
         {
-            if (mStrainStateBuffer[i].IsStressed)
-            {
-                shipRenderContext.UploadElementStressedSpring(
-                    GetEndpointAIndex(i),
-                    GetEndpointBIndex(i));
-            }
+            shipRenderContext.UploadElementStressedSpring(
+                GetEndpointAIndex(i),
+                GetEndpointBIndex(i));
         }
     }
 }
@@ -278,7 +413,15 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
     float * restrict const cachedLengthBuffer = mCachedVectorialLengthBuffer.data();
     vec2f * restrict const cachedNormalizedVectorBuffer = mCachedVectorialNormalizedVectorBuffer.data();
 
-    // Visit all springs
+    //
+    // 1. Visit all springs, only collecting the ones that break - so that this pass
+    //    does not get interleaved with the destruction of elements, the firing of
+    //    events, and the re-routing of frontiers - and the ones that are stressed
+    //
+
+    mBreakingSpringsBuffer.clear();
+    mStressedSpringsBuffer.clear();
+
     assert(is_aligned_to_float_element_count(GetBufferElementCount()));
     for (ElementIndex s_0 = 0; s_0 < GetBufferElementCount(); s_0 += 4)
     {
@@ -313,15 +456,7 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
                 if (absStrain > breakingElongation)
                 {
                     // It's broken!
-
-                    // Destroy this spring
-                    this->Destroy(
-                        s,
-                        DestroyOptions::FireBreakEvent // Notify Break
-                        | DestroyOptions::DestroyAllTriangles,
-                        currentSimulationTime,
-                        simulationParameters,
-                        points);
+                    mBreakingSpringsBuffer.push_back(s);
                 }
                 else
                 {
@@ -354,6 +489,11 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
                         }
                     }
 
+                    if (strainState.IsStressed)
+                    {
+                        mStressedSpringsBuffer.push_back(s);
+                    }
+
                     // Update stress
                     if constexpr (DoUpdateStress)
                     {
@@ -377,6 +517,29 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
             }
         }
     }
+
+    //
+    // 2. Destroy the springs that broke
+    //
+    // Note: destroying a spring does not affect the strain of other springs, hence
+    // the outcome of the checks above is the same as if we had destroyed each spring
+    // as soon as we found it breaking
+    //
+
+    for (ElementIndex const s : mBreakingSpringsBuffer)
+    {
+        // Check again, as reactions to earlier destructions (e.g. gadgets) might have destroyed it
+        if (!mIsDeletedBuffer[s])
+        {
+            this->Destroy(
+                s,
+                DestroyOptions::FireBreakEvent // Notify Break
+                | DestroyOptions::DestroyAllTriangles,
+                currentSimulationTime,
+                simulationParameters,
+                points);
+        }
+    }
 }
 
 void Springs::UpdateCoefficientsForPartition(
@@ -387,12 +550,15 @@ void Springs::UpdateCoefficientsForPartition(
     ElementCount const partitionSize = (GetElementCount() / partitionCount) + ((GetElementCount() % partitionCount) ? 1 : 0);
     ElementCount const startSpringIndex = partition * partitionSize;
     ElementCount const endSpringIndex = std::min(startSpringIndex + partitionSize, GetElementCount());
+
+    CoefficientsParameters const coefficientsParameters = MakeCoefficientsParameters();
     for (ElementIndex s = startSpringIndex; s < endSpringIndex; ++s)
     {
         if (!IsDeleted(s))
         {
             inline_UpdateCoefficients(
                 s,
+                coefficientsParameters,
                 points);
         }
     }
@@ -404,11 +570,27 @@ void Springs::UpdateCoefficients(
 {
     inline_UpdateCoefficients(
         springIndex,
+        MakeCoefficientsParameters(),
         points);
 }
 
+Springs::CoefficientsParameters Springs::MakeCoefficientsParameters() const
+{
+    float const dt = SimulationParameters::SimulationStepTimeDuration<float> / mCurrentNumMechanicalDynamicsIterations;
+
+    // Note: products are kept in the same order as they would be if calculated for each spring,
+    // so that coefficients are identical
+    return CoefficientsParameters{
+        dt,
+        dt * dt,
+        mCurrentSpringStiffnessAdjustment,
+        SimulationParameters::SpringDampingCoefficient * mCurrentSpringDampingAdjustment,
+        mCurrentMeltingTemperatureAdjustment };
+}
+
 void Springs::inline_UpdateCoefficients(
     ElementIndex springIndex,
+    CoefficientsParameters const & coefficientsParameters,
     Points const & points)
 {
     auto const endpointAIndex = GetEndpointAIndex(springIndex);
@@ -418,8 +600,6 @@ void Springs::inline_UpdateCoefficients(
         (points.GetAugmentedMaterialMass(endpointAIndex) * points.GetAugmentedMaterialMass(endpointBIndex))
         / (points.GetAugmentedMaterialMass(endpointAIndex) + points.GetAugmentedMaterialMass(endpointBIndex));
 
-    float const dt = SimulationParameters::SimulationStepTimeDuration<float> / mCurrentNumMechanicalDynamicsIterations;
-
     // Note: in 1.14 the spring temperature was the average of the two points.
     // Differences in temperature between adjacent points made it so that springs'
     // melting was widely underestimated.
@@ -432,7 +612,7 @@ void Springs::inline_UpdateCoefficients(
     // if we're below the melting temperature
     float const meltingOverheat =
         springTemperature
-        - GetMaterialMeltingTemperature(springIndex) * mCurrentMeltingTemperatureAdjustment;
+        - GetMaterialMeltingTemperature(springIndex) * coefficientsParameters.MeltingTemperatureAdjustment;
 
     //
     // Stiffness coefficient
@@ -473,9 +653,9 @@ void Springs::inline_UpdateCoefficients(
     float const desiredStiffnessCoefficient =
         SimulationParameters::SpringReductionFraction
         * GetMaterialStiffness(springIndex)
-        * mCurrentSpringStiffnessAdjustment
+        * coefficientsParameters.StiffnessAdjustment
         * massFactor
-        / (dt * dt)
+        / coefficientsParameters.DtSquared
         * meltMultiplier;
 
     // If the coefficient is growing (spring is becoming more stiff), then
@@ -503,10 +683,9 @@ void Springs::inline_UpdateCoefficients(
     //
 
     mDampingCoefficientBuffer[springIndex] =
-        SimulationParameters::SpringDampingCoefficient
-        * mCurrentSpringDampingAdjustment
+        coefficientsParameters.DampingFactor
         * massFactor
-        / dt;
+        / coefficientsParameters.Dt;
 
     //
     // Breaking elongation
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "../Materials.h"
+#include "../ShipFactoryTypes.h"
 #include "../SimulationEventDispatcher.h"
 #include "../SimulationParameters.h"
 
@@ -16,10 +17,13 @@
 #include <Core/ElementContainer.h>
 #include <Core/EnumFlags.h>
 #include <Core/FixedSizeVector.h>
+#include <Core/MemoryReport.h>
+#include <Core/Snapshot.h>
 
 #include <cassert>
 #include <functional>
 #include <limits>
+#include <vector>
 
 namespace Physics
 {
@@ -125,36 +129,36 @@ public:
         World & parentWorld,
         SimulationEventDispatcher & simulationEventDispatcher,
         SimulationParameters const & simulationParameters)
-        : ElementContainer(elementCount)
+        : ElementContainer(elementCount, simulationParameters.DoUseContiguousElementBuffers)
         , mPerfectSquareCount(perfectSquareCount)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true)
+        , mIsDeletedBuffer(mBufferArena, mBufferElementCount, mElementCount, true)
         // Endpoints
-        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(0, 0))
+        , mEndpointsBuffer(mBufferArena, mBufferElementCount, mElementCount, Endpoints(0, 0))
         // Factory endpoint octants
-        , mFactoryEndpointOctantsBuffer(mBufferElementCount, mElementCount, EndpointOctants(0, 4))
+        , mFactoryEndpointOctantsBuffer(mBufferArena, mBufferElementCount, mElementCount, EndpointOctants(0, 4))
         // Super triangles
-        , mSuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector())
-        , mFactorySuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector())
+        , mSuperTrianglesBuffer(mBufferArena, mBufferElementCount, mElementCount, SuperTrianglesVector())
+        , mFactorySuperTrianglesBuffer(mBufferArena, mBufferElementCount, mElementCount, SuperTrianglesVector())
         // Covering triangles
-        , mCoveringTrianglesCountBuffer(mBufferElementCount, mElementCount, 0)
+        , mCoveringTrianglesCountBuffer(mBufferArena, mBufferElementCount, mElementCount, 0)
         // Physical
-        , mStrainStateBuffer(mBufferElementCount, mElementCount, StrainState(0.0f, 0.0f, false))
-        , mFactoryRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f)
-        , mRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f)
-        , mStiffnessCoefficientBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mDampingCoefficientBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mMaterialPropertiesBuffer(mBufferElementCount, mElementCount, MaterialProperties(0.0f, 0.0f, 0.0f, 0.0f))
-        , mBaseStructuralMaterialBuffer(mBufferElementCount, mElementCount, nullptr)
-        , mIsRopeBuffer(mBufferElementCount, mElementCount, false)
-        , mCachedVectorialLengthBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mCachedVectorialNormalizedVectorBuffer(mBufferElementCount, mElementCount, vec2f::zero())
+        , mStrainStateBuffer(mBufferArena, mBufferElementCount, mElementCount, StrainState(0.0f, 0.0f, false))
+        , mFactoryRestLengthBuffer(mBufferArena, mBufferElementCount, mElementCount, 1.0f)
+        , mRestLengthBuffer(mBufferArena, mBufferElementCount, mElementCount, 1.0f)
+        , mStiffnessCoefficientBuffer(mBufferArena, mBufferElementCount, mElementCount, 0.0f)
+        , mDampingCoefficientBuffer(mBufferArena, mBufferElementCount, mElementCount, 0.0f)
+        , mMaterialPropertiesBuffer(mBufferArena, mBufferElementCount, mElementCount, MaterialProperties(0.0f, 0.0f, 0.0f, 0.0f))
+        , mBaseStructuralMaterialBuffer(mBufferArena, mBufferElementCount, mElementCount, nullptr)
+        , mIsRopeBuffer(mBufferArena, mBufferElementCount, mElementCount, false)
+        , mCachedVectorialLengthBuffer(mBufferArena, mBufferElementCount, mElementCount, 0.0f)
+        , mCachedVectorialNormalizedVectorBuffer(mBufferArena, mBufferElementCount, mElementCount, vec2f::zero())
         // Water
-        , mWaterPermeabilityBuffer(mBufferElementCount, mElementCount, 0.0f)
+        , mWaterPermeabilityBuffer(mBufferArena, mBufferElementCount, mElementCount, 0.0f)
         // Heat
-        , mMaterialThermalConductivityBuffer(mBufferElementCount, mElementCount, 0.0f)
+        , mMaterialThermalConductivityBuffer(mBufferArena, mBufferElementCount, mElementCount, 0.0f)
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -169,6 +173,8 @@ public:
         , mCurrentMeltingTemperatureAdjustment(simulationParameters.MeltingTemperatureAdjustment)
         , mFloatBufferAllocator(mBufferElementCount)
         , mVec2fBufferAllocator(mBufferElementCount)
+        , mBreakingSpringsBuffer()
+        , mStressedSpringsBuffer()
     {
     }
 
@@ -179,6 +185,19 @@ public:
         mShipPhysicsHandler = shipPhysicsHandler;
     }
 
+    /*
+     * Saves the dynamic state of the springs; the structure itself is not part of
+     * snapshots.
+     */
+    void SaveSnapshot(SnapshotWriter & writer) const;
+
+    void RestoreSnapshot(SnapshotReader & reader);
+
+    /*
+     * Adds the memory occupied by the springs to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
     void Add(
         ElementIndex pointAIndex,
         ElementIndex pointBIndex,
@@ -188,6 +207,14 @@ public:
         ElementCount coveringTrianglesCount,
         Points const & points);
 
+    /*
+     * Adds all of the ship's springs at once, equivalently to invoking Add() for each one of
+     * them in order, but filling each buffer in a single pass.
+     */
+    void AddRange(
+        std::vector<ShipFactorySpring> const & springInfos,
+        Points const & points);
+
     void Destroy(
         ElementIndex springElementIndex,
         DestroyOptions destroyOptions,
@@ -200,9 +227,24 @@ public:
         SimulationParameters const & simulationParameters,
         Points const & points);
 
-    void UpdateForSimulationParameters(
-        SimulationParameters const & simulationParameters,
-        Points const & points);
+    /*
+     * Adopts eventual parameter changes; returns true when these require the coefficients of all
+     * springs to be recalculated, which is then up to the caller - for all partitions - via
+     * UpdateCoefficientsForSimulationParameters().
+     */
+    bool UpdateForSimulationParameters(SimulationParameters const & simulationParameters);
+
+    void UpdateCoefficientsForSimulationParameters(
+        ElementIndex partition,
+        ElementIndex partitionCount,
+        Points const & points)
+    {
+        // Recalculate coefficients for this paritition
+        UpdateCoefficientsForPartition(
+            partition,
+            partitionCount,
+            points);
+    }
 
     void UpdateForDecayAndTemperature(
         ElementIndex partition,
@@ -483,6 +525,11 @@ public:
         return mFactoryRestLengthBuffer[springElementIndex];
     }
 
+    float const * GetFactoryRestLengthBuffer() const noexcept
+    {
+        return mFactoryRestLengthBuffer.data();
+    }
+
     float GetRestLength(ElementIndex springElementIndex) const noexcept
     {
         return mRestLengthBuffer[springElementIndex];
@@ -562,6 +609,11 @@ public:
         return mCachedVectorialNormalizedVectorBuffer[springElementIndex];
     }
 
+    vec2f const * GetCachedVectorialNormalizedVectorBuffer() const noexcept
+    {
+        return mCachedVectorialNormalizedVectorBuffer.data();
+    }
+
     //
     // Water
     //
@@ -591,12 +643,12 @@ public:
     // Temporary buffer
     //
 
-    std::shared_ptr<Buffer<float>> AllocateWorkBufferFloat()
+    PooledBuffer<float> AllocateWorkBufferFloat()
     {
         return mFloatBufferAllocator.Allocate();
     }
 
-    std::shared_ptr<Buffer<vec2f>> AllocateWorkBufferVec2f()
+    PooledBuffer<vec2f> AllocateWorkBufferVec2f()
     {
         return mVec2fBufferAllocator.Allocate();
     }
@@ -618,8 +670,23 @@ private:
         ElementIndex springIndex,
         Points const & points);
 
+    /*
+     * The terms of the coefficients that only depend on the current parameters.
+     */
+    struct CoefficientsParameters
+    {
+        float Dt;
+        float DtSquared;
+        float StiffnessAdjustment;
+        float DampingFactor;
+        float MeltingTemperatureAdjustment;
+    };
+
+    CoefficientsParameters MakeCoefficientsParameters() const;
+
     inline void inline_UpdateCoefficients(
         ElementIndex springIndex,
+        CoefficientsParameters const & coefficientsParameters,
         Points const & points);
 
     static float CalculateSpringStrengthIterationsAdjustment(float numMechanicalDynamicsIterations);
@@ -707,6 +774,15 @@ private:
     // Allocators for work buffers
     BufferAllocator<float> mFloatBufferAllocator;
     BufferAllocator<vec2f> mVec2fBufferAllocator;
+
+    // Work buffer for the springs found to be breaking during strain checks,
+    // which are destroyed after all springs have been checked
+    std::vector<ElementIndex> mBreakingSpringsBuffer;
+
+    // The springs found to be stressed during the last strain checks, in index order;
+    // a by-product of the checks, so that uploading stressed springs does not have
+    // to visit all springs
+    std::vector<ElementIndex> mStressedSpringsBuffer;
 };
 
 }
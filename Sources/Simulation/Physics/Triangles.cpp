@@ -46,6 +46,66 @@ void Triangles::Add(
     mCoveredSpringsBuffer.emplace_back(coveredSprings);
 }
 
+void Triangles::AddRange(
+    std::vector<ShipFactoryTriangle> const & triangleInfos,
+    IndexRemap const & pointIndexRemap,
+    std::vector<FactoryOppositeTrianglesInfo> const & oppositeTrianglesInfos,
+    std::vector<FactoryFloorsInfo> const & floorsInfos)
+{
+    size_t const count = triangleInfos.size();
+
+    assert(oppositeTrianglesInfos.size() == count);
+    assert(floorsInfos.size() == count);
+
+    mIsDeletedBuffer.emplace_back_n(count, false);
+
+    mEndpointsBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            return Endpoints(
+                pointIndexRemap.OldToNew(triangleInfos[t].PointIndices1[0]),
+                pointIndexRemap.OldToNew(triangleInfos[t].PointIndices1[1]),
+                pointIndexRemap.OldToNew(triangleInfos[t].PointIndices1[2]));
+        });
+
+    mSubSpringsBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            assert(triangleInfos[t].Springs2.size() == 3);
+            return SubSprings(triangleInfos[t].Springs2[0], triangleInfos[t].Springs2[1], triangleInfos[t].Springs2[2]);
+        });
+
+    mOppositeTrianglesBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            auto const & infos = oppositeTrianglesInfos[t];
+            return OppositeTrianglesInfo{
+                OppositeTriangleInfo(std::get<0>(infos[0]), std::get<1>(infos[0])),
+                OppositeTriangleInfo(std::get<0>(infos[1]), std::get<1>(infos[1])),
+                OppositeTriangleInfo(std::get<0>(infos[2]), std::get<1>(infos[2])) };
+        });
+
+    mSubSpringNpcFloorKindsBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            auto const & infos = floorsInfos[t];
+            return SubSpringNpcFloorKinds({ std::get<0>(infos[0]), std::get<0>(infos[1]), std::get<0>(infos[2]) });
+        });
+
+    mSubSpringNpcFloorGeometriesBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            auto const & infos = floorsInfos[t];
+            return SubSpringNpcFloorGeometries({ std::get<1>(infos[0]), std::get<1>(infos[1]), std::get<1>(infos[2]) });
+        });
+
+    mCoveredSpringsBuffer.emplace_back_range(count, [&](size_t t)
+        {
+            CoveredSpringsVector coveredSprings;
+            coveredSprings.emplace_back(triangleInfos[t].Springs2[0]);
+            coveredSprings.emplace_back(triangleInfos[t].Springs2[1]);
+            coveredSprings.emplace_back(triangleInfos[t].Springs2[2]);
+            if (triangleInfos[t].CoveredTraverseSpringIndex2.has_value())
+                coveredSprings.push_back(*triangleInfos[t].CoveredTraverseSpringIndex2);
+            return coveredSprings;
+        });
+}
+
 void Triangles::Destroy(ElementIndex triangleElementIndex)
 {
     assert(triangleElementIndex < mElementCount);
@@ -76,19 +136,69 @@ ElementIndex Triangles::FindContaining(
     vec2f const & position,
     Points const & points) const
 {
+    ElementIndex result = NoneElementIndex;
+
+    VisitContainmentCandidates(
+        position,
+        points,
+        [&](ElementIndex t)
+        {
+            vec2f const aPosition = points.GetPosition(GetPointAIndex(t));
+            vec2f const bPosition = points.GetPosition(GetPointBIndex(t));
+            vec2f const cPosition = points.GetPosition(GetPointCIndex(t));
+
+            if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition))
+            {
+                result = t;
+                return true;
+            }
+
+            return false;
+        });
+
+    return result;
+}
+
+void Triangles::ReportMemory(MemoryReport & report) const
+{
+    report.Add("Triangles", "IsDeleted", mIsDeletedBuffer);
+    report.Add("Triangles", "Endpoints", mEndpointsBuffer);
+    report.Add("Triangles", "SubSprings", mSubSpringsBuffer);
+    report.Add("Triangles", "OppositeTriangles", mOppositeTrianglesBuffer);
+    report.Add("Triangles", "SubSpringNpcFloorKinds", mSubSpringNpcFloorKindsBuffer);
+    report.Add("Triangles", "SubSpringNpcFloorGeometries", mSubSpringNpcFloorGeometriesBuffer);
+    report.Add("Triangles", "CoveredSprings", mCoveredSpringsBuffer);
+    report.Add("Triangles", "RenderSlot", mRenderSlotBuffer);
+    report.Add("Triangles", "RenderPlaneId", mRenderPlaneIdBuffer);
+    report.Add("Triangles", "ContainmentGridEntries", mContainmentGridEntries);
+}
+
+void Triangles::BuildContainmentGrid(Points const & points) const
+{
+    // Boxes are slightly larger than the triangles, so that positions that are found to be in a triangle
+    // despite rounding are also found to be in its box
+    float constexpr BoxMargin = 0.01f;
+
+    // Each cell to hold a few triangles
+    float constexpr TargetTrianglesPerCell = 4.0f;
+
+    mContainmentGridEntries.clear();
     for (auto const t : *this)
     {
-        vec2f const aPosition = points.GetPosition(GetPointAIndex(t));
-        vec2f const bPosition = points.GetPosition(GetPointBIndex(t));
-        vec2f const cPosition = points.GetPosition(GetPointCIndex(t));
+        // Deleted triangles are included too, as they might be restored while the grid is in use
+        Geometry::AABB box;
+        box.ExtendTo(points.GetPosition(GetPointAIndex(t)));
+        box.ExtendTo(points.GetPosition(GetPointBIndex(t)));
+        box.ExtendTo(points.GetPosition(GetPointCIndex(t)));
 
-        if (Geometry::IsPointInTriangle(position, aPosition, bPosition, cPosition))
-        {
-            return t;
-        }
+        box.TopRight += vec2f(BoxMargin, BoxMargin);
+        box.BottomLeft -= vec2f(BoxMargin, BoxMargin);
+
+        mContainmentGridEntries.emplace_back(t, box);
     }
 
-    return NoneElementIndex;
+    mContainmentGrid.Build(mContainmentGridEntries, TargetTrianglesPerCell);
+    mIsContainmentGridBuilt = true;
 }
 
 }
\ No newline at end of file
@@ -5,14 +5,18 @@
 ***************************************************************************************/
 #pragma once
 
+#include "../ShipFactoryTypes.h"
 #include "../SimulationParameters.h"
 
 #include <Render/RenderContext.h>
 
+#include <Core/AABBGrid.h>
 #include <Core/Buffer.h>
 #include <Core/ElementContainer.h>
 #include <Core/FixedSizeVector.h>
 #include <Core/GameGeometry.h>
+#include <Core/IndexRemap.h>
+#include <Core/MemoryReport.h>
 
 #include <algorithm>
 #include <array>
@@ -20,6 +24,7 @@
 #include <functional>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace Physics
 {
@@ -90,27 +95,42 @@ private:
 
 public:
 
-    Triangles(ElementCount elementCount)
-        : ElementContainer(elementCount)
+    // Per-edge info that the ship factory derives for each triangle
+    using FactoryOppositeTrianglesInfo = std::array<std::tuple<ElementIndex, int>, 3>;
+    using FactoryFloorsInfo = std::array<std::tuple<NpcFloorKindType, NpcFloorGeometryType>, 3>;
+
+    Triangles(
+        ElementCount elementCount,
+        bool doUseContiguousBuffers)
+        : ElementContainer(elementCount, doUseContiguousBuffers)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true)
+        , mIsDeletedBuffer(mBufferArena, mBufferElementCount, mElementCount, true)
         // Endpoints
-        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex, NoneElementIndex))
+        , mEndpointsBuffer(mBufferArena, mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex, NoneElementIndex))
         // Sub springs
-        , mSubSpringsBuffer(mBufferElementCount, mElementCount, SubSprings(NoneElementIndex, NoneElementIndex, NoneElementIndex))
+        , mSubSpringsBuffer(mBufferArena, mBufferElementCount, mElementCount, SubSprings(NoneElementIndex, NoneElementIndex, NoneElementIndex))
         // Opposite triangles
-        , mOppositeTrianglesBuffer(mBufferElementCount, mElementCount, { OppositeTriangleInfo(NoneElementIndex, -1), OppositeTriangleInfo(NoneElementIndex, -1), OppositeTriangleInfo(NoneElementIndex, -1) })
+        , mOppositeTrianglesBuffer(mBufferArena, mBufferElementCount, mElementCount, { OppositeTriangleInfo(NoneElementIndex, -1), OppositeTriangleInfo(NoneElementIndex, -1), OppositeTriangleInfo(NoneElementIndex, -1) })
         // Floors
-        , mSubSpringNpcFloorKindsBuffer(mBufferElementCount, mElementCount, { NpcFloorKindType::NotAFloor, NpcFloorKindType::NotAFloor, NpcFloorKindType::NotAFloor })
-        , mSubSpringNpcFloorGeometriesBuffer(mBufferElementCount, mElementCount, { NpcFloorGeometryType::NotAFloor, NpcFloorGeometryType::NotAFloor, NpcFloorGeometryType::NotAFloor })
+        , mSubSpringNpcFloorKindsBuffer(mBufferArena, mBufferElementCount, mElementCount, { NpcFloorKindType::NotAFloor, NpcFloorKindType::NotAFloor, NpcFloorKindType::NotAFloor })
+        , mSubSpringNpcFloorGeometriesBuffer(mBufferArena, mBufferElementCount, mElementCount, { NpcFloorGeometryType::NotAFloor, NpcFloorGeometryType::NotAFloor, NpcFloorGeometryType::NotAFloor })
         // Covered springs
-        , mCoveredSpringsBuffer(mBufferElementCount, mElementCount, CoveredSpringsVector())
+        , mCoveredSpringsBuffer(mBufferArena, mBufferElementCount, mElementCount, CoveredSpringsVector())
+        // Render
+        , mRenderSlotBuffer(mBufferArena, mBufferElementCount, mElementCount, NoneElementIndex)
+        , mRenderPlaneIdBuffer(mBufferArena, mBufferElementCount, mElementCount, NonePlaneId)
         //////////////////////////////////
         // Container
         //////////////////////////////////
         , mShipPhysicsHandler(nullptr)
+        , mRenderSlotCount(0)
+        , mRenderTombstoneCount(0)
+        , mIsContainmentGridEnabled(false)
+        , mIsContainmentGridBuilt(false)
+        , mContainmentGrid()
+        , mContainmentGridEntries()
     {
     }
 
@@ -136,6 +156,16 @@ public:
         std::tuple<NpcFloorKindType, NpcFloorGeometryType> subSpringCFloorInfo,
         std::optional<ElementIndex> coveredTraverseSpringIndex);
 
+    /*
+     * Adds all of the ship's triangles at once, equivalently to invoking Add() for each one of
+     * them in order, but filling each buffer in a single pass.
+     */
+    void AddRange(
+        std::vector<ShipFactoryTriangle> const & triangleInfos,
+        IndexRemap const & pointIndexRemap,
+        std::vector<FactoryOppositeTrianglesInfo> const & oppositeTrianglesInfos,
+        std::vector<FactoryFloorsInfo> const & floorsInfos);
+
     void Destroy(ElementIndex triangleElementIndex);
 
     void Restore(ElementIndex triangleElementIndex);
@@ -144,6 +174,11 @@ public:
     // Render
     //
 
+    /*
+     * Adds the memory occupied by the triangles to the report.
+     */
+    void ReportMemory(MemoryReport & report) const;
+
     /*
      * Uploads triangle elements.
      *
@@ -151,35 +186,106 @@ public:
      * buffer for all triangles. The last element contains the total number of (non-deleted) triangles.
      *
      * The content of the planeIndices container is modified by this method, for performance convenience only.
+     *
+     * Each triangle keeps the slot it was last uploaded at; when triangles have only been deleted since the last
+     * upload - and the remaining ones are still in the same planes - the deleted triangles' slots are merely
+     * tombstoned, so that only those need to reach the GPU. The slots are re-compacted once tombstones are too many.
      */
     template<typename TIndices>
     void UploadElements(
         ShipId shipId,
         TIndices & planeIndices,
         Points const & points,
-        RenderContext & renderContext) const
+        RenderContext & renderContext)
     {
+        // Fraction of tombstoned slots at which we re-compact
+        size_t constexpr MaxTombstonesFraction = 4;
+
         auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
 
+        //
+        // Check whether we may just tombstone the slots of the deleted triangles
+        //
+
+        bool canTombstone = (mRenderSlotCount > 0);
+        size_t newTombstoneCount = 0;
         for (ElementIndex i : *this)
         {
+            if (!canTombstone)
+                break;
+
             if (!mIsDeletedBuffer[i])
             {
-                // Get the plane of this triangle (== plane of point A)
-                PlaneId planeId = points.GetPlaneId(GetPointAIndex(i));
-
-                // Send triangle to its index
-                assert(planeId < planeIndices.size());
-                shipRenderContext.UploadElementTriangle(
-                    planeIndices[planeId],
-                    GetPointAIndex(i),
-                    GetPointBIndex(i),
-                    GetPointCIndex(i));
-
-                // Remember that the next triangle for this plane goes to the next element
-                planeIndices[planeId]++;
+                // Triangles that were not uploaded, or that changed plane, need a new layout
+                canTombstone =
+                    mRenderSlotBuffer[i] != NoneElementIndex
+                    && mRenderPlaneIdBuffer[i] == points.GetPlaneId(GetPointAIndex(i));
+            }
+            else if (mRenderSlotBuffer[i] != NoneElementIndex)
+            {
+                ++newTombstoneCount;
             }
         }
+
+        if (canTombstone
+            && (mRenderTombstoneCount + newTombstoneCount) * MaxTombstonesFraction <= mRenderSlotCount)
+        {
+            shipRenderContext.UploadElementTrianglesPatchStart();
+
+            if (newTombstoneCount > 0)
+            {
+                for (ElementIndex i : *this)
+                {
+                    if (mIsDeletedBuffer[i] && mRenderSlotBuffer[i] != NoneElementIndex)
+                    {
+                        shipRenderContext.UploadElementTriangleTombstone(mRenderSlotBuffer[i]);
+                        mRenderSlotBuffer[i] = NoneElementIndex;
+                    }
+                }
+
+                mRenderTombstoneCount += newTombstoneCount;
+            }
+        }
+        else
+        {
+            //
+            // Upload a new, compact layout
+            //
+
+            shipRenderContext.UploadElementTrianglesStart(planeIndices.back());
+
+            for (ElementIndex i : *this)
+            {
+                if (!mIsDeletedBuffer[i])
+                {
+                    // Get the plane of this triangle (== plane of point A)
+                    PlaneId planeId = points.GetPlaneId(GetPointAIndex(i));
+
+                    // Send triangle to its index
+                    assert(planeId < planeIndices.size());
+                    shipRenderContext.UploadElementTriangle(
+                        planeIndices[planeId],
+                        GetPointAIndex(i),
+                        GetPointBIndex(i),
+                        GetPointCIndex(i));
+
+                    mRenderSlotBuffer[i] = static_cast<ElementIndex>(planeIndices[planeId]);
+                    mRenderPlaneIdBuffer[i] = planeId;
+
+                    // Remember that the next triangle for this plane goes to the next element
+                    planeIndices[planeId]++;
+                }
+                else
+                {
+                    mRenderSlotBuffer[i] = NoneElementIndex;
+                }
+            }
+
+            mRenderSlotCount = planeIndices.back();
+            mRenderTombstoneCount = 0;
+        }
+
+        shipRenderContext.UploadElementTrianglesEnd();
     }
 
 public:
@@ -231,6 +337,55 @@ public:
         vec2f const & position,
         Points const & points) const;
 
+    /*
+     * While enabled, containment queries are served by a grid of the triangles, built at
+     * the first query with the positions of their endpoints at that moment; hence, to be
+     * enabled only while these positions do not change.
+     */
+    void EnableContainmentGrid()
+    {
+        mIsContainmentGridEnabled = true;
+        mIsContainmentGridBuilt = false;
+    }
+
+    void DisableContainmentGrid()
+    {
+        mIsContainmentGridEnabled = false;
+        mIsContainmentGridBuilt = false;
+        mContainmentGrid.Clear();
+    }
+
+    /*
+     * Visits - in increasing index order - a superset of the triangles that might contain
+     * the specified position, deleted ones included; the visitor returns true to stop the visit.
+     */
+    template<typename TVisitor>
+    void VisitContainmentCandidates(
+        vec2f const & position,
+        Points const & points,
+        TVisitor && visitor) const
+    {
+        if (mIsContainmentGridEnabled)
+        {
+            if (!mIsContainmentGridBuilt)
+            {
+                BuildContainmentGrid(points);
+            }
+
+            mContainmentGrid.VisitCandidates(position, visitor);
+        }
+        else
+        {
+            for (auto const triangleIndex : *this)
+            {
+                if (visitor(triangleIndex))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
     //
     // Sub springs
     //
@@ -517,6 +672,8 @@ private:
         }
     }
 
+    void BuildContainmentGrid(Points const & points) const;
+
 private:
 
     //////////////////////////////////////////////////////////
@@ -544,11 +701,25 @@ private:
     // immutable
     Buffer<CoveredSpringsVector> mCoveredSpringsBuffer;
 
+    // Render - the slot at which each triangle was last uploaded, and the plane it was in
+    Buffer<ElementIndex> mRenderSlotBuffer;
+    Buffer<PlaneId> mRenderPlaneIdBuffer;
+
     //////////////////////////////////////////////////////////
     // Container
     //////////////////////////////////////////////////////////
 
     IShipPhysicsHandler * mShipPhysicsHandler;
+
+    // The size of the last uploaded layout, and how many of its slots are tombstoned
+    size_t mRenderSlotCount;
+    size_t mRenderTombstoneCount;
+
+    // Containment grid, built lazily while enabled
+    bool mIsContainmentGridEnabled;
+    bool mutable mIsContainmentGridBuilt;
+    Geometry::AABBGrid mutable mContainmentGrid;
+    std::vector<Geometry::AABBGrid::Entry> mutable mContainmentGridEntries; // Kept to reuse its capacity
 };
 
 }
@@ -6,6 +6,7 @@
 #include "Physics.h"
 
 #include <Core/GameRandomEngine.h>
+#include <Core/Log.h>
 
 #include <algorithm>
 #include <cassert>
@@ -35,6 +36,18 @@ World::World(
     , mNpcs(std::make_unique<Npcs>(*this, npcDatabase, mSimulationEventHandler, simulationParameters))
     //
     , mAllShipExternalAABBs()
+    , mAllShipExternalAABBShipIds()
+    , mShipCollisionRegions()
+    , mShipCollisionPairRegions()
+    , mFrameArena()
+    , mEnvironmentUpdateTasks()
+    //
+    , mShipSpringRelaxationParallelisms()
+    , mIntraShipParallelismShips()
+    , mShipLevelParallelismBuckets()
+    , mShipLevelParallelismTasks()
+    , mCurrentShipUpdateParallelismShipCount(0)
+    , mCurrentShipUpdateParallelismSimulationParallelism(0) // We'll detect a difference on first run
 {
     // Initialize world pieces that need to be initialized now
     mStars.Update(mCurrentSimulationTime, simulationParameters);
@@ -68,6 +81,7 @@ void World::AddShip(std::unique_ptr<Ship> ship)
     for (auto const & aabb : shipExternalAABBs.GetItems())
     {
         mAllShipExternalAABBs.Add(aabb);
+        mAllShipExternalAABBShipIds.push_back(mAllShips.back()->GetId());
     }
 }
 
@@ -105,6 +119,52 @@ void World::ReplayRecordedEvent(
     }
 }
 
+Snapshot World::TakeSnapshot() const
+{
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+
+    writer.Write(mCurrentSimulationTime);
+    writer.Write(GameRandomEngine::GetInstance().GetState());
+
+    mOceanSurface.SaveSnapshot(writer);
+
+    writer.Write(static_cast<std::uint32_t>(mAllShips.size()));
+    for (auto const & ship : mAllShips)
+    {
+        ship->SaveSnapshot(writer);
+    }
+
+    LogMessage("World::TakeSnapshot: ", snapshot.GetByteSize(), " bytes");
+
+    return snapshot;
+}
+
+void World::RestoreSnapshot(Snapshot const & snapshot)
+{
+    SnapshotReader reader(snapshot);
+
+    reader.Read(mCurrentSimulationTime);
+
+    std::string randomEngineState;
+    reader.Read(randomEngineState);
+    GameRandomEngine::GetInstance().SetState(randomEngineState);
+
+    mOceanSurface.RestoreSnapshot(reader);
+
+    if (reader.Read<std::uint32_t>() != mAllShips.size())
+    {
+        throw GameException("The snapshot was taken of a world with a different number of ships");
+    }
+
+    for (auto & ship : mAllShips)
+    {
+        ship->RestoreSnapshot(reader);
+    }
+
+    assert(reader.IsAtEnd());
+}
+
 size_t World::GetShipCount() const
 {
     return mAllShips.size();
@@ -117,6 +177,37 @@ size_t World::GetShipPointCount(ShipId shipId) const
     return mAllShips[shipId]->GetPointCount();
 }
 
+void World::ReportShipMemory(
+    ShipId shipId,
+    MemoryReport & report) const
+{
+    assert(shipId >= 0 && shipId < mAllShips.size());
+
+    mAllShips[shipId]->ReportMemory(report);
+}
+
+void World::SetShipInteriorTextureImage(
+    ShipId shipId,
+    RgbaImageData && interiorTextureImage)
+{
+    assert(shipId >= 0 && shipId < mAllShips.size());
+
+    mAllShips[shipId]->SetInteriorTextureImage(std::move(interiorTextureImage));
+}
+
+std::vector<ShipSpringRelaxationState> World::GetShipSpringRelaxationStates() const
+{
+    std::vector<ShipSpringRelaxationState> states;
+    states.reserve(mAllShips.size());
+
+    for (auto const & ship : mAllShips)
+    {
+        states.push_back(ship->GetSpringRelaxationState());
+    }
+
+    return states;
+}
+
 size_t World::GetAllShipSpringCount() const
 {
     return std::accumulate(
@@ -283,7 +374,8 @@ void World::MoveBy(
     GlobalConnectedComponentId connectedComponentId,
     vec2f const & moveOffset,
     vec2f const & inertialVelocity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     auto const shipId = connectedComponentId.GetShipId();
     assert(shipId >= 0 && shipId < mAllShips.size());
@@ -293,7 +385,8 @@ void World::MoveBy(
         connectedComponentId.GetLocalObjectId(),
         moveOffset,
         inertialVelocity,
-        simulationParameters);
+        simulationParameters,
+        threadManager);
 
     // NPCs
     mNpcs->MoveShipBy(
@@ -308,7 +401,8 @@ void World::MoveBy(
     ShipId shipId,
     vec2f const & moveOffset,
     vec2f const & inertialVelocity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     assert(shipId >= 0 && shipId < mAllShips.size());
 
@@ -316,7 +410,8 @@ void World::MoveBy(
     mAllShips[shipId]->MoveBy(
         moveOffset,
         inertialVelocity,
-        simulationParameters);
+        simulationParameters,
+        threadManager);
 
     // NPCs
     mNpcs->MoveShipBy(
@@ -332,7 +427,8 @@ void World::RotateBy(
     float angle,
     vec2f const & center,
     float inertialAngle,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     auto const shipId = connectedComponentId.GetShipId();
     assert(shipId >= 0 && shipId < mAllShips.size());
@@ -342,7 +438,8 @@ void World::RotateBy(
         angle,
         center,
         inertialAngle,
-        simulationParameters);
+        simulationParameters,
+        threadManager);
 
     mNpcs->RotateShipBy(
         shipId,
@@ -358,7 +455,8 @@ void World::RotateBy(
     float angle,
     vec2f const & center,
     float inertialAngle,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     assert(shipId >= 0 && shipId < mAllShips.size());
 
@@ -366,7 +464,8 @@ void World::RotateBy(
         angle,
         center,
         inertialAngle,
-        simulationParameters);
+        simulationParameters,
+        threadManager);
 
     mNpcs->RotateShipBy(
         shipId,
@@ -1482,40 +1581,124 @@ void World::Update(
 
     // Prepare all AABBs
     mAllShipExternalAABBs.Clear();
+    mAllShipExternalAABBShipIds.clear();
 
     //
     // Update all subsystems
     //
 
-    mStars.Update(mCurrentSimulationTime, simulationParameters);
-
+    // Storm and wind feed everything else
     mStorm.Update(simulationParameters);
 
     mWind.Update(mStorm.GetParameters(), simulationParameters);
 
-    mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
+    mOceanSurface.UpdateWaves(mCurrentSimulationTime, mWind, simulationParameters);
 
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters);
+    //
+    // The ocean's fluid dynamics only touch the ocean surface, hence they may run concurrently
+    // with the rest of the environment; the latter stays on the calling thread, as it
+    // uses the random engine
+    //
 
-    mOceanFloor.Update(simulationParameters);
+    mEnvironmentUpdateTasks.emplace_back(
+        [this, &simulationParameters, &perfStats]()
+        {
+            ScopedPerfMeasurement<PerfMeasurement::TotalOceanSurfaceUpdate> const perfMeasurement(perfStats);
+
+            mOceanSurface.UpdateFluidDynamics(mCurrentSimulationTime, mWind, simulationParameters);
+        });
+
+    // Last, hence guaranteed to run on this thread
+    mEnvironmentUpdateTasks.emplace_back(
+        [this, &simulationParameters]()
+        {
+            mStars.Update(mCurrentSimulationTime, simulationParameters);
+
+            mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
+
+            mOceanFloor.Update(simulationParameters);
+        });
+
+    threadManager.GetSimulationThreadPool().RunAndClear(mEnvironmentUpdateTasks);
 
-    for (auto & ship : mAllShips)
     {
-        ship->Update(
-            mCurrentSimulationTime,
-            mStorm.GetParameters(),
-            simulationParameters,
-            stressRenderMode,
-            mAllShipExternalAABBs,
-            threadManager,
-            perfStats);
+        auto const shipsStartTime = GameChronometer::Now();
+
+        //
+        // Decide how ships share the simulation parallelism
+        //
+
+        size_t const simulationParallelism = threadManager.GetSimulationParallelism();
+        if (mAllShips.size() != mCurrentShipUpdateParallelismShipCount
+            || simulationParallelism != mCurrentShipUpdateParallelismSimulationParallelism)
+        {
+            RecalculateShipUpdateParallelism(simulationParallelism, simulationParameters, threadManager);
+
+            // Remember new values
+            mCurrentShipUpdateParallelismShipCount = mAllShips.size();
+            mCurrentShipUpdateParallelismSimulationParallelism = simulationParallelism;
+        }
+
+        //
+        // Process eventual parameter changes - in ship order, as this may use the random engine
+        //
+
+        for (auto & ship : mAllShips)
+        {
+            ship->UpdateForSimulationParameters(
+                simulationParameters,
+                simulationParallelism,
+                mShipSpringRelaxationParallelisms[ship->GetId()],
+                threadManager);
+        }
+
+        //
+        // Update mechanics - ship-local, hence ships may run concurrently
+        //
+
+        {
+            auto const springsStartTime = GameChronometer::Now();
+
+            UpdateShipMechanics(simulationParameters, threadManager);
+
+            perfStats.Update<PerfMeasurement::TotalShipsSpringsUpdate>(GameChronometer::Now() - springsStartTime);
+        }
+
+        //
+        // Update the rest - in ship order, so that AABBs and events are always produced in the same order
+        //
+
+        for (auto & ship : mAllShips)
+        {
+            ship->Update(
+                mCurrentSimulationTime,
+                mStorm.GetParameters(),
+                simulationParameters,
+                stressRenderMode,
+                mAllShipExternalAABBs,
+                threadManager,
+                perfStats);
+
+            mAllShipExternalAABBShipIds.resize(mAllShipExternalAABBs.GetCount(), ship->GetId());
+        }
+
+        //
+        // Collide ships with each other - now that their AABBs are known
+        //
+
+        if (simulationParameters.DoCollideShips && mAllShips.size() > 1)
+        {
+            UpdateShipCollisions(simulationParameters);
+        }
+
+        perfStats.Update<PerfMeasurement::TotalShipsUpdate>(GameChronometer::Now() - shipsStartTime);
     }
 
     {
         auto const startTime = std::chrono::steady_clock::now();
 
         assert(mNpcs);
-        mNpcs->Update(mCurrentSimulationTime, mStorm.GetParameters(), simulationParameters);
+        mNpcs->Update(mCurrentSimulationTime, mStorm.GetParameters(), simulationParameters, viewModel.GetVisibleWorld(), threadManager);
 
         perfStats.Update<PerfMeasurement::TotalNpcUpdate>(std::chrono::steady_clock::now() - startTime);
     }
@@ -1540,40 +1723,249 @@ void World::Update(
     }
 
     mNpcs->UpdateEnd();
+
+    mFrameArena.Reset();
+}
+
+void World::UpdateShipCollisions(SimulationParameters const & simulationParameters)
+{
+    assert(mAllShipExternalAABBShipIds.size() == mAllShipExternalAABBs.GetCount());
+
+    //
+    // Broadphase: find the regions where AABBs of different ships intersect
+    //
+
+    mShipCollisionRegions.clear();
+
+    auto const & aabbs = mAllShipExternalAABBs.GetItems();
+    mAllShipExternalAABBs.VisitIntersectingPairs(
+        SimulationParameters::ShipCollisionMargin,
+        [&](size_t i1, size_t i2)
+        {
+            ShipId shipId1 = mAllShipExternalAABBShipIds[i1];
+            ShipId shipId2 = mAllShipExternalAABBShipIds[i2];
+            if (shipId1 == shipId2)
+            {
+                return;
+            }
+
+            Geometry::AABB region(
+                std::max(aabbs[i1].BottomLeft.x, aabbs[i2].BottomLeft.x) - SimulationParameters::ShipCollisionMargin,
+                std::min(aabbs[i1].TopRight.x, aabbs[i2].TopRight.x) + SimulationParameters::ShipCollisionMargin,
+                std::min(aabbs[i1].TopRight.y, aabbs[i2].TopRight.y) + SimulationParameters::ShipCollisionMargin,
+                std::max(aabbs[i1].BottomLeft.y, aabbs[i2].BottomLeft.y) - SimulationParameters::ShipCollisionMargin);
+
+            if (shipId1 > shipId2)
+            {
+                std::swap(shipId1, shipId2);
+            }
+
+            mShipCollisionRegions.emplace_back(shipId1, shipId2, region);
+        });
+
+    if (mShipCollisionRegions.empty())
+    {
+        return;
+    }
+
+    // Group by pair of ships; stable, so that regions stay in visit order
+    std::stable_sort(
+        mShipCollisionRegions.begin(),
+        mShipCollisionRegions.end(),
+        [](auto const & lhs, auto const & rhs)
+        {
+            return lhs.ShipId1 < rhs.ShipId1
+                || (lhs.ShipId1 == rhs.ShipId1 && lhs.ShipId2 < rhs.ShipId2);
+        });
+
+    //
+    // Narrowphase: one ship pair at a time
+    //
+
+    for (size_t r = 0; r < mShipCollisionRegions.size(); )
+    {
+        ShipId const shipId1 = mShipCollisionRegions[r].ShipId1;
+        ShipId const shipId2 = mShipCollisionRegions[r].ShipId2;
+
+        mShipCollisionPairRegions.clear();
+        for (; r < mShipCollisionRegions.size()
+            && mShipCollisionRegions[r].ShipId1 == shipId1
+            && mShipCollisionRegions[r].ShipId2 == shipId2; ++r)
+        {
+            mShipCollisionPairRegions.push_back(mShipCollisionRegions[r].Region);
+        }
+
+        mAllShips[shipId1]->ApplyShipCollisions(
+            *mAllShips[shipId2],
+            mShipCollisionPairRegions,
+            simulationParameters);
+    }
+}
+
+void World::RecalculateShipUpdateParallelism(
+    size_t simulationParallelism,
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    mShipSpringRelaxationParallelisms.clear();
+    mIntraShipParallelismShips.clear();
+    mShipLevelParallelismBuckets.clear();
+    mShipLevelParallelismTasks.clear();
+
+    //
+    // Separate small ships from large ones
+    //
+
+    std::vector<Ship *> smallShips;
+    for (auto & ship : mAllShips)
+    {
+        if (ship->GetPointCount() <= ShipLevelParallelismMaxPointCount)
+        {
+            smallShips.push_back(ship.get());
+        }
+    }
+
+    if (simulationParallelism < 2 || smallShips.size() < 2)
+    {
+        // Not worth it - all ships use the whole thread pool
+        smallShips.clear();
+    }
+
+    for (auto & ship : mAllShips)
+    {
+        if (std::find(smallShips.cbegin(), smallShips.cend(), ship.get()) == smallShips.cend())
+        {
+            mIntraShipParallelismShips.push_back(ship.get());
+            mShipSpringRelaxationParallelisms.push_back(simulationParallelism);
+        }
+        else
+        {
+            mShipSpringRelaxationParallelisms.push_back(1);
+        }
+    }
+
+    //
+    // Distribute small ships among buckets: largest ships first, each going to the
+    // least-loaded bucket
+    //
+    // Note: which bucket a ship ends up in has no effect on the results, as this stage
+    // only touches ship-local state
+    //
+
+    if (!smallShips.empty())
+    {
+        std::stable_sort(
+            smallShips.begin(),
+            smallShips.end(),
+            [](Ship const * lhs, Ship const * rhs)
+            {
+                return lhs->GetPointCount() > rhs->GetPointCount();
+            });
+
+        size_t const bucketCount = std::min(simulationParallelism, smallShips.size());
+        mShipLevelParallelismBuckets.resize(bucketCount);
+        std::vector<size_t> bucketPointCounts(bucketCount, 0);
+
+        for (Ship * ship : smallShips)
+        {
+            size_t const b = std::distance(
+                bucketPointCounts.cbegin(),
+                std::min_element(bucketPointCounts.cbegin(), bucketPointCounts.cend()));
+
+            mShipLevelParallelismBuckets[b].push_back(ship);
+            bucketPointCounts[b] += ship->GetPointCount();
+        }
+
+        // Note: we store references to SimulationParameters and ThreadManager in the lambda;
+        // this is only safe if they are never re-created
+
+        for (size_t b = 0; b < bucketCount; ++b)
+        {
+            mShipLevelParallelismTasks.emplace_back(
+                [this, b, &simulationParameters, &threadManager]()
+                {
+                    for (Ship * ship : mShipLevelParallelismBuckets[b])
+                    {
+                        ship->UpdateMechanics(simulationParameters, threadManager);
+                    }
+                });
+        }
+    }
+
+    LogMessage("World::RecalculateShipUpdateParallelism: ships=", mAllShips.size(), " simulationParallelism=", simulationParallelism,
+        " intraShipParallelismShips=", mIntraShipParallelismShips.size(), " shipLevelParallelismShips=", smallShips.size(),
+        " shipLevelParallelismTasks=", mShipLevelParallelismTasks.size());
+}
+
+void World::UpdateShipMechanics(
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    // Large ships first, one at a time, each using the whole thread pool
+    for (Ship * ship : mIntraShipParallelismShips)
+    {
+        ship->UpdateMechanics(simulationParameters, threadManager);
+    }
+
+    // Then small ships, all at the same time
+    if (!mShipLevelParallelismTasks.empty())
+    {
+        threadManager.GetSimulationThreadPool().Run(mShipLevelParallelismTasks);
+    }
 }
 
 void World::RenderUpload(
     SimulationParameters const & simulationParameters,
-    RenderContext & renderContext)
+    RenderContext & renderContext,
+    float renderInterpolationFactor,
+    PerfStats & perfStats)
 {
-    mStars.Upload(renderContext);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalSkyRenderUpload> const perfMeasurement(perfStats);
 
-    mWind.Upload(renderContext);
+        mStars.Upload(renderContext);
 
-    mStorm.Upload(renderContext);
+        mWind.Upload(renderContext);
 
-    mClouds.Upload(renderContext);
+        mStorm.Upload(renderContext);
 
-    mOceanFloor.Upload(simulationParameters, renderContext);
+        mClouds.Upload(renderContext);
+    }
 
-    mOceanSurface.Upload(renderContext);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalOceanRenderUpload> const perfMeasurement(perfStats);
 
-    mFishes.Upload(renderContext);
+        mOceanFloor.Upload(simulationParameters, renderContext);
+
+        mOceanSurface.Upload(renderContext);
+    }
+
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalFishRenderUpload> const perfMeasurement(perfStats);
+
+        mFishes.Upload(renderContext);
+    }
 
     // Ships
     {
+        ScopedPerfMeasurement<PerfMeasurement::TotalShipsRenderUpload> const perfMeasurement(perfStats);
+
         renderContext.UploadShipsStart();
 
         for (auto const & ship : mAllShips)
         {
-            ship->RenderUpload(renderContext);
+            ship->RenderUpload(renderContext, renderInterpolationFactor, perfStats);
         }
 
         renderContext.UploadShipsEnd();
     }
 
-    assert(mNpcs);
-    mNpcs->Upload(renderContext);
+    {
+        ScopedPerfMeasurement<PerfMeasurement::TotalNpcRenderUpload> const perfMeasurement(perfStats);
+
+        assert(mNpcs);
+        mNpcs->Upload(renderContext);
+    }
 
     // AABBs
     if (renderContext.GetShowAABBs())
@@ -18,10 +18,13 @@
 #include <Render/ViewModel.h>
 
 #include <Core/AABBSet.h>
+#include <Core/FrameArena.h>
 #include <Core/GameChronometer.h>
 #include <Core/GameTypes.h>
 #include <Core/ImageData.h>
+#include <Core/MemoryReport.h>
 #include <Core/PerfStats.h>
+#include <Core/Snapshot.h>
 #include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
@@ -58,6 +61,19 @@ public:
         RecordedEvent const & event,
         SimulationParameters const & simulationParameters);
 
+    /*
+     * Takes a binary snapshot of the dynamic state of the world - simulation time, random
+     * engine, ocean surface, and ships - which may later be restored onto this world, or
+     * onto a new world with the same ships loaded in the same order, making the simulation
+     * continue exactly from where the snapshot was taken.
+     *
+     * Wind, storm, clouds, fishes, and NPCs are not part of snapshots; see Ship::SaveSnapshot()
+     * for what is not captured of ships.
+     */
+    Snapshot TakeSnapshot() const;
+
+    void RestoreSnapshot(Snapshot const & snapshot);
+
     float GetCurrentSimulationTime() const
     {
         return mCurrentSimulationTime;
@@ -67,6 +83,16 @@ public:
 
     size_t GetShipPointCount(ShipId shipId) const;
 
+    void ReportShipMemory(
+        ShipId shipId,
+        MemoryReport & report) const;
+
+    void SetShipInteriorTextureImage(
+        ShipId shipId,
+        RgbaImageData && interiorTextureImage);
+
+    std::vector<ShipSpringRelaxationState> GetShipSpringRelaxationStates() const;
+
     size_t GetAllShipSpringCount() const;
 
     size_t GetAllShipTriangleCount() const;
@@ -94,6 +120,14 @@ public:
         return *mNpcs;
     }
 
+    /*
+     * Scratch memory for the current simulation step, reset at the end of each Update.
+     */
+    FrameArena & GetFrameArena()
+    {
+        return mFrameArena;
+    }
+
     inline void DisturbOceanAt(
         vec2f const & position,
         float fishScareRadius,
@@ -174,27 +208,31 @@ public:
         GlobalConnectedComponentId connectedComponentId,
         vec2f const & moveOffset,
         vec2f const & inertialVelocity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void MoveBy(
         ShipId shipId,
         vec2f const & moveOffset,
         vec2f const & inertialVelocity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void RotateBy(
         GlobalConnectedComponentId connectedComponentId,
         float angle,
         vec2f const & center,
         float inertialAngle,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void RotateBy(
         ShipId shipId,
         float angle,
         vec2f const & center,
         float inertialAngle,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void MoveGrippedBy(
         std::vector<GrippedMoveParameters> const & movesWorld,
@@ -498,12 +536,35 @@ public:
         ThreadManager & threadManager,
         PerfStats & perfStats);
 
+    /*
+     * The render interpolation factor is the fraction of the last simulation step at which
+     * ship points are rendered; 1.0 unless rendering is interpolated.
+     */
     void RenderUpload(
         SimulationParameters const & simulationParameters,
-        RenderContext & renderContext);
+        RenderContext & renderContext,
+        float renderInterpolationFactor,
+        PerfStats & perfStats);
 
 private:
 
+    void RecalculateShipUpdateParallelism(
+        size_t simulationParallelism,
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+    void UpdateShipMechanics(
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+    void UpdateShipCollisions(SimulationParameters const & simulationParameters);
+
+private:
+
+    // Ships with at most these many points are candidates for ship-level parallelism,
+    // i.e. for being updated at the same time as other ships, each on a single thread
+    static ElementCount constexpr ShipLevelParallelismMaxPointCount = 20000;
+
     // The current simulation time
     float mCurrentSimulationTime;
 
@@ -527,6 +588,56 @@ private:
     // The set of all ships' external AABB's in the world, updated at each
     // simulation cycle and at each ship addition
     Geometry::ShipAABBSet mAllShipExternalAABBs;
+
+    // The ID of the ship of each of the AABBs above
+    std::vector<ShipId> mAllShipExternalAABBShipIds;
+
+    // Scratch space for ship-to-ship collisions: the regions where two ships' AABBs
+    // intersect, and the regions of one pair of ships at a time
+    struct ShipCollisionRegion
+    {
+        ShipId ShipId1; // Lower
+        ShipId ShipId2;
+        Geometry::AABB Region;
+
+        ShipCollisionRegion(
+            ShipId shipId1,
+            ShipId shipId2,
+            Geometry::AABB const & region)
+            : ShipId1(shipId1)
+            , ShipId2(shipId2)
+            , Region(region)
+        {}
+    };
+
+    std::vector<ShipCollisionRegion> mShipCollisionRegions;
+    std::vector<Geometry::AABB> mShipCollisionPairRegions;
+
+    // Scratch memory for the current simulation step
+    FrameArena mFrameArena;
+
+    // The tasks updating the environment concurrently; only kept here to reuse their storage
+    std::vector<ThreadPool::Task> mEnvironmentUpdateTasks;
+
+    //
+    // Ship update parallelism
+    //
+
+    // The spring relaxation parallelism assigned to each ship, indexed by ship ID
+    std::vector<size_t> mShipSpringRelaxationParallelisms;
+
+    // The ships whose mechanics are updated one after the other, each using
+    // the whole thread pool
+    std::vector<Ship *> mIntraShipParallelismShips;
+
+    // The ships whose mechanics are updated concurrently with other ships, grouped
+    // in as many buckets as there are tasks; each bucket is run by one task
+    std::vector<std::vector<Ship *>> mShipLevelParallelismBuckets;
+    std::vector<ThreadPool::Task> mShipLevelParallelismTasks;
+
+    // The parameters that we've last calculated the above with; used to detect changes
+    size_t mCurrentShipUpdateParallelismShipCount;
+    size_t mCurrentShipUpdateParallelismSimulationParallelism;
 };
 
 }
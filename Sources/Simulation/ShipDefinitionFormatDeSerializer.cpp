@@ -16,9 +16,14 @@
 #include <Core/UserGameException.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <utility>
 
 namespace {
@@ -27,14 +32,46 @@ unsigned char const HeaderTitle[] = "FLOATING SANDBOX SHIP\x1a\x00\x00";
 
 uint8_t constexpr CurrentFileFormatVersion = 1;
 
+// Max number of threads encoding sections concurrently
+size_t constexpr MaxSectionEncodeWorkers = 4;
+
 }
 
 ShipDefinition ShipDefinitionFormatDeSerializer::Load(
     BinaryReadStream & shipDefinitionInputStream,
     MaterialDatabase const & materialDatabase)
+{
+    return InternalLoad(
+        shipDefinitionInputStream,
+        materialDatabase,
+        nullptr);
+}
+
+ShipDefinition ShipDefinitionFormatDeSerializer::Load(
+    BinaryReadStream & shipDefinitionInputStream,
+    MaterialDatabase const & materialDatabase,
+    ThreadManager & threadManager)
+{
+    return InternalLoad(
+        shipDefinitionInputStream,
+        materialDatabase,
+        &(threadManager.GetSimulationThreadPool()));
+}
+
+ShipDefinition ShipDefinitionFormatDeSerializer::InternalLoad(
+    BinaryReadStream & shipDefinitionInputStream,
+    MaterialDatabase const & materialDatabase,
+    ThreadPool * threadPool)
 {
     DeSerializationBuffer<BigEndianess> buffer(256);
 
+    // Layer sections are independent of each other: we only gather them while
+    // parsing, and decode them all at the end
+    std::optional<DeSerializationBuffer<BigEndianess>> structuralLayerBuffer;
+    std::optional<DeSerializationBuffer<BigEndianess>> electricalLayerBuffer;
+    std::optional<DeSerializationBuffer<BigEndianess>> ropesLayerBuffer;
+    std::optional<DeSerializationBuffer<BigEndianess>> textureLayerBuffer;
+
     //
     // Read and process sections
     //
@@ -95,12 +132,8 @@ ShipDefinition ShipDefinitionFormatDeSerializer::Load(
                         throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
                     }
 
-                    ReadIntoBuffer(inputStream, buffer, sectionHeader.SectionBodySize);
-                    ReadStructuralLayer(
-                        buffer,
-                        *shipAttributes,
-                        materialDatabase.GetStructuralMaterialColorMap(),
-                        structuralLayer);
+                    structuralLayerBuffer.emplace(sectionHeader.SectionBodySize);
+                    ReadIntoBuffer(inputStream, *structuralLayerBuffer, sectionHeader.SectionBodySize);
 
                     break;
                 }
@@ -113,12 +146,8 @@ ShipDefinition ShipDefinitionFormatDeSerializer::Load(
                         throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
                     }
 
-                    ReadIntoBuffer(inputStream, buffer, sectionHeader.SectionBodySize);
-                    ReadElectricalLayer(
-                        buffer,
-                        *shipAttributes,
-                        materialDatabase.GetElectricalMaterialColorMap(),
-                        electricalLayer);
+                    electricalLayerBuffer.emplace(sectionHeader.SectionBodySize);
+                    ReadIntoBuffer(inputStream, *electricalLayerBuffer, sectionHeader.SectionBodySize);
 
                     break;
                 }
@@ -131,22 +160,16 @@ ShipDefinition ShipDefinitionFormatDeSerializer::Load(
                         throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
                     }
 
-                    ReadIntoBuffer(inputStream, buffer, sectionHeader.SectionBodySize);
-                    ReadRopesLayer(
-                        buffer,
-                        *shipAttributes,
-                        materialDatabase.GetStructuralMaterialColorMap(),
-                        ropesLayer);
+                    ropesLayerBuffer.emplace(sectionHeader.SectionBodySize);
+                    ReadIntoBuffer(inputStream, *ropesLayerBuffer, sectionHeader.SectionBodySize);
 
                     break;
                 }
 
                 case static_cast<uint32_t>(MainSectionTagType::TextureLayer_PNG) :
                 {
-                    RgbaImageData image = ReadPngImage(inputStream, sectionHeader.SectionBodySize);
-
-                    // Make texture out of this image
-                    textureLayer = std::make_unique<TextureLayerData>(std::move(image));
+                    textureLayerBuffer.emplace(sectionHeader.SectionBodySize);
+                    ReadIntoBuffer(inputStream, *textureLayerBuffer, sectionHeader.SectionBodySize);
 
                     break;
                 }
@@ -159,6 +182,7 @@ ShipDefinition ShipDefinitionFormatDeSerializer::Load(
                 }
 
                 case static_cast<uint32_t>(MainSectionTagType::Preview_PNG) :
+                case static_cast<uint32_t>(MainSectionTagType::SectionIndex) :
                 {
                     // Ignore and skip section
                     size_t const szSkipped = inputStream.Skip(sectionHeader.SectionBodySize);
@@ -190,6 +214,68 @@ ShipDefinition ShipDefinitionFormatDeSerializer::Load(
             return false;
         });
 
+    //
+    // Decode layers
+    //
+
+    std::vector<ThreadPool::Task> layerDecoders;
+
+    // The texture goes first, being the longest to decode, so that it doesn't
+    // end up last on the calling thread
+    if (textureLayerBuffer.has_value())
+    {
+        layerDecoders.emplace_back(
+            [&]()
+            {
+                MemoryViewBinaryReadStream pngStream(textureLayerBuffer->GetData(), textureLayerBuffer->GetSize());
+                RgbaImageData image = ReadPngImage(pngStream, textureLayerBuffer->GetSize());
+
+                // Make texture out of this image
+                textureLayer = std::make_unique<TextureLayerData>(std::move(image));
+            });
+    }
+
+    if (structuralLayerBuffer.has_value())
+    {
+        layerDecoders.emplace_back(
+            [&]()
+            {
+                ReadStructuralLayer(
+                    *structuralLayerBuffer,
+                    *shipAttributes,
+                    materialDatabase.GetStructuralMaterialColorMap(),
+                    structuralLayer);
+            });
+    }
+
+    if (electricalLayerBuffer.has_value())
+    {
+        layerDecoders.emplace_back(
+            [&]()
+            {
+                ReadElectricalLayer(
+                    *electricalLayerBuffer,
+                    *shipAttributes,
+                    materialDatabase.GetElectricalMaterialColorMap(),
+                    electricalLayer);
+            });
+    }
+
+    if (ropesLayerBuffer.has_value())
+    {
+        layerDecoders.emplace_back(
+            [&]()
+            {
+                ReadRopesLayer(
+                    *ropesLayerBuffer,
+                    *shipAttributes,
+                    materialDatabase.GetStructuralMaterialColorMap(),
+                    ropesLayer);
+            });
+    }
+
+    RunLayerDecoders(layerDecoders, threadPool);
+
     //
     // Ensure all the required sections have been seen
     //
@@ -223,8 +309,9 @@ ShipPreviewData ShipDefinitionFormatDeSerializer::LoadPreviewData(BinaryReadStre
     std::optional<ShipAttributes> shipAttributes;
     std::optional<ShipMetadata> shipMetadata;
 
-    Parse(
+    ParseIndexed(
         shipDefinitionInputStream,
+        { MainSectionTagType::ShipAttributes, MainSectionTagType::Metadata },
         [&](SectionHeader const & sectionHeader, BinaryReadStream & inputStream) -> bool
         {
             switch (sectionHeader.Tag)
@@ -288,8 +375,9 @@ RgbaImageData ShipDefinitionFormatDeSerializer::LoadPreviewImage(
 
     std::optional<RgbaImageData> previewImage;
 
-    Parse(
+    ParseIndexed(
         shipDefinitionInputStream,
+        { MainSectionTagType::TextureLayer_PNG, MainSectionTagType::Preview_PNG },
         [&](SectionHeader const & sectionHeader, BinaryReadStream & inputStream) -> bool
         {
             switch (sectionHeader.Tag)
@@ -341,16 +429,27 @@ void ShipDefinitionFormatDeSerializer::Save(
     Version const & currentGameVersion,
     BinaryWriteStream & shipDefinitionOutputStream)
 {
-    DeSerializationBuffer<BigEndianess> buffer(256);
+    Save(
+        shipDefinition,
+        currentGameVersion,
+        shipDefinitionOutputStream,
+        SimpleProgressCallback::Dummy());
+}
 
+void ShipDefinitionFormatDeSerializer::Save(
+    ShipDefinition const & shipDefinition,
+    Version const & currentGameVersion,
+    BinaryWriteStream & shipDefinitionOutputStream,
+    SimpleProgressCallback const & progressCallback)
+{
     //
-    // Write header
+    // Prepare the encoders of the sections, in file order
     //
 
-    AppendFileHeader(shipDefinitionOutputStream, buffer);
+    std::vector<std::pair<MainSectionTagType, SectionBodyEncoder>> sectionEncoders;
 
     //
-    // Write ship attributes
+    // Ship attributes
     //
 
     ShipAttributes const shipAttributes = ShipAttributes(
@@ -359,45 +458,37 @@ void ShipDefinitionFormatDeSerializer::Save(
         (bool)shipDefinition.Layers.ExteriorTextureLayer,
         (bool)shipDefinition.Layers.ElectricalLayer);
 
-    AppendSection(
-        shipDefinitionOutputStream,
-        static_cast<std::uint32_t>(MainSectionTagType::ShipAttributes),
-        [&]() { return AppendShipAttributes(shipAttributes, buffer); },
-        buffer);
+    sectionEncoders.emplace_back(
+        MainSectionTagType::ShipAttributes,
+        [&](auto & buffer) { return AppendShipAttributes(shipAttributes, buffer); });
 
     //
-    // Write metadata
+    // Metadata
     //
 
-    AppendSection(
-        shipDefinitionOutputStream,
-        static_cast<std::uint32_t>(MainSectionTagType::Metadata),
-        [&]() { return AppendMetadata(shipDefinition.Metadata, buffer); },
-        buffer);
+    sectionEncoders.emplace_back(
+        MainSectionTagType::Metadata,
+        [&](auto & buffer) { return AppendMetadata(shipDefinition.Metadata, buffer); });
 
     if (shipDefinition.Layers.ExteriorTextureLayer)
     {
         //
-        // Write texture
+        // Texture
         //
 
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::TextureLayer_PNG),
-            [&]() { return AppendPngImage(shipDefinition.Layers.ExteriorTextureLayer->Buffer, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::TextureLayer_PNG,
+            [&](auto & buffer) { return AppendPngImage(shipDefinition.Layers.ExteriorTextureLayer->Buffer, buffer); });
     }
     else if (shipDefinition.Layers.StructuralLayer)
     {
         //
-        // Make and write a preview image
+        // Make a preview image
         //
 
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::Preview_PNG),
-            [&]() { return AppendPngPreview(*shipDefinition.Layers.StructuralLayer, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::Preview_PNG,
+            [&](auto & buffer) { return AppendPngPreview(*shipDefinition.Layers.StructuralLayer, buffer); });
     }
     else
     {
@@ -405,76 +496,112 @@ void ShipDefinitionFormatDeSerializer::Save(
     }
 
     //
-    // Write structural layer
+    // Structural layer
     //
 
     if (shipDefinition.Layers.StructuralLayer)
     {
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::StructuralLayer),
-            [&]() { return AppendStructuralLayer(*shipDefinition.Layers.StructuralLayer, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::StructuralLayer,
+            [&](auto & buffer) { return AppendStructuralLayer(*shipDefinition.Layers.StructuralLayer, buffer); });
     }
 
     //
-    // Write electrical layer
+    // Electrical layer
     //
 
     if (shipDefinition.Layers.ElectricalLayer)
     {
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::ElectricalLayer),
-            [&]() { return AppendElectricalLayer(*shipDefinition.Layers.ElectricalLayer, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::ElectricalLayer,
+            [&](auto & buffer) { return AppendElectricalLayer(*shipDefinition.Layers.ElectricalLayer, buffer); });
     }
 
     //
-    // Write ropes layer
+    // Ropes layer
     //
 
     if (shipDefinition.Layers.RopesLayer)
     {
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::RopesLayer),
-            [&]() { return AppendRopesLayer(*shipDefinition.Layers.RopesLayer, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::RopesLayer,
+            [&](auto & buffer) { return AppendRopesLayer(*shipDefinition.Layers.RopesLayer, buffer); });
     }
 
     //
-    // Write physics data
+    // Physics data
     //
 
-    AppendSection(
-        shipDefinitionOutputStream,
-        static_cast<std::uint32_t>(MainSectionTagType::PhysicsData),
-        [&]() { return AppendPhysicsData(shipDefinition.PhysicsData, buffer); },
-        buffer);
+    sectionEncoders.emplace_back(
+        MainSectionTagType::PhysicsData,
+        [&](auto & buffer) { return AppendPhysicsData(shipDefinition.PhysicsData, buffer); });
 
     //
-    // Write auto-texturization settings
+    // Auto-texturization settings
     //
 
     if (shipDefinition.AutoTexturizationSettings.has_value())
     {
-        AppendSection(
-            shipDefinitionOutputStream,
-            static_cast<std::uint32_t>(MainSectionTagType::AutoTexturizationSettings),
-            [&]() { return AppendAutoTexturizationSettings(*shipDefinition.AutoTexturizationSettings, buffer); },
-            buffer);
+        sectionEncoders.emplace_back(
+            MainSectionTagType::AutoTexturizationSettings,
+            [&](auto & buffer) { return AppendAutoTexturizationSettings(*shipDefinition.AutoTexturizationSettings, buffer); });
+    }
+
+    //
+    // Encode sections
+    //
+
+    auto const sectionBuffers = EncodeSections(
+        sectionEncoders,
+        progressCallback.MakeSubCallback(0.0f, 0.95f));
+
+    DeSerializationBuffer<BigEndianess> buffer(256);
+
+    //
+    // Write header
+    //
+
+    AppendFileHeader(shipDefinitionOutputStream, buffer);
+
+    //
+    // Write sections, keeping track of their offsets
+    //
+
+    SectionIndex sectionIndex;
+    size_t writeOffset = sizeof(FileHeader);
+
+    for (size_t s = 0; s < sectionEncoders.size(); ++s)
+    {
+        sectionIndex.emplace_back(static_cast<std::uint32_t>(sectionEncoders[s].first), static_cast<std::uint32_t>(writeOffset));
+
+        shipDefinitionOutputStream.Write(sectionBuffers[s].GetData(), sectionBuffers[s].GetSize());
+        writeOffset += sectionBuffers[s].GetSize();
     }
 
     //
-    // Write tail
+    // Write section index
+    //
+
+    size_t const sectionIndexOffset = writeOffset;
+
+    AppendSection(
+        shipDefinitionOutputStream,
+        static_cast<std::uint32_t>(MainSectionTagType::SectionIndex),
+        [&]() { return AppendSectionIndex(sectionIndex, buffer); },
+        buffer);
+
+    //
+    // Write tail, which points to the section index - being at the end of the file,
+    // it's at a known position
     //
 
     AppendSection(
         shipDefinitionOutputStream,
         static_cast<std::uint32_t>(MainSectionTagType::Tail),
-        [&]() { return 0; },
+        [&]() { return buffer.Append(static_cast<std::uint32_t>(sectionIndexOffset)); },
         buffer);
+
+    progressCallback(1.0f);
 }
 
 PasswordHash ShipDefinitionFormatDeSerializer::CalculatePasswordHash(std::string const & password)
@@ -486,9 +613,82 @@ PasswordHash ShipDefinitionFormatDeSerializer::CalculatePasswordHash(std::string
 
 // Write
 
+std::vector<DeSerializationBuffer<BigEndianess>> ShipDefinitionFormatDeSerializer::EncodeSections(
+    std::vector<std::pair<MainSectionTagType, SectionBodyEncoder>> const & sectionEncoders,
+    SimpleProgressCallback const & progressCallback)
+{
+    std::vector<DeSerializationBuffer<BigEndianess>> sectionBuffers;
+    sectionBuffers.reserve(sectionEncoders.size());
+    for (size_t s = 0; s < sectionEncoders.size(); ++s)
+    {
+        sectionBuffers.emplace_back(256);
+    }
+
+    //
+    // Encode them with a few workers - this thread being one of them
+    //
+
+    std::vector<std::exception_ptr> encodeExceptions(sectionEncoders.size());
+    std::atomic<size_t> nextSectionIndex(0);
+
+    size_t encodedSectionCount = 0;
+    std::mutex progressLock;
+
+    auto const runWorker = [&]()
+    {
+        for (size_t s = nextSectionIndex++; s < sectionEncoders.size(); s = nextSectionIndex++)
+        {
+            try
+            {
+                auto & sectionBuffer = sectionBuffers[s];
+
+                EncodeSection(
+                    static_cast<std::uint32_t>(sectionEncoders[s].first),
+                    [&]() { return sectionEncoders[s].second(sectionBuffer); },
+                    sectionBuffer);
+            }
+            catch (...)
+            {
+                encodeExceptions[s] = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> const lock(progressLock);
+
+                ++encodedSectionCount;
+                progressCallback(static_cast<float>(encodedSectionCount) / static_cast<float>(sectionEncoders.size()));
+            }
+        }
+    };
+
+    size_t const workerCount = std::min({ MaxSectionEncodeWorkers, ThreadManager::GetNumberOfProcessors(), sectionEncoders.size() });
+
+    std::vector<std::thread> workerThreads;
+    for (size_t w = 1; w < workerCount; ++w)
+    {
+        workerThreads.emplace_back(runWorker);
+    }
+
+    runWorker();
+
+    for (auto & workerThread : workerThreads)
+    {
+        workerThread.join();
+    }
+
+    for (auto const & encodeException : encodeExceptions)
+    {
+        if (encodeException)
+        {
+            std::rethrow_exception(encodeException);
+        }
+    }
+
+    return sectionBuffers;
+}
+
 template<typename TSectionBodyAppender>
-void ShipDefinitionFormatDeSerializer::AppendSection(
-    BinaryWriteStream & shipDefinitionOutputStream,
+void ShipDefinitionFormatDeSerializer::EncodeSection(
     std::uint32_t tag,
     TSectionBodyAppender const & sectionBodyAppender,
     DeSerializationBuffer<BigEndianess> & buffer)
@@ -506,23 +706,34 @@ void ShipDefinitionFormatDeSerializer::AppendSection(
 
     // SectionBodySize, again
     buffer.WriteAt(static_cast<std::uint32_t>(sectionBodySize), sectionBodySizeIndex);
+}
+
+template<typename TSectionBodyAppender>
+size_t ShipDefinitionFormatDeSerializer::AppendSection(
+    BinaryWriteStream & shipDefinitionOutputStream,
+    std::uint32_t tag,
+    TSectionBodyAppender const & sectionBodyAppender,
+    DeSerializationBuffer<BigEndianess> & buffer)
+{
+    EncodeSection(tag, sectionBodyAppender, buffer);
 
     // Serialize
     shipDefinitionOutputStream.Write(buffer.GetData(), buffer.GetSize());
+
+    return buffer.GetSize();
 }
 
 size_t ShipDefinitionFormatDeSerializer::AppendPngImage(
     RgbaImageData const & rawImageData,
     DeSerializationBuffer<BigEndianess> & buffer)
 {
-    auto encodedImageOutputStream = MemoryBinaryWriteStream();
-    PngTools::EncodeImage(rawImageData, encodedImageOutputStream);
+    // Encode straight into the buffer
+    size_t const startSize = buffer.GetSize();
 
-    size_t const byteSize = encodedImageOutputStream.GetSize();
-    void * targetBuf = reinterpret_cast<void *>(buffer.Receive(byteSize));
-    std::memcpy(targetBuf, encodedImageOutputStream.GetData(), byteSize);
+    auto encodedImageOutputStream = DeSerializationBufferWriteStream<BigEndianess>(buffer);
+    PngTools::EncodeImage(rawImageData, encodedImageOutputStream);
 
-    return byteSize;
+    return buffer.GetSize() - startSize;
 }
 
 void ShipDefinitionFormatDeSerializer::AppendFileHeader(
@@ -556,6 +767,23 @@ void ShipDefinitionFormatDeSerializer::AppendFileHeader(DeSerializationBuffer<Bi
     assert(buffer.GetSize() == sizeof(FileHeader));
 }
 
+size_t ShipDefinitionFormatDeSerializer::AppendSectionIndex(
+    SectionIndex const & sectionIndex,
+    DeSerializationBuffer<BigEndianess> & buffer)
+{
+    size_t sectionBodySize = 0;
+
+    sectionBodySize += buffer.Append(static_cast<std::uint32_t>(sectionIndex.size()));
+
+    for (auto const & entry : sectionIndex)
+    {
+        sectionBodySize += buffer.Append(entry.first);
+        sectionBodySize += buffer.Append(entry.second);
+    }
+
+    return sectionBodySize;
+}
+
 size_t ShipDefinitionFormatDeSerializer::AppendShipAttributes(
     ShipAttributes const & shipAttributes,
     DeSerializationBuffer<BigEndianess> & buffer)
@@ -904,14 +1132,13 @@ size_t ShipDefinitionFormatDeSerializer::AppendStructuralLayerBuffer(
     Buffer2D<StructuralElement, struct ShipSpaceTag> const & structuralLayerBuffer,
     DeSerializationBuffer<BigEndianess> & buffer)
 {
-    size_t subSectionBodySize = 0;
-
     //
-    // Encode layer with RLE of RGB color key buffer
+    // Encode layer with RLE of RGB color key buffer, straight into the buffer
     //
 
+    size_t const startSize = buffer.GetSize();
+
     size_t const layerLinearSize = structuralLayerBuffer.Size.GetLinearSize();
-    DeSerializationBuffer<BigEndianess> rleBuffer(layerLinearSize * sizeof(MaterialColorKey)); // Upper bound
 
     StructuralElement const * structuralElementBuffer = structuralLayerBuffer.Data.get();
     for (size_t i = 0; i < layerLinearSize; /*incremented in loop*/)
@@ -929,22 +1156,14 @@ size_t ShipDefinitionFormatDeSerializer::AppendStructuralLayerBuffer(
             ++i, ++materialCount);
 
         // Serialize count
-        rleBuffer.Append<var_uint16_t>(var_uint16_t(materialCount));
+        buffer.Append<var_uint16_t>(var_uint16_t(materialCount));
 
         // Serialize RGB color key
         MaterialColorKey const colorKey = (structuralElement.Material == nullptr) ? EmptyMaterialColorKey : structuralElement.Material->ColorKey;
-        rleBuffer.Append(reinterpret_cast<unsigned char const *>(&colorKey), sizeof(MaterialColorKey));
+        buffer.Append(reinterpret_cast<unsigned char const *>(&colorKey), sizeof(MaterialColorKey));
     }
 
-    //
-    // Serialize RLE buffer
-    //
-
-    subSectionBodySize += buffer.Append(
-        rleBuffer.GetData(),
-        rleBuffer.GetSize());
-
-    return subSectionBodySize;
+    return buffer.GetSize() - startSize;
 }
 
 size_t ShipDefinitionFormatDeSerializer::AppendElectricalLayer(
@@ -1015,14 +1234,13 @@ size_t ShipDefinitionFormatDeSerializer::AppendElectricalLayerBuffer(
     Buffer2D<ElectricalElement, struct ShipSpaceTag> const & electricalLayerBuffer,
     DeSerializationBuffer<BigEndianess> & buffer)
 {
-    size_t subSectionBodySize = 0;
-
     //
-    // Encode layer with RLE of <RGB color key, instance ID> buffer
+    // Encode layer with RLE of <RGB color key, instance ID> buffer, straight into the buffer
     //
 
+    size_t const startSize = buffer.GetSize();
+
     size_t const layerLinearSize = electricalLayerBuffer.Size.GetLinearSize();
-    DeSerializationBuffer<BigEndianess> rleBuffer(layerLinearSize * (sizeof(MaterialColorKey) + sizeof(std::uint16_t))); // Upper bound
 
     ElectricalElement const * electricalElementBuffer = electricalLayerBuffer.Data.get();
     for (size_t i = 0; i < layerLinearSize; /*incremented in loop*/)
@@ -1040,30 +1258,22 @@ size_t ShipDefinitionFormatDeSerializer::AppendElectricalLayerBuffer(
             ++i, ++materialCount);
 
         // Serialize count
-        rleBuffer.Append<var_uint16_t>(var_uint16_t(materialCount));
+        buffer.Append<var_uint16_t>(var_uint16_t(materialCount));
 
         // Serialize RGB key
         MaterialColorKey const colorKey = (electricalElement.Material == nullptr) ? EmptyMaterialColorKey : electricalElement.Material->ColorKey;
-        rleBuffer.Append(reinterpret_cast<unsigned char const *>(&colorKey), sizeof(MaterialColorKey));
+        buffer.Append(reinterpret_cast<unsigned char const *>(&colorKey), sizeof(MaterialColorKey));
 
         // Serialize instance index - only if instanced
         if (electricalElement.Material != nullptr
             && electricalElement.Material->IsInstanced)
         {
             static_assert(sizeof(ElectricalElementInstanceIndex) <= sizeof(std::uint16_t));
-            rleBuffer.Append<var_uint16_t>(var_uint16_t(electricalElement.InstanceIndex));
+            buffer.Append<var_uint16_t>(var_uint16_t(electricalElement.InstanceIndex));
         }
     }
 
-    //
-    // Serialize RLE buffer
-    //
-
-    subSectionBodySize += buffer.Append(
-        rleBuffer.GetData(),
-        rleBuffer.GetSize());
-
-    return subSectionBodySize;
+    return buffer.GetSize() - startSize;
 }
 
 size_t ShipDefinitionFormatDeSerializer::AppendElectricalLayerPanel(
@@ -1316,6 +1526,173 @@ void ShipDefinitionFormatDeSerializer::Parse(
     }
 }
 
+template<typename SectionHandler>
+void ShipDefinitionFormatDeSerializer::ParseIndexed(
+    BinaryReadStream & shipDefinitionInputStream,
+    std::vector<MainSectionTagType> const & tags,
+    SectionHandler const & sectionHandler)
+{
+    DeSerializationBuffer<BigEndianess> buffer(256);
+
+    ReadFileHeader(shipDefinitionInputStream, buffer);
+
+    std::optional<SectionIndex> const sectionIndex = TryReadSectionIndex(shipDefinitionInputStream, buffer);
+    if (!sectionIndex.has_value())
+    {
+        // Older file, parse it all
+        shipDefinitionInputStream.SetPosition(0);
+        Parse(shipDefinitionInputStream, sectionHandler);
+        return;
+    }
+
+    for (MainSectionTagType const tag : tags)
+    {
+        for (auto const & entry : *sectionIndex)
+        {
+            if (entry.first == static_cast<std::uint32_t>(tag))
+            {
+                shipDefinitionInputStream.SetPosition(entry.second);
+
+                SectionHeader const sectionHeader = ReadSectionHeader(shipDefinitionInputStream, buffer);
+                if (sectionHeader.Tag != entry.first)
+                {
+                    throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
+                }
+
+                if (sectionHandler(sectionHeader, shipDefinitionInputStream))
+                {
+                    // We're done
+                    return;
+                }
+            }
+        }
+    }
+}
+
+std::optional<ShipDefinitionFormatDeSerializer::SectionIndex> ShipDefinitionFormatDeSerializer::TryReadSectionIndex(
+    BinaryReadStream & shipDefinitionInputStream,
+    DeSerializationBuffer<BigEndianess> & buffer)
+{
+    //
+    // The tail - at the end of the file - tells where the index is; files
+    // from before the index have an empty tail
+    //
+
+    size_t const fileSize = shipDefinitionInputStream.GetSize();
+    size_t constexpr TailSize = sizeof(SectionHeader) + sizeof(std::uint32_t);
+    if (fileSize < sizeof(FileHeader) + TailSize)
+    {
+        return std::nullopt;
+    }
+
+    shipDefinitionInputStream.SetPosition(fileSize - TailSize);
+    SectionHeader const tailHeader = ReadSectionHeader(shipDefinitionInputStream, buffer);
+    if (tailHeader.Tag != static_cast<std::uint32_t>(MainSectionTagType::Tail)
+        || tailHeader.SectionBodySize != sizeof(std::uint32_t))
+    {
+        return std::nullopt;
+    }
+
+    ReadIntoBuffer(shipDefinitionInputStream, buffer, sizeof(std::uint32_t));
+    std::uint32_t sectionIndexOffset;
+    buffer.ReadAt<std::uint32_t>(0, sectionIndexOffset);
+
+    if (sectionIndexOffset < sizeof(FileHeader)
+        || sectionIndexOffset + sizeof(SectionHeader) > fileSize - TailSize)
+    {
+        throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
+    }
+
+    //
+    // Read index
+    //
+
+    shipDefinitionInputStream.SetPosition(sectionIndexOffset);
+    SectionHeader const sectionIndexHeader = ReadSectionHeader(shipDefinitionInputStream, buffer);
+    if (sectionIndexHeader.Tag != static_cast<std::uint32_t>(MainSectionTagType::SectionIndex)
+        || sectionIndexHeader.SectionBodySize < sizeof(std::uint32_t))
+    {
+        throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
+    }
+
+    ReadIntoBuffer(shipDefinitionInputStream, buffer, sectionIndexHeader.SectionBodySize);
+
+    size_t readOffset = 0;
+
+    std::uint32_t entryCount;
+    readOffset += buffer.ReadAt<std::uint32_t>(readOffset, entryCount);
+
+    if (sectionIndexHeader.SectionBodySize != sizeof(std::uint32_t) + static_cast<size_t>(entryCount) * 2 * sizeof(std::uint32_t))
+    {
+        throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
+    }
+
+    SectionIndex sectionIndex;
+    sectionIndex.reserve(entryCount);
+    for (std::uint32_t e = 0; e < entryCount; ++e)
+    {
+        std::uint32_t tag;
+        readOffset += buffer.ReadAt<std::uint32_t>(readOffset, tag);
+        std::uint32_t offset;
+        readOffset += buffer.ReadAt<std::uint32_t>(readOffset, offset);
+
+        if (offset + sizeof(SectionHeader) > sectionIndexOffset)
+        {
+            throw UserGameException(UserGameException::MessageIdType::InvalidShipFile);
+        }
+
+        sectionIndex.emplace_back(tag, offset);
+    }
+
+    return sectionIndex;
+}
+
+void ShipDefinitionFormatDeSerializer::RunLayerDecoders(
+    std::vector<ThreadPool::Task> const & layerDecoders,
+    ThreadPool * threadPool)
+{
+    if (threadPool == nullptr || layerDecoders.size() <= 1)
+    {
+        for (auto const & layerDecoder : layerDecoders)
+        {
+            layerDecoder();
+        }
+
+        return;
+    }
+
+    // The thread pool swallows exceptions, hence we ferry them back ourselves
+    std::vector<std::exception_ptr> exceptions(layerDecoders.size());
+
+    std::vector<ThreadPool::Task> tasks;
+    tasks.reserve(layerDecoders.size());
+    for (size_t i = 0; i < layerDecoders.size(); ++i)
+    {
+        tasks.emplace_back(
+            [&layerDecoders, &exceptions, i]()
+            {
+                try
+                {
+                    layerDecoders[i]();
+                }
+                catch (...)
+                {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+    }
+
+    threadPool->Run(tasks);
+
+    for (auto const & exception : exceptions)
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 void ShipDefinitionFormatDeSerializer::ThrowMaterialNotFound(ShipAttributes const & shipAttributes)
 {
     throw UserGameException(
@@ -1330,6 +1707,14 @@ void ShipDefinitionFormatDeSerializer::ReadIntoBuffer(
 {
     buffer.Reset();
 
+    // Parse in-place when the stream's content is already in memory
+    if (std::uint8_t const * const data = shipDefinitionInputStream.ReadInPlace(size);
+        data != nullptr)
+    {
+        buffer.Borrow(data, size);
+        return;
+    }
+
     size_t const szRead = shipDefinitionInputStream.Read(buffer.Receive(size), size);
     if (szRead != size)
     {
@@ -1805,36 +2190,51 @@ void ShipDefinitionFormatDeSerializer::ReadStructuralLayer(
         {
             case static_cast<uint32_t>(StructuralLayerTagType::Buffer) :
             {
-                // Decode RLE buffer
+                // Decode RLE buffer - straight from the buffer's data, as none of its
+                // values is endian-dependent
+                assert(readOffset + sectionHeader.SectionBodySize <= buffer.GetSize());
+                unsigned char const * const rleData = buffer.GetData() + readOffset;
+
+                // Runs tend to alternate among few materials, hence we remember the last lookup
+                MaterialColorKey lastColorKey = EmptyMaterialColorKey;
+                StructuralMaterial const * lastMaterial = nullptr;
+
                 size_t writeOffset = 0;
                 StructuralElement * structuralLayerWrite = structuralLayer->Buffer.Data.get();
                 for (size_t bufferReadOffset = 0; bufferReadOffset < sectionHeader.SectionBodySize; /*incremented in loop*/)
                 {
                     // Deserialize count
                     var_uint16_t count;
-                    bufferReadOffset += buffer.ReadAt(readOffset + bufferReadOffset, count);
+                    bufferReadOffset += BigEndian<var_uint16_t>::Read(rleData + bufferReadOffset, count);
 
                     // Deserialize colorKey value
                     MaterialColorKey colorKey;
-                    bufferReadOffset += buffer.ReadAt(readOffset + bufferReadOffset, reinterpret_cast<unsigned char *>(&colorKey), sizeof(colorKey));
+                    std::memcpy(&colorKey, rleData + bufferReadOffset, sizeof(colorKey));
+                    bufferReadOffset += sizeof(colorKey);
 
                     // Lookup material
-                    StructuralMaterial const * material;
-                    if (colorKey == EmptyMaterialColorKey)
+                    if (colorKey != lastColorKey)
                     {
-                        material = nullptr;
-                    }
-                    else
-                    {
-                        auto const materialIt = materialColorMap.find(colorKey);
-                        if (materialIt == materialColorMap.cend())
+                        if (colorKey == EmptyMaterialColorKey)
                         {
-                            ThrowMaterialNotFound(shipAttributes);
+                            lastMaterial = nullptr;
                         }
+                        else
+                        {
+                            auto const materialIt = materialColorMap.find(colorKey);
+                            if (materialIt == materialColorMap.cend())
+                            {
+                                ThrowMaterialNotFound(shipAttributes);
+                            }
 
-                        material = &(materialIt->second);
+                            lastMaterial = &(materialIt->second);
+                        }
+
+                        lastColorKey = colorKey;
                     }
 
+                    StructuralMaterial const * const material = lastMaterial;
+
                     // Fill material
                     std::fill_n(
                         structuralLayerWrite + writeOffset,
@@ -1895,43 +2295,58 @@ void ShipDefinitionFormatDeSerializer::ReadElectricalLayer(
         {
             case static_cast<uint32_t>(ElectricalLayerTagType::Buffer) :
             {
-                // Decode RLE buffer
+                // Decode RLE buffer - straight from the buffer's data, as none of its
+                // values is endian-dependent
+                assert(readOffset + sectionHeader.SectionBodySize <= buffer.GetSize());
+                unsigned char const * const rleData = buffer.GetData() + readOffset;
+
+                // Runs tend to alternate among few materials, hence we remember the last lookup
+                MaterialColorKey lastColorKey = EmptyMaterialColorKey;
+                ElectricalMaterial const * lastMaterial = nullptr;
+
                 size_t writeOffset = 0;
                 ElectricalElement * electricalLayerWrite = electricalLayer->Buffer.Data.get();
                 for (size_t bufferReadOffset = 0; bufferReadOffset < sectionHeader.SectionBodySize; /*incremented in loop*/)
                 {
                     // Deserialize count
                     var_uint16_t count;
-                    bufferReadOffset += buffer.ReadAt(readOffset + bufferReadOffset, count);
+                    bufferReadOffset += BigEndian<var_uint16_t>::Read(rleData + bufferReadOffset, count);
 
                     // Deserialize colorKey value
                     MaterialColorKey colorKey;
-                    bufferReadOffset += buffer.ReadAt(readOffset + bufferReadOffset, reinterpret_cast<unsigned char *>(&colorKey), sizeof(colorKey));
+                    std::memcpy(&colorKey, rleData + bufferReadOffset, sizeof(colorKey));
+                    bufferReadOffset += sizeof(colorKey);
 
                     // Lookup material
-                    ElectricalMaterial const * material;
-                    if (colorKey == EmptyMaterialColorKey)
-                    {
-                        material = nullptr;
-                    }
-                    else
+                    if (colorKey != lastColorKey)
                     {
-                        auto const materialIt = materialColorMap.find(colorKey);
-                        if (materialIt == materialColorMap.cend())
+                        if (colorKey == EmptyMaterialColorKey)
                         {
-                            ThrowMaterialNotFound(shipAttributes);
+                            lastMaterial = nullptr;
+                        }
+                        else
+                        {
+                            auto const materialIt = materialColorMap.find(colorKey);
+                            if (materialIt == materialColorMap.cend())
+                            {
+                                ThrowMaterialNotFound(shipAttributes);
+                            }
+
+                            lastMaterial = &(materialIt->second);
                         }
 
-                        material = &(materialIt->second);
+                        lastColorKey = colorKey;
                     }
 
+                    ElectricalMaterial const * const material = lastMaterial;
+
                     // Deserialize instanceID - only if instanced
                     ElectricalElementInstanceIndex instanceId;
                     if (material != nullptr
                         && material->IsInstanced)
                     {
                         var_uint16_t instanceIdTmp;
-                        bufferReadOffset += buffer.ReadAt(readOffset + bufferReadOffset, instanceIdTmp);
+                        bufferReadOffset += BigEndian<var_uint16_t>::Read(rleData + bufferReadOffset, instanceIdTmp);
                         instanceId = static_cast<ElectricalElementInstanceIndex>(instanceIdTmp.value());
                     }
                     else
@@ -13,14 +13,19 @@
 #include <Core/DeSerializationBuffer.h>
 #include <Core/GameTypes.h>
 #include <Core/ImageData.h>
+#include <Core/ProgressCallback.h>
 #include <Core/Streams.h>
+#include <Core/ThreadManager.h>
 #include <Core/Version.h>
 
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #define MAKE_TAG(ch1, ch2, ch3, ch4) \
     std::uint32_t( ((ch1 & 0xff) << 24) | ((ch2 & 0xff) << 16) | ((ch3 & 0xff) << 8) | (ch4 & 0xff) )
@@ -36,6 +41,14 @@ public:
         BinaryReadStream & shipDefinitionInputStream,
         MaterialDatabase const & materialDatabase);
 
+    /*
+     * Decodes the layers concurrently on the simulation thread pool.
+     */
+    static ShipDefinition Load(
+        BinaryReadStream & shipDefinitionInputStream,
+        MaterialDatabase const & materialDatabase,
+        ThreadManager & threadManager);
+
     static ShipPreviewData LoadPreviewData(BinaryReadStream & shipDefinitionInputStream);
 
     static RgbaImageData LoadPreviewImage(
@@ -47,6 +60,17 @@ public:
         Version const & currentGameVersion,
         BinaryWriteStream & shipDefinitionOutputStream);
 
+    /*
+     * Encodes the sections concurrently - the texture's PNG and the layers being the
+     * expensive ones - and writes them out in file order; progress is reported as sections
+     * get encoded, by any of the encoders, one at a time.
+     */
+    static void Save(
+        ShipDefinition const & shipDefinition,
+        Version const & currentGameVersion,
+        BinaryWriteStream & shipDefinitionOutputStream,
+        SimpleProgressCallback const & progressCallback);
+
     static PasswordHash CalculatePasswordHash(std::string const & password);
 
 private:
@@ -103,8 +127,9 @@ private:
         AutoTexturizationSettings = MAKE_TAG('A', 'T', 'X', '1'),
         ShipAttributes = MAKE_TAG('A', 'T', 'T', '1'),
         Preview_PNG = MAKE_TAG('P', 'V', 'P', '1'),
+        SectionIndex = MAKE_TAG('S', 'I', 'X', '1'),
 
-        Tail = 0xffffffff
+        Tail = 0xffffffff // Body, when not empty, is the offset of the SectionIndex section
     };
 
     enum class ShipAttributesTagType : std::uint32_t
@@ -197,10 +222,26 @@ private:
 
 private:
 
+    // Main section tags and offsets of their (headers') sections, in file order
+    using SectionIndex = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
     // Write
 
+    // Appends the body of a main section to the buffer, returning the size of the body
+    using SectionBodyEncoder = std::function<size_t(DeSerializationBuffer<BigEndianess> & buffer)>;
+
+    static std::vector<DeSerializationBuffer<BigEndianess>> EncodeSections(
+        std::vector<std::pair<MainSectionTagType, SectionBodyEncoder>> const & sectionEncoders,
+        SimpleProgressCallback const & progressCallback);
+
     template<typename TSectionAppender>
-    static void AppendSection(
+    static void EncodeSection(
+        std::uint32_t tag,
+        TSectionAppender const & sectionAppender,
+        DeSerializationBuffer<BigEndianess> & buffer);
+
+    template<typename TSectionAppender>
+    static size_t AppendSection(
         BinaryWriteStream & shipDefinitionOutputStream,
         std::uint32_t tag,
         TSectionAppender const & sectionAppender,
@@ -216,6 +257,10 @@ private:
 
     static void AppendFileHeader(DeSerializationBuffer<BigEndianess> & buffer);
 
+    static size_t AppendSectionIndex(
+        SectionIndex const & sectionIndex,
+        DeSerializationBuffer<BigEndianess> & buffer);
+
     static size_t AppendShipAttributes(
         ShipAttributes const & shipAttributes,
         DeSerializationBuffer<BigEndianess> & buffer);
@@ -290,11 +335,35 @@ private:
 
     // Read
 
+    static ShipDefinition InternalLoad(
+        BinaryReadStream & shipDefinitionInputStream,
+        MaterialDatabase const & materialDatabase,
+        ThreadPool * threadPool);
+
+    static void RunLayerDecoders(
+        std::vector<ThreadPool::Task> const & layerDecoders,
+        ThreadPool * threadPool);
+
     template<typename SectionHandler>
     static void Parse(
         BinaryReadStream & shipDefinitionInputStream,
         SectionHandler const & sectionHandler);
 
+    /*
+     * Visits the sections with the specified tags - in the specified order - seeking
+     * straight to them via the section index; falls back to parsing all the sections
+     * of files without an index.
+     */
+    template<typename SectionHandler>
+    static void ParseIndexed(
+        BinaryReadStream & shipDefinitionInputStream,
+        std::vector<MainSectionTagType> const & tags,
+        SectionHandler const & sectionHandler);
+
+    static std::optional<SectionIndex> TryReadSectionIndex(
+        BinaryReadStream & shipDefinitionInputStream,
+        DeSerializationBuffer<BigEndianess> & buffer);
+
     static void ThrowMaterialNotFound(ShipAttributes const & shipAttributes);
 
     static void ReadIntoBuffer(
@@ -361,6 +430,7 @@ private:
     friend class ShipDefinitionFormatDeSerializerTests_Metadata_Minimal_Test;
     friend class ShipDefinitionFormatDeSerializerTests_PhysicsData_Test;
     friend class ShipDefinitionFormatDeSerializerTests_AutoTexturizationSettings_Test;
+    friend class ShipDefinitionFormatDeSerializerTests_SectionIndex_Test;
     friend class ShipDefinitionFormatDeSerializer_StructuralLayerTests;
     friend class ShipDefinitionFormatDeSerializer_StructuralLayerTests_VariousSizes_Uniform_Test;
     friend class ShipDefinitionFormatDeSerializer_StructuralLayerTests_MidSize_Heterogeneous_Test;
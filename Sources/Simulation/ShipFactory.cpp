@@ -13,18 +13,82 @@
 #include <Core/GameMath.h>
 #include <Core/ImageTools.h>
 #include <Core/Log.h>
+#include <Core/ThreadPool.h>
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <optional>
 #include <sstream>
+#include <tuple>
 #include <utility>
 
 using namespace Physics;
 
 //////////////////////////////////////////////////////////////////////////////
 
+ShipFactory::DeferredTextures::DeferredTextures(
+    Physics::Ship const & ship,
+    ShipSpaceSize const & shipSize,
+    ShipLayers && layers,
+    std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings)
+    : mShip(ship)
+    , mShipSize(shipSize)
+    , mLayers(std::move(layers))
+    , mAutoTexturizationSettings(autoTexturizationSettings)
+{
+}
+
+ShipId ShipFactory::DeferredTextures::GetShipId() const
+{
+    return mShip.GetId();
+}
+
+ShipFactory::DeferredTextures::Result ShipFactory::DeferredTextures::Make(
+    ShipTexturizer const & shipTexturizer,
+    IAssetManager const & assetManager,
+    std::optional<ImageSize> const & maxGpuInteriorViewSize)
+{
+    auto const startTime = GameChronometer::Now();
+
+    RgbaImageData exteriorTextureImage = MakeExteriorTexture(mLayers, mAutoTexturizationSettings, shipTexturizer, assetManager);
+    RgbaImageData interiorTextureImage = MakeInteriorTexture(mLayers, shipTexturizer, assetManager);
+
+    // Note: triangles' vertices and floors, and points' texture coordinates, never change
+
+    std::optional<RgbaImageData> interiorViewImage;
+    std::vector<InteriorViewFloorVertex> interiorViewFloorVertices;
+
+    if (maxGpuInteriorViewSize.has_value()
+        && interiorTextureImage.Size.width <= maxGpuInteriorViewSize->width
+        && interiorTextureImage.Size.height <= maxGpuInteriorViewSize->height)
+    {
+        interiorViewFloorVertices = shipTexturizer.MakeInteriorViewFloorVertices(
+            mShip.GetTriangles(),
+            mShip.GetPoints(),
+            mShipSize,
+            interiorTextureImage.Size);
+    }
+    else
+    {
+        interiorViewImage.emplace(shipTexturizer.MakeInteriorViewTexture(
+            mShip.GetTriangles(),
+            mShip.GetPoints(),
+            mShipSize,
+            interiorTextureImage));
+    }
+
+    LogMessage("ShipFactory: made deferred textures in ",
+        std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
+
+    return Result{
+        std::move(exteriorTextureImage),
+        std::move(interiorTextureImage),
+        std::move(interiorViewImage),
+        std::move(interiorViewFloorVertices) };
+}
+
 std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFactory::Create(
     ShipId shipId,
     World & parentWorld,
@@ -35,7 +99,72 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
     ShipStrengthRandomizer const & shipStrengthRandomizer,
     SimulationEventDispatcher & simulationEventDispatcher,
     IAssetManager const & assetManager,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    auto [ship, exteriorTextureImage, interiorViewImage, deferredTextures] = InternalCreate(
+        shipId,
+        parentWorld,
+        std::move(shipDefinition),
+        shipLoadOptions,
+        materialDatabase,
+        shipTexturizer,
+        shipStrengthRandomizer,
+        simulationEventDispatcher,
+        assetManager,
+        simulationParameters,
+        threadManager,
+        false);
+
+    assert(!deferredTextures);
+
+    return std::make_tuple(
+        std::move(ship),
+        std::move(exteriorTextureImage),
+        std::move(interiorViewImage));
+}
+
+std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData, std::unique_ptr<ShipFactory::DeferredTextures>> ShipFactory::CreateProgressively(
+    ShipId shipId,
+    World & parentWorld,
+    ShipDefinition && shipDefinition,
+    ShipLoadOptions const & shipLoadOptions,
+    MaterialDatabase const & materialDatabase,
+    ShipTexturizer const & shipTexturizer,
+    ShipStrengthRandomizer const & shipStrengthRandomizer,
+    SimulationEventDispatcher & simulationEventDispatcher,
+    IAssetManager const & assetManager,
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    return InternalCreate(
+        shipId,
+        parentWorld,
+        std::move(shipDefinition),
+        shipLoadOptions,
+        materialDatabase,
+        shipTexturizer,
+        shipStrengthRandomizer,
+        simulationEventDispatcher,
+        assetManager,
+        simulationParameters,
+        threadManager,
+        true);
+}
+
+std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData, std::unique_ptr<ShipFactory::DeferredTextures>> ShipFactory::InternalCreate(
+    ShipId shipId,
+    World & parentWorld,
+    ShipDefinition && shipDefinition,
+    ShipLoadOptions const & shipLoadOptions,
+    MaterialDatabase const & materialDatabase,
+    ShipTexturizer const & shipTexturizer,
+    ShipStrengthRandomizer const & shipStrengthRandomizer,
+    SimulationEventDispatcher & simulationEventDispatcher,
+    IAssetManager const & assetManager,
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager,
+    bool isProgressive)
 {
     auto const totalStartTime = GameChronometer::Now();
 
@@ -62,373 +191,396 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
     }
 
     //
-    // Process structural ship layer and:
-    // - Create ShipFactoryPoint's for each particle, including ropes' endpoints
-    // - Build a 2D matrix containing indices to the particles
+    // Prepare textures - while we create the physical ship; textures only depend on
+    // the layers, which the creation of the physical ship only reads.
+    //
+    // Note: the two textures share the texturizer's material texture cache,
+    // hence they are made one after the other
     //
 
-    assert(shipDefinition.Layers.StructuralLayer);
-    auto const & structuralLayerBuffer = shipDefinition.Layers.StructuralLayer->Buffer;
-
-    float const halfShipWidth = static_cast<float>(shipSize.width) / 2.0f;
-    float const shipSpaceToWorldSpaceFactor = shipDefinition.Metadata.Scale.outputUnits / shipDefinition.Metadata.Scale.inputUnits;
+    std::optional<RgbaImageData> exteriorTextureImage;
+    std::optional<RgbaImageData> interiorTextureImage;
 
-    // ShipFactoryPoint's
-    std::vector<ShipFactoryPoint> pointInfos1;
+    ThreadPool::Task const texturesTask = [&]()
+    {
+        if (!isProgressive)
+        {
+            exteriorTextureImage.emplace(MakeExteriorTexture(shipDefinition.Layers, shipDefinition.AutoTexturizationSettings, shipTexturizer, assetManager));
+            interiorTextureImage.emplace(MakeInteriorTexture(shipDefinition.Layers, shipTexturizer, assetManager));
+        }
+        else
+        {
+            // Placeholders for both; the interior is whited out like the real one
+            exteriorTextureImage.emplace(MakePlaceholderTexture(shipDefinition.Layers, shipDefinition.AutoTexturizationSettings, shipTexturizer, assetManager));
+
+            interiorTextureImage.emplace(exteriorTextureImage->Clone());
+            ImageTools::BlendWithColor(
+                *interiorTextureImage,
+                rgbColor(rgbColor::data_type_max, rgbColor::data_type_max, rgbColor::data_type_max),
+                0.5f);
+        }
+    };
 
-    // Matrix of points - we allocate 2 extra dummy rows and cols - around - to avoid checking for boundaries
-    ShipFactoryPointIndexMatrix pointIndexMatrix(shipSize.width + 2, shipSize.height + 2);
+    //
+    // Create the physical ship
+    //
 
-    // Region of actual content
-    int minX = shipSize.width;
-    int maxX = 0;
-    int minY = shipSize.height;
-    int maxY = 0;
+    std::optional<Points> points;
+    std::optional<Springs> springs;
+    std::optional<Triangles> triangles;
+    std::optional<ElectricalElements> electricalElements;
+    std::optional<Frontiers> frontiers;
+    ElementCount perfectSquareCount = 0;
 
-    // Visit all columns
-    for (int x = 0; x < shipSize.width; ++x)
+    ThreadPool::Task const physicsTask = [&]()
     {
-        // From bottom to top
-        for (int y = 0; y < shipSize.height; ++y)
-        {
-            ShipSpaceCoordinates const coords = ShipSpaceCoordinates(x, y);
+        //
+        // Process structural ship layer and:
+        // - Create ShipFactoryPoint's for each particle, including ropes' endpoints
+        // - Build a 2D matrix containing indices to the particles
+        //
 
-            // Get structural material properties
+        assert(shipDefinition.Layers.StructuralLayer);
+        auto const & structuralLayerBuffer = shipDefinition.Layers.StructuralLayer->Buffer;
 
-            StructuralMaterial const * structuralMaterial = structuralLayerBuffer[coords].Material;
+        float const halfShipWidth = static_cast<float>(shipSize.width) / 2.0f;
+        float const shipSpaceToWorldSpaceFactor = shipDefinition.Metadata.Scale.outputUnits / shipDefinition.Metadata.Scale.inputUnits;
 
-            rgbaColor structuralMaterialRenderColor = (structuralMaterial != nullptr)
-                ? structuralMaterial->RenderColor
-                : rgbaColor::zero();
+        // ShipFactoryPoint's
+        std::vector<ShipFactoryPoint> pointInfos1;
 
-            bool isStructuralMaterialRope = (structuralMaterial != nullptr)
-                ? structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
-                : false;
+        // Matrix of points - we allocate 2 extra dummy rows and cols - around - to avoid checking for boundaries
+        ShipFactoryPointIndexMatrix pointIndexMatrix(shipSize.width + 2, shipSize.height + 2);
 
-            bool isStructuralMaterialLeaking = (structuralMaterial != nullptr)
-                ? structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
-                : false;
+        // Region of actual content
+        int minX = shipSize.width;
+        int maxX = 0;
+        int minY = shipSize.height;
+        int maxY = 0;
 
-            // Check if there's a rope endpoint here
-            if (shipDefinition.Layers.RopesLayer)
+        // Visit all columns
+        for (int x = 0; x < shipSize.width; ++x)
+        {
+            // From bottom to top
+            for (int y = 0; y < shipSize.height; ++y)
             {
-                auto const ropeSearchIt = std::find_if(
-                    shipDefinition.Layers.RopesLayer->Buffer.cbegin(),
-                    shipDefinition.Layers.RopesLayer->Buffer.cend(),
-                    [&coords](RopeElement const & e)
+                ShipSpaceCoordinates const coords = ShipSpaceCoordinates(x, y);
+
+                // Get structural material properties
+
+                StructuralMaterial const * structuralMaterial = structuralLayerBuffer[coords].Material;
+
+                rgbaColor structuralMaterialRenderColor = (structuralMaterial != nullptr)
+                    ? structuralMaterial->RenderColor
+                    : rgbaColor::zero();
+
+                bool isStructuralMaterialRope = (structuralMaterial != nullptr)
+                    ? structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
+                    : false;
+
+                bool isStructuralMaterialLeaking = (structuralMaterial != nullptr)
+                    ? structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
+                    : false;
+
+                // Check if there's a rope endpoint here
+                if (shipDefinition.Layers.RopesLayer)
+                {
+                    auto const ropeSearchIt = std::find_if(
+                        shipDefinition.Layers.RopesLayer->Buffer.cbegin(),
+                        shipDefinition.Layers.RopesLayer->Buffer.cend(),
+                        [&coords](RopeElement const & e)
+                        {
+                            return e.StartCoords == coords || e.EndCoords == coords;
+                        });
+
+                    if (ropeSearchIt != shipDefinition.Layers.RopesLayer->Buffer.cend())
                     {
-                        return e.StartCoords == coords || e.EndCoords == coords;
-                    });
+                        //
+                        // There is a rope endpoint here
+                        //
+
+                        if (structuralMaterial == nullptr)
+                        {
+                            // Make a structural element for this endpoint
+                            structuralMaterial = ropeSearchIt->Material;
+                            assert(structuralMaterial != nullptr);
+                            isStructuralMaterialLeaking = true; // Ropes leak by default
+                        }
+
+                        // Change endpoint's color to match the rope's - or else the spring will look bad
+                        structuralMaterialRenderColor = ropeSearchIt->RenderColor;
 
-                if (ropeSearchIt != shipDefinition.Layers.RopesLayer->Buffer.cend())
+                        // Make it a rope point so that the first spring segment is a rope spring
+                        isStructuralMaterialRope = true;
+                    }
+                }
+
+                // Check if there's a structural element here
+                if (nullptr != structuralMaterial)
                 {
                     //
-                    // There is a rope endpoint here
+                    // Transform water point to air point + water
                     //
 
-                    if (structuralMaterial == nullptr)
+                    float water = 0.0f;
+                    if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Water))
                     {
-                        // Make a structural element for this endpoint
-                        structuralMaterial = ropeSearchIt->Material;
-                        assert(structuralMaterial != nullptr);
-                        isStructuralMaterialLeaking = true; // Ropes leak by default
+                        structuralMaterial = &(materialDatabase.GetUniqueStructuralMaterial(StructuralMaterial::MaterialUniqueType::Air));
+                        water = 1.0f;
                     }
 
-                    // Change endpoint's color to match the rope's - or else the spring will look bad
-                    structuralMaterialRenderColor = ropeSearchIt->RenderColor;
+                    //
+                    // Make a point
+                    //
 
-                    // Make it a rope point so that the first spring segment is a rope spring
-                    isStructuralMaterialRope = true;
-                }
-            }
+                    ElementIndex const pointIndex = static_cast<ElementIndex>(pointInfos1.size());
+
+                    pointIndexMatrix[{x + 1, y + 1}] = static_cast<ElementIndex>(pointIndex);
+
+                    vec2f const worldCoords =
+                        vec2f(
+                            static_cast<float>(x) - halfShipWidth,
+                            static_cast<float>(y)) * shipSpaceToWorldSpaceFactor
+                        + shipDefinition.PhysicsData.Offset;
+
+                    pointInfos1.emplace_back(
+                        coords,
+                        worldCoords,
+                        MakeTextureCoordinates(x, y, shipSize),
+                        structuralMaterialRenderColor,
+                        *structuralMaterial,
+                        isStructuralMaterialRope,
+                        isStructuralMaterialLeaking,
+                        structuralMaterial->Strength,
+                        water);
+
+                    // Eventually decorate with electrical layer information
+                    if (shipDefinition.Layers.ElectricalLayer && shipDefinition.Layers.ElectricalLayer->Buffer[coords].Material != nullptr)
+                    {
+                        pointInfos1.back().ElectricalMtl = shipDefinition.Layers.ElectricalLayer->Buffer[coords].Material;
+                        pointInfos1.back().ElectricalElementInstanceIdx = shipDefinition.Layers.ElectricalLayer->Buffer[coords].InstanceIndex;
+                    }
 
-            // Check if there's a structural element here
-            if (nullptr != structuralMaterial)
-            {
-                //
-                // Transform water point to air point + water
-                //
+                    //
+                    // Update min/max coords
+                    //
 
-                float water = 0.0f;
-                if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Water))
+                    minX = std::min(minX, x);
+                    maxX = std::max(maxX, x);
+                    minY = std::min(minY, y);
+                    maxY = std::max(maxY, y);
+                }
+                else
                 {
-                    structuralMaterial = &(materialDatabase.GetUniqueStructuralMaterial(StructuralMaterial::MaterialUniqueType::Air));
-                    water = 1.0f;
+                    // Just ignore this pixel
                 }
+            }
+        }
 
-                //
-                // Make a point
-                //
+        //
+        // Process the rope endpoints and:
+        // - Fill-in points between the endpoints, creating additional ShipFactoryPoint's for them
+        // - Fill-in springs between each pair of points in the rope, creating ShipFactorySpring's for them
+        //      - And populating the point pair -> spring index 1 map
+        //
 
-                ElementIndex const pointIndex = static_cast<ElementIndex>(pointInfos1.size());
-
-                pointIndexMatrix[{x + 1, y + 1}] = static_cast<ElementIndex>(pointIndex);
-
-                vec2f const worldCoords =
-                    vec2f(
-                        static_cast<float>(x) - halfShipWidth,
-                        static_cast<float>(y)) * shipSpaceToWorldSpaceFactor
-                    + shipDefinition.PhysicsData.Offset;
-
-                pointInfos1.emplace_back(
-                    coords,
-                    worldCoords,
-                    MakeTextureCoordinates(x, y, shipSize),
-                    structuralMaterialRenderColor,
-                    *structuralMaterial,
-                    isStructuralMaterialRope,
-                    isStructuralMaterialLeaking,
-                    structuralMaterial->Strength,
-                    water);
-
-                // Eventually decorate with electrical layer information
-                if (shipDefinition.Layers.ElectricalLayer && shipDefinition.Layers.ElectricalLayer->Buffer[coords].Material != nullptr)
-                {
-                    pointInfos1.back().ElectricalMtl = shipDefinition.Layers.ElectricalLayer->Buffer[coords].Material;
-                    pointInfos1.back().ElectricalElementInstanceIdx = shipDefinition.Layers.ElectricalLayer->Buffer[coords].InstanceIndex;
-                }
+        std::vector<ShipFactorySpring> springInfos1;
 
-                //
-                // Update min/max coords
-                //
+        ShipFactoryPointPairToIndexMap pointPairToSpringIndex1Map;
+        pointPairToSpringIndex1Map.reserve(pointInfos1.size() * 4); // Roughly four springs per point in a full lattice
 
-                minX = std::min(minX, x);
-                maxX = std::max(maxX, x);
-                minY = std::min(minY, y);
-                maxY = std::max(maxY, y);
-            }
-            else
-            {
-                // Just ignore this pixel
-            }
+        if (shipDefinition.Layers.RopesLayer)
+        {
+            AppendRopes(
+                shipDefinition.Layers.RopesLayer->Buffer,
+                shipSize,
+                pointIndexMatrix,
+                pointInfos1,
+                springInfos1,
+                pointPairToSpringIndex1Map);
         }
-    }
 
-    //
-    // Process the rope endpoints and:
-    // - Fill-in points between the endpoints, creating additional ShipFactoryPoint's for them
-    // - Fill-in springs between each pair of points in the rope, creating ShipFactorySpring's for them
-    //      - And populating the point pair -> spring index 1 map
-    //
+        //
+        // Visit point matrix and:
+        //  - Set non-fully-surrounded ShipFactoryPoint's as "leaking"
+        //  - Detect springs and create ShipFactorySpring's for them (additional to ropes)
+        //      - And populate the point pair -> spring index 1 map
+        //  - Do tessellation and create ShipFactoryTriangle's
+        //
 
-    std::vector<ShipFactorySpring> springInfos1;
+        std::vector<ShipFactoryTriangle> triangleInfos;
 
-    ShipFactoryPointPairToIndexMap pointPairToSpringIndex1Map;
+        size_t leakingPointsCount;
 
-    if (shipDefinition.Layers.RopesLayer)
-    {
-        AppendRopes(
-            shipDefinition.Layers.RopesLayer->Buffer,
-            shipSize,
+        CreateShipElementInfos(
             pointIndexMatrix,
             pointInfos1,
             springInfos1,
-            pointPairToSpringIndex1Map);
-    }
+            pointPairToSpringIndex1Map,
+            triangleInfos,
+            leakingPointsCount);
 
-    //
-    // Visit point matrix and:
-    //  - Set non-fully-surrounded ShipFactoryPoint's as "leaking"
-    //  - Detect springs and create ShipFactorySpring's for them (additional to ropes)
-    //      - And populate the point pair -> spring index 1 map
-    //  - Do tessellation and create ShipFactoryTriangle's
-    //
-
-    std::vector<ShipFactoryTriangle> triangleInfos;
-
-    size_t leakingPointsCount;
-
-    CreateShipElementInfos(
-        pointIndexMatrix,
-        pointInfos1,
-        springInfos1,
-        pointPairToSpringIndex1Map,
-        triangleInfos,
-        leakingPointsCount);
-
-    //
-    // Filter out redundant triangles
-    //
-
-    triangleInfos = FilterOutRedundantTriangles(
-        triangleInfos,
-        pointInfos1,
-        springInfos1);
-
-    //
-    // Connect points to triangles
-    //
-
-    ConnectPointsToTriangles(
-        pointInfos1,
-        triangleInfos);
+        //
+        // Filter out redundant triangles
+        //
 
-    //
-    // Optimize order of ShipFactoryPoint's and ShipFactorySpring's for our spring
-    // relaxation algorithm - and hopefully to improve cache hits
-    //
+        triangleInfos = FilterOutRedundantTriangles(
+            triangleInfos,
+            pointInfos1,
+            springInfos1);
 
-    auto [pointInfos2, pointIndexRemap, springInfos2, springIndexRemap, perfectSquareCount] = OptimizeLayout(
-        pointIndexMatrix,
-        pointInfos1,
-        springInfos1);
+        //
+        // Connect points to triangles
+        //
 
-    // Note: we don't optimize triangles, as tests indicate that performance gets (marginally) worse,
-    // and at the same time, it makes sense to use the natural order of the triangles as it ensures
-    // that higher elements in the ship cover lower elements when they are semi-detached.
+        ConnectPointsToTriangles(
+            pointInfos1,
+            triangleInfos);
 
-    //
-    // Associate all springs with the triangles that run through them (supertriangles)
-    //
+        //
+        // Optimize order of ShipFactoryPoint's and ShipFactorySpring's for our spring
+        // relaxation algorithm - and hopefully to improve cache hits
+        //
 
-    ConnectSpringsAndTriangles(
-        springInfos2,
-        triangleInfos,
-        pointIndexRemap);
+        auto [pointInfos2, pointIndexRemap, springInfos2, springIndexRemap, optimizedPerfectSquareCount] = OptimizeLayout(
+            pointIndexMatrix,
+            pointInfos1,
+            springInfos1,
+            simulationParameters.ShipLayoutOrder);
 
-    //
-    // Create frontiers
-    //
+        // Note: we don't optimize triangles, as tests indicate that performance gets (marginally) worse,
+        // and at the same time, it makes sense to use the natural order of the triangles as it ensures
+        // that higher elements in the ship cover lower elements when they are semi-detached.
 
-    std::vector<ShipFactoryFrontier> shipFactoryFrontiers = CreateShipFrontiers(
-        pointIndexMatrix,
-        pointIndexRemap,
-        pointInfos2,
-        springInfos2,
-        pointPairToSpringIndex1Map,
-        springIndexRemap);
+        //
+        // Associate all springs with the triangles that run through them (supertriangles)
+        //
 
-    //
-    // Randomize strength
-    //
+        ConnectSpringsAndTriangles(
+            springInfos2,
+            triangleInfos,
+            pointIndexRemap);
 
-    shipStrengthRandomizer.RandomizeStrength(
-        pointIndexMatrix,
-        vec2i(minX, minY) + vec2i(1, 1), // Image -> PointIndexMatrix
-        vec2i(maxX - minX + 1, maxY - minY + 1),
-        pointInfos2,
-        pointIndexRemap,
-        springInfos2,
-        triangleInfos,
-        shipFactoryFrontiers);
+        //
+        // Create frontiers
+        //
 
-    //
-    // Create floorplan
-    //
+        std::vector<ShipFactoryFrontier> shipFactoryFrontiers = CreateShipFrontiers(
+            pointIndexMatrix,
+            pointIndexRemap,
+            pointInfos2,
+            springInfos2,
+            pointPairToSpringIndex1Map,
+            springIndexRemap);
 
-    ShipFloorplanizer shipFloorplanizer;
+        //
+        // Randomize strength
+        //
 
-    ShipFactoryFloorPlan floorPlan2 = shipFloorplanizer.BuildFloorplan(
-        pointIndexMatrix,
-        pointInfos2,
-        pointIndexRemap,
-        springInfos2);
+        shipStrengthRandomizer.RandomizeStrength(
+            pointIndexMatrix,
+            vec2i(minX, minY) + vec2i(1, 1), // Image -> PointIndexMatrix
+            vec2i(maxX - minX + 1, maxY - minY + 1),
+            pointInfos2,
+            pointIndexRemap,
+            springInfos2,
+            triangleInfos,
+            shipFactoryFrontiers);
 
-    //
-    // Visit all ShipFactoryPoint's and create Points, i.e. the entire set of points
-    //
+        //
+        // Create floorplan
+        //
 
-    auto [points, allElectricalElementInstanceIndices] = CreatePoints(
-        pointInfos2,
-        parentWorld,
-        materialDatabase,
-        simulationEventDispatcher,
-        simulationParameters,
-        shipDefinition.PhysicsData);
+        ShipFloorplanizer shipFloorplanizer;
 
-    //
-    // Create Springs for all ShipFactorySpring's
-    //
+        ShipFactoryFloorPlan floorPlan2 = shipFloorplanizer.BuildFloorplan(
+            pointIndexMatrix,
+            pointInfos2,
+            pointIndexRemap,
+            springInfos2);
 
-    Springs springs = CreateSprings(
-        springInfos2,
-        perfectSquareCount,
-        points,
-        parentWorld,
-        simulationEventDispatcher,
-        simulationParameters);
+        //
+        // Visit all ShipFactoryPoint's and create Points, i.e. the entire set of points
+        //
 
-    //
-    // Create Triangles for all ShipFactoryTriangle's
-    //
+        auto [shipPoints, allElectricalElementInstanceIndices] = CreatePoints(
+            pointInfos2,
+            parentWorld,
+            materialDatabase,
+            simulationEventDispatcher,
+            simulationParameters,
+            shipDefinition.PhysicsData);
 
-    Triangles triangles = CreateTriangles(
-        triangleInfos,
-        points,
-        pointIndexRemap,
-        springInfos2,
-        floorPlan2);
+        //
+        // Create Springs for all ShipFactorySpring's
+        //
 
-    //
-    // Create Electrical Elements
-    //
+        springs.emplace(CreateSprings(
+            springInfos2,
+            optimizedPerfectSquareCount,
+            shipPoints,
+            parentWorld,
+            simulationEventDispatcher,
+            simulationParameters));
 
-    ElectricalElements electricalElements = CreateElectricalElements(
-        points,
-        pointInfos2,
-        allElectricalElementInstanceIndices,
-        shipDefinition.Layers.ElectricalLayer
-            ? shipDefinition.Layers.ElectricalLayer->Panel
-            : ElectricalPanel(),
-        shipLoadOptions.FlipHorizontally,
-        shipLoadOptions.FlipVertically,
-        shipLoadOptions.Rotate90CW,
-        shipId,
-        parentWorld,
-        simulationEventDispatcher,
-        simulationParameters);
+        //
+        // Create Triangles for all ShipFactoryTriangle's
+        //
 
-    //
-    // Create frontiers
-    //
+        triangles.emplace(CreateTriangles(
+            triangleInfos,
+            shipPoints,
+            pointIndexRemap,
+            springInfos2,
+            floorPlan2,
+            simulationParameters));
 
-    Frontiers frontiers = CreateFrontiers(
-        shipFactoryFrontiers,
-        points,
-        springs);
+        //
+        // Create Electrical Elements
+        //
 
-    //
-    // Create exterior texture
-    //
+        electricalElements.emplace(CreateElectricalElements(
+            shipPoints,
+            pointInfos2,
+            allElectricalElementInstanceIndices,
+            shipDefinition.Layers.ElectricalLayer
+                ? shipDefinition.Layers.ElectricalLayer->Panel
+                : ElectricalPanel(),
+            shipLoadOptions.FlipHorizontally,
+            shipLoadOptions.FlipVertically,
+            shipLoadOptions.Rotate90CW,
+            shipId,
+            parentWorld,
+            simulationEventDispatcher,
+            simulationParameters));
 
-    RgbaImageData exteriorTextureImage = shipDefinition.Layers.ExteriorTextureLayer
-        ? std::move(shipDefinition.Layers.ExteriorTextureLayer->Buffer) // Use provided texture
-        : shipTexturizer.MakeAutoTexture(
-            *shipDefinition.Layers.StructuralLayer,
-            shipDefinition.AutoTexturizationSettings, // Auto-texturize
-            ShipTexturizer::MaxHighDefinitionTextureSize,
-            assetManager);
+        //
+        // Create frontiers
+        //
 
-    //
-    // Create interior texture
-    //
+        frontiers.emplace(CreateFrontiers(
+            shipFactoryFrontiers,
+            shipPoints,
+            *springs));
 
-    RgbaImageData interiorTextureImage = shipDefinition.Layers.InteriorTextureLayer
-        ? std::move(shipDefinition.Layers.InteriorTextureLayer->Buffer) // Use provided texture
-        : shipTexturizer.MakeAutoTexture(
-            *shipDefinition.Layers.StructuralLayer,
-            ShipAutoTexturizationSettings( // Custom
-                ShipAutoTexturizationModeType::MaterialTextures,
-                0.15f,
-                0.65f),
-            ShipTexturizer::MaxHighDefinitionTextureSize,
-            assetManager);
+        points.emplace(std::move(shipPoints));
+        perfectSquareCount = optimizedPerfectSquareCount;
+    };
 
-    // Whiteout
-    ImageTools::BlendWithColor(
-        interiorTextureImage,
-        rgbColor(rgbColor::data_type_max, rgbColor::data_type_max, rgbColor::data_type_max),
-        0.5f);
+    // Physics last, as the last task runs on this thread - and physics fires events
+    threadManager.GetSimulationThreadPool().Run({ texturesTask, physicsTask });
 
     //
     // Create interior view
     //
 
-    RgbaImageData interiorViewImage = shipTexturizer.MakeInteriorViewTexture(
-        triangles,
-        points,
-        shipSize,
-        interiorTextureImage);
+    RgbaImageData interiorViewImage = !isProgressive
+        ? shipTexturizer.MakeInteriorViewTexture(
+            *triangles,
+            *points,
+            shipSize,
+            *interiorTextureImage)
+        : interiorTextureImage->Clone(); // No floors on placeholder
 
     //
     // We're done!
@@ -436,37 +588,118 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
 
 #ifdef _DEBUG
     VerifyShipInvariants(
-        points,
-        springs,
-        triangles);
+        *points,
+        *springs,
+        *triangles);
 #endif
 
     LogMessage("ShipFactory: Created ship: W=", shipSize.width, ", H=", shipSize.height, ", ",
-        points.GetRawShipPointCount(), "raw/", points.GetBufferElementCount(), "buf points, ",
-        springs.GetElementCount(), " springs (", perfectSquareCount, " perfect squares, ", perfectSquareCount * 4 * 100 / std::max(1u, springs.GetElementCount()), "%), ",
-        triangles.GetElementCount(), " triangles, ",
-        electricalElements.GetElementCount(), " electrical elements (", electricalElements.GetLampCount(), " lamps), ",
-        frontiers.GetElementCount(), " frontiers.");
+        points->GetRawShipPointCount(), "raw/", points->GetBufferElementCount(), "buf points, ",
+        springs->GetElementCount(), " springs (", perfectSquareCount, " perfect squares, ", perfectSquareCount * 4 * 100 / std::max(1u, springs->GetElementCount()), "%), ",
+        triangles->GetElementCount(), " triangles, ",
+        electricalElements->GetElementCount(), " electrical elements (", electricalElements->GetLampCount(), " lamps), ",
+        frontiers->GetElementCount(), " frontiers.");
 
     auto ship = std::make_unique<Ship>(
         shipId,
         parentWorld,
         materialDatabase,
         simulationEventDispatcher,
-        std::move(points),
-        std::move(springs),
-        std::move(triangles),
-        std::move(electricalElements),
-        std::move(frontiers),
-        std::move(interiorTextureImage));
+        std::move(*points),
+        std::move(*springs),
+        std::move(*triangles),
+        std::move(*electricalElements),
+        std::move(*frontiers),
+        std::move(*interiorTextureImage));
+
+    std::unique_ptr<DeferredTextures> deferredTextures;
+    if (isProgressive)
+    {
+        deferredTextures = std::make_unique<DeferredTextures>(
+            *ship,
+            shipSize,
+            std::move(shipDefinition.Layers),
+            shipDefinition.AutoTexturizationSettings);
+    }
 
     LogMessage("ShipFactory: Create() took ",
         std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - totalStartTime).count(), "us");
 
     return std::make_tuple(
         std::move(ship),
-        std::move(exteriorTextureImage),
-        std::move(interiorViewImage));
+        std::move(*exteriorTextureImage),
+        std::move(interiorViewImage),
+        std::move(deferredTextures));
+}
+
+RgbaImageData ShipFactory::MakeExteriorTexture(
+    ShipLayers & layers,
+    std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
+    ShipTexturizer const & shipTexturizer,
+    IAssetManager const & assetManager)
+{
+    return layers.ExteriorTextureLayer
+        ? std::move(layers.ExteriorTextureLayer->Buffer) // Use provided texture
+        : shipTexturizer.MakeAutoTexture(
+            *layers.StructuralLayer,
+            autoTexturizationSettings, // Auto-texturize
+            ShipTexturizer::MaxHighDefinitionTextureSize,
+            assetManager);
+}
+
+RgbaImageData ShipFactory::MakeInteriorTexture(
+    ShipLayers & layers,
+    ShipTexturizer const & shipTexturizer,
+    IAssetManager const & assetManager)
+{
+    RgbaImageData interiorTextureImage = layers.InteriorTextureLayer
+        ? std::move(layers.InteriorTextureLayer->Buffer) // Use provided texture
+        : shipTexturizer.MakeInteriorAutoTexture(
+            *layers.StructuralLayer,
+            ShipTexturizer::MaxHighDefinitionTextureSize,
+            assetManager);
+
+    // Whiteout
+    ImageTools::BlendWithColor(
+        interiorTextureImage,
+        rgbColor(rgbColor::data_type_max, rgbColor::data_type_max, rgbColor::data_type_max),
+        0.5f);
+
+    return interiorTextureImage;
+}
+
+RgbaImageData ShipFactory::MakePlaceholderTexture(
+    ShipLayers const & layers,
+    std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
+    ShipTexturizer const & shipTexturizer,
+    IAssetManager const & assetManager)
+{
+    if (layers.ExteriorTextureLayer)
+    {
+        // Shrink provided texture
+        auto const & texture = layers.ExteriorTextureLayer->Buffer;
+        int const maxDimension = std::max(texture.Size.width, texture.Size.height);
+        if (maxDimension <= PlaceholderTextureSize)
+        {
+            return texture.Clone();
+        }
+
+        return ImageTools::Resize(
+            texture,
+            ImageSize(
+                std::max(1, texture.Size.width * PlaceholderTextureSize / maxDimension),
+                std::max(1, texture.Size.height * PlaceholderTextureSize / maxDimension)),
+            ImageTools::FilterKind::Nearest);
+    }
+    else
+    {
+        // Auto-texturize at low resolution
+        return shipTexturizer.MakeAutoTexture(
+            *layers.StructuralLayer,
+            autoTexturizationSettings,
+            PlaceholderTextureSize,
+            assetManager);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1130,7 +1363,8 @@ void ShipFactory::ConnectPointsToTriangles(
 ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
     ShipFactoryPointIndexMatrix const & pointIndexMatrix,
     std::vector<ShipFactoryPoint> const & pointInfos1,
-    std::vector<ShipFactorySpring> const & springInfos1)
+    std::vector<ShipFactorySpring> const & springInfos1,
+    ShipLayoutOrderType layoutOrder)
 {
     IndexRemap optimalPointRemap(pointInfos1.size());
     IndexRemap optimalSpringRemap(springInfos1.size());
@@ -1141,12 +1375,12 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
 
     // Build Point Pair (Old) -> Spring Index (Old) table
     ShipFactoryPointPairToIndexMap pointPair1ToSpringIndex1Map;
+    pointPair1ToSpringIndex1Map.reserve(springInfos1.size());
     for (ElementIndex s = 0; s < springInfos1.size(); ++s)
     {
-        pointPair1ToSpringIndex1Map.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(springInfos1[s].PointAIndex, springInfos1[s].PointBIndex),
-            std::forward_as_tuple(s));
+        pointPair1ToSpringIndex1Map.try_emplace(
+            { springInfos1[s].PointAIndex, springInfos1[s].PointBIndex },
+            s);
     }
 
     //
@@ -1176,207 +1410,243 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
 
     ElementCount perfectSquareCount = 0;
 
-    for (int y = 0; y < pointIndexMatrix.height; ++y)
+    auto const tryMapPerfectSquare = [&](int x, int y)
     {
-        for (int x = 0; x < pointIndexMatrix.width; ++x)
+        // Check if this is vertex A of a square
+        if (pointIndexMatrix[{x, y}]
+            && x < pointIndexMatrix.width - 1 && pointIndexMatrix[{x + 1, y}]
+            && y < pointIndexMatrix.height - 1 && pointIndexMatrix[{x + 1, y + 1}]
+            && pointIndexMatrix[{x, y + 1}])
         {
-            // Check if this is vertex A of a square
-            if (pointIndexMatrix[{x, y}]
-                && x < pointIndexMatrix.width - 1 && pointIndexMatrix[{x + 1, y}]
-                && y < pointIndexMatrix.height - 1 && pointIndexMatrix[{x + 1, y + 1}]
-                && pointIndexMatrix[{x, y + 1}])
+            ElementIndex const a = *pointIndexMatrix[{x, y}];
+            ElementIndex const b = *pointIndexMatrix[{x + 1, y}];
+            ElementIndex const c = *pointIndexMatrix[{x + 1, y + 1}];
+            ElementIndex const d = *pointIndexMatrix[{x, y + 1}];
+
+            // Check existence - and availability - of all springs now
+
+            ElementIndex crossSpringACIndex;
+            if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, c });
+                springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+            {
+                crossSpringACIndex = springIt->second;
+            }
+            else
+            {
+                return;
+            }
+
+            ElementIndex crossSpringBDIndex;
+            if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, d });
+                springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
             {
-                ElementIndex const a = *pointIndexMatrix[{x, y}];
-                ElementIndex const b = *pointIndexMatrix[{x + 1, y}];
-                ElementIndex const c = *pointIndexMatrix[{x + 1, y + 1}];
-                ElementIndex const d = *pointIndexMatrix[{x, y + 1}];
+                crossSpringBDIndex = springIt->second;
+            }
+            else
+            {
+                return;
+            }
 
-                // Check existence - and availability - of all springs now
+            if ((x + y) % 2 == 0)
+            {
+                // Even: check AD, BC
 
-                ElementIndex crossSpringACIndex;
-                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, c });
+                ElementIndex sideSpringADIndex;
+                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, d });
                     springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
                 {
-                    crossSpringACIndex = springIt->second;
+                    sideSpringADIndex = springIt->second;
                 }
                 else
                 {
-                    continue;
+                    return;
                 }
 
-                ElementIndex crossSpringBDIndex;
-                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, d });
+                ElementIndex sideSpringBCIndex;
+                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, c });
                     springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
                 {
-                    crossSpringBDIndex = springIt->second;
+                    sideSpringBCIndex = springIt->second;
                 }
                 else
                 {
-                    continue;
+                    return;
                 }
 
-                if ((x + y) % 2 == 0)
+                // It'a a perfect square
+
+                // Re-order springs and make sure they have the right directions:
+                //  A->C
+                //  B->D
+                //  A->D
+                //  B->C
+
+                optimalSpringRemap.AddOld(crossSpringACIndex);
+                remappedSpringMask[crossSpringACIndex] = true;
+                if (springInfos1[crossSpringACIndex].PointBIndex != c)
                 {
-                    // Even: check AD, BC
+                    assert(springInfos1[crossSpringACIndex].PointBIndex == a);
+                    springFlipMask[crossSpringACIndex] = true;
+                }
 
-                    ElementIndex sideSpringADIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, d });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
-                    {
-                        sideSpringADIndex = springIt->second;
-                    }
-                    else
-                    {
-                        continue;
-                    }
+                optimalSpringRemap.AddOld(crossSpringBDIndex);
+                remappedSpringMask[crossSpringBDIndex] = true;
+                if (springInfos1[crossSpringBDIndex].PointBIndex != d)
+                {
+                    assert(springInfos1[crossSpringBDIndex].PointBIndex == b);
+                    springFlipMask[crossSpringBDIndex] = true;
+                }
 
-                    ElementIndex sideSpringBCIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, c });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
-                    {
-                        sideSpringBCIndex = springIt->second;
-                    }
-                    else
-                    {
-                        continue;
-                    }
+                optimalSpringRemap.AddOld(sideSpringADIndex);
+                remappedSpringMask[sideSpringADIndex] = true;
+                if (springInfos1[sideSpringADIndex].PointBIndex != d)
+                {
+                    assert(springInfos1[sideSpringADIndex].PointBIndex == a);
+                    springFlipMask[sideSpringADIndex] = true;
+                }
 
-                    // It'a a perfect square
+                optimalSpringRemap.AddOld(sideSpringBCIndex);
+                remappedSpringMask[sideSpringBCIndex] = true;
+                if (springInfos1[sideSpringBCIndex].PointBIndex != c)
+                {
+                    assert(springInfos1[sideSpringBCIndex].PointBIndex == b);
+                    springFlipMask[sideSpringBCIndex] = true;
+                }
+            }
+            else
+            {
+                // Odd: check AB, CD
 
-                    // Re-order springs and make sure they have the right directions:
-                    //  A->C
-                    //  B->D
-                    //  A->D
-                    //  B->C
+                ElementIndex sideSpringABIndex;
+                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, b });
+                    springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                {
+                    sideSpringABIndex = springIt->second;
+                }
+                else
+                {
+                    return;
+                }
 
-                    optimalSpringRemap.AddOld(crossSpringACIndex);
-                    remappedSpringMask[crossSpringACIndex] = true;
-                    if (springInfos1[crossSpringACIndex].PointBIndex != c)
-                    {
-                        assert(springInfos1[crossSpringACIndex].PointBIndex == a);
-                        springFlipMask[crossSpringACIndex] = true;
-                    }
+                ElementIndex sideSpringCDIndex;
+                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ c, d });
+                    springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                {
+                    sideSpringCDIndex = springIt->second;
+                }
+                else
+                {
+                    return;
+                }
 
-                    optimalSpringRemap.AddOld(crossSpringBDIndex);
-                    remappedSpringMask[crossSpringBDIndex] = true;
-                    if (springInfos1[crossSpringBDIndex].PointBIndex != d)
-                    {
-                        assert(springInfos1[crossSpringBDIndex].PointBIndex == b);
-                        springFlipMask[crossSpringBDIndex] = true;
-                    }
+                // It'a a perfect square
 
-                    optimalSpringRemap.AddOld(sideSpringADIndex);
-                    remappedSpringMask[sideSpringADIndex] = true;
-                    if (springInfos1[sideSpringADIndex].PointBIndex != d)
-                    {
-                        assert(springInfos1[sideSpringADIndex].PointBIndex == a);
-                        springFlipMask[sideSpringADIndex] = true;
-                    }
+                // Re-order springs abd make sure they have the right directions:
+                //  A->C
+                //  D->B
+                //  A->B
+                //  D->C
 
-                    optimalSpringRemap.AddOld(sideSpringBCIndex);
-                    remappedSpringMask[sideSpringBCIndex] = true;
-                    if (springInfos1[sideSpringBCIndex].PointBIndex != c)
-                    {
-                        assert(springInfos1[sideSpringBCIndex].PointBIndex == b);
-                        springFlipMask[sideSpringBCIndex] = true;
-                    }
+                optimalSpringRemap.AddOld(crossSpringACIndex);
+                remappedSpringMask[crossSpringACIndex] = true;
+                if (springInfos1[crossSpringACIndex].PointBIndex != c)
+                {
+                    assert(springInfos1[crossSpringACIndex].PointBIndex == a);
+                    springFlipMask[crossSpringACIndex] = true;
                 }
-                else
+
+                optimalSpringRemap.AddOld(crossSpringBDIndex);
+                remappedSpringMask[crossSpringBDIndex] = true;
+                if (springInfos1[crossSpringBDIndex].PointBIndex != b)
                 {
-                    // Odd: check AB, CD
+                    assert(springInfos1[crossSpringBDIndex].PointBIndex == d);
+                    springFlipMask[crossSpringBDIndex] = true;
+                }
 
-                    ElementIndex sideSpringABIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, b });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
-                    {
-                        sideSpringABIndex = springIt->second;
-                    }
-                    else
-                    {
-                        continue;
-                    }
+                optimalSpringRemap.AddOld(sideSpringABIndex);
+                remappedSpringMask[sideSpringABIndex] = true;
+                if (springInfos1[sideSpringABIndex].PointBIndex != b)
+                {
+                    assert(springInfos1[sideSpringABIndex].PointBIndex == a);
+                    springFlipMask[sideSpringABIndex] = true;
+                }
 
-                    ElementIndex sideSpringCDIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ c, d });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
-                    {
-                        sideSpringCDIndex = springIt->second;
-                    }
-                    else
-                    {
-                        continue;
-                    }
+                optimalSpringRemap.AddOld(sideSpringCDIndex);
+                remappedSpringMask[sideSpringCDIndex] = true;
+                if (springInfos1[sideSpringCDIndex].PointBIndex != c)
+                {
+                    assert(springInfos1[sideSpringCDIndex].PointBIndex == d);
+                    springFlipMask[sideSpringCDIndex] = true;
+                }
+            }
 
-                    // It'a a perfect square
+            // If we're here, this was a perfect square
 
-                    // Re-order springs abd make sure they have the right directions:
-                    //  A->C
-                    //  D->B
-                    //  A->B
-                    //  D->C
+            // Remap points
 
-                    optimalSpringRemap.AddOld(crossSpringACIndex);
-                    remappedSpringMask[crossSpringACIndex] = true;
-                    if (springInfos1[crossSpringACIndex].PointBIndex != c)
-                    {
-                        assert(springInfos1[crossSpringACIndex].PointBIndex == a);
-                        springFlipMask[crossSpringACIndex] = true;
-                    }
+            if (!remappedPointMask[a])
+            {
+                optimalPointRemap.AddOld(a);
+                remappedPointMask[a] = true;
+            }
 
-                    optimalSpringRemap.AddOld(crossSpringBDIndex);
-                    remappedSpringMask[crossSpringBDIndex] = true;
-                    if (springInfos1[crossSpringBDIndex].PointBIndex != b)
-                    {
-                        assert(springInfos1[crossSpringBDIndex].PointBIndex == d);
-                        springFlipMask[crossSpringBDIndex] = true;
-                    }
+            if (!remappedPointMask[b])
+            {
+                optimalPointRemap.AddOld(b);
+                remappedPointMask[b] = true;
+            }
 
-                    optimalSpringRemap.AddOld(sideSpringABIndex);
-                    remappedSpringMask[sideSpringABIndex] = true;
-                    if (springInfos1[sideSpringABIndex].PointBIndex != b)
-                    {
-                        assert(springInfos1[sideSpringABIndex].PointBIndex == a);
-                        springFlipMask[sideSpringABIndex] = true;
-                    }
+            if (!remappedPointMask[c])
+            {
+                optimalPointRemap.AddOld(c);
+                remappedPointMask[c] = true;
+            }
 
-                    optimalSpringRemap.AddOld(sideSpringCDIndex);
-                    remappedSpringMask[sideSpringCDIndex] = true;
-                    if (springInfos1[sideSpringCDIndex].PointBIndex != c)
-                    {
-                        assert(springInfos1[sideSpringCDIndex].PointBIndex == d);
-                        springFlipMask[sideSpringCDIndex] = true;
-                    }
-                }
+            if (!remappedPointMask[d])
+            {
+                optimalPointRemap.AddOld(d);
+                remappedPointMask[d] = true;
+            }
 
-                // If we're here, this was a perfect square
+            ++perfectSquareCount;
+        }
+    };
 
-                // Remap points
+    // The points of the matrix in Morton order; only populated for the Morton layout
+    std::vector<std::tuple<std::uint32_t, int, int>> mortonOrderedMatrixPoints;
 
-                if (!remappedPointMask[a])
-                {
-                    optimalPointRemap.AddOld(a);
-                    remappedPointMask[a] = true;
-                }
+    if (layoutOrder == ShipLayoutOrderType::Morton)
+    {
+        // Visit squares by the Morton code of their vertex A, so that points - and thus
+        // their springs - that are close in space are also close in memory
 
-                if (!remappedPointMask[b])
+        for (int y = 0; y < pointIndexMatrix.height; ++y)
+        {
+            for (int x = 0; x < pointIndexMatrix.width; ++x)
+            {
+                if (pointIndexMatrix[{x, y}])
                 {
-                    optimalPointRemap.AddOld(b);
-                    remappedPointMask[b] = true;
+                    mortonOrderedMatrixPoints.emplace_back(MortonCode(static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y)), x, y);
                 }
+            }
+        }
 
-                if (!remappedPointMask[c])
-                {
-                    optimalPointRemap.AddOld(c);
-                    remappedPointMask[c] = true;
-                }
+        std::sort(mortonOrderedMatrixPoints.begin(), mortonOrderedMatrixPoints.end());
 
-                if (!remappedPointMask[d])
-                {
-                    optimalPointRemap.AddOld(d);
-                    remappedPointMask[d] = true;
-                }
+        for (auto const & [code, x, y] : mortonOrderedMatrixPoints)
+        {
+            tryMapPerfectSquare(x, y);
+        }
+    }
+    else
+    {
+        // Visit squares by rows
 
-                ++perfectSquareCount;
+        for (int y = 0; y < pointIndexMatrix.height; ++y)
+        {
+            for (int x = 0; x < pointIndexMatrix.width; ++x)
+            {
+                tryMapPerfectSquare(x, y);
             }
         }
     }
@@ -1388,21 +1658,66 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
     LogMessage("LayoutOptimizer: ", perfectSquareCount, " perfect squares, ", std::count(remappedPointMask.cbegin(), remappedPointMask.cend(), false), " leftover points, ",
         std::count(remappedSpringMask.cbegin(), remappedSpringMask.cend(), false), " leftover springs");
 
-    for (ElementIndex p = 0; p < pointInfos1.size(); ++p)
+    if (layoutOrder == ShipLayoutOrderType::Morton)
     {
-        if (!remappedPointMask[p])
+        // Leftover points in the matrix in Morton order, followed by the others (i.e. ropes)
+
+        for (auto const & [code, x, y] : mortonOrderedMatrixPoints)
         {
-            optimalPointRemap.AddOld(p);
+            ElementIndex const p = *pointIndexMatrix[{x, y}];
+            if (!remappedPointMask[p])
+            {
+                optimalPointRemap.AddOld(p);
+                remappedPointMask[p] = true;
+            }
         }
-    }
 
-    for (ElementIndex s = 0; s < springInfos1.size(); ++s)
-    {
-        if (!remappedSpringMask[s])
+        for (ElementIndex p = 0; p < pointInfos1.size(); ++p)
+        {
+            if (!remappedPointMask[p])
+            {
+                optimalPointRemap.AddOld(p);
+            }
+        }
+
+        // Leftover springs in the order of their (new) first endpoint
+
+        std::vector<std::tuple<ElementIndex, ElementIndex>> leftoverSprings;
+        for (ElementIndex s = 0; s < springInfos1.size(); ++s)
+        {
+            if (!remappedSpringMask[s])
+            {
+                leftoverSprings.emplace_back(
+                    std::min(optimalPointRemap.OldToNew(springInfos1[s].PointAIndex), optimalPointRemap.OldToNew(springInfos1[s].PointBIndex)),
+                    s);
+            }
+        }
+
+        std::sort(leftoverSprings.begin(), leftoverSprings.end());
+
+        for (auto const & [firstEndpoint, s] : leftoverSprings)
         {
             optimalSpringRemap.AddOld(s);
         }
     }
+    else
+    {
+        for (ElementIndex p = 0; p < pointInfos1.size(); ++p)
+        {
+            if (!remappedPointMask[p])
+            {
+                optimalPointRemap.AddOld(p);
+            }
+        }
+
+        for (ElementIndex s = 0; s < springInfos1.size(); ++s)
+        {
+            if (!remappedSpringMask[s])
+            {
+                optimalSpringRemap.AddOld(s);
+            }
+        }
+    }
 
     //
     // Remap
@@ -1452,13 +1767,13 @@ void ShipFactory::ConnectSpringsAndTriangles(
     //
 
     ShipFactoryPointPairToIndexMap pointPair1ToSpring2Map;
+    pointPair1ToSpring2Map.reserve(springInfos2.size());
 
     for (ElementIndex s = 0; s < springInfos2.size(); ++s)
     {
-        pointPair1ToSpring2Map.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(pointIndexRemap.NewToOld(springInfos2[s].PointAIndex), pointIndexRemap.NewToOld(springInfos2[s].PointBIndex)),
-            std::forward_as_tuple(s));
+        pointPair1ToSpring2Map.try_emplace(
+            { pointIndexRemap.NewToOld(springInfos2[s].PointAIndex), pointIndexRemap.NewToOld(springInfos2[s].PointBIndex) },
+            s);
     }
 
     //
@@ -1884,41 +2199,26 @@ std::tuple<Physics::Points, std::set<ElectricalElementInstanceIndex>> ShipFactor
         physicsData.InternalPressure // Default internal pressure is 1atm
         * SimulationParameters::AirPressureAtSeaLevel; // The ship's (initial) internal pressure is just relative to a constant 1 atm
 
-    ElementIndex electricalElementCounter = 0;
-    for (size_t p = 0; p < pointInfos2.size(); ++p)
-    {
-        ShipFactoryPoint const & pointInfo = pointInfos2[p];
-
-        ElementIndex electricalElementIndex = NoneElementIndex;
-        if (nullptr != pointInfo.ElectricalMtl)
-        {
-            // This point has an associated electrical element
-            electricalElementIndex = electricalElementCounter;
-            ++electricalElementCounter;
-        }
+    std::vector<float> randomNormalizedUniformFloats(pointInfos2.size());
+    GameRandomEngine::GetInstance().FillNormalizedUniformReals(
+        randomNormalizedUniformFloats.data(),
+        randomNormalizedUniformFloats.size());
 
-        //
-        // Create point
-        //
+    //
+    // Create points
+    //
 
-        points.Add(
-            pointInfo.Position,
-            pointInfo.Water,
-            internalPressure,
-            pointInfo.StructuralMtl,
-            pointInfo.ElectricalMtl,
-            pointInfo.IsRope,
-            pointInfo.Strength,
-            electricalElementIndex,
-            pointInfo.IsLeaking,
-            pointInfo.RenderColor,
-            pointInfo.TextureCoordinates,
-            GameRandomEngine::GetInstance().GenerateNormalizedUniformReal());
+    points.AddRange(
+        pointInfos2,
+        internalPressure,
+        randomNormalizedUniformFloats);
 
-        //
-        // Remember electrical element instance index
-        //
+    //
+    // Remember electrical element instance indices
+    //
 
+    for (ShipFactoryPoint const & pointInfo : pointInfos2)
+    {
         if (pointInfo.ElectricalElementInstanceIdx != NoneElectricalElementInstanceIndex)
         {
             auto [_, isInserted] = allElectricalElementInstanceIndices.insert(pointInfo.ElectricalElementInstanceIdx);
@@ -1947,18 +2247,13 @@ Physics::Springs ShipFactory::CreateSprings(
         simulationEventDispatcher,
         simulationParameters);
 
+    // Create springs
+    springs.AddRange(
+        springInfos2,
+        points);
+
     for (ElementIndex s = 0; s < springInfos2.size(); ++s)
     {
-        // Create spring
-        springs.Add(
-            springInfos2[s].PointAIndex,
-            springInfos2[s].PointBIndex,
-            springInfos2[s].PointAAngle,
-            springInfos2[s].PointBAngle,
-            springInfos2[s].Triangles,
-            springInfos2[s].CoveringTrianglesCount,
-            points);
-
         // Add spring to its endpoints
         points.AddFactoryConnectedSpring(
             springInfos2[s].PointAIndex,
@@ -1978,9 +2273,17 @@ Physics::Triangles ShipFactory::CreateTriangles(
     Physics::Points & points,
     IndexRemap const & pointIndexRemap,
     std::vector<ShipFactorySpring> const & springInfos2,
-    ShipFactoryFloorPlan const & floorPlan2)
+    ShipFactoryFloorPlan const & floorPlan2,
+    SimulationParameters const & simulationParameters)
 {
-    Physics::Triangles triangles(static_cast<ElementIndex>(triangleInfos2.size()));
+    Physics::Triangles triangles(
+        static_cast<ElementIndex>(triangleInfos2.size()),
+        simulationParameters.DoUseContiguousElementBuffers);
+
+    std::vector<Physics::Triangles::FactoryOppositeTrianglesInfo> oppositeTrianglesInfos;
+    oppositeTrianglesInfos.reserve(triangleInfos2.size());
+    std::vector<Physics::Triangles::FactoryFloorsInfo> floorsInfos;
+    floorsInfos.reserve(triangleInfos2.size());
 
     for (ElementIndex t = 0; t < triangleInfos2.size(); ++t)
     {
@@ -2070,21 +2373,15 @@ Physics::Triangles ShipFactory::CreateTriangles(
             }
         }
 
-        // Create triangle
-        triangles.Add(
-            pointIndexRemap.OldToNew(triangleInfos2[t].PointIndices1[0]),
-            pointIndexRemap.OldToNew(triangleInfos2[t].PointIndices1[1]),
-            pointIndexRemap.OldToNew(triangleInfos2[t].PointIndices1[2]),
-            triangleInfos2[t].Springs2[0],
-            triangleInfos2[t].Springs2[1],
-            triangleInfos2[t].Springs2[2],
+        // Remember triangle's edge info
+        oppositeTrianglesInfos.push_back({ {
             { subSpringsOppositeTriangle[0].first, subSpringsOppositeTriangle[0].second },
             { subSpringsOppositeTriangle[1].first, subSpringsOppositeTriangle[1].second },
-            { subSpringsOppositeTriangle[2].first, subSpringsOppositeTriangle[2].second },
+            { subSpringsOppositeTriangle[2].first, subSpringsOppositeTriangle[2].second } } });
+        floorsInfos.push_back({ {
             { subSpringsFloorKind[0], subSpringsFloorGeometry[0] },
             { subSpringsFloorKind[1], subSpringsFloorGeometry[1] },
-            { subSpringsFloorKind[2], subSpringsFloorGeometry[2] },
-            triangleInfos2[t].CoveredTraverseSpringIndex2);
+            { subSpringsFloorKind[2], subSpringsFloorGeometry[2] } } });
 
         // Add triangle to its endpoints
         points.AddFactoryConnectedTriangle(pointIndexRemap.OldToNew(triangleInfos2[t].PointIndices1[0]), t, true); // Owner
@@ -2092,6 +2389,13 @@ Physics::Triangles ShipFactory::CreateTriangles(
         points.AddFactoryConnectedTriangle(pointIndexRemap.OldToNew(triangleInfos2[t].PointIndices1[2]), t, false); // Not owner
     }
 
+    // Create triangles
+    triangles.AddRange(
+        triangleInfos2,
+        pointIndexRemap,
+        oppositeTrianglesInfos,
+        floorsInfos);
+
     return triangles;
 }
 
@@ -18,10 +18,13 @@
 
 #include <Core/GameTypes.h>
 #include <Core/IndexRemap.h>
+#include <Core/ThreadManager.h>
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <set>
+#include <tuple>
 #include <vector>
 
 /*
@@ -32,6 +35,54 @@ class ShipFactory
 {
 public:
 
+    /*
+     * The full textures of a ship created progressively, to be made - in the background, while
+     * the ship is already being simulated with placeholder textures - and then swapped in.
+     *
+     * Make() may run on any thread, as it only reads attributes of the ship that never change
+     * after its creation; the ship must outlive it.
+     */
+    class DeferredTextures final
+    {
+    public:
+
+        struct Result
+        {
+            RgbaImageData ExteriorTextureImage;
+            RgbaImageData InteriorTextureImage;
+
+            // Either the interior view, or the floors to draw onto the interior texture to make it
+            std::optional<RgbaImageData> InteriorViewImage;
+            std::vector<InteriorViewFloorVertex> InteriorViewFloorVertices;
+        };
+
+        DeferredTextures(
+            Physics::Ship const & ship,
+            ShipSpaceSize const & shipSize,
+            ShipLayers && layers,
+            std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings);
+
+        ShipId GetShipId() const;
+
+        /*
+         * May only be invoked once.
+         *
+         * When given a max size, an interior view that fits is not made, leaving it - via its
+         * floors - to the GPU.
+         */
+        Result Make(
+            ShipTexturizer const & shipTexturizer,
+            IAssetManager const & assetManager,
+            std::optional<ImageSize> const & maxGpuInteriorViewSize);
+
+    private:
+
+        Physics::Ship const & mShip;
+        ShipSpaceSize const mShipSize;
+        ShipLayers mLayers;
+        std::optional<ShipAutoTexturizationSettings> const mAutoTexturizationSettings;
+    };
+
     static std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> Create(
         ShipId shipId,
         Physics::World & parentWorld,
@@ -42,7 +93,61 @@ public:
         ShipStrengthRandomizer const & shipStrengthRandomizer,
         SimulationEventDispatcher & simulationEventDispatcher,
         IAssetManager const & assetManager,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+    /*
+     * Creates the ship with low-resolution placeholder textures, returning - together with them -
+     * the means to make its full textures.
+     */
+    static std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData, std::unique_ptr<DeferredTextures>> CreateProgressively(
+        ShipId shipId,
+        Physics::World & parentWorld,
+        ShipDefinition && shipDefinition,
+        ShipLoadOptions const & shipLoadOptions,
+        MaterialDatabase const & materialDatabase,
+        ShipTexturizer const & shipTexturizer,
+        ShipStrengthRandomizer const & shipStrengthRandomizer,
+        SimulationEventDispatcher & simulationEventDispatcher,
+        IAssetManager const & assetManager,
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+private:
+
+    // Max dimension of placeholder textures
+    static int constexpr PlaceholderTextureSize = 512;
+
+    static std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData, std::unique_ptr<DeferredTextures>> InternalCreate(
+        ShipId shipId,
+        Physics::World & parentWorld,
+        ShipDefinition && shipDefinition,
+        ShipLoadOptions const & shipLoadOptions,
+        MaterialDatabase const & materialDatabase,
+        ShipTexturizer const & shipTexturizer,
+        ShipStrengthRandomizer const & shipStrengthRandomizer,
+        SimulationEventDispatcher & simulationEventDispatcher,
+        IAssetManager const & assetManager,
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager,
+        bool isProgressive);
+
+    static RgbaImageData MakeExteriorTexture(
+        ShipLayers & layers,
+        std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
+        ShipTexturizer const & shipTexturizer,
+        IAssetManager const & assetManager);
+
+    static RgbaImageData MakeInteriorTexture(
+        ShipLayers & layers,
+        ShipTexturizer const & shipTexturizer,
+        IAssetManager const & assetManager);
+
+    static RgbaImageData MakePlaceholderTexture(
+        ShipLayers const & layers,
+        std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
+        ShipTexturizer const & shipTexturizer,
+        IAssetManager const & assetManager);
 
 private:
 
@@ -128,7 +233,8 @@ private:
     static LayoutOptimizationResults OptimizeLayout(
         ShipFactoryPointIndexMatrix const & pointIndexMatrix,
         std::vector<ShipFactoryPoint> const & pointInfos1,
-        std::vector<ShipFactorySpring> const & springInfos1);
+        std::vector<ShipFactorySpring> const & springInfos1,
+        ShipLayoutOrderType layoutOrder);
 
     static void ConnectSpringsAndTriangles(
         std::vector<ShipFactorySpring> & springInfos2,
@@ -174,7 +280,8 @@ private:
         Physics::Points & points,
         IndexRemap const & pointIndexRemap,
         std::vector<ShipFactorySpring> const & springInfos2,
-        ShipFactoryFloorPlan const & floorPlan2);
+        ShipFactoryFloorPlan const & floorPlan2,
+        SimulationParameters const & simulationParameters);
 
     static Physics::ElectricalElements CreateElectricalElements(
         Physics::Points const & points,
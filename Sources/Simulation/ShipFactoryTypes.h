@@ -15,9 +15,12 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /*
@@ -179,7 +182,168 @@ struct ShipFactoryPointPair
     };
 };
 
-using ShipFactoryPointPairToIndexMap = std::unordered_map<ShipFactoryPointPair, ElementIndex, ShipFactoryPointPair::Hasher>;
+/*
+ * Map from point pairs to element indices, for the (many) springs and edges we
+ * look up while making a ship.
+ *
+ * An open-addressing hash table with linear probing over packed point pairs; it
+ * offers the subset of std::unordered_map's interface that ship making needs, with
+ * lookups returning pointers to entries - and nullptr when not found.
+ */
+class ShipFactoryPointPairToIndexMap final
+{
+public:
+
+    struct Entry
+    {
+        std::uint64_t first; // Packed point pair
+        ElementIndex second;
+    };
+
+public:
+
+    ShipFactoryPointPairToIndexMap()
+        : mEntries()
+        , mSize(0)
+        , mCapacityShift(0)
+    {
+        Rehash(MinCapacity);
+    }
+
+    size_t size() const noexcept
+    {
+        return mSize;
+    }
+
+    void reserve(size_t size)
+    {
+        size_t capacity = MinCapacity;
+        while (IsOverloaded(size, capacity))
+        {
+            capacity *= 2;
+        }
+
+        if (capacity > mEntries.size())
+        {
+            Rehash(capacity);
+        }
+    }
+
+    Entry const * find(ShipFactoryPointPair const & pointPair) const noexcept
+    {
+        std::uint64_t const key = Pack(pointPair);
+        for (size_t i = Hash(key); ; i = (i + 1) & (mEntries.size() - 1))
+        {
+            if (mEntries[i].first == key)
+            {
+                return &(mEntries[i]);
+            }
+            else if (mEntries[i].first == EmptyKey)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    Entry const * end() const noexcept
+    {
+        return nullptr;
+    }
+
+    Entry const * cend() const noexcept
+    {
+        return nullptr;
+    }
+
+    /*
+     * Inserts the entry unless the point pair is already in the map; returns the entry
+     * for the point pair, and whether it's been inserted.
+     */
+    std::pair<Entry *, bool> try_emplace(
+        ShipFactoryPointPair const & pointPair,
+        ElementIndex index)
+    {
+        if (IsOverloaded(mSize + 1, mEntries.size()))
+        {
+            Rehash(mEntries.size() * 2);
+        }
+
+        std::uint64_t const key = Pack(pointPair);
+        for (size_t i = Hash(key); ; i = (i + 1) & (mEntries.size() - 1))
+        {
+            if (mEntries[i].first == key)
+            {
+                return { &(mEntries[i]), false };
+            }
+            else if (mEntries[i].first == EmptyKey)
+            {
+                mEntries[i].first = key;
+                mEntries[i].second = index;
+                ++mSize;
+
+                return { &(mEntries[i]), true };
+            }
+        }
+    }
+
+private:
+
+    static size_t constexpr MinCapacity = 16;
+
+    // Both endpoints would be NoneElementIndex
+    static std::uint64_t constexpr EmptyKey = std::numeric_limits<std::uint64_t>::max();
+
+    static inline bool IsOverloaded(
+        size_t size,
+        size_t capacity)
+    {
+        // Max load factor: 0.75
+        return size * 4 > capacity * 3;
+    }
+
+    static inline std::uint64_t Pack(ShipFactoryPointPair const & pointPair)
+    {
+        return (static_cast<std::uint64_t>(pointPair.Endpoint1Index) << 32) | static_cast<std::uint64_t>(pointPair.Endpoint2Index);
+    }
+
+    inline size_t Hash(std::uint64_t key) const
+    {
+        // Fibonacci hashing: the top bits of the product are well mixed
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - mCapacityShift));
+    }
+
+    void Rehash(size_t capacity)
+    {
+        assert(capacity >= MinCapacity && (capacity & (capacity - 1)) == 0);
+
+        std::vector<Entry> oldEntries(capacity, Entry{ EmptyKey, NoneElementIndex });
+        oldEntries.swap(mEntries);
+
+        mCapacityShift = 0;
+        while ((size_t(1) << mCapacityShift) < capacity)
+        {
+            ++mCapacityShift;
+        }
+
+        for (Entry const & entry : oldEntries)
+        {
+            if (entry.first != EmptyKey)
+            {
+                size_t i = Hash(entry.first);
+                while (mEntries[i].first != EmptyKey)
+                {
+                    i = (i + 1) & (mEntries.size() - 1);
+                }
+
+                mEntries[i] = entry;
+            }
+        }
+    }
+
+    std::vector<Entry> mEntries; // Capacity is a power of two
+    size_t mSize;
+    int mCapacityShift;
+};
 
 struct ShipFactoryFloorInfo
 {
@@ -69,10 +69,58 @@ void ShipStrengthRandomizer::RandomizeStrength_Perlin(std::vector<ShipFactoryPoi
 
     float constexpr CellWidth = 4.0f;
 
-    auto const gradientVectorAt = [](float x, float y) -> vec2f // Always positive
+    auto const gradientAt = [](float x, float y) -> float // Always positive
     {
         float const arg = (1.0f + std::sinf(x * (x * 12.9898f + y * 78.233f))) * 43758.5453f;
-        float const random = arg - std::floor(arg);
+        return arg - std::floor(arg);
+    };
+
+    //
+    // Calculate gradients once per grid corner, as each is shared by all
+    // the points of four cells
+    //
+
+    auto const gridPosOf = [](ShipFactoryPoint const & point)
+    {
+        return vec2f(
+            static_cast<float>(point.Position.x) / CellWidth,
+            static_cast<float>(point.Position.y) / CellWidth);
+    };
+
+    vec2i gridMin(std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+    vec2i gridMax(std::numeric_limits<int>::lowest(), std::numeric_limits<int>::lowest());
+    for (auto const & point : pointInfos2)
+    {
+        if (!point.IsRope)
+        {
+            vec2f const gridPos = gridPosOf(point);
+            gridMin.x = std::min(gridMin.x, static_cast<int>(floor(gridPos.x)));
+            gridMin.y = std::min(gridMin.y, static_cast<int>(floor(gridPos.y)));
+            gridMax.x = std::max(gridMax.x, static_cast<int>(floor(gridPos.x)) + 1);
+            gridMax.y = std::max(gridMax.y, static_cast<int>(floor(gridPos.y)) + 1);
+        }
+    }
+
+    if (gridMin.x > gridMax.x)
+    {
+        // Only ropes
+        return;
+    }
+
+    Matrix2<float> gradients(gridMax.x - gridMin.x + 1, gridMax.y - gridMin.y + 1);
+    for (int x = 0; x < gradients.width; ++x)
+    {
+        for (int y = 0; y < gradients.height; ++y)
+        {
+            gradients[{x, y}] = gradientAt(
+                static_cast<float>(x + gridMin.x),
+                static_cast<float>(y + gridMin.y));
+        }
+    }
+
+    auto const gradientVectorAt = [&](float x, float y) -> vec2f
+    {
+        float const random = gradients[vec2i(static_cast<int>(x), static_cast<int>(y)) - gridMin];
         return vec2f(random, random);
     };
 
@@ -82,9 +130,7 @@ void ShipStrengthRandomizer::RandomizeStrength_Perlin(std::vector<ShipFactoryPoi
         if (!point.IsRope)
         {
             // Coordinates of point in grid space
-            vec2f const gridPos(
-                static_cast<float>(point.Position.x) / CellWidth,
-                static_cast<float>(point.Position.y) / CellWidth);
+            vec2f const gridPos = gridPosOf(point);
 
             // Coordinates of four cell corners
             float const x0 = floor(gridPos.x);
@@ -218,13 +264,27 @@ void ShipStrengthRandomizer::RandomizeStrength_Batik(
         * mDensityAdjustment
         * 0.803); // Magic number
 
+    // The crack points added since the last distance update; initially, all
+    // points at distance zero
+    std::vector<vec2i> newCrackPointCoords;
+    for (int x = 0; x < distanceMatrix.width; ++x)
+    {
+        for (int y = 0; y < distanceMatrix.height; ++y)
+        {
+            if (distanceMatrix[{x, y}].Distance == 0.0f)
+            {
+                newCrackPointCoords.emplace_back(x, y);
+            }
+        }
+    }
+
     for (int iCrack = 0; iCrack < numberOfCracks; ++iCrack)
     {
         //
-        // Update distances
+        // Update distances, re-propagating only from the cracks added by the previous iteration
         //
 
-        UpdateBatikDistances(distanceMatrix);
+        UpdateBatikDistances(distanceMatrix, newCrackPointCoords);
 
         //
         // Choose a starting point among all triangle vertices
@@ -295,6 +355,7 @@ void ShipStrengthRandomizer::RandomizeStrength_Batik(
             PropagateBatikCrack(
                 startingPointCoords + OctantDirections[*bestNextPointOctant],
                 distanceMatrix,
+                newCrackPointCoords,
                 randomEngine);
 
             //
@@ -315,6 +376,7 @@ void ShipStrengthRandomizer::RandomizeStrength_Batik(
                 PropagateBatikCrack(
                     startingPointCoords + OctantDirections[*oppositeOctant],
                     distanceMatrix,
+                    newCrackPointCoords,
                     randomEngine);
             }
         }
@@ -322,6 +384,7 @@ void ShipStrengthRandomizer::RandomizeStrength_Batik(
         // Set crack at starting point
         distanceMatrix[startingPointCoords].Distance = 0.0f;
         distanceMatrix[startingPointCoords].IsCrack = true;
+        newCrackPointCoords.emplace_back(startingPointCoords);
     }
 
     //
@@ -392,6 +455,7 @@ template<typename TRandomEngine>
 void ShipStrengthRandomizer::PropagateBatikCrack(
     vec2i const & startingPoint,
     BatikDistanceMatrix & distanceMatrix,
+    std::vector<vec2i> & newCrackPointCoords,
     TRandomEngine & randomEngine) const
 {
     auto directionPerturbationDistribution = std::uniform_int_distribution(-1, 1);
@@ -401,11 +465,11 @@ void ShipStrengthRandomizer::PropagateBatikCrack(
     // at distance zero (border or other crack) is reached
     //
 
-    std::vector<vec2i> crackPointCoords;
+    size_t const firstCrackPointIndex = newCrackPointCoords.size();
 
     for (vec2i p = startingPoint; ;)
     {
-        crackPointCoords.emplace_back(p);
+        newCrackPointCoords.emplace_back(p);
 
         //
         // Check whether we're done
@@ -468,58 +532,47 @@ void ShipStrengthRandomizer::PropagateBatikCrack(
     //
 
     // Futurework: perf: do this inline
-    for (auto const & p : crackPointCoords)
+    for (size_t i = firstCrackPointIndex; i < newCrackPointCoords.size(); ++i)
     {
-        distanceMatrix[p].Distance = 0.0f;
-        distanceMatrix[p].IsCrack = true;
+        distanceMatrix[newCrackPointCoords[i]].Distance = 0.0f;
+        distanceMatrix[newCrackPointCoords[i]].IsCrack = true;
     }
 }
 
-void ShipStrengthRandomizer::UpdateBatikDistances(BatikDistanceMatrix & distanceMatrix) const
+void ShipStrengthRandomizer::UpdateBatikDistances(
+    BatikDistanceMatrix & distanceMatrix,
+    std::vector<vec2i> & newZeroDistancePointCoords) const
 {
     //
-    // Jain's algorithm (1989, Fundamentals of Digital Image Processing, Chapter 2)
+    // Distances are 8-connected unit steps, and all of the seeds are at zero; a breadth-first
+    // visit from the seeds thus lowers each point at most once, to its final distance, and only
+    // visits the points that are now closer to the new seeds than to anything else.
+    //
+    // The rest of the matrix is already a valid distance map, hence the time is linear with the
+    // number of updated points - rather than with the size of the matrix, at each crack.
     //
 
-    auto const updateDistanceFromOctant = [&distanceMatrix](vec2i const & idx, Octant const & octant)
-    {
-        vec2i const nidx = idx + OctantDirections[octant];
-        if (nidx.IsInSize(distanceMatrix)
-            && distanceMatrix[nidx].Distance + 1.0f < distanceMatrix[idx].Distance)
-        {
-            distanceMatrix[idx].Distance = distanceMatrix[nidx].Distance + 1.0f;
-        }
-    };
+    // Used as a FIFO queue
+    std::vector<vec2i> & queue = newZeroDistancePointCoords;
 
-    // Top-Left -> Bottom-Right
-    for (int x = 0; x < distanceMatrix.width; ++x)
+    for (size_t head = 0; head < queue.size(); ++head)
     {
-        for (int y = distanceMatrix.height - 1; y >= 0; --y)
-        {
-            vec2i const idx(x, y);
-
-            // Upper left half of 8-neighborhood of (x, y)
-            for (Octant t = 4; t <= 7; ++t)
-            {
-                updateDistanceFromOctant(idx, t);
-            }
-        }
-    }
+        vec2i const idx = queue[head];
+        float const nextDistance = distanceMatrix[idx].Distance + 1.0f;
 
-    // Bottom-Right -> Top-Left
-    for (int x = distanceMatrix.width - 1; x >= 0; --x)
-    {
-        for (int y = 0; y < distanceMatrix.height; ++y)
+        for (Octant octant = 0; octant < 8; ++octant)
         {
-            vec2i const idx(x, y);
-
-            // Lower right half of 8-neighborhood of (x, y)
-            for (int t = 0; t <= 3; ++t)
+            vec2i const nidx = idx + OctantDirections[octant];
+            if (nidx.IsInSize(distanceMatrix)
+                && nextDistance < distanceMatrix[nidx].Distance)
             {
-                updateDistanceFromOctant(idx, t);
+                distanceMatrix[nidx].Distance = nextDistance;
+                queue.emplace_back(nidx);
             }
         }
     }
+
+    queue.clear();
 }
 
 template <typename TAcceptor>
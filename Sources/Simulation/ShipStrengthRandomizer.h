@@ -87,9 +87,13 @@ private:
     void PropagateBatikCrack(
         vec2i const & startingPoint,
         BatikDistanceMatrix & distanceMatrix,
+        std::vector<vec2i> & newCrackPointCoords,
         TRandomEngine & randomEngine) const;
 
-    void UpdateBatikDistances(BatikDistanceMatrix & distanceMatrix) const;
+    // Lowers distances from the specified - new - zero-distance points; consumes the points
+    void UpdateBatikDistances(
+        BatikDistanceMatrix & distanceMatrix,
+        std::vector<vec2i> & newZeroDistancePointCoords) const;
 
     template <typename TAcceptor>
     std::optional<Octant> FindClosestOctant(
@@ -9,12 +9,25 @@
 #include <Core/GameException.h>
 #include <Core/GameMath.h>
 #include <Core/Log.h>
+#include <Core/ThreadManager.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <thread>
+#include <unordered_set>
 
-size_t constexpr MaterialTextureCacheSizeHighWatermark = 40;
-size_t constexpr MaterialTextureCacheSizeLowWatermark = 25;
+// Budget of the material texture cache; least-recently used textures
+// are evicted beyond it
+size_t constexpr MaterialTextureCacheMaxByteSize = 96 * 1024 * 1024;
+
+// Max number of threads loading material textures concurrently
+size_t constexpr MaxMaterialTexturePreloadWorkers = 4;
+
+// Min number of target pixels that make it worth to fill a texture concurrently
+size_t constexpr MinConcurrentTargetPixelCount = 256 * 256;
 
 std::string const MaterialTextureNameNone = "none";
 
@@ -39,6 +52,102 @@ namespace /*anonymous*/ {
                 inputColor.z + (bumpMapSample.x - inputColor.z) * factor);
         }
     }
+
+    template<typename TVisitor>
+    void ForEachMaterialInRegion(
+        StructuralLayerData const & structuralLayer,
+        ShipSpaceRect const & structuralLayerRegion,
+        TVisitor && visitor)
+    {
+        std::unordered_set<StructuralMaterial const *> visitedMaterials;
+
+        int const endY = structuralLayerRegion.origin.y + structuralLayerRegion.size.height;
+        int const endX = structuralLayerRegion.origin.x + structuralLayerRegion.size.width;
+        for (int y = structuralLayerRegion.origin.y; y < endY; ++y)
+        {
+            for (int x = structuralLayerRegion.origin.x; x < endX; ++x)
+            {
+                StructuralMaterial const * const structuralMaterial = structuralLayer.Buffer[ShipSpaceCoordinates(x, y)].Material;
+                if (structuralMaterial != nullptr
+                    && visitedMaterials.insert(structuralMaterial).second)
+                {
+                    visitor(*structuralMaterial);
+                }
+            }
+        }
+    }
+
+    /*
+     * Invokes rowsFiller(startY, endY) on bands of rows of the region, concurrently
+     * when the region is large enough to be worth it - this thread being one of the workers.
+     * The filler must only write to the quads of its own rows.
+     */
+    template<typename TRowsFiller>
+    void RunRowsConcurrently(
+        ShipSpaceRect const & structuralLayerRegion,
+        int magnificationFactor,
+        TRowsFiller const & rowsFiller)
+    {
+        int const startY = structuralLayerRegion.origin.y;
+        int const endY = structuralLayerRegion.origin.y + structuralLayerRegion.size.height;
+
+        size_t const targetPixelCount =
+            structuralLayerRegion.size.GetLinearSize()
+            * static_cast<size_t>(magnificationFactor)
+            * static_cast<size_t>(magnificationFactor);
+
+        size_t const workerCount = targetPixelCount >= MinConcurrentTargetPixelCount
+            ? std::min(ThreadManager::GetNumberOfProcessors(), static_cast<size_t>(std::max(structuralLayerRegion.size.height, 1)))
+            : 1;
+
+        if (workerCount <= 1)
+        {
+            rowsFiller(startY, endY);
+            return;
+        }
+
+        // Bands are interleaved among workers, so that rows with more (or less)
+        // material are spread evenly
+        int constexpr BandHeight = 4;
+        std::atomic<int> nextBandStartY(startY);
+        std::vector<std::exception_ptr> workerExceptions(workerCount);
+
+        auto const runWorker = [&](size_t w)
+        {
+            try
+            {
+                for (int bandStartY = nextBandStartY.fetch_add(BandHeight); bandStartY < endY; bandStartY = nextBandStartY.fetch_add(BandHeight))
+                {
+                    rowsFiller(bandStartY, std::min(bandStartY + BandHeight, endY));
+                }
+            }
+            catch (...)
+            {
+                workerExceptions[w] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workerThreads;
+        for (size_t w = 1; w < workerCount; ++w)
+        {
+            workerThreads.emplace_back(runWorker, w);
+        }
+
+        runWorker(0);
+
+        for (auto & workerThread : workerThreads)
+        {
+            workerThread.join();
+        }
+
+        for (auto const & workerException : workerExceptions)
+        {
+            if (workerException)
+            {
+                std::rethrow_exception(workerException);
+            }
+        }
+    }
 }
 
 ShipTexturizer::ShipTexturizer(
@@ -49,6 +158,9 @@ ShipTexturizer::ShipTexturizer(
     , mMaterialTextureNameToTextureRelativePathMap(
         MakeMaterialTextureNameToTextureRelativePathMap(materialDatabase, assetManager))
     , mMaterialTextureCache()
+    , mMaterialTextureCacheByteSize(0)
+    , mMaterialTextureCacheTick(0)
+    , mMaterialTextureCachePinTick(0)
 {
 }
 
@@ -78,9 +190,6 @@ RgbaImageData ShipTexturizer::MakeAutoTexture(
 {
     auto const startTime = GameChronometer::Now();
 
-    // Zero-out cache usage counts
-    ResetMaterialTextureCacheUseCounts();
-
     // Calculate texture size
     ShipSpaceSize const shipSize = structuralLayer.Buffer.Size;
     int magnificationFactor = CalculateHighDefinitionTextureMagnificationFactor(shipSize, maxTextureSize);
@@ -112,6 +221,21 @@ RgbaImageData ShipTexturizer::MakeAutoTexture(
     return texture;
 }
 
+RgbaImageData ShipTexturizer::MakeInteriorAutoTexture(
+    StructuralLayerData const & structuralLayer,
+    int maxTextureSize,
+    IAssetManager const & assetManager) const
+{
+    return MakeAutoTexture(
+        structuralLayer,
+        ShipAutoTexturizationSettings( // Custom
+            ShipAutoTexturizationModeType::MaterialTextures,
+            0.15f,
+            0.65f),
+        maxTextureSize,
+        assetManager);
+}
+
 void ShipTexturizer::AutoTexturizeInto(
     StructuralLayerData const & structuralLayer,
     ShipSpaceRect const & structuralLayerRegion,
@@ -145,8 +269,27 @@ void ShipTexturizer::AutoTexturizeInto(
         register_int nextPixelXI;
     };
 
-    std::vector<XInterpolationData> xInterpolationData;
-    xInterpolationData.resize(magnificationFactor);
+    // Textures used in this region must survive cache purges until we're done
+    mMaterialTextureCachePinTick = mMaterialTextureCacheTick;
+
+    std::unordered_map<StructuralMaterial const *, Vec2fImageData const *> materialTextures;
+    if (settings.Mode == ShipAutoTexturizationModeType::MaterialTextures)
+    {
+        // Load all the textures we're going to need at once, rather than stalling on each
+        PreloadMaterialTextures(
+            structuralLayer,
+            structuralLayerRegion,
+            assetManager);
+
+        // Resolve them upfront, as the rows are texturized concurrently
+        ForEachMaterialInRegion(
+            structuralLayer,
+            structuralLayerRegion,
+            [&](StructuralMaterial const & material)
+            {
+                materialTextures[&material] = &GetMaterialTexture(material.MaterialTextureName, assetManager);
+            });
+    }
 
     //
     // Populate texture
@@ -155,176 +298,185 @@ void ShipTexturizer::AutoTexturizeInto(
     auto targetImageData = targetTextureImage.Data.get();
     auto const & structuralBuffer = structuralLayer.Buffer;
 
-    int const startY = structuralLayerRegion.origin.y;
-    int const endY = structuralLayerRegion.origin.y + structuralLayerRegion.size.height;
-
     int const startX = structuralLayerRegion.origin.x;
     int const endX = structuralLayerRegion.origin.x + structuralLayerRegion.size.width;
 
-    for (int y = startY; y < endY; ++y)
+    auto const texturizeRows = [&](int startY, int endY)
     {
-        for (int x = startX; x < endX; ++x)
-        {
-            ShipSpaceCoordinates const coords = ShipSpaceCoordinates(x, y);
+        std::vector<XInterpolationData> xInterpolationData;
+        xInterpolationData.resize(magnificationFactor);
 
-            // Get structure pixel color
-            StructuralMaterial const * const structuralMaterial = structuralBuffer[coords].Material;
-            rgbaColor const structurePixelColor = structuralMaterial != nullptr
-                ? structuralMaterial->RenderColor
-                : rgbaColor::zero(); // Fully transparent
-
-            if (settings.Mode == ShipAutoTexturizationModeType::FlatStructure
-                || structuralMaterial == nullptr)
+        for (int y = startY; y < endY; ++y)
+        {
+            for (int x = startX; x < endX; ++x)
             {
-                //
-                // Flat structure/transparent
-                //
+                ShipSpaceCoordinates const coords = ShipSpaceCoordinates(x, y);
+
+                // Get structure pixel color
+                StructuralMaterial const * const structuralMaterial = structuralBuffer[coords].Material;
+                rgbaColor const structurePixelColor = structuralMaterial != nullptr
+                    ? structuralMaterial->RenderColor
+                    : rgbaColor::zero(); // Fully transparent
 
-                // Fill quad with color
-                for (int yy = 0; yy < magnificationFactor; ++yy)
+                if (settings.Mode == ShipAutoTexturizationModeType::FlatStructure
+                    || structuralMaterial == nullptr)
                 {
-                    int const quadOffset =
-                        x * magnificationFactor
-                        + (y * magnificationFactor + yy) * targetTextureWidth;
+                    //
+                    // Flat structure/transparent
+                    //
 
-                    for (int xx = 0; xx < magnificationFactor; ++xx)
+                    // Fill quad with color
+                    for (int yy = 0; yy < magnificationFactor; ++yy)
                     {
-                        targetImageData[quadOffset + xx] = structurePixelColor;
+                        int const quadOffset =
+                            x * magnificationFactor
+                            + (y * magnificationFactor + yy) * targetTextureWidth;
+
+                        for (int xx = 0; xx < magnificationFactor; ++xx)
+                        {
+                            targetImageData[quadOffset + xx] = structurePixelColor;
+                        }
                     }
                 }
-            }
-            else
-            {
-                //
-                // Material textures
-                //
-
-                assert(settings.Mode == ShipAutoTexturizationModeType::MaterialTextures);
-
-                vec3f const structurePixelColorF = structurePixelColor.toVec3f();
-
-                // Get bump map texture
-                assert(structuralMaterial != nullptr);
-                Vec2fImageData const & materialTexture = GetMaterialTexture(structuralMaterial->MaterialTextureName, assetManager);
-
-                //
-                // Prepare bilinear interpolation along X
-                //
-
-                float pixelX = static_cast<float>(x) * worldToMaterialTexturePixelConversionFactor;
-                for (int xx = 0; xx < magnificationFactor; ++xx, pixelX += magnificationFactorInvF * worldToMaterialTexturePixelConversionFactor)
+                else
                 {
-                    // Integral part
-                    xInterpolationData[xx].pixelXI = FastTruncateToArchInt(pixelX);
-
-                    // Fractional part between index and next index
-                    xInterpolationData[xx].pixelDx = pixelX - xInterpolationData[xx].pixelXI;
-
-                    // Wrap integral coordinates
-                    xInterpolationData[xx].pixelXI %= static_cast<register_int>(materialTexture.Size.width);
-
-                    // Next X
-                    xInterpolationData[xx].nextPixelXI = (xInterpolationData[xx].pixelXI + 1) % static_cast<register_int>(materialTexture.Size.width);
-
-                    assert(xInterpolationData[xx].pixelXI >= 0 && xInterpolationData[xx].pixelXI < materialTexture.Size.width);
-                    assert(xInterpolationData[xx].pixelDx >= 0.0f && xInterpolationData[xx].pixelDx < 1.0f);
-                    assert(xInterpolationData[xx].nextPixelXI >= 0 && xInterpolationData[xx].nextPixelXI < materialTexture.Size.width);
-                }
+                    //
+                    // Material textures
+                    //
 
-                //
-                // Fill quad with color multiply-blended with "bump map" texture
-                //
+                    assert(settings.Mode == ShipAutoTexturizationModeType::MaterialTextures);
 
-                int const baseTargetQuadOffset = (x + y * targetTextureWidth) * magnificationFactor;
+                    vec3f const structurePixelColorF = structurePixelColor.toVec3f();
 
-                float worldY = static_cast<float>(y);
-                for (int yy = 0; yy < magnificationFactor; ++yy, worldY += magnificationFactorInvF)
-                {
-                    int const targetQuadOffset = baseTargetQuadOffset + yy * targetTextureWidth;
+                    // Get bump map texture
+                    assert(structuralMaterial != nullptr);
+                    assert(materialTextures.count(structuralMaterial) == 1);
+                    Vec2fImageData const & materialTexture = *(materialTextures.find(structuralMaterial)->second);
 
                     //
-                    // Prepare bilinear interpolation for Y
+                    // Prepare bilinear interpolation along X
                     //
 
-                    float const pixelY = worldY * worldToMaterialTexturePixelConversionFactor;
-
-                    // Integral part
-                    auto pixelYI = FastTruncateToArchInt(pixelY);
+                    float pixelX = static_cast<float>(x) * worldToMaterialTexturePixelConversionFactor;
+                    for (int xx = 0; xx < magnificationFactor; ++xx, pixelX += magnificationFactorInvF * worldToMaterialTexturePixelConversionFactor)
+                    {
+                        // Integral part
+                        xInterpolationData[xx].pixelXI = FastTruncateToArchInt(pixelX);
 
-                    // Fractional part between index and next index
-                    float const pixelDy = pixelY - pixelYI;
+                        // Fractional part between index and next index
+                        xInterpolationData[xx].pixelDx = pixelX - xInterpolationData[xx].pixelXI;
 
-                    // Wrap integral coordinates
-                    pixelYI %= static_cast<decltype(pixelYI)>(materialTexture.Size.height);
-                    auto const pixelYIOffset = pixelYI * materialTexture.Size.width;
+                        // Wrap integral coordinates
+                        xInterpolationData[xx].pixelXI %= static_cast<register_int>(materialTexture.Size.width);
 
-                    // Next Y
-                    auto const nextPixelYI = (pixelYI + 1) % static_cast<decltype(pixelYI)>(materialTexture.Size.height);
-                    auto const nextPixelYIOffset = nextPixelYI * materialTexture.Size.width;;
+                        // Next X
+                        xInterpolationData[xx].nextPixelXI = (xInterpolationData[xx].pixelXI + 1) % static_cast<register_int>(materialTexture.Size.width);
 
-                    assert(pixelYI >= 0 && pixelYI < materialTexture.Size.height);
-                    assert(pixelDy >= 0.0f && pixelDy < 1.0f);
-                    assert(nextPixelYI >= 0 && nextPixelYI < materialTexture.Size.height);
+                        assert(xInterpolationData[xx].pixelXI >= 0 && xInterpolationData[xx].pixelXI < materialTexture.Size.width);
+                        assert(xInterpolationData[xx].pixelDx >= 0.0f && xInterpolationData[xx].pixelDx < 1.0f);
+                        assert(xInterpolationData[xx].nextPixelXI >= 0 && xInterpolationData[xx].nextPixelXI < materialTexture.Size.width);
+                    }
 
                     //
-                    // Loop for all Xs
+                    // Fill quad with color multiply-blended with "bump map" texture
                     //
 
-                    for (int xx = 0; xx < magnificationFactor; ++xx)
+                    int const baseTargetQuadOffset = (x + y * targetTextureWidth) * magnificationFactor;
+
+                    float worldY = static_cast<float>(y);
+                    for (int yy = 0; yy < magnificationFactor; ++yy, worldY += magnificationFactorInvF)
                     {
+                        int const targetQuadOffset = baseTargetQuadOffset + yy * targetTextureWidth;
+
                         //
-                        // Bilinear interpolation for X
+                        // Prepare bilinear interpolation for Y
                         //
 
-                        // Linear interpolation between x samples at bottom
-                        vec2f const interpolatedXColorBottom = Mix(
-                            materialTexture.Data[xInterpolationData[xx].pixelXI + pixelYIOffset],
-                            materialTexture.Data[xInterpolationData[xx].nextPixelXI + pixelYIOffset],
-                            xInterpolationData[xx].pixelDx);
+                        float const pixelY = worldY * worldToMaterialTexturePixelConversionFactor;
 
-                        // Linear interpolation between x samples at top
-                        vec2f const interpolatedXColorTop = Mix(
-                            materialTexture.Data[xInterpolationData[xx].pixelXI + nextPixelYIOffset],
-                            materialTexture.Data[xInterpolationData[xx].nextPixelXI + nextPixelYIOffset],
-                            xInterpolationData[xx].pixelDx);
+                        // Integral part
+                        auto pixelYI = FastTruncateToArchInt(pixelY);
 
-                        // Linear interpolation between two vertical samples
-                        vec2f const bumpMapSample = Mix(
-                            interpolatedXColorBottom,
-                            interpolatedXColorTop,
-                            pixelDy);
+                        // Fractional part between index and next index
+                        float const pixelDy = pixelY - pixelYI;
+
+                        // Wrap integral coordinates
+                        pixelYI %= static_cast<decltype(pixelYI)>(materialTexture.Size.height);
+                        auto const pixelYIOffset = pixelYI * materialTexture.Size.width;
+
+                        // Next Y
+                        auto const nextPixelYI = (pixelYI + 1) % static_cast<decltype(pixelYI)>(materialTexture.Size.height);
+                        auto const nextPixelYIOffset = nextPixelYI * materialTexture.Size.width;;
+
+                        assert(pixelYI >= 0 && pixelYI < materialTexture.Size.height);
+                        assert(pixelDy >= 0.0f && pixelDy < 1.0f);
+                        assert(nextPixelYI >= 0 && nextPixelYI < materialTexture.Size.height);
 
                         //
-                        // Bi-directional multiply blending between structural color and bumpmap sample "value" (just r),
-                        // blended again with structural color via material transparency
+                        // Loop for all Xs
                         //
 
-                        float const whateverFactor = (2.0f * bumpMapSample.x - 1.0f) * materialTextureAlpha;
-
-                        vec3f resultantColor;
-                        if (bumpMapSample.x <= 0.5f)
-                        {
-                            // Damper: input * [0.0, 1.0]
-                            // Then: mix of input and of result of multiply-blend, via materialTextureAlpha
-                            resultantColor = structurePixelColorF * (1.0f + whateverFactor);
-                        }
-                        else
+                        for (int xx = 0; xx < magnificationFactor; ++xx)
                         {
-                            // Amplifier: input + (bump - input) * [0.0, 1.0]
-                            // Then: mix of input and of result of multiply-blend, via materialTextureAlpha
-                            float const bFactor = bumpMapSample.x * whateverFactor;
-                            resultantColor = structurePixelColorF * (1.0f - whateverFactor) + vec3f(bFactor, bFactor, bFactor);
+                            //
+                            // Bilinear interpolation for X
+                            //
+
+                            // Linear interpolation between x samples at bottom
+                            vec2f const interpolatedXColorBottom = Mix(
+                                materialTexture.Data[xInterpolationData[xx].pixelXI + pixelYIOffset],
+                                materialTexture.Data[xInterpolationData[xx].nextPixelXI + pixelYIOffset],
+                                xInterpolationData[xx].pixelDx);
+
+                            // Linear interpolation between x samples at top
+                            vec2f const interpolatedXColorTop = Mix(
+                                materialTexture.Data[xInterpolationData[xx].pixelXI + nextPixelYIOffset],
+                                materialTexture.Data[xInterpolationData[xx].nextPixelXI + nextPixelYIOffset],
+                                xInterpolationData[xx].pixelDx);
+
+                            // Linear interpolation between two vertical samples
+                            vec2f const bumpMapSample = Mix(
+                                interpolatedXColorBottom,
+                                interpolatedXColorTop,
+                                pixelDy);
+
+                            //
+                            // Bi-directional multiply blending between structural color and bumpmap sample "value" (just r),
+                            // blended again with structural color via material transparency
+                            //
+
+                            float const whateverFactor = (2.0f * bumpMapSample.x - 1.0f) * materialTextureAlpha;
+
+                            vec3f resultantColor;
+                            if (bumpMapSample.x <= 0.5f)
+                            {
+                                // Damper: input * [0.0, 1.0]
+                                // Then: mix of input and of result of multiply-blend, via materialTextureAlpha
+                                resultantColor = structurePixelColorF * (1.0f + whateverFactor);
+                            }
+                            else
+                            {
+                                // Amplifier: input + (bump - input) * [0.0, 1.0]
+                                // Then: mix of input and of result of multiply-blend, via materialTextureAlpha
+                                float const bFactor = bumpMapSample.x * whateverFactor;
+                                resultantColor = structurePixelColorF * (1.0f - whateverFactor) + vec3f(bFactor, bFactor, bFactor);
+                            }
+
+                            // Store resultant color, using structure's alpha channel value as the final alpha
+                            targetImageData[targetQuadOffset + xx] = rgbaColor(
+                                resultantColor,
+                                structurePixelColor.a);
                         }
-
-                        // Store resultant color, using structure's alpha channel value as the final alpha
-                        targetImageData[targetQuadOffset + xx] = rgbaColor(
-                            resultantColor,
-                            structurePixelColor.a);
                     }
                 }
             }
         }
-    }
+    };
+
+    RunRowsConcurrently(
+        structuralLayerRegion,
+        magnificationFactor,
+        texturizeRows);
 }
 
 RgbaImageData ShipTexturizer::MakeInteriorViewTexture(
@@ -345,22 +497,8 @@ RgbaImageData ShipTexturizer::MakeInteriorViewTexture(
     // Visit all triangles and render their floors
     //
 
-    vec2f const shipSizeF = shipSize.ToFloat();
     vec2f const textureSizeF = interiorView.Size.ToFloat();
-
-    // Size of the quad occupied by two triangles adjoined along
-    // their diagonals, in pixels
-    ImageSize const quadSize = ImageSize::FromFloatFloor(textureSizeF / shipSizeF);
-
-    // Thickness of a floor, in pixels
-    //
-    // Futurework: should incorporate ship's scale, as now we calculate thickness assuming
-    // width and height are 1:1 with meters
-    int const floorThickness = std::max(
-        std::max(
-            quadSize.width / 10,
-            quadSize.height / 10),
-        2);
+    int const floorThickness = CalculateInteriorViewFloorThickness(shipSize, interiorView.Size);
 
     for (auto const t : triangles)
     {
@@ -380,6 +518,40 @@ RgbaImageData ShipTexturizer::MakeInteriorViewTexture(
     return interiorView;
 }
 
+std::vector<InteriorViewFloorVertex> ShipTexturizer::MakeInteriorViewFloorVertices(
+    Physics::Triangles const & triangles,
+    Physics::Points const & points,
+    ShipSpaceSize const & shipSize,
+    ImageSize const & textureSize) const
+{
+    auto const startTime = GameChronometer::Now();
+
+    vec2f const textureSizeF = textureSize.ToFloat();
+    int const floorThickness = CalculateInteriorViewFloorThickness(shipSize, textureSize);
+
+    std::vector<InteriorViewFloorVertex> floorVertices;
+
+    for (auto const t : triangles)
+    {
+        VisitTriangleFloorEdges(
+            t,
+            points,
+            triangles,
+            textureSizeF,
+            floorThickness,
+            [&floorVertices](FloorEdge const & edge)
+            {
+                AppendFloorEdgeVertices(edge, floorVertices);
+            });
+    }
+
+    LogMessage("ShipTexturizer: completed interior view floors:",
+        " shipSize=", shipSize, " textureSize=", textureSize, " vertices=", floorVertices.size(),
+        " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
+
+    return floorVertices;
+}
+
 void ShipTexturizer::RenderShipInto(
     StructuralLayerData const & structuralLayer,
     ShipSpaceRect const & structuralLayerRegion,
@@ -450,152 +622,157 @@ void ShipTexturizer::RenderShipInto(
     auto const & structuralBuffer = structuralLayer.Buffer;
     auto targetImageData = targetTextureImage.Data.get();
 
-    int const startY = structuralLayerRegion.origin.y;
-    int const endY = structuralLayerRegion.origin.y + structuralLayerRegion.size.height;
-
     int const startX = structuralLayerRegion.origin.x;
     int const endX = structuralLayerRegion.origin.x + structuralLayerRegion.size.width;
 
-    for (int y = startY; y < endY; ++y)
+    auto const renderRows = [&](int startY, int endY)
     {
-        for (int x = startX; x < endX; ++x)
+        for (int y = startY; y < endY; ++y)
         {
-            //
-            // We now populate the target texture in the quad whose corners lie at these coordinates (in the target texture):
-            //
-            // 3:(x * magnificationFactor, (y + 1) * magnificationFactor) ... 4:((x + 1) * magnificationFactor, (y + 1) * magnificationFactor)
-            // ...
-            // ...
-            // ...
-            // 1:[x * magnificationFactor, y * magnificationFactor] ... 2:((x + 1) * magnificationFactor, y * magnificationFactor)
-            //
-            // We actually populate quads or triangles (with |side|==magnificationFactor), depending on the presence of the four corners. We do so by:
-            //  - Looping for all target YY's in the quad
-            //  - For each YY:
-            //      - Fill-in the XX segment between xxStart and xxEnd, and transparent outside (prefix and suffix)
-            //      - Change xxStart and xxEnd depending on Y
-            //
-
-            //
-            // Determine quad vertices
-            //
-
-            // Init with no quad - prefix only
-            int xxStart = magnificationFactor, xxStartIncr = 0;
-            int xxEnd = magnificationFactor, xxEndIncr = 0;
-
-            bool const hasVertex1 = structuralBuffer[{x, y}].Material != nullptr;
-
-            ShipSpaceCoordinates const coords2 = ShipSpaceCoordinates(x + 1, y);
-            bool const hasVertex2 = coords2.IsInSize(structuralSize) && structuralBuffer[coords2].Material != nullptr;
-
-            ShipSpaceCoordinates const coords3 = ShipSpaceCoordinates(x, y + 1);
-            bool const hasVertex3 = coords3.IsInSize(structuralSize) && structuralBuffer[coords3].Material != nullptr;
-
-            ShipSpaceCoordinates const coords4 = ShipSpaceCoordinates(x + 1, y + 1);
-            bool const hasVertex4 = coords4.IsInSize(structuralSize) && structuralBuffer[coords4].Material != nullptr;
-
-            if (hasVertex1)
+            for (int x = startX; x < endX; ++x)
             {
-                if (hasVertex2)
+                //
+                // We now populate the target texture in the quad whose corners lie at these coordinates (in the target texture):
+                //
+                // 3:(x * magnificationFactor, (y + 1) * magnificationFactor) ... 4:((x + 1) * magnificationFactor, (y + 1) * magnificationFactor)
+                // ...
+                // ...
+                // ...
+                // 1:[x * magnificationFactor, y * magnificationFactor] ... 2:((x + 1) * magnificationFactor, y * magnificationFactor)
+                //
+                // We actually populate quads or triangles (with |side|==magnificationFactor), depending on the presence of the four corners. We do so by:
+                //  - Looping for all target YY's in the quad
+                //  - For each YY:
+                //      - Fill-in the XX segment between xxStart and xxEnd, and transparent outside (prefix and suffix)
+                //      - Change xxStart and xxEnd depending on Y
+                //
+
+                //
+                // Determine quad vertices
+                //
+
+                // Init with no quad - prefix only
+                int xxStart = magnificationFactor, xxStartIncr = 0;
+                int xxEnd = magnificationFactor, xxEndIncr = 0;
+
+                bool const hasVertex1 = structuralBuffer[{x, y}].Material != nullptr;
+
+                ShipSpaceCoordinates const coords2 = ShipSpaceCoordinates(x + 1, y);
+                bool const hasVertex2 = coords2.IsInSize(structuralSize) && structuralBuffer[coords2].Material != nullptr;
+
+                ShipSpaceCoordinates const coords3 = ShipSpaceCoordinates(x, y + 1);
+                bool const hasVertex3 = coords3.IsInSize(structuralSize) && structuralBuffer[coords3].Material != nullptr;
+
+                ShipSpaceCoordinates const coords4 = ShipSpaceCoordinates(x + 1, y + 1);
+                bool const hasVertex4 = coords4.IsInSize(structuralSize) && structuralBuffer[coords4].Material != nullptr;
+
+                if (hasVertex1)
                 {
-                    if (hasVertex3)
+                    if (hasVertex2)
                     {
-                        if (hasVertex4)
+                        if (hasVertex3)
                         {
-                            // Whole quad
-                            xxStart = 0; xxStartIncr = 0;
-                            xxEnd = magnificationFactor; xxEndIncr = 0;
+                            if (hasVertex4)
+                            {
+                                // Whole quad
+                                xxStart = 0; xxStartIncr = 0;
+                                xxEnd = magnificationFactor; xxEndIncr = 0;
+                            }
+                            else
+                            {
+                                // 3
+                                // |
+                                // 1---2
+
+                                xxStart = 0; xxStartIncr = 0;
+                                xxEnd = magnificationFactor; xxEndIncr = -1;
+                            }
                         }
-                        else
+                        else if (hasVertex4)
                         {
-                            // 3
-                            // |
+                            //     4
+                            //     |
                             // 1---2
 
-                            xxStart = 0; xxStartIncr = 0;
-                            xxEnd = magnificationFactor; xxEndIncr = -1;
+                            xxStart = 0; xxStartIncr = 1;
+                            xxEnd = magnificationFactor; xxEndIncr = 0;
                         }
                     }
-                    else if (hasVertex4)
+                    else
                     {
-                        //     4
-                        //     |
-                        // 1---2
+                        // No vertex 2
 
-                        xxStart = 0; xxStartIncr = 1;
-                        xxEnd = magnificationFactor; xxEndIncr = 0;
+                        if (hasVertex3 && hasVertex4)
+                        {
+                            // 3---4
+                            // |
+                            // 1
+
+                            xxStart = 0; xxStartIncr = 0;
+                            xxEnd = 1; xxEndIncr = 1;
+                        }
                     }
                 }
                 else
                 {
-                    // No vertex 2
+                    // No vertex 1
 
-                    if (hasVertex3 && hasVertex4)
+                    if (hasVertex2 && hasVertex3 && hasVertex4)
                     {
                         // 3---4
-                        // |
-                        // 1
+                        //     |
+                        //     2
 
-                        xxStart = 0; xxStartIncr = 0;
-                        xxEnd = 1; xxEndIncr = 1;
+                        xxStart = magnificationFactor - 1; xxStartIncr = -1;
+                        xxEnd = magnificationFactor; xxEndIncr = 0;
                     }
                 }
-            }
-            else
-            {
-                // No vertex 1
 
-                if (hasVertex2 && hasVertex3 && hasVertex4)
-                {
-                    // 3---4
-                    //     |
-                    //     2
-
-                    xxStart = magnificationFactor - 1; xxStartIncr = -1;
-                    xxEnd = magnificationFactor; xxEndIncr = 0;
-                }
-            }
-
-            //
-            // Fill-in quad
-            //
+                //
+                // Fill-in quad
+                //
 
-            int targetQuadOffset =
-                (y * magnificationFactor) * targetTextureWidth
-                + x * magnificationFactor;
+                int targetQuadOffset =
+                    (y * magnificationFactor) * targetTextureWidth
+                    + x * magnificationFactor;
 
-            for (int yy = 0;
-                yy < magnificationFactor;
-                ++yy, xxStart += xxStartIncr, xxEnd += xxEndIncr, targetQuadOffset += targetTextureWidth)
-            {
-                // Prefix - fill with empty
-                assert(0 <= xxStart && xxStart <= magnificationFactor);
-                for (int xx = 0; xx < xxStart; ++xx)
+                for (int yy = 0;
+                    yy < magnificationFactor;
+                    ++yy, xxStart += xxStartIncr, xxEnd += xxEndIncr, targetQuadOffset += targetTextureWidth)
                 {
-                    targetImageData[targetQuadOffset + xx] = TransparentColor;
-                }
+                    // Prefix - fill with empty
+                    assert(0 <= xxStart && xxStart <= magnificationFactor);
+                    for (int xx = 0; xx < xxStart; ++xx)
+                    {
+                        targetImageData[targetQuadOffset + xx] = TransparentColor;
+                    }
 
-                // Body - fill with source texture
-                for (int xx = xxStart; xx < xxEnd; ++xx)
-                {
-                    rgbaColor const textureSample = SampleTextureBilinearConstrained(
-                        sourceTextureImage,
-                        sampleOffsetX + targetTextureSpaceToSourceTextureSpaceX * (x * magnificationFactor + xx),
-                        sampleOffsetY + targetTextureSpaceToSourceTextureSpaceY * (y * magnificationFactor + yy));
+                    // Body - fill with source texture
+                    for (int xx = xxStart; xx < xxEnd; ++xx)
+                    {
+                        rgbaColor const textureSample = SampleTextureBilinearConstrained(
+                            sourceTextureImage,
+                            sampleOffsetX + targetTextureSpaceToSourceTextureSpaceX * (x * magnificationFactor + xx),
+                            sampleOffsetY + targetTextureSpaceToSourceTextureSpaceY * (y * magnificationFactor + yy));
 
-                    targetImageData[targetQuadOffset + xx] = textureSample;
-                }
+                        targetImageData[targetQuadOffset + xx] = textureSample;
+                    }
 
-                // Suffix - fill with empty
-                assert(0 <= xxEnd && xxEnd <= magnificationFactor);
-                for (int xx = xxEnd; xx < magnificationFactor; ++xx)
-                {
-                    targetImageData[targetQuadOffset + xx] = TransparentColor;
+                    // Suffix - fill with empty
+                    assert(0 <= xxEnd && xxEnd <= magnificationFactor);
+                    for (int xx = xxEnd; xx < magnificationFactor; ++xx)
+                    {
+                        targetImageData[targetQuadOffset + xx] = TransparentColor;
+                    }
                 }
             }
         }
-    }
+    };
+
+    RunRowsConcurrently(
+        structuralLayerRegion,
+        magnificationFactor,
+        renderRows);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -660,6 +837,9 @@ RgbaImageData ShipTexturizer::MakeMaterialTextureSample(
     // Create output image
     auto sampleData = std::make_unique<rgbaColor[]>(sampleSize.GetLinearSize());
 
+    // Previous operations' textures may now be purged
+    mMaterialTextureCachePinTick = mMaterialTextureCacheTick;
+
     // Get bump map texture and render color
     Vec2fImageData const & materialTexture = GetMaterialTexture(textureName, assetManager);
     vec3f const renderPixelColorF = renderColor.toVec3f();
@@ -712,96 +892,223 @@ ShipTexturizer::Vec2fImageData const & ShipTexturizer::GetMaterialTexture(
     if (it != mMaterialTextureCache.end())
     {
         // Texture is cached
-        ++it->second.UseCount;
+        it->second.LastUseTick = ++mMaterialTextureCacheTick;
         return it->second.Texture;
     }
     else
     {
         // Have to load texture
+        assert(mMaterialTextureNameToTextureRelativePathMap.count(actualTextureName) > 0);
+        return InsertIntoMaterialTextureCache(
+            actualTextureName,
+            LoadMaterialTexture(mMaterialTextureNameToTextureRelativePathMap.at(actualTextureName), assetManager));
+    }
+}
 
-        // Check whether need to make room in the cache, first
-        if (mMaterialTextureCache.size() + 1 >= MaterialTextureCacheSizeHighWatermark)
-        {
-            PurgeMaterialTextureCache(MaterialTextureCacheSizeLowWatermark);
-        }
+ShipTexturizer::Vec2fImageData ShipTexturizer::LoadMaterialTexture(
+    std::string const & textureRelativePath,
+    IAssetManager const & assetManager)
+{
+    RgbImageData texture = assetManager.LoadMaterialTexture(textureRelativePath);
 
-        // Load texture
-        assert(mMaterialTextureNameToTextureRelativePathMap.count(actualTextureName) > 0);
-        RgbImageData texture = assetManager.LoadMaterialTexture(mMaterialTextureNameToTextureRelativePathMap.at(actualTextureName));
+    // Convert to vec2f
+    auto const pixelCount = texture.Size.GetLinearSize();
+    std::unique_ptr<vec2f[]> vec2fTexture = std::make_unique<vec2f[]>(pixelCount);
+    for (size_t p = 0; p < pixelCount; ++p)
+    {
+        assert(texture.Data[p].r == texture.Data[p].g);
+        assert(texture.Data[p].r == texture.Data[p].b);
+
+        vec2fTexture[p] = vec2f(
+            static_cast<float>(texture.Data[p].r) / 255.0f,
+            1.0f); // Alpha: at this moment we hardcode it as opaque, we'll think whether we want to make transparent chains
+    }
+
+    return Vec2fImageData(texture.Size, std::move(vec2fTexture));
+}
 
-        // Convert to vec2f
-        auto const pixelCount = texture.Size.GetLinearSize();
-        std::unique_ptr<vec2f[]> vec2fTexture = std::make_unique<vec2f[]>(pixelCount);
-        for (size_t p = 0; p < pixelCount; ++p)
+void ShipTexturizer::PreloadMaterialTextures(
+    StructuralLayerData const & structuralLayer,
+    ShipSpaceRect const & structuralLayerRegion,
+    IAssetManager const & assetManager) const
+{
+    //
+    // Find the textures used by the region which are not in the cache
+    //
+
+    std::vector<std::string> missingTextureNames;
+
+    ForEachMaterialInRegion(
+        structuralLayer,
+        structuralLayerRegion,
+        [&](StructuralMaterial const & material)
         {
-            assert(texture.Data[p].r == texture.Data[p].g);
-            assert(texture.Data[p].r == texture.Data[p].b);
+            std::string const textureName = material.MaterialTextureName.value_or(MaterialTextureNameNone);
+            if (mMaterialTextureCache.count(textureName) == 0
+                && std::find(missingTextureNames.cbegin(), missingTextureNames.cend(), textureName) == missingTextureNames.cend())
+            {
+                missingTextureNames.push_back(textureName);
+            }
+        });
+
+    if (missingTextureNames.size() < 2)
+    {
+        // Nothing to gain from loading concurrently
+        return;
+    }
+
+    //
+    // Load them with a few workers - this thread being one of them
+    //
+
+    auto const startTime = GameChronometer::Now();
+
+    std::vector<std::optional<Vec2fImageData>> loadedTextures(missingTextureNames.size());
+    std::vector<std::exception_ptr> loadExceptions(missingTextureNames.size());
+    std::atomic<size_t> nextTextureIndex(0);
 
-            vec2fTexture[p] = vec2f(
-                static_cast<float>(texture.Data[p].r) / 255.0f,
-                1.0f); // Alpha: at this moment we hardcode it as opaque, we'll think whether we want to make transparent chains
+    auto const runWorker = [&]()
+    {
+        for (size_t t = nextTextureIndex++; t < missingTextureNames.size(); t = nextTextureIndex++)
+        {
+            try
+            {
+                assert(mMaterialTextureNameToTextureRelativePathMap.count(missingTextureNames[t]) > 0);
+                loadedTextures[t].emplace(
+                    LoadMaterialTexture(mMaterialTextureNameToTextureRelativePathMap.at(missingTextureNames[t]), assetManager));
+            }
+            catch (...)
+            {
+                loadExceptions[t] = std::current_exception();
+            }
         }
+    };
 
-        // Insert texture into cache
-        auto const inserted = mMaterialTextureCache.emplace(
-            actualTextureName,
-            Vec2fImageData(texture.Size, std::move(vec2fTexture)));
+    size_t const workerCount = std::min({ MaxMaterialTexturePreloadWorkers, ThreadManager::GetNumberOfProcessors(), missingTextureNames.size() });
+
+    std::vector<std::thread> workerThreads;
+    for (size_t w = 1; w < workerCount; ++w)
+    {
+        workerThreads.emplace_back(runWorker);
+    }
 
-        assert(inserted.second);
+    runWorker();
 
-        return inserted.first->second.Texture;
+    for (auto & workerThread : workerThreads)
+    {
+        workerThread.join();
     }
-}
 
-void ShipTexturizer::ResetMaterialTextureCacheUseCounts() const
-{
-    std::for_each(
-        mMaterialTextureCache.begin(),
-        mMaterialTextureCache.end(),
-        [](auto & kv)
+    for (auto const & loadException : loadExceptions)
+    {
+        if (loadException)
         {
-            kv.second.UseCount = 0;
-        });
+            std::rethrow_exception(loadException);
+        }
+    }
+
+    //
+    // Populate cache
+    //
+
+    for (size_t t = 0; t < missingTextureNames.size(); ++t)
+    {
+        assert(loadedTextures[t].has_value());
+        InsertIntoMaterialTextureCache(missingTextureNames[t], std::move(*loadedTextures[t]));
+    }
+
+    LogMessage("ShipTexturizer: preloaded ", missingTextureNames.size(), " material textures with ", workerCount, " workers:",
+        " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
 }
 
-void ShipTexturizer::PurgeMaterialTextureCache(size_t maxSize) const
+ShipTexturizer::Vec2fImageData const & ShipTexturizer::InsertIntoMaterialTextureCache(
+    std::string const & textureName,
+    Vec2fImageData && texture) const
 {
-    LogMessage("ShipTexturizer: purging ", maxSize, " material texture cache elements");
+    size_t const textureByteSize = texture.Size.GetLinearSize() * sizeof(vec2f);
+
+    // Make room in the cache, first
+    if (mMaterialTextureCacheByteSize + textureByteSize > MaterialTextureCacheMaxByteSize)
+    {
+        PurgeMaterialTextureCache(
+            MaterialTextureCacheMaxByteSize - std::min(textureByteSize, MaterialTextureCacheMaxByteSize));
+    }
+
+    auto const inserted = mMaterialTextureCache.emplace(
+        textureName,
+        CachedTexture(
+            std::move(texture),
+            ++mMaterialTextureCacheTick));
+
+    assert(inserted.second);
 
-    // Create vector with keys and usage counts
-    std::vector<std::pair<std::string, size_t>> keyUsages;
+    mMaterialTextureCacheByteSize += textureByteSize;
+
+    return inserted.first->second.Texture;
+}
+
+void ShipTexturizer::PurgeMaterialTextureCache(size_t maxByteSize) const
+{
+    // Sort keys by last use, least recent first
+    std::vector<std::pair<std::string, std::uint64_t>> keyUses;
     std::transform(
         mMaterialTextureCache.cbegin(),
         mMaterialTextureCache.cend(),
-        std::back_inserter(keyUsages),
-        [](auto const & it) ->std::pair<std::string, size_t>
+        std::back_inserter(keyUses),
+        [](auto const & it) -> std::pair<std::string, std::uint64_t>
         {
-            return std::make_pair(it.first, it.second.UseCount);
+            return std::make_pair(it.first, it.second.LastUseTick);
         });
 
-    // Sorty by usage count, ascending
     std::sort(
-        keyUsages.begin(),
-        keyUsages.end(),
+        keyUses.begin(),
+        keyUses.end(),
         [](auto const & lhs, auto const & rhs)
         {
             return lhs.second < rhs.second;
         });
 
-    // Trim the top elements
-    for (size_t i = 0; i < maxSize && i < keyUsages.size(); ++i)
+    // Evict until we're within budget, sparing the textures in use by the current operation
+    size_t purgedCount = 0;
+    for (size_t i = 0; i < keyUses.size() && keyUses[i].second <= mMaterialTextureCachePinTick && mMaterialTextureCacheByteSize > maxByteSize; ++i, ++purgedCount)
     {
-        mMaterialTextureCache.erase(keyUsages[i].first);
+        auto const it = mMaterialTextureCache.find(keyUses[i].first);
+        assert(it != mMaterialTextureCache.end());
+
+        mMaterialTextureCacheByteSize -= it->second.Texture.Size.GetLinearSize() * sizeof(vec2f);
+        mMaterialTextureCache.erase(it);
     }
+
+    LogMessage("ShipTexturizer: purged ", purgedCount, " material texture cache elements");
 }
 
-void ShipTexturizer::DrawTriangleFloorInto(
+int ShipTexturizer::CalculateInteriorViewFloorThickness(
+    ShipSpaceSize const & shipSize,
+    ImageSize const & textureSize)
+{
+    // Size of the quad occupied by two triangles adjoined along
+    // their diagonals, in pixels
+    ImageSize const quadSize = ImageSize::FromFloatFloor(textureSize.ToFloat() / shipSize.ToFloat());
+
+    // Thickness of a floor, in pixels
+    //
+    // Futurework: should incorporate ship's scale, as now we calculate thickness assuming
+    // width and height are 1:1 with meters
+    return std::max(
+        std::max(
+            quadSize.width / 10,
+            quadSize.height / 10),
+        2);
+}
+
+template<typename TVisitor>
+void ShipTexturizer::VisitTriangleFloorEdges(
     ElementIndex triangleIndex,
     Physics::Points const & points,
     Physics::Triangles const & triangles,
     vec2f const & textureSizeF,
     int const floorThickness,
-    RgbaImageData & targetTextureImage) const
+    TVisitor && visitor) const
 {
     //
     // 1. Find minima and maxima
@@ -860,15 +1167,11 @@ void ShipTexturizer::DrawTriangleFloorInto(
                 {
                     // Left |
 
-                    DrawHVEdgeFloorInto(
+                    visitor(FloorEdge::MakeHV(
                         minX - floorThickness / 2, // xStart
                         minX + floorThickness / 2 - 1, // xEnd, included
-                        1, // xIncr,
-                        0, // xLimitIncr
                         yStart,
-                        yEnd,
-                        1, // yIncr
-                        targetTextureImage);
+                        yEnd));
                 }
                 else
                 {
@@ -876,15 +1179,11 @@ void ShipTexturizer::DrawTriangleFloorInto(
 
                     assert(endpointA.x == maxX);
 
-                    DrawHVEdgeFloorInto(
+                    visitor(FloorEdge::MakeHV(
                         maxX - floorThickness / 2, // xStart
                         maxX + floorThickness / 2 - 1, // xEnd, included
-                        1, // xIncr,
-                        0, // xLimitIncr
                         yStart,
-                        yEnd,
-                        1, // yIncr
-                        targetTextureImage);
+                        yEnd));
                 }
             }
             else if (endpointA.y == endpointB.y)
@@ -895,15 +1194,11 @@ void ShipTexturizer::DrawTriangleFloorInto(
                 {
                     // Bottom -
 
-                    DrawHVEdgeFloorInto(
+                    visitor(FloorEdge::MakeHV(
                         minX - floorThickness / 2, // xStart
                         maxX + floorThickness / 2 - 1, // xEnd, included
-                        1, // xIncr
-                        0, // xLimitIncr
                         minY - floorThickness / 2, // yStart
-                        minY + floorThickness / 2 - 1, // yEnd, included
-                        1, // yIncr
-                        targetTextureImage);
+                        minY + floorThickness / 2 - 1)); // yEnd, included
                 }
                 else
                 {
@@ -911,15 +1206,11 @@ void ShipTexturizer::DrawTriangleFloorInto(
 
                     assert(endpointA.y == maxY);
 
-                    DrawHVEdgeFloorInto(
+                    visitor(FloorEdge::MakeHV(
                         minX - floorThickness / 2, // xStart
                         maxX + floorThickness / 2 - 1, // xEnd, included
-                        1, // xIncr
-                        0, // xLimitIncr
                         maxY - floorThickness / 2, // yStart
-                        maxY + floorThickness / 2  - 1, // yEnd, included
-                        1, // yIncr
-                        targetTextureImage);
+                        maxY + floorThickness / 2  - 1)); // yEnd, included
                 }
             }
             else
@@ -936,36 +1227,159 @@ void ShipTexturizer::DrawTriangleFloorInto(
                 {
                     // Left-Right /
 
-                    DrawDEdgeFloorInto(
+                    visitor(FloorEdge::MakeD(
                         (minX - floorThickness / 2 - 1) - 1, // xStart
                         (minX + floorThickness / 2 - 1) + 1, // xEnd, included
-                        1, // xIncr
                         1, // xLimitIncr
                         minX - floorThickness / 2, // absoluteMinX
                         maxX + floorThickness / 2 - 1, // absoluteMaxX
                         yStart,
-                        yEnd,
-                        1, // yIncr
-                        targetTextureImage);
+                        yEnd));
                 }
                 else
                 {
                     // Right-Left \
 
-                    DrawDEdgeFloorInto(
+                    visitor(FloorEdge::MakeD(
                         (maxX - floorThickness / 2) - 1,
                         (maxX + floorThickness / 2) + 1,
-                        1, // xIncr
                         -1, // xLimitIncr
                         minX - floorThickness / 2, // absoluteMinX
                         maxX + floorThickness / 2 - 1, // absoluteMaxX
                         yStart,
-                        yEnd,
-                        1, // yIncr
-                        targetTextureImage);
+                        yEnd));
+                }
+            }
+        }
+    }
+}
+
+void ShipTexturizer::DrawTriangleFloorInto(
+    ElementIndex triangleIndex,
+    Physics::Points const & points,
+    Physics::Triangles const & triangles,
+    vec2f const & textureSizeF,
+    int const floorThickness,
+    RgbaImageData & targetTextureImage) const
+{
+    VisitTriangleFloorEdges(
+        triangleIndex,
+        points,
+        triangles,
+        textureSizeF,
+        floorThickness,
+        [this, &targetTextureImage](FloorEdge const & edge)
+        {
+            if (!edge.IsDiagonal)
+            {
+                DrawHVEdgeFloorInto(
+                    edge.XStart,
+                    edge.XEnd,
+                    1, // xIncr
+                    edge.XLimitIncr,
+                    edge.YStart,
+                    edge.YEnd,
+                    1, // yIncr
+                    targetTextureImage);
+            }
+            else
+            {
+                DrawDEdgeFloorInto(
+                    edge.XStart,
+                    edge.XEnd,
+                    1, // xIncr
+                    edge.XLimitIncr,
+                    edge.AbsoluteMinX,
+                    edge.AbsoluteMaxX,
+                    edge.YStart,
+                    edge.YEnd,
+                    1, // yIncr
+                    targetTextureImage);
+            }
+        });
+}
+
+void ShipTexturizer::AppendFloorEdgeVertices(
+    FloorEdge const & edge,
+    std::vector<InteriorViewFloorVertex> & floorVertices)
+{
+    //
+    // Row k of the edge covers the pixels [XStart + k * XLimitIncr, XEnd + k * XLimitIncr], clipped
+    // to [AbsoluteMinX, AbsoluteMaxX]; as the GPU fills the pixels whose center is inside a triangle,
+    // we make a band that - at the center of each row - extends a quarter of a pixel beyond the centers
+    // of the row's first and last pixels, and clip it against the absolute limits
+    //
+
+    float const rowCount = static_cast<float>(edge.YEnd - edge.YStart + 1);
+    float const xLimitIncr = static_cast<float>(edge.XLimitIncr);
+    float const bottomY = static_cast<float>(edge.YStart);
+    float const topY = bottomY + rowCount;
+    float const absoluteMinX = static_cast<float>(edge.AbsoluteMinX);
+    float const absoluteMaxX = static_cast<float>(edge.AbsoluteMaxX + 1);
+
+    auto const appendBand = [&](int xStart, int xEnd, float alpha)
+    {
+        // The band, counter-clockwise
+        std::array<vec2f, 8> polygon;
+        size_t polygonSize = 4;
+        polygon[0] = vec2f(static_cast<float>(xStart) - xLimitIncr * 0.5f + 0.25f, bottomY);
+        polygon[1] = vec2f(static_cast<float>(xEnd) - xLimitIncr * 0.5f + 0.75f, bottomY);
+        polygon[2] = vec2f(static_cast<float>(xEnd) + xLimitIncr * (rowCount - 0.5f) + 0.75f, topY);
+        polygon[3] = vec2f(static_cast<float>(xStart) + xLimitIncr * (rowCount - 0.5f) + 0.25f, topY);
+
+        // Clip against x >= absoluteMinX (sign=1) and x <= absoluteMaxX (sign=-1)
+        auto const clip = [&](float limitX, float sign)
+        {
+            std::array<vec2f, 8> clipped;
+            size_t clippedSize = 0;
+
+            for (size_t v = 0; v < polygonSize; ++v)
+            {
+                vec2f const & p1 = polygon[v];
+                vec2f const & p2 = polygon[(v + 1) % polygonSize];
+
+                float const d1 = (p1.x - limitX) * sign;
+                float const d2 = (p2.x - limitX) * sign;
+
+                if (d1 >= 0.0f)
+                {
+                    clipped[clippedSize++] = p1;
+                }
+
+                if ((d1 >= 0.0f) != (d2 >= 0.0f))
+                {
+                    float const t = d1 / (d1 - d2);
+                    clipped[clippedSize++] = vec2f(limitX, p1.y + (p2.y - p1.y) * t);
                 }
             }
+
+            polygon = clipped;
+            polygonSize = clippedSize;
+        };
+
+        clip(absoluteMinX, 1.0f);
+        clip(absoluteMaxX, -1.0f);
+
+        // Fan
+        vec4f const color = vec4f(0.0f, 0.0f, 0.0f, alpha);
+        for (size_t v = 2; v < polygonSize; ++v)
+        {
+            floorVertices.emplace_back(color, polygon[0].x, polygon[0].y);
+            floorVertices.emplace_back(color, polygon[v - 1].x, polygon[v - 1].y);
+            floorVertices.emplace_back(color, polygon[v].x, polygon[v].y);
         }
+    };
+
+    if (!edge.IsDiagonal)
+    {
+        appendBand(edge.XStart, edge.XEnd, 1.0f);
+    }
+    else
+    {
+        // See DrawDEdgeFloorInto: the first and the last pixel of each row are anti-aliased
+        appendBand(edge.XStart + 1, edge.XEnd - 1, 1.0f);
+        appendBand(edge.XStart, edge.XStart, 0.20f);
+        appendBand(edge.XEnd, edge.XEnd, 0.20f);
     }
 }
 
@@ -10,14 +10,18 @@
 #include "Physics/Physics.h"
 #include "ShipAutoTexturizationSettings.h"
 
+#include <Render/InteriorViewRasterizer.h>
+
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
 #include <Core/Vectors.h>
 
 #include <cassert>
+#include <cstdint>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 class ShipTexturizer
 {
@@ -41,6 +45,14 @@ public:
         int maxTextureSize,
         IAssetManager const & assetManager) const;
 
+    /*
+     * The texture of the interior view of ships that come without one.
+     */
+    RgbaImageData MakeInteriorAutoTexture(
+        StructuralLayerData const & structuralLayer,
+        int maxTextureSize,
+        IAssetManager const & assetManager) const;
+
     void AutoTexturizeInto(
         StructuralLayerData const & structuralLayer,
         ShipSpaceRect const & structuralLayerRegion,
@@ -55,6 +67,16 @@ public:
         ShipSpaceSize const & shipSize,
         RgbaImageData const & backgroundTexture) const;
 
+    /*
+     * The floors that MakeInteriorViewTexture draws onto the background texture, as triangles
+     * for the GPU to draw them - yielding the same pixels.
+     */
+    std::vector<InteriorViewFloorVertex> MakeInteriorViewFloorVertices(
+        Physics::Triangles const & triangles,
+        Physics::Points const & points,
+        ShipSpaceSize const & shipSize,
+        ImageSize const & textureSize) const;
+
     void RenderShipInto(
         StructuralLayerData const & structuralLayer,
         ShipSpaceRect const & structuralLayerRegion,
@@ -129,9 +151,75 @@ private:
         std::optional<std::string> const & textureName,
         IAssetManager const & assetManager) const;
 
-    void ResetMaterialTextureCacheUseCounts() const;
+    static Vec2fImageData LoadMaterialTexture(
+        std::string const & textureRelativePath,
+        IAssetManager const & assetManager);
+
+    void PreloadMaterialTextures(
+        StructuralLayerData const & structuralLayer,
+        ShipSpaceRect const & structuralLayerRegion,
+        IAssetManager const & assetManager) const;
+
+    Vec2fImageData const & InsertIntoMaterialTextureCache(
+        std::string const & textureName,
+        Vec2fImageData && texture) const;
+
+    void PurgeMaterialTextureCache(size_t maxByteSize) const;
+
+    /*
+     * The pixels of a floor along a triangle edge: rows from YStart to YEnd, the first of which
+     * spans from XStart to XEnd, each subsequent one shifted by XLimitIncr, and all
+     * clipped to [AbsoluteMinX, AbsoluteMaxX].
+     */
+    struct FloorEdge
+    {
+        int XStart;
+        int XEnd; // Included
+        int XLimitIncr;
+        int AbsoluteMinX;
+        int AbsoluteMaxX; // Included
+        int YStart;
+        int YEnd; // Included
+        bool IsDiagonal; // Diagonal edges are anti-aliased on the first and last pixel of each row
+
+        static FloorEdge MakeHV(
+            int xStart,
+            int xEnd,
+            int yStart,
+            int yEnd)
+        {
+            return FloorEdge{ xStart, xEnd, 0, xStart, xEnd, yStart, yEnd, false };
+        }
+
+        static FloorEdge MakeD(
+            int xStart,
+            int xEnd,
+            int xLimitIncr,
+            int absoluteMinX,
+            int absoluteMaxX,
+            int yStart,
+            int yEnd)
+        {
+            return FloorEdge{ xStart, xEnd, xLimitIncr, absoluteMinX, absoluteMaxX, yStart, yEnd, true };
+        }
+    };
+
+    static int CalculateInteriorViewFloorThickness(
+        ShipSpaceSize const & shipSize,
+        ImageSize const & textureSize);
+
+    template<typename TVisitor>
+    inline void VisitTriangleFloorEdges(
+        ElementIndex triangleIndex,
+        Physics::Points const & points,
+        Physics::Triangles const & triangles,
+        vec2f const & textureSizeF,
+        int const floorThickness,
+        TVisitor && visitor) const;
 
-    void PurgeMaterialTextureCache(size_t maxSize) const;
+    static void AppendFloorEdgeVertices(
+        FloorEdge const & edge,
+        std::vector<InteriorViewFloorVertex> & floorVertices);
 
     inline void DrawTriangleFloorInto(
         ElementIndex triangleIndex,
@@ -191,13 +279,18 @@ private:
     struct CachedTexture
     {
         Vec2fImageData Texture;
-        size_t UseCount;
+        std::uint64_t LastUseTick; // For LRU eviction
 
-        CachedTexture(Vec2fImageData && texture)
+        CachedTexture(
+            Vec2fImageData && texture,
+            std::uint64_t lastUseTick)
             : Texture(std::move(texture))
-            , UseCount(0)
+            , LastUseTick(lastUseTick)
         {}
     };
 
     mutable std::unordered_map<std::string, CachedTexture> mMaterialTextureCache;
+    mutable size_t mMaterialTextureCacheByteSize;
+    mutable std::uint64_t mMaterialTextureCacheTick;
+    mutable std::uint64_t mMaterialTextureCachePinTick; // Textures used after this tick may not be purged
 };
@@ -8,14 +8,25 @@
 #include "ISimulationEventHandlers.h"
 
 #include <Core/Log.h>
-#include <Core/TupleKeys.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 /*
  * Dispatches events to multiple sinks, aggregating some events in the process.
+ *
+ * Aggregated events may be published concurrently from multiple threads: each thread
+ * aggregates into its own buffer, without locks, and the buffers are merged - in sorted
+ * order, so that sinks see the same sequence regardless of which threads produced what -
+ * at Flush(). All other events go straight to the sinks, hence they - and Flush() - must
+ * only be published on the main thread.
  */
 class SimulationEventDispatcher final
     : public IStructuralShipEventHandler
@@ -30,25 +41,10 @@ class SimulationEventDispatcher final
 public:
 
     SimulationEventDispatcher()
-        : mStressEvents()
-        , mImpactEvents()
-        , mBreakEvents()
-        , mLampBrokenEvents()
-        , mLampExplodedEvents()
-        , mLampImplodedEvents()
-        , mCombustionExplosionEvents()
-        , mLightningHitEvents()
-        , mLightFlickerEvents()
-        , mSpringRepairedEvents()
-        , mTriangleRepairedEvents()
-        , mLaserCutEvents(0)
-        , mWaterDisplacedEvents(0.0f)
-        , mAirBubbleSurfacedEvents(0u)
-        , mBombExplosionEvents()
-        , mRCBombPingEvents()
-        , mTimerBombDefusedEvents()
-        , mWatertightDoorOpenedEvents()
-        , mWatertightDoorClosedEvents()
+        : mId(NextId.fetch_add(1, std::memory_order_relaxed))
+        , mThreadAggregations()
+        , mThreadAggregationsLock()
+        , mMergedAggregations()
         , mLastNpcCountsUpdated()
         , mLastHumanNpcCountsUpdated()
         // Sinks
@@ -79,7 +75,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mStressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThisThreadAggregations().StressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     virtual void OnImpact(
@@ -87,7 +83,7 @@ public:
         bool isUnderwater,
         float kineticEnergy) override
     {
-        mImpactEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += kineticEnergy;
+        GetThisThreadAggregations().ImpactEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += kineticEnergy;
     }
 
     void OnBreak(
@@ -95,7 +91,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThisThreadAggregations().BreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnDestroy(
@@ -114,7 +110,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mSpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThisThreadAggregations().SpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnTriangleRepaired(
@@ -122,7 +118,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mTriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThisThreadAggregations().TriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnSawed(
@@ -137,7 +133,7 @@ public:
 
     virtual void OnLaserCut(unsigned int size) override
     {
-        mLaserCutEvents += size;
+        GetThisThreadAggregations().LaserCutEvents += size;
     }
 
     //
@@ -196,12 +192,12 @@ public:
 
     void OnWaterDisplaced(float waterDisplacedMagnitude) override
     {
-        mWaterDisplacedEvents += waterDisplacedMagnitude;
+        GetThisThreadAggregations().WaterDisplacedEvents += waterDisplacedMagnitude;
     }
 
     void OnAirBubbleSurfaced(unsigned int size) override
     {
-        mAirBubbleSurfacedEvents += size;
+        GetThisThreadAggregations().AirBubbleSurfacedEvents += size;
     }
 
     void OnWaterReaction(
@@ -285,14 +281,14 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBombExplosionEvents[std::make_tuple(gadgetType, isUnderwater)] += size;
+        GetThisThreadAggregations().BombExplosionEvents[std::make_tuple(gadgetType, isUnderwater)] += size;
     }
 
     void OnRCBombPing(
         bool isUnderwater,
         unsigned int size) override
     {
-        mRCBombPingEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().RCBombPingEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnTimerBombFuse(
@@ -311,7 +307,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mTimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().TimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnAntiMatterBombContained(
@@ -346,14 +342,14 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().WatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnWatertightDoorClosed(
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().WatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnFishCountUpdated(size_t count) override
@@ -424,7 +420,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mCombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().CombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     //
@@ -509,7 +505,7 @@ public:
 
     void OnLightningHit(StructuralMaterial const & structuralMaterial) override
     {
-        mLightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
+        GetThisThreadAggregations().LightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
     }
 
     //
@@ -520,21 +516,21 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampBrokenEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().LampBrokenEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnLampExploded(
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampExplodedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().LampExplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnLampImploded(
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampImplodedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThisThreadAggregations().LampImplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnLightFlicker(
@@ -542,7 +538,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mLightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
+        GetThisThreadAggregations().LightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
     }
 
     void OnElectricalElementAnnouncementsBegin() override
@@ -801,143 +797,161 @@ public:
      */
     void Flush()
     {
+        //
+        // Merge all threads' aggregations
+        //
+
+        EventAggregations & events = mMergedAggregations;
+
+        {
+            std::lock_guard const lock{ mThreadAggregationsLock };
+
+            for (auto const & threadAggregations : mThreadAggregations)
+            {
+                threadAggregations->MergeInto(events);
+                threadAggregations->Clear();
+            }
+        }
+
+        events.Sort();
+
         //
         // Publish aggregations
         //
 
         for (auto * sink : mStructuralShipSinks)
         {
-            for (auto const & entry : mStressEvents)
+            for (auto const & entry : events.StressEvents)
             {
                 sink->OnStress(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mImpactEvents)
+            for (auto const & entry : events.ImpactEvents)
             {
                 sink->OnImpact(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mBreakEvents)
+            for (auto const & entry : events.BreakEvents)
             {
                 sink->OnBreak(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mSpringRepairedEvents)
+            for (auto const & entry : events.SpringRepairedEvents)
             {
                 sink->OnSpringRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mTriangleRepairedEvents)
+            for (auto const & entry : events.TriangleRepairedEvents)
             {
                 sink->OnTriangleRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            if (mLaserCutEvents > 0)
+            if (events.LaserCutEvents > 0)
             {
-                sink->OnLaserCut(mLaserCutEvents);
+                sink->OnLaserCut(events.LaserCutEvents);
             }
         }
 
-        mStressEvents.clear();
-        mImpactEvents.clear();
-        mBreakEvents.clear();
-        mSpringRepairedEvents.clear();
-        mTriangleRepairedEvents.clear();
-        mLaserCutEvents = 0;
+        events.StressEvents.clear();
+        events.ImpactEvents.clear();
+        events.BreakEvents.clear();
+        events.SpringRepairedEvents.clear();
+        events.TriangleRepairedEvents.clear();
+        events.LaserCutEvents = 0;
 
         for (auto * sink : mGenericShipSinks)
         {
-            if (mWaterDisplacedEvents != 0.0f)
+            if (events.WaterDisplacedEvents != 0.0f)
             {
-                sink->OnWaterDisplaced(mWaterDisplacedEvents);
+                sink->OnWaterDisplaced(events.WaterDisplacedEvents);
             }
 
-            if (mAirBubbleSurfacedEvents > 0)
+            if (events.AirBubbleSurfacedEvents > 0)
             {
-                sink->OnAirBubbleSurfaced(mAirBubbleSurfacedEvents);
+                sink->OnAirBubbleSurfaced(events.AirBubbleSurfacedEvents);
             }
 
-            for (auto const & entry : mBombExplosionEvents)
+            for (auto const & entry : events.BombExplosionEvents)
             {
                 sink->OnBombExplosion(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mRCBombPingEvents)
+            for (auto const & entry : events.RCBombPingEvents)
             {
                 sink->OnRCBombPing(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mTimerBombDefusedEvents)
+            for (auto const & entry : events.TimerBombDefusedEvents)
             {
                 sink->OnTimerBombDefused(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mWatertightDoorOpenedEvents)
+            for (auto const & entry : events.WatertightDoorOpenedEvents)
             {
                 sink->OnWatertightDoorOpened(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mWatertightDoorClosedEvents)
+            for (auto const & entry : events.WatertightDoorClosedEvents)
             {
                 sink->OnWatertightDoorClosed(std::get<0>(entry.first), entry.second);
             }
         }
 
-        mWaterDisplacedEvents = 0.0f;
-        mAirBubbleSurfacedEvents = 0u;
-        mBombExplosionEvents.clear();
-        mRCBombPingEvents.clear();
-        mTimerBombDefusedEvents.clear();
-        mWatertightDoorOpenedEvents.clear();
-        mWatertightDoorClosedEvents.clear();
+        events.WaterDisplacedEvents = 0.0f;
+        events.AirBubbleSurfacedEvents = 0u;
+        events.BombExplosionEvents.clear();
+        events.RCBombPingEvents.clear();
+        events.TimerBombDefusedEvents.clear();
+        events.WatertightDoorOpenedEvents.clear();
+        events.WatertightDoorClosedEvents.clear();
 
         for (auto * sink : mCombustionSinks)
         {
-            for (auto const & entry : mCombustionExplosionEvents)
+            for (auto const & entry : events.CombustionExplosionEvents)
             {
                 sink->OnCombustionExplosion(std::get<0>(entry.first), entry.second);
             }
         }
 
-        mCombustionExplosionEvents.clear();
+        events.CombustionExplosionEvents.clear();
 
         for (auto * sink : mAtmosphereSinks)
         {
-            for (auto const & entry : mLightningHitEvents)
+            for (auto const & entry : events.LightningHitEvents)
             {
                 sink->OnLightningHit(*(std::get<0>(entry.first)));
             }
         }
 
-        mLightningHitEvents.clear();
+        events.LightningHitEvents.clear();
 
         for (auto * sink : mElectricalElementSinks)
         {
-            for (auto const & entry : mLampBrokenEvents)
+            for (auto const & entry : events.LampBrokenEvents)
             {
                 sink->OnLampBroken(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLampExplodedEvents)
+            for (auto const & entry : events.LampExplodedEvents)
             {
                 sink->OnLampExploded(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLampImplodedEvents)
+            for (auto const & entry : events.LampImplodedEvents)
             {
                 sink->OnLampImploded(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLightFlickerEvents)
+            for (auto const & entry : events.LightFlickerEvents)
             {
                 sink->OnLightFlicker(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
             }
         }
 
-        mLampBrokenEvents.clear();
-        mLampExplodedEvents.clear();
-        mLampImplodedEvents.clear();
-        mLightFlickerEvents.clear();
+        events.LampBrokenEvents.clear();
+        events.LampExplodedEvents.clear();
+        events.LampImplodedEvents.clear();
+        events.LightFlickerEvents.clear();
 
         for (auto * sink : mNpcSinks)
         {
@@ -1000,26 +1014,190 @@ public:
 
 private:
 
-    // The current events being aggregated
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mStressEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, float> mImpactEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mBreakEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampBrokenEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampExplodedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampImplodedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mCombustionExplosionEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *>, unsigned int> mLightningHitEvents;
-    unordered_tuple_map<std::tuple<DurationShortLongType, bool>, unsigned int> mLightFlickerEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mSpringRepairedEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mTriangleRepairedEvents;
-    unsigned int mLaserCutEvents;
-    float mWaterDisplacedEvents;
-    unsigned int mAirBubbleSurfacedEvents;
-    unordered_tuple_map<std::tuple<GadgetType, bool>, unsigned int> mBombExplosionEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mRCBombPingEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mTimerBombDefusedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorOpenedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorClosedEvents;
+    /*
+     * Flat map for aggregating events by key; there are only a handful of keys
+     * per event kind, hence lookups are linear, and clearing keeps the storage.
+     */
+    template<typename TKey, typename TValue>
+    class AggregationMap final
+    {
+    public:
+
+        TValue & operator[](TKey const & key)
+        {
+            for (auto & entry : mEntries)
+            {
+                if (entry.first == key)
+                {
+                    return entry.second;
+                }
+            }
+
+            return mEntries.emplace_back(key, TValue(0)).second;
+        }
+
+        using const_iterator = typename std::vector<std::pair<TKey, TValue>>::const_iterator;
+
+        const_iterator begin() const
+        {
+            return mEntries.cbegin();
+        }
+
+        const_iterator end() const
+        {
+            return mEntries.cend();
+        }
+
+        void MergeInto(AggregationMap & other) const
+        {
+            for (auto const & entry : mEntries)
+            {
+                other[entry.first] += entry.second;
+            }
+        }
+
+        void Sort()
+        {
+            std::sort(
+                mEntries.begin(),
+                mEntries.end(),
+                [](auto const & lhs, auto const & rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+        }
+
+        void clear()
+        {
+            mEntries.clear();
+        }
+
+    private:
+
+        std::vector<std::pair<TKey, TValue>> mEntries;
+    };
+
+    struct EventAggregations
+    {
+        AggregationMap<std::tuple<StructuralMaterial const *, bool>, unsigned int> StressEvents;
+        AggregationMap<std::tuple<StructuralMaterial const *, bool>, float> ImpactEvents;
+        AggregationMap<std::tuple<StructuralMaterial const *, bool>, unsigned int> BreakEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> LampBrokenEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> LampExplodedEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> LampImplodedEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> CombustionExplosionEvents;
+        AggregationMap<std::tuple<StructuralMaterial const *>, unsigned int> LightningHitEvents;
+        AggregationMap<std::tuple<DurationShortLongType, bool>, unsigned int> LightFlickerEvents;
+        AggregationMap<std::tuple<StructuralMaterial const *, bool>, unsigned int> SpringRepairedEvents;
+        AggregationMap<std::tuple<StructuralMaterial const *, bool>, unsigned int> TriangleRepairedEvents;
+        unsigned int LaserCutEvents{ 0 };
+        float WaterDisplacedEvents{ 0.0f };
+        unsigned int AirBubbleSurfacedEvents{ 0u };
+        AggregationMap<std::tuple<GadgetType, bool>, unsigned int> BombExplosionEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> RCBombPingEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> TimerBombDefusedEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> WatertightDoorOpenedEvents;
+        AggregationMap<std::tuple<bool>, unsigned int> WatertightDoorClosedEvents;
+
+        void MergeInto(EventAggregations & other) const
+        {
+            StressEvents.MergeInto(other.StressEvents);
+            ImpactEvents.MergeInto(other.ImpactEvents);
+            BreakEvents.MergeInto(other.BreakEvents);
+            LampBrokenEvents.MergeInto(other.LampBrokenEvents);
+            LampExplodedEvents.MergeInto(other.LampExplodedEvents);
+            LampImplodedEvents.MergeInto(other.LampImplodedEvents);
+            CombustionExplosionEvents.MergeInto(other.CombustionExplosionEvents);
+            LightningHitEvents.MergeInto(other.LightningHitEvents);
+            LightFlickerEvents.MergeInto(other.LightFlickerEvents);
+            SpringRepairedEvents.MergeInto(other.SpringRepairedEvents);
+            TriangleRepairedEvents.MergeInto(other.TriangleRepairedEvents);
+            other.LaserCutEvents += LaserCutEvents;
+            other.WaterDisplacedEvents += WaterDisplacedEvents;
+            other.AirBubbleSurfacedEvents += AirBubbleSurfacedEvents;
+            BombExplosionEvents.MergeInto(other.BombExplosionEvents);
+            RCBombPingEvents.MergeInto(other.RCBombPingEvents);
+            TimerBombDefusedEvents.MergeInto(other.TimerBombDefusedEvents);
+            WatertightDoorOpenedEvents.MergeInto(other.WatertightDoorOpenedEvents);
+            WatertightDoorClosedEvents.MergeInto(other.WatertightDoorClosedEvents);
+        }
+
+        void Sort()
+        {
+            StressEvents.Sort();
+            ImpactEvents.Sort();
+            BreakEvents.Sort();
+            LampBrokenEvents.Sort();
+            LampExplodedEvents.Sort();
+            LampImplodedEvents.Sort();
+            CombustionExplosionEvents.Sort();
+            LightningHitEvents.Sort();
+            LightFlickerEvents.Sort();
+            SpringRepairedEvents.Sort();
+            TriangleRepairedEvents.Sort();
+            BombExplosionEvents.Sort();
+            RCBombPingEvents.Sort();
+            TimerBombDefusedEvents.Sort();
+            WatertightDoorOpenedEvents.Sort();
+            WatertightDoorClosedEvents.Sort();
+        }
+
+        void Clear()
+        {
+            StressEvents.clear();
+            ImpactEvents.clear();
+            BreakEvents.clear();
+            LampBrokenEvents.clear();
+            LampExplodedEvents.clear();
+            LampImplodedEvents.clear();
+            CombustionExplosionEvents.clear();
+            LightningHitEvents.clear();
+            LightFlickerEvents.clear();
+            SpringRepairedEvents.clear();
+            TriangleRepairedEvents.clear();
+            LaserCutEvents = 0;
+            WaterDisplacedEvents = 0.0f;
+            AirBubbleSurfacedEvents = 0u;
+            BombExplosionEvents.clear();
+            RCBombPingEvents.clear();
+            TimerBombDefusedEvents.clear();
+            WatertightDoorOpenedEvents.clear();
+            WatertightDoorClosedEvents.clear();
+        }
+    };
+
+    EventAggregations & GetThisThreadAggregations()
+    {
+        // Note: the cache is keyed by dispatcher ID rather than by address, as a new
+        // dispatcher might be constructed where an old one used to be
+        thread_local std::uint64_t thisThreadDispatcherId = 0;
+        thread_local EventAggregations * thisThreadAggregations = nullptr;
+
+        if (thisThreadDispatcherId != mId)
+        {
+            std::lock_guard const lock{ mThreadAggregationsLock };
+
+            mThreadAggregations.emplace_back(std::make_unique<EventAggregations>());
+
+            thisThreadDispatcherId = mId;
+            thisThreadAggregations = mThreadAggregations.back().get();
+        }
+
+        return *thisThreadAggregations;
+    }
+
+    static inline std::atomic<std::uint64_t> NextId{ 1 };
+
+    std::uint64_t const mId;
+
+    // The current events being aggregated, one set per thread that has published any;
+    // never deleted, as threads hold on to theirs
+    std::vector<std::unique_ptr<EventAggregations>> mThreadAggregations;
+    std::mutex mThreadAggregationsLock;
+
+    // The merged aggregations, kept across flushes for their storage
+    EventAggregations mMergedAggregations;
+
     std::optional<size_t> mLastNpcCountsUpdated;
     std::optional<std::tuple<size_t, size_t>> mLastHumanNpcCountsUpdated;
 
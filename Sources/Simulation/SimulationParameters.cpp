@@ -132,6 +132,11 @@ SimulationParameters::SimulationParameters()
     , IsUltraViolentMode(false)
     , MoveToolInertia(3.0f)
     // Computation
-    , SpringRelaxationParallelComputationMode(SpringRelaxationParallelComputationModeType::Hybrid)
+    , SpringRelaxationParallelComputationMode(SpringRelaxationParallelComputationModeType::Automatic)
+    , ShipLayoutOrder(ShipLayoutOrderType::Rows)
+    , DoUseContiguousElementBuffers(true)
+    , DoInterpolateRenderedPositions(false)
+    // Ship-to-ship collisions
+    , DoCollideShips(true)
 {
 }
\ No newline at end of file
@@ -47,6 +47,22 @@ struct SimulationParameters
     static T constexpr ParticleUpdateLowFrequencyStepTimeDuration = SimulationStepTimeDuration<T> * static_cast<T>(ParticleUpdateLowFrequencyPeriod);
 
 
+    //
+    // Resting ships
+    //
+
+    static int constexpr RestingStepsToSleep = 128; // Number of consecutive still simulation steps before a ship may fall asleep
+    static float constexpr RestingMaxVelocity = 0.01f; // m/s, speed of the fastest point of a still ship
+    static float constexpr RestingMaxAcceleration = 0.05f; // m/s^2, acceleration of the most unbalanced point of a ship at rest
+
+
+    //
+    // Chebyshev spring relaxation
+    //
+
+    static float constexpr ChebyshevSpringRelaxationSpectralRadius = 0.9f; // Estimate of the spectral radius of plain spring relaxation; the higher, the more aggressive the over-relaxation
+
+
     //
     // Physical Constants
     //
@@ -680,6 +696,21 @@ struct SimulationParameters
 
     SpringRelaxationParallelComputationModeType SpringRelaxationParallelComputationMode;
 
+    ShipLayoutOrderType ShipLayoutOrder; // Order of the points and springs of new ships
+
+    bool DoUseContiguousElementBuffers; // Allocate the buffers of each ship's points, springs, and triangles contiguously, in huge pages where supported
+
+    bool DoInterpolateRenderedPositions; // Snapshot positions at each step, so that ship points may be rendered in-between steps
+
+    //
+    // Ship-to-ship collisions
+    //
+
+    bool DoCollideShips;
+    static float constexpr ShipCollisionMargin = 0.5f; // m; ship AABBs closer than this are checked for collisions
+    static float constexpr ShipCollisionStiffness = 0.5f; // Fraction of a point's penetration into the other ship that is resolved at each step
+    static float constexpr ShipCollisionDamping = 0.5f; // Fraction of a point's approaching velocity relative to the other ship that is removed at each step
+
     //
     // Limits
     //
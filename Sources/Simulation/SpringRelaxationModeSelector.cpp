@@ -0,0 +1,128 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "SpringRelaxationModeSelector.h"
+
+#include <Core/Log.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+SpringRelaxationModeSelector::SpringRelaxationModeSelector()
+    : mCandidates({ { SpringRelaxationParallelComputationModeType::StepByStep, 1 } })
+    , mSpringCount(0)
+    , mIsEvaluating(false)
+    , mCurrentCandidate(0)
+    , mCurrentCandidateStepCount(0)
+    , mCurrentCandidateTotalMillis(0.0f)
+    , mBestCandidate(0)
+    , mBestCandidateAverageMillis(std::numeric_limits<float>::max())
+    , mLastEvaluationBrokenSpringCount(0)
+{
+}
+
+void SpringRelaxationModeSelector::Reset(
+    size_t springCount,
+    size_t maxParallelism)
+{
+    assert(maxParallelism >= 1);
+
+    mSpringCount = springCount;
+
+    mCandidates.clear();
+    mCandidates.push_back({ SpringRelaxationParallelComputationModeType::StepByStep, 1 });
+
+    if (springCount >= MinParallelSpringCount && maxParallelism > 1)
+    {
+        mCandidates.push_back({ SpringRelaxationParallelComputationModeType::StepByStep, maxParallelism });
+        mCandidates.push_back({ SpringRelaxationParallelComputationModeType::FullSpeed, maxParallelism });
+        mCandidates.push_back({ SpringRelaxationParallelComputationModeType::Hybrid, maxParallelism });
+
+        StartEvaluation(0);
+    }
+    else
+    {
+        // Nothing to choose from
+        mIsEvaluating = false;
+        mCurrentCandidate = 0;
+        mLastEvaluationBrokenSpringCount = 0;
+    }
+}
+
+bool SpringRelaxationModeSelector::Update(
+    float springRelaxationMillis,
+    size_t brokenSpringCount)
+{
+    if (!mIsEvaluating)
+    {
+        // Repairs restore springs
+        mLastEvaluationBrokenSpringCount = std::min(mLastEvaluationBrokenSpringCount, brokenSpringCount);
+
+        if (mCandidates.size() > 1
+            && static_cast<float>(brokenSpringCount - mLastEvaluationBrokenSpringCount) >= static_cast<float>(mSpringCount) * ReevaluationBrokenSpringFraction)
+        {
+            // The workload has changed enough
+            Choice const previousChoice = GetChoice();
+            StartEvaluation(brokenSpringCount);
+            return GetChoice() != previousChoice;
+        }
+
+        return false;
+    }
+
+    //
+    // Evaluating
+    //
+
+    ++mCurrentCandidateStepCount;
+    if (mCurrentCandidateStepCount > WarmupStepsPerCandidate)
+    {
+        mCurrentCandidateTotalMillis += springRelaxationMillis;
+    }
+
+    if (mCurrentCandidateStepCount < WarmupStepsPerCandidate + MeasuredStepsPerCandidate)
+    {
+        return false;
+    }
+
+    // Done with this candidate
+    float const averageMillis = mCurrentCandidateTotalMillis / static_cast<float>(MeasuredStepsPerCandidate);
+    if (averageMillis < mBestCandidateAverageMillis)
+    {
+        mBestCandidate = mCurrentCandidate;
+        mBestCandidateAverageMillis = averageMillis;
+    }
+
+    if (mCurrentCandidate + 1 < mCandidates.size())
+    {
+        // Next candidate
+        ++mCurrentCandidate;
+        mCurrentCandidateStepCount = 0;
+        mCurrentCandidateTotalMillis = 0.0f;
+        return true;
+    }
+
+    // Done evaluating
+    mIsEvaluating = false;
+
+    LogMessage("SpringRelaxationModeSelector: chose candidate ", mBestCandidate, " of ", mCandidates.size(),
+        " (", mBestCandidateAverageMillis, "ms) for ", mSpringCount, " springs");
+
+    bool const hasChanged = (mBestCandidate != mCurrentCandidate);
+    mCurrentCandidate = mBestCandidate;
+    return hasChanged;
+}
+
+void SpringRelaxationModeSelector::StartEvaluation(size_t brokenSpringCount)
+{
+    mIsEvaluating = true;
+    mCurrentCandidate = 0;
+    mCurrentCandidateStepCount = 0;
+    mCurrentCandidateTotalMillis = 0.0f;
+    mBestCandidate = 0;
+    mBestCandidateAverageMillis = std::numeric_limits<float>::max();
+    mLastEvaluationBrokenSpringCount = brokenSpringCount;
+}
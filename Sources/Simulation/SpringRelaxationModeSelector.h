@@ -0,0 +1,98 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include <Core/GameTypes.h>
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Chooses the spring relaxation computation mode - and the number of threads - of a
+ * single ship, when the user asks for automatic selection.
+ *
+ * Ships that are too small to benefit from parallelism are simply given a single thread.
+ * For all others, an evaluation tries each candidate in turn, for a few steps each, timing
+ * the spring relaxation at each step; the fastest candidate is then kept until the next
+ * evaluation, which happens when the ship's parallelism budget changes, or when the ship
+ * has lost enough springs for its workload to have changed.
+ *
+ * Chebyshev is never chosen, as it changes the relaxation rather than its parallelization.
+ */
+class SpringRelaxationModeSelector final
+{
+public:
+
+    struct Choice
+    {
+        SpringRelaxationParallelComputationModeType Mode;
+        size_t Parallelism;
+
+        bool operator==(Choice const & other) const
+        {
+            return Mode == other.Mode && Parallelism == other.Parallelism;
+        }
+
+        bool operator!=(Choice const & other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    SpringRelaxationModeSelector();
+
+    Choice const & GetChoice() const
+    {
+        return mCandidates[mCurrentCandidate];
+    }
+
+    bool IsEvaluating() const
+    {
+        return mIsEvaluating;
+    }
+
+    /*
+     * Starts afresh, for a ship with the specified number of springs and parallelism budget.
+     */
+    void Reset(
+        size_t springCount,
+        size_t maxParallelism);
+
+    /*
+     * Feeds the duration of the last spring relaxation, and the current number of broken springs;
+     * returns true when the choice has changed.
+     */
+    bool Update(
+        float springRelaxationMillis,
+        size_t brokenSpringCount);
+
+private:
+
+    // Ships with fewer springs than these are not worth parallelizing
+    static size_t constexpr MinParallelSpringCount = 4096;
+
+    // Steps of each candidate that are discarded, as they pay for cold caches and task (re-)creation...
+    static size_t constexpr WarmupStepsPerCandidate = 4;
+    // ...and steps that are timed
+    static size_t constexpr MeasuredStepsPerCandidate = 16;
+
+    // Fraction of springs broken since the last evaluation, at which we re-evaluate
+    static float constexpr ReevaluationBrokenSpringFraction = 0.125f;
+
+    void StartEvaluation(size_t brokenSpringCount);
+
+    std::vector<Choice> mCandidates;
+    size_t mSpringCount;
+
+    bool mIsEvaluating;
+    size_t mCurrentCandidate;
+    size_t mCurrentCandidateStepCount;
+    float mCurrentCandidateTotalMillis;
+    size_t mBestCandidate;
+    float mBestCandidateAverageMillis;
+
+    size_t mLastEvaluationBrokenSpringCount;
+};
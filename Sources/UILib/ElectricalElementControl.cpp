@@ -80,13 +80,18 @@ void GaugeElectricalElementControl::UpdateSimulation()
     // Update hand endpoint
     //
 
-    mHandEndpoint = CalculateHandEndpoint(mCenterPoint, mHandLength, mCurrentAngle);
+    wxPoint const newHandEndpoint = CalculateHandEndpoint(mCenterPoint, mHandLength, mCurrentAngle);
 
     //
-    // Redraw
+    // Redraw - only if the hand has moved, as gauges mostly sit still
     //
 
-    mImagePanel->Refresh();
+    if (newHandEndpoint != mHandEndpoint)
+    {
+        mHandEndpoint = newHandEndpoint;
+
+        mImagePanel->Refresh();
+    }
 }
 
 void GaugeElectricalElementControl::Render(wxDC & dc)
@@ -151,6 +151,11 @@ public:
 
     void SetState(ElectricalState state)
     {
+        if (state == mCurrentState)
+        {
+            return;
+        }
+
         mCurrentState = state;
 
         SetImageForCurrentState();
@@ -163,6 +168,11 @@ public:
 
     virtual void SetEnabled(bool isEnabled) override
     {
+        if (isEnabled == mIsEnabled)
+        {
+            return;
+        }
+
         mIsEnabled = isEnabled;
 
         SetImageForCurrentState();
@@ -533,6 +543,11 @@ public:
 
     void SetState(ElectricalState state)
     {
+        if (state == mCurrentState)
+        {
+            return;
+        }
+
         mCurrentState = state;
 
         SetImageForCurrentState();
@@ -717,7 +732,13 @@ public:
 
     void SetValue(float controllerValue) override
     {
-        mCurrentValue = ControllerValueToTelegraphValue(controllerValue);
+        TelegraphValue const newValue = ControllerValueToTelegraphValue(controllerValue);
+        if (newValue == mCurrentValue)
+        {
+            return;
+        }
+
+        mCurrentValue = newValue;
 
         Refresh();
     }
@@ -729,6 +750,11 @@ public:
 
     virtual void SetEnabled(bool isEnabled) override
     {
+        if (isEnabled == mIsEnabled)
+        {
+            return;
+        }
+
         mIsEnabled = isEnabled;
 
         Refresh();
@@ -851,6 +877,11 @@ public:
 
     void SetValue(float controllerValue) override
     {
+        if (controllerValue == mCurrentValue)
+        {
+            return;
+        }
+
         mCurrentValue = controllerValue;
 
         Refresh();
@@ -863,6 +894,11 @@ public:
 
     virtual void SetEnabled(bool isEnabled) override
     {
+        if (isEnabled == mIsEnabled)
+        {
+            return;
+        }
+
         mIsEnabled = isEnabled;
 
         Refresh();
@@ -963,6 +999,11 @@ public:
 
     void SetValue(float controllerValue) override
     {
+        if (controllerValue == mCurrentValue)
+        {
+            return;
+        }
+
         mCurrentValue = controllerValue;
 
         mImageBitmap->SetBitmap(GetImageForCurrentState());
@@ -977,6 +1018,11 @@ public:
 
     virtual void SetEnabled(bool isEnabled) override
     {
+        if (isEnabled == mIsEnabled)
+        {
+            return;
+        }
+
         mIsEnabled = isEnabled;
 
         mImageBitmap->SetBitmap(GetImageForCurrentState());
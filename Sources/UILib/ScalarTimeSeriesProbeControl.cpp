@@ -6,6 +6,7 @@
 #include "ScalarTimeSeriesProbeControl.h"
 
 #include <wx/dcbuffer.h>
+#include <wx/dcmemory.h>
 
 #include <algorithm>
 #include <cassert>
@@ -13,6 +14,7 @@
 #include <limits>
 #include <numeric>
 #include <sstream>
+#include <utility>
 
 static constexpr int Height = 80;
 
@@ -26,9 +28,18 @@ ScalarTimeSeriesProbeControl::ScalarTimeSeriesProbeControl(
         wxDefaultSize,
         wxBORDER_SIMPLE)
     , mWidth(width)
+    , mXGridStepSize(std::max(width / 6, 1))
     , mBufferedDCBitmap()
     , mTimeSeriesPen(wxColor("BLACK"), 2, wxPENSTYLE_SOLID)
     , mGridPen(wxColor(0xa0, 0xa0, 0xa0), 1, wxPENSTYLE_SOLID)
+    , mSampleCount(0)
+    , mChartBitmap(std::make_unique<wxBitmap>(width, Height))
+    , mChartScrollBitmap(std::make_unique<wxBitmap>(width, Height))
+    , mIsChartValid(false)
+    , mChartPendingSampleCount(0)
+    , mChartMaxValue(0.0f)
+    , mChartMinValue(0.0f)
+    , mChartYGridStepSize(0)
 {
     SetMinSize(wxSize(width, Height));
     SetMaxSize(wxSize(width, Height));
@@ -57,11 +68,18 @@ void ScalarTimeSeriesProbeControl::RegisterSample(float value)
     mSamples.emplace(
         [](float) {},
         value);
+
+    ++mSampleCount;
+    ++mChartPendingSampleCount;
 }
 
 void ScalarTimeSeriesProbeControl::UpdateSimulation()
 {
-    Refresh();
+    // Samples may arrive at any rate, but we paint at most once per update
+    if (mChartPendingSampleCount > 0 || !mIsChartValid)
+    {
+        Refresh();
+    }
 }
 
 void ScalarTimeSeriesProbeControl::Reset()
@@ -72,6 +90,9 @@ void ScalarTimeSeriesProbeControl::Reset()
     mMinValue = std::numeric_limits<float>::max();
 
     mGridValueSize = 0.0f;
+
+    mIsChartValid = false;
+    mChartPendingSampleCount = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -118,99 +139,175 @@ int ScalarTimeSeriesProbeControl::MapValueToY(float value) const
 
 void ScalarTimeSeriesProbeControl::Render(wxDC & dc)
 {
-    dc.Clear();
+    UpdateChart();
+
+    dc.DrawBitmap(*mChartBitmap, 0, 0);
 
     if (!mSamples.empty())
     {
         //
-        // Check if need to resize grid
+        // Draw label
         //
 
-        // Calculate new grid step
-        float numberOfGridLines = 6.0f;
-        float const currentValueExtent = mMaxValue - mMinValue;
-        if (currentValueExtent > 0.0f)
-        {
-            if (mGridValueSize == 0.0f)
-                mGridValueSize = currentValueExtent / 6.0f;
-
-            // Number of grid lines we would have with the current extent
-            numberOfGridLines = currentValueExtent / mGridValueSize;
-            if (numberOfGridLines > 20.0f)
-            {
-                // Recalc
-                mGridValueSize = currentValueExtent / 6.0f;
-                numberOfGridLines = 6.0f;
-            }
-        }
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << *mSamples.cbegin() << " (" << mMaxValue << ")";
+
+        wxString labelText(ss.str());
+        dc.DrawText(labelText, 0, 1);
+    }
+}
 
-        static const int xGridStepSize = mWidth / 6;
-        int yGridStepSize = std::min(mWidth, Height) / static_cast<int>(ceil(numberOfGridLines));
+void ScalarTimeSeriesProbeControl::UpdateChart()
+{
+    int const yGridStepSize = CalculateYGridStepSize();
 
+    // Samples move by one column each, with the newest at mWidth - 2
+    int const maxScrollableSampleCount = mWidth - 3;
 
+    bool const isFullRender =
+        !mIsChartValid
+        || mMaxValue != mChartMaxValue
+        || mMinValue != mChartMinValue
+        || yGridStepSize != mChartYGridStepSize
+        || mChartPendingSampleCount > static_cast<size_t>(std::max(maxScrollableSampleCount, 0));
+
+    size_t const pendingSampleCount = mChartPendingSampleCount;
+
+    mIsChartValid = true;
+    mChartPendingSampleCount = 0;
+    mChartMaxValue = mMaxValue;
+    mChartMinValue = mMinValue;
+    mChartYGridStepSize = yGridStepSize;
+
+    if (isFullRender)
+    {
+        //
+        // Render fully
+        //
+
+        wxMemoryDC chartDc(*mChartBitmap);
+        RenderChartColumns(chartDc, 0);
+    }
+    else if (pendingSampleCount > 0)
+    {
         //
-        // Draw grid
+        // Scroll the chart left by the new samples, and render only their columns
         //
 
-        dc.SetPen(mGridPen);
+        int const scrollSize = static_cast<int>(pendingSampleCount);
 
-        for (int y = yGridStepSize; y < Height - 1; y += yGridStepSize)
         {
-            dc.DrawLine(0, y, mWidth - 1, y);
+            wxMemoryDC chartDc(*mChartBitmap);
+            wxMemoryDC chartScrollDc(*mChartScrollBitmap);
+
+            chartScrollDc.Blit(0, 0, mWidth - scrollSize, Height, &chartDc, scrollSize, 0);
+
+            // From the column of the oldest new sample, whose segment joins the old samples
+            RenderChartColumns(chartScrollDc, mWidth - 1 - scrollSize);
         }
 
-        for (int x = xGridStepSize; x < mWidth - 1; x += xGridStepSize)
+        std::swap(mChartBitmap, mChartScrollBitmap);
+    }
+}
+
+int ScalarTimeSeriesProbeControl::CalculateYGridStepSize()
+{
+    //
+    // Check if need to resize grid
+    //
+
+    // Calculate new grid step
+    float numberOfGridLines = 6.0f;
+    float const currentValueExtent = mMaxValue - mMinValue;
+    if (currentValueExtent > 0.0f)
+    {
+        if (mGridValueSize == 0.0f)
+            mGridValueSize = currentValueExtent / 6.0f;
+
+        // Number of grid lines we would have with the current extent
+        numberOfGridLines = currentValueExtent / mGridValueSize;
+        if (numberOfGridLines > 20.0f)
         {
-            dc.DrawLine(x, 0, x, Height - 1);
+            // Recalc
+            mGridValueSize = currentValueExtent / 6.0f;
+            numberOfGridLines = 6.0f;
         }
+    }
+
+    return std::max(std::min(mWidth, Height) / static_cast<int>(ceil(numberOfGridLines)), 1);
+}
 
+void ScalarTimeSeriesProbeControl::RenderChartColumns(
+    wxDC & dc,
+    int firstX) const
+{
+    //
+    // Clear columns
+    //
 
-        //
-        // Draw chart
-        //
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    dc.SetBrush(wxBrush(GetBackgroundColour()));
+    dc.DrawRectangle(firstX, 0, mWidth - firstX, Height);
 
-        dc.SetPen(mTimeSeriesPen);
+    if (mSamples.empty())
+    {
+        return;
+    }
+
+    //
+    // Draw grid
+    //
+
+    dc.SetPen(mGridPen);
 
-        auto it = mSamples.cbegin();
-        int lastX = mWidth - 2;
-        int lastY = MapValueToY(*it);
-        ++it;
+    for (int y = mChartYGridStepSize; y < Height - 1; y += mChartYGridStepSize)
+    {
+        dc.DrawLine(firstX, y, mWidth - 1, y);
+    }
 
-        if (it == mSamples.cend())
+    // Vertical lines scroll with the samples
+    for (int x = std::max(firstX, 1); x < mWidth - 1; ++x)
+    {
+        if ((mSampleCount + static_cast<size_t>(x)) % static_cast<size_t>(mXGridStepSize) == 0)
         {
-            // Draw just a point
-            dc.DrawPoint(lastX, lastY);
+            dc.DrawLine(x, 0, x, Height - 1);
         }
-        else
-        {
-            // Draw lines
-            do
-            {
-                int newX = lastX - 1;
-                if (newX == 0)
-                    break;
+    }
 
-                int newY = MapValueToY(*it);
+    //
+    // Draw chart
+    //
 
-                dc.DrawLine(newX, newY, lastX, lastY);
+    dc.SetPen(mTimeSeriesPen);
 
-                lastX = newX;
-                lastY = newY;
+    auto it = mSamples.cbegin();
+    int lastX = mWidth - 2;
+    int lastY = MapValueToY(*it);
+    ++it;
 
-                ++it;
-            }
-            while (it != mSamples.cend());
-        }
+    if (it == mSamples.cend())
+    {
+        // Draw just a point
+        dc.DrawPoint(lastX, lastY);
+    }
+    else
+    {
+        // Draw lines - up to the first column to render
+        do
+        {
+            int newX = lastX - 1;
+            if (newX == 0 || lastX < firstX)
+                break;
 
+            int newY = MapValueToY(*it);
 
-        //
-        // Draw label
-        //
+            dc.DrawLine(newX, newY, lastX, lastY);
 
-        std::stringstream ss;
-        ss << std::fixed << std::setprecision(3) << *mSamples.cbegin() << " (" << mMaxValue << ")";
+            lastX = newX;
+            lastY = newY;
 
-        wxString labelText(ss.str());
-        dc.DrawText(labelText, 0, 1);
+            ++it;
+        }
+        while (it != mSamples.cend());
     }
-}
\ No newline at end of file
+}
@@ -11,6 +11,13 @@
 
 #include <memory>
 
+/*
+ * Plots the time series of a scalar.
+ *
+ * The chart is kept in a bitmap, which - as long as the value range doesn't change -
+ * is only scrolled and completed with the columns of the new samples; painting is
+ * only requested at simulation updates following the arrival of new samples.
+ */
 class ScalarTimeSeriesProbeControl : public wxPanel
 {
 public:
@@ -35,11 +42,20 @@ private:
 
     void Render(wxDC& dc);
 
+    void UpdateChart();
+
+    int CalculateYGridStepSize();
+
+    void RenderChartColumns(
+        wxDC & dc,
+        int firstX) const;
+
     inline int MapValueToY(float value) const;
 
 private:
 
     int const mWidth;
+    int const mXGridStepSize;
 
     std::unique_ptr<wxBitmap> mBufferedDCBitmap;
     wxPen const mTimeSeriesPen;
@@ -50,6 +66,21 @@ private:
     float mGridValueSize;
 
     CircularList<float, 200> mSamples;
+    size_t mSampleCount; // Ever registered, for scrolling the vertical grid along with the samples
+
+    //
+    // Chart cache
+    //
+
+    std::unique_ptr<wxBitmap> mChartBitmap;
+    std::unique_ptr<wxBitmap> mChartScrollBitmap; // The target of scrolls, swapped with the chart bitmap afterwards
+    bool mIsChartValid;
+    size_t mChartPendingSampleCount; // Samples registered after the chart was last updated
+
+    // The parameters the chart has been rendered with
+    float mChartMaxValue;
+    float mChartMinValue;
+    int mChartYGridStepSize;
 };
 
 class IntegratingScalarTimeSeriesProbeControl : public ScalarTimeSeriesProbeControl
@@ -7,7 +7,10 @@
 
 #include "StandardSystemPaths.h"
 
+#include <Game/ShipDeSerializer.h>
+
 #include <Core/Log.h>
+#include <Core/ThreadManager.h>
 
 #include <UILib/ShipDescriptionDialog.h>
 #include <UILib/WxHelpers.h>
@@ -15,6 +18,8 @@
 #include <wx/sizer.h>
 #include <wx/statbmp.h>
 
+#include <algorithm>
+
 constexpr int MinDirCtrlWidth = 260;
 constexpr int MaxDirComboWidth = 650;
 
@@ -29,6 +34,10 @@ ShipLoadDialog<TUsageType>::ShipLoadDialog(
     ///
     , mStandardInstalledShipFolderPath(gameAssetManager.GetInstalledShipFolderPath())
     , mUserShipFolderPath(StandardSystemPaths::GetInstance().GetUserShipFolderPath())
+    , mSearchIndexThread()
+    , mIsSearchIndexThreadInterrupted(false)
+    , mSearchIndices()
+    , mSearchIndicesMutex()
 {
     Create(
         mParent,
@@ -251,7 +260,7 @@ ShipLoadDialog<TUsageType>::ShipLoadDialog(
 
                     // Label
                     {
-                        wxStaticText * searchLabel = new wxStaticText(this, wxID_ANY, _("Search in this folder:"));
+                        wxStaticText * searchLabel = new wxStaticText(this, wxID_ANY, _("Search in this folder, then in the ship libraries:"));
                         vSearchSizer->Add(searchLabel, 0, wxALIGN_LEFT | wxEXPAND);
                     }
 
@@ -583,6 +592,7 @@ ShipLoadDialog<TUsageType>::ShipLoadDialog(
 template<ShipLoadDialogUsageType TUsageType>
 ShipLoadDialog<TUsageType>::~ShipLoadDialog()
 {
+    StopSearchIndexThread();
 }
 
 template<ShipLoadDialogUsageType TUsageType>
@@ -608,6 +618,9 @@ int ShipLoadDialog<TUsageType>::ShowModal(std::vector<std::filesystem::path> con
     // Populate recent directories
     RepopulateRecentDirectoriesComboBox(shipLoadDirectories);
 
+    // Bring library search indices up-to-date
+    StartSearchIndexThread();
+
     //
     // Initialize preview panel
     //
@@ -692,6 +705,30 @@ void ShipLoadDialog<TUsageType>::OnSearchNextButtonClicked(wxCommandEvent & /*ev
     auto searchString = mShipSearchCtrl->GetValue();
     assert(!searchString.IsEmpty());
 
+    // Move on to the library match that follows the selected ship, if the latter is a library match itself
+    auto const libraryResults = SearchLibrary(searchString.ToStdString());
+    if (mSelectedShipFilepath.has_value())
+    {
+        auto const selectedShipFilepath = mSelectedShipFilepath->lexically_normal();
+        auto const it = std::find_if(
+            libraryResults.cbegin(),
+            libraryResults.cend(),
+            [&selectedShipFilepath](auto const & shipFilepath)
+            {
+                return shipFilepath.lexically_normal() == selectedShipFilepath;
+            });
+
+        if (it != libraryResults.cend())
+        {
+            auto const nextIt = std::next(it);
+            if (GoToShip(nextIt != libraryResults.cend() ? *nextIt : libraryResults.front()))
+            {
+                return;
+            }
+        }
+    }
+
+    // Not in a library, or not indexed yet
     mShipPreviewWindow->Search(searchString.ToStdString());
 }
 
@@ -828,6 +865,8 @@ void ShipLoadDialog<TUsageType>::EndModal(int retCode)
 {
     mShipPreviewWindow->OnClose();
 
+    StopSearchIndexThread();
+
     wxDialog::EndModal(retCode);
 }
 
@@ -873,6 +912,15 @@ void ShipLoadDialog<TUsageType>::StartShipSearch()
     if (!searchString.IsEmpty())
     {
         found = mShipPreviewWindow->Search(searchString.ToStdString());
+        if (!found)
+        {
+            // Not in this folder, try the whole libraries
+            auto const libraryResults = SearchLibrary(searchString.ToStdString());
+            if (!libraryResults.empty())
+            {
+                found = GoToShip(libraryResults.front());
+            }
+        }
     }
 
     mSearchNextButton->Enable(found);
@@ -919,5 +967,105 @@ void ShipLoadDialog<TUsageType>::RepopulateRecentDirectoriesComboBox(std::vector
     mRecentDirectoriesComboBox->SetValue(dirToSelect);
 }
 
+template<ShipLoadDialogUsageType TUsageType>
+void ShipLoadDialog<TUsageType>::StartSearchIndexThread()
+{
+    if (mSearchIndexThread.joinable())
+    {
+        // Already running
+        return;
+    }
+
+    std::vector<std::filesystem::path> libraryDirectoryPaths{ mStandardInstalledShipFolderPath };
+    if (mUserShipFolderPath != mStandardInstalledShipFolderPath)
+    {
+        libraryDirectoryPaths.push_back(mUserShipFolderPath);
+    }
+
+    mIsSearchIndexThreadInterrupted = false;
+
+    mSearchIndexThread = std::thread(
+        [this, libraryDirectoryPaths]()
+        {
+            ThreadManager::InitializeThisBackgroundThread();
+
+            for (auto const & libraryDirectoryPath : libraryDirectoryPaths)
+            {
+                try
+                {
+                    auto searchIndex = std::make_shared<ShipSearchIndex>(ShipSearchIndex::Load(libraryDirectoryPath));
+
+                    bool const isCompleted = searchIndex->Update(
+                        ShipDeSerializer::LoadShipPreviewData,
+                        [this]()
+                        {
+                            return mIsSearchIndexThreadInterrupted.load();
+                        });
+
+                    // Save also when interrupted, so that we resume from where we stopped
+                    searchIndex->Save();
+
+                    {
+                        std::scoped_lock lock(mSearchIndicesMutex);
+                        mSearchIndices[libraryDirectoryPath] = std::move(searchIndex);
+                    }
+
+                    if (!isCompleted)
+                    {
+                        break;
+                    }
+                }
+                catch (std::exception const & ex)
+                {
+                    LogMessage("ShipLoadDialog: error updating search index of \"", libraryDirectoryPath.string(), "\": ", ex.what());
+                }
+            }
+        });
+}
+
+template<ShipLoadDialogUsageType TUsageType>
+void ShipLoadDialog<TUsageType>::StopSearchIndexThread()
+{
+    if (mSearchIndexThread.joinable())
+    {
+        mIsSearchIndexThreadInterrupted = true;
+        mSearchIndexThread.join();
+    }
+}
+
+template<ShipLoadDialogUsageType TUsageType>
+std::vector<std::filesystem::path> ShipLoadDialog<TUsageType>::SearchLibrary(std::string const & query) const
+{
+    std::vector<std::filesystem::path> results;
+
+    std::scoped_lock lock(mSearchIndicesMutex);
+
+    for (auto const & [_, searchIndex] : mSearchIndices)
+    {
+        auto const indexResults = searchIndex->Search(query);
+        results.insert(results.end(), indexResults.cbegin(), indexResults.cend());
+    }
+
+    return results;
+}
+
+template<ShipLoadDialogUsageType TUsageType>
+bool ShipLoadDialog<TUsageType>::GoToShip(std::filesystem::path const & shipFilepath)
+{
+    std::filesystem::path const shipDirectoryPath = shipFilepath.parent_path();
+    if (std::filesystem::path(mDirCtrl->GetPath().ToStdString()).lexically_normal() != shipDirectoryPath.lexically_normal())
+    {
+        // Changing directory clears the search, which we want to keep
+        wxString const searchString = mShipSearchCtrl->GetValue();
+
+        mDirCtrl->SetPath(shipDirectoryPath.string()); // Will send its own event
+
+        mShipSearchCtrl->ChangeValue(searchString);
+        mShipSearchCtrl->SetInsertionPointEnd();
+    }
+
+    return mShipPreviewWindow->SelectShip(shipFilepath);
+}
+
 template class ShipLoadDialog<ShipLoadDialogUsageType::ForGame>;
 template class ShipLoadDialog<ShipLoadDialogUsageType::ForShipBuilder>;
\ No newline at end of file
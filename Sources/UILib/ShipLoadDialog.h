@@ -9,6 +9,7 @@
 
 #include <Game/GameAssetManager.h>
 #include <Game/ShipLoadSpecifications.h>
+#include <Game/ShipSearchIndex.h>
 
 #include <UILib/BitmapButton.h>
 #include <UILib/BitmapToggleButton.h>
@@ -19,9 +20,14 @@
 #include <wx/popupwin.h>
 #include <wx/srchctrl.h>
 
+#include <atomic>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 enum class ShipLoadDialogUsageType
@@ -99,6 +105,11 @@ private:
     void StartShipSearch();
     void RepopulateRecentDirectoriesComboBox(std::vector<std::filesystem::path> const & shipLoadDirectories);
 
+    void StartSearchIndexThread();
+    void StopSearchIndexThread();
+    std::vector<std::filesystem::path> SearchLibrary(std::string const & query) const;
+    bool GoToShip(std::filesystem::path const & shipFilepath);
+
 private:
 
     wxWindow * const mParent;
@@ -137,4 +148,17 @@ private:
     std::optional<ShipMetadata> mSelectedShipMetadata;
     std::optional<std::filesystem::path> mSelectedShipFilepath;
     std::optional<std::filesystem::path> mChosenShipFilepath;
+
+    //
+    // Library-wide search
+    //
+    // The search indices of the ship libraries are brought up-to-date by a
+    // thread each time the dialog is opened, and published as each is done
+    //
+
+    std::thread mSearchIndexThread;
+    std::atomic<bool> mIsSearchIndexThreadInterrupted;
+
+    std::map<std::filesystem::path, std::shared_ptr<ShipSearchIndex const>> mSearchIndices;
+    mutable std::mutex mSearchIndicesMutex;
 };
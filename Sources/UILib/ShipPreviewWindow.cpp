@@ -15,8 +15,10 @@
 #include <Core/GameException.h>
 #include <Core/ImageTools.h>
 #include <Core/Log.h>
+#include <Core/ThreadManager.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
 wxDEFINE_EVENT(fsEVT_SHIP_FILE_SELECTED, ShipPreviewWindow::fsShipFileSelectedEvent);
@@ -53,6 +55,11 @@ ShipPreviewWindow::ShipPreviewWindow(
     , mSortPredicate(MakeSortPredicate(mSortMethod, mIsSortDescending))
     , mCurrentlyCompletedDirectorySnapshot()
     //
+    , mDirectoryWatcher()
+    , mWatchedDirectoryPath()
+    , mHasWatchedDirectoryChanged(false)
+    , mLastWatchedDirectoryChangeTimestamp()
+    //
     , mPreviewThread()
     , mPanelToThreadMessage()
     , mPanelToThreadMessageMutex()
@@ -93,6 +100,9 @@ ShipPreviewWindow::ShipPreviewWindow(
     // Setup poll queue timer
     mPollQueueTimer = std::make_unique<wxTimer>(this, wxID_ANY);
     Bind(wxEVT_TIMER, &ShipPreviewWindow::OnPollQueueTimer, this, mPollQueueTimer->GetId());
+
+    // Register directory watcher events
+    Bind(wxEVT_FSWATCHER, &ShipPreviewWindow::OnFileSystemWatcherEvent, this);
 }
 
 ShipPreviewWindow::~ShipPreviewWindow()
@@ -144,6 +154,20 @@ void ShipPreviewWindow::SetDirectory(std::filesystem::path const & directoryPath
 {
     LogMessage("ShipPreviewWindow::SetDirectory(", directoryPath.string(), ")");
 
+    // Spare the scan altogether if we're already complete on this directory, and it hasn't changed since
+    if (mCurrentlyCompletedDirectorySnapshot.has_value()
+        && mCurrentlyCompletedDirectorySnapshot->DirectoryPath == directoryPath
+        && mWatchedDirectoryPath == directoryPath
+        && !mHasWatchedDirectoryChanged)
+    {
+        LogMessage("ShipPreviewWindow::SetDirectory(", directoryPath.string(), "): no change notified");
+        return;
+    }
+
+    // Start watching before scanning, so to not miss changes happening in between
+    WatchDirectory(directoryPath);
+    mHasWatchedDirectoryChanged = false;
+
     //
     // Build set of files from directory
     //
@@ -266,6 +290,23 @@ bool ShipPreviewWindow::Search(std::string const & shipName)
     return foundShipIndex.has_value();
 }
 
+bool ShipPreviewWindow::SelectShip(std::filesystem::path const & shipFilepath)
+{
+    auto const shipFilename = shipFilepath.filename();
+
+    for (size_t i = 0; i < mInfoTiles.size(); ++i)
+    {
+        if (mInfoTiles[i].ShipFilepath.filename() == shipFilename)
+        {
+            EnsureInfoTileIsVisible(i);
+            SelectInfoTile(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void ShipPreviewWindow::SetSortMethod(SortMethod sortMethod)
 {
     mSortMethod = sortMethod;
@@ -553,6 +594,47 @@ void ShipPreviewWindow::OnPollQueueTimer(wxTimerEvent & /*event*/)
 
         EnsureSelectedShipIsVisible();
     }
+
+    // Pick up changes to the current directory, once they've settled
+    if (mHasWatchedDirectoryChanged
+        && mWatchedDirectoryPath.has_value()
+        && std::chrono::steady_clock::now() - mLastWatchedDirectoryChangeTimestamp >= WatchedDirectoryChangeSettleTime)
+    {
+        std::optional<std::filesystem::path> selectedShipFilepath;
+        if (mSelectedShipFileId.has_value())
+        {
+            selectedShipFilepath = mInfoTiles[ShipFileIdToInfoTileIndex(*mSelectedShipFileId)].ShipFilepath;
+        }
+
+        LogMessage("ShipPreviewWindow::OnPollQueueTimer: change notified for ", mWatchedDirectoryPath->string());
+
+        std::filesystem::path const directoryPath = *mWatchedDirectoryPath;
+        SetDirectory(directoryPath);
+
+        // Keep the selection, if the ship is still there
+        if (selectedShipFilepath.has_value())
+        {
+            SelectShip(*selectedShipFilepath);
+        }
+    }
+}
+
+void ShipPreviewWindow::OnFileSystemWatcherEvent(wxFileSystemWatcherEvent & event)
+{
+    auto const isShipFile = [](wxFileName const & fileName)
+        {
+            return ShipDeSerializer::IsAnyShipDefinitionFile(std::filesystem::path(fileName.GetFullPath().ToStdString()));
+        };
+
+    if (event.GetChangeType() == wxFSW_EVENT_WARNING
+        || event.GetChangeType() == wxFSW_EVENT_ERROR
+        || isShipFile(event.GetPath())
+        || (event.GetChangeType() == wxFSW_EVENT_RENAME && isShipFile(event.GetNewPath())))
+    {
+        // Warnings and errors mean that we might have missed changes
+        mHasWatchedDirectoryChanged = true;
+        mLastWatchedDirectoryChangeTimestamp = std::chrono::steady_clock::now();
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -835,6 +917,36 @@ std::function<bool(ShipPreviewWindow::InfoTile const &, ShipPreviewWindow::InfoT
     };
 }
 
+void ShipPreviewWindow::WatchDirectory(std::filesystem::path const & directoryPath)
+{
+    if (mWatchedDirectoryPath == directoryPath)
+    {
+        return;
+    }
+
+    if (!mDirectoryWatcher)
+    {
+        // Created lazily, as it needs the event loop to be running
+        mDirectoryWatcher = std::make_unique<wxFileSystemWatcher>();
+        mDirectoryWatcher->SetOwner(this);
+    }
+
+    mDirectoryWatcher->RemoveAll();
+    mWatchedDirectoryPath.reset();
+
+    if (mDirectoryWatcher->Add(
+        wxFileName::DirName(directoryPath.string()),
+        wxFSW_EVENT_CREATE | wxFSW_EVENT_DELETE | wxFSW_EVENT_RENAME | wxFSW_EVENT_MODIFY | wxFSW_EVENT_WARNING | wxFSW_EVENT_ERROR))
+    {
+        mWatchedDirectoryPath = directoryPath;
+    }
+    else
+    {
+        // We'll just have to scan each time
+        LogMessage("ShipPreviewWindow::WatchDirectory(", directoryPath.string(), "): cannot watch directory");
+    }
+}
+
 ShipPreviewWindow::DirectorySnapshot ShipPreviewWindow::EnumerateShipFiles(std::filesystem::path const & directoryPath)
 {
     std::vector<std::tuple<std::filesystem::path, std::filesystem::file_time_type>> files;
@@ -1016,6 +1128,8 @@ void ShipPreviewWindow::Render(wxDC & dc)
         // Calculate left margin for content of info tile
         int const infoTileContentLeftMargin = mExpandedHorizontalMargin / 2 + InfoTileInset;
 
+        std::vector<ShipFileId_t> visibleShipFileIds;
+
         // Process all info tiles
         for (size_t i = 0; i < mInfoTiles.size(); ++i)
         {
@@ -1025,6 +1139,8 @@ void ShipPreviewWindow::Render(wxDC & dc)
             // Check if this info tile's virtual rect intersects the visible one
             if (visibleRectVirtual.Intersects(infoTileRectVirtual))
             {
+                visibleShipFileIds.emplace_back(infoTile.ShipFileId);
+
                 //
                 // Bitmap
                 //
@@ -1178,9 +1294,19 @@ void ShipPreviewWindow::Render(wxDC & dc)
                 }
             }
         }
+
+        // Let the preview workers know what to serve first
+        PublishVisibleShipFileIds(std::move(visibleShipFileIds));
     }
 }
 
+void ShipPreviewWindow::PublishVisibleShipFileIds(std::vector<ShipFileId_t> && visibleShipFileIds)
+{
+    std::scoped_lock lock(mVisibleShipFileIdsMutex);
+
+    mVisibleShipFileIds = std::move(visibleShipFileIds);
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 
 void ShipPreviewWindow::ShutdownPreviewThread()
@@ -1204,6 +1330,8 @@ void ShipPreviewWindow::RunPreviewThread()
 {
     LogMessage("PreviewThread::Enter");
 
+    ThreadManager::InitializeThisBackgroundThread();
+
     while (true)
     {
         //
@@ -1284,53 +1412,112 @@ void ShipPreviewWindow::ScanDirectorySnapshot(DirectorySnapshot && directorySnap
     auto previewDirectoryManager = ShipPreviewDirectoryManager::Create(directorySnapshot.DirectoryPath);
 
     //
-    // Process all files and create previews
+    // Process all files and create previews, with a few workers - this
+    // thread being one of them; files whose info tiles are visible go first
     //
 
-    for (auto fileIt = directorySnapshot.FileEntries.cbegin(); fileIt != directorySnapshot.FileEntries.cend(); ++fileIt)
+    size_t const fileEntryCount = directorySnapshot.FileEntries.size();
+
+    std::vector<size_t> shipFileIdToFileEntryIndex(fileEntryCount);
+    for (size_t f = 0; f < fileEntryCount; ++f)
     {
-        // Check whether we have been interrupted
-        if (!!mPanelToThreadMessage)
-        {
-            LogMessage("PreviewThread::ScanDirectorySnapshot(): interrupted, exiting");
+        assert(directorySnapshot.FileEntries[f].ShipFileId.Value < fileEntryCount);
+        shipFileIdToFileEntryIndex[directorySnapshot.FileEntries[f].ShipFileId.Value] = f;
+    }
 
-            // Commit - with a partial visit
-            previewDirectoryManager->Commit(false);
+    std::mutex fileEntryClaimMutex;
+    std::vector<bool> isFileEntryClaimed(fileEntryCount, false);
+    size_t nextFileEntryIndex = 0;
 
-            return;
-        }
+    auto const claimNextFileEntry = [&]() -> std::optional<size_t>
+    {
+        std::scoped_lock claimLock(fileEntryClaimMutex);
 
-        try
         {
-            // Load preview data
-            auto shipPreviewData = ShipDeSerializer::LoadShipPreviewData(fileIt->FilePath);
-
-            // Load preview image
-            auto shipPreviewImage = previewDirectoryManager->LoadPreviewImage(shipPreviewData, PreviewImageSize);
-
-            // Notify
-            QueueThreadToPanelMessage(
-                ThreadToPanelMessage::MakePreviewReadyMessage(
-                    fileIt->ShipFileId,
-                    std::move(shipPreviewData),
-                    std::move(shipPreviewImage)));
+            std::scoped_lock visibleLock(mVisibleShipFileIdsMutex);
+
+            for (ShipFileId_t const shipFileId : mVisibleShipFileIds)
+            {
+                // Note: IDs might be from an older directory, in which case this is just a bad guess
+                if (shipFileId.Value < fileEntryCount)
+                {
+                    size_t const f = shipFileIdToFileEntryIndex[shipFileId.Value];
+                    if (!isFileEntryClaimed[f])
+                    {
+                        isFileEntryClaimed[f] = true;
+                        return f;
+                    }
+                }
+            }
         }
-        catch (std::exception const & ex)
+
+        for (; nextFileEntryIndex < fileEntryCount; ++nextFileEntryIndex)
         {
-            LogMessage("PreviewThread::ScanDirectorySnapshot(): encountered error (", std::string(ex.what()), "), notifying...");
+            if (!isFileEntryClaimed[nextFileEntryIndex])
+            {
+                isFileEntryClaimed[nextFileEntryIndex] = true;
+                return nextFileEntryIndex++;
+            }
+        }
+
+        return std::nullopt;
+    };
 
-            // Notify
-            QueueThreadToPanelMessage(
-                ThreadToPanelMessage::MakePreviewErrorMessage(
-                    fileIt->ShipFileId,
-                    "Cannot load preview"));
+    std::atomic<bool> isInterrupted(false);
+
+    auto const runWorker = [&]()
+    {
+        while (true)
+        {
+            // Check whether we have been interrupted - our work is stale then
+            if (IsScanInterrupted())
+            {
+                isInterrupted = true;
+                break;
+            }
 
-            LogMessage("PreviewThread::ScanDirectorySnapshot(): ...error notified.");
+            auto const fileEntryIndex = claimNextFileEntry();
+            if (!fileEntryIndex.has_value())
+            {
+                // We're done
+                break;
+            }
 
-            // Keep going
+            LoadPreview(directorySnapshot.FileEntries[*fileEntryIndex], *previewDirectoryManager);
         }
+    };
+
+    size_t const workerCount = std::max(
+        size_t(1),
+        std::min({ MaxPreviewWorkers, ThreadManager::GetNumberOfProcessors(), fileEntryCount }));
+
+    std::vector<std::thread> workerThreads;
+    for (size_t w = 1; w < workerCount; ++w)
+    {
+        workerThreads.emplace_back(
+            [&runWorker]()
+            {
+                ThreadManager::InitializeThisBackgroundThread();
+                runWorker();
+            });
+    }
+
+    runWorker();
+
+    for (auto & workerThread : workerThreads)
+    {
+        workerThread.join();
     }
 
+    if (isInterrupted)
+    {
+        LogMessage("PreviewThread::ScanDirectorySnapshot(): interrupted, exiting");
+
+        // Commit - with a partial visit
+        previewDirectoryManager->Commit(false);
+
+        return;
+    }
 
     //
     // Notify completion
@@ -1349,6 +1536,48 @@ void ShipPreviewWindow::ScanDirectorySnapshot(DirectorySnapshot && directorySnap
     LogMessage("PreviewThread::ScanDirectorySnapshot(): ...preview completed.");
 }
 
+void ShipPreviewWindow::LoadPreview(
+    DirectorySnapshot::FileEntry const & fileEntry,
+    ShipPreviewDirectoryManager & previewDirectoryManager)
+{
+    try
+    {
+        // Load preview data
+        auto shipPreviewData = ShipDeSerializer::LoadShipPreviewData(fileEntry.FilePath);
+
+        // Load preview image
+        auto shipPreviewImage = previewDirectoryManager.LoadPreviewImage(shipPreviewData, PreviewImageSize);
+
+        // Notify
+        QueueThreadToPanelMessage(
+            ThreadToPanelMessage::MakePreviewReadyMessage(
+                fileEntry.ShipFileId,
+                std::move(shipPreviewData),
+                std::move(shipPreviewImage)));
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("PreviewThread::LoadPreview(): encountered error (", std::string(ex.what()), "), notifying...");
+
+        // Notify
+        QueueThreadToPanelMessage(
+            ThreadToPanelMessage::MakePreviewErrorMessage(
+                fileEntry.ShipFileId,
+                "Cannot load preview"));
+
+        LogMessage("PreviewThread::LoadPreview(): ...error notified.");
+
+        // Keep going
+    }
+}
+
+bool ShipPreviewWindow::IsScanInterrupted()
+{
+    std::scoped_lock lock(mPanelToThreadMessageMutex);
+
+    return !!mPanelToThreadMessage;
+}
+
 void ShipPreviewWindow::QueueThreadToPanelMessage(std::unique_ptr<ThreadToPanelMessage> message)
 {
     // Lock queue
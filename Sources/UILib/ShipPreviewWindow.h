@@ -7,15 +7,18 @@
 
 #include <Game/EnhancedShipPreviewData.h>
 #include <Game/GameAssetManager.h>
+#include <Game/ShipPreviewDirectoryManager.h>
 
 #include <Core/ImageData.h>
 #include <Core/PortableTimepoint.h>
 #include <Core/StrongTypeDef.h>
 
+#include <wx/fswatcher.h>
 #include <wx/timer.h>
 #include <wx/wx.h>
 
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <filesystem>
@@ -214,6 +217,12 @@ public:
 
     bool Search(std::string const & shipName);
 
+    /*
+     * Selects the ship with the specified file - which is expected to be in the current directory -
+     * if it's there.
+     */
+    bool SelectShip(std::filesystem::path const & shipFilepath);
+
     SortMethod GetCurrentSortMethod() const
     {
         return mSortMethod;
@@ -240,6 +249,7 @@ private:
     void OnMouseDoubleClick(wxMouseEvent & event);
     void OnKeyDown(wxKeyEvent & event);
     void OnPollQueueTimer(wxTimerEvent & event);
+    void OnFileSystemWatcherEvent(wxFileSystemWatcherEvent & event);
 
 private:
 
@@ -435,6 +445,23 @@ private:
     // When set, indicates that the preview of this directory is completed
     std::optional<DirectorySnapshot> mCurrentlyCompletedDirectorySnapshot;
 
+    ////////////////////////////////////////////////
+    // Directory watching
+    ////////////////////////////////////////////////
+
+    // The current directory is watched for changes to its ship files, so that re-visiting it
+    // while it's unchanged costs no scan, and so that changes show up while we're open
+
+    void WatchDirectory(std::filesystem::path const & directoryPath);
+
+    // How long to wait after the last change before picking changes up, so to pick up bursts at once
+    static std::chrono::milliseconds constexpr WatchedDirectoryChangeSettleTime = std::chrono::milliseconds(500);
+
+    std::unique_ptr<wxFileSystemWatcher> mDirectoryWatcher;
+    std::optional<std::filesystem::path> mWatchedDirectoryPath;
+    bool mHasWatchedDirectoryChanged;
+    std::chrono::steady_clock::time_point mLastWatchedDirectoryChangeTimestamp;
+
     ////////////////////////////////////////////////
     // Preview Thread
     ////////////////////////////////////////////////
@@ -443,6 +470,23 @@ private:
 
     void RunPreviewThread();
     void ScanDirectorySnapshot(DirectorySnapshot && directorySnapshot);
+    void LoadPreview(
+        DirectorySnapshot::FileEntry const & fileEntry,
+        ShipPreviewDirectoryManager & previewDirectoryManager);
+    bool IsScanInterrupted();
+
+    // Max number of threads loading previews, including the preview thread itself
+    static size_t constexpr MaxPreviewWorkers = 4;
+
+    //
+    // Panel-to-workers visibility hint
+    //
+
+    void PublishVisibleShipFileIds(std::vector<ShipFileId_t> && visibleShipFileIds);
+
+    // The ship files whose info tiles are currently visible, which workers serve first
+    std::vector<ShipFileId_t> mVisibleShipFileIds;
+    std::mutex mVisibleShipFileIdsMutex;
 
     //
     // Panel-to-Thread communication
@@ -0,0 +1,136 @@
+#include <Core/AABBGrid.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+std::vector<ElementIndex> CollectCandidates(
+    Geometry::AABBGrid const & grid,
+    vec2f const & position)
+{
+    std::vector<ElementIndex> candidates;
+    grid.VisitCandidates(
+        position,
+        [&](ElementIndex element)
+        {
+            candidates.push_back(element);
+            return false;
+        });
+
+    return candidates;
+}
+
+}
+
+TEST(AABBGridTests, Empty)
+{
+    Geometry::AABBGrid grid;
+
+    grid.Build({}, 4.0f);
+
+    EXPECT_TRUE(grid.IsEmpty());
+    EXPECT_TRUE(CollectCandidates(grid, vec2f(0.0f, 0.0f)).empty());
+}
+
+TEST(AABBGridTests, VisitsOnlyOverlappingElements)
+{
+    // A 10x10 grid of unit boxes
+    std::vector<Geometry::AABBGrid::Entry> entries;
+    for (int y = 0; y < 10; ++y)
+    {
+        for (int x = 0; x < 10; ++x)
+        {
+            entries.emplace_back(
+                static_cast<ElementIndex>(y * 10 + x),
+                Geometry::AABB(static_cast<float>(x), static_cast<float>(x + 1), static_cast<float>(y + 1), static_cast<float>(y)));
+        }
+    }
+
+    Geometry::AABBGrid grid;
+    grid.Build(entries, 1.0f);
+
+    ASSERT_FALSE(grid.IsEmpty());
+
+    for (auto const & position : { vec2f(0.5f, 0.5f), vec2f(3.25f, 7.75f), vec2f(9.5f, 9.5f), vec2f(10.0f, 10.0f), vec2f(0.0f, 0.0f) })
+    {
+        auto const candidates = CollectCandidates(grid, position);
+
+        // All the elements containing the position are there...
+        for (auto const & entry : entries)
+        {
+            if (entry.Box.Contains(position))
+            {
+                EXPECT_NE(std::find(candidates.cbegin(), candidates.cend(), entry.Element), candidates.cend());
+            }
+        }
+
+        // ...but not many others
+        EXPECT_LE(candidates.size(), 9u);
+    }
+
+    EXPECT_TRUE(CollectCandidates(grid, vec2f(-0.5f, 5.0f)).empty());
+    EXPECT_TRUE(CollectCandidates(grid, vec2f(5.0f, 10.5f)).empty());
+}
+
+TEST(AABBGridTests, VisitsInInsertionOrder)
+{
+    std::vector<Geometry::AABBGrid::Entry> entries;
+    entries.emplace_back(2, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    entries.emplace_back(5, Geometry::AABB(4.0f, 6.0f, 6.0f, 4.0f));
+    entries.emplace_back(7, Geometry::AABB(0.0f, 1.0f, 1.0f, 0.0f));
+    entries.emplace_back(9, Geometry::AABB(3.0f, 7.0f, 7.0f, 3.0f));
+
+    Geometry::AABBGrid grid;
+    grid.Build(entries, 1.0f);
+
+    auto const candidates = CollectCandidates(grid, vec2f(5.0f, 5.0f));
+
+    ASSERT_EQ(candidates.size(), 3u);
+    EXPECT_EQ(candidates[0], 2u);
+    EXPECT_EQ(candidates[1], 5u);
+    EXPECT_EQ(candidates[2], 9u);
+}
+
+TEST(AABBGridTests, StopsWhenVisitorSaysSo)
+{
+    std::vector<Geometry::AABBGrid::Entry> entries;
+    entries.emplace_back(0, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    entries.emplace_back(1, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+
+    Geometry::AABBGrid grid;
+    grid.Build(entries, 4.0f);
+
+    size_t visitCount = 0;
+    grid.VisitCandidates(
+        vec2f(5.0f, 5.0f),
+        [&](ElementIndex)
+        {
+            ++visitCount;
+            return true;
+        });
+
+    EXPECT_EQ(visitCount, 1u);
+}
+
+TEST(AABBGridTests, DegenerateBounds)
+{
+    // All elements on a line
+    std::vector<Geometry::AABBGrid::Entry> entries;
+    for (int x = 0; x < 100; ++x)
+    {
+        entries.emplace_back(
+            static_cast<ElementIndex>(x),
+            Geometry::AABB(static_cast<float>(x), static_cast<float>(x) + 0.5f, 3.0f, 3.0f));
+    }
+
+    Geometry::AABBGrid grid;
+    grid.Build(entries, 2.0f);
+
+    auto const candidates = CollectCandidates(grid, vec2f(42.25f, 3.0f));
+
+    EXPECT_NE(std::find(candidates.cbegin(), candidates.cend(), 42u), candidates.cend());
+    EXPECT_LE(candidates.size(), 8u);
+}
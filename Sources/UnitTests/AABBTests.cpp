@@ -3,6 +3,9 @@
 
 #include "gtest/gtest.h"
 
+#include <utility>
+#include <vector>
+
 TEST(AABBTests, AABB_Contains)
 {
     Geometry::AABB t(10.0f, 20.0f, 100.0f, 90.0f);
@@ -22,6 +25,20 @@ TEST(AABBTests, AABB_ContainsWithMargin)
     EXPECT_TRUE(t.Contains(vec2f(15.0f, 89.0f), 2.0f));
 }
 
+TEST(AABBTests, AABB_IntersectsWithMargin)
+{
+    Geometry::AABB t(10.0f, 20.0f, 100.0f, 90.0f);
+
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(15.0f, 16.0f, 96.0f, 95.0f), 0.0f)); // Inside
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(0.0f, 30.0f, 110.0f, 80.0f), 0.0f)); // Enclosing
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(18.0f, 25.0f, 95.0f, 85.0f), 0.0f)); // Overlapping
+    EXPECT_FALSE(t.Intersects(Geometry::AABB(21.0f, 25.0f, 95.0f, 94.0f), 0.0f));
+    EXPECT_FALSE(t.Intersects(Geometry::AABB(15.0f, 16.0f, 89.0f, 80.0f), 0.0f));
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(21.0f, 25.0f, 95.0f, 94.0f), 2.0f));
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(15.0f, 16.0f, 89.0f, 80.0f), 2.0f));
+    EXPECT_FALSE(t.Intersects(Geometry::AABB(23.0f, 25.0f, 95.0f, 94.0f), 2.0f));
+}
+
 TEST(AABBTests, AABBSet_Contains)
 {
     Geometry::AABBSet t;
@@ -48,3 +65,42 @@ TEST(AABBTests, AABBSet_MakeUnion)
     EXPECT_EQ(res->TopRight, vec2f(25.0f, 100.0f));
     EXPECT_EQ(res->BottomLeft, vec2f(10.0f, 70.0f));
 }
+
+TEST(AABBTests, AABBSet_VisitIntersectingPairs)
+{
+    Geometry::AABBSet t;
+    t.Add(Geometry::AABB(10.0f, 20.0f, 100.0f, 80.0f)); // 0
+    t.Add(Geometry::AABB(-50.0f, -40.0f, 100.0f, 80.0f)); // 1: isolated
+    t.Add(Geometry::AABB(15.0f, 25.0f, 91.0f, 70.0f)); // 2: overlaps 0
+    t.Add(Geometry::AABB(0.0f, 30.0f, 50.0f, 40.0f)); // 3: below 0 and 2
+    t.Add(Geometry::AABB(21.0f, 22.0f, 85.0f, 84.0f)); // 4: in 2, 1 to the right of 0
+
+    std::vector<std::pair<size_t, size_t>> pairs;
+    t.VisitIntersectingPairs(
+        0.0f,
+        [&pairs](size_t i, size_t j)
+        {
+            pairs.emplace_back(i, j);
+        });
+
+    std::sort(pairs.begin(), pairs.end());
+    ASSERT_EQ(2u, pairs.size());
+    EXPECT_EQ(std::make_pair(size_t(0), size_t(2)), pairs[0]);
+    EXPECT_EQ(std::make_pair(size_t(2), size_t(4)), pairs[1]);
+
+    // With margin
+
+    pairs.clear();
+    t.VisitIntersectingPairs(
+        1.5f,
+        [&pairs](size_t i, size_t j)
+        {
+            pairs.emplace_back(i, j);
+        });
+
+    std::sort(pairs.begin(), pairs.end());
+    ASSERT_EQ(3u, pairs.size());
+    EXPECT_EQ(std::make_pair(size_t(0), size_t(2)), pairs[0]);
+    EXPECT_EQ(std::make_pair(size_t(0), size_t(4)), pairs[1]);
+    EXPECT_EQ(std::make_pair(size_t(2), size_t(4)), pairs[2]);
+}
@@ -415,6 +415,63 @@ TEST(AlgorithmsTests, DiffuseLight_NeonVectorized_8Lamps)
 }
 #endif
 
+TEST(AlgorithmsTests, DiffuseLight_Tiled_MatchesNaive)
+{
+    ElementIndex constexpr PointCount = 1000;
+    ElementIndex constexpr LampCount = 40;
+
+    auto pointPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(PointCount);
+    auto pointPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(PointCount);
+    for (ElementIndex p = 0; p < PointCount; ++p)
+    {
+        // A strip of points, walked in rows as ships are
+        pointPositions[p] = vec2f(static_cast<float>(p % 50), static_cast<float>(p / 50));
+        pointPlaneIds[p] = static_cast<PlaneId>(p % 7);
+    }
+
+    auto lampPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(LampCount);
+    auto lampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(LampCount);
+    auto lampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(LampCount);
+    auto lampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(LampCount);
+    for (ElementIndex l = 0; l < LampCount; ++l)
+    {
+        lampPositions[l] = vec2f(static_cast<float>((l * 13) % 50) + 0.5f, static_cast<float>((l * 7) % 20) + 0.25f);
+        lampPlaneIds[l] = static_cast<PlaneId>(l % 7);
+        lampDistanceCoeffs[l] = (l % 5 == 0) ? 0.0f : 0.05f * static_cast<float>(l % 4 + 1);
+        lampSpreadMaxDistances[l] = 1.0f + static_cast<float>(l % 6);
+    }
+
+    auto expectedLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(PointCount);
+    Algorithms::DiffuseLight_Naive(
+        pointPositions.get(),
+        pointPlaneIds.get(),
+        PointCount,
+        lampPositions.get(),
+        lampPlaneIds.get(),
+        lampDistanceCoeffs.get(),
+        lampSpreadMaxDistances.get(),
+        LampCount,
+        expectedLightBuffer.get());
+
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(PointCount);
+    Algorithms::DiffuseLight_Tiled(
+        0,
+        PointCount,
+        pointPositions.get(),
+        pointPlaneIds.get(),
+        lampPositions.get(),
+        lampPlaneIds.get(),
+        lampDistanceCoeffs.get(),
+        lampSpreadMaxDistances.get(),
+        LampCount,
+        outLightBuffer.get());
+
+    for (ElementIndex p = 0; p < PointCount; ++p)
+    {
+        EXPECT_NEAR(expectedLightBuffer[p], outLightBuffer[p], 0.0001f);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -603,6 +660,334 @@ TEST(AlgorithmsTests, CalculateSpringVectors_NeonVectorized)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// CalculateSpringOutboundWaterVelocities
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Algorithm>
+void RunCalculateSpringOutboundWaterVelocitiesTest(Algorithm algorithm)
+{
+    static size_t constexpr NumSprings = 4;
+    static size_t constexpr NumPoints = 6;
+
+    aligned_to_vword std::array<vec2f, NumPoints> const positions = {
+        vec2f(0.0f, 0.0f),
+        vec2f(1.0f, 0.0f),
+        vec2f(1.0f, 1.0f),
+        vec2f(0.0f, 3.0f),
+        vec2f(-2.0f, 0.5f),
+        vec2f(5.0f, -1.0f)
+    };
+
+    aligned_to_vword std::array<float, NumPoints> const waters = { 0.0f, 1.0f, 0.5f, 2.0f, 0.0f, 0.25f };
+
+    aligned_to_vword std::array<vec2f, NumPoints> const waterVelocities = {
+        vec2f(0.0f, 0.0f),
+        vec2f(1.0f, 0.0f),
+        vec2f(-1.0f, 2.0f),
+        vec2f(0.0f, -3.0f),
+        vec2f(4.0f, 0.5f),
+        vec2f(0.0f, 0.0f)
+    };
+
+    static std::array<SpringEndpoints, NumSprings> const endpoints = {
+        SpringEndpoints{0, 1},
+        SpringEndpoints{1, 2},
+        SpringEndpoints{3, 2},
+        SpringEndpoints{4, 5}
+    };
+
+    aligned_to_vword std::array<vec2f, NumSprings> normalizedVectors;
+    for (size_t s = 0; s < NumSprings; ++s)
+    {
+        normalizedVectors[s] = (positions[endpoints[s].PointBIndex] - positions[endpoints[s].PointAIndex]).normalise();
+    }
+
+    aligned_to_vword std::array<float, NumSprings> const factoryRestLengths = { 1.0f, 1.0f, 2.0f, 0.5f };
+
+    float constexpr WaterCrazyness = 0.5f;
+    float constexpr GravityMagnitude = 9.80f;
+
+    aligned_to_vword std::array<float, NumSprings> pointAOutboundVelocities;
+    aligned_to_vword std::array<float, NumSprings> pointBOutboundVelocities;
+    aligned_to_vword std::array<float, NumSprings> pointAOutboundWeights;
+    aligned_to_vword std::array<float, NumSprings> pointBOutboundWeights;
+
+    algorithm(
+        0,
+        endpoints.data(),
+        normalizedVectors.data(),
+        factoryRestLengths.data(),
+        positions.data(),
+        waters.data(),
+        waterVelocities.data(),
+        WaterCrazyness,
+        GravityMagnitude,
+        pointAOutboundVelocities.data(),
+        pointBOutboundVelocities.data(),
+        pointAOutboundWeights.data(),
+        pointBOutboundWeights.data());
+
+    // Verify against the point-major formulation, from each endpoint
+
+    auto const calculateOutboundVelocity = [&](ElementIndex p, ElementIndex o, vec2f const & dir)
+        {
+            float const dwy = (waters[p] - waters[o]) + (positions[p].y - positions[o].y);
+            float const bernoulliVelocity = (dwy >= 0.0f)
+                ? std::sqrt(2.0f * GravityMagnitude * dwy)
+                : -std::sqrt(2.0f * GravityMagnitude * -dwy);
+            float const alphaCrazyness = 1.0f + WaterCrazyness * (waters[p] - 1.0f);
+
+            return std::max(waterVelocities[p].dot(dir) + bernoulliVelocity * alphaCrazyness, 0.0f);
+        };
+
+    for (size_t s = 0; s < NumSprings; ++s)
+    {
+        float const expectedA = calculateOutboundVelocity(endpoints[s].PointAIndex, endpoints[s].PointBIndex, normalizedVectors[s]);
+        float const expectedB = calculateOutboundVelocity(endpoints[s].PointBIndex, endpoints[s].PointAIndex, -normalizedVectors[s]);
+
+        EXPECT_TRUE(ApproxEquals(pointAOutboundVelocities[s], expectedA, 0.001f));
+        EXPECT_TRUE(ApproxEquals(pointBOutboundVelocities[s], expectedB, 0.001f));
+        EXPECT_TRUE(ApproxEquals(pointAOutboundWeights[s], expectedA / factoryRestLengths[s], 0.001f));
+        EXPECT_TRUE(ApproxEquals(pointBOutboundWeights[s], expectedB / factoryRestLengths[s], 0.001f));
+    }
+}
+
+TEST(AlgorithmsTests, CalculateSpringOutboundWaterVelocities_Naive)
+{
+    RunCalculateSpringOutboundWaterVelocitiesTest(Algorithms::CalculateSpringOutboundWaterVelocities_Naive<SpringEndpoints>);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, CalculateSpringOutboundWaterVelocities_SSEVectorized)
+{
+    RunCalculateSpringOutboundWaterVelocitiesTest(Algorithms::CalculateSpringOutboundWaterVelocities_SSEVectorized<SpringEndpoints>);
+}
+#endif
+
+#if FS_IS_ARM_NEON()
+TEST(AlgorithmsTests, CalculateSpringOutboundWaterVelocities_NeonVectorized)
+{
+    RunCalculateSpringOutboundWaterVelocitiesTest(Algorithms::CalculateSpringOutboundWaterVelocities_NeonVectorized<SpringEndpoints>);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// DissipateHeat
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Algorithm>
+void RunDissipateHeatTest(Algorithm algorithm)
+{
+    static size_t constexpr NumPoints = 8;
+
+    aligned_to_vword std::array<vec2f, NumPoints> const positions = {
+        vec2f(0.0f, 10.0f),
+        vec2f(1.0f, -100.0f),
+        vec2f(2.0f, -5000.0f),
+        vec2f(3.0f, 5.0f),
+        vec2f(4.0f, 0.0f),
+        vec2f(5.0f, -1.0f),
+        vec2f(6.0f, 20.0f),
+        vec2f(7.0f, -2000.0f)
+    };
+
+    aligned_to_vword std::array<float, NumPoints> const cachedDepths = { -10.0f, 100.0f, 5000.0f, -5.0f, 0.0f, 1.0f, -20.0f, 2000.0f };
+    aligned_to_vword std::array<float, NumPoints> const waters = { 0.0f, 0.0f, 0.0f, 2.0f, 0.1f, 0.0f, 0.0f, 0.5f };
+    aligned_to_vword std::array<float, NumPoints> const heatCapacityReciprocals = { 0.1f, 0.2f, 0.5f, 0.01f, 30.0f, 4.0f, 0.001f, 0.3f };
+    aligned_to_vword std::array<float, NumPoints> const startTemperatures = { 500.0f, 280.0f, 400.0f, 1000.0f, 250.0f, 300.0f, 290.0f, 270.0f };
+
+    float constexpr SmotheringWaterHighWatermark = 1.0f;
+    float constexpr SurfaceWaterTemperature = 288.0f;
+    float constexpr ThermoclineSlope = -15.0f / 4000.0f;
+    float constexpr WaterCoefficient = 0.5f;
+    float constexpr AirTemperature = 298.0f;
+    float constexpr AirCoefficient = 0.05f;
+
+    aligned_to_vword std::array<float, NumPoints> temperatures = startTemperatures;
+
+    algorithm(
+        ElementIndex(0),
+        ElementIndex(NumPoints),
+        positions.data(),
+        cachedDepths.data(),
+        waters.data(),
+        heatCapacityReciprocals.data(),
+        SmotheringWaterHighWatermark,
+        SurfaceWaterTemperature,
+        ThermoclineSlope,
+        WaterCoefficient,
+        AirTemperature,
+        AirCoefficient,
+        temperatures.data());
+
+    // Verify against the original formulation, which clamps positive and negative deltas separately
+
+    for (size_t p = 0; p < NumPoints; ++p)
+    {
+        float deltaT;
+        float heatLost;
+        if (cachedDepths[p] > 0.0f || waters[p] > SmotheringWaterHighWatermark)
+        {
+            float const waterTemperature = SurfaceWaterTemperature - Clamp(positions[p].y * ThermoclineSlope, 0.0f, SurfaceWaterTemperature);
+            deltaT = startTemperatures[p] - waterTemperature;
+            heatLost = WaterCoefficient * deltaT;
+        }
+        else
+        {
+            deltaT = startTemperatures[p] - AirTemperature;
+            heatLost = AirCoefficient * deltaT;
+        }
+
+        float const dissipationDeltaT = heatLost * heatCapacityReciprocals[p];
+
+        float const expectedTemperature = (deltaT >= 0)
+            ? startTemperatures[p] - std::min(dissipationDeltaT, deltaT)
+            : startTemperatures[p] - std::max(dissipationDeltaT, deltaT);
+
+        EXPECT_TRUE(ApproxEquals(temperatures[p], expectedTemperature, 0.001f));
+    }
+}
+
+TEST(AlgorithmsTests, DissipateHeat_Naive)
+{
+    RunDissipateHeatTest(Algorithms::DissipateHeat_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, DissipateHeat_SSEVectorized)
+{
+    RunDissipateHeatTest(Algorithms::DissipateHeat_SSEVectorized);
+}
+#endif
+
+#if FS_IS_ARM_NEON()
+TEST(AlgorithmsTests, DissipateHeat_NeonVectorized)
+{
+    RunDissipateHeatTest(Algorithms::DissipateHeat_NeonVectorized);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// ApplyWorldParticleForces
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct BuoyancyCoefficients
+{
+    float Coefficient1;
+    float Coefficient2;
+};
+
+template<typename Algorithm>
+void RunApplyWorldParticleForcesTest(Algorithm algorithm)
+{
+    static size_t constexpr NumPoints = 8;
+
+    // Above water, at the interface, and under water
+    aligned_to_vword std::array<float, NumPoints> const depths = { -10.0f, -0.5f, 0.0f, 0.25f, 0.5f, 1.0f, 10.0f, 200.0f };
+    aligned_to_vword std::array<float, NumPoints> const airWaterInterfaceInverseWidths = { 1.0f, 1.0f, 1.0f, 2.0f, 1.0f, 0.5f, 1.0f, 4.0f };
+    aligned_to_vword std::array<float, NumPoints> const masses = { 1.0f, 10.0f, 100.0f, 2.5f, 1000.0f, 0.5f, 30.0f, 7.0f };
+    aligned_to_vword std::array<BuoyancyCoefficients, NumPoints> const buoyancyCoefficients = {
+        BuoyancyCoefficients{1.0f, 0.0f},
+        BuoyancyCoefficients{0.5f, 0.01f},
+        BuoyancyCoefficients{2.0f, -0.001f},
+        BuoyancyCoefficients{0.0f, 0.0f},
+        BuoyancyCoefficients{3.0f, 0.002f},
+        BuoyancyCoefficients{0.1f, 0.1f},
+        BuoyancyCoefficients{1.0f, 0.0f},
+        BuoyancyCoefficients{0.7f, 0.003f}
+    };
+    aligned_to_vword std::array<float, NumPoints> const temperatures = { 298.0f, 300.0f, 1000.0f, 250.0f, 298.0f, 400.0f, 280.0f, 290.0f };
+    aligned_to_vword std::array<vec2f, NumPoints> const velocities = {
+        vec2f(0.0f, 0.0f),
+        vec2f(1.0f, -2.0f),
+        vec2f(-3.0f, 0.5f),
+        vec2f(10.0f, 10.0f),
+        vec2f(0.0f, -20.0f),
+        vec2f(5.0f, 0.0f),
+        vec2f(-1.0f, -1.0f),
+        vec2f(0.25f, 4.0f)
+    };
+    aligned_to_vword std::array<float, NumPoints> const windReceptivities = { 1.0f, 0.5f, 0.0f, 2.0f, 1.0f, 0.1f, 1.0f, 0.3f };
+    aligned_to_vword std::array<vec2f, NumPoints> const startStaticForces = {
+        vec2f(0.0f, 0.0f),
+        vec2f(1.0f, 1.0f),
+        vec2f(-5.0f, 0.0f),
+        vec2f(0.0f, 100.0f),
+        vec2f(2.0f, -2.0f),
+        vec2f(0.0f, 0.0f),
+        vec2f(10.0f, 0.0f),
+        vec2f(0.0f, -0.5f)
+    };
+
+    vec2f const Gravity = vec2f(0.0f, -9.80f);
+    float constexpr AirDensity = 1.2754f;
+    float constexpr WaterDensity = 1000.0f;
+    float constexpr AirFrictionDragCoefficient = 0.0006f;
+    float constexpr WaterFrictionDragCoefficient = 0.7f;
+    vec2f const GlobalWindForce = vec2f(3.0f, 0.5f);
+
+    aligned_to_vword std::array<vec2f, NumPoints> staticForces = startStaticForces;
+
+    algorithm(
+        ElementIndex(0),
+        ElementIndex(NumPoints),
+        depths.data(),
+        airWaterInterfaceInverseWidths.data(),
+        masses.data(),
+        buoyancyCoefficients.data(),
+        temperatures.data(),
+        velocities.data(),
+        windReceptivities.data(),
+        Gravity,
+        AirDensity,
+        WaterDensity,
+        AirFrictionDragCoefficient,
+        WaterFrictionDragCoefficient,
+        GlobalWindForce,
+        staticForces.data());
+
+    // Verify against the original formulation, with the original form of mix
+
+    for (size_t p = 0; p < NumPoints; ++p)
+    {
+        float const uw = std::min(std::max(depths[p] * airWaterInterfaceInverseWidths[p], 0.0f), 1.0f);
+
+        float const buoyancyPush = buoyancyCoefficients[p].Coefficient1 + buoyancyCoefficients[p].Coefficient2 * temperatures[p];
+        float const density = AirDensity * (1.0f - uw) + WaterDensity * uw;
+        float const frictionDragCoefficient = AirFrictionDragCoefficient * (1.0f - uw) + WaterFrictionDragCoefficient * uw;
+
+        vec2f const expectedStaticForce =
+            startStaticForces[p]
+            + Gravity * masses[p]
+            + vec2f(0.0f, buoyancyPush * density)
+            - velocities[p] * frictionDragCoefficient
+            + GlobalWindForce * windReceptivities[p] * (1.0f - uw);
+
+        EXPECT_TRUE(ApproxEquals(staticForces[p].x, expectedStaticForce.x, 0.001f));
+        EXPECT_TRUE(ApproxEquals(staticForces[p].y, expectedStaticForce.y, 0.001f));
+    }
+}
+
+TEST(AlgorithmsTests, ApplyWorldParticleForces_Naive)
+{
+    RunApplyWorldParticleForcesTest(Algorithms::ApplyWorldParticleForces_Naive<BuoyancyCoefficients>);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, ApplyWorldParticleForces_SSEVectorized)
+{
+    RunApplyWorldParticleForcesTest(Algorithms::ApplyWorldParticleForces_SSEVectorized<BuoyancyCoefficients>);
+}
+#endif
+
+#if FS_IS_ARM_NEON()
+TEST(AlgorithmsTests, ApplyWorldParticleForces_NeonVectorized)
+{
+    RunApplyWorldParticleForcesTest(Algorithms::ApplyWorldParticleForces_NeonVectorized<BuoyancyCoefficients>);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // IntegrateAndResetDynamicForces
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -735,6 +1120,16 @@ TEST(AlgorithmsTests, RunIntegrateAndResetDynamicForcesTest_2_SSEVectorized)
 {
     RunIntegrateAndResetDynamicForcesTest_2(Algorithms::IntegrateAndResetDynamicForces_SSEVectorized<IntegrateAndResetDynamicForcesPoints>);
 }
+
+TEST(AlgorithmsTests, RunIntegrateAndResetDynamicForcesTest_2_AVX2Vectorized)
+{
+    if (!IsAVX2FMASupported())
+    {
+        GTEST_SKIP() << "AVX2/FMA not supported";
+    }
+
+    RunIntegrateAndResetDynamicForcesTest_2(Algorithms::IntegrateAndResetDynamicForces_AVX2Vectorized<IntegrateAndResetDynamicForcesPoints>);
+}
 #endif
 
 #if FS_IS_ARM_NEON()
@@ -744,6 +1139,90 @@ TEST(AlgorithmsTests, RunIntegrateAndResetDynamicForcesTest_2_NeonVectorized)
 }
 #endif
 
+TEST(AlgorithmsTests, IntegrateAndResetDynamicForcesWithOverRelaxation)
+{
+    //
+    // Populate
+    //
+
+    IntegrateAndResetDynamicForcesPoints points;
+
+    for (size_t i = 0; i < IntegrateAndResetDynamicForcesInputSize; ++i)
+    {
+        auto const fi = static_cast<float>(i);
+
+        points.positionBuffer[i] = vec2f(10.0f + fi, 20.0f + fi);
+        points.velocityBuffer[i] = vec2f(100.0f + fi, 200.0f + fi);
+        points.staticForceBuffer[i] = vec2f(1000.0f + fi, 2000.0f + fi);
+        points.integrationFactorBuffer[i] = vec2f(1.0f + fi, 2.0f + fi);
+
+        points.parallelDynamicForceBuffers[0][i] = vec2f(50.0f + fi, 500.0f + fi);
+        points.parallelDynamicForceBuffers[1][i] = vec2f(70.0f + fi, 700.0f + fi);
+    }
+
+    //
+    // Run test
+    //
+
+    float const dt = 1.0f / 64.0f;
+    float const velocityFactor = 0.9f;
+    float const relaxationFactor = 1.25f;
+
+    float * const restrict dynamicForceBuffers[2] = {
+        reinterpret_cast<float *>(points.parallelDynamicForceBuffers[0]),
+        reinterpret_cast<float *>(points.parallelDynamicForceBuffers[1]) };
+
+    Algorithms::IntegrateAndResetDynamicForcesWithOverRelaxation(
+        points,
+        2, // Number of partitions
+        4, // Start
+        20, // End
+        dynamicForceBuffers,
+        dt,
+        velocityFactor,
+        relaxationFactor);
+
+    //
+    // Verify
+    //
+
+    for (size_t i = 0; i < IntegrateAndResetDynamicForcesInputSize; ++i)
+    {
+        auto const fi = static_cast<float>(i);
+
+        if (i < 4 || i >= 20)
+        {
+            EXPECT_FLOAT_EQ(points.positionBuffer[i].x, 10.0f + fi);
+            EXPECT_FLOAT_EQ(points.positionBuffer[i].y, 20.0f + fi);
+
+            EXPECT_FLOAT_EQ(points.velocityBuffer[i].x, 100.0f + fi);
+            EXPECT_FLOAT_EQ(points.velocityBuffer[i].y, 200.0f + fi);
+
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[0][i].x, 50.0f + fi);
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[1][i].y, 700.0f + fi);
+        }
+        else
+        {
+            // Only dynamic forces are over-relaxed
+            vec2f const totalDynamicForce = vec2f(50.0f + fi, 500.0f + fi) + vec2f(70.0f + fi, 700.0f + fi);
+            vec2f const deltaPos =
+                vec2f(100.0f + fi, 200.0f + fi) * dt
+                + (totalDynamicForce * relaxationFactor + points.staticForceBuffer[i]) * points.integrationFactorBuffer[i];
+
+            EXPECT_FLOAT_EQ(points.positionBuffer[i].x, 10.0f + fi + deltaPos.x);
+            EXPECT_FLOAT_EQ(points.positionBuffer[i].y, 20.0f + fi + deltaPos.y);
+
+            EXPECT_FLOAT_EQ(points.velocityBuffer[i].x, deltaPos.x * velocityFactor);
+            EXPECT_FLOAT_EQ(points.velocityBuffer[i].y, deltaPos.y * velocityFactor);
+
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[0][i].x, 0.0f);
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[0][i].y, 0.0f);
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[1][i].x, 0.0f);
+            EXPECT_FLOAT_EQ(points.parallelDynamicForceBuffers[1][i].y, 0.0f);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // ApplySpringForces
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1064,6 +1543,70 @@ TEST(AlgorithmsTests, RunApplySpringForcesTest_NeonVectorized)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// MakePointsAABB
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Algorithm>
+void RunMakePointsAABBTest(Algorithm algorithm)
+{
+    aligned_to_vword std::array<vec2f, 12> const positions = {
+        vec2f(1000.0f, 1000.0f), // Excluded
+        vec2f(-1000.0f, -1000.0f), // Excluded
+        vec2f(-1000.0f, 1000.0f), // Excluded
+        vec2f(1000.0f, -1000.0f), // Excluded
+        vec2f(0.0f, 10.0f),
+        vec2f(1.0f, -100.0f),
+        vec2f(-20.0f, 5.0f),
+        vec2f(3.0f, 5.0f),
+        vec2f(4.0f, 0.0f),
+        vec2f(50.0f, -1.0f),
+        vec2f(6.0f, 200.0f),
+        vec2f(7.0f, -2.0f)
+    };
+
+    auto const result = algorithm(
+        ElementIndex(4),
+        ElementIndex(12),
+        positions.data());
+
+    EXPECT_EQ(result.BottomLeft.x, -20.0f);
+    EXPECT_EQ(result.TopRight.x, 50.0f);
+    EXPECT_EQ(result.TopRight.y, 200.0f);
+    EXPECT_EQ(result.BottomLeft.y, -100.0f);
+
+    // Empty
+
+    auto const emptyResult = algorithm(
+        ElementIndex(4),
+        ElementIndex(4),
+        positions.data());
+
+    EXPECT_EQ(emptyResult.BottomLeft.x, std::numeric_limits<float>::max());
+    EXPECT_EQ(emptyResult.TopRight.x, std::numeric_limits<float>::lowest());
+    EXPECT_EQ(emptyResult.TopRight.y, std::numeric_limits<float>::lowest());
+    EXPECT_EQ(emptyResult.BottomLeft.y, std::numeric_limits<float>::max());
+}
+
+TEST(AlgorithmsTests, MakePointsAABB_Naive)
+{
+    RunMakePointsAABBTest(Algorithms::MakePointsAABB_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, MakePointsAABB_SSEVectorized)
+{
+    RunMakePointsAABBTest(Algorithms::MakePointsAABB_SSEVectorized);
+}
+#endif
+
+#if FS_IS_ARM_NEON()
+TEST(AlgorithmsTests, MakePointsAABB_NeonVectorized)
+{
+    RunMakePointsAABBTest(Algorithms::MakePointsAABB_NeonVectorized);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // MakeAABBWeightedUnion
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
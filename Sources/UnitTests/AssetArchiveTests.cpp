@@ -0,0 +1,122 @@
+#include <Game/AssetArchive.h>
+
+#include <Core/GameException.h>
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+    void WriteTestFile(
+        std::filesystem::path const & filePath,
+        std::string const & content)
+    {
+        std::filesystem::create_directories(filePath.parent_path());
+        std::ofstream(filePath, std::ios::binary | std::ios::trunc) << content;
+    }
+
+    std::string ToString(AssetArchive::AssetView const & assetView)
+    {
+        return std::string(reinterpret_cast<char const *>(assetView.Data), assetView.Size);
+    }
+}
+
+class AssetArchiveTests : public testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        mRootDirectoryPath = std::filesystem::temp_directory_path() / "FloatingSandbox_AssetArchiveTests";
+        std::filesystem::remove_all(mRootDirectoryPath);
+
+        WriteTestFile(mRootDirectoryPath / "Data" / "Misc" / "npcs.json", "{ \"npcs\": [] }");
+        WriteTestFile(mRootDirectoryPath / "Data" / "Shaders" / "Ship" / "ship.glsl", "void main() {}");
+        WriteTestFile(mRootDirectoryPath / "Data" / "Shaders" / "Ship" / "Inc" / "common.glslinc", "// Common");
+        WriteTestFile(mRootDirectoryPath / "Data" / "Shaders" / "empty.glsl", "");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(mRootDirectoryPath);
+    }
+
+    std::filesystem::path mRootDirectoryPath;
+};
+
+TEST_F(AssetArchiveTests, PackAndFind)
+{
+    auto const archiveFilePath = mRootDirectoryPath / AssetArchive::ArchiveFileName;
+
+    EXPECT_EQ(4u, AssetArchive::Pack(mRootDirectoryPath / "Data", archiveFilePath));
+
+    auto const archive = AssetArchive::Open(archiveFilePath);
+    ASSERT_TRUE(archive);
+    EXPECT_EQ(4u, archive->GetSize());
+
+    auto assetView = archive->Find(std::filesystem::path("Misc") / "npcs.json");
+    ASSERT_TRUE(assetView.has_value());
+    EXPECT_EQ("{ \"npcs\": [] }", ToString(*assetView));
+
+    assetView = archive->Find(std::filesystem::path("Shaders") / "Ship" / "Inc" / "common.glslinc");
+    ASSERT_TRUE(assetView.has_value());
+    EXPECT_EQ("// Common", ToString(*assetView));
+
+    assetView = archive->Find(std::filesystem::path("Shaders") / "empty.glsl");
+    ASSERT_TRUE(assetView.has_value());
+    EXPECT_EQ(0u, assetView->Size);
+
+    EXPECT_FALSE(archive->Find(std::filesystem::path("Misc") / "fish_species.json").has_value());
+}
+
+TEST_F(AssetArchiveTests, Pack_SkipsArchiveItself)
+{
+    auto const archiveFilePath = mRootDirectoryPath / "Data" / AssetArchive::ArchiveFileName;
+
+    // Twice, so that the second time the archive is already there
+    EXPECT_EQ(4u, AssetArchive::Pack(mRootDirectoryPath / "Data", archiveFilePath));
+    EXPECT_EQ(4u, AssetArchive::Pack(mRootDirectoryPath / "Data", archiveFilePath));
+
+    auto const archive = AssetArchive::Open(archiveFilePath);
+    EXPECT_EQ(4u, archive->GetSize());
+}
+
+TEST_F(AssetArchiveTests, ListFiles)
+{
+    auto const archiveFilePath = mRootDirectoryPath / AssetArchive::ArchiveFileName;
+    AssetArchive::Pack(mRootDirectoryPath / "Data", archiveFilePath);
+
+    auto const archive = AssetArchive::Open(archiveFilePath);
+
+    auto files = archive->ListFiles(std::filesystem::path("Shaders") / "Ship", false);
+    ASSERT_EQ(1u, files.size());
+    EXPECT_EQ(std::filesystem::path("Shaders/Ship/ship.glsl"), files[0]);
+
+    files = archive->ListFiles(std::filesystem::path("Shaders") / "Ship", true);
+    ASSERT_EQ(2u, files.size());
+    EXPECT_EQ(std::filesystem::path("Shaders/Ship/Inc/common.glslinc"), files[0]);
+    EXPECT_EQ(std::filesystem::path("Shaders/Ship/ship.glsl"), files[1]);
+
+    files = archive->ListFiles(".", false);
+    EXPECT_EQ(0u, files.size());
+
+    files = archive->ListFiles(".", true);
+    EXPECT_EQ(4u, files.size());
+
+    // Not a prefix match on names
+    files = archive->ListFiles("Shad", true);
+    EXPECT_EQ(0u, files.size());
+}
+
+TEST_F(AssetArchiveTests, Open_UnrecognizedFile_Throws)
+{
+    auto const archiveFilePath = mRootDirectoryPath / AssetArchive::ArchiveFileName;
+    WriteTestFile(archiveFilePath, "Not an archive at all");
+
+    EXPECT_THROW(
+        AssetArchive::Open(archiveFilePath),
+        GameException);
+}
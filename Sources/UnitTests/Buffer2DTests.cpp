@@ -1,5 +1,7 @@
 #include <Core/Buffer2D.h>
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 TEST(Buffer2DTests, FillCctor_Size)
@@ -2581,6 +2583,59 @@ TEST(Buffer2DTests, BlitFromRegion_Operator)
     }
 }
 
+TEST(Buffer2DTests, BlitFromRegion_NonTriviallyCopyable)
+{
+    Buffer2D<std::string, struct IntegralTag> sourceBuffer(3, 3, std::string("src"));
+    Buffer2D<std::string, struct IntegralTag> targetBuffer(4, 4, std::string("tgt"));
+
+    targetBuffer.BlitFromRegion(
+        sourceBuffer,
+        { IntegralCoordinates{0, 0}, IntegralRectSize{2, 2} },
+        { 1, 1 });
+
+    for (int y = 0; y < targetBuffer.Size.height; ++y)
+    {
+        for (int x = 0; x < targetBuffer.Size.width; ++x)
+        {
+            bool const isBlitted = (x >= 1 && x < 3 && y >= 1 && y < 3);
+            EXPECT_EQ(targetBuffer[IntegralCoordinates(x, y)], isBlitted ? "src" : "tgt");
+        }
+    }
+}
+
+TEST(Buffer2DTests, FillRegion)
+{
+    Buffer2D<int, struct IntegralTag> buffer(6, 5, 242);
+
+    buffer.FillRegion({ IntegralCoordinates{1, 2}, IntegralRectSize{4, 2} }, 7);
+
+    for (int y = 0; y < buffer.Size.height; ++y)
+    {
+        for (int x = 0; x < buffer.Size.width; ++x)
+        {
+            bool const isFilled = (x >= 1 && x < 5 && y >= 2 && y < 4);
+            EXPECT_EQ(buffer[IntegralCoordinates(x, y)], isFilled ? 7 : 242);
+        }
+    }
+}
+
+TEST(Buffer2DTests, IsRegionEqual)
+{
+    Buffer2D<int, struct IntegralTag> buffer1(6, 5, 242);
+    buffer1.FillRegion({ IntegralCoordinates{1, 1}, IntegralRectSize{2, 3} }, 7);
+
+    Buffer2D<int, struct IntegralTag> buffer2(4, 4, 0);
+    buffer2.FillRegion({ IntegralCoordinates{2, 0}, IntegralRectSize{2, 3} }, 7);
+
+    EXPECT_TRUE(buffer1.IsRegionEqual({ IntegralCoordinates{1, 1}, IntegralRectSize{2, 3} }, buffer2, { 2, 0 }));
+    EXPECT_FALSE(buffer1.IsRegionEqual({ IntegralCoordinates{1, 1}, IntegralRectSize{2, 3} }, buffer2, { 1, 0 }));
+    EXPECT_FALSE(buffer1.IsRegionEqual({ IntegralCoordinates{0, 1}, IntegralRectSize{3, 3} }, buffer2, { 1, 0 }));
+
+    // Last element differs
+    buffer2[IntegralCoordinates(3, 2)] = 8;
+    EXPECT_FALSE(buffer1.IsRegionEqual({ IntegralCoordinates{1, 1}, IntegralRectSize{2, 3} }, buffer2, { 2, 0 }));
+}
+
 TEST(Buffer2DTests, Flip_Horizontal)
 {
     Buffer2D<int, struct IntegralTag> buffer(8, 8);
@@ -2659,6 +2714,32 @@ TEST(Buffer2DTests, Flip_HorizontalAndVertical)
     }
 }
 
+TEST(Buffer2DTests, Flip_HorizontalAndVertical_OddSize)
+{
+    Buffer2D<int, struct IntegralTag> buffer(5, 7);
+
+    int iVal = 100;
+    for (int y = 0; y < buffer.Size.height; ++y)
+    {
+        for (int x = 0; x < buffer.Size.width; ++x)
+        {
+            buffer[IntegralCoordinates(x, y)] = iVal++;
+        }
+    }
+
+    buffer.Flip(DirectionType::Horizontal | DirectionType::Vertical);
+
+    iVal = 100;
+    for (int y = buffer.Size.height - 1; y >= 0; --y)
+    {
+        for (int x = buffer.Size.width - 1; x >= 0; --x)
+        {
+            EXPECT_EQ(buffer[IntegralCoordinates(x, y)], iVal);
+            ++iVal;
+        }
+    }
+}
+
 TEST(Buffer2DTests, MakeReframed_SameRect)
 {
     Buffer2D<int, struct IntegralTag> sourceBuffer(8, 8);
@@ -3122,6 +3203,37 @@ TEST_P(Rotate90CCWTest, Rotate90CCWTest)
     }
 }
 
+TEST(Buffer2DTests, Rotate90_LargerThanBlocks)
+{
+    Buffer2D<int, struct IntegralTag> buffer(70, 45);
+
+    for (int y = 0; y < buffer.Size.height; ++y)
+    {
+        for (int x = 0; x < buffer.Size.width; ++x)
+        {
+            buffer[IntegralCoordinates(x, y)] = y * 1000 + x;
+        }
+    }
+
+    auto cwBuffer = buffer.Clone();
+    cwBuffer.Rotate90(RotationDirectionType::Clockwise);
+
+    auto ccwBuffer = buffer.Clone();
+    ccwBuffer.Rotate90(RotationDirectionType::CounterClockwise);
+
+    ASSERT_EQ(cwBuffer.Size, IntegralRectSize(45, 70));
+    ASSERT_EQ(ccwBuffer.Size, IntegralRectSize(45, 70));
+
+    for (int y = 0; y < buffer.Size.height; ++y)
+    {
+        for (int x = 0; x < buffer.Size.width; ++x)
+        {
+            EXPECT_EQ(cwBuffer[IntegralCoordinates(y, buffer.Size.width - 1 - x)], y * 1000 + x);
+            EXPECT_EQ(ccwBuffer[IntegralCoordinates(buffer.Size.height - 1 - y, x)], y * 1000 + x);
+        }
+    }
+}
+
 TEST(Buffer2DTests, MakeTransformed)
 {
     Buffer2D<int, struct IntegralTag> sourceBuffer(8, 6);
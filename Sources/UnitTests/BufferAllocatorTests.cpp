@@ -0,0 +1,119 @@
+#include <Core/BufferAllocator.h>
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+TEST(BufferAllocatorTests, Allocate)
+{
+    BufferAllocator<float> allocator(16);
+
+    auto buffer = allocator.Allocate();
+
+    EXPECT_EQ(16u, buffer->GetSize());
+}
+
+TEST(BufferAllocatorTests, ReusesReleasedBuffers)
+{
+    BufferAllocator<float> allocator(16);
+
+    Buffer<float> * buffer1Ptr;
+    {
+        auto buffer1 = allocator.Allocate();
+        buffer1Ptr = &(*buffer1);
+    }
+
+    auto buffer2 = allocator.Allocate();
+    EXPECT_EQ(buffer1Ptr, &(*buffer2));
+}
+
+TEST(BufferAllocatorTests, ConcurrentBuffersAreDistinct)
+{
+    BufferAllocator<float> allocator(16);
+
+    auto buffer1 = allocator.Allocate();
+    auto buffer2 = allocator.Allocate();
+
+    EXPECT_NE(&(*buffer1), &(*buffer2));
+}
+
+TEST(BufferAllocatorTests, MovedHandleReleasesOnce)
+{
+    BufferAllocator<float> allocator(16);
+
+    Buffer<float> * buffer1Ptr;
+    {
+        auto buffer1 = allocator.Allocate();
+        buffer1Ptr = &(*buffer1);
+
+        auto buffer2 = std::move(buffer1);
+        EXPECT_EQ(buffer1Ptr, &(*buffer2));
+    }
+
+    // Only one buffer in the pool
+    auto buffer3 = allocator.Allocate();
+    auto buffer4 = allocator.Allocate();
+    EXPECT_EQ(buffer1Ptr, &(*buffer3));
+    EXPECT_NE(buffer1Ptr, &(*buffer4));
+}
+
+TEST(BufferAllocatorTests, MoreReleasesThanSlots)
+{
+    BufferAllocator<float> allocator(16);
+
+    std::vector<PooledBuffer<float>> buffers;
+    for (int i = 0; i < 100; ++i)
+    {
+        buffers.emplace_back(allocator.Allocate());
+    }
+
+    buffers.clear();
+
+    auto buffer = allocator.Allocate();
+    EXPECT_EQ(16u, buffer->GetSize());
+}
+
+TEST(BufferAllocatorTests, ConcurrentAllocations)
+{
+    BufferAllocator<int> allocator(64);
+
+    std::vector<std::thread> threads;
+    std::vector<int> results(8, 0);
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&allocator, &results, t]()
+            {
+                bool isOk = true;
+                for (int i = 0; i < 2000; ++i)
+                {
+                    auto buffer = allocator.Allocate();
+                    buffer->fill(t);
+
+                    auto otherBuffer = allocator.Allocate();
+                    otherBuffer->fill(-1);
+
+                    for (size_t e = 0; e < buffer->GetSize(); ++e)
+                    {
+                        if ((*buffer)[e] != t)
+                        {
+                            isOk = false;
+                        }
+                    }
+                }
+
+                results[t] = isOk ? 1 : 0;
+            });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < 8; ++t)
+    {
+        EXPECT_EQ(1, results[t]);
+    }
+}
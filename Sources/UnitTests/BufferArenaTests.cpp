@@ -0,0 +1,96 @@
+#include <Core/Buffer.h>
+#include <Core/BufferArena.h>
+
+#include <Core/Vectors.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <utility>
+
+TEST(BufferArenaTests, Allocate_IsCacheLineAligned)
+{
+    BufferArena arena(true);
+
+    for (size_t byteSize : { 1, 7, 64, 65, 1000 })
+    {
+        void * const ptr = arena.Allocate(byteSize);
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % BufferArena::CacheLineByteSize);
+    }
+}
+
+TEST(BufferArenaTests, Allocate_PadsToCacheLine)
+{
+    BufferArena arena(true);
+
+    auto * const ptr1 = reinterpret_cast<std::uint8_t *>(arena.Allocate(10));
+    auto * const ptr2 = reinterpret_cast<std::uint8_t *>(arena.Allocate(100));
+    auto * const ptr3 = reinterpret_cast<std::uint8_t *>(arena.Allocate(64));
+
+    EXPECT_EQ(ptr1 + 64, ptr2);
+    EXPECT_EQ(ptr2 + 128, ptr3);
+
+    EXPECT_EQ(64u + 128u + 64u, arena.GetAllocatedByteSize());
+    EXPECT_EQ(1u, arena.GetChunkCount());
+}
+
+TEST(BufferArenaTests, Allocate_GrowsWithNewChunks)
+{
+    BufferArena arena(true);
+
+    void * const ptr1 = arena.Allocate(1024);
+    void * const ptr2 = arena.Allocate(8 * 1024 * 1024);
+
+    EXPECT_EQ(2u, arena.GetChunkCount());
+
+    // Memory of earlier chunks stays valid
+    reinterpret_cast<std::uint8_t *>(ptr1)[1023] = 42;
+    reinterpret_cast<std::uint8_t *>(ptr2)[8 * 1024 * 1024 - 1] = 42;
+    EXPECT_EQ(42, reinterpret_cast<std::uint8_t *>(ptr1)[1023]);
+}
+
+TEST(BufferArenaTests, Move)
+{
+    BufferArena arena1(true);
+
+    auto * const ptr = reinterpret_cast<int *>(arena1.Allocate(sizeof(int)));
+    *ptr = 42;
+
+    BufferArena arena2(std::move(arena1));
+
+    EXPECT_TRUE(arena2.IsEnabled());
+    EXPECT_EQ(1u, arena2.GetChunkCount());
+    EXPECT_EQ(0u, arena1.GetChunkCount());
+    EXPECT_EQ(42, *ptr);
+}
+
+TEST(BufferArenaTests, Buffer_FromEnabledArena)
+{
+    BufferArena arena(true);
+
+    Buffer<float> buf1(arena, 16, 0, 3.0f);
+    Buffer<vec2f> buf2(arena, 16, vec2f(1.0f, 2.0f));
+
+    EXPECT_EQ(16u * sizeof(float) + 16u * sizeof(vec2f), arena.GetAllocatedByteSize());
+
+    EXPECT_EQ(16u, buf1.GetSize());
+    EXPECT_EQ(3.0f, buf1[15]);
+    EXPECT_EQ(vec2f(1.0f, 2.0f), buf2[15]);
+
+    // Moving keeps the arena's memory
+    Buffer<float> buf3(std::move(buf1));
+    EXPECT_EQ(3.0f, buf3[15]);
+}
+
+TEST(BufferArenaTests, Buffer_FromDisabledArena)
+{
+    BufferArena arena(false);
+
+    Buffer<float> buf(arena, 16, 0, 3.0f);
+
+    EXPECT_EQ(0u, arena.GetAllocatedByteSize());
+    EXPECT_EQ(0u, arena.GetChunkCount());
+
+    EXPECT_TRUE(is_aligned_to_vectorization_word(buf.data()));
+    EXPECT_EQ(3.0f, buf[15]);
+}
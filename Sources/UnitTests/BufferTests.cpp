@@ -18,6 +18,52 @@ TEST(BufferTests, Buffer_EmplaceBack)
     EXPECT_EQ(24, buf[0]);
 }
 
+TEST(BufferTests, Buffer_EmplaceBackN)
+{
+    Buffer<int> buf(64);
+
+    buf.emplace_back(24);
+    buf.emplace_back_n(3, 13);
+
+    EXPECT_EQ(4u, buf.GetCurrentPopulatedSize());
+
+    EXPECT_EQ(24, buf[0]);
+    EXPECT_EQ(13, buf[1]);
+    EXPECT_EQ(13, buf[2]);
+    EXPECT_EQ(13, buf[3]);
+}
+
+TEST(BufferTests, Buffer_EmplaceBackRange)
+{
+    Buffer<vec2f> buf(64);
+
+    buf.emplace_back(1.0f, 2.0f);
+    buf.emplace_back_range(
+        3,
+        [](size_t i)
+        {
+            return vec2f(static_cast<float>(i), 10.0f);
+        });
+
+    EXPECT_EQ(4u, buf.GetCurrentPopulatedSize());
+
+    EXPECT_EQ(vec2f(1.0f, 2.0f), buf[0]);
+    EXPECT_EQ(vec2f(0.0f, 10.0f), buf[1]);
+    EXPECT_EQ(vec2f(1.0f, 10.0f), buf[2]);
+    EXPECT_EQ(vec2f(2.0f, 10.0f), buf[3]);
+}
+
+TEST(BufferTests, Buffer_EmplaceBackRange_Overflow)
+{
+    Buffer<int> buf(4);
+
+    buf.emplace_back(24);
+
+    EXPECT_THROW(
+        buf.emplace_back_range(4, [](size_t i) { return static_cast<int>(i); }),
+        std::runtime_error);
+}
+
 TEST(BufferTests, Buffer_Clear)
 {
     Buffer<int> buf(64);
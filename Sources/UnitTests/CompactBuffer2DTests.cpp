@@ -0,0 +1,58 @@
+#include <Core/CompactBuffer2D.h>
+
+#include "gtest/gtest.h"
+
+TEST(CompactBuffer2DTests, Uniform_IsEncodedInRuns)
+{
+    Buffer2D<int, struct IntegralTag> buffer(100, 200, 242);
+
+    CompactBuffer2D<int, struct IntegralTag> compactBuffer(buffer);
+
+    EXPECT_EQ(compactBuffer.GetSize(), IntegralRectSize(100, 200));
+    EXPECT_LT(compactBuffer.GetByteSize(), buffer.GetByteSize() / 100);
+
+    auto const restoredBuffer = compactBuffer.MakeBuffer();
+
+    EXPECT_EQ(restoredBuffer.Size, buffer.Size);
+    EXPECT_EQ(restoredBuffer, buffer);
+}
+
+TEST(CompactBuffer2DTests, Mixed_RoundTrips)
+{
+    Buffer2D<int, struct IntegralTag> buffer(64, 64, 0);
+    for (int y = 10; y < 20; ++y)
+    {
+        for (int x = 5; x < 50; ++x)
+        {
+            buffer[IntegralCoordinates(x, y)] = 7;
+        }
+    }
+
+    buffer[IntegralCoordinates(0, 0)] = 1;
+    buffer[IntegralCoordinates(63, 63)] = 2;
+
+    CompactBuffer2D<int, struct IntegralTag> compactBuffer(buffer);
+
+    EXPECT_LT(compactBuffer.GetByteSize(), buffer.GetByteSize());
+
+    auto const restoredBuffer = compactBuffer.MakeBuffer();
+
+    EXPECT_EQ(restoredBuffer, buffer);
+}
+
+TEST(CompactBuffer2DTests, Noisy_IsKeptVerbatim)
+{
+    Buffer2D<int, struct IntegralTag> buffer(32, 32, 0);
+    for (int i = 0; i < 32 * 32; ++i)
+    {
+        buffer.Data[i] = i;
+    }
+
+    CompactBuffer2D<int, struct IntegralTag> compactBuffer(buffer);
+
+    EXPECT_EQ(compactBuffer.GetByteSize(), buffer.GetByteSize());
+
+    auto const restoredBuffer = compactBuffer.MakeBuffer();
+
+    EXPECT_EQ(restoredBuffer, buffer);
+}
@@ -325,4 +325,72 @@ TEST(DeSerializationBufferTests, Append_Bytes)
     EXPECT_EQ(b.GetData()[5], 13);
     EXPECT_EQ(b.GetData()[6], 18);
     EXPECT_EQ(b.GetData()[7], 19);
-}
\ No newline at end of file
+}
+
+TEST(DeSerializationBufferTests, Borrow)
+{
+    DeSerializationBuffer<BigEndianess> b(16);
+
+    b.Append<std::uint16_t>(0x0412);
+
+    unsigned char const borrowedData[] = { 0x12, 0x34, 0x56, 0x78 };
+    b.Reset();
+    b.Borrow(borrowedData, sizeof(borrowedData));
+
+    EXPECT_EQ(b.GetSize(), 4u);
+    EXPECT_EQ(b.GetData(), borrowedData);
+
+    std::uint32_t val;
+    size_t const sz = b.ReadAt<std::uint32_t>(0, val);
+    EXPECT_EQ(sz, sizeof(std::uint32_t));
+    EXPECT_EQ(val, 0x12345678u);
+
+    // Back to own data
+
+    b.Reset();
+    b.Append<std::uint16_t>(0xff01);
+
+    std::uint16_t val2;
+    b.ReadAt<std::uint16_t>(0, val2);
+    EXPECT_EQ(val2, 0xff01);
+    EXPECT_NE(b.GetData(), borrowedData);
+}
+
+TEST(DeSerializationBufferTests, GrowsAcrossManyAppends)
+{
+    DeSerializationBuffer<BigEndianess> b(4);
+
+    for (std::uint32_t i = 0; i < 100000; ++i)
+    {
+        b.Append<std::uint32_t>(i);
+    }
+
+    ASSERT_EQ(b.GetSize(), 100000u * sizeof(std::uint32_t));
+
+    for (std::uint32_t i = 0; i < 100000; i += 997)
+    {
+        std::uint32_t val;
+        b.ReadAt<std::uint32_t>(i * sizeof(std::uint32_t), val);
+        EXPECT_EQ(val, i);
+    }
+}
+
+TEST(DeSerializationBufferTests, WriteStream)
+{
+    DeSerializationBuffer<BigEndianess> b(4);
+
+    b.Append<std::uint16_t>(0x0412);
+
+    DeSerializationBufferWriteStream<BigEndianess> stream(b);
+
+    std::uint8_t const testData[] = { 2, 3, 8, 9, 12, 13 };
+    stream.Write(testData, sizeof(testData));
+
+    ASSERT_EQ(b.GetSize(), 2u + sizeof(testData));
+
+    std::uint16_t val;
+    b.ReadAt<std::uint16_t>(0, val);
+    EXPECT_EQ(val, 0x0412);
+
+    EXPECT_EQ(std::memcmp(b.GetData() + 2, testData, sizeof(testData)), 0);
+}
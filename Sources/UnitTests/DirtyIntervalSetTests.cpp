@@ -0,0 +1,96 @@
+#include <Core/DirtyIntervalSet.h>
+
+#include "gtest/gtest.h"
+
+using Interval = DirtyIntervalSet::Interval;
+
+TEST(DirtyIntervalSetTests, Empty)
+{
+    DirtyIntervalSet set(0, 4);
+
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_TRUE(set.Coalesce().empty());
+}
+
+TEST(DirtyIntervalSetTests, SequentialElements_ExtendLastInterval)
+{
+    DirtyIntervalSet set(0, 4);
+
+    set.Add(3);
+    set.Add(4);
+    set.Add(5);
+    set.Add(5);
+
+    EXPECT_FALSE(set.IsEmpty());
+    EXPECT_EQ(set.Coalesce(), std::vector<Interval>({ Interval(3, 6) }));
+}
+
+TEST(DirtyIntervalSetTests, Coalesce_SortsAndMergesOverlapping)
+{
+    DirtyIntervalSet set(0, 4);
+
+    set.Add(20, 30);
+    set.Add(2, 5);
+    set.Add(25, 35);
+    set.Add(4, 8);
+
+    EXPECT_EQ(set.Coalesce(), std::vector<Interval>({ Interval(2, 8), Interval(20, 35) }));
+}
+
+TEST(DirtyIntervalSetTests, Coalesce_MergesWithinDistance)
+{
+    DirtyIntervalSet set(3, 4);
+
+    set.Add(0, 2);
+    set.Add(5, 6); // Gap of 3
+    set.Add(10, 11); // Gap of 4
+
+    EXPECT_EQ(set.Coalesce(), std::vector<Interval>({ Interval(0, 6), Interval(10, 11) }));
+}
+
+TEST(DirtyIntervalSetTests, Coalesce_MergesIntoOneWhenTooMany)
+{
+    DirtyIntervalSet set(0, 2);
+
+    set.Add(0);
+    set.Add(10);
+    set.Add(20);
+
+    EXPECT_EQ(set.Coalesce(), std::vector<Interval>({ Interval(0, 21) }));
+}
+
+TEST(DirtyIntervalSetTests, ManyOutOfOrderElements_StayCovered)
+{
+    DirtyIntervalSet set(0, 4);
+
+    for (ElementIndex i = 100; i > 0; i -= 2)
+    {
+        set.Add(i);
+    }
+
+    auto const & intervals = set.Coalesce();
+    ASSERT_LE(intervals.size(), size_t(4));
+    for (ElementIndex i = 100; i > 0; i -= 2)
+    {
+        EXPECT_TRUE(std::any_of(
+            intervals.cbegin(),
+            intervals.cend(),
+            [i](Interval const & interval)
+            {
+                return i >= interval.Start && i < interval.End;
+            }));
+    }
+}
+
+TEST(DirtyIntervalSetTests, Clear)
+{
+    DirtyIntervalSet set(0, 4);
+
+    set.Add(7);
+    set.Clear();
+
+    EXPECT_TRUE(set.IsEmpty());
+
+    set.Add(9);
+    EXPECT_EQ(set.Coalesce(), std::vector<Interval>({ Interval(9, 10) }));
+}
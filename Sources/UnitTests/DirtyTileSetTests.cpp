@@ -0,0 +1,82 @@
+#include <ShipBuilderLib/DirtyTileSet.h>
+
+#include "gtest/gtest.h"
+
+namespace ShipBuilder {
+
+TEST(DirtyTileSetTests, Empty)
+{
+    DirtyTileSet<struct ShipSpaceTag> dirtyTileSet(4);
+
+    EXPECT_TRUE(dirtyTileSet.IsEmpty());
+    EXPECT_TRUE(dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(100, 100))).empty());
+}
+
+TEST(DirtyTileSetTests, ScatteredRects_AreReportedAsTileRuns)
+{
+    DirtyTileSet<struct ShipSpaceTag> dirtyTileSet(4);
+
+    // Two tiles on the first tile row, one tile at the opposite corner
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(1, 1), ShipSpaceSize(5, 2)));
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(30, 30), ShipSpaceSize(1, 1)));
+
+    EXPECT_FALSE(dirtyTileSet.IsEmpty());
+    ASSERT_TRUE(dirtyTileSet.GetBoundingRect().has_value());
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(1, 1), ShipSpaceSize(30, 30)), *dirtyTileSet.GetBoundingRect());
+
+    auto const dirtyRects = dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(32, 32)));
+
+    ASSERT_EQ(2u, dirtyRects.size());
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(8, 4)), dirtyRects[0]);
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(28, 28), ShipSpaceSize(4, 4)), dirtyRects[1]);
+}
+
+TEST(DirtyTileSetTests, DirtyRects_AreClippedToBounds)
+{
+    DirtyTileSet<struct ShipSpaceTag> dirtyTileSet(4);
+
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(1, 1)));
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(20, 9), ShipSpaceSize(1, 1)));
+
+    auto const dirtyRects = dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(22, 10)));
+
+    ASSERT_EQ(2u, dirtyRects.size());
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(4, 4)), dirtyRects[0]);
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(20, 8), ShipSpaceSize(2, 2)), dirtyRects[1]);
+}
+
+TEST(DirtyTileSetTests, MostlyDirty_IsReportedAsBoundingRect)
+{
+    DirtyTileSet<struct ShipSpaceTag> dirtyTileSet(4);
+
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(8, 8)));
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(9, 0), ShipSpaceSize(2, 9)));
+
+    auto const dirtyRects = dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(100, 100)));
+
+    ASSERT_EQ(1u, dirtyRects.size());
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(11, 9)), dirtyRects[0]);
+}
+
+TEST(DirtyTileSetTests, Clear)
+{
+    DirtyTileSet<struct ShipSpaceTag> dirtyTileSet(4);
+
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(3, 3), ShipSpaceSize(10, 1)));
+    dirtyTileSet.Clear();
+
+    EXPECT_TRUE(dirtyTileSet.IsEmpty());
+    EXPECT_TRUE(dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(100, 100))).empty());
+
+    // Grows after clear
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(60, 0), ShipSpaceSize(1, 1)));
+    dirtyTileSet.Add(ShipSpaceRect(ShipSpaceCoordinates(0, 60), ShipSpaceSize(1, 1)));
+
+    auto const dirtyRects = dirtyTileSet.GetDirtyRects(ShipSpaceRect(ShipSpaceSize(100, 100)));
+
+    ASSERT_EQ(2u, dirtyRects.size());
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(60, 0), ShipSpaceSize(4, 4)), dirtyRects[0]);
+    EXPECT_EQ(ShipSpaceRect(ShipSpaceCoordinates(0, 60), ShipSpaceSize(4, 4)), dirtyRects[1]);
+}
+
+}
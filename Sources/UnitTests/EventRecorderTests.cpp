@@ -0,0 +1,84 @@
+#include <Simulation/EventRecorder.h>
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+
+TEST(EventRecorderTests, RecordsInMemory)
+{
+    std::vector<uint32_t> callbackIndices;
+
+    EventRecorder recorder(
+        [&](uint32_t eventIndex, RecordedEvent const &)
+        {
+            callbackIndices.push_back(eventIndex);
+        });
+
+    recorder.RecordEvent(RecordedEvent::MakePointDetachForDestroy(5, vec2f(1.0f, 2.0f), 3.0f));
+    recorder.RecordEvent(RecordedEvent::MakeTriangleDestroy(7));
+
+    RecordedEvents const events = recorder.StopRecording();
+
+    ASSERT_EQ(2u, events.GetSize());
+
+    EXPECT_EQ(RecordedEvent::RecordedEventType::PointDetachForDestroy, events.GetEvent(0).GetType());
+    EXPECT_EQ(5u, events.GetEvent(0).GetPointIndex());
+    EXPECT_EQ(vec2f(1.0f, 2.0f), events.GetEvent(0).GetDetachVelocity());
+    EXPECT_EQ(3.0f, events.GetEvent(0).GetSimulationTime());
+    EXPECT_EQ("PointDetachOnDestroy:5", events.GetEvent(0).ToString());
+
+    EXPECT_EQ(RecordedEvent::RecordedEventType::TriangleDestroy, events.GetEvent(1).GetType());
+    EXPECT_EQ(7u, events.GetEvent(1).GetPointIndex());
+    EXPECT_EQ("TriangleDestroy:7", events.GetEvent(1).ToString());
+
+    ASSERT_EQ(2u, callbackIndices.size());
+    EXPECT_EQ(0u, callbackIndices[0]);
+    EXPECT_EQ(1u, callbackIndices[1]);
+}
+
+TEST(EventRecorderTests, RecordsInMemory_ManyChunks)
+{
+    EventRecorder recorder(nullptr);
+
+    for (ElementIndex i = 0; i < 10000; ++i)
+    {
+        recorder.RecordEvent(RecordedEvent::MakeTriangleDestroy(i));
+    }
+
+    RecordedEvents const events = recorder.StopRecording();
+
+    ASSERT_EQ(10000u, events.GetSize());
+    for (ElementIndex i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(i, events.GetEvent(i).GetPointIndex());
+    }
+}
+
+TEST(EventRecorderTests, StreamsToFile)
+{
+    std::filesystem::path const filePath = std::filesystem::temp_directory_path() / "FloatingSandbox_EventRecorderTests.bin";
+
+    {
+        EventRecorder recorder(nullptr, filePath);
+
+        for (ElementIndex i = 0; i < 10000; ++i)
+        {
+            recorder.RecordEvent(RecordedEvent::MakePointDetachForDestroy(i, vec2f(static_cast<float>(i), 0.0f), 1.0f));
+        }
+
+        RecordedEvents const events = recorder.StopRecording();
+
+        ASSERT_EQ(10000u, events.GetSize());
+        for (ElementIndex i = 0; i < 10000; ++i)
+        {
+            EXPECT_EQ(i, events.GetEvent(i).GetPointIndex());
+            EXPECT_EQ(static_cast<float>(i), events.GetEvent(i).GetDetachVelocity().x);
+        }
+    }
+
+    // And may be loaded again
+    RecordedEvents const reloadedEvents = RecordedEvents::Load(filePath);
+    EXPECT_EQ(10000u, reloadedEvents.GetSize());
+
+    std::filesystem::remove(filePath);
+}
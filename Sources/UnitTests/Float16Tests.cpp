@@ -0,0 +1,70 @@
+#include <Core/Float16.h>
+
+#include <cmath>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+TEST(Float16Tests, ExactValues)
+{
+    EXPECT_EQ(Float16(0.0f).GetBits(), 0x0000u);
+    EXPECT_EQ(Float16(-0.0f).GetBits(), 0x8000u);
+    EXPECT_EQ(Float16(1.0f).GetBits(), 0x3c00u);
+    EXPECT_EQ(Float16(-2.0f).GetBits(), 0xc000u);
+    EXPECT_EQ(Float16(0.5f).GetBits(), 0x3800u);
+    EXPECT_EQ(Float16(65504.0f).GetBits(), 0x7bffu);
+
+    EXPECT_EQ(Float16(0.0f).ToFloat(), 0.0f);
+    EXPECT_EQ(Float16(1.0f).ToFloat(), 1.0f);
+    EXPECT_EQ(Float16(-2.0f).ToFloat(), -2.0f);
+    EXPECT_EQ(Float16(0.25f).ToFloat(), 0.25f);
+    EXPECT_EQ(Float16(1024.0f).ToFloat(), 1024.0f);
+    EXPECT_EQ(Float16(65504.0f).ToFloat(), 65504.0f);
+}
+
+TEST(Float16Tests, RoundsToNearestEven)
+{
+    // 1 + 2^-11 is halfway between 1 and 1 + 2^-10: to even, i.e. 1
+    EXPECT_EQ(Float16(1.0f + std::ldexp(1.0f, -11)).GetBits(), 0x3c00u);
+
+    // 1 + 3 * 2^-11 is halfway between 1 + 2^-10 and 1 + 2^-9: to even, i.e. 1 + 2^-9
+    EXPECT_EQ(Float16(1.0f + 3.0f * std::ldexp(1.0f, -11)).GetBits(), 0x3c02u);
+
+    // Just above halfway: up
+    EXPECT_EQ(Float16(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)).GetBits(), 0x3c01u);
+}
+
+TEST(Float16Tests, RoundTripPrecision)
+{
+    for (float f = -1000.0f; f <= 1000.0f; f += 0.37f)
+    {
+        float const roundTrip = Float16(f).ToFloat();
+        EXPECT_LE(std::abs(roundTrip - f), std::abs(f) * (1.0f / 2048.0f) + 1e-7f);
+    }
+}
+
+TEST(Float16Tests, Denormals)
+{
+    float const smallestDenormal = std::ldexp(1.0f, -24);
+
+    EXPECT_EQ(Float16(smallestDenormal).GetBits(), 0x0001u);
+    EXPECT_EQ(Float16(smallestDenormal).ToFloat(), smallestDenormal);
+
+    EXPECT_EQ(Float16(-3.0f * smallestDenormal).GetBits(), 0x8003u);
+    EXPECT_EQ(Float16(-3.0f * smallestDenormal).ToFloat(), -3.0f * smallestDenormal);
+
+    // Too small: to zero
+    EXPECT_EQ(Float16(smallestDenormal / 4.0f).GetBits(), 0x0000u);
+}
+
+TEST(Float16Tests, InfinitiesAndNaNs)
+{
+    EXPECT_EQ(Float16(std::numeric_limits<float>::infinity()).GetBits(), 0x7c00u);
+    EXPECT_EQ(Float16(-std::numeric_limits<float>::infinity()).GetBits(), 0xfc00u);
+
+    // Overflow
+    EXPECT_EQ(Float16(70000.0f).GetBits(), 0x7c00u);
+    EXPECT_EQ(Float16(70000.0f).ToFloat(), std::numeric_limits<float>::infinity());
+
+    EXPECT_TRUE(std::isnan(Float16(std::numeric_limits<float>::quiet_NaN()).ToFloat()));
+}
@@ -1,4 +1,5 @@
 #include <Core/FontSet.h>
+#include <Core/MemoryStreams.h>
 
 #include <Render/GameFontSets.h>
 
@@ -67,3 +68,54 @@ TEST(FontSetTests, Load)
 
 	EXPECT_EQ(fontSet.Atlas.Size, ExpectedAtlasSize);
 }
+
+TEST(FontSetTests, SerializeDeserialize)
+{
+	std::array<std::uint8_t, 256> glyphWidths;
+	std::array<vec2f, 256> glyphBottomLefts;
+	std::array<vec2f, 256> glyphTopRights;
+	for (int i = 0; i < 256; ++i)
+	{
+		glyphWidths[i] = static_cast<std::uint8_t>(i);
+		glyphBottomLefts[i] = vec2f(static_cast<float>(i) / 256.0f, 0.25f);
+		glyphTopRights[i] = vec2f(static_cast<float>(i + 1) / 256.0f, 0.5f);
+	}
+
+	std::vector<FontMetadata> metadata;
+	metadata.emplace_back(ImageSize(8, 10), glyphWidths, glyphBottomLefts, glyphTopRights);
+	metadata.emplace_back(ImageSize(16, 20), glyphWidths, glyphTopRights, glyphBottomLefts);
+	metadata.emplace_back(ImageSize(32, 40), glyphWidths, glyphBottomLefts, glyphBottomLefts);
+
+	RgbaImageData atlas(ImageSize(4, 2));
+	for (size_t i = 0; i < atlas.Size.GetLinearSize(); ++i)
+	{
+		atlas.Data[i] = rgbaColor(static_cast<std::uint8_t>(i), 2, 3, 4);
+	}
+
+	FontSet<GameFontSets::FontSet> const fontSet(std::move(metadata), std::move(atlas));
+
+	MemoryBinaryWriteStream outputStream;
+	fontSet.Serialize(outputStream);
+
+	auto inputStream = outputStream.MakeReadStreamCopy();
+	auto const fontSet2 = FontSet<GameFontSets::FontSet>::TryDeserialize(inputStream);
+
+	ASSERT_TRUE(fontSet2.has_value());
+
+	ASSERT_EQ(fontSet2->Metadata.size(), 3);
+	EXPECT_EQ(fontSet2->Metadata[1].CellSize, ImageSize(16, 20));
+	EXPECT_EQ(fontSet2->Metadata[1].GlyphWidths, glyphWidths);
+	EXPECT_EQ(fontSet2->Metadata[1].GlyphTextureAtlasBottomLefts, glyphTopRights);
+	EXPECT_EQ(fontSet2->Metadata[1].GlyphTextureAtlasTopRights, glyphBottomLefts);
+
+	EXPECT_EQ(fontSet2->Atlas.Size, ImageSize(4, 2));
+	EXPECT_EQ(fontSet2->Atlas.Data[5], rgbaColor(5, 2, 3, 4));
+}
+
+TEST(FontSetTests, Deserialize_RejectsTruncatedBlob)
+{
+	std::vector<std::uint8_t> blob(16, 0);
+	MemoryBinaryReadStream inputStream(std::move(blob));
+
+	EXPECT_FALSE(FontSet<GameFontSets::FontSet>::TryDeserialize(inputStream).has_value());
+}
@@ -0,0 +1,88 @@
+#include <Core/FrameArena.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+TEST(FrameArenaTests, Allocate_IsAligned)
+{
+    FrameArena arena(1024);
+
+    arena.Allocate(1, 1);
+    void * const ptr = arena.Allocate(8, 16);
+
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % 16);
+}
+
+TEST(FrameArenaTests, Allocate_IsContiguous)
+{
+    FrameArena arena(1024);
+
+    auto * const ptr1 = static_cast<std::byte *>(arena.Allocate(16, 8));
+    auto * const ptr2 = static_cast<std::byte *>(arena.Allocate(16, 8));
+
+    EXPECT_EQ(ptr1 + 16, ptr2);
+    EXPECT_EQ(32u, arena.GetAllocatedByteCount());
+}
+
+TEST(FrameArenaTests, Allocate_GrowsBeyondCapacity)
+{
+    FrameArena arena(64);
+
+    arena.Allocate(48, 8);
+    void * const ptr = arena.Allocate(1000, 8);
+
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_EQ(2u, arena.GetChunkCount());
+}
+
+TEST(FrameArenaTests, Reset_ReusesMemory)
+{
+    FrameArena arena(1024);
+
+    void * const ptr1 = arena.Allocate(100, 8);
+
+    arena.Reset();
+
+    EXPECT_EQ(0u, arena.GetAllocatedByteCount());
+
+    void * const ptr2 = arena.Allocate(100, 8);
+    EXPECT_EQ(ptr1, ptr2);
+}
+
+TEST(FrameArenaTests, Reset_CoalescesChunks)
+{
+    FrameArena arena(64);
+
+    arena.Allocate(48, 8);
+    arena.Allocate(1000, 8);
+    ASSERT_EQ(2u, arena.GetChunkCount());
+
+    arena.Reset();
+
+    EXPECT_EQ(1u, arena.GetChunkCount());
+
+    // Same load now fits in one chunk
+    arena.Allocate(48, 8);
+    arena.Allocate(1000, 8);
+    EXPECT_EQ(1u, arena.GetChunkCount());
+}
+
+TEST(FrameArenaTests, FrameVector)
+{
+    FrameArena arena(64);
+
+    frame_vector<int> v{ FrameArenaAllocator<int>(arena) };
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+
+    ASSERT_EQ(1000u, v.size());
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(i, v[i]);
+    }
+
+    EXPECT_GE(arena.GetAllocatedByteCount(), 1000u * sizeof(int));
+}
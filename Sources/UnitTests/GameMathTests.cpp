@@ -233,6 +233,18 @@ TEST(GameMathTests, MixPiecewiseLinear_Basic)
 	EXPECT_TRUE(ApproxEquals(MixPiecewiseLinear(0.3f, 10.0f, 20.0f, 0.1f, 100.0f, 100.0f), 20.0f, 0.05f));
 }
 
+TEST(GameMathTests, MortonCode_Basic)
+{
+    EXPECT_EQ(MortonCode(0, 0), 0u);
+    EXPECT_EQ(MortonCode(1, 0), 1u);
+    EXPECT_EQ(MortonCode(0, 1), 2u);
+    EXPECT_EQ(MortonCode(1, 1), 3u);
+    EXPECT_EQ(MortonCode(2, 0), 4u);
+    EXPECT_EQ(MortonCode(3, 5), 0b100111u);
+    EXPECT_EQ(MortonCode(0xffff, 0), 0x55555555u);
+    EXPECT_EQ(MortonCode(0, 0xffff), 0xaaaaaaaau);
+}
+
 TEST(GameMathTests, FastTruncate)
 {
     EXPECT_EQ(register_int(1), FastTruncateToArchInt(1.1f));
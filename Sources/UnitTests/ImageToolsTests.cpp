@@ -1,5 +1,7 @@
 #include <Core/ImageTools.h>
 
+#include <cstdlib>
+
 #include "gtest/gtest.h"
 
 TEST(ImageToolsTests, Resize_Smaller_Nearest_1)
@@ -258,3 +260,95 @@ TEST(ImageToolsTests, Resize_Idempotent_Bilinear)
         }
     }
 }
+
+namespace {
+
+    RgbaImageData MakeRandomRgbaImage(ImageSize const & size)
+    {
+        RgbaImageData image(size);
+
+        uint32_t state = 17;
+        for (size_t i = 0; i < size.GetLinearSize(); ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            image.Data[i] = rgbaColor(
+                static_cast<uint8_t>(state >> 24),
+                static_cast<uint8_t>(state >> 16),
+                static_cast<uint8_t>(state >> 8),
+                // Make sure we test the extremes of alpha
+                (i % 5) == 0 ? 0 : ((i % 5) == 1 ? 255 : static_cast<uint8_t>(state)));
+        }
+
+        return image;
+    }
+
+    // Fast-math may round vectorized and scalar code differently
+    ::testing::AssertionResult IsNear(rgbaColor const & actual, rgbaColor const & expected)
+    {
+        if (std::abs(actual.r - expected.r) <= 1
+            && std::abs(actual.g - expected.g) <= 1
+            && std::abs(actual.b - expected.b) <= 1
+            && std::abs(actual.a - expected.a) <= 1)
+        {
+            return ::testing::AssertionSuccess();
+        }
+
+        return ::testing::AssertionFailure() << actual.toString() << " is not near " << expected.toString();
+    }
+}
+
+TEST(ImageToolsTests, BlendWithColor_MatchesPerPixelMix)
+{
+    RgbaImageData image = MakeRandomRgbaImage(ImageSize(7, 5)); // Not a multiple of the vectorization width
+    RgbaImageData expected = image.Clone();
+
+    rgbColor const color(20, 200, 120);
+    float const alpha = 0.37f;
+
+    ImageTools::BlendWithColor(image, color, alpha);
+
+    for (size_t i = 0; i < image.Size.GetLinearSize(); ++i)
+    {
+        EXPECT_TRUE(IsNear(image.Data[i], expected.Data[i].mix(color, alpha)));
+    }
+}
+
+TEST(ImageToolsTests, AlphaPreMultiply_MatchesPerPixelAlphaMultiply)
+{
+    RgbaImageData image = MakeRandomRgbaImage(ImageSize(7, 5));
+    RgbaImageData expected = image.Clone();
+
+    ImageTools::AlphaPreMultiply(image);
+
+    for (size_t i = 0; i < image.Size.GetLinearSize(); ++i)
+    {
+        expected.Data[i].alpha_multiply();
+        EXPECT_TRUE(IsNear(image.Data[i], expected.Data[i]));
+    }
+}
+
+TEST(ImageToolsTests, Overlay_MatchesPerPixelBlend)
+{
+    RgbaImageData base = MakeRandomRgbaImage(ImageSize(13, 9));
+    RgbaImageData const overlay = MakeRandomRgbaImage(ImageSize(11, 4)); // Wider than tall
+    RgbaImageData expected = base.Clone();
+
+    int const x = 3;
+    int const y = 2;
+
+    ImageTools::Overlay(base, overlay, x, y);
+
+    for (int r = 0; r < base.Size.height; ++r)
+    {
+        for (int c = 0; c < base.Size.width; ++c)
+        {
+            rgbaColor expectedColor = expected[{c, r}];
+            if (r >= y && r < y + overlay.Size.height && c >= x && c < x + overlay.Size.width)
+            {
+                expectedColor = expectedColor.blend(overlay[{c - x, r - y}]);
+            }
+
+            EXPECT_TRUE(IsNear(base[{c, r}], expectedColor));
+        }
+    }
+}
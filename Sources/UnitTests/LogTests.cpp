@@ -0,0 +1,89 @@
+#include <Core/Log.h>
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LogTests, Log_IsPublishedAtFlush)
+{
+    Logger logger;
+
+    logger.Log("Foo ", 42, " ", 1.5f);
+
+    std::string const all = logger.GetAll();
+    EXPECT_NE(std::string::npos, all.find(":Foo 42 1.5\n"));
+}
+
+TEST(LogTests, Log_CapturesStringsAtLogTime)
+{
+    Logger logger;
+
+    char buffer[8];
+    std::strcpy(buffer, "Before");
+    logger.Log(buffer);
+    std::strcpy(buffer, "After");
+
+    std::string const all = logger.GetAll();
+    EXPECT_NE(std::string::npos, all.find(":Before\n"));
+    EXPECT_EQ(std::string::npos, all.find("After"));
+}
+
+TEST(LogTests, Listener_ReceivesAllMessagesInOrder)
+{
+    Logger logger;
+
+    logger.Log("Message ", 0);
+
+    std::vector<std::string> receivedMessages;
+    logger.RegisterListener(
+        [&receivedMessages](std::string const & message)
+        {
+            receivedMessages.push_back(message);
+        });
+
+    for (int i = 1; i < 100; ++i)
+    {
+        logger.Log("Message ", i);
+    }
+
+    logger.Flush();
+    logger.UnregisterListener();
+
+    ASSERT_EQ(100u, receivedMessages.size());
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_NE(std::string::npos, receivedMessages[i].find(":Message " + std::to_string(i) + "\n"));
+    }
+}
+
+TEST(LogTests, Log_FromMultipleThreads)
+{
+    Logger logger;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&logger, t]()
+            {
+                for (int i = 0; i < 100; ++i)
+                {
+                    logger.Log("T", t, "M", i);
+                }
+            });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    std::string const all = logger.GetAll();
+    for (int t = 0; t < 4; ++t)
+    {
+        EXPECT_NE(std::string::npos, all.find(":T" + std::to_string(t) + "M99\n"));
+    }
+}
@@ -0,0 +1,51 @@
+#include <Simulation/MaterialDatabase.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+TEST(MaterialDatabaseTests, FindStructuralMaterial)
+{
+    std::vector<std::unique_ptr<StructuralMaterial>> materials;
+    std::vector<StructuralMaterial const *> materialPtrs;
+    for (std::uint8_t i = 0; i < 200; ++i)
+    {
+        materials.emplace_back(new StructuralMaterial(MakeTestStructuralMaterial("Foo" + std::to_string(i), rgbColor(i, static_cast<std::uint8_t>(i * 3), static_cast<std::uint8_t>(255 - i)))));
+        materialPtrs.push_back(materials.back().get());
+    }
+
+    MaterialDatabase db = MaterialDatabase::Make(materialPtrs, {});
+
+    // Survives a move
+    MaterialDatabase movedDb = std::move(db);
+
+    for (std::uint8_t i = 0; i < 200; ++i)
+    {
+        StructuralMaterial const * material = movedDb.FindStructuralMaterial(rgbColor(i, static_cast<std::uint8_t>(i * 3), static_cast<std::uint8_t>(255 - i)));
+        ASSERT_NE(nullptr, material);
+        EXPECT_EQ("Foo" + std::to_string(i), material->Name);
+    }
+
+    EXPECT_EQ(nullptr, movedDb.FindStructuralMaterial(rgbColor(0, 0, 0)));
+    EXPECT_EQ(nullptr, movedDb.FindStructuralMaterial(rgbColor(1, 3, 255)));
+}
+
+TEST(MaterialDatabaseTests, FindElectricalMaterial)
+{
+    ElectricalMaterial const material1 = MakeTestElectricalMaterial("Lamp", rgbColor(10, 20, 30));
+    ElectricalMaterial const material2 = MakeTestElectricalMaterial("Switch", rgbColor(10, 21, 0), true);
+
+    MaterialDatabase db = MaterialDatabase::Make({}, { &material1, &material2 });
+
+    ASSERT_NE(nullptr, db.FindElectricalMaterial(rgbColor(10, 20, 30)));
+    EXPECT_EQ("Lamp", db.FindElectricalMaterial(rgbColor(10, 20, 30))->Name);
+    ASSERT_NE(nullptr, db.FindElectricalMaterial(rgbColor(10, 21, 0)));
+    EXPECT_EQ("Switch", db.FindElectricalMaterial(rgbColor(10, 21, 0))->Name);
+    EXPECT_EQ(nullptr, db.FindElectricalMaterial(rgbColor(10, 21, 7)));
+    EXPECT_EQ(nullptr, db.FindElectricalMaterial(rgbColor(10, 20, 31)));
+
+    // Legacy: instanced materials match on r and g only
+    ASSERT_NE(nullptr, db.FindElectricalMaterialLegacy(rgbColor(10, 21, 7)));
+    EXPECT_EQ("Switch", db.FindElectricalMaterialLegacy(rgbColor(10, 21, 7))->Name);
+    EXPECT_EQ(nullptr, db.FindElectricalMaterialLegacy(rgbColor(10, 20, 31)));
+}
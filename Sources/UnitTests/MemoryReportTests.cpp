@@ -0,0 +1,78 @@
+#include <Core/MemoryReport.h>
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+TEST(MemoryReportTests, Empty)
+{
+    MemoryReport report;
+
+    EXPECT_EQ(0u, report.GetTotalByteSize());
+    EXPECT_TRUE(report.GetSubsystemByteSizes().empty());
+    EXPECT_TRUE(report.GetLargestEntries(5).empty());
+}
+
+TEST(MemoryReportTests, Add_Buffer)
+{
+    Buffer<float> buffer(16);
+
+    MemoryReport report;
+    report.Add("Points", "Mass", buffer);
+
+    ASSERT_EQ(1u, report.GetEntries().size());
+    EXPECT_EQ("Points", report.GetEntries()[0].Subsystem);
+    EXPECT_EQ("Mass", report.GetEntries()[0].Item);
+    EXPECT_EQ(16u * sizeof(float), report.GetEntries()[0].ByteSize);
+}
+
+TEST(MemoryReportTests, Add_Vector_AccountsForCapacity)
+{
+    std::vector<int> vector;
+    vector.reserve(10);
+    vector.push_back(1);
+
+    MemoryReport report;
+    report.Add("Ship", "Indices", vector);
+
+    ASSERT_EQ(1u, report.GetEntries().size());
+    EXPECT_EQ(vector.capacity() * sizeof(int), report.GetEntries()[0].ByteSize);
+}
+
+TEST(MemoryReportTests, GetSubsystemByteSizes_AggregatesAndSortsByDecreasingSize)
+{
+    MemoryReport report;
+    report.Add("Springs", "A", 10);
+    report.Add("Points", "A", 20);
+    report.Add("Springs", "B", 30);
+    report.Add("Triangles", "A", 5);
+
+    EXPECT_EQ(65u, report.GetTotalByteSize());
+
+    auto const subsystems = report.GetSubsystemByteSizes();
+    ASSERT_EQ(3u, subsystems.size());
+    EXPECT_EQ("Springs", subsystems[0].first);
+    EXPECT_EQ(40u, subsystems[0].second);
+    EXPECT_EQ("Points", subsystems[1].first);
+    EXPECT_EQ(20u, subsystems[1].second);
+    EXPECT_EQ("Triangles", subsystems[2].first);
+    EXPECT_EQ(5u, subsystems[2].second);
+}
+
+TEST(MemoryReportTests, GetLargestEntries)
+{
+    MemoryReport report;
+    report.Add("Springs", "A", 10);
+    report.Add("Points", "A", 20);
+    report.Add("Springs", "B", 30);
+    report.Add("Triangles", "A", 5);
+
+    auto const largest = report.GetLargestEntries(2);
+    ASSERT_EQ(2u, largest.size());
+    EXPECT_EQ("Springs", largest[0].Subsystem);
+    EXPECT_EQ("B", largest[0].Item);
+    EXPECT_EQ("Points", largest[1].Subsystem);
+    EXPECT_EQ("A", largest[1].Item);
+
+    EXPECT_EQ(4u, report.GetLargestEntries(10).size());
+}
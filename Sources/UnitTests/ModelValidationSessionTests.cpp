@@ -0,0 +1,92 @@
+#include <ShipBuilderLib/ModelValidationSession.h>
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+
+namespace ShipBuilder {
+
+namespace {
+
+ModelValidationResults WaitForResults(ModelValidationSession & session)
+{
+    while (true)
+    {
+        auto results = session.PollResults();
+        if (results.has_value())
+        {
+            return *results;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}
+
+TEST(ModelValidationSessionTests, EmptyStructuralLayer_IsError)
+{
+    Model model(ShipSpaceSize(20, 10), "Test");
+    ModelValidationCache cache;
+
+    ModelValidationSession session(model, cache, Finalizer([]() {}));
+
+    auto const results = WaitForResults(session);
+
+    EXPECT_TRUE(results.HasErrors());
+    ASSERT_EQ(results.GetIssues().size(), 1u);
+    EXPECT_EQ(results.GetIssues()[0].GetCheckClass(), ModelValidationIssue::CheckClassType::EmptyStructuralLayer);
+    EXPECT_EQ(results.GetIssues()[0].GetSeverity(), ModelValidationIssue::SeverityType::Error);
+}
+
+TEST(ModelValidationSessionTests, UnchangedLayers_AreNotRevalidated)
+{
+    Model model(ShipSpaceSize(20, 10), "Test");
+    ModelValidationCache cache;
+
+    {
+        ModelValidationSession session(model, cache, Finalizer([]() {}));
+        WaitForResults(session);
+    }
+
+    // Unchanged: all steps are complete right away
+    {
+        ModelValidationSession session(model, cache, Finalizer([]() {}));
+
+        EXPECT_EQ(session.GetNumberOfCompletedSteps(), session.GetNumberOfSteps());
+
+        auto const results = session.PollResults();
+        ASSERT_TRUE(results.has_value());
+        EXPECT_TRUE(results->HasErrors());
+    }
+
+    // Changed: steps are run again
+    model.SetIsDirty(LayerType::Structural);
+
+    {
+        ModelValidationSession session(model, cache, Finalizer([]() {}));
+
+        auto const results = WaitForResults(session);
+        EXPECT_TRUE(results.HasErrors());
+    }
+}
+
+TEST(ModelValidationSessionTests, FinalizerRunsAtEndOfSession)
+{
+    Model model(ShipSpaceSize(20, 10), "Test");
+    ModelValidationCache cache;
+
+    bool hasFinalized = false;
+
+    {
+        ModelValidationSession session(model, cache, Finalizer([&hasFinalized]() { hasFinalized = true; }));
+        WaitForResults(session);
+
+        EXPECT_FALSE(hasFinalized);
+    }
+
+    EXPECT_TRUE(hasFinalized);
+}
+
+}
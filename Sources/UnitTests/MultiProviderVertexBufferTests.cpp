@@ -2647,3 +2647,194 @@ TEST(MultiProviderVertexBufferTests, TwoProviders_FirstUpdates_SecondAppends)
     EXPECT_EQ(buffer.TestActions[0].Pointer[2].foo1, 40.0f);
     EXPECT_EQ(buffer.TestActions[0].Pointer[3].foo1, 50.0f);
 }
+
+/////////////////////////////
+
+TEST(MultiProviderVertexBufferTests, TwoProviders_Grows_ReallocsWithSlack)
+{
+    using TBuf = MultiProviderVertexBuffer<TestVertexAttributes, 2>;
+    TBuf buffer;
+
+    buffer.UpdateStart(0, 2);
+    buffer.UpdateVertex(0, 0, { 1.0f, 10.0f });
+    buffer.UpdateVertex(0, 1, { 2.0f, 20.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.UpdateStart(1, 3);
+    buffer.UpdateVertex(1, 0, { 3.0f, 30.0f });
+    buffer.UpdateVertex(1, 1, { 4.0f, 40.0f });
+    buffer.UpdateVertex(1, 2, { 5.0f, 50.0f });
+    buffer.UpdateEnd(1);
+
+    buffer.RenderUpload();
+
+    ASSERT_EQ(buffer.TestActions.size(), 1u);
+    EXPECT_EQ(buffer.TestActions[0].Action, TBuf::TestAction::ActionKind::AllocateAndUploadVBO);
+    EXPECT_EQ(buffer.TestActions[0].AllocatedSize, 5u * sizeof(TestVertexAttributes));
+
+    buffer.TestActions.clear();
+
+    buffer.UpdateStart(0, 3);
+    buffer.UpdateVertex(0, 2, { 6.0f, 60.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.RenderUpload();
+
+    EXPECT_EQ(buffer.GetTotalVertexCount(), 6u);
+    ASSERT_EQ(buffer.TestActions.size(), 1u);
+
+    EXPECT_EQ(buffer.TestActions[0].Action, TBuf::TestAction::ActionKind::AllocateAndUploadVBO);
+    EXPECT_EQ(buffer.TestActions[0].Offset, 0u * sizeof(TestVertexAttributes));
+    EXPECT_EQ(buffer.TestActions[0].Size, 6u * sizeof(TestVertexAttributes));
+    EXPECT_EQ(buffer.TestActions[0].AllocatedSize, 10u * sizeof(TestVertexAttributes));
+}
+
+TEST(MultiProviderVertexBufferTests, TwoProviders_GrowsWithinSlack_First_UploadsOnlyChangedPortion)
+{
+    using TBuf = MultiProviderVertexBuffer<TestVertexAttributes, 2>;
+    TBuf buffer;
+
+    buffer.UpdateStart(0, 2);
+    buffer.UpdateVertex(0, 0, { 1.0f, 10.0f });
+    buffer.UpdateVertex(0, 1, { 2.0f, 20.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.UpdateStart(1, 3);
+    buffer.UpdateVertex(1, 0, { 3.0f, 30.0f });
+    buffer.UpdateVertex(1, 1, { 4.0f, 40.0f });
+    buffer.UpdateVertex(1, 2, { 5.0f, 50.0f });
+    buffer.UpdateEnd(1);
+
+    buffer.RenderUpload();
+
+    // Grow beyond allocation, making room for growth
+
+    buffer.UpdateStart(0, 3);
+    buffer.UpdateVertex(0, 2, { 6.0f, 60.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.RenderUpload();
+
+    buffer.TestActions.clear();
+
+    // Grow within slack
+
+    buffer.UpdateStart(0, 4);
+    buffer.UpdateVertex(0, 3, { 7.0f, 70.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.RenderUpload();
+
+    EXPECT_EQ(buffer.GetTotalVertexCount(), 7u);
+    ASSERT_EQ(buffer.TestActions.size(), 1u);
+
+    EXPECT_EQ(buffer.TestActions[0].Action, TBuf::TestAction::ActionKind::UploadVBO);
+    EXPECT_EQ(buffer.TestActions[0].Offset, 3u * sizeof(TestVertexAttributes));
+    ASSERT_EQ(buffer.TestActions[0].Size, 4u * sizeof(TestVertexAttributes));
+
+    EXPECT_EQ(buffer.TestActions[0].Pointer[0].foo1, 7.0f);
+    EXPECT_EQ(buffer.TestActions[0].Pointer[1].foo1, 3.0f);
+    EXPECT_EQ(buffer.TestActions[0].Pointer[2].foo1, 4.0f);
+    EXPECT_EQ(buffer.TestActions[0].Pointer[3].foo1, 5.0f);
+}
+
+TEST(MultiProviderVertexBufferTests, TwoProviders_GrowsWithinSlack_Second_UploadsOnlyChangedPortion)
+{
+    using TBuf = MultiProviderVertexBuffer<TestVertexAttributes, 2>;
+    TBuf buffer;
+
+    buffer.UpdateStart(0, 2);
+    buffer.UpdateVertex(0, 0, { 1.0f, 10.0f });
+    buffer.UpdateVertex(0, 1, { 2.0f, 20.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.UpdateStart(1, 3);
+    buffer.UpdateVertex(1, 0, { 3.0f, 30.0f });
+    buffer.UpdateVertex(1, 1, { 4.0f, 40.0f });
+    buffer.UpdateVertex(1, 2, { 5.0f, 50.0f });
+    buffer.UpdateEnd(1);
+
+    buffer.RenderUpload();
+
+    // Grow beyond allocation, making room for growth
+
+    buffer.AppendStart(1, 4);
+    buffer.AppendVertex(1, { 3.0f, 30.0f });
+    buffer.AppendVertex(1, { 4.0f, 40.0f });
+    buffer.AppendVertex(1, { 5.0f, 50.0f });
+    buffer.AppendVertex(1, { 6.0f, 60.0f });
+    buffer.AppendEnd(1);
+
+    buffer.RenderUpload();
+
+    buffer.TestActions.clear();
+
+    // Grow within slack, one vertex at a time
+
+    for (size_t v = 4; v < 8; ++v)
+    {
+        buffer.UpdateStart(1, v + 1);
+        buffer.UpdateVertex(1, v, { static_cast<float>(v + 3), 0.0f });
+        buffer.UpdateEnd(1);
+
+        buffer.RenderUpload();
+    }
+
+    EXPECT_EQ(buffer.GetTotalVertexCount(), 10u);
+    ASSERT_EQ(buffer.TestActions.size(), 4u);
+
+    for (size_t a = 0; a < 4; ++a)
+    {
+        EXPECT_EQ(buffer.TestActions[a].Action, TBuf::TestAction::ActionKind::UploadVBO);
+        EXPECT_EQ(buffer.TestActions[a].Offset, (6u + a) * sizeof(TestVertexAttributes));
+        ASSERT_EQ(buffer.TestActions[a].Size, 1u * sizeof(TestVertexAttributes));
+        EXPECT_EQ(buffer.TestActions[a].Pointer[0].foo1, static_cast<float>(a + 7));
+    }
+}
+
+TEST(MultiProviderVertexBufferTests, TwoProviders_Shrinks_DoesNotRealloc)
+{
+    using TBuf = MultiProviderVertexBuffer<TestVertexAttributes, 2>;
+    TBuf buffer;
+
+    buffer.UpdateStart(0, 2);
+    buffer.UpdateVertex(0, 0, { 1.0f, 10.0f });
+    buffer.UpdateVertex(0, 1, { 2.0f, 20.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.UpdateStart(1, 3);
+    buffer.UpdateVertex(1, 0, { 3.0f, 30.0f });
+    buffer.UpdateVertex(1, 1, { 4.0f, 40.0f });
+    buffer.UpdateVertex(1, 2, { 5.0f, 50.0f });
+    buffer.UpdateEnd(1);
+
+    buffer.RenderUpload();
+
+    buffer.TestActions.clear();
+
+    buffer.UpdateStart(0, 1);
+    buffer.UpdateEnd(0);
+
+    buffer.RenderUpload();
+
+    // Back to original size
+
+    buffer.UpdateStart(0, 2);
+    buffer.UpdateVertex(0, 1, { 20.0f, 200.0f });
+    buffer.UpdateEnd(0);
+
+    buffer.RenderUpload();
+
+    EXPECT_EQ(buffer.GetTotalVertexCount(), 5u);
+    ASSERT_EQ(buffer.TestActions.size(), 2u);
+
+    EXPECT_EQ(buffer.TestActions[0].Action, TBuf::TestAction::ActionKind::UploadVBO);
+    EXPECT_EQ(buffer.TestActions[0].Offset, 1u * sizeof(TestVertexAttributes));
+    ASSERT_EQ(buffer.TestActions[0].Size, 3u * sizeof(TestVertexAttributes));
+
+    EXPECT_EQ(buffer.TestActions[1].Action, TBuf::TestAction::ActionKind::UploadVBO);
+    EXPECT_EQ(buffer.TestActions[1].Offset, 1u * sizeof(TestVertexAttributes));
+    ASSERT_EQ(buffer.TestActions[1].Size, 4u * sizeof(TestVertexAttributes));
+    EXPECT_EQ(buffer.TestActions[1].Pointer[0].foo1, 20.0f);
+    EXPECT_EQ(buffer.TestActions[1].Pointer[1].foo1, 3.0f);
+}
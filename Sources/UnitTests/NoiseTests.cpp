@@ -0,0 +1,56 @@
+#include <Core/Noise.h>
+
+#include <Core/GameRandomEngine.h>
+#include <Core/ThreadPool.h>
+
+#include <cmath>
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+TEST(NoiseTests, Perlin_IsRepeatable)
+{
+    GameRandomEngine::GetInstance().Reseed(GameRandomEngine::DefaultSeed);
+
+    auto const noise = Noise::CreateRepeatableFractal2DPerlinNoise(IntegralRectSize(64, 32), 2, 16, 0.5f);
+
+    // Opposite edges of the cells grid see the same grid vectors, hence the noise wraps around
+    for (int x = 0; x < 64; ++x)
+    {
+        EXPECT_NEAR((noise[{x, 0}]), (noise[{x, 31}]), 0.2f);
+    }
+
+    for (int y = 0; y < 32; ++y)
+    {
+        EXPECT_NEAR((noise[{0, y}]), (noise[{63, y}]), 0.2f);
+    }
+
+    for (int y = 0; y < 32; ++y)
+    {
+        for (int x = 0; x < 64; ++x)
+        {
+            EXPECT_TRUE(std::isfinite(noise[{x, y}]));
+        }
+    }
+}
+
+TEST(NoiseTests, Perlin_ParallelMatchesSerial)
+{
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool threadPool(ThreadManager::ThreadTaskKind::Simulation, 4, threadManager);
+
+    // Cell widths that are (96 / 24..3) and are not (100 / 20..5) multiples of the vectorization width
+    for (auto const & [size, firstGridDensity, lastGridDensity] : { std::make_tuple(IntegralRectSize(96, 48), 3, 24), std::make_tuple(IntegralRectSize(100, 40), 5, 20) })
+    {
+        GameRandomEngine::GetInstance().Reseed(GameRandomEngine::DefaultSeed);
+        auto const serialNoise = Noise::CreateRepeatableFractal2DPerlinNoise(size, firstGridDensity, lastGridDensity, 0.7f);
+
+        GameRandomEngine::GetInstance().Reseed(GameRandomEngine::DefaultSeed);
+        auto const parallelNoise = Noise::CreateRepeatableFractal2DPerlinNoise(size, firstGridDensity, lastGridDensity, 0.7f, threadPool);
+
+        for (size_t i = 0; i < serialNoise.Size.GetLinearSize(); ++i)
+        {
+            EXPECT_EQ(serialNoise.Data[i], parallelNoise.Data[i]);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#include <Core/PerfTrace.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+std::string ReadFile(std::filesystem::path const & filePath)
+{
+    std::ifstream file(filePath);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+}
+
+TEST(PerfTraceTests, NotRecording_DoesNotRecord)
+{
+    auto const filePath = std::filesystem::temp_directory_path() / "PerfTraceTests_1.json";
+
+    {
+        ScopedPerfTraceEvent const e("Foo");
+    }
+
+    PerfTrace::GetInstance().StartRecording();
+    size_t const eventCount = PerfTrace::GetInstance().StopRecording(filePath);
+
+    EXPECT_EQ(eventCount, 0u);
+
+    std::filesystem::remove(filePath);
+}
+
+TEST(PerfTraceTests, RecordsEventsOfAllThreads)
+{
+    auto const filePath = std::filesystem::temp_directory_path() / "PerfTraceTests_2.json";
+
+    PerfTrace::GetInstance().StartRecording();
+
+    PerfTrace::GetInstance().SetThisThreadName("Test Main");
+
+    {
+        ScopedPerfTraceEvent const e("Foo");
+    }
+
+    std::thread t(
+        []()
+        {
+            PerfTrace::GetInstance().SetThisThreadName("Test \"Worker\"");
+
+            ScopedPerfTraceEvent const e("Bar");
+        });
+
+    t.join();
+
+    size_t const eventCount = PerfTrace::GetInstance().StopRecording(filePath);
+
+    EXPECT_EQ(eventCount, 2u);
+
+    std::string const trace = ReadFile(filePath);
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(trace.find("\"name\":\"Foo\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Bar\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Test Main\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Test \\\"Worker\\\"\""), std::string::npos);
+
+    std::filesystem::remove(filePath);
+}
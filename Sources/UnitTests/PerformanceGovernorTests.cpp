@@ -0,0 +1,84 @@
+#include <Game/PerformanceGovernor.h>
+
+#include "gtest/gtest.h"
+
+TEST(PerformanceGovernorTests, StartsAtMaxQuality)
+{
+    PerformanceGovernor governor(16.0f);
+
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.GetQualityLevel());
+}
+
+TEST(PerformanceGovernorTests, LowersQualityOnlyAfterPersistentSlowFrames)
+{
+    PerformanceGovernor governor(16.0f);
+
+    // A single spike is not enough
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(30.0f));
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(16.0f));
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(30.0f));
+
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(30.0f));
+}
+
+TEST(PerformanceGovernorTests, KeepsQualityWithinDeadBand)
+{
+    PerformanceGovernor governor(16.0f);
+
+    governor.Update(30.0f);
+    ASSERT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(30.0f));
+
+    // Neither slow nor comfortably fast
+    for (int i = 0; i < 20; ++i)
+    {
+        EXPECT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(14.0f));
+    }
+}
+
+TEST(PerformanceGovernorTests, RaisesQualityOnlyAfterPersistentFastFrames)
+{
+    PerformanceGovernor governor(16.0f);
+
+    governor.Update(30.0f);
+    ASSERT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(30.0f));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(5.0f));
+    }
+
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(5.0f));
+
+    // Never beyond max
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(5.0f));
+    }
+}
+
+TEST(PerformanceGovernorTests, NeverBelowZero)
+{
+    PerformanceGovernor governor(16.0f);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        governor.Update(100.0f);
+    }
+
+    EXPECT_EQ(0, governor.GetQualityLevel());
+}
+
+TEST(PerformanceGovernorTests, Reset)
+{
+    PerformanceGovernor governor(16.0f);
+
+    governor.Update(30.0f);
+    ASSERT_EQ(PerformanceGovernor::MaxQualityLevel - 1, governor.Update(30.0f));
+
+    governor.Reset();
+
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.GetQualityLevel());
+
+    // Slow-period count restarts too
+    EXPECT_EQ(PerformanceGovernor::MaxQualityLevel, governor.Update(30.0f));
+}
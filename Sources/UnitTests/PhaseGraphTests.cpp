@@ -0,0 +1,117 @@
+#include <Core/PhaseGraph.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    enum class TestResource
+    {
+        A,
+        B,
+        C,
+
+        _Last = C
+    };
+}
+
+using TestPhaseGraph = PhaseGraph<TestResource>;
+
+TEST(PhaseGraphTests, IndependentPhases_HaveNoDependencies)
+{
+    TestPhaseGraph graph;
+
+    auto const p0 = graph.AddPhase([]() {}, { TestResource::A }, { TestResource::B });
+    auto const p1 = graph.AddPhase([]() {}, { TestResource::A }, { TestResource::C });
+
+    EXPECT_TRUE(graph.GetDependencies(p0).empty());
+    EXPECT_TRUE(graph.GetDependencies(p1).empty());
+}
+
+TEST(PhaseGraphTests, ReadAfterWrite)
+{
+    TestPhaseGraph graph;
+
+    auto const p0 = graph.AddPhase([]() {}, {}, { TestResource::A });
+    auto const p1 = graph.AddPhase([]() {}, { TestResource::A }, {});
+
+    EXPECT_EQ(graph.GetDependencies(p1), std::vector<TestPhaseGraph::PhaseId>({ p0 }));
+}
+
+TEST(PhaseGraphTests, WriteAfterRead)
+{
+    TestPhaseGraph graph;
+
+    auto const p0 = graph.AddPhase([]() {}, { TestResource::A }, {});
+    auto const p1 = graph.AddPhase([]() {}, { TestResource::A }, {});
+    auto const p2 = graph.AddPhase([]() {}, {}, { TestResource::A });
+
+    EXPECT_TRUE(graph.GetDependencies(p1).empty());
+    EXPECT_EQ(graph.GetDependencies(p2), std::vector<TestPhaseGraph::PhaseId>({ p0, p1 }));
+}
+
+TEST(PhaseGraphTests, WriteAfterWrite)
+{
+    TestPhaseGraph graph;
+
+    auto const p0 = graph.AddPhase([]() {}, {}, { TestResource::A });
+    auto const p1 = graph.AddPhase([]() {}, {}, { TestResource::A, TestResource::B });
+    auto const p2 = graph.AddPhase([]() {}, { TestResource::B }, {});
+    auto const p3 = graph.AddPhase([]() {}, { TestResource::A }, { TestResource::A });
+
+    EXPECT_EQ(graph.GetDependencies(p1), std::vector<TestPhaseGraph::PhaseId>({ p0 }));
+    EXPECT_EQ(graph.GetDependencies(p2), std::vector<TestPhaseGraph::PhaseId>({ p1 }));
+    EXPECT_EQ(graph.GetDependencies(p3), std::vector<TestPhaseGraph::PhaseId>({ p1 }));
+}
+
+TEST(PhaseGraphTests, PhaseGroups)
+{
+    TestPhaseGraph graph;
+
+    auto const p0 = graph.AddPhase([]() {}, {}, { TestResource::A });
+
+    std::vector<ThreadPool::Task> tasks;
+    tasks.emplace_back([]() {});
+    tasks.emplace_back([]() {});
+    auto const g1 = graph.AddPhases(std::move(tasks), { TestResource::A }, { TestResource::B });
+
+    auto const p2 = graph.AddPhase([]() {}, { TestResource::B }, {});
+    auto const p3 = graph.AddPhase([]() {}, {}, { TestResource::A });
+
+    ASSERT_EQ(g1.size(), 2u);
+
+    // Phases in a group don't depend on each other
+    EXPECT_EQ(graph.GetDependencies(g1[0]), std::vector<TestPhaseGraph::PhaseId>({ p0 }));
+    EXPECT_EQ(graph.GetDependencies(g1[1]), std::vector<TestPhaseGraph::PhaseId>({ p0 }));
+
+    // Later phases depend on the whole group
+    EXPECT_EQ(graph.GetDependencies(p2), std::vector<TestPhaseGraph::PhaseId>({ g1[0], g1[1] }));
+    EXPECT_EQ(graph.GetDependencies(p3), std::vector<TestPhaseGraph::PhaseId>({ p0, g1[0], g1[1] }));
+}
+
+TEST(PhaseGraphTests, Run_SeesProgramOrder)
+{
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool threadPool(ThreadManager::ThreadTaskKind::Simulation, 4, threadManager);
+
+    for (int iter = 0; iter < 50; ++iter)
+    {
+        int a = 0;
+        int b = 0;
+        int seenA = -1;
+        int seenB = -1;
+
+        TestPhaseGraph graph;
+        graph.AddPhase([&]() { a = 1; }, {}, { TestResource::A });
+        graph.AddPhase([&]() { b = 1; }, {}, { TestResource::B });
+        graph.AddPhase([&]() { seenA = a; }, { TestResource::A }, { TestResource::C });
+        graph.AddPhase([&]() { a = 2; b = a + b; }, { TestResource::B }, { TestResource::A, TestResource::B });
+        graph.AddPhase([&]() { seenB = b; }, { TestResource::B, TestResource::C }, {});
+
+        graph.Run(threadPool);
+
+        EXPECT_EQ(seenA, 1);
+        EXPECT_EQ(seenB, 3);
+    }
+}
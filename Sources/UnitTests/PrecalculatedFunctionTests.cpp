@@ -1,6 +1,7 @@
 #include <Core/PrecalculatedFunction.h>
 
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -124,4 +125,33 @@ TEST(PrecalculatedFunctionTests, LinearlyInterpolatedPeriodic)
     EXPECT_NEAR(sin(2.0f * Pi<float> * -0.67f), pf.GetLinearlyInterpolatedPeriodic(-1.67f), 0.0001);
     EXPECT_NEAR(sin(2.0f * Pi<float> * -0.67f), pf.GetLinearlyInterpolatedPeriodic(-2.67f), 0.0001);
     EXPECT_NEAR(sin(2.0f * Pi<float> * -0.67f), pf.GetLinearlyInterpolatedPeriodic(-100.67f), 0.0001);
-}
\ No newline at end of file
+}
+
+TEST(PrecalculatedFunctionTests, LinearlyInterpolatedPeriodic_Batch)
+{
+    PrecalculatedFunction<512> pf(
+        [](float x)
+        {
+            return sin(2.0f * Pi<float> * x);
+        });
+
+    // Not a multiple of the vectorization width, to also exercise the tail
+    std::vector<float> x;
+    for (float v = -103.3f; v < 103.3f; v += 0.0731f)
+    {
+        x.push_back(v);
+    }
+
+    x.push_back(-1.0f);
+    x.push_back(0.0f);
+    x.push_back(1.0f);
+    x.push_back(-0.5f / 512.0f);
+
+    std::vector<float> values(x.size());
+    pf.GetLinearlyInterpolatedPeriodic(x.data(), values.data(), x.size());
+
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(pf.GetLinearlyInterpolatedPeriodic(x[i]), values[i], 0.0001) << "x=" << x[i];
+    }
+}
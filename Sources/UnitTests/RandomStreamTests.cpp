@@ -0,0 +1,100 @@
+#include <Core/GameRandomEngine.h>
+#include <Core/RandomStream.h>
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+TEST(RandomStreamTests, IsDeterministic)
+{
+    RandomStream stream1(42, 3);
+    RandomStream stream2(42, 3);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(stream1(), stream2());
+    }
+}
+
+TEST(RandomStreamTests, StreamsAreIndependent)
+{
+    RandomStream stream1(42, 0);
+    RandomStream stream2(42, 1);
+    RandomStream stream3(43, 0);
+
+    int equalCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto const v1 = stream1();
+        auto const v2 = stream2();
+        auto const v3 = stream3();
+
+        if (v1 == v2 || v1 == v3 || v2 == v3)
+            ++equalCount;
+    }
+
+    EXPECT_EQ(0, equalCount);
+}
+
+TEST(RandomStreamTests, NormalizedUniformReal_IsInRange)
+{
+    RandomStream stream(42, 0);
+
+    float sum = 0.0f;
+    for (int i = 0; i < 10000; ++i)
+    {
+        float const value = stream.GenerateNormalizedUniformReal();
+        EXPECT_GE(value, 0.0f);
+        EXPECT_LT(value, 1.0f);
+
+        sum += value;
+    }
+
+    EXPECT_NEAR(0.5f, sum / 10000.0f, 0.02f);
+}
+
+TEST(RandomStreamTests, FillNormalizedUniformReals_MatchesSequentialGeneration)
+{
+    RandomStream stream1(42, 0);
+    RandomStream stream2(42, 0);
+
+    // Misalign the batch with respect to the start of the stream
+    EXPECT_EQ(stream1.GenerateNormalizedUniformReal(), stream2.GenerateNormalizedUniformReal());
+
+    std::vector<float> values(37);
+    stream1.FillNormalizedUniformReals(values.data(), values.size());
+
+    for (float const value : values)
+    {
+        EXPECT_EQ(stream2.GenerateNormalizedUniformReal(), value);
+    }
+
+    // Continues from after the batch
+    EXPECT_EQ(stream2(), stream1());
+}
+
+TEST(RandomStreamTests, Counter_ResumesSequence)
+{
+    RandomStream stream1(42, 0);
+    for (int i = 0; i < 10; ++i)
+        stream1();
+
+    RandomStream stream2(42, 0);
+    stream2.SetCounter(stream1.GetCounter());
+
+    EXPECT_EQ(stream1(), stream2());
+}
+
+TEST(RandomStreamTests, GameRandomEngine_MakeStream_DoesNotDependOnDraws)
+{
+    auto & randomEngine = GameRandomEngine::GetInstance();
+    randomEngine.Reseed(1234);
+
+    RandomStream stream1 = randomEngine.MakeStream(5);
+
+    randomEngine.GenerateNormalizedUniformReal();
+
+    RandomStream stream2 = randomEngine.MakeStream(5);
+
+    EXPECT_EQ(stream1(), stream2());
+}
@@ -0,0 +1,177 @@
+#include <ShipBuilderLib/ScanlineFloodFill.h>
+
+#include <Core/Buffer2D.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace ShipBuilder {
+
+namespace {
+
+// 0: fillable; 1: wall; 2: filled
+Buffer2D<int, struct IntegralTag> MakeGrid(std::vector<std::string> const & rows)
+{
+    Buffer2D<int, struct IntegralTag> grid(static_cast<int>(rows[0].size()), static_cast<int>(rows.size()), 0);
+    for (int y = 0; y < grid.Size.height; ++y)
+    {
+        for (int x = 0; x < grid.Size.width; ++x)
+        {
+            grid[IntegralCoordinates(x, y)] = (rows[y][x] == '#') ? 1 : 0;
+        }
+    }
+
+    return grid;
+}
+
+template<bool IsEightConnected>
+Buffer2D<int, struct IntegralTag> ReferenceFill(
+    Buffer2D<int, struct IntegralTag> grid,
+    IntegralCoordinates const & seed)
+{
+    std::queue<IntegralCoordinates> points;
+    grid[seed] = 2;
+    points.push(seed);
+
+    while (!points.empty())
+    {
+        auto const p = points.front();
+        points.pop();
+
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                if ((dx == 0 && dy == 0) || (!IsEightConnected && dx != 0 && dy != 0))
+                {
+                    continue;
+                }
+
+                IntegralCoordinates const n(p.x + dx, p.y + dy);
+                if (n.IsInSize(grid.Size) && grid[n] == 0)
+                {
+                    grid[n] = 2;
+                    points.push(n);
+                }
+            }
+        }
+    }
+
+    return grid;
+}
+
+template<bool IsEightConnected>
+Buffer2D<int, struct IntegralTag> ScanlineFill(
+    Buffer2D<int, struct IntegralTag> grid,
+    IntegralCoordinates const & seed,
+    std::vector<IntegralCoordinates> * borders = nullptr)
+{
+    ScanlineFloodFill<IsEightConnected>(
+        seed,
+        grid.Size,
+        [&](IntegralCoordinates const & coords)
+        {
+            return grid[coords] == 0;
+        },
+        [&](int y, int startX, int endX)
+        {
+            for (int x = startX; x < endX; ++x)
+            {
+                EXPECT_EQ(grid[IntegralCoordinates(x, y)], 0);
+                grid[IntegralCoordinates(x, y)] = 2;
+            }
+        },
+        [&](IntegralCoordinates const & coords)
+        {
+            if (borders != nullptr && grid[coords] == 1)
+            {
+                borders->push_back(coords);
+            }
+        });
+
+    return grid;
+}
+
+}
+
+TEST(ScanlineFloodFillTests, FourConnected_MatchesReference)
+{
+    auto const grid = MakeGrid({
+        "....#.....",
+        ".##.#.###.",
+        ".#..#...#.",
+        ".#.###..#.",
+        ".#...#.##.",
+        "..##.#....",
+        "#...#.#.#.",
+        ".#.......#" });
+
+    for (int y = 0; y < grid.Size.height; ++y)
+    {
+        for (int x = 0; x < grid.Size.width; ++x)
+        {
+            IntegralCoordinates const seed(x, y);
+            if (grid[seed] == 0)
+            {
+                EXPECT_EQ(ScanlineFill<false>(grid.Clone(), seed), ReferenceFill<false>(grid.Clone(), seed));
+            }
+        }
+    }
+}
+
+TEST(ScanlineFloodFillTests, EightConnected_MatchesReference)
+{
+    auto const grid = MakeGrid({
+        "...#......",
+        "..#.#.###.",
+        ".#...#..#.",
+        "#.#.#..#..",
+        ".#.#..#.#.",
+        "..#..#...#",
+        ".#..#.#.#.",
+        "#..#...#.." });
+
+    for (int y = 0; y < grid.Size.height; ++y)
+    {
+        for (int x = 0; x < grid.Size.width; ++x)
+        {
+            IntegralCoordinates const seed(x, y);
+            if (grid[seed] == 0)
+            {
+                EXPECT_EQ(ScanlineFill<true>(grid.Clone(), seed), ReferenceFill<true>(grid.Clone(), seed));
+            }
+        }
+    }
+}
+
+TEST(ScanlineFloodFillTests, EightConnected_VisitsAllBorders)
+{
+    auto const grid = MakeGrid({
+        "#####",
+        "#...#",
+        "#.#.#",
+        "#...#",
+        "#####" });
+
+    std::vector<IntegralCoordinates> borders;
+    ScanlineFill<true>(grid.Clone(), IntegralCoordinates(1, 1), &borders);
+
+    // All walls are neighbors of the ring, corners included
+    for (int y = 0; y < grid.Size.height; ++y)
+    {
+        for (int x = 0; x < grid.Size.width; ++x)
+        {
+            IntegralCoordinates const coords(x, y);
+            if (grid[coords] == 1)
+            {
+                EXPECT_NE(std::find(borders.cbegin(), borders.cend(), coords), borders.cend());
+            }
+        }
+    }
+}
+
+}
@@ -353,6 +353,32 @@ TEST(SettingsTests, Settings_SetDirtyWithDiff)
     EXPECT_TRUE(settings1.IsDirty(TestSettings::Setting5_custom));
 }
 
+TEST(SettingsTests, Settings_AssignDirty)
+{
+    Settings<TestSettings> settings1(MakeTestSettings());
+
+    settings1.SetValue<float>(TestSettings::Setting1_float, 242.0f);
+    settings1.SetValue<uint32_t>(TestSettings::Setting2_uint32, 999);
+
+    Settings<TestSettings> settings2(MakeTestSettings());
+
+    settings2.SetValue<uint32_t>(TestSettings::Setting2_uint32, 1000);
+    settings2.SetValue<std::string>(TestSettings::Setting4_string, std::string("Test!"));
+    settings2.ClearDirty(TestSettings::Setting4_string);
+
+    settings1.AssignDirty(settings2);
+
+    EXPECT_EQ(242.0f, settings1.GetValue<float>(TestSettings::Setting1_float));
+    EXPECT_EQ(1000u, settings1.GetValue<uint32_t>(TestSettings::Setting2_uint32));
+    EXPECT_EQ(std::string(""), settings1.GetValue<std::string>(TestSettings::Setting4_string));
+
+    EXPECT_FALSE(settings1.IsDirty(TestSettings::Setting1_float));
+    EXPECT_TRUE(settings1.IsDirty(TestSettings::Setting2_uint32));
+    EXPECT_FALSE(settings1.IsDirty(TestSettings::Setting3_bool));
+    EXPECT_FALSE(settings1.IsDirty(TestSettings::Setting4_string));
+    EXPECT_FALSE(settings1.IsDirty(TestSettings::Setting5_custom));
+}
+
 TEST(SettingsTests, Settings_Comparison)
 {
     Settings<TestSettings> settings1(MakeTestSettings());
@@ -1451,6 +1477,49 @@ TEST(SettingsTests, BaseSettingsManager_E2E_SaveAndLoadPersistedSettings_ByVal)
     EXPECT_EQ(123, settings2.GetValue<CustomValue>(TestSettings::Setting5_custom).Int);
 }
 
+TEST(SettingsTests, BaseSettingsManager_E2E_LoadPersistedSettings_ReloadsAfterSave)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    TestSettingsManager sm(testFileSystem);
+
+    PersistedSettingsKey const key("TestName", PersistedSettingsStorageTypes::User);
+
+    Settings<TestSettings> settings1(MakeTestSettings());
+    settings1.SetValue<uint32_t>(TestSettings::Setting2_uint32, 999);
+    sm.SaveDirtySettings("TestName", "TestDescription", settings1);
+
+    Settings<TestSettings> settings2(MakeTestSettings());
+    sm.LoadPersistedSettings(key, settings2);
+
+    EXPECT_EQ(999u, settings2.GetValue<uint32_t>(TestSettings::Setting2_uint32));
+    EXPECT_TRUE(settings2.IsDirty(TestSettings::Setting2_uint32));
+    EXPECT_FALSE(settings2.IsDirty(TestSettings::Setting1_float));
+
+    //
+    // Overwrite - the next load must see the new values
+    //
+
+    Settings<TestSettings> settings3(MakeTestSettings());
+    settings3.SetValue<uint32_t>(TestSettings::Setting2_uint32, 1000);
+    settings3.SetValue<bool>(TestSettings::Setting3_bool, true);
+    sm.SaveDirtySettings("TestName", "TestDescription", settings3);
+
+    Settings<TestSettings> settings4(MakeTestSettings());
+    sm.LoadPersistedSettings(key, settings4);
+
+    EXPECT_EQ(1000u, settings4.GetValue<uint32_t>(TestSettings::Setting2_uint32));
+    EXPECT_EQ(true, settings4.GetValue<bool>(TestSettings::Setting3_bool));
+
+    // Loading again gives the same
+    Settings<TestSettings> settings5(MakeTestSettings());
+    sm.LoadPersistedSettings(key, settings5);
+
+    EXPECT_EQ(settings4, settings5);
+    EXPECT_TRUE(settings5.IsDirty(TestSettings::Setting2_uint32));
+    EXPECT_TRUE(settings5.IsDirty(TestSettings::Setting3_bool));
+    EXPECT_FALSE(settings5.IsDirty(TestSettings::Setting4_string));
+}
+
 TEST(SettingsTests, BaseSettingsManager_E2E_DeletePersistedSettings)
 {
     auto testFileSystem = std::make_shared<TestFileSystem>();
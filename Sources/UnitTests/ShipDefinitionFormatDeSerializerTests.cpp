@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 #include <vector>
 
@@ -176,6 +177,60 @@ TEST(ShipDefinitionFormatDeSerializerTests, AutoTexturizationSettings)
     EXPECT_EQ(sourceAts.MaterialTextureTransparency, targetAts.MaterialTextureTransparency);
 }
 
+TEST(ShipDefinitionFormatDeSerializerTests, SectionIndex)
+{
+    ShipDefinition const shipDefinition(
+        ShipLayers(ShipSpaceSize(10, 20), nullptr, nullptr, nullptr, nullptr, nullptr),
+        ShipMetadata("TestShipName"),
+        ShipPhysicsData(),
+        std::nullopt);
+
+    MemoryBinaryWriteStream outputStream;
+    ShipDefinitionFormatDeSerializer::Save(
+        shipDefinition,
+        Version(1, 2, 3, 4),
+        outputStream);
+
+    //
+    // Index
+    //
+
+    auto inputStream1 = outputStream.MakeReadStreamCopy();
+    DeSerializationBuffer<BigEndianess> buffer(256);
+    auto const sectionIndex = ShipDefinitionFormatDeSerializer::TryReadSectionIndex(inputStream1, buffer);
+
+    ASSERT_TRUE(sectionIndex.has_value());
+    ASSERT_EQ(sectionIndex->size(), 3u);
+    EXPECT_EQ((*sectionIndex)[0].first, static_cast<std::uint32_t>(ShipDefinitionFormatDeSerializer::MainSectionTagType::ShipAttributes));
+    EXPECT_EQ((*sectionIndex)[0].second, sizeof(ShipDefinitionFormatDeSerializer::FileHeader));
+    EXPECT_EQ((*sectionIndex)[1].first, static_cast<std::uint32_t>(ShipDefinitionFormatDeSerializer::MainSectionTagType::Metadata));
+    EXPECT_EQ((*sectionIndex)[2].first, static_cast<std::uint32_t>(ShipDefinitionFormatDeSerializer::MainSectionTagType::PhysicsData));
+
+    //
+    // Preview data, via index
+    //
+
+    auto inputStream2 = outputStream.MakeReadStreamCopy();
+    ShipPreviewData const previewData1 = ShipDefinitionFormatDeSerializer::LoadPreviewData(inputStream2);
+    EXPECT_EQ(previewData1.ShipSize, ShipSpaceSize(10, 20));
+    EXPECT_EQ(previewData1.Metadata.ShipName, "TestShipName");
+
+    //
+    // Preview data, from a file without index (i.e. with an empty tail)
+    //
+
+    std::vector<std::uint8_t> unindexedData(outputStream.GetData(), outputStream.GetData() + outputStream.GetSize() - sizeof(std::uint32_t));
+    std::fill(unindexedData.end() - sizeof(std::uint32_t), unindexedData.end(), std::uint8_t(0));
+
+    MemoryBinaryReadStream inputStream3(std::move(unindexedData));
+    EXPECT_FALSE(ShipDefinitionFormatDeSerializer::TryReadSectionIndex(inputStream3, buffer).has_value());
+
+    inputStream3.SetPosition(0);
+    ShipPreviewData const previewData2 = ShipDefinitionFormatDeSerializer::LoadPreviewData(inputStream3);
+    EXPECT_EQ(previewData2.ShipSize, ShipSpaceSize(10, 20));
+    EXPECT_EQ(previewData2.Metadata.ShipName, "TestShipName");
+}
+
 class ShipDefinitionFormatDeSerializer_StructuralLayerTests : public testing::Test
 {
 protected:
@@ -1178,6 +1233,62 @@ TEST(ShipDefinitionFormatDeSerializer, Roundtrip)
     EXPECT_EQ(sd.AutoTexturizationSettings->MaterialTextureMagnification, shipDefinition.AutoTexturizationSettings->MaterialTextureMagnification);
     EXPECT_EQ(sd.AutoTexturizationSettings->MaterialTextureTransparency, shipDefinition.AutoTexturizationSettings->MaterialTextureTransparency);
 
+    //
+    // Deserialize whole, decoding layers concurrently
+    //
+
+    {
+        ThreadManager threadManager(false, ThreadManager::GetNumberOfProcessors(), [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+        auto inputStream4 = outputStream.MakeReadStreamCopy();
+
+        ShipDefinition const sdp = ShipDefinitionFormatDeSerializer::Load(
+            inputStream4,
+            materialDatabase,
+            threadManager);
+
+        ASSERT_TRUE(sdp.Layers.StructuralLayer);
+        for (size_t i = 0; i < shipSize.GetLinearSize(); ++i)
+        {
+            EXPECT_EQ(sdp.Layers.StructuralLayer->Buffer.Data[i].Material, sd.Layers.StructuralLayer->Buffer.Data[i].Material);
+        }
+
+        ASSERT_TRUE(sdp.Layers.ElectricalLayer);
+        for (size_t i = 0; i < shipSize.GetLinearSize(); ++i)
+        {
+            EXPECT_EQ(sdp.Layers.ElectricalLayer->Buffer.Data[i].Material, sd.Layers.ElectricalLayer->Buffer.Data[i].Material);
+            EXPECT_EQ(sdp.Layers.ElectricalLayer->Buffer.Data[i].InstanceIndex, sd.Layers.ElectricalLayer->Buffer.Data[i].InstanceIndex);
+        }
+
+        ASSERT_TRUE(sdp.Layers.RopesLayer);
+        EXPECT_EQ(sdp.Layers.RopesLayer->Buffer.GetElementCount(), 2u);
+
+        ASSERT_TRUE(sdp.Layers.ExteriorTextureLayer);
+        EXPECT_EQ(sdp.Layers.ExteriorTextureLayer->Buffer.Size, sourceExteriorTexture.Size);
+    }
+
+    //
+    // Serialize again, reporting progress - yielding the same file
+    //
+
+    {
+        std::vector<float> progresses;
+
+        MemoryBinaryWriteStream outputStream2;
+        ShipDefinitionFormatDeSerializer::Save(
+            shipDefinition,
+            Version(1, 2, 3, 4),
+            outputStream2,
+            SimpleProgressCallback([&progresses](float progress) { progresses.push_back(progress); }));
+
+        ASSERT_EQ(outputStream2.GetSize(), outputStream.GetSize());
+        EXPECT_EQ(std::memcmp(outputStream2.GetData(), outputStream.GetData(), outputStream.GetSize()), 0);
+
+        ASSERT_FALSE(progresses.empty());
+        EXPECT_TRUE(std::is_sorted(progresses.cbegin(), progresses.cend()));
+        EXPECT_EQ(progresses.back(), 1.0f);
+    }
+
     //
     // Deserialize preview data
     //
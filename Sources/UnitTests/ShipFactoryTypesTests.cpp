@@ -0,0 +1,46 @@
+#include <Simulation/ShipFactoryTypes.h>
+
+#include "gtest/gtest.h"
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_FindsInsertedPairsRegardlessOfOrder)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    auto const [entry1, isInserted1] = map.try_emplace({ 4, 2 }, 10);
+    EXPECT_TRUE(isInserted1);
+    EXPECT_EQ(ElementIndex(10), entry1->second);
+
+    auto const [entry2, isInserted2] = map.try_emplace({ 2, 4 }, 11);
+    EXPECT_FALSE(isInserted2);
+    EXPECT_EQ(ElementIndex(10), entry2->second);
+
+    EXPECT_EQ(1u, map.size());
+
+    auto const it = map.find({ 2, 4 });
+    ASSERT_NE(map.cend(), it);
+    EXPECT_EQ(ElementIndex(10), it->second);
+
+    EXPECT_EQ(map.cend(), map.find({ 2, 5 }));
+    EXPECT_EQ(map.cend(), map.find({ 0, 0 }));
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_SurvivesGrowth)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    for (ElementIndex i = 0; i < 5000; ++i)
+    {
+        EXPECT_TRUE(map.try_emplace({ i, i + 1 }, i).second);
+    }
+
+    EXPECT_EQ(5000u, map.size());
+
+    for (ElementIndex i = 0; i < 5000; ++i)
+    {
+        auto const it = map.find({ i + 1, i });
+        ASSERT_NE(map.cend(), it);
+        EXPECT_EQ(i, it->second);
+
+        EXPECT_EQ(map.cend(), map.find({ i, i + 2 }));
+    }
+}
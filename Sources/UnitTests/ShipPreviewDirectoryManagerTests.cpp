@@ -2,6 +2,8 @@
 
 #include "TestingUtils.h"
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
 #include <sstream>
 
@@ -967,4 +969,78 @@ TEST_F(ShipPreviewImageDatabaseTests, Commit_NewOverwrites1)
     ++verifyIndexIt;
     EXPECT_EQ("preview_s", verifyIndexIt->first.string());
     EXPECT_EQ(ImageSize(3, 3), verifyIndexIt->second.Dimensions);
-}
\ No newline at end of file
+}
+TEST_F(ShipPreviewImageDatabaseTests, TryGetPreviewImage_RoundtripsImageContent)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+
+    ImageSize const dimensions(7, 4);
+    std::unique_ptr<rgbaColor[]> buffer = std::make_unique<rgbaColor[]>(dimensions.GetLinearSize());
+    for (size_t i = 0; i < dimensions.GetLinearSize(); ++i)
+    {
+        buffer[i] = rgbaColor(
+            static_cast<rgbaColor::data_type>(i * 3),
+            static_cast<rgbaColor::data_type>(255 - i),
+            static_cast<rgbaColor::data_type>(i * 7),
+            static_cast<rgbaColor::data_type>(i % 2 == 0 ? 255 : 128));
+    }
+
+    auto newDb = NewShipPreviewImageDatabase(testFileSystem);
+
+    newDb.Add(
+        "preview_a",
+        std::filesystem::file_time_type::min() + std::chrono::seconds(10),
+        std::make_unique<RgbaImageData>(dimensions, std::make_unique<rgbaColor[]>(dimensions.GetLinearSize())));
+
+    newDb.Add(
+        "preview_b",
+        std::filesystem::file_time_type::min() + std::chrono::seconds(20),
+        std::make_unique<RgbaImageData>(dimensions, std::move(buffer)));
+
+    bool const isCreated = newDb.Commit(
+        TmpDatabaseFilePath,
+        PersistedShipPreviewImageDatabase(testFileSystem),
+        true,
+        1);
+
+    ASSERT_TRUE(isCreated);
+
+    PersistedShipPreviewImageDatabase verifyDb = PersistedShipPreviewImageDatabase::Load(
+        TmpDatabaseFilePath,
+        testFileSystem);
+
+    // Stale timestamp is not served
+    EXPECT_FALSE(verifyDb.TryGetPreviewImage("preview_b", std::filesystem::file_time_type::min() + std::chrono::seconds(21)).has_value());
+
+    auto const previewImage = verifyDb.TryGetPreviewImage("preview_b", std::filesystem::file_time_type::min() + std::chrono::seconds(20));
+    ASSERT_TRUE(previewImage.has_value());
+    ASSERT_EQ(dimensions, previewImage->Size);
+    for (size_t i = 0; i < dimensions.GetLinearSize(); ++i)
+    {
+        EXPECT_EQ(
+            rgbaColor(
+                static_cast<rgbaColor::data_type>(i * 3),
+                static_cast<rgbaColor::data_type>(255 - i),
+                static_cast<rgbaColor::data_type>(i * 7),
+                static_cast<rgbaColor::data_type>(i % 2 == 0 ? 255 : 128)),
+            previewImage->Data[i]);
+    }
+}
+
+TEST_F(ShipPreviewImageDatabaseTests, Load_DiscardsDatabaseWithDifferentImageEncoding)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+
+    MakeOldDb(2, TmpDatabaseFilePath, testFileSystem);
+
+    ASSERT_EQ(2u, PersistedShipPreviewImageDatabase::Load(TmpDatabaseFilePath, testFileSystem).mIndex.size());
+
+    // Pretend the database stores its images in some other encoding
+    auto & content = testFileSystem->GetFileMap()[TmpDatabaseFilePath].BinaryContent;
+    std::array<std::uint8_t, 4> const encodingTag{ 'P', 'N', 'G', '1' };
+    auto const encodingIt = std::search(content.begin(), content.end(), encodingTag.cbegin(), encodingTag.cend());
+    ASSERT_NE(content.end(), encodingIt);
+    *encodingIt = 'X';
+
+    EXPECT_EQ(0u, PersistedShipPreviewImageDatabase::Load(TmpDatabaseFilePath, testFileSystem).mIndex.size());
+}
@@ -0,0 +1,227 @@
+#include <Game/ShipSearchIndex.h>
+
+#include "TestingUtils.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    static std::filesystem::path LibraryDirectory = "C:\\Ships";
+
+    std::filesystem::file_time_type MakeLastModified(int seconds)
+    {
+        return std::filesystem::file_time_type::min() + std::chrono::seconds(seconds);
+    }
+
+    class TestShipMetadataLoader
+    {
+    public:
+
+        std::map<std::filesystem::path, ShipMetadata> Metadata;
+        std::vector<std::filesystem::path> LoadedShipFilePaths;
+
+        ShipSearchIndex::ShipMetadataLoader MakeLoader()
+        {
+            return [this](std::filesystem::path const & shipFilePath)
+            {
+                LoadedShipFilePaths.push_back(shipFilePath);
+
+                auto const it = Metadata.find(shipFilePath);
+                if (it == Metadata.end())
+                {
+                    throw std::runtime_error("Not a ship");
+                }
+
+                return EnhancedShipPreviewData(
+                    shipFilePath,
+                    ShipSpaceSize(100, 40),
+                    it->second,
+                    false,
+                    false,
+                    PortableTimepoint::Now());
+            };
+        }
+    };
+
+    ShipMetadata MakeMetadata(
+        std::string const & shipName,
+        std::string const & author,
+        std::string const & yearBuilt)
+    {
+        ShipMetadata metadata(shipName);
+        metadata.Author = author;
+        metadata.YearBuilt = yearBuilt;
+        return metadata;
+    }
+
+    auto const NeverInterrupted = []() { return false; };
+}
+
+class ShipSearchIndexTests : public testing::Test
+{
+};
+
+TEST_F(ShipSearchIndexTests, Search_AcrossDirectories)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "a" / "titanic.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "b" / "c" / "carpathia.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "b" / "readme.txt", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    loader.Metadata.emplace(LibraryDirectory / "a" / "titanic.shp2", MakeMetadata("R.M.S. Titanic", "Shipwright", "1912"));
+    loader.Metadata.emplace(LibraryDirectory / "b" / "c" / "carpathia.shp2", MakeMetadata("R.M.S. Carpathia", "Someone Else", "1903"));
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_EQ(0u, index.GetSize());
+
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+    EXPECT_EQ(2u, index.GetSize());
+    EXPECT_EQ(2u, loader.LoadedShipFilePaths.size()); // Not the readme
+
+    auto results = index.Search("r.m.s.");
+    ASSERT_EQ(2u, results.size());
+    EXPECT_EQ(LibraryDirectory / "a" / "titanic.shp2", results[0]);
+    EXPECT_EQ(LibraryDirectory / "b" / "c" / "carpathia.shp2", results[1]);
+
+    results = index.Search("SHIPWRIGHT");
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(LibraryDirectory / "a" / "titanic.shp2", results[0]);
+
+    results = index.Search("1903");
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(LibraryDirectory / "b" / "c" / "carpathia.shp2", results[0]);
+
+    results = index.Search("lusitania");
+    EXPECT_EQ(0u, results.size());
+}
+
+TEST_F(ShipSearchIndexTests, SaveAndLoad_Roundtrip)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "a" / "titanic.shp2", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    auto metadata = MakeMetadata("R.M.S. Titanic", "Shipwright", "1912");
+    metadata.Description = "Unsinkable";
+    loader.Metadata.emplace(LibraryDirectory / "a" / "titanic.shp2", metadata);
+
+    {
+        auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+        EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+        index.Save();
+    }
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_EQ(1u, index.GetSize());
+
+    auto const results = index.Search("unsinkable");
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(LibraryDirectory / "a" / "titanic.shp2", results[0]);
+}
+
+TEST_F(ShipSearchIndexTests, Update_OnlyReloadsNewAndModifiedShips)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "titanic.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "carpathia.shp2", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    loader.Metadata.emplace(LibraryDirectory / "titanic.shp2", MakeMetadata("Titanic", "A", "1912"));
+    loader.Metadata.emplace(LibraryDirectory / "carpathia.shp2", MakeMetadata("Carpathia", "B", "1903"));
+    loader.Metadata.emplace(LibraryDirectory / "lusitania.shp2", MakeMetadata("Lusitania", "C", "1906"));
+
+    {
+        auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+        EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+        index.Save();
+    }
+
+    // Modify one, add one
+    testFileSystem->PrepareTestFile(LibraryDirectory / "carpathia.shp2", "", MakeLastModified(20));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "lusitania.shp2", "", MakeLastModified(10));
+    loader.Metadata.at(LibraryDirectory / "carpathia.shp2").ShipName = "Carpathia II";
+    loader.LoadedShipFilePaths.clear();
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+
+    ASSERT_EQ(2u, loader.LoadedShipFilePaths.size());
+    EXPECT_EQ(LibraryDirectory / "carpathia.shp2", loader.LoadedShipFilePaths[0]);
+    EXPECT_EQ(LibraryDirectory / "lusitania.shp2", loader.LoadedShipFilePaths[1]);
+
+    EXPECT_EQ(3u, index.GetSize());
+    EXPECT_EQ(1u, index.Search("carpathia ii").size());
+}
+
+TEST_F(ShipSearchIndexTests, Update_ForgetsRemovedShips)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "titanic.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "carpathia.shp2", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    loader.Metadata.emplace(LibraryDirectory / "titanic.shp2", MakeMetadata("Titanic", "A", "1912"));
+    loader.Metadata.emplace(LibraryDirectory / "carpathia.shp2", MakeMetadata("Carpathia", "B", "1903"));
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+    EXPECT_EQ(2u, index.GetSize());
+
+    testFileSystem->DeleteFile(LibraryDirectory / "titanic.shp2");
+
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+    EXPECT_EQ(1u, index.GetSize());
+    EXPECT_EQ(0u, index.Search("titanic").size());
+}
+
+TEST_F(ShipSearchIndexTests, Update_Interrupted)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "titanic.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "carpathia.shp2", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    loader.Metadata.emplace(LibraryDirectory / "titanic.shp2", MakeMetadata("Titanic", "A", "1912"));
+    loader.Metadata.emplace(LibraryDirectory / "carpathia.shp2", MakeMetadata("Carpathia", "B", "1903"));
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+
+    size_t checkCount = 0;
+    EXPECT_FALSE(index.Update(loader.MakeLoader(), [&checkCount]() { return ++checkCount > 1; }));
+    EXPECT_EQ(1u, index.GetSize());
+
+    // Resumes
+    loader.LoadedShipFilePaths.clear();
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+    EXPECT_EQ(1u, loader.LoadedShipFilePaths.size());
+    EXPECT_EQ(2u, index.GetSize());
+}
+
+TEST_F(ShipSearchIndexTests, Update_IgnoresUnloadableShips)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / "titanic.shp2", "", MakeLastModified(10));
+    testFileSystem->PrepareTestFile(LibraryDirectory / "broken.shp2", "", MakeLastModified(10));
+
+    TestShipMetadataLoader loader;
+    loader.Metadata.emplace(LibraryDirectory / "titanic.shp2", MakeMetadata("Titanic", "A", "1912"));
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_TRUE(index.Update(loader.MakeLoader(), NeverInterrupted));
+    EXPECT_EQ(1u, index.GetSize());
+}
+
+TEST_F(ShipSearchIndexTests, Load_UnrecognizedFile_MakesForEmptyIndex)
+{
+    auto testFileSystem = std::make_shared<TestFileSystem>();
+    testFileSystem->PrepareTestFile(LibraryDirectory / ".floatingsandbox_shipsearchindex");
+    testFileSystem->GetFileMap()[LibraryDirectory / ".floatingsandbox_shipsearchindex"].BinaryContent = { 0x01, 0x02, 0x03 };
+
+    auto index = ShipSearchIndex::Load(LibraryDirectory, testFileSystem);
+    EXPECT_EQ(0u, index.GetSize());
+}
@@ -4,6 +4,9 @@
 
 #include "gmock/gmock.h"
 
+#include <thread>
+#include <vector>
+
 class _MockSimulationEventHandler
     : public IStructuralShipEventHandler
     , public IGenericShipEventHandler
@@ -133,4 +136,53 @@ TEST(SimulationEventDispatcherTests, ClearsStateAtUpdate)
     dispatcher.Flush();
 
     Mock::VerifyAndClear(&handler);
-}
\ No newline at end of file
+}
+TEST(SimulationEventDispatcherTests, Aggregates_OnStress_MultipleThreads)
+{
+    MockHandler handler;
+
+    SimulationEventDispatcher dispatcher;
+    dispatcher.RegisterStructuralShipEventHandler(&handler);
+
+    StructuralMaterial sm1 = MakeTestStructuralMaterial("Foo1", rgbColor(1, 2, 3));
+
+    StructuralMaterial sm2 = MakeTestStructuralMaterial("Foo2", rgbColor(1, 2, 3));
+
+    EXPECT_CALL(handler, OnStress(_, _, _)).Times(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    dispatcher.OnStress(sm1, false, 1);
+                    dispatcher.OnStress(sm2, true, 2);
+                }
+            });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    dispatcher.OnStress(sm1, false, 1);
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_CALL(handler, OnStress(Field(&StructuralMaterial::Name, "Foo1"), false, 4001)).Times(1);
+    EXPECT_CALL(handler, OnStress(Field(&StructuralMaterial::Name, "Foo2"), true, 8000)).Times(1);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_CALL(handler, OnStress(_, _, _)).Times(0);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+}
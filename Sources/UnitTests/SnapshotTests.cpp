@@ -0,0 +1,138 @@
+#include <Core/GameException.h>
+#include <Core/GameRandomEngine.h>
+#include <Core/Snapshot.h>
+
+#include "gtest/gtest.h"
+
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+TEST(SnapshotTests, RoundTrip)
+{
+    Buffer<float> buffer(5, 0, [](size_t i) { return static_cast<float>(i) * 1.5f; });
+    std::vector<int> vector{ 4, 5, 6 };
+    std::deque<short> deque{ 7, 8 };
+
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+    writer.Write(42u);
+    writer.Write(buffer);
+    writer.Write(buffer, 2);
+    writer.Write(vector);
+    writer.Write(deque);
+    writer.Write(std::string("Hello"));
+
+    Buffer<float> targetBuffer(5, 0, 0.0f);
+    Buffer<float> targetPartialBuffer(5, 0, -1.0f);
+    std::vector<int> targetVector;
+    std::deque<short> targetDeque{ 1, 2, 3 };
+    std::string targetString;
+
+    SnapshotReader reader(snapshot);
+    EXPECT_EQ(42u, reader.Read<unsigned int>());
+    reader.Read(targetBuffer);
+    reader.Read(targetPartialBuffer, 2);
+    reader.Read(targetVector);
+    reader.Read(targetDeque);
+    reader.Read(targetString);
+
+    EXPECT_TRUE(reader.IsAtEnd());
+
+    for (size_t i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(buffer[i], targetBuffer[i]);
+    }
+
+    EXPECT_EQ(0.0f, targetPartialBuffer[0]);
+    EXPECT_EQ(1.5f, targetPartialBuffer[1]);
+    EXPECT_EQ(-1.0f, targetPartialBuffer[2]);
+
+    EXPECT_EQ(vector, targetVector);
+    EXPECT_EQ(deque, targetDeque);
+    EXPECT_EQ("Hello", targetString);
+}
+
+TEST(SnapshotTests, Read_ThrowsOnBufferSizeMismatch)
+{
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+    writer.Write(Buffer<float>(5, 0, 0.0f));
+
+    Buffer<float> targetBuffer(6, 0, 0.0f);
+
+    SnapshotReader reader(snapshot);
+    EXPECT_THROW(reader.Read(targetBuffer), GameException);
+}
+
+TEST(SnapshotTests, Read_ThrowsOnElementSizeMismatch)
+{
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+    writer.Write(Buffer<float>(5, 0, 0.0f));
+
+    Buffer<double> targetBuffer(5, 0, 0.0);
+
+    SnapshotReader reader(snapshot);
+    EXPECT_THROW(reader.Read(targetBuffer), GameException);
+}
+
+TEST(SnapshotTests, Read_ThrowsWhenTruncated)
+{
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+    writer.Write(std::uint16_t(1));
+
+    SnapshotReader reader(snapshot);
+    EXPECT_THROW(reader.Read<std::uint32_t>(), GameException);
+}
+
+TEST(SnapshotTests, SaveAndLoad)
+{
+    Snapshot snapshot;
+    SnapshotWriter writer(snapshot);
+    writer.Write(std::vector<int>{ 1, 2, 3 });
+
+    auto const filePath = std::filesystem::temp_directory_path() / "SnapshotTests_SaveAndLoad.snapshot";
+    snapshot.Save(filePath);
+
+    Snapshot const loadedSnapshot = Snapshot::Load(filePath);
+    std::filesystem::remove(filePath);
+
+    EXPECT_EQ(snapshot.GetByteSize(), loadedSnapshot.GetByteSize());
+
+    std::vector<int> targetVector;
+    SnapshotReader reader(loadedSnapshot);
+    reader.Read(targetVector);
+
+    EXPECT_EQ(std::vector<int>({ 1, 2, 3 }), targetVector);
+}
+
+TEST(SnapshotTests, GameRandomEngine_ResumesFromState)
+{
+    auto & randomEngine = GameRandomEngine::GetInstance();
+    randomEngine.Reseed(1234);
+
+    // Leave the normal distribution with a cached value
+    randomEngine.GenerateNormalizedUniformReal();
+    randomEngine.GenerateStandardNormalReal();
+
+    std::string const state = randomEngine.GetState();
+
+    std::vector<float> expected;
+    for (int i = 0; i < 10; ++i)
+    {
+        expected.push_back(randomEngine.GenerateNormalizedUniformReal());
+        expected.push_back(randomEngine.GenerateStandardNormalReal());
+    }
+
+    randomEngine.Reseed(5678);
+    randomEngine.SetState(state);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(expected[i * 2], randomEngine.GenerateNormalizedUniformReal());
+        EXPECT_EQ(expected[i * 2 + 1], randomEngine.GenerateStandardNormalReal());
+    }
+}
@@ -0,0 +1,143 @@
+#include <Core/GameGeometry.h>
+#include <Core/SpatialGrid.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+std::vector<vec2f> MakeRandomPositions(size_t count, float extent)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> dist(-extent, extent);
+
+    std::vector<vec2f> positions;
+    for (size_t i = 0; i < count; ++i)
+    {
+        positions.emplace_back(dist(random), dist(random));
+    }
+
+    return positions;
+}
+
+}
+
+TEST(SpatialGridTests, Empty)
+{
+    SpatialGrid grid(1.0f, 4);
+    grid.Rebuild(nullptr, 0, 0);
+
+    EXPECT_TRUE(grid.IsEmpty());
+
+    size_t visitCount = 0;
+    grid.VisitInRadius(vec2f::zero(), 10.0f, [&](ElementIndex) { ++visitCount; });
+    grid.VisitAlongSegment(vec2f::zero(), vec2f(10.0f, 10.0f), 1.0f, [&](ElementIndex) { ++visitCount; });
+
+    EXPECT_EQ(visitCount, 0u);
+}
+
+TEST(SpatialGridTests, VisitInRadius_VisitsAllElementsInRadius)
+{
+    std::vector<vec2f> const positions = MakeRandomPositions(2000, 50.0f);
+
+    SpatialGrid grid(2.0f, 4);
+    grid.Rebuild(positions.data(), 0, static_cast<ElementIndex>(positions.size()));
+
+    for (vec2f const center : { vec2f::zero(), vec2f(30.0f, -20.0f), vec2f(-49.0f, 49.0f), vec2f(200.0f, 0.0f) })
+    {
+        for (float const radius : { 0.5f, 3.0f, 12.0f, 300.0f })
+        {
+            std::vector<ElementIndex> visited;
+            grid.VisitInRadius(center, radius, [&](ElementIndex e) { visited.push_back(e); });
+
+            // No duplicates
+            std::sort(visited.begin(), visited.end());
+            EXPECT_TRUE(std::adjacent_find(visited.begin(), visited.end()) == visited.end());
+
+            // All in radius
+            for (ElementIndex e = 0; e < positions.size(); ++e)
+            {
+                if ((positions[e] - center).length() < radius)
+                {
+                    EXPECT_TRUE(std::binary_search(visited.begin(), visited.end(), e));
+                }
+            }
+        }
+    }
+}
+
+TEST(SpatialGridTests, VisitInRadius_HonorsRange)
+{
+    std::vector<vec2f> const positions = MakeRandomPositions(100, 5.0f);
+
+    SpatialGrid grid(1.0f, 4);
+    grid.Rebuild(positions.data(), 10, 20);
+
+    std::vector<ElementIndex> visited;
+    grid.VisitInRadius(vec2f::zero(), 100.0f, [&](ElementIndex e) { visited.push_back(e); });
+
+    std::sort(visited.begin(), visited.end());
+    ASSERT_EQ(visited.size(), 10u);
+    EXPECT_EQ(visited.front(), 10u);
+    EXPECT_EQ(visited.back(), 19u);
+}
+
+TEST(SpatialGridTests, VisitInRadius_SparseElements)
+{
+    // Far apart elements - forces the grid to grow its cells
+    std::vector<vec2f> const positions = {
+        vec2f(-5000.0f, -5000.0f),
+        vec2f(0.0f, 0.0f),
+        vec2f(0.5f, 0.0f),
+        vec2f(5000.0f, 5000.0f) };
+
+    SpatialGrid grid(1.0f, 4);
+    grid.Rebuild(positions.data(), 0, static_cast<ElementIndex>(positions.size()));
+
+    std::vector<ElementIndex> visited;
+    grid.VisitInRadius(vec2f::zero(), 1.0f, [&](ElementIndex e) { visited.push_back(e); });
+
+    std::sort(visited.begin(), visited.end());
+    ASSERT_GE(visited.size(), 2u);
+    EXPECT_TRUE(std::binary_search(visited.begin(), visited.end(), 1u));
+    EXPECT_TRUE(std::binary_search(visited.begin(), visited.end(), 2u));
+}
+
+TEST(SpatialGridTests, VisitAlongSegment_VisitsAllElementsNearSegment)
+{
+    std::vector<vec2f> const positions = MakeRandomPositions(2000, 50.0f);
+
+    SpatialGrid grid(2.0f, 4);
+    grid.Rebuild(positions.data(), 0, static_cast<ElementIndex>(positions.size()));
+
+    std::vector<std::pair<vec2f, vec2f>> const segments = {
+        { vec2f(-40.0f, -40.0f), vec2f(40.0f, 40.0f) },
+        { vec2f(40.0f, -10.0f), vec2f(-40.0f, -12.0f) },
+        { vec2f(3.0f, 45.0f), vec2f(3.5f, -45.0f) },
+        { vec2f(-10.0f, 5.0f), vec2f(10.0f, 5.0f) }, // Horizontal
+        { vec2f(1.0f, 1.0f), vec2f(1.0f, 1.0f) } // Degenerate
+    };
+
+    for (auto const & segment : segments)
+    {
+        for (float const radius : { 0.25f, 3.0f })
+        {
+            std::vector<ElementIndex> visited;
+            grid.VisitAlongSegment(segment.first, segment.second, radius, [&](ElementIndex e) { visited.push_back(e); });
+
+            std::sort(visited.begin(), visited.end());
+            EXPECT_TRUE(std::adjacent_find(visited.begin(), visited.end()) == visited.end());
+
+            for (ElementIndex e = 0; e < positions.size(); ++e)
+            {
+                if (Geometry::Segment::DistanceToPoint(segment.first, segment.second, positions[e]) < radius)
+                {
+                    EXPECT_TRUE(std::binary_search(visited.begin(), visited.end(), e));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include <Simulation/SpringRelaxationModeSelector.h>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    // Runs the current evaluation to completion, timing each candidate with the given function
+    template<typename TTimer>
+    size_t RunEvaluation(
+        SpringRelaxationModeSelector & selector,
+        TTimer && timer)
+    {
+        size_t stepCount = 0;
+        while (selector.IsEvaluating())
+        {
+            selector.Update(timer(selector.GetChoice()), 0);
+            ++stepCount;
+
+            if (stepCount > 1000)
+            {
+                break;
+            }
+        }
+
+        return stepCount;
+    }
+}
+
+TEST(SpringRelaxationModeSelectorTests, SmallShip_SingleThread_NoEvaluation)
+{
+    SpringRelaxationModeSelector selector;
+    selector.Reset(100, 8);
+
+    EXPECT_FALSE(selector.IsEvaluating());
+    EXPECT_EQ(SpringRelaxationParallelComputationModeType::StepByStep, selector.GetChoice().Mode);
+    EXPECT_EQ(1u, selector.GetChoice().Parallelism);
+
+    // Never re-evaluates
+    EXPECT_FALSE(selector.Update(1.0f, 100));
+    EXPECT_FALSE(selector.IsEvaluating());
+}
+
+TEST(SpringRelaxationModeSelectorTests, NoParallelism_NoEvaluation)
+{
+    SpringRelaxationModeSelector selector;
+    selector.Reset(1000000, 1);
+
+    EXPECT_FALSE(selector.IsEvaluating());
+    EXPECT_EQ(1u, selector.GetChoice().Parallelism);
+}
+
+TEST(SpringRelaxationModeSelectorTests, LargeShip_ChoosesFastestCandidate)
+{
+    SpringRelaxationModeSelector selector;
+    selector.Reset(1000000, 4);
+
+    EXPECT_TRUE(selector.IsEvaluating());
+
+    RunEvaluation(
+        selector,
+        [](SpringRelaxationModeSelector::Choice const & choice)
+        {
+            if (choice.Mode == SpringRelaxationParallelComputationModeType::Hybrid)
+                return 1.0f;
+            else if (choice.Parallelism == 1)
+                return 4.0f;
+            else
+                return 2.0f;
+        });
+
+    EXPECT_FALSE(selector.IsEvaluating());
+    EXPECT_EQ(SpringRelaxationParallelComputationModeType::Hybrid, selector.GetChoice().Mode);
+    EXPECT_EQ(4u, selector.GetChoice().Parallelism);
+}
+
+TEST(SpringRelaxationModeSelectorTests, WarmupStepsAreNotMeasured)
+{
+    SpringRelaxationModeSelector selector;
+    selector.Reset(1000000, 4);
+
+    // The first candidate is very slow on its first step only
+    size_t firstCandidateStep = 0;
+    RunEvaluation(
+        selector,
+        [&firstCandidateStep](SpringRelaxationModeSelector::Choice const & choice)
+        {
+            if (choice.Mode == SpringRelaxationParallelComputationModeType::StepByStep && choice.Parallelism == 1)
+                return (firstCandidateStep++ == 0) ? 1000.0f : 1.0f;
+            else
+                return 2.0f;
+        });
+
+    EXPECT_EQ(SpringRelaxationParallelComputationModeType::StepByStep, selector.GetChoice().Mode);
+    EXPECT_EQ(1u, selector.GetChoice().Parallelism);
+}
+
+TEST(SpringRelaxationModeSelectorTests, ReevaluatesWhenShipBreaks)
+{
+    SpringRelaxationModeSelector selector;
+    selector.Reset(10000, 4);
+
+    RunEvaluation(selector, [](SpringRelaxationModeSelector::Choice const &) { return 1.0f; });
+    ASSERT_FALSE(selector.IsEvaluating());
+
+    // A few broken springs are not enough
+    selector.Update(1.0f, 100);
+    EXPECT_FALSE(selector.IsEvaluating());
+
+    // Many are
+    selector.Update(1.0f, 5000);
+    EXPECT_TRUE(selector.IsEvaluating());
+}
@@ -0,0 +1,114 @@
+#include <Core/SpscRingBuffer.h>
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+TEST(SpscRingBufferTests, Empty)
+{
+    SpscRingBuffer<int, 4> ring;
+
+    EXPECT_TRUE(ring.IsEmpty());
+
+    int element;
+    EXPECT_FALSE(ring.TryPop(element));
+}
+
+TEST(SpscRingBufferTests, PushPop_Fifo)
+{
+    SpscRingBuffer<int, 4> ring;
+
+    EXPECT_TRUE(ring.TryPush(1));
+    EXPECT_TRUE(ring.TryPush(2));
+    EXPECT_TRUE(ring.TryPush(3));
+
+    EXPECT_FALSE(ring.IsEmpty());
+
+    int element;
+    EXPECT_TRUE(ring.TryPop(element));
+    EXPECT_EQ(element, 1);
+    EXPECT_TRUE(ring.TryPop(element));
+    EXPECT_EQ(element, 2);
+    EXPECT_TRUE(ring.TryPop(element));
+    EXPECT_EQ(element, 3);
+
+    EXPECT_FALSE(ring.TryPop(element));
+    EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST(SpscRingBufferTests, Full)
+{
+    SpscRingBuffer<int, 4> ring;
+
+    EXPECT_TRUE(ring.TryPush(1));
+    EXPECT_TRUE(ring.TryPush(2));
+    EXPECT_TRUE(ring.TryPush(3));
+    EXPECT_TRUE(ring.TryPush(4));
+    EXPECT_FALSE(ring.TryPush(5));
+
+    int element;
+    EXPECT_TRUE(ring.TryPop(element));
+    EXPECT_EQ(element, 1);
+
+    EXPECT_TRUE(ring.TryPush(5));
+    EXPECT_FALSE(ring.TryPush(6));
+}
+
+TEST(SpscRingBufferTests, WrapsAround)
+{
+    SpscRingBuffer<int, 4> ring;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(ring.TryPush(i));
+        EXPECT_TRUE(ring.TryPush(i + 1000));
+
+        int element;
+        EXPECT_TRUE(ring.TryPop(element));
+        EXPECT_EQ(element, i);
+        EXPECT_TRUE(ring.TryPop(element));
+        EXPECT_EQ(element, i + 1000);
+    }
+
+    EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST(SpscRingBufferTests, ProducerAndConsumerThreads)
+{
+    SpscRingBuffer<size_t, 16> ring;
+
+    size_t constexpr ElementCount = 100000;
+
+    std::thread producer(
+        [&ring]()
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                while (!ring.TryPush(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    size_t expectedElement = 0;
+    bool isInOrder = true;
+    while (expectedElement < ElementCount)
+    {
+        size_t element;
+        if (ring.TryPop(element))
+        {
+            isInOrder = isInOrder && (element == expectedElement);
+            ++expectedElement;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(isInOrder);
+    EXPECT_TRUE(ring.IsEmpty());
+}
@@ -0,0 +1,71 @@
+#include <Core/StartupTimeline.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+TEST(StartupTimelineTests, Stages_SortedByStartTime)
+{
+    StartupTimeline timeline;
+
+    auto const t0 = GameChronometer::Now();
+
+    timeline.RecordStage("B", t0 + std::chrono::milliseconds(20), t0 + std::chrono::milliseconds(30));
+    timeline.RecordStage("A", t0 + std::chrono::milliseconds(10), t0 + std::chrono::milliseconds(40));
+
+    auto const stages = timeline.GetStages();
+
+    ASSERT_EQ(stages.size(), 2u);
+
+    EXPECT_EQ(std::string(stages[0].Name), "A");
+    EXPECT_EQ(stages[0].Duration, std::chrono::milliseconds(30));
+    EXPECT_EQ(std::string(stages[1].Name), "B");
+    EXPECT_EQ(stages[1].Duration, std::chrono::milliseconds(10));
+    EXPECT_EQ(stages[1].StartOffset - stages[0].StartOffset, std::chrono::milliseconds(10));
+}
+
+TEST(StartupTimelineTests, Stages_ThreadOrdinals)
+{
+    StartupTimeline timeline;
+
+    {
+        ScopedStartupStage const stage("Main1", timeline);
+    }
+
+    std::thread([&timeline]()
+        {
+            ScopedStartupStage const stage("Other", timeline);
+        }).join();
+
+    {
+        ScopedStartupStage const stage("Main2", timeline);
+    }
+
+    auto const stages = timeline.GetStages();
+
+    ASSERT_EQ(stages.size(), 3u);
+
+    EXPECT_EQ(std::string(stages[0].Name), "Main1");
+    EXPECT_EQ(stages[0].ThreadOrdinal, 0u);
+    EXPECT_EQ(std::string(stages[1].Name), "Other");
+    EXPECT_EQ(stages[1].ThreadOrdinal, 1u);
+    EXPECT_EQ(std::string(stages[2].Name), "Main2");
+    EXPECT_EQ(stages[2].ThreadOrdinal, 0u);
+}
+
+TEST(StartupTimelineTests, LogAndClear_Clears)
+{
+    StartupTimeline timeline;
+
+    {
+        ScopedStartupStage const stage("Stage", timeline);
+    }
+
+    ASSERT_EQ(timeline.GetStages().size(), 1u);
+
+    timeline.LogAndClear();
+
+    EXPECT_TRUE(timeline.GetStages().empty());
+}
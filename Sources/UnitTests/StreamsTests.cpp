@@ -43,6 +43,30 @@ TEST(Streams, MemoryBinaryReadStream)
     EXPECT_EQ(buffer[1], 0x02);
 }
 
+TEST(Streams, MemoryBinaryReadStream_ReadInPlace)
+{
+    std::vector<std::uint8_t> data{
+        0x00, 0x01, 0x02, 0x03
+    };
+
+    MemoryBinaryReadStream stream(std::move(data));
+
+    stream.SetPosition(1u);
+
+    std::uint8_t const * inPlaceData = stream.ReadInPlace(2u);
+
+    ASSERT_NE(inPlaceData, nullptr);
+    EXPECT_EQ(stream.GetCurrentPosition(), 3u);
+    EXPECT_EQ(inPlaceData[0], 0x01);
+    EXPECT_EQ(inPlaceData[1], 0x02);
+
+    // Not enough data left
+    inPlaceData = stream.ReadInPlace(2u);
+
+    EXPECT_EQ(inPlaceData, nullptr);
+    EXPECT_EQ(stream.GetCurrentPosition(), 3u);
+}
+
 TEST(Streams, MemoryTextReadStream_ReadAll)
 {
     std::string data = " Hello\nWorld\r\nOut There! ";
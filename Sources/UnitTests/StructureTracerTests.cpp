@@ -0,0 +1,205 @@
+#include <ShipBuilderLib/StructureTracer.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace ShipBuilder {
+
+namespace {
+
+// Straightforward, single-threaded, two-pass tracing, as reference
+typename LayerTypeTraits<LayerType::Structural>::buffer_type ReferenceTrace(
+    RgbaImageData const & texture,
+    ImageRect const & textureRect,
+    ShipSpaceRect const & shipRect,
+    vec2f const & shipToTexture,
+    StructuralMaterial const * edgeMaterial,
+    StructuralMaterial const * fillMaterial,
+    std::uint8_t alphaThreshold)
+{
+    auto buffer = LayerTypeTraits<LayerType::Structural>::buffer_type(shipRect.size);
+    buffer.Fill(StructuralElement(nullptr));
+
+    auto const writeParticle = [&](ShipSpaceCoordinates s, bool isEdge)
+    {
+        if (s.IsInSize(shipRect.size))
+        {
+            if (isEdge)
+                buffer[s] = StructuralElement(edgeMaterial);
+            else if (buffer[s].Material == nullptr)
+                buffer[s] = StructuralElement(fillMaterial);
+        }
+    };
+
+    for (int tx = textureRect.origin.x; tx < textureRect.origin.x + textureRect.size.width; ++tx)
+    {
+        int const sx = static_cast<int>(std::floor(static_cast<float>(tx) / shipToTexture.x)) - shipRect.origin.x;
+        bool isScanLineFull = texture[{tx, textureRect.origin.y}].a > alphaThreshold;
+        for (int ty = textureRect.origin.y + 1; ty < textureRect.origin.y + textureRect.size.height; ++ty)
+        {
+            bool const isPixelFull = texture[{tx, ty}].a > alphaThreshold;
+            if (!isScanLineFull && isPixelFull)
+                writeParticle({ sx, static_cast<int>(std::floor(static_cast<float>(ty) / shipToTexture.y - 0.5f)) - shipRect.origin.y }, true);
+            else if (isScanLineFull && !isPixelFull)
+                writeParticle({ sx, static_cast<int>(std::floor(static_cast<float>(ty - 1) / shipToTexture.y - 0.5f)) + 1 - shipRect.origin.y }, true);
+            else if (isScanLineFull && isPixelFull)
+                writeParticle({ sx, static_cast<int>(std::floor(static_cast<float>(ty) / shipToTexture.y - 0.5f)) - shipRect.origin.y }, false);
+            isScanLineFull = isPixelFull;
+        }
+    }
+
+    for (int ty = textureRect.origin.y; ty < textureRect.origin.y + textureRect.size.height; ++ty)
+    {
+        int const sy = static_cast<int>(std::floor(static_cast<float>(ty) / shipToTexture.y)) - shipRect.origin.y;
+        bool isScanLineFull = texture[{textureRect.origin.x, ty}].a > alphaThreshold;
+        for (int tx = textureRect.origin.x + 1; tx < textureRect.origin.x + textureRect.size.width; ++tx)
+        {
+            bool const isPixelFull = texture[{tx, ty}].a > alphaThreshold;
+            if (!isScanLineFull && isPixelFull)
+                writeParticle({ static_cast<int>(std::floor(static_cast<float>(tx) / shipToTexture.x - 0.5f)) - shipRect.origin.x, sy }, true);
+            else if (isScanLineFull && !isPixelFull)
+                writeParticle({ static_cast<int>(std::floor(static_cast<float>(tx - 1) / shipToTexture.x - 0.5f)) + 1 - shipRect.origin.x, sy }, true);
+            else if (isScanLineFull && isPixelFull)
+                writeParticle({ static_cast<int>(std::floor(static_cast<float>(tx) / shipToTexture.x - 0.5f)) - shipRect.origin.x, sy }, false);
+            isScanLineFull = isPixelFull;
+        }
+    }
+
+    return buffer;
+}
+
+RgbaImageData MakeBlobTexture(ImageSize const & size)
+{
+    // Some opaque blobs with soft borders, plus noise
+    RgbaImageData texture(size, rgbaColor(0, 0, 0, 0));
+
+    std::srand(42);
+    for (int b = 0; b < 6; ++b)
+    {
+        float const cx = static_cast<float>(std::rand() % size.width);
+        float const cy = static_cast<float>(std::rand() % size.height);
+        float const r = static_cast<float>(5 + std::rand() % (size.width / 4));
+        for (int y = 0; y < size.height; ++y)
+        {
+            for (int x = 0; x < size.width; ++x)
+            {
+                float const d = std::sqrt((x - cx) * (x - cx) + (y - cy) * (y - cy));
+                if (d < r)
+                {
+                    texture[{x, y}].a = static_cast<std::uint8_t>(std::min(255.0f, (r - d) * 40.0f));
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < size.width * size.height / 50; ++i)
+    {
+        texture[{std::rand() % size.width, std::rand() % size.height}].a = static_cast<std::uint8_t>(std::rand() % 256);
+    }
+
+    return texture;
+}
+
+}
+
+class StructureTracerTests : public testing::TestWithParam<std::tuple<float, size_t>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    StructureTracerTests,
+    StructureTracerTests,
+    ::testing::Values(
+        std::make_tuple(1.0f, 1),
+        std::make_tuple(1.0f, 4),
+        std::make_tuple(2.0f, 3),
+        std::make_tuple(2.5f, 8),
+        std::make_tuple(4.0f, 5)
+    ));
+
+TEST_P(StructureTracerTests, MatchesReference)
+{
+    float const magnification = std::get<0>(GetParam());
+    size_t const parallelism = std::get<1>(GetParam());
+
+    ShipSpaceSize const shipSize(80, 70);
+    ImageSize const textureSize(
+        static_cast<int>(shipSize.width * magnification),
+        static_cast<int>(shipSize.height * magnification));
+    vec2f const shipToTexture(
+        static_cast<float>(textureSize.width) / static_cast<float>(shipSize.width),
+        static_cast<float>(textureSize.height) / static_cast<float>(shipSize.height));
+
+    RgbaImageData const texture = MakeBlobTexture(textureSize);
+
+    StructuralMaterial const edgeMaterial = MakeTestStructuralMaterial("Edge", rgbColor(1, 2, 3));
+    StructuralMaterial const fillMaterial = MakeTestStructuralMaterial("Fill", rgbColor(4, 5, 6));
+
+    for (ImageRect const & textureRect : {
+        ImageRect(textureSize),
+        ImageRect(ImageCoordinates(7, 11), ImageSize(textureSize.width / 2, textureSize.height - 20)) })
+    {
+        ShipSpaceRect const shipRect(
+            ShipSpaceCoordinates(
+                static_cast<int>(std::floor(textureRect.origin.x / shipToTexture.x)),
+                static_cast<int>(std::floor(textureRect.origin.y / shipToTexture.y))),
+            ShipSpaceSize(
+                static_cast<int>(std::ceil(textureRect.size.width / shipToTexture.x)) + 1,
+                static_cast<int>(std::ceil(textureRect.size.height / shipToTexture.y)) + 1));
+
+        auto const expected = ReferenceTrace(texture, textureRect, shipRect, shipToTexture, &edgeMaterial, &fillMaterial, 128);
+        auto const actual = StructureTracer::MakeTrace(texture, textureRect, shipRect, shipToTexture, &edgeMaterial, &fillMaterial, 128, parallelism);
+
+        ASSERT_EQ(actual.Size, expected.Size);
+
+        size_t edgeCount = 0;
+        for (int y = 0; y < expected.Size.height; ++y)
+        {
+            for (int x = 0; x < expected.Size.width; ++x)
+            {
+                EXPECT_EQ(actual[ShipSpaceCoordinates(x, y)].Material, expected[ShipSpaceCoordinates(x, y)].Material) << "at " << x << "," << y;
+
+                if (expected[{x, y}].Material == &edgeMaterial)
+                {
+                    ++edgeCount;
+                }
+            }
+        }
+
+        // Make sure the test is meaningful
+        EXPECT_GT(edgeCount, 0u);
+    }
+}
+
+TEST(StructureTracerTests_Basic, FullyOpaque)
+{
+    StructuralMaterial const edgeMaterial = MakeTestStructuralMaterial("Edge", rgbColor(1, 2, 3));
+    StructuralMaterial const fillMaterial = MakeTestStructuralMaterial("Fill", rgbColor(4, 5, 6));
+
+    RgbaImageData const texture(ImageSize(8, 8), rgbaColor(10, 10, 10, 255));
+
+    auto const trace = StructureTracer::MakeTrace(
+        texture,
+        ImageRect(texture.Size),
+        ShipSpaceRect(ShipSpaceCoordinates(0, 0), ShipSpaceSize(4, 4)),
+        vec2f(2.0f, 2.0f),
+        &edgeMaterial,
+        &fillMaterial,
+        0,
+        2);
+
+    // No transitions, hence just filler
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            EXPECT_EQ(trace[ShipSpaceCoordinates(x, y)].Material, &fillMaterial);
+        }
+    }
+}
+
+}
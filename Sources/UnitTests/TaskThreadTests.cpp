@@ -1,13 +1,17 @@
 #include <Core/TaskThread.h>
 
+#include <array>
+#include <atomic>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 TEST(TaskThreadTests, Synchronous)
 {
-    ThreadManager threadManager{ false, 16, [](std::string const &, bool) {} };
-    TaskThread t("Test thread", true, threadManager);
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
 
     bool isDone = false;
     auto tc = t.QueueTask(
@@ -16,15 +20,15 @@ TEST(TaskThreadTests, Synchronous)
             isDone = true;
         });
 
-    tc->Wait();
+    tc.Wait();
 
     EXPECT_TRUE(isDone);
 }
 
 TEST(TaskThreadTests, Asynchronous)
 {
-    ThreadManager threadManager{ false, 16, [](std::string const &, bool) {} };
-    TaskThread t("Test thread", true, threadManager);
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
 
     bool isDone = false;
     t.QueueTask(
@@ -43,8 +47,8 @@ TEST(TaskThreadTests, Asynchronous)
 
 TEST(TaskThreadTests, RunSynchronously)
 {
-    ThreadManager threadManager{ false, 16, [](std::string const &, bool) {} };
-    TaskThread t("Test thread", true, threadManager);
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
 
     bool isDone = false;
     t.RunSynchronously(
@@ -58,8 +62,8 @@ TEST(TaskThreadTests, RunSynchronously)
 
 TEST(TaskThreadTests, QueueSynchronizationPoint)
 {
-    ThreadManager threadManager{ false, 16, [](std::string const &, bool) {} };
-    TaskThread t("Test thread", true, threadManager);
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
 
     bool isDone = false;
     t.RunSynchronously(
@@ -69,7 +73,86 @@ TEST(TaskThreadTests, QueueSynchronizationPoint)
         });
 
     auto tc = t.QueueSynchronizationPoint();
-    tc->Wait();
+    tc.Wait();
 
     EXPECT_TRUE(isDone);
-}
\ No newline at end of file
+}
+
+TEST(TaskThreadTests, IsCompleted)
+{
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
+
+    std::atomic<bool> isReleased = false;
+    auto tc = t.QueueTask(
+        [&isReleased]()
+        {
+            while (!isReleased.load())
+            {
+                std::this_thread::yield();
+            }
+        });
+
+    EXPECT_FALSE(tc.IsCompleted());
+
+    isReleased.store(true);
+    tc.Wait();
+
+    EXPECT_TRUE(tc.IsCompleted());
+}
+
+TEST(TaskThreadTests, ManyTasks_MoreThanQueueCapacity)
+{
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
+
+    std::vector<int> results;
+    std::array<int, 64> largePayload{}; // Too large to be stored in-place
+    largePayload[63] = 1000;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            t.QueueTask(
+                [&results, i]()
+                {
+                    results.push_back(i);
+                });
+        }
+        else
+        {
+            t.QueueTask(
+                [&results, i, largePayload]()
+                {
+                    results.push_back(i + largePayload[63]);
+                });
+        }
+    }
+
+    auto tc = t.QueueSynchronizationPoint();
+    tc.Wait();
+
+    ASSERT_EQ(1000u, results.size());
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(i % 2 == 0 ? i : i + 1000, results[i]);
+    }
+}
+
+TEST(TaskThreadTests, Exception)
+{
+    ThreadManager threadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    TaskThread t(ThreadManager::ThreadTaskKind::Other, "Test thread", 0, true, threadManager);
+
+    auto tc1 = t.QueueTask(
+        []()
+        {
+            throw std::runtime_error("Test exception");
+        });
+
+    auto tc2 = t.QueueSynchronizationPoint();
+
+    EXPECT_THROW(tc1.Wait(), std::runtime_error);
+    EXPECT_NO_THROW(tc2.Wait());
+}
@@ -0,0 +1,80 @@
+#include <Game/TelemetrySink.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace {
+
+    class StringTextWriteStream final : public TextWriteStream
+    {
+    public:
+
+        StringTextWriteStream(std::string & data)
+            : mData(data)
+        {}
+
+        void Write(std::string const & content) override
+        {
+            mData += content;
+        }
+
+    private:
+
+        std::string & mData;
+    };
+
+    TelemetrySink::Sample MakeSample(std::uint32_t frameCount)
+    {
+        TelemetrySink::Sample sample{};
+        sample.FrameCount = frameCount;
+        sample.FishCount = 7;
+        return sample;
+    }
+
+    size_t CountLines(std::string const & data)
+    {
+        return static_cast<size_t>(std::count(data.cbegin(), data.cend(), '\n'));
+    }
+}
+
+TEST(TelemetrySinkTests, Csv_HeaderAndSamples)
+{
+    std::string data;
+
+    {
+        TelemetrySink sink(std::make_unique<StringTextWriteStream>(data), TelemetrySink::FormatType::Csv);
+
+        EXPECT_TRUE(sink.Publish(MakeSample(10)));
+        EXPECT_TRUE(sink.Publish(MakeSample(11)));
+    }
+
+    ASSERT_EQ(CountLines(data), 3u);
+
+    auto const header = data.substr(0, data.find('\n'));
+    EXPECT_EQ(header.rfind("wall_clock_s,simulation_s,frame_count,", 0), 0u);
+    EXPECT_NE(header.find(",fish_count"), std::string::npos);
+
+    // Same number of columns in header and samples
+    auto const firstSample = data.substr(header.size() + 1, data.find('\n', header.size() + 1) - header.size() - 1);
+    EXPECT_EQ(std::count(header.cbegin(), header.cend(), ','), std::count(firstSample.cbegin(), firstSample.cend(), ','));
+    EXPECT_EQ(firstSample.substr(firstSample.rfind(',') + 1), "7");
+}
+
+TEST(TelemetrySinkTests, Ndjson_OneObjectPerSample)
+{
+    std::string data;
+
+    {
+        TelemetrySink sink(std::make_unique<StringTextWriteStream>(data), TelemetrySink::FormatType::Ndjson);
+
+        EXPECT_TRUE(sink.Publish(MakeSample(10)));
+    }
+
+    ASSERT_EQ(CountLines(data), 1u);
+    EXPECT_EQ(data.front(), '{');
+    EXPECT_NE(data.find("\"frame_count\":10,"), std::string::npos);
+    EXPECT_NE(data.find("\"fish_count\":7}\n"), std::string::npos);
+}
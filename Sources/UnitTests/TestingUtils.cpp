@@ -51,6 +51,14 @@ std::vector<IAssetManager::AssetDescriptor> TestAssetManager::EnumerateTextureDa
     return assetDescriptors;
 }
 
+std::uint64_t TestAssetManager::GetTextureDatabaseFrameStamp(std::string const & databaseName, std::string const & frameRelativePath) const
+{
+    assert(false); // Not needed by tests, so far
+    (void)databaseName;
+    (void)frameRelativePath;
+    return 0;
+}
+
 std::string TestAssetManager::GetMaterialTextureRelativePath(std::string const & materialTextureName) const
 {
     assert(false); // Not needed by tests, so far
@@ -109,6 +117,13 @@ std::unique_ptr<BinaryReadStream> TestAssetManager::LoadFont(std::string const &
     return nullptr;
 }
 
+std::unique_ptr<BinaryReadStream> TestAssetManager::TryLoadBakedFontSet(std::string const & fontSetName) const
+{
+    assert(false); // Not needed by tests, so far
+    (void)fontSetName;
+    return nullptr;
+}
+
 picojson::value TestAssetManager::LoadStructuralMaterialDatabase() const
 {
     assert(false); // Not needed by tests, so far
@@ -41,6 +41,7 @@ public:
     ImageSize GetTextureDatabaseFrameSize(std::string const & databaseName, std::string const & frameRelativePath) const override;
     RgbaImageData LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const override;
     std::vector<AssetDescriptor> EnumerateTextureDatabaseFrames(std::string const & databaseName) const override;
+    std::uint64_t GetTextureDatabaseFrameStamp(std::string const & databaseName, std::string const & frameRelativePath) const override;
 
     std::string GetMaterialTextureRelativePath(std::string const & materialTextureName) const override;
     RgbImageData LoadMaterialTexture(std::string const & frameRelativePath) const override;
@@ -53,6 +54,7 @@ public:
 
     std::vector<AssetDescriptor> EnumerateFonts(std::string const & fontSetName) const override;
     std::unique_ptr<BinaryReadStream> LoadFont(std::string const & fontSetName, std::string const & fontRelativePath) const override;
+    std::unique_ptr<BinaryReadStream> TryLoadBakedFontSet(std::string const & fontSetName) const override;
 
     picojson::value LoadStructuralMaterialDatabase() const override;
     picojson::value LoadElectricalMaterialDatabase() const override;
@@ -256,6 +258,19 @@ public:
         return filePaths;
     }
 
+    std::vector<std::filesystem::path> ListFilesRecursively(std::filesystem::path const & directoryPath) override
+    {
+        std::vector<std::filesystem::path> filePaths;
+
+        for (auto const & kv : mFileMap)
+        {
+            if (IsParentOf(directoryPath, kv.first))
+                filePaths.push_back(kv.first);
+        }
+
+        return filePaths;
+    }
+
     void DeleteFile(std::filesystem::path const & filePath) override
     {
         auto it = mFileMap.find(filePath);
@@ -314,6 +329,7 @@ public:
     MOCK_METHOD1(OpenBinaryInputStream, std::unique_ptr<BinaryReadStream>(std::filesystem::path const & filePath));
     MOCK_METHOD1(OpenTextInputStream, std::unique_ptr<TextReadStream>(std::filesystem::path const & filePath));
     MOCK_METHOD1(ListFiles, std::vector<std::filesystem::path>(std::filesystem::path const & directoryPath));
+    MOCK_METHOD1(ListFilesRecursively, std::vector<std::filesystem::path>(std::filesystem::path const & directoryPath));
     MOCK_METHOD1(DeleteFile, void(std::filesystem::path const & filePath));
     MOCK_METHOD2(RenameFile, void(std::filesystem::path const & oldFilePath, std::filesystem::path const & newFilePath));
 };
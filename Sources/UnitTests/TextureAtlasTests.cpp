@@ -611,3 +611,67 @@ TEST(TextureAtlasTests, Placement_Duplicates)
         atlas.Metadata.GetFrameMetadata({ MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, 1 }).TextureCoordinatesTopRight,
         atlas.Metadata.GetFrameMetadata({ MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, 2 }).TextureCoordinatesTopRight);
 }
+
+TEST(TextureAtlasTests, Cache_RoundTrip)
+{
+    std::vector<TextureAtlasFrameMetadata<MyTestTextureDatabase>> frames;
+    frames.emplace_back(
+        0.75f,
+        1.0f,
+        vec2f(0.25f, 0.5f),
+        vec2f(0.5f, 0.75f),
+        2,
+        0,
+        TextureFrameMetadata<MyTestTextureDatabase>(
+            ImageSize(6, 4),
+            1.0f, 2.0f,
+            false,
+            ImageCoordinates(3, 2),
+            vec2f(0.5f, 1.0f),
+            vec2f(0.5f, 0.5f),
+            TextureFrameId<MyTestTextureDatabase::MyTextureGroups>(MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, 0),
+            "Foo",
+            "Foo"));
+
+    RgbaImageData atlasImage(8, 4, rgbaColor(0x10, 0x20, 0x30, 0x40));
+    atlasImage[{3, 1}] = rgbaColor(0x01, 0x02, 0x03, 0x04);
+
+    TextureAtlas<MyTestTextureDatabase> const atlas(
+        TextureAtlasMetadata<MyTestTextureDatabase>(ImageSize(8, 4), TextureAtlasOptions::MipMappable, std::move(frames)),
+        std::move(atlasImage));
+
+    std::filesystem::path const cacheFilePath = std::filesystem::temp_directory_path() / "TextureAtlasTests_Cache_RoundTrip.atlas.cache";
+
+    TextureAtlasBuilder<MyTestTextureDatabase>::SaveCachedAtlas(atlas, cacheFilePath, 0x1234);
+    auto const cachedAtlas = TextureAtlasBuilder<MyTestTextureDatabase>::TryLoadCachedAtlas(cacheFilePath, 0x1234);
+
+    std::filesystem::remove(cacheFilePath);
+
+    ASSERT_TRUE(cachedAtlas.has_value());
+
+    EXPECT_EQ(cachedAtlas->Metadata.GetSize(), ImageSize(8, 4));
+    EXPECT_TRUE(cachedAtlas->Metadata.IsSuitableForMipMapping());
+    ASSERT_EQ(cachedAtlas->Metadata.GetFrameCount(), 1u);
+    EXPECT_EQ(cachedAtlas->Metadata.GetFrameMetadata("Foo").TextureCoordinatesBottomLeft, vec2f(0.25f, 0.5f));
+    EXPECT_EQ(cachedAtlas->Metadata.GetFrameMetadata("Foo").FrameMetadata.Size, ImageSize(6, 4));
+
+    EXPECT_EQ(cachedAtlas->Image.Size, ImageSize(8, 4));
+    EXPECT_EQ((cachedAtlas->Image[{0, 0}]), rgbaColor(0x10, 0x20, 0x30, 0x40));
+    EXPECT_EQ((cachedAtlas->Image[{3, 1}]), rgbaColor(0x01, 0x02, 0x03, 0x04));
+}
+
+TEST(TextureAtlasTests, Cache_RejectsDifferentKey)
+{
+    TextureAtlas<MyTestTextureDatabase> const atlas(
+        TextureAtlasMetadata<MyTestTextureDatabase>(ImageSize(4, 4), TextureAtlasOptions::None, {}),
+        RgbaImageData(4, 4, rgbaColor(0x10, 0x20, 0x30, 0x40)));
+
+    std::filesystem::path const cacheFilePath = std::filesystem::temp_directory_path() / "TextureAtlasTests_Cache_RejectsDifferentKey.atlas.cache";
+
+    TextureAtlasBuilder<MyTestTextureDatabase>::SaveCachedAtlas(atlas, cacheFilePath, 0x1234);
+    auto const cachedAtlas = TextureAtlasBuilder<MyTestTextureDatabase>::TryLoadCachedAtlas(cacheFilePath, 0x1235);
+
+    std::filesystem::remove(cacheFilePath);
+
+    EXPECT_FALSE(cachedAtlas.has_value());
+}
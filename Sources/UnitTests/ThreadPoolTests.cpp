@@ -1,6 +1,7 @@
 #include <Core/ThreadPool.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <vector>
 
@@ -14,7 +15,7 @@ public:
 
 protected:
 
-    ThreadManager mThreadManager{ false, 16, [](std::string const &, bool) {} };
+    ThreadManager mThreadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
 };
 
 INSTANTIATE_TEST_SUITE_P(
@@ -43,7 +44,7 @@ TEST_P(ThreadPoolTests_OneRuns, One_Runs)
     ASSERT_TRUE(std::none_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
 
     // Run
-    ThreadPool t(1, mThreadManager);
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, 1, mThreadManager);
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
@@ -57,7 +58,7 @@ public:
 
 protected:
 
-    ThreadManager mThreadManager{ false, 16, [](std::string const &, bool) {} };
+    ThreadManager mThreadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
 };
 
 INSTANTIATE_TEST_SUITE_P(
@@ -92,8 +93,219 @@ TEST_P(ThreadPoolTests_FourRuns, Four_Runs)
     ASSERT_TRUE(std::none_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
 
     // Run
-    ThreadPool t(4, mThreadManager);
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, 4, mThreadManager);
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
-}
\ No newline at end of file
+}
+
+TEST(ThreadPoolTests, Run_ManyTasks_ReusesPool)
+{
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, 4, threadManager);
+
+    std::atomic<int> counter{ 0 };
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 37; ++i)
+    {
+        tasks.emplace_back(
+            [&counter]()
+            {
+                ++counter;
+            });
+    }
+
+    for (int r = 0; r < 100; ++r)
+    {
+        t.Run(tasks);
+    }
+
+    EXPECT_EQ(counter.load(), 37 * 100);
+}
+
+TEST(ThreadPoolTests, Run_HotWorkers)
+{
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, 4, threadManager);
+
+    std::atomic<int> counter{ 0 };
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        tasks.emplace_back(
+            [&counter]()
+            {
+                ++counter;
+            });
+    }
+
+    t.SetAreWorkersHot(true);
+
+    for (int r = 0; r < 100; ++r)
+    {
+        t.Run(tasks);
+    }
+
+    // Workers go back to parking
+    t.SetAreWorkersHot(false);
+
+    for (int r = 0; r < 100; ++r)
+    {
+        t.Run(tasks);
+    }
+
+    EXPECT_EQ(counter.load(), 8 * 200);
+}
+
+TEST(ThreadPoolTests, Run_TasksSeeRunningThreadContext)
+{
+    ThreadManager threadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, 4, threadManager);
+
+    GameRandomEngine randomEngine;
+    GameWallClock wallClock;
+
+    std::vector<GameRandomEngine *> randomEngines(8, nullptr);
+    std::vector<GameWallClock *> wallClocks(8, nullptr);
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        tasks.emplace_back(
+            [&randomEngines, &wallClocks, i]()
+            {
+                randomEngines[i] = &GameRandomEngine::GetInstance();
+                wallClocks[i] = &GameWallClock::GetInstance();
+            });
+    }
+
+    {
+        GameRandomEngine::ThreadBinding const randomEngineBinding(&randomEngine);
+        GameWallClock::ThreadBinding const wallClockBinding(&wallClock);
+
+        t.Run(tasks);
+    }
+
+    EXPECT_TRUE(std::all_of(randomEngines.cbegin(), randomEngines.cend(), [&](auto * e) { return e == &randomEngine; }));
+    EXPECT_TRUE(std::all_of(wallClocks.cbegin(), wallClocks.cend(), [&](auto * c) { return c == &wallClock; }));
+
+    // Back to the process-wide instances
+    t.Run(tasks);
+
+    EXPECT_TRUE(std::all_of(randomEngines.cbegin(), randomEngines.cend(), [&](auto * e) { return e == &GameRandomEngine::GetInstance(); }));
+    EXPECT_NE(&randomEngine, &GameRandomEngine::GetInstance());
+}
+
+class ThreadPoolTests_TaskGraph : public testing::TestWithParam<size_t>
+{
+public:
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+protected:
+
+    ThreadManager mThreadManager{ false, 1, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    ThreadPoolTests_TaskGraph,
+    ThreadPoolTests_TaskGraph,
+    ::testing::Values(
+        1,
+        2,
+        4
+    ));
+
+TEST_P(ThreadPoolTests_TaskGraph, SingleTask)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, GetParam(), mThreadManager);
+
+    bool hasRun = false;
+
+    ThreadPool::TaskGraph graph;
+    graph.Add([&hasRun]() { hasRun = true; });
+
+    t.Run(graph);
+
+    EXPECT_TRUE(hasRun);
+}
+
+TEST_P(ThreadPoolTests_TaskGraph, ContinuationsRunAfterDependencies)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, GetParam(), mThreadManager);
+
+    //
+    //  a   b
+    //  |\ /
+    //  | c
+    //  |/
+    //  d
+    //
+
+    std::atomic<int> sequence{ 0 };
+    int aOrder = -1;
+    int bOrder = -1;
+    int cOrder = -1;
+    int dOrder = -1;
+
+    ThreadPool::TaskGraph graph;
+    auto const a = graph.Add([&]() { aOrder = sequence++; });
+    auto const b = graph.Add([&]() { bOrder = sequence++; });
+    auto const c = graph.Add([&]() { cOrder = sequence++; }, { a, b });
+    graph.Add([&]() { dOrder = sequence++; }, { a, c });
+
+    ASSERT_EQ(graph.GetSize(), 4u);
+
+    for (int r = 0; r < 50; ++r)
+    {
+        sequence = 0;
+
+        t.Run(graph);
+
+        EXPECT_EQ(sequence.load(), 4);
+        EXPECT_LT(aOrder, cOrder);
+        EXPECT_LT(bOrder, cOrder);
+        EXPECT_LT(aOrder, dOrder);
+        EXPECT_LT(cOrder, dOrder);
+    }
+}
+
+TEST_P(ThreadPoolTests_TaskGraph, WideFanOutFanIn)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::Simulation, GetParam(), mThreadManager);
+
+    size_t constexpr Width = 25;
+
+    std::vector<int> results(Width, 0);
+    int total = 0;
+
+    ThreadPool::TaskGraph graph;
+    auto const root = graph.Add([&]() { std::fill(results.begin(), results.end(), 0); });
+    std::vector<ThreadPool::TaskGraph::TaskId> middle;
+    for (size_t i = 0; i < Width; ++i)
+    {
+        middle.push_back(graph.Add([&results, i]() { results[i] = static_cast<int>(i); }, { root }));
+    }
+
+    // Sink depends on all middle tasks: chain it through a continuation of each
+    auto sink = middle[0];
+    for (size_t i = 1; i < Width; ++i)
+    {
+        sink = graph.Add([]() {}, { sink, middle[i] });
+    }
+
+    graph.Add(
+        [&]()
+        {
+            total = 0;
+            for (int r : results)
+                total += r;
+        },
+        { sink });
+
+    t.Run(graph);
+
+    EXPECT_EQ(total, static_cast<int>(Width * (Width - 1) / 2));
+}
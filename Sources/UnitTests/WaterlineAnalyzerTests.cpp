@@ -0,0 +1,100 @@
+#include <ShipBuilderLib/WaterlineAnalyzer.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+namespace ShipBuilder {
+
+namespace {
+
+class TestModel final : public IModelObservable
+{
+public:
+
+    explicit TestModel(StructuralLayerData && structuralLayer)
+        : mShipSize(structuralLayer.Buffer.Size)
+        , mStructuralLayer(std::move(structuralLayer))
+        , mShipMetadata("Test")
+        , mShipPhysicsData()
+        , mShipAutoTexturizationSettings()
+    {}
+
+    ShipSpaceSize const & GetShipSize() const override { return mShipSize; }
+    bool HasLayer(LayerType layer) const override { return layer == LayerType::Structural; }
+    bool IsDirty() const override { return false; }
+    bool IsLayerDirty(LayerType) const override { return false; }
+    ShipMetadata const & GetShipMetadata() const override { return mShipMetadata; }
+    ShipPhysicsData const & GetShipPhysicsData() const override { return mShipPhysicsData; }
+    std::optional<ShipAutoTexturizationSettings> const & GetShipAutoTexturizationSettings() const override { return mShipAutoTexturizationSettings; }
+    ModelMacroProperties GetModelMacroProperties() const override { return ModelMacroProperties(0, 0.0f, std::nullopt); }
+    StructuralLayerData const & GetStructuralLayer() const override { return mStructuralLayer; }
+
+private:
+
+    ShipSpaceSize const mShipSize;
+    StructuralLayerData const mStructuralLayer;
+    ShipMetadata const mShipMetadata;
+    ShipPhysicsData const mShipPhysicsData;
+    std::optional<ShipAutoTexturizationSettings> const mShipAutoTexturizationSettings;
+};
+
+}
+
+TEST(WaterlineAnalyzerTests, Buoyancy_MatchesPerParticleSum)
+{
+    StructuralMaterial material = MakeTestStructuralMaterial("Foo", rgbColor(1, 2, 3));
+    material.BuoyancyVolumeFill = 0.5f;
+
+    StructuralLayerData structuralLayer(ShipSpaceSize(37, 23));
+    for (int y = 0; y < 23; ++y)
+    {
+        for (int x = 0; x < 37; ++x)
+        {
+            if ((x * 7 + y * 3) % 5 != 0)
+            {
+                structuralLayer.Buffer[{x, y}] = StructuralElement(&material);
+            }
+        }
+    }
+
+    TestModel const model(std::move(structuralLayer));
+    WaterlineAnalyzer const analyzer(model);
+
+    for (float const angle : { 0.0f, 0.3f, -0.7f, 1.5707963f, 2.5f, -3.0f })
+    {
+        vec2f const waterlineCenter(15.3f, 11.6f);
+        vec2f const waterlineDirection = vec2f(0.0f, -1.0f).rotate(angle);
+
+        // Reference: per-particle sum
+        float expectedBuoyantForce = 0.0f;
+        vec2f expectedCenterOfBuoyancySum = vec2f::zero();
+        for (int y = 0; y < 23; ++y)
+        {
+            for (int x = 0; x < 37; ++x)
+            {
+                auto const coords = ShipSpaceCoordinates(x, y);
+                if (model.GetStructuralLayer().Buffer[coords].Material != nullptr
+                    && (coords.ToFloat() - waterlineCenter).dot(waterlineDirection) >= 0.0f)
+                {
+                    expectedBuoyantForce += 1000.0f * 0.5f;
+                    expectedCenterOfBuoyancySum += coords.ToFloat() * 1000.0f * 0.5f;
+                }
+            }
+        }
+
+        auto const [buoyantForce, centerOfBuoyancy] = analyzer.CalculateBuoyancyWithWaterline(waterlineCenter, waterlineDirection);
+
+        EXPECT_FLOAT_EQ(buoyantForce, expectedBuoyantForce);
+
+        if (expectedBuoyantForce != 0.0f)
+        {
+            EXPECT_NEAR(centerOfBuoyancy.x, expectedCenterOfBuoyancySum.x / expectedBuoyantForce, 0.001f);
+            EXPECT_NEAR(centerOfBuoyancy.y, expectedCenterOfBuoyancySum.y / expectedBuoyantForce, 0.001f);
+        }
+    }
+}
+
+}